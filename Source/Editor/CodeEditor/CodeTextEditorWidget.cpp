@@ -122,8 +122,9 @@ public:
         {
             keywords = glslKeywords;
         }
-        else if (gapi == Pegasus::PegasusDesc::DIRECT_3D)
+        else if (gapi == Pegasus::PegasusDesc::DIRECT_3D || gapi == Pegasus::PegasusDesc::NULL_GAPI)
         {
+            // the null backend runs the same hlsl shader assets as directx
             keywords = hlslKeywords;
         }
         else
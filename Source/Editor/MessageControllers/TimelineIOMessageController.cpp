@@ -170,8 +170,8 @@ unsigned ShadowLaneState::GetBlockCount() const
 void ShadowLaneState::Build(const ILaneProxy* proxy)
 {
     mRootState.insert(Str(PROP_LANE_NAME), QString(proxy->IsNameDefined() ? proxy->GetName() : ""));
-    IBlockProxy* blockList[LANE_MAX_NUM_BLOCKS];
-    unsigned int numBlocks = proxy->GetBlocks(blockList);
+    QVector<IBlockProxy*> blockList(static_cast<int>(proxy->GetNumBlocks()));
+    unsigned int numBlocks = blockList.isEmpty() ? 0 : proxy->GetBlocks(blockList.data());
     mRootState.insert(Str(PROP_BLOCK_COUNT), numBlocks);
 
     QVariantList blockQtList;    
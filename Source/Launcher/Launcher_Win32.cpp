@@ -62,19 +62,19 @@ void LogHandler(Pegasus::Core::LogChannel logChannel, const char * msgStr)
     std::time(&rawTime);
     std::tm timeInfo;
     localtime_s(&timeInfo, &rawTime);
-    static char timeString[10] = "";
+    char timeString[10] = "";
     std::strftime(timeString, 10, "%H:%M:%S", &timeInfo);
 
     // Convert the log channel to a string
-    static char logChannelString[5] = "";
+    char logChannelString[5] = "";
     logChannelString[0] = static_cast<char>((logChannel >> 24) & 0xFF);
     logChannelString[1] = static_cast<char>((logChannel >> 16) & 0xFF);
     logChannelString[2] = static_cast<char>((logChannel >>  8) & 0xFF);
     logChannelString[3] = static_cast<char>( logChannel        & 0xFF);
     logChannelString[4] = '\0';
 
-    // Build the log string
-    static char logBuffer[LOG_BUFFER_SIZE] = "";
+    // Build the log string (on the stack, the handler is called from the worker threads too)
+    char logBuffer[LOG_BUFFER_SIZE] = "";
     sprintf_s(logBuffer, "%s [%s] %s\n", timeString, logChannelString, msgStr);
 
     // Output the log string to the console
@@ -125,9 +125,9 @@ Pegasus::Core::AssertReturnCode AssertionHandler(const char * testStr,
         return Pegasus::Core::ASSERTION_IGNOREALL;
     }
 
-    // Prepare the content of the dialog box
-    static char * titleText = nullptr;
-    static char assertionText[ASSERTIONERROR_BUFFER_SIZE] = "";
+    // Prepare the content of the dialog box (on the stack, assertions can fail on several threads at once)
+    const char * titleText = nullptr;
+    char assertionText[ASSERTIONERROR_BUFFER_SIZE] = "";
     if (testStr == "FAILURE")
     {
         titleText = "Failure";
@@ -148,7 +148,7 @@ Pegasus::Core::AssertReturnCode AssertionHandler(const char * testStr,
 
 #if PEGASUS_ENABLE_LOG
     //! Send the text of the assertion error to the log
-    static char logBuffer[ASSERTIONERROR_BUFFER_SIZE];
+    char logBuffer[ASSERTIONERROR_BUFFER_SIZE];
     sprintf_s(logBuffer, "%s. %s", titleText, assertionText);
     LogHandler('ASRT', logBuffer);
 #endif  // PEGASUS_ENABLE_LOG
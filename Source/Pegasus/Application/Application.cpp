@@ -19,6 +19,8 @@
 #include "Pegasus/Application/AppWindowComponentFactory.h"
 #include "Pegasus/Application/Components/EditorComponents.h"
 #include "Pegasus/Core/Time.h"
+#include "Pegasus/Core/ParallelFor.h"
+#include "Pegasus/Core/Io.h"
 #include "Pegasus/Graph/NodeManager.h"
 #include "Pegasus/Memory/MemoryManager.h"
 #include "Pegasus/Render/IDevice.h"
@@ -90,6 +92,12 @@ Application::Application(const ApplicationConfig& config)
     // Set up the time system
     Core::InitializePegasusTime();
 
+    // Set up the worker threads used by the node generators
+    Core::InitializeParallelFor();
+
+    // Set up the threads serving the asynchronous file reads
+    Io::InitializeIoThreads();
+
 
     // Set up window manager
     mWindowManager = PG_NEW(windowAlloc, -1, "AppWindowManager", Alloc::PG_MEM_PERM) AppWindowManager(windowAlloc);
@@ -188,6 +196,8 @@ Application::~Application()
 #if PEGASUS_ENABLE_BS_REFLECTION_INFO
     PG_DELETE(nodeAlloc, mBsReflectionInfo);
 #endif
+    // No read can be pending once the IO manager is gone
+    Io::ShutdownIoThreads();
     PG_DELETE(coreAlloc, mIoManager);
     
     //Kill device and context
@@ -197,6 +207,8 @@ Application::~Application()
     mDevice = nullptr;
     PG_LOG('APPL', "Device Destroyed");
 
+    Core::ShutdownParallelFor();
+
     // Tear down debugging facilities
 #if PEGASUS_ENABLE_ASSERT
     Core::AssertionManager::GetInstance()->UnregisterHandler();
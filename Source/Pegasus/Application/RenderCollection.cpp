@@ -25,6 +25,7 @@
 #include "Pegasus/Render/Render.h"
 #include "Pegasus/Utils/String.h"
 #include "Pegasus/PropertyGrid/PropertyGridObject.h"
+#include "Pegasus/PropertyGrid/PropertySnapshot.h"
 
 using namespace Pegasus::Utils;
 
@@ -71,19 +72,17 @@ namespace Application
                 mCachedInfoCount = entryLayout->mProperties.GetSize();
             }
     
-            //walk the node's properties and cache them.
-            for (unsigned int i = 0; i < node->GetNumClassProperties(); ++i)
+            //map the layout to the node's properties, through the compiled layout of the node class.
+            const PropertyGrid::PropertyGridClassInfo* classInfo = node->GetClassInfo();
+            for (int propId = 0; propId < mCachedInfoCount; ++propId)
             {
-                const PropertyGrid::PropertyRecord& record = node->GetClassPropertyRecord(i);
-                for (unsigned int propId = 0; propId < entryLayout->mProperties.GetSize(); ++propId)
+                const int i = classInfo->FindClassProperty(entryLayout->mProperties[propId]);
+                if (i != -1)
                 {
-                    if (!Utils::Strcmp(record.name, entryLayout->mProperties[propId]))
-                    {
-                        mCachedInfos[propId].mValid = true;
-                        mCachedInfos[propId].mSize  = record.size;
-                        mCachedInfos[propId].mCachedAccessor = node->GetClassPropertyAccessor(static_cast<unsigned>(i));
-                        break;
-                    }
+                    const PropertyGrid::PropertyRecord& record = node->GetClassPropertyRecord(static_cast<unsigned>(i));
+                    mCachedInfos[propId].mValid = true;
+                    mCachedInfos[propId].mSize  = record.size;
+                    mCachedInfos[propId].mCachedAccessor = node->GetClassPropertyAccessor(static_cast<unsigned>(i));
                 }
             }
         }
@@ -260,19 +259,26 @@ namespace Application
       mContext(context),
       mFactory(factory),
       mIsUsingGlobalCache(false),
+      mRenderResolvesResources(false),
       mCurrentRenderInfo(nullptr),
+      mPropertySnapshot(nullptr),
+      mRenderWrites(nullptr),
       mGlobalCache(nullptr),
       mGlobalCacheListener(nullptr)
 #if PEGASUS_ENABLE_SCRIPT_PERMISSIONS
       ,mPermissions(PERMISSIONS_DEFAULT)
 #endif
+      ,mPendingPropertyChanges(alloc)
     {
         mImpl = PG_NEW(alloc, -1, "RenderCollectionImpl", Alloc::PG_MEM_TEMP) RenderCollectionImpl(alloc);
+        mRenderWrites = PG_NEW(alloc, -1, "RenderCollection::RenderWrites", Alloc::PG_MEM_TEMP) PropertyGrid::PropertySnapshot(alloc);
     }
 
     RenderCollection::~RenderCollection()
     {
+        FlushPropertyChanges();
         InternalRemoveGlobalCache();
+        PG_DELETE(mAlloc, mRenderWrites);
         PG_DELETE(mAlloc, mImpl);
     }
 
@@ -291,8 +297,78 @@ namespace Application
 
     void RenderCollection::Clean()
     {
+        //the written nodes can be released by the clean, their events are sent before
+        FlushPropertyChanges();
         InternalRemoveGlobalCache();
         mImpl->Clean();
+        mRenderResolvesResources = false;
+    }
+
+    void RenderCollection::FlushPropertyChanges()
+    {
+        const unsigned int numChanges = mPendingPropertyChanges.GetSize();
+
+        //batch every written node first, the nodes coalesce the properties written several times
+        for (unsigned int i = 0; i < numChanges; ++i)
+        {
+            mPendingPropertyChanges[i].GetOwner()->BeginPropertyBatch();
+        }
+        for (unsigned int i = 0; i < numChanges; ++i)
+        {
+            mPendingPropertyChanges[i].NotifyPropertyChanged();
+        }
+        for (unsigned int i = 0; i < numChanges; ++i)
+        {
+            mPendingPropertyChanges[i].GetOwner()->EndPropertyBatch();
+        }
+        mPendingPropertyChanges.Clear();
+    }
+
+    void RenderCollection::SetPropertySnapshot(const PropertyGrid::PropertySnapshot* snapshot)
+    {
+        mPropertySnapshot = snapshot;
+        if (mRenderWrites->GetNumProperties() > 0)
+        {
+            mRenderWrites->Clear();
+        }
+    }
+
+    void RenderCollection::ReadScriptProperty(const PropertyGrid::PropertyAccessor& accessor, void* destBuffer, unsigned int size)
+    {
+        //read your own writes first, the snapshot only has the values of the update
+        if (mPropertySnapshot != nullptr)
+        {
+            if (mRenderWrites->Read(accessor, destBuffer, size) || mPropertySnapshot->Read(accessor, destBuffer, size))
+            {
+                return;
+            }
+        }
+
+        PropertyGrid::PropertyGridObject* owner = accessor.GetOwner();
+        owner->LockProperties();
+        accessor.Read(destBuffer, size);
+        owner->UnlockProperties();
+    }
+
+    void RenderCollection::WriteScriptProperty(const PropertyGrid::PropertyAccessor& accessor, const void* srcBuffer, unsigned int size)
+    {
+        PropertyGrid::PropertyGridObject* owner = accessor.GetOwner();
+        owner->LockProperties();
+        const bool changed = accessor.WriteWithoutNotification(srcBuffer, size);
+        owner->UnlockProperties();
+
+        if (mPropertySnapshot != nullptr)
+        {
+            mRenderWrites->Write(accessor, srcBuffer, size);
+        }
+
+        //the dirty flag and the events of the node are not locked, they are left to the main thread.
+        //Skip the property written just before, the common case of a script writing a value in a loop
+        const unsigned int numChanges = mPendingPropertyChanges.GetSize();
+        if (changed && (numChanges == 0 || !mPendingPropertyChanges[numChanges - 1].IsSameProperty(accessor)))
+        {
+            mPendingPropertyChanges.PushEmpty() = accessor;
+        }
     }
 
     void RenderCollection::SignalIsUsingGlobalCache()
@@ -399,6 +475,33 @@ namespace Application
         #undef RES_PROCESS
     }
 
+    template<typename R, bool hasProperties>
+    struct PropertyCapturer {
+        static void TemplateCaptureAll(Utils::Vector<ObjectPropertyCache<R, hasProperties> >& resList, PropertyGrid::PropertySnapshot& snapshot)
+        {
+            for (unsigned i = 0; i < resList.GetSize(); ++i)
+            {
+                snapshot.Capture(&(*resList[i].mObject));
+            }
+        }
+    };
+
+    template<typename R >
+    struct PropertyCapturer<R, false> {
+        static void TemplateCaptureAll(Utils::Vector<ObjectPropertyCache<R, false> >& resList, PropertyGrid::PropertySnapshot& snapshot)
+        {
+            //no properties read by the scripts
+        }
+    };
+
+    void RenderCollection::CaptureProperties(PropertyGrid::PropertySnapshot& snapshot)
+    {
+        #define RES_PROCESS(type, instance, metaname, hasProperties, canUpdate) \
+            PropertyCapturer<type,hasProperties>::TemplateCaptureAll(mImpl->instance, snapshot);
+        #include "../Source/Pegasus/Application/RenderResources.inl"
+        #undef RES_PROCESS
+    }
+
     #define RES_PROCESS(type, instance, metaname, hasProperties, canUpdate) \
         template<>\
         RenderCollection::CollectionHandle RenderCollection::AddResource<type>(RenderCollection* collection, type* r) { return AddResourceInternal<type>(collection, r);}\
@@ -27,6 +27,7 @@
 #include "Pegasus/Utils/String.h"
 #include "Pegasus/Utils/Vector.h"
 #include "Pegasus/Render/Render.h"
+#include "Pegasus/Render/CommandBuffer.h"
 #include "Pegasus/Allocator/IAllocator.h"
 #include "Pegasus/Core/IApplicationContext.h"
 #include "Pegasus/Math/Vector.h"
@@ -38,6 +39,7 @@
 #include "Pegasus/Texture/TextureManager.h"
 #include "Pegasus/Window/Window.h"
 #include "Pegasus/Timeline/BlockRuntimeScriptListener.h"
+#include "Pegasus/Timeline/Timeline.h"
 
 using namespace Pegasus;
 using namespace Pegasus::Timeline;
@@ -55,6 +57,8 @@ static void RegisterFunctions    (BlockLib* lib);
 ///////////////////////////////////////////////////////////////////////////////////
 
 static Application::RenderCollection* GetContainer(BsVmState* state);
+static Render::CommandBuffer* GetCommandBuffer(Application::RenderCollection* collection);
+static bool CanResolveResources(Application::RenderCollection* collection, const char* funcall);
 
 ////Program Methods//////////////////////////////////////////
 void Program_SetShaderStage(FunCallbackContext& context);
@@ -82,6 +86,7 @@ void Node_CreateMeshOperator(FunCallbackContext& context);
 
 /////Render API Functions////////////////////////////////////
 void Render_CreateUniformBuffer(FunCallbackContext& context);
+void Render_CreateTransientUniformBuffer(FunCallbackContext& context);
 void Render_CreateStructuredReadBuffer(FunCallbackContext& context);
 void Render_SetBuffer(FunCallbackContext& context);
 void Render_GetUniformLocation(FunCallbackContext& context);
@@ -119,6 +124,7 @@ void Render_SetVertexSampler(FunCallbackContext& context);
 void Render_SetDepthClearValue(FunCallbackContext& context);
 void Render_Draw(FunCallbackContext& context);
 void Render_DrawInstanced(FunCallbackContext& context);
+void Render_DrawLod(FunCallbackContext& context);
 void Render_Dispatch(FunCallbackContext& context);
 void Render_CreateRenderTarget(FunCallbackContext& context);
 void Render_CreateDepthStencil(FunCallbackContext& context);
@@ -148,6 +154,11 @@ void Render_SetComputeOutputs(FunCallbackContext& context);
 #define CHECK_PERMISSIONS(_renderCollection, funcall, perms)
 #endif
 
+//! Calls a function of the render API, recorded into the command buffer of the render being run when it has one
+//! (lanes recorded on worker threads), called directly otherwise
+#define RENDER_API_CALL(_renderCollection, funcall, ...) \
+    ((GetCommandBuffer(_renderCollection) != nullptr) ? GetCommandBuffer(_renderCollection)->funcall(__VA_ARGS__) : Render::funcall(__VA_ARGS__))
+
 /////Global cache Functions////////////////////////////////////
 template<typename T, bool isWindowIdUsed=false> void GlobalCache_Register(FunCallbackContext& context);
 template<typename T, bool isWindowIdUsed=false> void GlobalCache_Find(FunCallbackContext& context);
@@ -470,8 +481,8 @@ static void RegisterRenderStructs(BlockLib* lib)
     const StructDeclarationDesc structDefs[] = {
        {  
             "Uniform",  
-            {   "float4",    "float4",     "float4",     "float4", "int", "int", "int", nullptr },
-            {  "namebytes0", "namebytes1", "namebytes2", "namebytes3", "mInternalIndex", "mInternalOwner" , "mInternalVersion", nullptr }
+            {   "float4",    "float4",     "float4",     "float4", "int", "int", "int", "int", nullptr },
+            {  "namebytes0", "namebytes1", "namebytes2", "namebytes3", "mInternalIndex", "mInternalOwner" , "mInternalVersion", "mNameHash", nullptr }
         }, 
         {
             "RenderTargetConfig",
@@ -848,6 +859,13 @@ static void RegisterFunctions(BlockLib* lib)
             { "bufferSize", nullptr },
             Render_CreateUniformBuffer
         },
+        {
+            "CreateTransientUniformBuffer",
+            "Buffer",
+            { "int",        nullptr },
+            { "bufferSize", nullptr },
+            Render_CreateTransientUniformBuffer
+        },
         {
             "CreateStructuredReadBuffer",
             "Buffer",
@@ -1107,6 +1125,13 @@ static void RegisterFunctions(BlockLib* lib)
             { "instanceCount", nullptr },
             Render_DrawInstanced
         },
+        {
+            "DrawLod",
+            "int",
+            { "float", nullptr },
+            { "screenSize", nullptr },
+            Render_DrawLod
+        },
         {
             "Dispatch",
             "int",
@@ -1281,6 +1306,30 @@ static Application::RenderCollection* GetContainer(BsVmState* state)
     return container;
 }
 
+static Render::CommandBuffer* GetCommandBuffer(Application::RenderCollection* collection)
+{
+    const Pegasus::Timeline::RenderInfo* renderInfo = collection->GetRenderInfo();
+    return (renderInfo != nullptr) ? renderInfo->commandBuffer : nullptr;
+}
+
+//! Test if a call creating a resource or a node, or resolving a uniform, can run.
+//! Those calls use the device and the node managers, they are only made on the main thread.
+//! A render making them stays on the main thread (see TimelineScriptRunner::CanRenderConcurrently()),
+//! the calls made while recording on a worker thread are skipped until then.
+static bool CanResolveResources(Application::RenderCollection* collection, const char* funcall)
+{
+    if (collection->GetRenderInfo() != nullptr)
+    {
+        collection->SignalRenderResolvesResources();
+        if (GetCommandBuffer(collection) != nullptr)
+        {
+            PG_LOG('ERR_', "Cannot call \"%s\" while recording on a worker thread, the block renders on the main thread from the next frame.", funcall);
+            return false;
+        }
+    }
+    return true;
+}
+
 /////////////////////////////////////////////////////////////
 //!> Program Node functions
 /////////////////////////////////////////////////////////////
@@ -1449,6 +1498,11 @@ void Node_CreateTexture(FunCallbackContext& context)
     FunParamStream stream(context);
     BsVmState* state = context.GetVmState();
     RenderCollection* collection = GetContainer(state);  
+    if (!CanResolveResources(collection, "CreateTexture"))
+    {
+        stream.SubmitReturn(RenderCollection::INVALID_HANDLE);
+        return;
+    }
     Pegasus::Texture::TextureConfiguration blankConfig;
     Pegasus::Texture::TextureRef t = collection->GetAppContext()->GetTextureManager()->CreateTextureNode(blankConfig);
     if (t != nullptr)
@@ -1468,6 +1522,11 @@ void Node_CreateTextureGenerator(FunCallbackContext& context)
     FunParamStream stream(context);
     BsVmState* state = context.GetVmState();
     RenderCollection* collection = GetContainer(state);
+    if (!CanResolveResources(collection, "CreateTextureGenerator"))
+    {
+        stream.SubmitReturn(RenderCollection::INVALID_HANDLE);
+        return;
+    }
     const char* name = stream.NextBsStringArgument();
     Pegasus::Texture::TextureConfiguration blankConfig;
     Pegasus::Texture::TextureGeneratorRef t = collection->GetAppContext()->GetTextureManager()->CreateTextureGeneratorNode(name, blankConfig);
@@ -1488,6 +1547,11 @@ void Node_CreateTextureOperator(FunCallbackContext& context)
     FunParamStream stream(context);
     BsVmState* state = context.GetVmState();
     RenderCollection* collection = GetContainer(state);
+    if (!CanResolveResources(collection, "CreateTextureOperator"))
+    {
+        stream.SubmitReturn(RenderCollection::INVALID_HANDLE);
+        return;
+    }
     const char* name = stream.NextBsStringArgument();
     Pegasus::Texture::TextureConfiguration blankConfig;
     Pegasus::Texture::TextureOperatorRef t = collection->GetAppContext()->GetTextureManager()->CreateTextureOperatorNode(name, blankConfig);
@@ -1508,6 +1572,11 @@ void Node_CreateMesh(FunCallbackContext& context)
     FunParamStream stream(context);
     BsVmState* state = context.GetVmState();
     RenderCollection* collection = GetContainer(state);
+    if (!CanResolveResources(collection, "CreateMesh"))
+    {
+        stream.SubmitReturn(RenderCollection::INVALID_HANDLE);
+        return;
+    }
     Core::IApplicationContext* appCtx = collection->GetAppContext();
     Mesh::MeshManager* meshManager = appCtx->GetMeshManager();
     Mesh::MeshRef newMesh = meshManager->CreateMeshNode();
@@ -1520,6 +1589,11 @@ void Node_CreateMeshGenerator(FunCallbackContext& context)
     FunParamStream stream(context);
     BsVmState* state = context.GetVmState();
     RenderCollection* collection = GetContainer(state);
+    if (!CanResolveResources(collection, "CreateMeshGenerator"))
+    {
+        stream.SubmitReturn(RenderCollection::INVALID_HANDLE);
+        return;
+    }
     Core::IApplicationContext* appCtx = collection->GetAppContext();
     Mesh::MeshManager* meshManager = appCtx->GetMeshManager();
 
@@ -1541,6 +1615,11 @@ void Node_CreateMeshOperator(FunCallbackContext& context)
     FunParamStream stream(context);
     BsVmState* state = context.GetVmState();
     RenderCollection* collection = GetContainer(state);
+    if (!CanResolveResources(collection, "CreateMeshOperator"))
+    {
+        stream.SubmitReturn(RenderCollection::INVALID_HANDLE);
+        return;
+    }
     Core::IApplicationContext* appCtx = collection->GetAppContext();
     Mesh::MeshManager* meshManager = appCtx->GetMeshManager();
 
@@ -1562,12 +1641,17 @@ void Node_CreateMeshOperator(FunCallbackContext& context)
 /////////////////////////////////////////////////////////////
 //!> Render functions
 /////////////////////////////////////////////////////////////
-void Render_CreateUniformBuffer(FunCallbackContext& context)
+static void InternalCreateUniformBuffer(FunCallbackContext& context, const char* functionName, bool transient)
 {
     FunParamStream stream(context);
     BsVmState* state = context.GetVmState();
     Application::RenderCollection* renderCollection = GetContainer(state);
-    CHECK_PERMISSIONS(renderCollection, "CreateUniformBuffer", PERMISSIONS_RENDER_API_CALL);
+    CHECK_PERMISSIONS(renderCollection, functionName, PERMISSIONS_RENDER_API_CALL);
+    if (!CanResolveResources(renderCollection, functionName))
+    {
+        stream.SubmitReturn(RenderCollection::INVALID_HANDLE);
+        return;
+    }
 
     int& bufferSize = stream.NextArgument<int>();
 
@@ -1578,18 +1662,32 @@ void Render_CreateUniformBuffer(FunCallbackContext& context)
     }
     else
     {
-        Render::BufferRef buffer = Render::CreateUniformBuffer(bufferSize);
+        Render::BufferRef buffer = Render::CreateUniformBuffer(bufferSize, transient);
         stream.SubmitReturn( RenderCollection::AddResource<Render::Buffer>(renderCollection, buffer));
-
     }
 }
 
+void Render_CreateUniformBuffer(FunCallbackContext& context)
+{
+    InternalCreateUniformBuffer(context, "CreateUniformBuffer", false);
+}
+
+void Render_CreateTransientUniformBuffer(FunCallbackContext& context)
+{
+    InternalCreateUniformBuffer(context, "CreateTransientUniformBuffer", true);
+}
+
 void Render_CreateStructuredReadBuffer(FunCallbackContext& context)
 {
     FunParamStream stream(context);
     BsVmState* state = context.GetVmState();
     Application::RenderCollection* renderCollection = GetContainer(state);
     CHECK_PERMISSIONS(renderCollection, "CreateStructuredReadBuffer", PERMISSIONS_RENDER_API_CALL);
+    if (!CanResolveResources(renderCollection, "CreateStructuredReadBuffer"))
+    {
+        stream.SubmitReturn(RenderCollection::INVALID_HANDLE);
+        return;
+    }
 
     int& bufferSize = stream.NextArgument<int>();
     int& elementCount = stream.NextArgument<int>();
@@ -1623,7 +1721,7 @@ void Render_SetBuffer(FunCallbackContext& context)
     if (handle != Application::RenderCollection::INVALID_HANDLE)
     {
         Render::BufferRef buff = RenderCollection::GetResource<Render::Buffer>(collection, handle);
-        Render::SetBuffer(buff, bufferPointer);
+        RENDER_API_CALL(collection, SetBuffer, buff, bufferPointer);
     }
     else
     {
@@ -1638,6 +1736,10 @@ void Render_GetUniformLocation(FunCallbackContext& context)
     BsVmState* state = context.GetVmState();
     Application::RenderCollection* renderCollection = GetContainer(state);
     CHECK_PERMISSIONS(renderCollection, "GetUniformLocation", PERMISSIONS_RENDER_API_CALL);
+    if (!CanResolveResources(renderCollection, "GetUniformLocation"))
+    {
+        return;
+    }
     RenderCollection::CollectionHandle& programId = stream.NextArgument<RenderCollection::CollectionHandle>();
     if (programId != RenderCollection::INVALID_HANDLE)
     {
@@ -1669,7 +1771,7 @@ void Render_SetUniformBuffer(FunCallbackContext& context)
     if (bufferHandle != Application::RenderCollection::INVALID_HANDLE)
     {
         Render::BufferRef buffer = RenderCollection::GetResource<Render::Buffer>(renderCollection, bufferHandle);
-        bool res = Render::SetUniformBuffer(uniform, buffer);
+        bool res = RENDER_API_CALL(renderCollection, SetUniformBuffer, uniform, buffer);
         if (!res)
         {
             PG_LOG('ERR_', "Error setting uniform. Check that uniform exists and that program is set.");
@@ -1695,7 +1797,7 @@ void Render_SetUniformBufferResource(FunCallbackContext& context)
     if (bufferHandle != Application::RenderCollection::INVALID_HANDLE)
     {
         Render::BufferRef buffer = RenderCollection::GetResource<Render::Buffer>(renderCollection, bufferHandle);
-        bool res = Render::SetUniformBufferResource(uniform, buffer);
+        bool res = RENDER_API_CALL(renderCollection, SetUniformBufferResource, uniform, buffer);
         if (!res)
         {
             PG_LOG('ERR_', "Error setting uniform buffer resource. Check that uniform exists and that program is set.");
@@ -1719,7 +1821,7 @@ void Render_SetUniformTexture(FunCallbackContext& context)
     if (texHandle != Application::RenderCollection::INVALID_HANDLE)
     {
         Texture::TextureRef texture = RenderCollection::GetResource<Texture::Texture>(renderCollection, texHandle);
-        bool res = Render::SetUniformTexture(uniform, texture);
+        bool res = RENDER_API_CALL(renderCollection, SetUniformTexture, uniform, texture);
         if (!res)
         {
             PG_LOG('ERR_', "Error setting uniform texture. Check that uniform exists and that program is set.");
@@ -1743,7 +1845,7 @@ void Render_SetUniformTextureRenderTarget(FunCallbackContext& context)
     if (renderTargetId != Application::RenderCollection::INVALID_HANDLE)
     {
         Render::RenderTargetRef renderTarget = RenderCollection::GetResource<Render::RenderTarget>(renderCollection, renderTargetId);
-        Render::SetUniformTextureRenderTarget(uniform, renderTarget);
+        RENDER_API_CALL(renderCollection, SetUniformTextureRenderTarget, uniform, renderTarget);
     }
     else
     {
@@ -1764,7 +1866,7 @@ void Render_SetUniformDepth(FunCallbackContext& context)
     if (renderTargetId != Application::RenderCollection::INVALID_HANDLE)
     {
         Render::DepthStencilRef depth = RenderCollection::GetResource<Render::DepthStencil>(renderCollection, renderTargetId);
-        Render::SetUniformDepth(uniform, depth);
+        RENDER_API_CALL(renderCollection, SetUniformDepth, uniform, depth);
     }
     else
     {
@@ -1784,7 +1886,7 @@ void Render_SetUniformStencil(FunCallbackContext& context)
     if (renderTargetId != Application::RenderCollection::INVALID_HANDLE)
     {
         Render::DepthStencilRef stencil = RenderCollection::GetResource<Render::DepthStencil>(renderCollection, renderTargetId);
-        Render::SetUniformStencil(uniform, stencil);
+        RENDER_API_CALL(renderCollection, SetUniformStencil, uniform, stencil);
     }
     else
     {
@@ -1804,7 +1906,7 @@ void Render_SetUniformCubeMap(FunCallbackContext& context)
     if (cmId != Application::RenderCollection::INVALID_HANDLE)
     {
         Render::CubeMapRef cm = RenderCollection::GetResource<Render::CubeMap>(renderCollection, cmId);
-        Render::SetUniformCubeMap(uniform, cm);
+        RENDER_API_CALL(renderCollection, SetUniformCubeMap, uniform, cm);
     }
     else
     {
@@ -1822,7 +1924,7 @@ void Render_SetProgram(FunCallbackContext& context)
     if (programId != Application::RenderCollection::INVALID_HANDLE)
     {
         Shader::ProgramLinkageRef program = RenderCollection::GetResource<Shader::ProgramLinkage>(renderCollection, programId);
-        Render::SetProgram(program);
+        RENDER_API_CALL(renderCollection, SetProgram, program);
     }
     else
     {
@@ -1840,7 +1942,7 @@ void Render_SetMesh(FunCallbackContext& context)
     if (meshId != Application::RenderCollection::INVALID_HANDLE)
     {
         Mesh::MeshRef mesh = RenderCollection::GetResource<Mesh::Mesh>(renderCollection, meshId);
-        Render::SetMesh(mesh);
+        RENDER_API_CALL(renderCollection, SetMesh, mesh);
     }
     else
     {
@@ -1850,39 +1952,46 @@ void Render_SetMesh(FunCallbackContext& context)
 
 void Render_UnbindMesh(FunCallbackContext& context)
 {
-    Pegasus::Render::UnbindMesh();
+    RenderCollection* renderCollection = GetContainer(context.GetVmState());
+    RENDER_API_CALL(renderCollection, UnbindMesh);
 }
 
 void Render_UnbindComputeOutputs(FunCallbackContext& context)
 {
-    Pegasus::Render::UnbindComputeOutputs();
+    RenderCollection* renderCollection = GetContainer(context.GetVmState());
+    RENDER_API_CALL(renderCollection, UnbindComputeOutputs);
 }
 
 void Render_UnbindRenderTargets(FunCallbackContext& context)
 {
-    Pegasus::Render::UnbindRenderTargets();
+    RenderCollection* renderCollection = GetContainer(context.GetVmState());
+    RENDER_API_CALL(renderCollection, UnbindRenderTargets);
 }
 
 void Render_UnbindComputeResources(FunCallbackContext& context)
 {
-    Pegasus::Render::UnbindComputeResources();
+    RenderCollection* renderCollection = GetContainer(context.GetVmState());
+    RENDER_API_CALL(renderCollection, UnbindComputeResources);
 }
 void Render_UnbindVertexResources(FunCallbackContext& context)
 {
-    Pegasus::Render::UnbindVertexResources();
+    RenderCollection* renderCollection = GetContainer(context.GetVmState());
+    RENDER_API_CALL(renderCollection, UnbindVertexResources);
 }
 void Render_UnbindPixelResources(FunCallbackContext& context)
 {
-    Pegasus::Render::UnbindPixelResources();
+    RenderCollection* renderCollection = GetContainer(context.GetVmState());
+    RENDER_API_CALL(renderCollection, UnbindPixelResources);
 }
 
 void Render_SetViewport(FunCallbackContext& context)
 {
     FunParamStream stream(context);
     BsVmState* state = context.GetVmState();
-    CHECK_PERMISSIONS(GetContainer(state), "SetViewport", PERMISSIONS_RENDER_API_CALL);
+    RenderCollection* collection = GetContainer(state);
+    CHECK_PERMISSIONS(collection, "SetViewport", PERMISSIONS_RENDER_API_CALL);
     Render::Viewport& viewport = stream.NextArgument<Render::Viewport>();
-    Render::SetViewport(viewport);
+    RENDER_API_CALL(collection, SetViewport, viewport);
 }
 
 void Render_SetViewport2(FunCallbackContext& context)
@@ -1895,7 +2004,7 @@ void Render_SetViewport2(FunCallbackContext& context)
     if (handle != RenderCollection::INVALID_HANDLE)
     {
         Render::RenderTargetRef rt = RenderCollection::GetResource<Render::RenderTarget>(collection, handle);
-        Pegasus::Render::SetViewport(rt);
+        RENDER_API_CALL(collection, SetViewport, rt);
     }
     else
     {
@@ -1917,7 +2026,7 @@ void Render_SetRenderTarget(FunCallbackContext& context)
     if (rtHandle != RenderCollection::INVALID_HANDLE)
     {
         Render::RenderTargetRef rt = RenderCollection::GetResource<Render::RenderTarget>(renderCollection,rtHandle);
-        Render::SetRenderTarget(rt);
+        RENDER_API_CALL(renderCollection, SetRenderTarget, rt);
     }
     else
     {
@@ -1936,7 +2045,7 @@ void Render_SetRenderTarget2(FunCallbackContext& context)
     {
         Render::RenderTargetRef rt = RenderCollection::GetResource<Render::RenderTarget>(renderCollection,rtHandle);
         Render::DepthStencilRef dt = RenderCollection::GetResource<Render::DepthStencil>(renderCollection,dtHandle);
-        Render::SetRenderTarget(rt,dt);
+        RENDER_API_CALL(renderCollection, SetRenderTarget, rt,dt);
     }
     else
     {
@@ -2010,7 +2119,7 @@ void Render_SetRenderTargets(FunCallbackContext& context)
     }
     Render::DepthStencilRef depthStencil = RenderCollection::GetResource<Render::DepthStencil>(renderCollection,depthHandle);
     PG_ASSERT(depthStencil != nullptr);
-    Pegasus::Render::SetRenderTargets(targetCounts, targets, depthStencil);
+    RENDER_API_CALL(renderCollection, SetRenderTargets, targetCounts, targets, depthStencil);
 }
 
 void Render_SetRenderTargets2(FunCallbackContext& context)
@@ -2020,47 +2129,39 @@ void Render_SetRenderTargets2(FunCallbackContext& context)
 
 void Render_SetDefaultRenderTarget(FunCallbackContext& context)
 {
-#if PEGASUS_ENABLE_SCRIPT_PERMISSIONS
     RenderCollection* renderCollection = GetContainer(context.GetVmState());
     CHECK_PERMISSIONS(renderCollection, "SetDefaultRenderTarget", PERMISSIONS_RENDER_API_CALL);
-#endif
-    Pegasus::Render::DispatchDefaultRenderTarget();
+    RENDER_API_CALL(renderCollection, DispatchDefaultRenderTarget);
 }
 
 void Render_SetPrimitiveMode(FunCallbackContext& context)
 {
-#if PEGASUS_ENABLE_SCRIPT_PERMISSIONS
     RenderCollection* renderCollection = GetContainer(context.GetVmState());
     CHECK_PERMISSIONS(renderCollection, "SetPrimitiveMode", PERMISSIONS_RENDER_API_CALL);
-#endif
     PG_ASSERT(context.GetInputBufferSize() == sizeof(Pegasus::Render::PrimitiveMode));
     FunParamStream stream(context);
-    Render::SetPrimitiveMode(stream.NextArgument<Pegasus::Render::PrimitiveMode>());
+    RENDER_API_CALL(renderCollection, SetPrimitiveMode, stream.NextArgument<Pegasus::Render::PrimitiveMode>());
 }
 
 void Render_Clear(FunCallbackContext& context)
 {
     PG_ASSERT(context.GetInputBufferSize() == 3 * sizeof(int));
     FunParamStream stream(context);
-#if PEGASUS_ENABLE_SCRIPT_PERMISSIONS
     RenderCollection* renderCollection = GetContainer(context.GetVmState());
     CHECK_PERMISSIONS(renderCollection, "SetPrimitiveMode", PERMISSIONS_RENDER_API_CALL);
-#endif
     bool col = stream.NextArgument<int>() != 0;
     bool depth = stream.NextArgument<int>() != 0;
     bool stencil = stream.NextArgument<int>() != 0;
-    Render::Clear(col, depth, stencil);
+    RENDER_API_CALL(renderCollection, Clear, col, depth, stencil);
 }
 
 void Render_SetClearColorValue(FunCallbackContext& context)
 {
     FunParamStream stream(context);
-#if PEGASUS_ENABLE_SCRIPT_PERMISSIONS
     RenderCollection* renderCollection = GetContainer(context.GetVmState());
     CHECK_PERMISSIONS(renderCollection, "SetClearColorValue", PERMISSIONS_RENDER_API_CALL);
-#endif
     Math::ColorRGBA& color = stream.NextArgument<Math::ColorRGBA>();
-    Render::SetClearColorValue(color);
+    RENDER_API_CALL(renderCollection, SetClearColorValue, color);
 }
 
 void Render_SetRasterizerState(FunCallbackContext& context)
@@ -2073,7 +2174,7 @@ void Render_SetRasterizerState(FunCallbackContext& context)
     if (handle != RenderCollection::INVALID_HANDLE)
     {
         Render::RasterizerStateRef rasterState = RenderCollection::GetResource<Render::RasterizerState>(collection, handle);
-        Render::SetRasterizerState(rasterState);
+        RENDER_API_CALL(collection, SetRasterizerState, rasterState);
     }
     else
     {
@@ -2091,7 +2192,7 @@ void Render_SetBlendingState(FunCallbackContext& context)
     if (handle != RenderCollection::INVALID_HANDLE)
     {
         Render::BlendingStateRef blendState = RenderCollection::GetResource<Render::BlendingState>(collection, handle);
-        Render::SetBlendingState(blendState);
+        RENDER_API_CALL(collection, SetBlendingState, blendState);
     }
     else
     {
@@ -2110,7 +2211,7 @@ void Render_SetComputeSampler(FunCallbackContext& context)
     {
         int slot = stream.NextArgument<int>();
         Render::SamplerStateRef samplerState = RenderCollection::GetResource<Render::SamplerState>(collection, handle);
-        Render::SetComputeSampler(samplerState, slot);
+        RENDER_API_CALL(collection, SetComputeSampler, samplerState, slot);
     }
     else
     {
@@ -2129,7 +2230,7 @@ void Render_SetPixelSampler(FunCallbackContext& context)
     {
         int slot = stream.NextArgument<int>();
         Render::SamplerStateRef samplerState = RenderCollection::GetResource<Render::SamplerState>(collection, handle);
-        Render::SetPixelSampler(samplerState, slot);
+        RENDER_API_CALL(collection, SetPixelSampler, samplerState, slot);
     }
     else
     {
@@ -2148,7 +2249,7 @@ void Render_SetVertexSampler(FunCallbackContext& context)
     {
         int slot = stream.NextArgument<int>();
         Render::SamplerStateRef samplerState = RenderCollection::GetResource<Render::SamplerState>(collection, handle);
-        Render::SetVertexSampler(samplerState,slot);
+        RENDER_API_CALL(collection, SetVertexSampler, samplerState,slot);
     }
     else
     {
@@ -2159,45 +2260,46 @@ void Render_SetVertexSampler(FunCallbackContext& context)
 void Render_SetDepthClearValue(FunCallbackContext& context)
 {
     FunParamStream stream(context);
-#if PEGASUS_ENABLE_SCRIPT_PERMISSIONS
     RenderCollection* renderCollection = GetContainer(context.GetVmState());
     CHECK_PERMISSIONS(renderCollection, "setDepthClearValue", PERMISSIONS_RENDER_API_CALL);
-#endif
     float& depthClearVal = stream.NextArgument<float>();
-    Render::SetDepthClearValue(depthClearVal);
+    RENDER_API_CALL(renderCollection, SetDepthClearValue, depthClearVal);
 }
 
 void Render_Draw(FunCallbackContext& context)
 {
-#if PEGASUS_ENABLE_SCRIPT_PERMISSIONS
     RenderCollection* renderCollection = GetContainer(context.GetVmState());
     CHECK_PERMISSIONS(renderCollection, "Draw", PERMISSIONS_RENDER_API_CALL);
-#endif
-    Render::Draw();
+    RENDER_API_CALL(renderCollection, Draw);
 }
 
 void Render_DrawInstanced(FunCallbackContext& context)
 {
-#if PEGASUS_ENABLE_SCRIPT_PERMISSIONS
     RenderCollection* renderCollection = GetContainer(context.GetVmState());
     CHECK_PERMISSIONS(renderCollection, "Draw", PERMISSIONS_RENDER_API_CALL);
-#endif
     FunParamStream stream(context);
     int instanceCount = stream.NextArgument<int>();
-    Render::DrawInstanced((unsigned int)instanceCount);
+    RENDER_API_CALL(renderCollection, DrawInstanced, (unsigned int)instanceCount);
+}
+
+void Render_DrawLod(FunCallbackContext& context)
+{
+    RenderCollection* renderCollection = GetContainer(context.GetVmState());
+    CHECK_PERMISSIONS(renderCollection, "Draw", PERMISSIONS_RENDER_API_CALL);
+    FunParamStream stream(context);
+    float screenSize = stream.NextArgument<float>();
+    RENDER_API_CALL(renderCollection, DrawLod, screenSize);
 }
 
 void Render_Dispatch(FunCallbackContext& context)
 {
-#if PEGASUS_ENABLE_SCRIPT_PERMISSIONS
     RenderCollection* renderCollection = GetContainer(context.GetVmState());
     CHECK_PERMISSIONS(renderCollection, "Dispatch", PERMISSIONS_RENDER_API_CALL);
-#endif
     FunParamStream stream(context);
     int x = stream.NextArgument<int>();
     int y = stream.NextArgument<int>();
     int z = stream.NextArgument<int>();
-    Render::Dispatch(
+    RENDER_API_CALL(renderCollection, Dispatch,
        static_cast<unsigned int>(x),
        static_cast<unsigned int>(y),
        static_cast<unsigned int>(z));
@@ -2209,6 +2311,11 @@ void Render_CreateRenderTarget(FunCallbackContext& context)
     BsVmState* vmState = context.GetVmState();
     Application::RenderCollection* renderCollection = GetContainer(vmState);
     CHECK_PERMISSIONS(renderCollection, "CreateRenderTarget", PERMISSIONS_RENDER_API_CALL);
+    if (!CanResolveResources(renderCollection, "CreateRenderTarget"))
+    {
+        stream.SubmitReturn(RenderCollection::INVALID_HANDLE);
+        return;
+    }
     Render::RenderTargetConfig& config = stream.NextArgument<Render::RenderTargetConfig>();
     Render::RenderTargetRef rt = Render::CreateRenderTarget(config);
     stream.SubmitReturn( RenderCollection::AddResource<Render::RenderTarget>( renderCollection, rt));
@@ -2220,6 +2327,11 @@ void Render_CreateDepthStencil(FunCallbackContext& context)
     BsVmState* vmState = context.GetVmState();
     Application::RenderCollection* renderCollection = GetContainer(vmState);
     CHECK_PERMISSIONS(renderCollection, "CreateDepthStencil", PERMISSIONS_RENDER_API_CALL);
+    if (!CanResolveResources(renderCollection, "CreateDepthStencil"))
+    {
+        stream.SubmitReturn(RenderCollection::INVALID_HANDLE);
+        return;
+    }
     Render::DepthStencilConfig& config = stream.NextArgument<Render::DepthStencilConfig>();
     Render::DepthStencilRef rt = Render::CreateDepthStencil(config);
     stream.SubmitReturn( RenderCollection::AddResource<Render::DepthStencil>(renderCollection, rt));
@@ -2231,6 +2343,11 @@ void Render_CreateCubeMap(FunCallbackContext& context)
     BsVmState* vmState = context.GetVmState();
     Application::RenderCollection* renderCollection = GetContainer(vmState);
     CHECK_PERMISSIONS(renderCollection, "CreateCubeMap", PERMISSIONS_RENDER_API_CALL);
+    if (!CanResolveResources(renderCollection, "CreateCubeMap"))
+    {
+        stream.SubmitReturn(RenderCollection::INVALID_HANDLE);
+        return;
+    }
     Render::CubeMapConfig& config = stream.NextArgument<Render::CubeMapConfig>();
     Render::CubeMapRef cm = Render::CreateCubeMap(config);
     stream.SubmitReturn( RenderCollection::AddResource<Render::CubeMap>(renderCollection, cm));
@@ -2242,6 +2359,11 @@ void Render_CreateRenderTargetFromCubeMap(FunCallbackContext& context)
     BsVmState* vmState = context.GetVmState();
     Application::RenderCollection* renderCollection = GetContainer(vmState);
     CHECK_PERMISSIONS(renderCollection, "CreateRenderTargetFromCubeMap", PERMISSIONS_RENDER_API_CALL);
+    if (!CanResolveResources(renderCollection, "CreateRenderTargetFromCubeMap"))
+    {
+        stream.SubmitReturn(RenderCollection::INVALID_HANDLE);
+        return;
+    }
     Render::CubeFace targetFace = stream.NextArgument<Render::CubeFace>();
     RenderCollection::CollectionHandle cubeMapHandle = stream.NextArgument<RenderCollection::CollectionHandle>();
     RenderCollection::CollectionHandle returnHandle = RenderCollection::INVALID_HANDLE;
@@ -2265,6 +2387,11 @@ void Render_CreateRasterizerState(FunCallbackContext& context)
     BsVmState* state = context.GetVmState();
     RenderCollection* collection = GetContainer(state);
     CHECK_PERMISSIONS(collection, "CreateRasterizerState", PERMISSIONS_RENDER_API_CALL);
+    if (!CanResolveResources(collection, "CreateRasterizerState"))
+    {
+        stream.SubmitReturn(RenderCollection::INVALID_HANDLE);
+        return;
+    }
     Render::RasterizerConfig& rasterConfig = stream.NextArgument<Render::RasterizerConfig>();
     Render::RasterizerStateRef rasterState = Render::CreateRasterizerState(rasterConfig);
     stream.SubmitReturn( RenderCollection::AddResource<Render::RasterizerState>(collection, rasterState) );
@@ -2276,6 +2403,11 @@ void Render_CreateBlendingState(FunCallbackContext& context)
     BsVmState* state = context.GetVmState();
     RenderCollection* collection = GetContainer(state);
     CHECK_PERMISSIONS(collection, "CreateBlendingState", PERMISSIONS_RENDER_API_CALL);
+    if (!CanResolveResources(collection, "CreateBlendingState"))
+    {
+        stream.SubmitReturn(RenderCollection::INVALID_HANDLE);
+        return;
+    }
     
     Render::BlendingConfig* blendConfig = static_cast<Render::BlendingConfig*>(context.GetRawInputBuffer());
     Render::BlendingStateRef blendState = Render::CreateBlendingState(*blendConfig);
@@ -2288,6 +2420,11 @@ void Render_CreateSamplerState(FunCallbackContext& context)
     BsVmState* state = context.GetVmState();
     RenderCollection* collection = GetContainer(state);
     CHECK_PERMISSIONS(collection, "CreateSamplerState", PERMISSIONS_RENDER_API_CALL);
+    if (!CanResolveResources(collection, "CreateSamplerState"))
+    {
+        stream.SubmitReturn(RenderCollection::INVALID_HANDLE);
+        return;
+    }
     
     Render::SamplerStateConfig* cfg = static_cast<Render::SamplerStateConfig*>(context.GetRawInputBuffer());
     Render::SamplerStateRef samplerState = Render::CreateSamplerState(*cfg);
@@ -2304,7 +2441,7 @@ void Render_GenerateMipsRT(FunCallbackContext& context)
     if (rtHandle != RenderCollection::INVALID_HANDLE)
     {
         Render::RenderTargetRef rt = RenderCollection::GetResource<Render::RenderTarget>(collection, rtHandle);
-        Render::GenerateMips(rt);
+        RENDER_API_CALL(collection, GenerateMips, rt);
     }
     else
     {
@@ -2322,7 +2459,7 @@ void Render_GenerateMipsCM(FunCallbackContext& context)
     if (cmHandle != RenderCollection::INVALID_HANDLE)
     {
         Render::CubeMapRef cm = RenderCollection::GetResource<Render::CubeMap>(collection, cmHandle);
-        Render::GenerateMips(cm);
+        RENDER_API_CALL(collection, GenerateMips, cm);
     }
     else
     {
@@ -2330,6 +2467,12 @@ void Render_GenerateMipsCM(FunCallbackContext& context)
     }
 }
 
+//! Reads a node property, from the snapshot of the frame being rendered when there is one
+static void ReadNodeProperty(const PropertyGrid::PropertyAccessor* accessor, const Pegasus::BlockScript::PropertyCallbackContext& context, void* destBuffer, unsigned int size)
+{
+    GetContainer(context.state)->ReadScriptProperty(*accessor, destBuffer, size);
+}
+
 bool PropertyGridPropertyCallback(const PropertyGrid::PropertyAccessor* accessor, const Pegasus::BlockScript::PropertyCallbackContext& context)
 {
     if (accessor != nullptr)
@@ -2345,7 +2488,7 @@ bool PropertyGridPropertyCallback(const PropertyGrid::PropertyAccessor* accessor
             if (context.isRead)
             {
                 PropertyGrid::BaseEnumType enumType;
-                accessor->Read(&enumType, sizeof(PropertyGrid::BaseEnumType));
+                ReadNodeProperty(accessor, context, &enumType, sizeof(PropertyGrid::BaseEnumType));
                 int v = enumType.GetValue();
                 *static_cast<int*>(context.destBuffer) = v;
             }
@@ -2355,7 +2498,7 @@ bool PropertyGridPropertyCallback(const PropertyGrid::PropertyAccessor* accessor
                 int enumIndex = enumValue - 1;
                 PG_ASSERT(enumIndex >= 0 && static_cast<unsigned int>(enumIndex) < enums.GetSize());
                 const PropertyGrid::BaseEnumType* enumValuePtr = enums[enumIndex];
-                accessor->Write(enumValuePtr, sizeof(*enumValuePtr));
+                GetContainer(context.state)->WriteScriptProperty(*accessor, enumValuePtr, sizeof(*enumValuePtr));
             }
             return true;
         }
@@ -2363,11 +2506,12 @@ bool PropertyGridPropertyCallback(const PropertyGrid::PropertyAccessor* accessor
         {
             if (context.isRead)
             {
-                accessor->Read(context.destBuffer, context.propertyDesc->mType->GetByteSize());
+                ReadNodeProperty(accessor, context, context.destBuffer, context.propertyDesc->mType->GetByteSize());
             }
             else
             {
-                accessor->Write(context.srcBuffer, context.propertyDesc->mType->GetByteSize());
+                //locks the node shared with the scripts of other threads, the change is notified on the main thread
+                GetContainer(context.state)->WriteScriptProperty(*accessor, context.srcBuffer, context.propertyDesc->mType->GetByteSize());
             }
             return true;
         }
@@ -2465,20 +2609,22 @@ void Render_SetComputeOutputs(FunCallbackContext& context)
     else
     {
         T* resource = RenderCollection::GetResource<T>(renderCollection, resourceHandle);
-        Render::SetComputeOutput(resource, slotId);
+        RENDER_API_CALL(renderCollection, SetComputeOutput, resource, slotId);
     }
 }
 
 void Render_BeginMarker(FunCallbackContext& context)
 {
     FunParamStream stream(context);
+    RenderCollection* renderCollection = GetContainer(context.GetVmState());
     const char* markerName = stream.NextBsStringArgument();
-    Render::BeginMarker(markerName);
+    RENDER_API_CALL(renderCollection, BeginMarker, markerName);
 }
 
 void Render_EndMarker(FunCallbackContext& context)
 {
-    Render::EndMarker();
+    RenderCollection* renderCollection = GetContainer(context.GetVmState());
+    RENDER_API_CALL(renderCollection, EndMarker);
 }
 
 void Render_CreateSimpleRasterConfig(FunCallbackContext& context)
@@ -12,6 +12,7 @@
 #include "Pegasus/AssetLib/AssetLib.h"
 #include "Pegasus/AssetLib/Asset.h"
 #include "Pegasus/AssetLib/ASTree.h"
+#include "Pegasus/AssetLib/BinaryAsset.h"
 #include "Pegasus/Utils/String.h"
 #include "Pegasus/Utils/ByteStream.h"
 #include "Pegasus/Allocator/Alloc.h"
@@ -108,6 +109,7 @@ namespace AssetPrivate
                 AssetPrivate::DumpElementToStream(tabSize + 1, a->GetElement(i).a, stream);
                 if ( i != a->GetSize() - 1) stream.Append(COMMA, COMMASZ);
             }
+            break;
         case Array::AS_TYPE_ASSET_PATH_REF:
             for (int i = 0; i < a->GetSize(); ++i)
             {
@@ -234,6 +236,7 @@ Asset::Asset(Alloc::IAllocator* allocator, Pegasus::AssetLib::AssetLib* lib, Ass
   mChildArrays(allocator),
   mChildObjects(allocator),
   mRoot(nullptr),
+  mEncoding(Asset::ENCODING_TEXT),
   mRuntimeData(nullptr),
   mAssetLib(lib),
   mTypeDesc(nullptr)
@@ -331,6 +334,7 @@ void Asset::Clear()
 
         mAstAllocator.FreeMemory();
         mStringAllocator.FreeMemory();
+        mBinaryBuffer.DestroyBuffer();
 
     }
 }
@@ -347,6 +351,13 @@ void Asset::SetFileBuffer(const Io::FileBuffer& fb)
     mRawAsset = fb;
 }
 
+void Asset::SetBinaryBuffer(const Io::FileBuffer& fb)
+{
+    PG_ASSERT(mFormat == Asset::FMT_STRUCTURED);
+    mBinaryBuffer.DestroyBuffer();
+    mBinaryBuffer = fb;
+}
+
 void Asset::SetPath(const char* path)
 {
     if (path == mPathString) return;
@@ -375,11 +386,23 @@ void Asset::SetPath(const char* path)
 }
 
 void Asset::DumpToStream(Utils::ByteStream& stream)
+{
+    DumpToStream(stream, mEncoding);
+}
+
+void Asset::DumpToStream(Utils::ByteStream& stream, Asset::Encoding encoding)
 {
     PG_ASSERT (mFormat == Asset::FMT_STRUCTURED)
     if (mRoot != nullptr)
     {
-        AssetPrivate::DumpElementToStream(0, mRoot, stream);
+        if (encoding == Asset::ENCODING_BINARY)
+        {
+            WriteBinaryAsset(mRoot, mAllocator, stream);
+        }
+        else
+        {
+            AssetPrivate::DumpElementToStream(0, mRoot, stream);
+        }
     }
 }
 
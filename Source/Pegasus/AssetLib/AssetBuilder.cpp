@@ -94,9 +94,13 @@ const char* AssetBuilder::CopyString(const char* string)
 void AssetBuilder::EnqueueChildAsset(const char* name, const char* newAssetPath)
 {
     PG_ASSERT(mObjStack.GetSize() != 0)
-    Object* obj = GetObject();
+    EnqueueChildAsset(GetObject(), name, newAssetPath);
+}
+
+void AssetBuilder::EnqueueChildAsset(Object* object, const char* name, const char* newAssetPath)
+{
     ObjectChildAssetRequest& request = mObjectChildAssetQueue.PushEmpty();
-    request.object = obj;
+    request.object = object;
     request.identifier = name;
     request.assetPath = newAssetPath;
 }
@@ -104,8 +108,12 @@ void AssetBuilder::EnqueueChildAsset(const char* name, const char* newAssetPath)
 void AssetBuilder::EnqueueAssetArrayElement(const char* assetPath)
 {
     PG_ASSERT(mArrStack.GetSize() != 0);
-    Array* arr = GetArray();
+    EnqueueAssetArrayElement(GetArray(), assetPath);
+}
+
+void AssetBuilder::EnqueueAssetArrayElement(Array* array, const char* assetPath)
+{
     ArrayChildAssetRequest& request = mArrayChildAssetQueue.PushEmpty();
-    request.array = arr;
+    request.array = array;
     request.assetPath = assetPath;
 }
@@ -15,6 +15,7 @@
 #include "Pegasus/AssetLib/RuntimeAssetObject.h"
 #include "Pegasus/AssetLib/AssetRuntimeFactory.h"
 #include "Pegasus/AssetLib/ASTree.h"
+#include "Pegasus/AssetLib/BinaryAsset.h"
 #include "Pegasus/Allocator/IAllocator.h"
 #include "Pegasus/Core/Io.h"
 #include "Pegasus/Core/Log.h"
@@ -40,7 +41,11 @@ Pegasus::AssetLib::AssetLib::AssetLib(Alloc::IAllocator* allocator, Io::IOManage
   mIoMgr(mgr),
   mAllocator(allocator),
   mAssets(allocator),
-  mFactories(allocator)
+  mAssetIndex(allocator),
+  mFactories(allocator),
+  mLoadGraph(allocator, this),
+  mLoadObjectDepth(0),
+  mParallelLoading(true)
 #if PEGASUS_ENABLE_PROXIES
   ,mProxy(this)
 #endif
@@ -63,34 +68,10 @@ Pegasus::AssetLib::AssetLib::AssetLib(Alloc::IAllocator* allocator, Io::IOManage
     }
 #endif
 }
-char toLow(char c)
-{
-    return c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c;
-}
-
-char toBrac(char c)
-{
-    return c == '/' ? '\\' : c;
-}
-
-static bool PathsAreEqual(const char* str1, const char* str2)
-{
-    bool eq = true;
-    while (eq && *str1 != '\0' && *str2 != '\0')
-    {
-        char ch1 = *str1;
-        char ch2 = *str2;
-        ch1 = toBrac(toLow(ch1));
-        ch2 = toBrac(toLow(ch2));
-        eq = ch1 == ch2;
-        ++str1;
-        ++str2;
-    }
-    return eq && *str1 == *str2;
-}
-
 Pegasus::AssetLib::AssetLib::~AssetLib()
 {
+    mLoadGraph.Clear();
+
     for (unsigned int i = 0; i < mAssets.GetSize(); ++i)
     {      
         PG_DELETE(mAllocator, mAssets[i]);
@@ -160,25 +141,23 @@ extern void Bison_AssetScriptParse(const Io::FileBuffer* fileBuffer, AssetBuilde
 Io::IoError Pegasus::AssetLib::AssetLib::LoadAsset(const char* path, bool isStructured, Pegasus::AssetLib::Asset** assetOut)
 {
     //try to find it first
-    for (unsigned int i = 0; i < mAssets.GetSize(); ++i)
+    Asset* loadedAsset = mAssetIndex.Find(path);
+    if (loadedAsset != nullptr)
     {
-        if (PathsAreEqual(mAssets[i]->GetPath(), path))
+        if (isStructured != (loadedAsset->GetFormat() == Pegasus::AssetLib::Asset::FMT_STRUCTURED))
         {
-            if (isStructured != (mAssets[i]->GetFormat() == Pegasus::AssetLib::Asset::FMT_STRUCTURED))
-            {
-                *assetOut = nullptr;
-                return Io::ERR_READING_FILE;
-            }
-            *assetOut = mAssets[i];
+            *assetOut = nullptr;
+            return Io::ERR_READING_FILE;
+        }
+        *assetOut = loadedAsset;
 #if PEGASUS_ASSETLIB_ENABLE_CATEGORIES
-            //asset is referenced on this cateogry
-            if (mCurrentCategory != nullptr)
-            {
-                mCurrentCategory->RegisterAsset(*assetOut);
-            }
-#endif
-            return Io::ERR_NONE;
+        //asset is referenced on this cateogry
+        if (mCurrentCategory != nullptr)
+        {
+            mCurrentCategory->RegisterAsset(*assetOut);
         }
+#endif
+        return Io::ERR_NONE;
     }
 
     //not found? lets build it from a file..
@@ -187,6 +166,7 @@ Io::IoError Pegasus::AssetLib::AssetLib::LoadAsset(const char* path, bool isStru
     Io::IoError err = InternalBuildAsset(assetOut, isStructured, path);         
     if (*assetOut != nullptr)
     {
+        mAssetIndex.Insert(*assetOut, static_cast<int>(mAssets.GetSize()));
         mAssets.PushEmpty() = *assetOut;
     }
 #if PEGASUS_ASSETLIB_ENABLE_CATEGORIES
@@ -213,8 +193,23 @@ Io::IoError Pegasus::AssetLib::AssetLib::InternalBuildAsset(Asset** assetOut, bo
     path = isPreallocated ? (*assetOut)->GetPath() : path;
     isStructured = isPreallocated ? (*assetOut)->GetFormat() == Asset::FMT_STRUCTURED : isStructured;
 
+    //preloaded assets are read and parsed already, only their child assets are left
+    const AssetBuilder* preloadedBuilder = nullptr;
+    if (!isPreallocated && mLoadGraph.TakeAsset(path, isStructured, assetOut, &preloadedBuilder))
+    {
+        if (isStructured)
+        {
+            ResolvePendingChildAssets(*assetOut, *preloadedBuilder);
+        }
+        return Io::ERR_NONE;
+    }
+
     Io::FileBuffer fileBuffer;
+#if PEGASUS_USE_MAPPED_ASSETS
+    Io::IoError err = mIoMgr->MapFileToBuffer(path, fileBuffer, mAllocator); //map the raw file first, pages are read on first access
+#else
     Io::IoError err = mIoMgr->OpenFileToBuffer(path, fileBuffer, true, mAllocator); //open the raw file first
+#endif
 
     if (err == Io::ERR_NONE)
     {
@@ -225,11 +220,10 @@ Io::IoError Pegasus::AssetLib::AssetLib::InternalBuildAsset(Asset** assetOut, bo
         (*assetOut)->SetPath(path);
         if (isStructured)
         {
-            mBuilder.BeginCompilation(*assetOut);
-            Bison_AssetScriptParse(&fileBuffer, &mBuilder);    
+            BuildStructuredAsset(*assetOut, fileBuffer, &mBuilder);
             if (mBuilder.GetErrorCount() == 0)
             {
-                ResolvePendingChildAssets(*assetOut);
+                ResolvePendingChildAssets(*assetOut, mBuilder);
             }
             else
             {
@@ -251,31 +245,62 @@ Io::IoError Pegasus::AssetLib::AssetLib::InternalBuildAsset(Asset** assetOut, bo
     return err;
 }
 
-void Pegasus::AssetLib::AssetLib::UnloadAsset(Asset* asset)
+void Pegasus::AssetLib::AssetLib::BuildStructuredAsset(Asset* asset, Io::FileBuffer& fileBuffer, AssetBuilder* builder) const
 {
-    //find this asset
-    for (unsigned int i = 0; i < mAssets.GetSize(); ++i)
+    builder->BeginCompilation(asset);
+    if (IsBinaryAsset(fileBuffer.GetBuffer(), fileBuffer.GetFileSize()))
     {
-        if (mAssets[i] == asset)
+        //binary assets are used in place, the asset keeps the buffer the tree points into
+        const char* buffer = fileBuffer.GetBuffer();
+        const int bufferSize = fileBuffer.GetFileSize();
+        asset->SetEncoding(Asset::ENCODING_BINARY);
+        asset->SetBinaryBuffer(fileBuffer);
+        fileBuffer.ForgetBuffer();
+        if (!ReadBinaryAsset(buffer, bufferSize, mAllocator, builder))
         {
-            if (asset->GetRuntimeData() != nullptr)
-            {
-                asset->GetRuntimeData()->mAsset = nullptr;
-            }
-            mAssets.Delete(i);
-            PG_DELETE(mAllocator, asset);
-            return;
+            builder->IncErrorCount();
         }
     }
-    PG_FAILSTR("Asset not found!, do not call this function if this asset is not associated with this library");
+    else
+    {
+        asset->SetEncoding(Asset::ENCODING_TEXT);
+        Bison_AssetScriptParse(&fileBuffer, builder);
+    }
 }
 
-void Pegasus::AssetLib::AssetLib::ResolvePendingChildAssets(Asset* asset)
+void Pegasus::AssetLib::AssetLib::UnloadAsset(Asset* asset)
+{
+    //find this asset, the index keeps its position in the asset list
+    int assetPosition = -1;
+    if (!mAssetIndex.Contains(asset, &assetPosition))
+    {
+        PG_FAILSTR("Asset not found!, do not call this function if this asset is not associated with this library");
+        return;
+    }
+
+    if (asset->GetRuntimeData() != nullptr)
+    {
+        asset->GetRuntimeData()->mAsset = nullptr;
+    }
+
+    //the last asset takes the free position, so nothing is moved but one pointer
+    const unsigned int lastPosition = mAssets.GetSize() - 1;
+    if (static_cast<unsigned int>(assetPosition) != lastPosition)
+    {
+        mAssets[assetPosition] = mAssets[lastPosition];
+        mAssetIndex.SetUserData(mAssets[assetPosition], assetPosition);
+    }
+    mAssets.Delete(lastPosition);
+    mAssetIndex.Remove(asset);
+    PG_DELETE(mAllocator, asset);
+}
+
+void Pegasus::AssetLib::AssetLib::ResolvePendingChildAssets(Asset* asset, const AssetBuilder& builder)
 {
     //it's important to copy these two vectors. Because the builder gets resetted when loading, this will
     // mean that the builder gets reset when recursive loading takes place.
-    Pegasus::Utils::Vector<AssetBuilder::ObjectChildAssetRequest> objectRequest = mBuilder.mObjectChildAssetQueue;
-    Pegasus::Utils::Vector<AssetBuilder::ArrayChildAssetRequest> arrayRequests = mBuilder.mArrayChildAssetQueue;
+    Pegasus::Utils::Vector<AssetBuilder::ObjectChildAssetRequest> objectRequest = builder.mObjectChildAssetQueue;
+    Pegasus::Utils::Vector<AssetBuilder::ArrayChildAssetRequest> arrayRequests = builder.mArrayChildAssetQueue;
 
     for (unsigned i = 0; i < objectRequest.GetSize(); ++i)
     {
@@ -305,18 +330,16 @@ Asset* Pegasus::AssetLib::AssetLib::CreateAsset(const char* path, bool isStructu
 {
     Asset* asset = nullptr;
     //try to find it first
-    for (unsigned int i = 0; i < mAssets.GetSize(); ++i)
+    if (mAssetIndex.Find(path) != nullptr)
     {
-        if (PathsAreEqual(mAssets[i]->GetPath(), path))
-        {
-            PG_LOG('ERR_', "Attempting to create an asset that already exists on cache!");
-            return nullptr;  //Cant allow to override this asset
-        }
+        PG_LOG('ERR_', "Attempting to create an asset that already exists on cache!");
+        return nullptr;  //Cant allow to override this asset
     }
 
     // structured means its a json file. non structured means it does not get parsed and the file gets raw'd
     asset = PG_NEW(mAllocator, -1, "Asset", Alloc::PG_MEM_TEMP) Asset(mAllocator, this, isStructured ? Asset::FMT_STRUCTURED : Asset::FMT_RAW);
     asset->SetPath(path);
+    mAssetIndex.Insert(asset, static_cast<int>(mAssets.GetSize()));
     mAssets.PushEmpty() = asset;
 
     if (!isStructured)
@@ -366,21 +389,17 @@ void Pegasus::AssetLib::AssetLib::RegisterObjectFactory(AssetRuntimeFactory* fac
     mFactories.PushEmpty() = factory;
 }
 
-RuntimeAssetObjectRef Pegasus::AssetLib::AssetLib::LoadObject(const char* path)
+bool Pegasus::AssetLib::AssetLib::GetPathFormat(const char* path, const char** outExtension, bool* outIsStructured)
 {
-    
-    Pegasus::AssetLib::Asset* asset = nullptr;
-
-    bool isStructured = true; //assume is structured.
-
     const char* extension = Utils::Strrchr(path, '.');
     if (extension == nullptr || extension[0] == '\0')
     {
-        PG_LOG('ERR_', "Extension is required for any asset loaded through the asset system.");
-        return nullptr;
+        return false;
     }
 
     ++extension; //skip the . character
+    *outExtension = extension;
+    *outIsStructured = true; //assume is structured.
 
     //find out if its structured or not.
     const Pegasus::PegasusAssetTypeDesc* const* desc = GetAllAssetTypesDescs();
@@ -388,11 +407,66 @@ RuntimeAssetObjectRef Pegasus::AssetLib::AssetLib::LoadObject(const char* path)
     {
         if (!Utils::Stricmp(extension,(*desc)->mExtension))
         {
-            isStructured = (*desc)->mIsStructured;
+            *outIsStructured = (*desc)->mIsStructured;
             break;
         }
         ++desc;
     }
+    return true;
+}
+
+void Pegasus::AssetLib::AssetLib::PreloadAssets(const char* const* paths, int pathCount)
+{
+    mLoadGraph.Load(paths, pathCount);
+
+    const LoadGraphStats& stats = mLoadGraph.GetStats();
+    if (stats.mAssetCount > 1)
+    {
+        PG_LOG('ASST', "Preloaded %d assets (%d failed, depth %d) in %.2f ms: serial %.2f ms (read %.2f ms, parse %.2f ms), critical path %.2f ms, speedup %.2fx",
+            stats.mAssetCount, stats.mFailedCount, stats.mDepth, stats.mWallTime * 1000.0,
+            stats.GetSerialTime() * 1000.0, stats.mReadTime * 1000.0, stats.mParseTime * 1000.0, stats.mCriticalPath * 1000.0,
+            stats.mWallTime > 0.0 ? stats.GetSerialTime() / stats.mWallTime : 1.0);
+    }
+}
+
+void Pegasus::AssetLib::AssetLib::ReleasePreloadedAssets()
+{
+    mLoadGraph.Clear();
+}
+
+RuntimeAssetObjectRef Pegasus::AssetLib::AssetLib::LoadObject(const char* path)
+{
+    //the first object loaded reads and parses its whole asset graph in parallel,
+    //the child objects loaded while creating it then find their assets ready
+    const bool ownsPreload = mLoadObjectDepth == 0 && mParallelLoading && mLoadGraph.IsEmpty();
+    if (ownsPreload)
+    {
+        PreloadAssets(&path, 1);
+    }
+
+    ++mLoadObjectDepth;
+    RuntimeAssetObjectRef obj = InternalLoadObject(path);
+    --mLoadObjectDepth;
+
+    if (ownsPreload)
+    {
+        ReleasePreloadedAssets();
+    }
+    return obj;
+}
+
+RuntimeAssetObjectRef Pegasus::AssetLib::AssetLib::InternalLoadObject(const char* path)
+{
+    
+    Pegasus::AssetLib::Asset* asset = nullptr;
+
+    bool isStructured = true;
+    const char* extension = nullptr;
+    if (!GetPathFormat(path, &extension, &isStructured))
+    {
+        PG_LOG('ERR_', "Extension is required for any asset loaded through the asset system.");
+        return nullptr;
+    }
     
     if (Io::ERR_NONE == LoadAsset(path, isStructured, &asset))
     {
@@ -522,7 +596,7 @@ bool Pegasus::AssetLib::AssetLib::DeserializeAsset(Asset* asset, char* buffer)
     fb.ForgetBuffer();
     if (mBuilder.GetErrorCount() == 0)
     {
-        ResolvePendingChildAssets(asset);
+        ResolvePendingChildAssets(asset, mBuilder);
         return true;
     }
     return false;
@@ -532,7 +606,7 @@ char* Pegasus::AssetLib::AssetLib::SerializeAsset(Asset* asset)
 {
     static const char sNull = 0;
     Utils::ByteStream bs(mAllocator);
-    asset->DumpToStream(bs);
+    asset->DumpToStream(bs, Asset::ENCODING_TEXT);
     bs.Append(&sNull, 1);
     void* result = bs.GetBuffer();
     bs.ForgetBuffer();
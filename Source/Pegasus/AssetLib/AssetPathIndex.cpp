@@ -0,0 +1,287 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   AssetPathIndex.cpp
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Hash index of assets by normalized path (case and kind of slashes ignored)
+
+#include "Pegasus/AssetLib/AssetPathIndex.h"
+#include "Pegasus/AssetLib/Asset.h"
+#include "Pegasus/Allocator/IAllocator.h"
+#include "Pegasus/Allocator/Alloc.h"
+#include "Pegasus/Core/Assertion.h"
+#include "Pegasus/Memory/MemoryManager.h"
+
+using namespace Pegasus;
+using namespace Pegasus::AssetLib;
+
+namespace
+{
+
+//! Smallest table, allocated on the first insertion
+const unsigned int MIN_CAPACITY = 32;
+
+//! \return the character as compared by PathsAreEqual
+inline char NormalizePathChar(char c)
+{
+    c = c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c;
+    return c == '/' ? '\\' : c;
+}
+
+}
+
+//----------------------------------------------------------------------------------------
+
+AssetPathIndex::AssetPathIndex()
+:   mAllocator(Memory::GetGlobalAllocator()),
+    mSlots(nullptr),
+    mCapacity(0),
+    mCount(0),
+    mRemovedCount(0)
+{
+}
+
+//----------------------------------------------------------------------------------------
+
+AssetPathIndex::AssetPathIndex(Alloc::IAllocator* allocator)
+:   mAllocator(allocator),
+    mSlots(nullptr),
+    mCapacity(0),
+    mCount(0),
+    mRemovedCount(0)
+{
+}
+
+//----------------------------------------------------------------------------------------
+
+AssetPathIndex::~AssetPathIndex()
+{
+    if (mSlots != nullptr)
+    {
+        PG_DELETE_ARRAY(mAllocator, mSlots);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int AssetPathIndex::HashPath(const char* path)
+{
+    //same hash as Utils::HashStr, on the normalized characters
+    unsigned int hash = 5381;
+    while (*path != '\0')
+    {
+        hash = ((hash << 5) + hash) + static_cast<unsigned char>(NormalizePathChar(*path));
+        ++path;
+    }
+
+    //the table uses the low bits only, mix the high bits in
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6bu;
+    hash ^= hash >> 13;
+    return hash;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool AssetPathIndex::PathsAreEqual(const char* str1, const char* str2)
+{
+    bool eq = true;
+    while (eq && *str1 != '\0' && *str2 != '\0')
+    {
+        eq = NormalizePathChar(*str1) == NormalizePathChar(*str2);
+        ++str1;
+        ++str2;
+    }
+    return eq && *str1 == *str2;
+}
+
+//----------------------------------------------------------------------------------------
+
+void AssetPathIndex::Insert(Asset* asset, int userData)
+{
+    PG_ASSERTSTR(asset != nullptr, "Cannot index a null asset");
+
+    //keep at least a quarter of the slots empty, so the probe sequences stay short
+    if ((mCount + mRemovedCount + 1) * 4 > mCapacity * 3)
+    {
+        unsigned int capacity = mCapacity == 0 ? MIN_CAPACITY : mCapacity;
+        while ((mCount + 1) * 2 > capacity)
+        {
+            capacity <<= 1;
+        }
+        Rehash(capacity);
+    }
+
+    const unsigned int hash = HashPath(asset->GetPath());
+    const unsigned int mask = mCapacity - 1;
+    unsigned int s = hash & mask;
+    while (mSlots[s].mAsset != nullptr)
+    {
+        s = (s + 1) & mask;
+    }
+
+    Slot& slot = mSlots[s];
+    if (slot.mIsRemoved)
+    {
+        --mRemovedCount;
+    }
+    slot.mAsset = asset;
+    slot.mHash = hash;
+    slot.mUserData = userData;
+    slot.mIsRemoved = false;
+    ++mCount;
+}
+
+//----------------------------------------------------------------------------------------
+
+Asset* AssetPathIndex::Find(const char* path, int* outUserData) const
+{
+    if (mCount == 0)
+    {
+        return nullptr;
+    }
+
+    const unsigned int hash = HashPath(path);
+    const unsigned int mask = mCapacity - 1;
+    for (unsigned int s = hash & mask; ; s = (s + 1) & mask)
+    {
+        const Slot& slot = mSlots[s];
+        if (slot.mAsset == nullptr)
+        {
+            if (!slot.mIsRemoved)
+            {
+                return nullptr;
+            }
+        }
+        else if (slot.mHash == hash && PathsAreEqual(slot.mAsset->GetPath(), path))
+        {
+            if (outUserData != nullptr)
+            {
+                *outUserData = slot.mUserData;
+            }
+            return slot.mAsset;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+bool AssetPathIndex::Contains(const Asset* asset, int* outUserData) const
+{
+    const Slot* slot = FindSlot(asset);
+    if (slot != nullptr && outUserData != nullptr)
+    {
+        *outUserData = slot->mUserData;
+    }
+    return slot != nullptr;
+}
+
+//----------------------------------------------------------------------------------------
+
+void AssetPathIndex::SetUserData(Asset* asset, int userData)
+{
+    Slot* slot = FindSlot(asset);
+    PG_ASSERTSTR(slot != nullptr, "The asset %s is not in the index", asset->GetPath());
+    if (slot != nullptr)
+    {
+        slot->mUserData = userData;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+bool AssetPathIndex::Remove(Asset* asset)
+{
+    Slot* slot = FindSlot(asset);
+    if (slot == nullptr)
+    {
+        return false;
+    }
+
+    slot->mAsset = nullptr;
+    slot->mIsRemoved = true;
+    --mCount;
+    ++mRemovedCount;
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+
+AssetPathIndex::Slot* AssetPathIndex::FindSlot(const Asset* asset) const
+{
+    if (mCount == 0)
+    {
+        return nullptr;
+    }
+
+    const unsigned int hash = HashPath(asset->GetPath());
+    const unsigned int mask = mCapacity - 1;
+    for (unsigned int s = hash & mask; ; s = (s + 1) & mask)
+    {
+        Slot& slot = mSlots[s];
+        if (slot.mAsset == asset)
+        {
+            return &slot;
+        }
+        else if (slot.mAsset == nullptr && !slot.mIsRemoved)
+        {
+            return nullptr;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void AssetPathIndex::Clear()
+{
+    for (unsigned int s = 0; s < mCapacity; ++s)
+    {
+        mSlots[s].mAsset = nullptr;
+        mSlots[s].mIsRemoved = false;
+    }
+    mCount = 0;
+    mRemovedCount = 0;
+}
+
+//----------------------------------------------------------------------------------------
+
+void AssetPathIndex::Rehash(unsigned int capacity)
+{
+    PG_ASSERTSTR((capacity & (capacity - 1)) == 0, "The capacity of the asset path index has to be a power of 2");
+    Slot* oldSlots = mSlots;
+    const unsigned int oldCapacity = mCapacity;
+
+    mSlots = PG_NEW_ARRAY(mAllocator, -1, "AssetPathIndex::Slots", Alloc::PG_MEM_PERM, Slot, capacity);
+    mCapacity = capacity;
+    mRemovedCount = 0;
+    for (unsigned int s = 0; s < capacity; ++s)
+    {
+        mSlots[s].mAsset = nullptr;
+        mSlots[s].mIsRemoved = false;
+    }
+
+    //hashes are kept in the slots, assets are not hashed again
+    const unsigned int mask = capacity - 1;
+    for (unsigned int o = 0; o < oldCapacity; ++o)
+    {
+        const Slot& oldSlot = oldSlots[o];
+        if (oldSlot.mAsset != nullptr)
+        {
+            unsigned int s = oldSlot.mHash & mask;
+            while (mSlots[s].mAsset != nullptr)
+            {
+                s = (s + 1) & mask;
+            }
+            mSlots[s] = oldSlot;
+        }
+    }
+
+    if (oldSlots != nullptr)
+    {
+        PG_DELETE_ARRAY(mAllocator, oldSlots);
+    }
+}
@@ -0,0 +1,625 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   BinaryAsset.cpp
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Binary encoding of structured assets, same Object / Array tree as the text grammar
+
+#include "Pegasus/AssetLib/BinaryAsset.h"
+#include "Pegasus/AssetLib/Asset.h"
+#include "Pegasus/AssetLib/AssetBuilder.h"
+#include "Pegasus/AssetLib/ASTree.h"
+#include "Pegasus/AssetLib/RuntimeAssetObject.h"
+#include "Pegasus/Allocator/Alloc.h"
+#include "Pegasus/Utils/ByteStream.h"
+#include "Pegasus/Utils/Memcpy.h"
+#include "Pegasus/Utils/Memset.h"
+#include "Pegasus/Utils/String.h"
+#include "Pegasus/Utils/Vector.h"
+
+using namespace Pegasus;
+using namespace Pegasus::AssetLib;
+
+namespace BinaryAssetPrivate
+{
+    //! Gives one index to each unique string of the asset, so keys repeated in every object are stored once
+    class StringTable
+    {
+    public:
+        explicit StringTable(Alloc::IAllocator* allocator)
+        :   mAllocator(allocator), mStrings(allocator), mSlots(nullptr), mSlotMask(0)
+        {
+            Grow();
+        }
+
+        ~StringTable()
+        {
+            PG_DELETE_ARRAY(mAllocator, mSlots);
+        }
+
+        //! \return the index of the string, added if it is not in the table yet
+        unsigned int Intern(const char* str)
+        {
+            unsigned int slot = Utils::HashStr(str) & mSlotMask;
+            while (mSlots[slot] != 0)
+            {
+                const unsigned int index = mSlots[slot] - 1;
+                if (!Utils::Strcmp(mStrings[index], str))
+                {
+                    return index;
+                }
+                slot = (slot + 1) & mSlotMask;
+            }
+
+            const unsigned int index = mStrings.GetSize();
+            mStrings.PushEmpty() = str;
+            mSlots[slot] = index + 1;
+
+            // keep the table at most half full
+            if (2 * mStrings.GetSize() > mSlotMask + 1)
+            {
+                Grow();
+            }
+            return index;
+        }
+
+        unsigned int GetCount() const { return mStrings.GetSize(); }
+        const char* GetString(unsigned int i) const { return mStrings[i]; }
+
+    private:
+        //! Doubles the number of slots and reinserts the strings
+        void Grow()
+        {
+            const unsigned int slotCount = (mSlotMask + 1) * 2 < 256 ? 256 : (mSlotMask + 1) * 2;
+            PG_DELETE_ARRAY(mAllocator, mSlots);
+            mSlots = PG_NEW_ARRAY(mAllocator, -1, "BinaryAsset::StringTable", Alloc::PG_MEM_TEMP, unsigned int, slotCount);
+            Utils::Memset32(mSlots, 0, slotCount * sizeof(unsigned int));
+            mSlotMask = slotCount - 1;
+            for (unsigned int i = 0; i < mStrings.GetSize(); ++i)
+            {
+                unsigned int slot = Utils::HashStr(mStrings[i]) & mSlotMask;
+                while (mSlots[slot] != 0)
+                {
+                    slot = (slot + 1) & mSlotMask;
+                }
+                mSlots[slot] = i + 1;
+            }
+        }
+
+        Alloc::IAllocator* mAllocator;
+        Utils::Vector<const char*> mStrings;
+        //! open addressing table of string index + 1, 0 for an empty slot
+        unsigned int* mSlots;
+        unsigned int mSlotMask;
+    };
+
+    //! Object or array waiting for its record to be written
+    struct PendingNode
+    {
+        const Object* mObject;
+        const Array* mArray;
+    };
+
+    void WriteUint(Utils::ByteStream& stream, unsigned int value)
+    {
+        stream.Append(&value, sizeof(value));
+    }
+
+    unsigned int FloatToUint(float f)
+    {
+        union { float f; unsigned int u; } bits;
+        bits.f = f;
+        return bits.u;
+    }
+
+    float UintToFloat(unsigned int u)
+    {
+        union { float f; unsigned int u; } bits;
+        bits.u = u;
+        return bits.f;
+    }
+
+    const char* GetAssetPath(const RuntimeAssetObject* assetObject)
+    {
+        PG_ASSERTSTR(assetObject != nullptr && assetObject->GetOwnerAsset() != nullptr, "Child asset without a path cannot be written");
+        return assetObject->GetOwnerAsset()->GetPath();
+    }
+
+    //! Writes the record of an object, and queues its child objects and arrays
+    void WriteObject(const Object* obj, StringTable& strings, Utils::Vector<PendingNode>& pending,
+                     unsigned int& objectCount, unsigned int& arrayCount, Utils::ByteStream& stream)
+    {
+        WriteUint(stream, obj->GetIntCount());
+        WriteUint(stream, obj->GetFloatCount());
+        WriteUint(stream, obj->GetStringCount());
+        WriteUint(stream, obj->GetObjectCount());
+        WriteUint(stream, obj->GetAssetsCount());
+        WriteUint(stream, obj->GetArrayCount());
+
+        for (int i = 0; i < obj->GetIntCount(); ++i)
+        {
+            WriteUint(stream, strings.Intern(obj->GetIntName(i)));
+            WriteUint(stream, static_cast<unsigned int>(obj->GetInt(i)));
+        }
+
+        for (int i = 0; i < obj->GetFloatCount(); ++i)
+        {
+            WriteUint(stream, strings.Intern(obj->GetFloatName(i)));
+            WriteUint(stream, FloatToUint(obj->GetFloat(i)));
+        }
+
+        for (int i = 0; i < obj->GetStringCount(); ++i)
+        {
+            WriteUint(stream, strings.Intern(obj->GetStringName(i)));
+            WriteUint(stream, strings.Intern(obj->GetString(i)));
+        }
+
+        for (int i = 0; i < obj->GetObjectCount(); ++i)
+        {
+            WriteUint(stream, strings.Intern(obj->GetObjectName(i)));
+            WriteUint(stream, objectCount++);
+            PendingNode& node = pending.PushEmpty();
+            node.mObject = obj->GetObject(i);
+            node.mArray = nullptr;
+        }
+
+        for (int i = 0; i < obj->GetAssetsCount(); ++i)
+        {
+            WriteUint(stream, strings.Intern(obj->GetAssetName(i)));
+            WriteUint(stream, strings.Intern(GetAssetPath(&(*obj->GetAsset(i)))));
+        }
+
+        for (int i = 0; i < obj->GetArrayCount(); ++i)
+        {
+            WriteUint(stream, strings.Intern(obj->GetArrayName(i)));
+            WriteUint(stream, arrayCount++);
+            PendingNode& node = pending.PushEmpty();
+            node.mObject = nullptr;
+            node.mArray = obj->GetArray(i);
+        }
+    }
+
+    //! Writes the record of an array, and queues its child objects and arrays
+    void WriteArray(const Array* arr, StringTable& strings, Utils::Vector<PendingNode>& pending,
+                    unsigned int& objectCount, unsigned int& arrayCount, Utils::ByteStream& stream)
+    {
+        WriteUint(stream, static_cast<unsigned int>(arr->GetType()));
+        WriteUint(stream, static_cast<unsigned int>(arr->GetSize()));
+
+        switch (arr->GetType())
+        {
+        case Array::AS_TYPE_INT:
+            for (int i = 0; i < arr->GetSize(); ++i)
+            {
+                WriteUint(stream, static_cast<unsigned int>(arr->GetElement(i).i));
+            }
+            break;
+        case Array::AS_TYPE_FLOAT:
+            for (int i = 0; i < arr->GetSize(); ++i)
+            {
+                WriteUint(stream, FloatToUint(arr->GetElement(i).f));
+            }
+            break;
+        case Array::AS_TYPE_STRING:
+            for (int i = 0; i < arr->GetSize(); ++i)
+            {
+                WriteUint(stream, strings.Intern(arr->GetElement(i).s));
+            }
+            break;
+        case Array::AS_TYPE_ASSET_PATH_REF:
+            for (int i = 0; i < arr->GetSize(); ++i)
+            {
+                WriteUint(stream, strings.Intern(GetAssetPath(arr->GetElement(i).asset)));
+            }
+            break;
+        case Array::AS_TYPE_OBJECT:
+            for (int i = 0; i < arr->GetSize(); ++i)
+            {
+                WriteUint(stream, objectCount++);
+                PendingNode& node = pending.PushEmpty();
+                node.mObject = arr->GetElement(i).o;
+                node.mArray = nullptr;
+            }
+            break;
+        case Array::AS_TYPE_ARRAY:
+            for (int i = 0; i < arr->GetSize(); ++i)
+            {
+                WriteUint(stream, arrayCount++);
+                PendingNode& node = pending.PushEmpty();
+                node.mObject = nullptr;
+                node.mArray = arr->GetElement(i).a;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    //! Bounds checked view of a binary asset buffer
+    class Reader
+    {
+    public:
+        Reader(const char* buffer, const BinaryAssetHeader& header)
+        :   mBuffer(buffer), mHeader(header), mWords(reinterpret_cast<const unsigned int*>(buffer))
+        {
+        }
+
+        //! \return true if count words from offset are inside the asset
+        bool IsRangeValid(unsigned int offset, unsigned int count) const
+        {
+            return (offset & 3) == 0 && offset <= mHeader.mSize && count <= (mHeader.mSize - offset) / sizeof(unsigned int);
+        }
+
+        //! \return the word at a byte offset, which has to be valid
+        unsigned int GetWord(unsigned int offset) const { return mWords[offset / sizeof(unsigned int)]; }
+
+        //! \return a pointer to the words starting at a byte offset, which has to be valid
+        const unsigned int* GetWords(unsigned int offset) const { return mWords + offset / sizeof(unsigned int); }
+
+        //! \return the string of an index, nullptr if the index or its offset are invalid
+        const char* GetString(unsigned int index) const
+        {
+            if (index >= mHeader.mStringCount)
+            {
+                return nullptr;
+            }
+            const unsigned int offset = GetWord(mHeader.mStringTable + index * sizeof(unsigned int));
+            return (offset >= mHeader.mStringData && offset < mHeader.mSize) ? mBuffer + offset : nullptr;
+        }
+
+    private:
+        const char* mBuffer;
+        const BinaryAssetHeader& mHeader;
+        const unsigned int* mWords;
+    };
+
+    //! Validates the header against the buffer size, so the tables can be read without checks
+    bool IsHeaderValid(const BinaryAssetHeader& header, int size)
+    {
+        if (header.mVersion != BINARY_ASSET_VERSION || header.mSize > static_cast<unsigned int>(size) || header.mSize < sizeof(BinaryAssetHeader))
+        {
+            return false;
+        }
+
+        Reader reader(nullptr, header);
+        return header.mObjectCount > 0
+            && reader.IsRangeValid(header.mObjectTable, header.mObjectCount)
+            && reader.IsRangeValid(header.mArrayTable, header.mArrayCount)
+            && reader.IsRangeValid(header.mStringTable, header.mStringCount)
+            && header.mStringData <= header.mSize;
+    }
+
+    //! Marks an object or array as referenced, nodes with more than one reference would not form a tree
+    bool Reference(unsigned char* references, unsigned int node)
+    {
+        if (references[node] != 0)
+        {
+            return false;
+        }
+        references[node] = 1;
+        return true;
+    }
+
+    //! Fills an object from its record
+    bool ReadObject(const Reader& reader, unsigned int offset, Object* obj,
+                    Object** objects, Array** arrays, unsigned char* objectRefs, unsigned char* arrayRefs,
+                    const BinaryAssetHeader& header, AssetBuilder* builder)
+    {
+        if (!reader.IsRangeValid(offset, BINARY_MEMBER_COUNT))
+        {
+            return false;
+        }
+
+        const unsigned int* counts = reader.GetWords(offset);
+        unsigned int entryCount = 0;
+        for (int m = 0; m < BINARY_MEMBER_COUNT; ++m)
+        {
+            // each member takes 8 bytes, which also keeps the total below any overflow
+            if (counts[m] > header.mSize / (2 * sizeof(unsigned int)))
+            {
+                return false;
+            }
+            entryCount += counts[m];
+        }
+
+        offset += BINARY_MEMBER_COUNT * sizeof(unsigned int);
+        if (!reader.IsRangeValid(offset, 2 * entryCount))
+        {
+            return false;
+        }
+
+        const unsigned int* entry = reader.GetWords(offset);
+        for (int m = 0; m < BINARY_MEMBER_COUNT; ++m)
+        {
+            for (unsigned int i = 0; i < counts[m]; ++i, entry += 2)
+            {
+                const char* name = reader.GetString(entry[0]);
+                const unsigned int value = entry[1];
+                if (name == nullptr)
+                {
+                    return false;
+                }
+
+                switch (m)
+                {
+                case BINARY_MEMBER_INT:
+                    obj->AddInt(name, static_cast<int>(value));
+                    break;
+                case BINARY_MEMBER_FLOAT:
+                    obj->AddFloat(name, UintToFloat(value));
+                    break;
+                case BINARY_MEMBER_STRING:
+                    {
+                        const char* str = reader.GetString(value);
+                        if (str == nullptr) return false;
+                        obj->AddString(name, str);
+                    }
+                    break;
+                case BINARY_MEMBER_OBJECT:
+                    if (value == 0 || value >= header.mObjectCount || !Reference(objectRefs, value)) return false;
+                    obj->AddObject(name, objects[value]);
+                    break;
+                case BINARY_MEMBER_ASSET:
+                    {
+                        const char* path = reader.GetString(value);
+                        if (path == nullptr) return false;
+                        builder->EnqueueChildAsset(obj, name, path);
+                    }
+                    break;
+                case BINARY_MEMBER_ARRAY:
+                    if (value >= header.mArrayCount || !Reference(arrayRefs, value)) return false;
+                    obj->AddArray(name, arrays[value]);
+                    break;
+                }
+            }
+        }
+        return true;
+    }
+
+    //! Fills an array from its record
+    bool ReadArray(const Reader& reader, unsigned int offset, Array* arr,
+                   Object** objects, Array** arrays, unsigned char* objectRefs, unsigned char* arrayRefs,
+                   const BinaryAssetHeader& header, AssetBuilder* builder)
+    {
+        if (!reader.IsRangeValid(offset, 2))
+        {
+            return false;
+        }
+
+        const unsigned int rawType = reader.GetWord(offset);
+        const unsigned int count = reader.GetWord(offset + sizeof(unsigned int));
+        offset += 2 * sizeof(unsigned int);
+        if (rawType > static_cast<unsigned int>(Array::AS_TYPE_ARRAY) || !reader.IsRangeValid(offset, count))
+        {
+            return false;
+        }
+
+        const Array::Type type = static_cast<Array::Type>(rawType);
+
+        if (type != Array::AS_TYPE_NULL)
+        {
+            arr->CommitType(type);
+        }
+
+        // the elements are one contiguous blob, converted in a single pass
+        const unsigned int* values = reader.GetWords(offset);
+        Array::Element el;
+        switch (type)
+        {
+        case Array::AS_TYPE_INT:
+            for (unsigned int i = 0; i < count; ++i)
+            {
+                el.i = static_cast<int>(values[i]);
+                arr->PushElement(el);
+            }
+            break;
+        case Array::AS_TYPE_FLOAT:
+            for (unsigned int i = 0; i < count; ++i)
+            {
+                el.f = UintToFloat(values[i]);
+                arr->PushElement(el);
+            }
+            break;
+        case Array::AS_TYPE_STRING:
+            for (unsigned int i = 0; i < count; ++i)
+            {
+                el.s = reader.GetString(values[i]);
+                if (el.s == nullptr) return false;
+                arr->PushElement(el);
+            }
+            break;
+        case Array::AS_TYPE_ASSET_PATH_REF:
+            for (unsigned int i = 0; i < count; ++i)
+            {
+                const char* path = reader.GetString(values[i]);
+                if (path == nullptr) return false;
+                builder->EnqueueAssetArrayElement(arr, path);
+            }
+            break;
+        case Array::AS_TYPE_OBJECT:
+            for (unsigned int i = 0; i < count; ++i)
+            {
+                if (values[i] == 0 || values[i] >= header.mObjectCount || !Reference(objectRefs, values[i])) return false;
+                el.o = objects[values[i]];
+                arr->PushElement(el);
+            }
+            break;
+        case Array::AS_TYPE_ARRAY:
+            for (unsigned int i = 0; i < count; ++i)
+            {
+                if (values[i] >= header.mArrayCount || !Reference(arrayRefs, values[i])) return false;
+                el.a = arrays[values[i]];
+                arr->PushElement(el);
+            }
+            break;
+        default:
+            return count == 0;
+        }
+        return true;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+bool Pegasus::AssetLib::IsBinaryAsset(const char* buffer, int size)
+{
+    unsigned int magic = 0;
+    if (buffer == nullptr || size < static_cast<int>(sizeof(magic)))
+    {
+        return false;
+    }
+    Utils::Memcpy(&magic, buffer, sizeof(magic));
+    return magic == BINARY_ASSET_MAGIC;
+}
+
+//----------------------------------------------------------------------------------------
+
+void Pegasus::AssetLib::WriteBinaryAsset(const Object* root, Alloc::IAllocator* allocator, Utils::ByteStream& stream)
+{
+    using namespace BinaryAssetPrivate;
+    PG_ASSERTSTR(root != nullptr, "A binary asset requires a root object");
+
+    StringTable strings(allocator);
+    Utils::Vector<PendingNode> pending(allocator);
+    Utils::Vector<unsigned int> objectOffsets(allocator);
+    Utils::Vector<unsigned int> arrayOffsets(allocator);
+
+    // the header gets patched once all the offsets are known
+    const int base = stream.GetSize();
+    BinaryAssetHeader header;
+    Utils::Memset32(&header, 0, sizeof(header));
+    stream.Append(&header, sizeof(header));
+
+    // breadth first, objects and arrays get their index when queued,
+    // so the records of each kind are written in index order
+    unsigned int objectCount = 1;
+    unsigned int arrayCount = 0;
+    PendingNode& rootNode = pending.PushEmpty();
+    rootNode.mObject = root;
+    rootNode.mArray = nullptr;
+    for (unsigned int n = 0; n < pending.GetSize(); ++n)
+    {
+        const PendingNode node = pending[n];
+        if (node.mObject != nullptr)
+        {
+            objectOffsets.PushEmpty() = stream.GetSize() - base;
+            WriteObject(node.mObject, strings, pending, objectCount, arrayCount, stream);
+        }
+        else
+        {
+            arrayOffsets.PushEmpty() = stream.GetSize() - base;
+            WriteArray(node.mArray, strings, pending, objectCount, arrayCount, stream);
+        }
+    }
+    PG_ASSERT(objectOffsets.GetSize() == objectCount && arrayOffsets.GetSize() == arrayCount);
+
+    header.mObjectTable = stream.GetSize() - base;
+    for (unsigned int i = 0; i < objectOffsets.GetSize(); ++i)
+    {
+        WriteUint(stream, objectOffsets[i]);
+    }
+
+    header.mArrayTable = stream.GetSize() - base;
+    for (unsigned int i = 0; i < arrayOffsets.GetSize(); ++i)
+    {
+        WriteUint(stream, arrayOffsets[i]);
+    }
+
+    header.mStringTable = stream.GetSize() - base;
+    header.mStringData = header.mStringTable + strings.GetCount() * sizeof(unsigned int);
+    unsigned int stringOffset = header.mStringData;
+    for (unsigned int i = 0; i < strings.GetCount(); ++i)
+    {
+        WriteUint(stream, stringOffset);
+        stringOffset += Utils::Strlen(strings.GetString(i)) + 1;
+    }
+
+    for (unsigned int i = 0; i < strings.GetCount(); ++i)
+    {
+        stream.Append(strings.GetString(i), Utils::Strlen(strings.GetString(i)) + 1);
+    }
+
+    header.mMagic = BINARY_ASSET_MAGIC;
+    header.mVersion = BINARY_ASSET_VERSION;
+    header.mSize = stream.GetSize() - base;
+    header.mObjectCount = objectCount;
+    header.mArrayCount = arrayCount;
+    header.mStringCount = strings.GetCount();
+    Utils::Memcpy(static_cast<char*>(stream.GetBuffer()) + base, &header, sizeof(header));
+}
+
+//----------------------------------------------------------------------------------------
+
+bool Pegasus::AssetLib::ReadBinaryAsset(const char* buffer, int size, Alloc::IAllocator* allocator, AssetBuilder* builder)
+{
+    using namespace BinaryAssetPrivate;
+    PG_ASSERTSTR((reinterpret_cast<size_t>(buffer) & 3) == 0, "Binary assets have to be loaded at a 4 byte aligned address");
+
+    if (!IsBinaryAsset(buffer, size) || size < static_cast<int>(sizeof(BinaryAssetHeader)))
+    {
+        return false;
+    }
+
+    const BinaryAssetHeader& header = *reinterpret_cast<const BinaryAssetHeader*>(buffer);
+    if (!IsHeaderValid(header, size))
+    {
+        PG_LOG('ERR_', "Invalid binary asset header, version %u (expected %u).", header.mVersion, BINARY_ASSET_VERSION);
+        return false;
+    }
+
+    // every string ends inside the string data
+    if (header.mStringCount > 0 && buffer[header.mSize - 1] != '\0')
+    {
+        return false;
+    }
+
+    Asset* asset = builder->GetBuiltAsset();
+    Reader reader(buffer, header);
+
+    // create every node first, the records link them by index
+    const unsigned int nodeCount = header.mObjectCount + header.mArrayCount;
+    Object** objects = PG_NEW_ARRAY(allocator, -1, "BinaryAsset::objects", Alloc::PG_MEM_TEMP, Object*, header.mObjectCount);
+    Array** arrays = PG_NEW_ARRAY(allocator, -1, "BinaryAsset::arrays", Alloc::PG_MEM_TEMP, Array*, header.mArrayCount > 0 ? header.mArrayCount : 1);
+    unsigned char* objectRefs = PG_NEW_ARRAY(allocator, -1, "BinaryAsset::references", Alloc::PG_MEM_TEMP, unsigned char, nodeCount);
+    unsigned char* arrayRefs = objectRefs + header.mObjectCount;
+    Utils::Memset8(objectRefs, 0, nodeCount);
+
+    for (unsigned int i = 0; i < header.mObjectCount; ++i)
+    {
+        objects[i] = asset->NewObject();
+    }
+    for (unsigned int i = 0; i < header.mArrayCount; ++i)
+    {
+        arrays[i] = asset->NewArray();
+    }
+
+    bool success = true;
+    for (unsigned int i = 0; success && i < header.mObjectCount; ++i)
+    {
+        success = ReadObject(reader, reader.GetWord(header.mObjectTable + i * sizeof(unsigned int)), objects[i],
+                             objects, arrays, objectRefs, arrayRefs, header, builder);
+    }
+    for (unsigned int i = 0; success && i < header.mArrayCount; ++i)
+    {
+        success = ReadArray(reader, reader.GetWord(header.mArrayTable + i * sizeof(unsigned int)), arrays[i],
+                            objects, arrays, objectRefs, arrayRefs, header, builder);
+    }
+
+    if (success)
+    {
+        asset->SetRootObject(objects[0]);
+    }
+    else
+    {
+        PG_LOG('ERR_', "Corrupted binary asset %s.", asset->GetPath());
+    }
+
+    PG_DELETE_ARRAY(allocator, objects);
+    PG_DELETE_ARRAY(allocator, arrays);
+    PG_DELETE_ARRAY(allocator, objectRefs);
+    return success;
+}
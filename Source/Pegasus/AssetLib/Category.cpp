@@ -34,7 +34,8 @@ Category::~Category()
 
 void Category::RegisterAsset(Asset* asset)
 {
-    for (unsigned i = 0; i < mAssets.GetSize(); ++i) if (asset == mAssets[i]) return;
+    if (HasAsset(asset)) return;
+    mAssetIndex.Insert(asset, static_cast<int>(mAssets.GetSize()));
     mAssets.PushEmpty() = asset;
     asset->RegisterToCategory(this);
 }
@@ -44,15 +45,32 @@ void Category::UnregisterAsset(Asset* asset, bool calledFromAssetDestructor)
     if (!calledFromAssetDestructor)
         asset->UnregisterToCategory(this);
 
-    for (unsigned i = 0; i < mAssets.GetSize(); ++i)
+    int assetPosition = -1;
+    if (!mAssetIndex.Contains(asset, &assetPosition))
     {
-        if (asset == mAssets[i])
-        {
-            mAssets.Delete(i);
-            return;
-        }
+        PG_FAILSTR("Can't find asset to deregister.");
+        return;
     }
-    PG_FAILSTR("Can't find asset to deregister.");
+
+    //the last asset takes the free position, the order of a category is not relevant
+    const unsigned lastPosition = mAssets.GetSize() - 1;
+    if (static_cast<unsigned>(assetPosition) != lastPosition)
+    {
+        mAssets[assetPosition] = mAssets[lastPosition];
+        mAssetIndex.SetUserData(mAssets[assetPosition], assetPosition);
+    }
+    mAssets.Delete(lastPosition);
+    mAssetIndex.Remove(asset);
+}
+
+bool Category::HasAsset(const Asset* asset) const
+{
+    return mAssetIndex.Contains(asset);
+}
+
+Asset* Category::FindAsset(const char* path) const
+{
+    return mAssetIndex.Find(path);
 }
 
 void Category::RemoveAssets()
@@ -63,6 +81,7 @@ void Category::RemoveAssets()
     }
 
     mAssets.Clear();
+    mAssetIndex.Clear();
 }
 
 #else
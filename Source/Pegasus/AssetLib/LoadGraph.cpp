@@ -0,0 +1,265 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   LoadGraph.cpp
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Graph of assets read and parsed in parallel ahead of their runtime objects
+
+#include "Pegasus/AssetLib/LoadGraph.h"
+#include "Pegasus/AssetLib/AssetLib.h"
+#include "Pegasus/AssetLib/AssetBuilder.h"
+#include "Pegasus/AssetLib/Asset.h"
+#include "Pegasus/Allocator/IAllocator.h"
+#include "Pegasus/Allocator/Alloc.h"
+#include "Pegasus/Core/Assertion.h"
+#include "Pegasus/Core/Io.h"
+#include "Pegasus/Core/ParallelFor.h"
+#include "Pegasus/Core/Time.h"
+#include "Pegasus/Utils/Memset.h"
+
+using namespace Pegasus;
+using namespace Pegasus::AssetLib;
+
+//! Asset of the graph, with the timings of its load
+struct LoadGraph::Node
+{
+    explicit Node(Alloc::IAllocator* allocator)
+    :   mAsset(nullptr), mBuilder(allocator), mResult(Io::ERR_NONE), mIsStructured(false), mIsTaken(false),
+        mParent(-1), mReadTime(0.0), mParseTime(0.0)
+    {
+    }
+
+    Asset* mAsset;          //!< Asset, created on the calling thread and filled by a worker
+    AssetBuilder mBuilder;  //!< Builder of the asset, holding its child asset requests once parsed
+    Io::IoError mResult;    //!< Result of the read and parse
+    bool mIsStructured;     //!< Format of the asset, from its extension
+    bool mIsTaken;          //!< True once the asset library owns the asset
+    int mParent;            //!< Index of the node that referenced this asset first, -1 for a root
+    double mReadTime;       //!< Time spent reading the file
+    double mParseTime;      //!< Time spent parsing the file
+};
+
+//----------------------------------------------------------------------------------------
+
+LoadGraph::LoadGraph(Alloc::IAllocator* allocator, AssetLib* lib)
+:   mAllocator(allocator),
+    mLib(lib),
+    mNodes(allocator),
+    mNodeIndex(allocator),
+    mLevelBegin(0)
+{
+    Utils::Memset8(&mStats, 0, sizeof(mStats));
+}
+
+//----------------------------------------------------------------------------------------
+
+LoadGraph::~LoadGraph()
+{
+    Clear();
+}
+
+//----------------------------------------------------------------------------------------
+
+void LoadGraph::Load(const char* const* paths, int pathCount)
+{
+    const double startTime = Core::ReadPegasusTime();
+    const unsigned int firstNode = mNodes.GetSize();
+
+    for (int p = 0; p < pathCount; ++p)
+    {
+        AddNode(paths[p], -1);
+    }
+
+    //every level is loaded in parallel, then its child assets make the next level.
+    //Assets are created and the graph grows only here, on the calling thread
+    int depth = 0;
+    unsigned int levelBegin = firstNode;
+    while (levelBegin < mNodes.GetSize())
+    {
+        const unsigned int levelEnd = mNodes.GetSize();
+        mLevelBegin = static_cast<int>(levelBegin);
+        Core::ParallelFor(static_cast<int>(levelEnd - levelBegin), 1, LoadNodes, this);
+
+        for (unsigned int n = levelBegin; n < levelEnd; ++n)
+        {
+            AddChildNodes(static_cast<int>(n));
+        }
+        levelBegin = levelEnd;
+        ++depth;
+    }
+
+    Utils::Memset8(&mStats, 0, sizeof(mStats));
+    mStats.mDepth = depth;
+    ComputeStats(firstNode, Core::ReadPegasusTime() - startTime);
+}
+
+//----------------------------------------------------------------------------------------
+
+bool LoadGraph::TakeAsset(const char* path, bool isStructured, Asset** outAsset, const AssetBuilder** outBuilder)
+{
+    int nodeIndex = -1;
+    if (mNodeIndex.Find(path, &nodeIndex) == nullptr)
+    {
+        return false;
+    }
+
+    //failures and format mismatches go through the regular load, which reports them
+    Node* node = mNodes[nodeIndex];
+    if (node->mResult != Io::ERR_NONE || node->mIsStructured != isStructured)
+    {
+        return false;
+    }
+
+    //taken assets leave the index, the asset library owns them now and can unload them
+    mNodeIndex.Remove(node->mAsset);
+    node->mIsTaken = true;
+    *outAsset = node->mAsset;
+    *outBuilder = &node->mBuilder;
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+
+void LoadGraph::Clear()
+{
+    for (unsigned int n = 0; n < mNodes.GetSize(); ++n)
+    {
+        Node* node = mNodes[n];
+        if (!node->mIsTaken)
+        {
+            PG_DELETE(mAllocator, node->mAsset);
+        }
+        PG_DELETE(mAllocator, node);
+    }
+    mNodes.Clear();
+    mNodeIndex.Clear();
+}
+
+//----------------------------------------------------------------------------------------
+
+void LoadGraph::AddNode(const char* path, int parent)
+{
+    const char* extension = nullptr;
+    bool isStructured = true;
+    if (!AssetLib::GetPathFormat(path, &extension, &isStructured))
+    {
+        //LoadObject reports the missing extension
+        return;
+    }
+
+    //taken assets are in the asset library already, or unloaded since then
+    if (mLib->mAssetIndex.Find(path) != nullptr || mNodeIndex.Find(path) != nullptr)
+    {
+        return;
+    }
+
+    Node* node = PG_NEW(mAllocator, -1, "LoadGraph Node", Alloc::PG_MEM_TEMP) Node(mAllocator);
+    node->mAsset = PG_NEW(mAllocator, -1, "Asset", Alloc::PG_MEM_TEMP) Asset(mAllocator, mLib, isStructured ? Asset::FMT_STRUCTURED : Asset::FMT_RAW);
+    node->mAsset->SetPath(path);
+    node->mIsStructured = isStructured;
+    node->mParent = parent;
+    mNodeIndex.Insert(node->mAsset, static_cast<int>(mNodes.GetSize()));
+    mNodes.PushEmpty() = node;
+}
+
+//----------------------------------------------------------------------------------------
+
+void LoadGraph::AddChildNodes(int nodeIndex)
+{
+    //copy the node pointer, adding nodes can move the vector
+    const Node* node = mNodes[nodeIndex];
+    if (node->mResult != Io::ERR_NONE || !node->mIsStructured)
+    {
+        return;
+    }
+
+    const AssetBuilder& builder = node->mBuilder;
+    for (unsigned int i = 0; i < builder.mObjectChildAssetQueue.GetSize(); ++i)
+    {
+        AddNode(builder.mObjectChildAssetQueue[i].assetPath, nodeIndex);
+    }
+    for (unsigned int i = 0; i < builder.mArrayChildAssetQueue.GetSize(); ++i)
+    {
+        AddNode(builder.mArrayChildAssetQueue[i].assetPath, nodeIndex);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void LoadGraph::LoadNodes(int begin, int end, void* userData)
+{
+    LoadGraph* graph = static_cast<LoadGraph*>(userData);
+    for (int n = begin; n < end; ++n)
+    {
+        graph->LoadNode(graph->mNodes[graph->mLevelBegin + n]);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void LoadGraph::LoadNode(Node* node)
+{
+    Asset* asset = node->mAsset;
+    const double readStart = Core::ReadPegasusTime();
+
+    Io::FileBuffer fileBuffer;
+#if PEGASUS_USE_MAPPED_ASSETS
+    node->mResult = mLib->mIoMgr->MapFileToBuffer(asset->GetPath(), fileBuffer, mAllocator);
+#else
+    node->mResult = mLib->mIoMgr->OpenFileToBuffer(asset->GetPath(), fileBuffer, true, mAllocator);
+#endif
+
+    const double parseStart = Core::ReadPegasusTime();
+    if (node->mResult == Io::ERR_NONE)
+    {
+        if (node->mIsStructured)
+        {
+            mLib->BuildStructuredAsset(asset, fileBuffer, &node->mBuilder);
+            if (node->mBuilder.GetErrorCount() != 0)
+            {
+                node->mResult = Io::ERR_READING_FILE;
+            }
+        }
+        else
+        {
+            asset->SetFileBuffer(fileBuffer);
+            fileBuffer.ForgetBuffer(); //forget this buffer, so we dont destroy it twice.
+        }
+    }
+    const double parseEnd = Core::ReadPegasusTime();
+
+    node->mReadTime = parseStart - readStart;
+    node->mParseTime = parseEnd - parseStart;
+}
+
+//----------------------------------------------------------------------------------------
+
+void LoadGraph::ComputeStats(unsigned int firstNode, double wallTime)
+{
+    mStats.mWallTime = wallTime;
+    mStats.mAssetCount = static_cast<int>(mNodes.GetSize() - firstNode);
+
+    //parents are always added before their children, so the chain of a parent is known before its children
+    Utils::Vector<double> chainTimes(mAllocator);
+    for (unsigned int n = 0; n < mNodes.GetSize(); ++n)
+    {
+        const Node* node = mNodes[n];
+        const double nodeTime = node->mReadTime + node->mParseTime;
+        const double chainTime = nodeTime + (node->mParent >= 0 ? chainTimes[node->mParent] : 0.0);
+        chainTimes.PushEmpty() = chainTime;
+        if (n < firstNode)
+        {
+            //loaded by a previous call
+            continue;
+        }
+
+        mStats.mReadTime += node->mReadTime;
+        mStats.mParseTime += node->mParseTime;
+        mStats.mCriticalPath = chainTime > mStats.mCriticalPath ? chainTime : mStats.mCriticalPath;
+        mStats.mFailedCount += node->mResult != Io::ERR_NONE ? 1 : 0;
+    }
+}
@@ -0,0 +1,573 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Benchmarks                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   AssetLibBenchmarks.cpp
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Pegasus benchmarks for the AssetLib package, implementation.
+//!         The reference load is the text grammar parsed by the flex / bison asset script parser,
+//!         the serial load of an asset graph for the parallel preload,
+//!         and a scan of every asset path for the path index.
+
+#include "Pegasus/Benchmarks/Benchmarks.h"
+#include "Pegasus/Benchmarks/AssetLibBenchmarks.h"
+#include "Pegasus/AssetLib/AssetLib.h"
+#include "Pegasus/AssetLib/Asset.h"
+#include "Pegasus/AssetLib/ASTree.h"
+#include "Pegasus/Core/Io.h"
+#include "Pegasus/Core/ParallelFor.h"
+#include "Pegasus/Memory/MemoryManager.h"
+#include "Pegasus/Utils/ByteStream.h"
+#include "Pegasus/Utils/Memcpy.h"
+#include "Pegasus/Utils/String.h"
+#include <stdio.h>
+
+using namespace Pegasus;
+using namespace Pegasus::AssetLib;
+
+namespace
+{
+
+//! Lanes of the benchmarked timeline like asset
+const int BENCHMARK_ASSET_LANE_COUNT = 64;
+
+//! Blocks per lane of the benchmarked asset
+const int BENCHMARK_ASSET_BLOCKS_PER_LANE = 64;
+
+//! Keys of the curve float array of each block
+const int BENCHMARK_ASSET_CURVE_SIZE = 32;
+
+//! Files written next to the executable
+const char* BENCHMARK_TEXT_ASSET_PATH = "AssetLibBenchmark.pas";
+const char* BENCHMARK_BINARY_ASSET_PATH = "AssetLibBenchmark.bin.pas";
+
+//! Asset graph of the parallel load: a root referencing the groups, each group referencing its leaves
+const char* BENCHMARK_GRAPH_ROOT_PATH = "AssetLibGraph.pas";
+const int BENCHMARK_GRAPH_GROUP_COUNT = 32;
+const int BENCHMARK_GRAPH_LEAVES_PER_GROUP = 4;
+
+//! Size of the tree of every group and leaf of the graph
+const int BENCHMARK_GRAPH_LANE_COUNT = 8;
+const int BENCHMARK_GRAPH_BLOCKS_PER_LANE = 16;
+
+//! Assets of the path lookup, and lookups of the measured run
+const int BENCHMARK_LOOKUP_ASSET_COUNT = 4096;
+const int BENCHMARK_LOOKUP_COUNT = 16384;
+
+//! Builds a timeline like tree, where every block repeats the same keys.
+//! The floats are multiples of 1/64, so the text encoding writes them exactly.
+void BuildBenchmarkAsset(Asset* asset, int laneCount, int blocksPerLane)
+{
+    Object* root = asset->NewObject();
+    root->AddString("name", "benchmark_timeline");
+    root->AddInt("ticks_per_beat", 128);
+    root->AddFloat("bpm", 138.0f);
+
+    Array* lanes = asset->NewArray();
+    lanes->CommitType(Array::AS_TYPE_OBJECT);
+    root->AddArray("lanes", lanes);
+
+    unsigned int seed = 1234567u;
+    for (int l = 0; l < laneCount; ++l)
+    {
+        char name[64];
+        sprintf_s(name, sizeof(name), "lane_%d", l);
+
+        Object* lane = asset->NewObject();
+        lane->AddString("name", asset->CopyString(name));
+        lane->AddInt("height", 64 + l);
+
+        Array* blocks = asset->NewArray();
+        blocks->CommitType(Array::AS_TYPE_OBJECT);
+        lane->AddArray("blocks", blocks);
+
+        for (int b = 0; b < blocksPerLane; ++b)
+        {
+            seed = seed * 1664525u + 1013904223u;
+
+            Object* block = asset->NewObject();
+            block->AddString("class", (seed & 1) != 0 ? "CubeBlock" : "PsyBeadsBlock");
+            block->AddInt("beat", b * 512);
+            block->AddInt("duration", 128 + static_cast<int>((seed >> 8) & 255));
+            block->AddInt("color", static_cast<int>((seed >> 4) & 0xffffff));
+            block->AddFloat("intensity", static_cast<float>((seed >> 12) & 255) / 64.0f);
+
+            Object* properties = asset->NewObject();
+            properties->AddFloat("speed", static_cast<float>((seed >> 16) & 127) / 64.0f);
+            properties->AddFloat("scale", -static_cast<float>((seed >> 20) & 127) / 64.0f);
+            properties->AddString("script", "Scripts/block.bs");
+            block->AddObject("properties", properties);
+
+            Array* curve = asset->NewArray();
+            curve->CommitType(Array::AS_TYPE_FLOAT);
+            for (int k = 0; k < BENCHMARK_ASSET_CURVE_SIZE; ++k)
+            {
+                Array::Element el;
+                el.f = static_cast<float>((k * 37 + b) & 1023) / 64.0f;
+                curve->PushElement(el);
+            }
+            block->AddArray("curve", curve);
+
+            Array::Element el;
+            el.o = block;
+            blocks->PushElement(el);
+        }
+
+        Array::Element el;
+        el.o = lane;
+        lanes->PushElement(el);
+    }
+
+    asset->SetRootObject(root);
+}
+
+bool CompareArrays(const Array* a, const Array* b);
+
+//! \return true if both objects have the same members, in the same order, with the same bits
+bool CompareObjects(const Object* a, const Object* b)
+{
+    if (a->GetIntCount() != b->GetIntCount() || a->GetFloatCount() != b->GetFloatCount() ||
+        a->GetStringCount() != b->GetStringCount() || a->GetObjectCount() != b->GetObjectCount() ||
+        a->GetAssetsCount() != b->GetAssetsCount() || a->GetArrayCount() != b->GetArrayCount())
+    {
+        return false;
+    }
+
+    bool match = true;
+    for (int i = 0; match && i < a->GetIntCount(); ++i)
+    {
+        match = !Utils::Strcmp(a->GetIntName(i), b->GetIntName(i)) && a->GetInt(i) == b->GetInt(i);
+    }
+    for (int i = 0; match && i < a->GetFloatCount(); ++i)
+    {
+        match = !Utils::Strcmp(a->GetFloatName(i), b->GetFloatName(i)) && a->GetFloat(i) == b->GetFloat(i);
+    }
+    for (int i = 0; match && i < a->GetStringCount(); ++i)
+    {
+        match = !Utils::Strcmp(a->GetStringName(i), b->GetStringName(i)) && !Utils::Strcmp(a->GetString(i), b->GetString(i));
+    }
+    for (int i = 0; match && i < a->GetObjectCount(); ++i)
+    {
+        match = !Utils::Strcmp(a->GetObjectName(i), b->GetObjectName(i)) && CompareObjects(a->GetObject(i), b->GetObject(i));
+    }
+    for (int i = 0; match && i < a->GetAssetsCount(); ++i)
+    {
+        match = !Utils::Strcmp(a->GetAssetName(i), b->GetAssetName(i)) && a->GetAsset(i) == b->GetAsset(i);
+    }
+    for (int i = 0; match && i < a->GetArrayCount(); ++i)
+    {
+        match = !Utils::Strcmp(a->GetArrayName(i), b->GetArrayName(i)) && CompareArrays(a->GetArray(i), b->GetArray(i));
+    }
+    return match;
+}
+
+//! \return true if both arrays have the same type and elements
+bool CompareArrays(const Array* a, const Array* b)
+{
+    if (a->GetType() != b->GetType() || a->GetSize() != b->GetSize())
+    {
+        return false;
+    }
+
+    bool match = true;
+    for (int i = 0; match && i < a->GetSize(); ++i)
+    {
+        const Array::Element& elA = a->GetElement(i);
+        const Array::Element& elB = b->GetElement(i);
+        switch (a->GetType())
+        {
+        case Array::AS_TYPE_INT:            match = elA.i == elB.i; break;
+        case Array::AS_TYPE_FLOAT:          match = elA.f == elB.f; break;
+        case Array::AS_TYPE_STRING:         match = !Utils::Strcmp(elA.s, elB.s); break;
+        case Array::AS_TYPE_OBJECT:         match = CompareObjects(elA.o, elB.o); break;
+        case Array::AS_TYPE_ARRAY:          match = CompareArrays(elA.a, elB.a); break;
+        case Array::AS_TYPE_ASSET_PATH_REF: match = elA.asset == elB.asset; break;
+        default: break;
+        }
+    }
+    return match;
+}
+
+//! \return true if both streams hold the same bytes
+bool CompareStreams(const Utils::ByteStream& a, const Utils::ByteStream& b)
+{
+    if (a.GetSize() != b.GetSize())
+    {
+        return false;
+    }
+    const char* bytesA = static_cast<const char*>(a.GetBuffer());
+    const char* bytesB = static_cast<const char*>(b.GetBuffer());
+    for (int i = 0; i < a.GetSize(); ++i)
+    {
+        if (bytesA[i] != bytesB[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//! Saves a stream to a file
+Io::IoError SaveStream(Io::IOManager* ioManager, const char* path, Utils::ByteStream& stream)
+{
+    Io::FileBuffer fileBuffer;
+    fileBuffer.OwnBuffer(nullptr, static_cast<char*>(stream.GetBuffer()), stream.GetSize());
+    const Io::IoError result = ioManager->SaveFileToBuffer(path, fileBuffer);
+    fileBuffer.ForgetBuffer();
+    return result;
+}
+
+//! Writes a text asset made of child asset references and of the tree of BuildBenchmarkAsset()
+//! \param childPaths paths of the child assets, null terminated
+Io::IoError WriteGraphAsset(Pegasus::AssetLib::AssetLib* lib, Io::IOManager* ioManager, const char* path, const char* const* childPaths)
+{
+    Alloc::IAllocator* allocator = Memory::GetGlobalAllocator();
+    Asset* payload = lib->CreateAsset(path, true);
+    BuildBenchmarkAsset(payload, BENCHMARK_GRAPH_LANE_COUNT, BENCHMARK_GRAPH_BLOCKS_PER_LANE);
+
+    Utils::ByteStream stream(allocator);
+    const char* header = "{\n    \"children\" : [";
+    stream.Append(header, Utils::Strlen(header));
+    for (int c = 0; childPaths[c] != nullptr; ++c)
+    {
+        char reference[128];
+        sprintf_s(reference, sizeof(reference), "%s{@%s}", c == 0 ? " " : ", ", childPaths[c]);
+        stream.Append(reference, Utils::Strlen(reference));
+    }
+    const char* payloadKey = " ],\n    \"payload\" : ";
+    stream.Append(payloadKey, Utils::Strlen(payloadKey));
+    payload->DumpToStream(stream, Asset::ENCODING_TEXT);
+    stream.Append("\n}\n", 3);
+    lib->UnloadAsset(payload);
+
+    return SaveStream(ioManager, path, stream);
+}
+
+//! Preloads the asset graph and releases it, as LoadObject does when creating the root object
+struct GraphPreloadRun
+{
+    Pegasus::AssetLib::AssetLib* mLib; LoadGraphStats mStats;
+    void operator()()
+    {
+        mLib->PreloadAssets(&BENCHMARK_GRAPH_ROOT_PATH, 1);
+        mStats = mLib->GetPreloadStats();
+        mLib->ReleasePreloadedAssets();
+    }
+};
+
+//! Loads and unloads an asset, as the asset library does for every structured asset
+struct AssetLoadRun
+{
+    Pegasus::AssetLib::AssetLib* mLib; const char* mPath; bool mSuccess;
+    void operator()()
+    {
+        Asset* asset = nullptr;
+        mSuccess = mLib->LoadAsset(mPath, true, &asset) == Io::ERR_NONE;
+        if (asset != nullptr)
+        {
+            mLib->UnloadAsset(asset);
+        }
+    }
+};
+
+//! Finds assets by scanning every path, as the asset library did before its path index
+struct LinearLookupRun
+{
+    Asset* const* mAssets; const char* const* mLookupPaths; int mFoundCount;
+    void operator()()
+    {
+        mFoundCount = 0;
+        for (int l = 0; l < BENCHMARK_LOOKUP_COUNT; ++l)
+        {
+            for (int a = 0; a < BENCHMARK_LOOKUP_ASSET_COUNT; ++a)
+            {
+                if (AssetPathIndex::PathsAreEqual(mAssets[a]->GetPath(), mLookupPaths[l]))
+                {
+                    ++mFoundCount;
+                    break;
+                }
+            }
+        }
+    }
+};
+
+//! Finds assets through LoadAsset, which hits the path index for assets loaded already
+struct IndexedLookupRun
+{
+    Pegasus::AssetLib::AssetLib* mLib; const char* const* mLookupPaths; int mFoundCount;
+    void operator()()
+    {
+        mFoundCount = 0;
+        for (int l = 0; l < BENCHMARK_LOOKUP_COUNT; ++l)
+        {
+            Asset* asset = nullptr;
+            if (mLib->LoadAsset(mLookupPaths[l], true, &asset) == Io::ERR_NONE)
+            {
+                ++mFoundCount;
+            }
+        }
+    }
+};
+
+}
+
+//----------------------------------------------------------------------------------------
+
+void BENCHMARK_AssetLibBinaryLoad()
+{
+    Alloc::IAllocator* allocator = Memory::GetGlobalAllocator();
+    Io::IOManager ioManager("");
+    Pegasus::AssetLib::AssetLib lib(allocator, &ioManager);
+
+    // text file of the generated tree
+    Asset* source = lib.CreateAsset(BENCHMARK_TEXT_ASSET_PATH, true);
+    BuildBenchmarkAsset(source, BENCHMARK_ASSET_LANE_COUNT, BENCHMARK_ASSET_BLOCKS_PER_LANE);
+    const Io::IoError textError = lib.SaveAsset(source);
+    lib.UnloadAsset(source);
+    if (textError != Io::ERR_NONE)
+    {
+        printf("  ERROR: could not write %s!\n", BENCHMARK_TEXT_ASSET_PATH);
+        return;
+    }
+
+    // round trip: text file -> tree -> binary file -> tree, both trees and their encodings have to match
+    Asset* textAsset = nullptr;
+    Asset* binaryAsset = nullptr;
+    Utils::ByteStream textStream(allocator);
+    Utils::ByteStream binaryStream(allocator);
+    if (lib.LoadAsset(BENCHMARK_TEXT_ASSET_PATH, true, &textAsset) != Io::ERR_NONE)
+    {
+        printf("  ERROR: could not parse %s!\n", BENCHMARK_TEXT_ASSET_PATH);
+        return;
+    }
+    textAsset->DumpToStream(textStream, Asset::ENCODING_TEXT);
+    textAsset->DumpToStream(binaryStream, Asset::ENCODING_BINARY);
+    if (SaveStream(&ioManager, BENCHMARK_BINARY_ASSET_PATH, binaryStream) != Io::ERR_NONE ||
+        lib.LoadAsset(BENCHMARK_BINARY_ASSET_PATH, true, &binaryAsset) != Io::ERR_NONE)
+    {
+        printf("  ERROR: could not write or load %s!\n", BENCHMARK_BINARY_ASSET_PATH);
+        lib.UnloadAsset(textAsset);
+        return;
+    }
+
+    Utils::ByteStream textRoundTrip(allocator);
+    Utils::ByteStream binaryRoundTrip(allocator);
+    binaryAsset->DumpToStream(textRoundTrip, Asset::ENCODING_TEXT);
+    binaryAsset->DumpToStream(binaryRoundTrip);
+    if (binaryAsset->GetEncoding() != Asset::ENCODING_BINARY || !CompareObjects(textAsset->Root(), binaryAsset->Root()))
+    {
+        printf("  ERROR: the binary asset does not match the text asset!\n");
+    }
+    if (!CompareStreams(textStream, textRoundTrip) || !CompareStreams(binaryStream, binaryRoundTrip))
+    {
+        printf("  ERROR: the round trip changed the encoded asset!\n");
+    }
+    lib.UnloadAsset(binaryAsset);
+    lib.UnloadAsset(textAsset);
+
+    // load times, the file read is part of both
+    AssetLoadRun textRun = { &lib, BENCHMARK_TEXT_ASSET_PATH, false };
+    AssetLoadRun binaryRun = { &lib, BENCHMARK_BINARY_ASSET_PATH, false };
+    const double textTime = BenchmarkMeasure(textRun);
+    const double binaryTime = BenchmarkMeasure(binaryRun);
+
+    const int blockCount = BENCHMARK_ASSET_LANE_COUNT * BENCHMARK_ASSET_BLOCKS_PER_LANE;
+    printf("  %d blocks, text %d bytes, binary %d bytes\n", blockCount, textStream.GetSize(), binaryStream.GetSize());
+    BenchmarkReport("Text load (flex / bison)", textTime, blockCount);
+    BenchmarkReport("Binary load", binaryTime, blockCount);
+    BenchmarkReportSpeedup("Speedup", textTime, binaryTime);
+
+    if (!textRun.mSuccess || !binaryRun.mSuccess)
+    {
+        printf("  ERROR: an asset failed to load!\n");
+    }
+
+    remove(BENCHMARK_TEXT_ASSET_PATH);
+    remove(BENCHMARK_BINARY_ASSET_PATH);
+}
+
+//----------------------------------------------------------------------------------------
+
+void BENCHMARK_AssetLibParallelLoad()
+{
+    Io::IOManager ioManager("");
+    Pegasus::AssetLib::AssetLib lib(Memory::GetGlobalAllocator(), &ioManager);
+
+    // root -> groups -> leaves, every file holding a small timeline like tree
+    char groupPaths[BENCHMARK_GRAPH_GROUP_COUNT][64];
+    char leafPaths[BENCHMARK_GRAPH_GROUP_COUNT * BENCHMARK_GRAPH_LEAVES_PER_GROUP][64];
+    const char* rootChildren[BENCHMARK_GRAPH_GROUP_COUNT + 1];
+    bool writeSuccess = true;
+    for (int g = 0; g < BENCHMARK_GRAPH_GROUP_COUNT; ++g)
+    {
+        const char* groupChildren[BENCHMARK_GRAPH_LEAVES_PER_GROUP + 1];
+        for (int l = 0; l < BENCHMARK_GRAPH_LEAVES_PER_GROUP; ++l)
+        {
+            char* leafPath = leafPaths[g * BENCHMARK_GRAPH_LEAVES_PER_GROUP + l];
+            sprintf_s(leafPath, 64, "AssetLibGraph_leaf_%d.pas", g * BENCHMARK_GRAPH_LEAVES_PER_GROUP + l);
+            const char* noChildren = nullptr;
+            writeSuccess = writeSuccess && WriteGraphAsset(&lib, &ioManager, leafPath, &noChildren) == Io::ERR_NONE;
+            groupChildren[l] = leafPath;
+        }
+        groupChildren[BENCHMARK_GRAPH_LEAVES_PER_GROUP] = nullptr;
+
+        sprintf_s(groupPaths[g], 64, "AssetLibGraph_group_%d.pas", g);
+        writeSuccess = writeSuccess && WriteGraphAsset(&lib, &ioManager, groupPaths[g], groupChildren) == Io::ERR_NONE;
+        rootChildren[g] = groupPaths[g];
+    }
+    rootChildren[BENCHMARK_GRAPH_GROUP_COUNT] = nullptr;
+    writeSuccess = writeSuccess && WriteGraphAsset(&lib, &ioManager, BENCHMARK_GRAPH_ROOT_PATH, rootChildren) == Io::ERR_NONE;
+
+    const int assetCount = 1 + BENCHMARK_GRAPH_GROUP_COUNT * (1 + BENCHMARK_GRAPH_LEAVES_PER_GROUP);
+    if (!writeSuccess)
+    {
+        printf("  ERROR: could not write the asset graph!\n");
+    }
+    else
+    {
+        // a preloaded leaf has to match the same leaf loaded the regular way
+        Alloc::IAllocator* allocator = Memory::GetGlobalAllocator();
+        Utils::ByteStream preloadedStream(allocator);
+        Utils::ByteStream serialStream(allocator);
+        Asset* leaf = nullptr;
+        lib.PreloadAssets(&BENCHMARK_GRAPH_ROOT_PATH, 1);
+        if (lib.LoadAsset(leafPaths[0], true, &leaf) == Io::ERR_NONE)
+        {
+            leaf->DumpToStream(preloadedStream);
+            lib.UnloadAsset(leaf);
+        }
+        lib.ReleasePreloadedAssets();
+        if (lib.LoadAsset(leafPaths[0], true, &leaf) == Io::ERR_NONE)
+        {
+            leaf->DumpToStream(serialStream);
+            lib.UnloadAsset(leaf);
+        }
+        if (preloadedStream.GetSize() == 0 || !CompareStreams(preloadedStream, serialStream))
+        {
+            printf("  ERROR: the preloaded asset does not match the serially loaded asset!\n");
+        }
+
+        GraphPreloadRun serialRun = { &lib };
+        GraphPreloadRun parallelRun = { &lib };
+        Core::SetParallelForThreadLimit(1);
+        const double serialTime = BenchmarkMeasure(serialRun);
+        Core::SetParallelForThreadLimit(0);
+        const double parallelTime = BenchmarkMeasure(parallelRun);
+
+        const LoadGraphStats& stats = parallelRun.mStats;
+        printf("  %d assets, depth %d, %d threads\n", stats.mAssetCount, stats.mDepth, Core::GetParallelForThreadCount());
+        BenchmarkReport("Serial load (1 thread)", serialTime, assetCount);
+        BenchmarkReport("Parallel load", parallelTime, assetCount);
+        BenchmarkReport("  read time, sum over assets", stats.mReadTime, assetCount);
+        BenchmarkReport("  parse time, sum over assets", stats.mParseTime, assetCount);
+        BenchmarkReport("  critical path", stats.mCriticalPath, assetCount);
+        BenchmarkReportSpeedup("Speedup", serialTime, parallelTime);
+        BenchmarkReportSpeedup("Speedup bound (serial / critical path)", stats.GetSerialTime(), stats.mCriticalPath);
+
+        if (stats.mAssetCount != assetCount || stats.mFailedCount != 0 || serialRun.mStats.mAssetCount != assetCount)
+        {
+            printf("  ERROR: %d assets loaded, %d failed, %d expected!\n", stats.mAssetCount, stats.mFailedCount, assetCount);
+        }
+    }
+
+    remove(BENCHMARK_GRAPH_ROOT_PATH);
+    for (int g = 0; g < BENCHMARK_GRAPH_GROUP_COUNT; ++g)
+    {
+        remove(groupPaths[g]);
+    }
+    for (int l = 0; l < BENCHMARK_GRAPH_GROUP_COUNT * BENCHMARK_GRAPH_LEAVES_PER_GROUP; ++l)
+    {
+        remove(leafPaths[l]);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void BENCHMARK_AssetLibPathLookup()
+{
+    Alloc::IAllocator* allocator = Memory::GetGlobalAllocator();
+    Io::IOManager ioManager("");
+    Pegasus::AssetLib::AssetLib lib(allocator, &ioManager);
+
+    // assets shared by many blocks, looked up with another case and other slashes than they were created with
+    Asset** assets = PG_NEW_ARRAY(allocator, -1, "Lookup assets", Alloc::PG_MEM_TEMP, Asset*, BENCHMARK_LOOKUP_ASSET_COUNT);
+    Asset** lookupAssets = PG_NEW_ARRAY(allocator, -1, "Lookup expected assets", Alloc::PG_MEM_TEMP, Asset*, BENCHMARK_LOOKUP_COUNT);
+    char* lookupPathStrings = PG_NEW_ARRAY(allocator, -1, "Lookup path strings", Alloc::PG_MEM_TEMP, char, BENCHMARK_LOOKUP_COUNT * 64);
+    const char** lookupPaths = PG_NEW_ARRAY(allocator, -1, "Lookup paths", Alloc::PG_MEM_TEMP, const char*, BENCHMARK_LOOKUP_COUNT);
+    bool createSuccess = true;
+    for (int a = 0; a < BENCHMARK_LOOKUP_ASSET_COUNT; ++a)
+    {
+        char path[64];
+        sprintf_s(path, sizeof(path), "Textures/Lane_%d/Block_%d.pas", a / 64, a % 64);
+        assets[a] = lib.CreateAsset(path, true);
+        createSuccess = createSuccess && assets[a] != nullptr;
+    }
+    unsigned int seed = 7654321u;
+    for (int l = 0; l < BENCHMARK_LOOKUP_COUNT; ++l)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        const int a = static_cast<int>((seed >> 8) % BENCHMARK_LOOKUP_ASSET_COUNT);
+        char* lookupPath = lookupPathStrings + l * 64;
+        sprintf_s(lookupPath, 64, "textures\\lane_%d\\block_%d.pas", a / 64, a % 64);
+        lookupPaths[l] = lookupPath;
+        lookupAssets[l] = assets[a];
+    }
+
+    // every lookup has to find the asset created with its path
+    bool lookupSuccess = createSuccess;
+    for (int l = 0; lookupSuccess && l < BENCHMARK_LOOKUP_COUNT; ++l)
+    {
+        Asset* asset = nullptr;
+        lookupSuccess = lib.LoadAsset(lookupPaths[l], true, &asset) == Io::ERR_NONE && asset == lookupAssets[l];
+    }
+    if (!lookupSuccess)
+    {
+        printf("  ERROR: a path lookup did not find its asset!\n");
+    }
+    else
+    {
+        LinearLookupRun linearRun = { assets, lookupPaths, 0 };
+        IndexedLookupRun indexedRun = { &lib, lookupPaths, 0 };
+        const double linearTime = BenchmarkMeasure(linearRun);
+        const double indexedTime = BenchmarkMeasure(indexedRun);
+
+        printf("  %d assets, %d lookups\n", BENCHMARK_LOOKUP_ASSET_COUNT, BENCHMARK_LOOKUP_COUNT);
+        BenchmarkReport("Linear path scan", linearTime, BENCHMARK_LOOKUP_COUNT);
+        BenchmarkReport("Path index (LoadAsset)", indexedTime, BENCHMARK_LOOKUP_COUNT);
+        BenchmarkReportSpeedup("Speedup", linearTime, indexedTime);
+
+        if (linearRun.mFoundCount != BENCHMARK_LOOKUP_COUNT || indexedRun.mFoundCount != BENCHMARK_LOOKUP_COUNT)
+        {
+            printf("  ERROR: %d and %d lookups found, %d expected!\n", linearRun.mFoundCount, indexedRun.mFoundCount, BENCHMARK_LOOKUP_COUNT);
+        }
+    }
+
+    // unloaded assets leave the index, their paths can be created again
+    for (int a = 0; createSuccess && a < BENCHMARK_LOOKUP_ASSET_COUNT; a += 2)
+    {
+        char path[64];
+        Utils::Memcpy(path, assets[a]->GetPath(), Utils::Strlen(assets[a]->GetPath()) + 1);
+        lib.UnloadAsset(assets[a]);
+        assets[a] = lib.CreateAsset(path, true);
+        if (assets[a] == nullptr)
+        {
+            printf("  ERROR: could not create %s again after unloading it!\n", path);
+            createSuccess = false;
+        }
+    }
+
+    for (int a = 0; a < BENCHMARK_LOOKUP_ASSET_COUNT; ++a)
+    {
+        if (assets[a] != nullptr)
+        {
+            lib.UnloadAsset(assets[a]);
+        }
+    }
+    PG_DELETE_ARRAY(allocator, lookupPaths);
+    PG_DELETE_ARRAY(allocator, lookupPathStrings);
+    PG_DELETE_ARRAY(allocator, lookupAssets);
+    PG_DELETE_ARRAY(allocator, assets);
+}
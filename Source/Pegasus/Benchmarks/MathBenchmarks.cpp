@@ -0,0 +1,1643 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Benchmarks                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MathBenchmarks.cpp
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Pegasus benchmarks for the Math package, implementation.
+//!         The reference functions are copies of the generic scalar code of Matrix.cpp and
+//!         Quaternion.cpp, the one the engine uses when the SIMD versions are not compiled.
+
+#include "Pegasus/Benchmarks/Benchmarks.h"
+#include "Pegasus/Benchmarks/MathBenchmarks.h"
+#include "Pegasus/Math/Matrix.h"
+#include "Pegasus/Math/Quaternion.h"
+#include "Pegasus/Math/BatchTransform.h"
+#include "Pegasus/Math/BatchCulling.h"
+#include "Pegasus/Math/BoundingVolumeHierarchy.h"
+#include "Pegasus/Math/FastMath.h"
+#include "Pegasus/Memory/MemoryManager.h"
+#include <stdio.h>
+#include <math.h>
+#include <float.h>
+#include <string.h>
+
+using namespace Pegasus;
+
+namespace
+{
+
+//! Number of operations of one benchmark run
+const int BENCHMARK_MATH_COUNT = 256 * 1024;
+
+//! Largest error accepted by the accuracy checks, relative to the magnitude of the reference result.
+//! The SIMD versions sum in a different order and fuse the multiply-adds when the target has FMA.
+const float BENCHMARK_MATH_TOLERANCE = 1e-5f;
+
+//! Random matrices, vectors and quaternions, and the buffers of the results
+struct MathBenchmarkData
+{
+    Math::Mat44* mMatrices;
+    Math::Mat44* mMatrixResults;
+    Math::Vec4* mVectors;
+    Math::Vec4* mVectorResults;
+    Math::Quaternion* mQuaternions;
+    Math::Quaternion* mQuaternionResults;
+    Math::Vec3* mPoints;
+    Math::Vec3* mPointResults;
+
+    MathBenchmarkData()
+    {
+        Alloc::IAllocator* allocator = Memory::GetGlobalAllocator();
+        mMatrices = PG_NEW_ARRAY(allocator, -1, "Benchmark matrices", Alloc::PG_MEM_TEMP, Math::Mat44, BENCHMARK_MATH_COUNT);
+        mMatrixResults = PG_NEW_ARRAY(allocator, -1, "Benchmark matrix results", Alloc::PG_MEM_TEMP, Math::Mat44, BENCHMARK_MATH_COUNT);
+        mVectors = PG_NEW_ARRAY(allocator, -1, "Benchmark vectors", Alloc::PG_MEM_TEMP, Math::Vec4, BENCHMARK_MATH_COUNT);
+        mVectorResults = PG_NEW_ARRAY(allocator, -1, "Benchmark vector results", Alloc::PG_MEM_TEMP, Math::Vec4, BENCHMARK_MATH_COUNT);
+        mQuaternions = PG_NEW_ARRAY(allocator, -1, "Benchmark quaternions", Alloc::PG_MEM_TEMP, Math::Quaternion, BENCHMARK_MATH_COUNT);
+        mQuaternionResults = PG_NEW_ARRAY(allocator, -1, "Benchmark quaternion results", Alloc::PG_MEM_TEMP, Math::Quaternion, BENCHMARK_MATH_COUNT);
+        mPoints = PG_NEW_ARRAY(allocator, -1, "Benchmark points", Alloc::PG_MEM_TEMP, Math::Vec3, BENCHMARK_MATH_COUNT);
+        mPointResults = PG_NEW_ARRAY(allocator, -1, "Benchmark point results", Alloc::PG_MEM_TEMP, Math::Vec3, BENCHMARK_MATH_COUNT);
+
+        //deterministic pseudo random values in [-1, 1], unit quaternions
+        unsigned int seed = 1234567u;
+        for (int i = 0; i < BENCHMARK_MATH_COUNT; ++i)
+        {
+            for (int c = 0; c < 16; ++c)
+            {
+                mMatrices[i].m[c] = NextValue(seed);
+            }
+            for (int c = 0; c < 4; ++c)
+            {
+                mVectors[i].v[c] = NextValue(seed);
+                mQuaternions[i].q[c] = NextValue(seed);
+            }
+            Math::Normalize(mQuaternions[i]);
+            mPoints[i] = Math::Vec3(NextValue(seed), NextValue(seed), NextValue(seed)) * 10.0f;
+        }
+    }
+
+    ~MathBenchmarkData()
+    {
+        Alloc::IAllocator* allocator = Memory::GetGlobalAllocator();
+        PG_DELETE_ARRAY(allocator, mMatrices);
+        PG_DELETE_ARRAY(allocator, mMatrixResults);
+        PG_DELETE_ARRAY(allocator, mVectors);
+        PG_DELETE_ARRAY(allocator, mVectorResults);
+        PG_DELETE_ARRAY(allocator, mQuaternions);
+        PG_DELETE_ARRAY(allocator, mQuaternionResults);
+        PG_DELETE_ARRAY(allocator, mPoints);
+        PG_DELETE_ARRAY(allocator, mPointResults);
+    }
+
+    static float NextValue(unsigned int& seed)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return static_cast<float>(seed >> 8) / 8388607.5f - 1.0f;
+    }
+};
+
+//------------------------------------------------------------------------------------
+// Reference scalar operations
+
+void ReferenceMult44_41(Math::Vec4& dst, const Math::Mat44& mat, const Math::Vec4& vec)
+{
+    const float t0 = mat.m11 * vec.x + mat.m12 * vec.y + mat.m13 * vec.z + mat.m14 * vec.w;
+    const float t1 = mat.m21 * vec.x + mat.m22 * vec.y + mat.m23 * vec.z + mat.m24 * vec.w;
+    const float t2 = mat.m31 * vec.x + mat.m32 * vec.y + mat.m33 * vec.z + mat.m34 * vec.w;
+    dst.w          = mat.m41 * vec.x + mat.m42 * vec.y + mat.m43 * vec.z + mat.m44 * vec.w;
+    dst.x          = t0;
+    dst.y          = t1;
+    dst.z          = t2;
+}
+
+void ReferenceMult44T_41(Math::Vec4& dst, const Math::Mat44& mat, const Math::Vec4& vec)
+{
+    const float t0 = mat.m11 * vec.x + mat.m21 * vec.y + mat.m31 * vec.z + mat.m41 * vec.w;
+    const float t1 = mat.m12 * vec.x + mat.m22 * vec.y + mat.m32 * vec.z + mat.m42 * vec.w;
+    const float t2 = mat.m13 * vec.x + mat.m23 * vec.y + mat.m33 * vec.z + mat.m43 * vec.w;
+    dst.w          = mat.m14 * vec.x + mat.m24 * vec.y + mat.m34 * vec.z + mat.m44 * vec.w;
+    dst.x          = t0;
+    dst.y          = t1;
+    dst.z          = t2;
+}
+
+void ReferenceMult44_44(Math::Mat44& dst, const Math::Mat44& mat1, const Math::Mat44& mat2)
+{
+    float t[16];
+    for (int r = 0; r < 4; ++r)
+    {
+        for (int c = 0; c < 4; ++c)
+        {
+            t[4 * r + c] = mat1.m[4 * r] * mat2.m[c] + mat1.m[4 * r + 1] * mat2.m[4 + c]
+                         + mat1.m[4 * r + 2] * mat2.m[8 + c] + mat1.m[4 * r + 3] * mat2.m[12 + c];
+        }
+    }
+    for (int i = 0; i < 16; ++i)
+    {
+        dst.m[i] = t[i];
+    }
+}
+
+//! quat1 = quat1 * quat2, normalized, as RightMult
+void ReferenceRightMult(Math::Quaternion& quat1, const Math::Quaternion& quat2)
+{
+    const float w = quat1.w * quat2.w - quat1.x * quat2.x - quat1.y * quat2.y - quat1.z * quat2.z;
+    const float x = quat1.w * quat2.x + quat1.x * quat2.w + quat1.y * quat2.z - quat1.z * quat2.y;
+    const float y = quat1.w * quat2.y - quat1.x * quat2.z + quat1.y * quat2.w + quat1.z * quat2.x;
+    quat1.z       = quat1.w * quat2.z + quat1.x * quat2.y - quat1.y * quat2.x + quat1.z * quat2.w;
+    quat1.w       = w;
+    quat1.x       = x;
+    quat1.y       = y;
+    Math::Normalize(quat1);
+}
+
+//! quat1 = quat2 * quat1, normalized, as LeftMult
+void ReferenceLeftMult(Math::Quaternion& quat1, const Math::Quaternion& quat2)
+{
+    Math::Quaternion q(quat2);
+    ReferenceRightMult(q, quat1);
+    quat1 = q;
+}
+
+void ReferenceRotateVector(Math::Vec3& v, const Math::Quaternion& quat)
+{
+    Math::Quaternion q( v.x * quat.x + v.y * quat.y + v.z * quat.z,
+                        v.x * quat.w - v.y * quat.z + v.z * quat.y,
+                        v.x * quat.z + v.y * quat.w - v.z * quat.x,
+                       -v.x * quat.y + v.y * quat.x + v.z * quat.w);
+    ReferenceLeftMult(q, quat);
+    v.x = q.x;
+    v.y = q.y;
+    v.z = q.z;
+}
+
+//------------------------------------------------------------------------------------
+// Functors, every operation reads the inputs of index i and writes the result of index i
+
+struct ReferenceMult44_41Run
+{
+    MathBenchmarkData* mData;
+    void operator()() { for (int i = 0; i < BENCHMARK_MATH_COUNT; ++i) { ReferenceMult44_41(mData->mVectorResults[i], mData->mMatrices[i], mData->mVectors[i]); } }
+};
+
+struct Mult44_41Run
+{
+    MathBenchmarkData* mData;
+    void operator()() { for (int i = 0; i < BENCHMARK_MATH_COUNT; ++i) { Math::Mult44_41(mData->mVectorResults[i], mData->mMatrices[i], mData->mVectors[i]); } }
+};
+
+struct ReferenceMult44T_41Run
+{
+    MathBenchmarkData* mData;
+    void operator()() { for (int i = 0; i < BENCHMARK_MATH_COUNT; ++i) { ReferenceMult44T_41(mData->mVectorResults[i], mData->mMatrices[i], mData->mVectors[i]); } }
+};
+
+struct Mult44T_41Run
+{
+    MathBenchmarkData* mData;
+    void operator()() { for (int i = 0; i < BENCHMARK_MATH_COUNT; ++i) { Math::Mult44T_41(mData->mVectorResults[i], mData->mMatrices[i], mData->mVectors[i]); } }
+};
+
+//! Multiplies each matrix with the next one
+struct ReferenceMult44_44Run
+{
+    MathBenchmarkData* mData;
+    void operator()()
+    {
+        for (int i = 0; i < BENCHMARK_MATH_COUNT; ++i)
+        {
+            ReferenceMult44_44(mData->mMatrixResults[i], mData->mMatrices[i], mData->mMatrices[(i + 1) % BENCHMARK_MATH_COUNT]);
+        }
+    }
+};
+
+struct Mult44_44Run
+{
+    MathBenchmarkData* mData;
+    void operator()()
+    {
+        for (int i = 0; i < BENCHMARK_MATH_COUNT; ++i)
+        {
+            Math::Mult44_44(mData->mMatrixResults[i], mData->mMatrices[i], mData->mMatrices[(i + 1) % BENCHMARK_MATH_COUNT]);
+        }
+    }
+};
+
+//! Multiplies each quaternion with the next one
+struct ReferenceQuaternionMultRun
+{
+    MathBenchmarkData* mData;
+    void operator()()
+    {
+        for (int i = 0; i < BENCHMARK_MATH_COUNT; ++i)
+        {
+            mData->mQuaternionResults[i] = mData->mQuaternions[i];
+            ReferenceRightMult(mData->mQuaternionResults[i], mData->mQuaternions[(i + 1) % BENCHMARK_MATH_COUNT]);
+        }
+    }
+};
+
+struct QuaternionMultRun
+{
+    MathBenchmarkData* mData;
+    void operator()()
+    {
+        for (int i = 0; i < BENCHMARK_MATH_COUNT; ++i)
+        {
+            mData->mQuaternionResults[i] = mData->mQuaternions[i];
+            Math::RightMult(mData->mQuaternionResults[i], mData->mQuaternions[(i + 1) % BENCHMARK_MATH_COUNT]);
+        }
+    }
+};
+
+struct ReferenceRotateVectorRun
+{
+    MathBenchmarkData* mData;
+    void operator()()
+    {
+        for (int i = 0; i < BENCHMARK_MATH_COUNT; ++i)
+        {
+            mData->mPointResults[i] = mData->mPoints[i];
+            ReferenceRotateVector(mData->mPointResults[i], mData->mQuaternions[i]);
+        }
+    }
+};
+
+struct RotateVectorRun
+{
+    MathBenchmarkData* mData;
+    void operator()()
+    {
+        for (int i = 0; i < BENCHMARK_MATH_COUNT; ++i)
+        {
+            mData->mPointResults[i] = mData->mPoints[i];
+            Math::RotateVector(mData->mPointResults[i], mData->mQuaternions[i]);
+        }
+    }
+};
+
+//------------------------------------------------------------------------------------
+// Accuracy
+
+//! Largest difference between two arrays of floats, relative to the magnitude of the reference
+float GetRelativeError(const float* values, const float* references, int count)
+{
+    float maxError = 0.0f;
+    for (int i = 0; i < count; ++i)
+    {
+        const float magnitude = fabsf(references[i]) > 1.0f ? fabsf(references[i]) : 1.0f;
+        const float error = fabsf(values[i] - references[i]) / magnitude;
+        if (!(error <= maxError))
+        {
+            //also keeps the NaNs
+            maxError = error;
+        }
+    }
+    return maxError;
+}
+
+//! Prints the largest error of an operation
+//! \return True when the error is under the tolerance
+bool ReportAccuracy(const char* label, float maxError)
+{
+    printf("  %-40s %10.3g max relative error\n", label, maxError);
+    if (!(maxError <= BENCHMARK_MATH_TOLERANCE))
+    {
+        printf("  ERROR: %s is not accurate enough!\n", label);
+        return false;
+    }
+    return true;
+}
+
+//! Runs a reference functor and an engine functor on the same inputs, and returns the largest error of the results
+template<class R, class F>
+float MeasureError(R& reference, F& func, const float* results, int floatCount, float* referenceResults)
+{
+    reference();
+    for (int i = 0; i < floatCount; ++i)
+    {
+        referenceResults[i] = results[i];
+    }
+    func();
+    return GetRelativeError(results, referenceResults, floatCount);
+}
+
+//! Runs a reference functor and the same operation of the engine, and prints the times
+template<class R, class F>
+void RunMathBenchmark(R& reference, F& func)
+{
+    const double referenceTime = BenchmarkMeasure(reference);
+    const double time = BenchmarkMeasure(func);
+    BenchmarkReport("Generic scalar", referenceTime, BENCHMARK_MATH_COUNT);
+    BenchmarkReport(PEGASUS_MATH_SIMD_SSE ? "SIMD" : "SIMD (not compiled, generic)", time, BENCHMARK_MATH_COUNT);
+    BenchmarkReportSpeedup("Speedup", referenceTime, time);
+}
+
+//------------------------------------------------------------------------------------
+// Batch transforms
+
+//! Element counts of the batch transform benchmarks
+const int BENCHMARK_BATCH_COUNTS[] = { 10 * 1000, 100 * 1000, 1000 * 1000, 10 * 1000 * 1000 };
+
+//! Random source elements and the destination of a batch transform
+struct BatchBenchmarkData
+{
+    float* mSrc;
+    float* mDst;
+    int mCount;
+    int mFloatsPerElement;
+    Math::Mat44 mMat;
+    Math::Mat33 mNormalMat;
+
+    BatchBenchmarkData(int count, int floatsPerElement) : mCount(count), mFloatsPerElement(floatsPerElement)
+    {
+        Alloc::IAllocator* allocator = Memory::GetGlobalAllocator();
+        mSrc = PG_NEW_ARRAY(allocator, -1, "Benchmark batch src", Alloc::PG_MEM_TEMP, float, count * floatsPerElement);
+        mDst = PG_NEW_ARRAY(allocator, -1, "Benchmark batch dst", Alloc::PG_MEM_TEMP, float, count * floatsPerElement);
+
+        unsigned int seed = 7654321u;
+        for (int i = 0; i < count * floatsPerElement; ++i)
+        {
+            mSrc[i] = MathBenchmarkData::NextValue(seed) * 10.0f;
+        }
+
+        //boxes with min <= max
+        if (floatsPerElement == 6)
+        {
+            for (int i = 0; i < count; ++i)
+            {
+                float* box = mSrc + 6 * i;
+                for (int c = 0; c < 3; ++c)
+                {
+                    const float lo = box[c] < box[c + 3] ? box[c] : box[c + 3];
+                    const float hi = box[c] < box[c + 3] ? box[c + 3] : box[c];
+                    box[c] = lo;
+                    box[c + 3] = hi;
+                }
+            }
+        }
+
+        //rotation, scale and translation
+        Math::Quaternion q(Math::Vec3(0.3f, 0.8f, 0.1f), 0.7f);
+        Math::QuaternionToMat44(mMat, q);
+        Math::QuaternionToMat33(mNormalMat, q);
+        for (int i = 0; i < 3; ++i)
+        {
+            for (int j = 0; j < 3; ++j)
+            {
+                mMat.m[4 * i + j] *= 1.5f;
+            }
+        }
+        mMat.m14 = 1.0f;
+        mMat.m24 = -2.0f;
+        mMat.m34 = 0.5f;
+    }
+
+    ~BatchBenchmarkData()
+    {
+        Alloc::IAllocator* allocator = Memory::GetGlobalAllocator();
+        PG_DELETE_ARRAY(allocator, mSrc);
+        PG_DELETE_ARRAY(allocator, mDst);
+    }
+};
+
+//! Per element loops, as the call sites did before the batch transforms
+
+struct ReferencePointsRun
+{
+    BatchBenchmarkData* mData;
+    void operator()()
+    {
+        for (int i = 0; i < mData->mCount; ++i)
+        {
+            const float* src = mData->mSrc + 3 * i;
+            Math::Vec4 p;
+            Math::Mult44_41(p, mData->mMat, Math::Vec4(src[0], src[1], src[2], 1.0f));
+            float* dst = mData->mDst + 3 * i;
+            dst[0] = p.x; dst[1] = p.y; dst[2] = p.z;
+        }
+    }
+};
+
+struct BatchPointsRun
+{
+    BatchBenchmarkData* mData;
+    void operator()() { Math::TransformPoints(mData->mDst, 3 * sizeof(float), mData->mSrc, 3 * sizeof(float), mData->mCount, mData->mMat); }
+};
+
+struct ReferenceNormalsRun
+{
+    BatchBenchmarkData* mData;
+    void operator()()
+    {
+        for (int i = 0; i < mData->mCount; ++i)
+        {
+            const float* src = mData->mSrc + 3 * i;
+            Math::Vec3 n;
+            Math::Mult33_31(n, mData->mNormalMat, Math::Vec3(src[0], src[1], src[2]));
+            const float len = Math::Length(n);
+            if (Math::Abs(len) > PFLOAT_EPSILON)
+            {
+                n /= len;
+            }
+            float* dst = mData->mDst + 3 * i;
+            dst[0] = n.x; dst[1] = n.y; dst[2] = n.z;
+        }
+    }
+};
+
+struct BatchNormalsRun
+{
+    BatchBenchmarkData* mData;
+    void operator()() { Math::TransformNormals(mData->mDst, 3 * sizeof(float), mData->mSrc, 3 * sizeof(float), mData->mCount, mData->mNormalMat, true); }
+};
+
+//! Homogeneous points in 4 planes, the pitch being the element count
+struct ReferencePointsSoaRun
+{
+    BatchBenchmarkData* mData;
+    void operator()()
+    {
+        const int pitch = mData->mCount;
+        for (int i = 0; i < mData->mCount; ++i)
+        {
+            const float* src = mData->mSrc + i;
+            Math::Vec4 p;
+            Math::Mult44_41(p, mData->mMat, Math::Vec4(src[0], src[pitch], src[2 * pitch], src[3 * pitch]));
+            float* dst = mData->mDst + i;
+            dst[0] = p.x; dst[pitch] = p.y; dst[2 * pitch] = p.z; dst[3 * pitch] = p.w;
+        }
+    }
+};
+
+struct BatchPointsSoaRun
+{
+    BatchBenchmarkData* mData;
+    void operator()() { Math::TransformHomogeneousPointsSoa(mData->mDst, mData->mCount, mData->mSrc, mData->mCount, mData->mCount, mData->mMat); }
+};
+
+//! Transforms the 8 corners of each box, and keeps their bounds
+struct ReferenceAabbsRun
+{
+    BatchBenchmarkData* mData;
+    void operator()()
+    {
+        for (int i = 0; i < mData->mCount; ++i)
+        {
+            const float* src = mData->mSrc + 6 * i;
+            float* dst = mData->mDst + 6 * i;
+            for (int k = 0; k < 8; ++k)
+            {
+                Math::Vec4 corner;
+                Math::Mult44_41(corner, mData->mMat, Math::Vec4(src[(k & 1) ? 3 : 0], src[(k & 2) ? 4 : 1], src[(k & 4) ? 5 : 2], 1.0f));
+                for (int c = 0; c < 3; ++c)
+                {
+                    dst[c] = k == 0 || corner.v[c] < dst[c] ? corner.v[c] : dst[c];
+                    dst[c + 3] = k == 0 || corner.v[c] > dst[c + 3] ? corner.v[c] : dst[c + 3];
+                }
+            }
+        }
+    }
+};
+
+struct BatchAabbsRun
+{
+    BatchBenchmarkData* mData;
+    void operator()() { Math::TransformAabbs(mData->mDst, 6 * sizeof(float), mData->mSrc, 6 * sizeof(float), mData->mCount, mData->mMat); }
+};
+
+//! Runs a per element loop and a batch transform for each element count, and checks the results match
+template<class R, class F>
+void RunBatchBenchmark(int floatsPerElement, const char* unit)
+{
+    Alloc::IAllocator* allocator = Memory::GetGlobalAllocator();
+    const int sizeCount = sizeof(BENCHMARK_BATCH_COUNTS) / sizeof(BENCHMARK_BATCH_COUNTS[0]);
+    for (int s = 0; s < sizeCount; ++s)
+    {
+        BatchBenchmarkData data(BENCHMARK_BATCH_COUNTS[s], floatsPerElement);
+        R reference = { &data };
+        F func = { &data };
+
+        //the smallest count checks the results, the others only measure
+        if (s == 0)
+        {
+            const int floatCount = data.mCount * floatsPerElement;
+            float* referenceResults = PG_NEW_ARRAY(allocator, -1, "Benchmark batch reference", Alloc::PG_MEM_TEMP, float, floatCount);
+            ReportAccuracy("Batch vs per element", MeasureError(reference, func, data.mDst, floatCount, referenceResults));
+            PG_DELETE_ARRAY(allocator, referenceResults);
+        }
+
+        const double referenceTime = BenchmarkMeasure(reference);
+        const double time = BenchmarkMeasure(func);
+        char label[64];
+        sprintf_s(label, sizeof(label), "Per element, %d %s", data.mCount, unit);
+        BenchmarkReport(label, referenceTime, data.mCount);
+        sprintf_s(label, sizeof(label), "Batch, %d %s", data.mCount, unit);
+        BenchmarkReport(label, time, data.mCount);
+        BenchmarkReportSpeedup("Speedup", referenceTime, time);
+    }
+}
+
+//------------------------------------------------------------------------------------
+// Batch culling
+
+//! Planes of the frustum of the culling benchmarks: camera at the origin looking down -z,
+//! 90 degrees field of view, near 1, far 100. The normals point outwards.
+void SetBenchmarkFrustum(Math::Plane planes[6])
+{
+    const float s = Math::P_1_OVER_SQRT_2;
+    planes[0] = Math::Plane(Math::Vec3(0.0f, 0.0f, 1.0f), 1.0f);
+    planes[1] = Math::Plane(Math::Vec3(0.0f, 0.0f, -1.0f), -100.0f);
+    planes[2] = Math::Plane(Math::Vec3(-s, 0.0f, s), 0.0f);
+    planes[3] = Math::Plane(Math::Vec3(s, 0.0f, s), 0.0f);
+    planes[4] = Math::Plane(Math::Vec3(0.0f, s, s), 0.0f);
+    planes[5] = Math::Plane(Math::Vec3(0.0f, -s, s), 0.0f);
+}
+
+//! Random boxes or spheres around a frustum, in SoA layout, and the culling masks
+struct CullBenchmarkData
+{
+    float* mSrc;
+    Math::PUInt32* mMasks;
+    Math::PUInt32* mReferenceMasks;
+    int mCount;
+    int mMaskSize;
+    Math::Plane mPlanes[6];
+
+    CullBenchmarkData(int count, bool spheres) : mCount(count), mMaskSize(Math::GetCullMaskSize(count))
+    {
+        Alloc::IAllocator* allocator = Memory::GetGlobalAllocator();
+        mSrc = PG_NEW_ARRAY(allocator, -1, "Benchmark cull src", Alloc::PG_MEM_TEMP, float, count * 6);
+        mMasks = PG_NEW_ARRAY(allocator, -1, "Benchmark cull masks", Alloc::PG_MEM_TEMP, Math::PUInt32, 2 * mMaskSize);
+        mReferenceMasks = PG_NEW_ARRAY(allocator, -1, "Benchmark cull reference masks", Alloc::PG_MEM_TEMP, Math::PUInt32, 2 * mMaskSize);
+
+        //centers around the frustum, sizes up to 10
+        unsigned int seed = 7654321u;
+        for (int i = 0; i < count; ++i)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                const float center = MathBenchmarkData::NextValue(seed) * 120.0f - (c == 2 ? 50.0f : 0.0f);
+                const float halfSize = (MathBenchmarkData::NextValue(seed) + 1.0f) * 2.5f;
+                if (spheres)
+                {
+                    mSrc[c * count + i] = center;
+                    mSrc[3 * count + i] = halfSize;
+                }
+                else
+                {
+                    mSrc[c * count + i] = center - halfSize;
+                    mSrc[(c + 3) * count + i] = center + halfSize;
+                }
+            }
+        }
+
+        SetBenchmarkFrustum(mPlanes);
+    }
+
+    ~CullBenchmarkData()
+    {
+        Alloc::IAllocator* allocator = Memory::GetGlobalAllocator();
+        PG_DELETE_ARRAY(allocator, mSrc);
+        PG_DELETE_ARRAY(allocator, mMasks);
+        PG_DELETE_ARRAY(allocator, mReferenceMasks);
+    }
+
+    //! Stores the state of one element in masks
+    void SetState(Math::PUInt32* masks, int i, bool inside, bool outside)
+    {
+        const Math::PUInt32 bit = 1ul << (i & 31);
+        if (inside) { masks[i >> 5] |= bit; }
+        if (outside) { masks[mMaskSize + (i >> 5)] |= bit; }
+    }
+
+    void ClearReferenceMasks()
+    {
+        for (int w = 0; w < 2 * mMaskSize; ++w)
+        {
+            mReferenceMasks[w] = 0;
+        }
+    }
+};
+
+//! 8 corners per box tested against every plane, as Camera::Frustum::GetCollisionState did before the batch culling
+struct ReferenceCullAabbsRun
+{
+    CullBenchmarkData* mData;
+    void operator()()
+    {
+        mData->ClearReferenceMasks();
+        const int pitch = mData->mCount;
+        for (int i = 0; i < mData->mCount; ++i)
+        {
+            const float* box = mData->mSrc + i;
+            Math::Vec3 corners[8];
+            for (int c = 0; c < 8; ++c)
+            {
+                corners[c] = Math::Vec3(box[((c & 1) ? 3 : 0) * pitch], box[((c & 2) ? 4 : 1) * pitch], box[((c & 4) ? 5 : 2) * pitch]);
+            }
+
+            bool inside = true;
+            bool outside = false;
+            for (int p = 0; p < 6 && !outside; ++p)
+            {
+                int in = 0;
+                int out = 0;
+                for (int c = 0; c < 8 && (in == 0 || out == 0); ++c)
+                {
+                    if (mData->mPlanes[p].IsInBack(corners[c])) { ++in; } else { ++out; }
+                }
+                outside = in == 0;
+                inside = inside && out == 0;
+            }
+            mData->SetState(mData->mReferenceMasks, i, inside && !outside, outside);
+        }
+    }
+};
+
+struct BatchCullAabbsRun
+{
+    CullBenchmarkData* mData;
+    void operator()() { Math::CullAabbsSoa(mData->mMasks, mData->mMasks + mData->mMaskSize, mData->mSrc, mData->mCount, mData->mCount, mData->mPlanes, 6); }
+};
+
+//! Per sphere loop over the planes
+struct ReferenceCullSpheresRun
+{
+    CullBenchmarkData* mData;
+    void operator()()
+    {
+        mData->ClearReferenceMasks();
+        const int pitch = mData->mCount;
+        for (int i = 0; i < mData->mCount; ++i)
+        {
+            const float* sphere = mData->mSrc + i;
+            const Math::Vec3 center(sphere[0], sphere[pitch], sphere[2 * pitch]);
+            const float radius = sphere[3 * pitch];
+            bool inside = true;
+            bool outside = false;
+            for (int p = 0; p < 6 && !outside; ++p)
+            {
+                const float dist = Math::Dot(mData->mPlanes[p].GetNormal(), center) + mData->mPlanes[p].GetOriginDistance();
+                outside = !(dist < radius);
+                inside = inside && dist + radius < 0.0f;
+            }
+            mData->SetState(mData->mReferenceMasks, i, inside && !outside, outside);
+        }
+    }
+};
+
+struct BatchCullSpheresRun
+{
+    CullBenchmarkData* mData;
+    void operator()() { Math::CullSpheresSoa(mData->mMasks, mData->mMasks + mData->mMaskSize, mData->mSrc, mData->mCount, mData->mCount, mData->mPlanes, 6); }
+};
+
+//! Runs a per element loop and a batch culling for each element count, and checks the states match
+template<class R, class F>
+void RunCullBenchmark(bool spheres, const char* unit)
+{
+    const int sizeCount = sizeof(BENCHMARK_BATCH_COUNTS) / sizeof(BENCHMARK_BATCH_COUNTS[0]);
+    for (int s = 0; s < sizeCount; ++s)
+    {
+        CullBenchmarkData data(BENCHMARK_BATCH_COUNTS[s], spheres);
+        R reference = { &data };
+        F func = { &data };
+
+        //the smallest count checks the results, the others only measure.
+        //The distances are computed in a different order, so an element right on a plane can differ.
+        if (s == 0)
+        {
+            reference();
+            func();
+            int differences = 0;
+            int insideCount = 0;
+            int outsideCount = 0;
+            for (int i = 0; i < data.mCount; ++i)
+            {
+                const Math::PUInt32 bit = 1ul << (i & 31);
+                const int w = i >> 5;
+                differences += ((data.mMasks[w] ^ data.mReferenceMasks[w]) & bit) != 0 || ((data.mMasks[data.mMaskSize + w] ^ data.mReferenceMasks[data.mMaskSize + w]) & bit) != 0;
+                insideCount += (data.mMasks[w] & bit) != 0;
+                outsideCount += (data.mMasks[data.mMaskSize + w] & bit) != 0;
+            }
+            printf("  %d inside, %d intersecting, %d outside, %d different from the per element loop\n",
+                   insideCount, data.mCount - insideCount - outsideCount, outsideCount, differences);
+            if (differences * 10000 > data.mCount)
+            {
+                printf("  ERROR: The batch culling does not match the per element loop!\n");
+            }
+        }
+
+        const double referenceTime = BenchmarkMeasure(reference);
+        const double time = BenchmarkMeasure(func);
+        char label[64];
+        sprintf_s(label, sizeof(label), "Per element, %d %s", data.mCount, unit);
+        BenchmarkReport(label, referenceTime, data.mCount);
+        sprintf_s(label, sizeof(label), "Batch, %d %s", data.mCount, unit);
+        BenchmarkReport(label, time, data.mCount);
+        BenchmarkReportSpeedup("Speedup", referenceTime, time);
+    }
+}
+
+//------------------------------------------------------------------------------------
+// Bounding volume hierarchy
+
+//! Object counts of the bounding volume hierarchy benchmarks
+const int BENCHMARK_BVH_COUNTS[] = { 10 * 1000, 100 * 1000, 1000 * 1000 };
+
+//! Number of overlap queries and of rays of one run
+const int BENCHMARK_BVH_QUERY_COUNT = 32;
+
+//! Length of the rays
+const float BENCHMARK_BVH_RAY_LENGTH = 1000.0f;
+
+//! Random boxes in a 500 units wide scene, with the frustum of the culling benchmarks at its center,
+//! their hierarchy, random query boxes and rays, and the results of the queries
+struct BvhBenchmarkData
+{
+    Math::BoundingVolumeHierarchy mBvh;
+    Math::AxisAlignedBoundingBox* mBoxes;
+    Math::BvhObjectHandle* mHandles;
+    Math::AxisAlignedBoundingBox mQueryBoxes[BENCHMARK_BVH_QUERY_COUNT];
+    Math::Vec3 mRayOrigins[BENCHMARK_BVH_QUERY_COUNT];
+    Math::Vec3 mRayDirections[BENCHMARK_BVH_QUERY_COUNT];
+    Math::Plane mPlanes[6];
+    int* mResults;
+    int* mReferenceResults;
+    unsigned char* mFound;
+    int mCount;
+    int mResultSum;
+    float mMoveOffset;
+
+    explicit BvhBenchmarkData(int count) : mBvh(Memory::GetGlobalAllocator()), mCount(count), mResultSum(0), mMoveOffset(0.5f)
+    {
+        Alloc::IAllocator* allocator = Memory::GetGlobalAllocator();
+        mBoxes = PG_NEW_ARRAY(allocator, -1, "Benchmark bvh boxes", Alloc::PG_MEM_TEMP, Math::AxisAlignedBoundingBox, count);
+        mHandles = PG_NEW_ARRAY(allocator, -1, "Benchmark bvh handles", Alloc::PG_MEM_TEMP, Math::BvhObjectHandle, count);
+        mResults = PG_NEW_ARRAY(allocator, -1, "Benchmark bvh results", Alloc::PG_MEM_TEMP, int, count);
+        mReferenceResults = PG_NEW_ARRAY(allocator, -1, "Benchmark bvh reference results", Alloc::PG_MEM_TEMP, int, count);
+        mFound = PG_NEW_ARRAY(allocator, -1, "Benchmark bvh found", Alloc::PG_MEM_TEMP, unsigned char, count);
+
+        //sizes up to 10, the user data of an object is its index
+        unsigned int seed = 2345671u;
+        for (int i = 0; i < count; ++i)
+        {
+            const Math::Vec3 center = NextPoint(seed) * 250.0f;
+            const float halfSize = (MathBenchmarkData::NextValue(seed) + 1.0f) * 2.5f;
+            mBoxes[i].SetMinMax(center - Math::Vec3(halfSize), center + Math::Vec3(halfSize));
+            mHandles[i] = mBvh.AddObject(mBoxes[i], i);
+        }
+
+        for (int q = 0; q < BENCHMARK_BVH_QUERY_COUNT; ++q)
+        {
+            const Math::Vec3 center = NextPoint(seed) * 250.0f;
+            mQueryBoxes[q].SetMinMax(center - Math::Vec3(20.0f), center + Math::Vec3(20.0f));
+            mRayOrigins[q] = NextPoint(seed) * 250.0f;
+            Math::Vec3 direction = NextPoint(seed);
+            if (Math::Length(direction) < 0.01f)
+            {
+                direction = Math::Vec3(0.0f, 0.0f, -1.0f);
+            }
+            Math::Normalize(direction);
+            mRayDirections[q] = direction;
+        }
+
+        SetBenchmarkFrustum(mPlanes);
+    }
+
+    ~BvhBenchmarkData()
+    {
+        Alloc::IAllocator* allocator = Memory::GetGlobalAllocator();
+        PG_DELETE_ARRAY(allocator, mBoxes);
+        PG_DELETE_ARRAY(allocator, mHandles);
+        PG_DELETE_ARRAY(allocator, mResults);
+        PG_DELETE_ARRAY(allocator, mReferenceResults);
+        PG_DELETE_ARRAY(allocator, mFound);
+    }
+
+    static Math::Vec3 NextPoint(unsigned int& seed)
+    {
+        const float x = MathBenchmarkData::NextValue(seed);
+        const float y = MathBenchmarkData::NextValue(seed);
+        const float z = MathBenchmarkData::NextValue(seed);
+        return Math::Vec3(x, y, z);
+    }
+
+    //! Per box loop over the planes, with the farthest corner in the back of each plane
+    int ReferenceFrustum(int* results) const
+    {
+        int resultCount = 0;
+        for (int i = 0; i < mCount; ++i)
+        {
+            const Math::Vec3& boxMin = mBoxes[i].GetMin();
+            const Math::Vec3& boxMax = mBoxes[i].GetMax();
+            bool outside = false;
+            for (int p = 0; p < 6 && !outside; ++p)
+            {
+                const Math::Vec3& normal = mPlanes[p].GetNormal();
+                float distance = mPlanes[p].GetOriginDistance();
+                for (int c = 0; c < 3; ++c)
+                {
+                    const float lo = normal.v[c] * boxMin.v[c];
+                    const float hi = normal.v[c] * boxMax.v[c];
+                    distance += lo < hi ? lo : hi;
+                }
+                outside = distance >= 0.0f;
+            }
+            if (!outside)
+            {
+                results[resultCount++] = i;
+            }
+        }
+        return resultCount;
+    }
+
+    //! Per box overlap test
+    int ReferenceOverlap(int* results, const Math::AxisAlignedBoundingBox& box) const
+    {
+        int resultCount = 0;
+        const Math::Vec3& queryMin = box.GetMin();
+        const Math::Vec3& queryMax = box.GetMax();
+        for (int i = 0; i < mCount; ++i)
+        {
+            const Math::Vec3& boxMin = mBoxes[i].GetMin();
+            const Math::Vec3& boxMax = mBoxes[i].GetMax();
+            if (boxMin.x <= queryMax.x && boxMax.x >= queryMin.x
+                && boxMin.y <= queryMax.y && boxMax.y >= queryMin.y
+                && boxMin.z <= queryMax.z && boxMax.z >= queryMin.z)
+            {
+                results[resultCount++] = i;
+            }
+        }
+        return resultCount;
+    }
+
+    //! Per box slab test, keeping the closest hit
+    bool ReferenceRay(int& userData, float& distance, int ray) const
+    {
+        const Math::Vec3& origin = mRayOrigins[ray];
+        float invDirection[3];
+        for (int c = 0; c < 3; ++c)
+        {
+            invDirection[c] = 1.0f / mRayDirections[ray].v[c];
+        }
+
+        distance = BENCHMARK_BVH_RAY_LENGTH;
+        userData = -1;
+        for (int i = 0; i < mCount; ++i)
+        {
+            float tNear = 0.0f;
+            float tFar = distance;
+            for (int c = 0; c < 3; ++c)
+            {
+                float t0 = (mBoxes[i].GetMin().v[c] - origin.v[c]) * invDirection[c];
+                float t1 = (mBoxes[i].GetMax().v[c] - origin.v[c]) * invDirection[c];
+                if (t0 > t1)
+                {
+                    const float t = t0;
+                    t0 = t1;
+                    t1 = t;
+                }
+                tNear = t0 > tNear ? t0 : tNear;
+                tFar = t1 < tFar ? t1 : tFar;
+            }
+            if (tNear <= tFar && (userData == -1 || tNear < distance))
+            {
+                userData = i;
+                distance = tNear;
+            }
+        }
+        return userData != -1;
+    }
+
+    //! Counts the objects found only by the hierarchy or only by the reference
+    int CountDifferences(int resultCount, int referenceCount)
+    {
+        memset(mFound, 0, mCount);
+        for (int r = 0; r < referenceCount; ++r)
+        {
+            mFound[mReferenceResults[r]] = 1;
+        }
+        int differences = 0;
+        for (int r = 0; r < resultCount; ++r)
+        {
+            unsigned char& found = mFound[mResults[r]];
+            differences += found != 1;
+            found = 2;
+        }
+        for (int r = 0; r < referenceCount; ++r)
+        {
+            differences += mFound[mReferenceResults[r]] != 2;
+        }
+        return differences;
+    }
+};
+
+struct BvhBuildRun
+{
+    BvhBenchmarkData* mData;
+    void operator()() { mData->mBvh.Build(); }
+};
+
+//! Moves one object out of 10 back and forth along x, then refits the tree
+struct BvhRefitRun
+{
+    BvhBenchmarkData* mData;
+    void operator()()
+    {
+        const Math::Vec3 offset(mData->mMoveOffset, 0.0f, 0.0f);
+        for (int i = 0; i < mData->mCount; i += 10)
+        {
+            Math::AxisAlignedBoundingBox& box = mData->mBoxes[i];
+            box.SetMinMax(box.GetMin() + offset, box.GetMax() + offset);
+            mData->mBvh.UpdateObject(mData->mHandles[i], box);
+        }
+        mData->mMoveOffset = -mData->mMoveOffset;
+        mData->mBvh.Refit();
+    }
+};
+
+struct ReferenceBvhFrustumRun
+{
+    BvhBenchmarkData* mData;
+    void operator()() { mData->mResultSum = mData->ReferenceFrustum(mData->mReferenceResults); }
+};
+
+struct BvhFrustumRun
+{
+    BvhBenchmarkData* mData;
+    void operator()() { mData->mResultSum = mData->mBvh.QueryFrustum(mData->mResults, mData->mCount, mData->mPlanes, 6); }
+};
+
+struct ReferenceBvhOverlapRun
+{
+    BvhBenchmarkData* mData;
+    void operator()()
+    {
+        mData->mResultSum = 0;
+        for (int q = 0; q < BENCHMARK_BVH_QUERY_COUNT; ++q)
+        {
+            mData->mResultSum += mData->ReferenceOverlap(mData->mReferenceResults, mData->mQueryBoxes[q]);
+        }
+    }
+};
+
+struct BvhOverlapRun
+{
+    BvhBenchmarkData* mData;
+    void operator()()
+    {
+        mData->mResultSum = 0;
+        for (int q = 0; q < BENCHMARK_BVH_QUERY_COUNT; ++q)
+        {
+            mData->mResultSum += mData->mBvh.QueryOverlap(mData->mResults, mData->mCount, mData->mQueryBoxes[q]);
+        }
+    }
+};
+
+struct ReferenceBvhRayRun
+{
+    BvhBenchmarkData* mData;
+    void operator()()
+    {
+        mData->mResultSum = 0;
+        for (int q = 0; q < BENCHMARK_BVH_QUERY_COUNT; ++q)
+        {
+            int userData;
+            float distance;
+            mData->mResultSum += mData->ReferenceRay(userData, distance, q);
+        }
+    }
+};
+
+struct BvhRayRun
+{
+    BvhBenchmarkData* mData;
+    void operator()()
+    {
+        mData->mResultSum = 0;
+        for (int q = 0; q < BENCHMARK_BVH_QUERY_COUNT; ++q)
+        {
+            int userData;
+            float distance;
+            const Math::Ray ray(mData->mRayOrigins[q], mData->mRayDirections[q]);
+            mData->mResultSum += mData->mBvh.QueryRay(userData, distance, ray, BENCHMARK_BVH_RAY_LENGTH);
+        }
+    }
+};
+
+//! Checks the queries of the hierarchy find the same objects as the per box loops.
+//! The distances to the planes are summed in the same order, so the results should match exactly.
+void CheckBvhQueries(BvhBenchmarkData& data)
+{
+    int differences = 0;
+    int resultCount = data.mBvh.QueryFrustum(data.mResults, data.mCount, data.mPlanes, 6);
+    int referenceCount = data.ReferenceFrustum(data.mReferenceResults);
+    differences += data.CountDifferences(resultCount, referenceCount);
+    printf("  Frustum: %d objects found, %d different from the per box loop\n", resultCount, differences);
+
+    int overlapSum = 0;
+    for (int q = 0; q < BENCHMARK_BVH_QUERY_COUNT; ++q)
+    {
+        resultCount = data.mBvh.QueryOverlap(data.mResults, data.mCount, data.mQueryBoxes[q]);
+        referenceCount = data.ReferenceOverlap(data.mReferenceResults, data.mQueryBoxes[q]);
+        differences += data.CountDifferences(resultCount, referenceCount);
+        overlapSum += resultCount;
+    }
+
+    int hitCount = 0;
+    for (int q = 0; q < BENCHMARK_BVH_QUERY_COUNT; ++q)
+    {
+        int userData, referenceUserData;
+        float distance, referenceDistance;
+        const bool hit = data.mBvh.QueryRay(userData, distance, Math::Ray(data.mRayOrigins[q], data.mRayDirections[q]), BENCHMARK_BVH_RAY_LENGTH);
+        const bool referenceHit = data.ReferenceRay(referenceUserData, referenceDistance, q);
+        differences += hit != referenceHit || (hit && distance != referenceDistance);
+        hitCount += hit;
+    }
+    printf("  %d objects overlapping %d boxes, %d rays out of %d hitting an object\n", overlapSum, BENCHMARK_BVH_QUERY_COUNT, hitCount, BENCHMARK_BVH_QUERY_COUNT);
+
+    if (differences != 0)
+    {
+        printf("  ERROR: The hierarchy queries do not match the per box loops (%d differences)!\n", differences);
+    }
+}
+
+//------------------------------------------------------------------------------------
+// Transcendental functions
+
+//! Step between two bit patterns of the accuracy sweeps, prime so every mantissa bit varies
+const unsigned int BENCHMARK_SWEEP_STEP = 61;
+
+//! Size of the last place of the float closest to a reference value, denormals included
+double GetUlp(double reference)
+{
+    const float f = fabsf(static_cast<float>(reference));
+    if (f < FLT_MIN)
+    {
+        return ldexp(1.0, -149);
+    }
+    int e;
+    frexpf(f, &e);
+    return ldexp(1.0, e - 24);
+}
+
+//! The function approximations, with the precise scalar version and the double precision reference
+struct SinFunction
+{
+    Math::SimdFloat4 Simd(Math::SimdFloat4 x) const { return Math::SimdSin(x); }
+    float Fast(float x) const { return Math::FastSin(x); }
+    float Precise(float x) const { return Math::Sin(x); }
+    double Reference(double x) const { return sin(x); }
+};
+
+struct CosFunction
+{
+    Math::SimdFloat4 Simd(Math::SimdFloat4 x) const { return Math::SimdCos(x); }
+    float Fast(float x) const { return Math::FastCos(x); }
+    float Precise(float x) const { return Math::Cos(x); }
+    double Reference(double x) const { return cos(x); }
+};
+
+struct ExpFunction
+{
+    Math::SimdFloat4 Simd(Math::SimdFloat4 x) const { return Math::SimdExp(x); }
+    float Fast(float x) const { return Math::FastExp(x); }
+    float Precise(float x) const { return Math::Exp(x); }
+    double Reference(double x) const { return exp(x); }
+};
+
+struct LogFunction
+{
+    Math::SimdFloat4 Simd(Math::SimdFloat4 x) const { return Math::SimdLog(x); }
+    float Fast(float x) const { return Math::FastLog(x); }
+    float Precise(float x) const { return Math::Log(x); }
+    double Reference(double x) const { return log(x); }
+};
+
+//! Power with a constant exponent
+struct PowFunction
+{
+    float mY;
+    Math::SimdFloat4 Simd(Math::SimdFloat4 x) const { return Math::SimdPow(x, Math::SimdSet1(mY)); }
+    float Fast(float x) const { return Math::FastPow(x, mY); }
+    float Precise(float x) const { return Math::Pow(x, mY); }
+    double Reference(double x) const { return pow(x, static_cast<double>(mY)); }
+};
+
+//! Largest errors of a function over a sweep of inputs
+template<class T>
+struct AccuracySweep
+{
+    T mFunction;
+    double mUlpBound;           //!< Largest error accepted in ULP, 0 to skip the check
+    double mUlpBoundPerLog;     //!< Error accepted in ULP in addition to mUlpBound, per unit of |log(x)|
+    double mAbsoluteBound;      //!< Largest absolute error accepted, 0 to skip the check
+    double mMaxUlp;
+    double mMaxAbsolute;
+    bool mInBounds;
+
+    void operator()(const float* x)
+    {
+        float results[4];
+        Math::SimdStoreU(results, mFunction.Simd(Math::SimdLoadU(x)));
+        for (int l = 0; l < 4; ++l)
+        {
+            const double reference = mFunction.Reference(x[l]);
+            double ulp;
+            double absolute;
+            if (fabs(reference) > FLT_MAX)
+            {
+                //the float result overflows, it has to be infinite
+                ulp = (fabsf(results[l]) > FLT_MAX) ? 0.0 : 1e30;
+                absolute = 0.0;
+            }
+            else
+            {
+                absolute = fabs(results[l] - reference);
+                ulp = absolute / GetUlp(reference);
+            }
+
+            //the negated comparisons catch the NaNs
+            if (!(ulp <= mMaxUlp)) { mMaxUlp = ulp; }
+            if (!(absolute <= mMaxAbsolute)) { mMaxAbsolute = absolute; }
+            const double ulpBound = mUlpBound + (mUlpBoundPerLog > 0.0 ? mUlpBoundPerLog * fabs(log(static_cast<double>(x[l]))) : 0.0);
+            if (mUlpBound > 0.0 && !(ulp <= ulpBound))
+            {
+                mInBounds = false;
+            }
+            if (mAbsoluteBound > 0.0 && !(absolute <= mAbsoluteBound))
+            {
+                mInBounds = false;
+            }
+        }
+    }
+};
+
+//! Walks the floats of [lo, hi] with a constant step between the bit patterns, 4 at a time
+template<class V>
+void SweepFloats(float lo, float hi, V& visitor)
+{
+    float x[4];
+    int lane = 0;
+    for (int side = 0; side < 2; ++side)
+    {
+        //positive floats of the range, then the negated floats of the negative part
+        const float first = side == 0 ? (lo > 0.0f ? lo : 0.0f) : (hi < 0.0f ? -hi : 0.0f);
+        const float last = side == 0 ? hi : -lo;
+        if (last < first || (side == 1 && last == 0.0f))
+        {
+            continue;
+        }
+
+        unsigned int firstBits;
+        unsigned int lastBits;
+        memcpy(&firstBits, &first, sizeof(float));
+        memcpy(&lastBits, &last, sizeof(float));
+        for (unsigned int bits = firstBits; bits <= lastBits && bits >= firstBits; bits += BENCHMARK_SWEEP_STEP)
+        {
+            float f;
+            memcpy(&f, &bits, sizeof(float));
+            x[lane++] = side == 0 ? f : -f;
+            if (lane == 4)
+            {
+                visitor(x);
+                lane = 0;
+            }
+        }
+    }
+
+    if (lane > 0)
+    {
+        for (int l = lane; l < 4; ++l)
+        {
+            x[l] = x[0];
+        }
+        visitor(x);
+    }
+}
+
+//! Sweeps a range of inputs, prints the largest errors
+//! \return True when the errors are under the bounds
+template<class T>
+bool SweepAccuracy(const char* label, const T& function, float lo, float hi, double ulpBound, double ulpBoundPerLog, double absoluteBound)
+{
+    AccuracySweep<T> sweep = { function, ulpBound, ulpBoundPerLog, absoluteBound, 0.0, 0.0, true };
+    SweepFloats(lo, hi, sweep);
+    printf("  %-32s %10.3f max ULP error %10.3g max absolute error\n", label, sweep.mMaxUlp, sweep.mMaxAbsolute);
+    if (!sweep.mInBounds)
+    {
+        printf("  ERROR: %s is over its documented error!\n", label);
+    }
+    return sweep.mInBounds;
+}
+
+//! Checks the special cases of SimdPow against powf: signs of the negative bases, NaN and zero bases
+//! \return True when every case matches powf within 1e-5 relative error
+bool CheckPowSpecialCases()
+{
+    const float bases[] = { -2.0f, -1.5f, -1.0f, -0.5f, 0.0f, 0.5f, 2.0f };
+    const float exponents[] = { -3.0f, -2.0f, -0.5f, 0.0f, 0.5f, 1.0f, 2.0f, 2.2f, 3.0f, 16777215.0f, 3.0e7f };
+    bool success = true;
+    for (unsigned int b = 0; b < sizeof(bases) / sizeof(bases[0]); ++b)
+    {
+        for (unsigned int e = 0; e < sizeof(exponents) / sizeof(exponents[0]); ++e)
+        {
+            const float x = bases[b];
+            const float y = exponents[e];
+            if (x != -1.0f && fabsf(y) > 16.0f)
+            {
+                continue;
+            }
+            const float expected = powf(x, y);
+            const float result = Math::SimdGetX(Math::SimdPow(Math::SimdSet1(x), Math::SimdSet1(y)));
+            const bool match = (expected != expected) ? (result != result)
+                             : (fabsf(expected) > FLT_MAX) ? (result == expected)
+                             : (fabs(static_cast<double>(result) - expected) <= 1e-5 * fabs(static_cast<double>(expected)));
+            if (!match)
+            {
+                BenchmarkReportError("SimdPow(%g, %g) = %g, powf gives %g", x, y, result, expected);
+                success = false;
+            }
+        }
+    }
+    return success;
+}
+
+//! Inputs and results of the transcendental function benchmarks
+struct TranscendentalBenchmarkData
+{
+    float* mInputs;
+    float* mResults;
+
+    //! Inputs uniformly distributed in [lo, hi], or spread over the exponents of [lo, hi] when logarithmic
+    TranscendentalBenchmarkData(float lo, float hi, bool logarithmic)
+    {
+        Alloc::IAllocator* allocator = Memory::GetGlobalAllocator();
+        mInputs = PG_NEW_ARRAY(allocator, -1, "Benchmark transcendental inputs", Alloc::PG_MEM_TEMP, float, BENCHMARK_MATH_COUNT);
+        mResults = PG_NEW_ARRAY(allocator, -1, "Benchmark transcendental results", Alloc::PG_MEM_TEMP, float, BENCHMARK_MATH_COUNT);
+        unsigned int seed = 7654321u;
+        for (int i = 0; i < BENCHMARK_MATH_COUNT; ++i)
+        {
+            const float t = 0.5f * MathBenchmarkData::NextValue(seed) + 0.5f;
+            mInputs[i] = logarithmic ? lo * powf(hi / lo, t) : lo + (hi - lo) * t;
+        }
+    }
+
+    ~TranscendentalBenchmarkData()
+    {
+        Alloc::IAllocator* allocator = Memory::GetGlobalAllocator();
+        PG_DELETE_ARRAY(allocator, mInputs);
+        PG_DELETE_ARRAY(allocator, mResults);
+    }
+};
+
+template<class T>
+struct PreciseRun
+{
+    TranscendentalBenchmarkData* mData;
+    T mFunction;
+    void operator()()
+    {
+        for (int i = 0; i < BENCHMARK_MATH_COUNT; ++i)
+        {
+            mData->mResults[i] = mFunction.Precise(mData->mInputs[i]);
+        }
+    }
+};
+
+template<class T>
+struct FastRun
+{
+    TranscendentalBenchmarkData* mData;
+    T mFunction;
+    void operator()()
+    {
+        for (int i = 0; i < BENCHMARK_MATH_COUNT; ++i)
+        {
+            mData->mResults[i] = mFunction.Fast(mData->mInputs[i]);
+        }
+    }
+};
+
+template<class T>
+struct SimdRun
+{
+    TranscendentalBenchmarkData* mData;
+    T mFunction;
+    void operator()()
+    {
+        for (int i = 0; i < BENCHMARK_MATH_COUNT; i += Math::SIMD_WIDTH)
+        {
+            Math::SimdStoreU(mData->mResults + i, mFunction.Simd(Math::SimdLoadU(mData->mInputs + i)));
+        }
+    }
+};
+
+//! Times the precise, fast and 4-wide versions of a function over BENCHMARK_MATH_COUNT inputs of [lo, hi]
+template<class T>
+void RunTranscendentalBenchmark(const char* name, const T& function, float lo, float hi, bool logarithmic)
+{
+    TranscendentalBenchmarkData data(lo, hi, logarithmic);
+    PreciseRun<T> precise = { &data, function };
+    FastRun<T> fast = { &data, function };
+    SimdRun<T> simd = { &data, function };
+
+    const double preciseTime = BenchmarkMeasure(precise);
+    const double fastTime = BenchmarkMeasure(fast);
+    const double simdTime = BenchmarkMeasure(simd);
+
+    char label[64];
+    sprintf_s(label, sizeof(label), "%s, libm", name);
+    BenchmarkReport(label, preciseTime, BENCHMARK_MATH_COUNT);
+    sprintf_s(label, sizeof(label), "%s, fast scalar", name);
+    BenchmarkReport(label, fastTime, BENCHMARK_MATH_COUNT);
+    sprintf_s(label, sizeof(label), "%s, 4-wide", name);
+    BenchmarkReport(label, simdTime, BENCHMARK_MATH_COUNT);
+    BenchmarkReportSpeedup("Speedup of fast scalar", preciseTime, fastTime);
+    BenchmarkReportSpeedup("Speedup of 4-wide", preciseTime, simdTime);
+}
+
+}
+
+//----------------------------------------------------------------------------------------
+
+void BENCHMARK_MathAccuracy()
+{
+    printf("  SIMD path: %s%s%s\n",
+           PEGASUS_MATH_SIMD_SSE ? "SSE2" : "scalar fallback",
+           PEGASUS_MATH_SIMD_SSE41 ? ", SSE4.1" : "",
+           PEGASUS_MATH_SIMD_FMA ? ", FMA" : "");
+
+    MathBenchmarkData data;
+    Alloc::IAllocator* allocator = Memory::GetGlobalAllocator();
+    const int floatCount = BENCHMARK_MATH_COUNT * 16;
+    float* referenceResults = PG_NEW_ARRAY(allocator, -1, "Benchmark reference results", Alloc::PG_MEM_TEMP, float, floatCount);
+
+    bool success = true;
+    {
+        ReferenceMult44_41Run reference = { &data };
+        Mult44_41Run func = { &data };
+        success &= ReportAccuracy("Mult44_41", MeasureError(reference, func, data.mVectorResults[0].v, BENCHMARK_MATH_COUNT * 4, referenceResults));
+    }
+    {
+        ReferenceMult44T_41Run reference = { &data };
+        Mult44T_41Run func = { &data };
+        success &= ReportAccuracy("Mult44T_41", MeasureError(reference, func, data.mVectorResults[0].v, BENCHMARK_MATH_COUNT * 4, referenceResults));
+    }
+    {
+        ReferenceMult44_44Run reference = { &data };
+        Mult44_44Run func = { &data };
+        success &= ReportAccuracy("Mult44_44", MeasureError(reference, func, data.mMatrixResults[0].m, floatCount, referenceResults));
+    }
+    {
+        ReferenceQuaternionMultRun reference = { &data };
+        QuaternionMultRun func = { &data };
+        success &= ReportAccuracy("RightMult", MeasureError(reference, func, data.mQuaternionResults[0].q, BENCHMARK_MATH_COUNT * 4, referenceResults));
+    }
+    {
+        ReferenceRotateVectorRun reference = { &data };
+        RotateVectorRun func = { &data };
+        success &= ReportAccuracy("RotateVector", MeasureError(reference, func, data.mPointResults[0].v, BENCHMARK_MATH_COUNT * 3, referenceResults));
+    }
+
+    //the destination can be one of the operands
+    {
+        float maxError = 0.0f;
+        for (int i = 0; i < 1024; ++i)
+        {
+            Math::Vec4 expectedVec;
+            ReferenceMult44_41(expectedVec, data.mMatrices[i], data.mVectors[i]);
+            Math::Vec4 vec = data.mVectors[i];
+            Math::Mult44_41(vec, data.mMatrices[i], vec);
+            const float vecError = GetRelativeError(vec.v, expectedVec.v, 4);
+            maxError = vecError > maxError ? vecError : maxError;
+
+            Math::Mat44 expectedMat;
+            ReferenceMult44_44(expectedMat, data.mMatrices[i], data.mMatrices[i + 1]);
+            Math::Mat44 mat = data.mMatrices[i];
+            Math::Mult44_44(mat, mat, data.mMatrices[i + 1]);
+            const float matError = GetRelativeError(mat.m, expectedMat.m, 16);
+            maxError = matError > maxError ? matError : maxError;
+
+            Math::Quaternion expectedQuat(data.mQuaternions[i]);
+            ReferenceLeftMult(expectedQuat, data.mQuaternions[i]);
+            Math::Quaternion quat(data.mQuaternions[i]);
+            Math::LeftMult(quat, quat);
+            const float quatError = GetRelativeError(quat.q, expectedQuat.q, 4);
+            maxError = quatError > maxError ? quatError : maxError;
+        }
+        success &= ReportAccuracy("Operand as destination", maxError);
+    }
+
+    PG_DELETE_ARRAY(allocator, referenceResults);
+    if (success)
+    {
+        printf("  The results match the generic scalar code\n");
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void BENCHMARK_MathMult44_41()
+{
+    MathBenchmarkData data;
+    ReferenceMult44_41Run reference = { &data };
+    Mult44_41Run func = { &data };
+    RunMathBenchmark(reference, func);
+}
+
+//----------------------------------------------------------------------------------------
+
+void BENCHMARK_MathMult44T_41()
+{
+    MathBenchmarkData data;
+    ReferenceMult44T_41Run reference = { &data };
+    Mult44T_41Run func = { &data };
+    RunMathBenchmark(reference, func);
+}
+
+//----------------------------------------------------------------------------------------
+
+void BENCHMARK_MathMult44_44()
+{
+    MathBenchmarkData data;
+    ReferenceMult44_44Run reference = { &data };
+    Mult44_44Run func = { &data };
+    RunMathBenchmark(reference, func);
+}
+
+//----------------------------------------------------------------------------------------
+
+void BENCHMARK_MathQuaternionMult()
+{
+    MathBenchmarkData data;
+    ReferenceQuaternionMultRun reference = { &data };
+    QuaternionMultRun func = { &data };
+    RunMathBenchmark(reference, func);
+}
+
+//----------------------------------------------------------------------------------------
+
+void BENCHMARK_MathRotateVector()
+{
+    MathBenchmarkData data;
+    ReferenceRotateVectorRun reference = { &data };
+    RotateVectorRun func = { &data };
+    RunMathBenchmark(reference, func);
+}
+
+//----------------------------------------------------------------------------------------
+
+void BENCHMARK_MathTransformPoints()
+{
+    RunBatchBenchmark<ReferencePointsRun, BatchPointsRun>(3, "(points)");
+}
+
+//----------------------------------------------------------------------------------------
+
+void BENCHMARK_MathTransformNormals()
+{
+    RunBatchBenchmark<ReferenceNormalsRun, BatchNormalsRun>(3, "(normals)");
+}
+
+//----------------------------------------------------------------------------------------
+
+void BENCHMARK_MathTransformPointsSoa()
+{
+    RunBatchBenchmark<ReferencePointsSoaRun, BatchPointsSoaRun>(4, "(points)");
+}
+
+//----------------------------------------------------------------------------------------
+
+void BENCHMARK_MathTransformAabbs()
+{
+    RunBatchBenchmark<ReferenceAabbsRun, BatchAabbsRun>(6, "(boxes)");
+}
+
+//----------------------------------------------------------------------------------------
+
+void BENCHMARK_MathCullAabbs()
+{
+    RunCullBenchmark<ReferenceCullAabbsRun, BatchCullAabbsRun>(false, "(boxes)");
+}
+
+//----------------------------------------------------------------------------------------
+
+void BENCHMARK_MathCullSpheres()
+{
+    RunCullBenchmark<ReferenceCullSpheresRun, BatchCullSpheresRun>(true, "(spheres)");
+}
+
+//----------------------------------------------------------------------------------------
+
+void BENCHMARK_MathBvhBuild()
+{
+    const int sizeCount = sizeof(BENCHMARK_BVH_COUNTS) / sizeof(BENCHMARK_BVH_COUNTS[0]);
+    for (int s = 0; s < sizeCount; ++s)
+    {
+        BvhBenchmarkData data(BENCHMARK_BVH_COUNTS[s]);
+        BvhBuildRun build = { &data };
+        BvhRefitRun refit = { &data };
+
+        const double buildTime = BenchmarkMeasure(build);
+        const float buildCost = data.mBvh.GetCost();
+        const double refitTime = BenchmarkMeasure(refit);
+        printf("  %d nodes, SAH cost %.1f after the build, %.1f after the refits\n", data.mBvh.GetNodeCount(), buildCost, data.mBvh.GetCost());
+
+        char label[64];
+        sprintf_s(label, sizeof(label), "Build, %d boxes", data.mCount);
+        BenchmarkReport(label, buildTime, data.mCount);
+        sprintf_s(label, sizeof(label), "Refit, %d of %d boxes moved", (data.mCount + 9) / 10, data.mCount);
+        BenchmarkReport(label, refitTime, (data.mCount + 9) / 10);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Measures a query of the hierarchy against its per box loop, the elements being the boxes covered by the queries
+template<class R, class F>
+void RunBvhQueryBenchmark(BvhBenchmarkData& data, const char* name, int queryCount)
+{
+    R reference = { &data };
+    F func = { &data };
+    const double referenceTime = BenchmarkMeasure(reference);
+    const double time = BenchmarkMeasure(func);
+    char label[64];
+    sprintf_s(label, sizeof(label), "Per box %s, %d boxes", name, data.mCount);
+    BenchmarkReport(label, referenceTime, data.mCount * queryCount);
+    sprintf_s(label, sizeof(label), "Hierarchy %s, %d boxes", name, data.mCount);
+    BenchmarkReport(label, time, data.mCount * queryCount);
+    BenchmarkReportSpeedup("Speedup", referenceTime, time);
+}
+
+void BENCHMARK_MathBvhQueries()
+{
+    const int sizeCount = sizeof(BENCHMARK_BVH_COUNTS) / sizeof(BENCHMARK_BVH_COUNTS[0]);
+    for (int s = 0; s < sizeCount; ++s)
+    {
+        BvhBenchmarkData data(BENCHMARK_BVH_COUNTS[s]);
+        data.mBvh.Update();
+        CheckBvhQueries(data);
+
+        RunBvhQueryBenchmark<ReferenceBvhFrustumRun, BvhFrustumRun>(data, "frustum", 1);
+        RunBvhQueryBenchmark<ReferenceBvhOverlapRun, BvhOverlapRun>(data, "overlap", BENCHMARK_BVH_QUERY_COUNT);
+        RunBvhQueryBenchmark<ReferenceBvhRayRun, BvhRayRun>(data, "ray", BENCHMARK_BVH_QUERY_COUNT);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void BENCHMARK_MathTranscendentalAccuracy()
+{
+    // The bounds are the ones documented in Simd.h
+    SinFunction sinFunction;
+    CosFunction cosFunction;
+    ExpFunction expFunction;
+    LogFunction logFunction;
+
+    bool success = true;
+    success &= SweepAccuracy("Sin [-pi, pi]", sinFunction, -Math::P_PI, Math::P_PI, 3.0, 0.0, 0.0);
+    success &= SweepAccuracy("Sin [-100, 100]", sinFunction, -100.0f, 100.0f, 8.0, 0.0, 0.0);
+    success &= SweepAccuracy("Sin [-8192, 8192]", sinFunction, -8192.0f, 8192.0f, 0.0, 0.0, 1.5e-7);
+    success &= SweepAccuracy("Cos [-pi, pi]", cosFunction, -Math::P_PI, Math::P_PI, 3.0, 0.0, 0.0);
+    success &= SweepAccuracy("Cos [-100, 100]", cosFunction, -100.0f, 100.0f, 8.0, 0.0, 0.0);
+    success &= SweepAccuracy("Cos [-8192, 8192]", cosFunction, -8192.0f, 8192.0f, 0.0, 0.0, 1.5e-7);
+    success &= SweepAccuracy("Exp [-104, 89]", expFunction, -104.0f, 89.0f, 1.5, 0.0, 0.0);
+    success &= SweepAccuracy("Log [FLT_MIN, FLT_MAX]", logFunction, FLT_MIN, FLT_MAX, 1.0, 0.0, 0.0);
+
+    const float exponents[] = { -3.0f, 1.0f / 2.2f, 0.5f, 2.2f, 8.0f, 32.0f };
+    for (unsigned int e = 0; e < sizeof(exponents) / sizeof(exponents[0]); ++e)
+    {
+        const PowFunction powFunction = { exponents[e] };
+        char label[64];
+        sprintf_s(label, sizeof(label), "Pow [0.001, 1000]^%g", exponents[e]);
+        success &= SweepAccuracy(label, powFunction, 0.001f, 1000.0f, 2.0, 2.0 * fabs(exponents[e]), 0.0);
+    }
+    success &= CheckPowSpecialCases();
+
+    if (success)
+    {
+        printf("  The approximations are within their documented errors\n");
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void BENCHMARK_MathTranscendentals()
+{
+    SinFunction sinFunction;
+    CosFunction cosFunction;
+    ExpFunction expFunction;
+    LogFunction logFunction;
+    const PowFunction powFunction = { 2.2f };
+    RunTranscendentalBenchmark("Sin", sinFunction, -100.0f, 100.0f, false);
+    RunTranscendentalBenchmark("Cos", cosFunction, -100.0f, 100.0f, false);
+    RunTranscendentalBenchmark("Exp", expFunction, -80.0f, 80.0f, false);
+    RunTranscendentalBenchmark("Log", logFunction, 0.001f, 1000.0f, true);
+    RunTranscendentalBenchmark("Pow", powFunction, 0.001f, 1000.0f, true);
+}
@@ -0,0 +1,678 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Benchmarks                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MeshBenchmarks.cpp
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Pegasus benchmarks for the Mesh package, implementation.
+//!         The reference functions are the interleaved (array-of-structures) loops the mesh
+//!         operators used before moving to structure-of-arrays streams.
+
+#include "Pegasus/Benchmarks/Benchmarks.h"
+#include "Pegasus/Benchmarks/MeshBenchmarks.h"
+#include "Pegasus/Mesh/MeshData.h"
+#include "Pegasus/Mesh/MeshSoaKernels.h"
+#include "Pegasus/Mesh/MeshOptimizer.h"
+#include "Pegasus/Mesh/MeshSimplifier.h"
+#include "Pegasus/Utils/TesselationTable.h"
+#include "Pegasus/RenderSystems/Volumes/CaseTable.h"
+#include "Pegasus/RenderSystems/Volumes/MarchingCubes.h"
+#include "Pegasus/Core/ParallelFor.h"
+#include "Pegasus/Math/Quaternion.h"
+#include "Pegasus/Memory/MemoryManager.h"
+#include "Pegasus/Utils/Memcpy.h"
+#include <stdio.h>
+#include <math.h>
+
+using namespace Pegasus;
+using namespace Pegasus::Mesh;
+
+namespace
+{
+
+//! Vertex count of the benchmarked meshes
+const int BENCHMARK_VERTEX_COUNT = 1024 * 1024;
+
+//! Number of waves of the wave field benchmark, same as WaveFieldOperator
+const int BENCHMARK_WAVE_COUNT = 4;
+
+//! Source and destination vertices, in both layouts
+struct MeshBenchmarkData
+{
+    StdVertex* mAosSrc;
+    StdVertex* mAosDst;
+    float* mSoaSrc;
+    float* mSoaDst;
+    int mPitch;
+
+    MeshBenchmarkData()
+    {
+        Alloc::IAllocator* allocator = Memory::GetGlobalAllocator();
+        mPitch = (BENCHMARK_VERTEX_COUNT + 7) & ~7;
+        mAosSrc = PG_NEW_ARRAY(allocator, -1, "Benchmark AoS src", Alloc::PG_MEM_TEMP, StdVertex, BENCHMARK_VERTEX_COUNT);
+        mAosDst = PG_NEW_ARRAY(allocator, -1, "Benchmark AoS dst", Alloc::PG_MEM_TEMP, StdVertex, BENCHMARK_VERTEX_COUNT);
+        mSoaSrc = PG_NEW_ARRAY(allocator, -1, "Benchmark SoA src", Alloc::PG_MEM_TEMP, float, mPitch * STDVERTEX_SOA_COMPONENT_COUNT);
+        mSoaDst = PG_NEW_ARRAY(allocator, -1, "Benchmark SoA dst", Alloc::PG_MEM_TEMP, float, mPitch * STDVERTEX_SOA_COMPONENT_COUNT);
+
+        //deterministic pseudo random positions on a plane, unit normals
+        unsigned int seed = 1234567u;
+        for (int v = 0; v < BENCHMARK_VERTEX_COUNT; ++v)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            const float x = static_cast<float>(seed & 0xffff) / 65535.0f * 20.0f - 10.0f;
+            const float z = static_cast<float>(seed >> 16) / 65535.0f * 20.0f - 10.0f;
+            StdVertex& vert = mAosSrc[v];
+            vert.position = Math::Vec4(x, 0.0f, z, 1.0f);
+            vert.normal = Math::Vec3(0.0f, 1.0f, 0.0f);
+            vert.uv = Math::Vec2(x, z);
+
+            const float components[STDVERTEX_SOA_COMPONENT_COUNT] = {
+                vert.position.x, vert.position.y, vert.position.z, vert.position.w,
+                vert.normal.x, vert.normal.y, vert.normal.z,
+                vert.uv.x, vert.uv.y
+            };
+            for (int c = 0; c < STDVERTEX_SOA_COMPONENT_COUNT; ++c)
+            {
+                mSoaSrc[c * mPitch + v] = components[c];
+            }
+        }
+    }
+
+    ~MeshBenchmarkData()
+    {
+        Alloc::IAllocator* allocator = Memory::GetGlobalAllocator();
+        PG_DELETE_ARRAY(allocator, mAosSrc);
+        PG_DELETE_ARRAY(allocator, mAosDst);
+        PG_DELETE_ARRAY(allocator, mSoaSrc);
+        PG_DELETE_ARRAY(allocator, mSoaDst);
+    }
+};
+
+//! Builds the same kind of matrices CombineTransformOperator generates
+void BuildBenchmarkMatrices(Math::Mat44& posMat, Math::Mat33& normMat)
+{
+    Math::Quaternion q(Math::Vec3(0.3f, 0.8f, 0.1f), 0.7f);
+    Math::QuaternionToMat44(posMat, q);
+    Math::QuaternionToMat33(normMat, q);
+    posMat.m14 = 1.0f;
+    posMat.m24 = -2.0f;
+    posMat.m34 = 0.5f;
+    posMat.m44 = 1.0f;
+}
+
+//------------------------------------------------------------------------------------
+// Reference interleaved loops
+
+void ReferenceWaveField(const StdVertex* inputVertex, StdVertex* outputVertex, int count,
+                        const Math::Vec3& timeDir, const Math::Vec3& displacementDir, const Math::Vec3* waveParams)
+{
+    for (int v = 0; v < count; ++v)
+    {
+        const Math::Vec4& p4 = inputVertex[v].position;
+        Math::Vec3 p3(p4.x,p4.y,p4.z);
+
+        float t = Math::Dot(p3, timeDir);
+        float d = 0.0f;
+        for (int w = 0; w < BENCHMARK_WAVE_COUNT; ++w)
+        {
+            const Math::Vec3& wave = waveParams[w];
+            d += wave.y*(Math::Sin(t*wave.x + wave.z));
+        }
+
+        outputVertex[v].position = inputVertex[v].position + Math::Vec4(d*displacementDir,0.0f);
+        outputVertex[v].normal = inputVertex[v].normal;
+        outputVertex[v].uv = inputVertex[v].uv;
+    }
+}
+
+void ReferenceTransform(const StdVertex* input, StdVertex* outputDest, int count,
+                        const Math::Mat44& targetTransform, const Math::Mat33& targetNormalTransform, bool normalize)
+{
+    for (int v = 0; v < count; ++v)
+    {
+        Math::Mult44_41(outputDest[v].position, targetTransform, input[v].position);
+        Math::Mult33_31(outputDest[v].normal, targetNormalTransform, input[v].normal);
+        if (normalize)
+        {
+            float len = Math::Length(outputDest[v].normal);
+            if (Math::Abs(len) > PFLOAT_EPSILON)
+            {
+                outputDest[v].normal /= len;
+            }
+        }
+        outputDest[v].uv = input[v].uv;
+    }
+}
+
+//------------------------------------------------------------------------------------
+// Functors
+
+struct ReferenceWaveFieldRun
+{
+    MeshBenchmarkData* mData; Math::Vec3 mTimeDir; Math::Vec3 mDispDir; const Math::Vec3* mWaves;
+    void operator()() { ReferenceWaveField(mData->mAosSrc, mData->mAosDst, BENCHMARK_VERTEX_COUNT, mTimeDir, mDispDir, mWaves); }
+};
+
+struct SoaWaveFieldRun
+{
+    MeshBenchmarkData* mData; Math::Vec3 mTimeDir; Math::Vec3 mDispDir; const Math::Vec3* mWaves;
+    void operator()()
+    {
+        SoaWaveDisplaceStdVertices(mData->mSoaSrc, mData->mPitch, mData->mSoaDst, mData->mPitch, BENCHMARK_VERTEX_COUNT,
+                                   mTimeDir, mDispDir, mWaves, BENCHMARK_WAVE_COUNT, false);
+    }
+};
+
+struct ReferenceTransformRun
+{
+    MeshBenchmarkData* mData; Math::Mat44 mPosMat; Math::Mat33 mNormMat; bool mNormalize;
+    void operator()() { ReferenceTransform(mData->mAosSrc, mData->mAosDst, BENCHMARK_VERTEX_COUNT, mPosMat, mNormMat, mNormalize); }
+};
+
+struct SoaTransformRun
+{
+    MeshBenchmarkData* mData; Math::Mat44 mPosMat; Math::Mat33 mNormMat; bool mNormalize;
+    void operator()()
+    {
+        SoaTransformStdVertices(mData->mSoaSrc, mData->mPitch, mData->mSoaDst, mData->mPitch, BENCHMARK_VERTEX_COUNT,
+                                mPosMat, mNormMat, mNormalize);
+    }
+};
+
+//! Parallel wave field, same chunking as WaveFieldOperator
+struct ParallelWaveFieldRun
+{
+    MeshBenchmarkData* mData; Math::Vec3 mTimeDir; Math::Vec3 mDispDir; const Math::Vec3* mWaves;
+
+    void operator()(int begin, int end) const
+    {
+        SoaWaveDisplaceStdVertices(mData->mSoaSrc + begin, mData->mPitch, mData->mSoaDst + begin, mData->mPitch, end - begin,
+                                   mTimeDir, mDispDir, mWaves, BENCHMARK_WAVE_COUNT, false);
+    }
+
+    void operator()()
+    {
+        Core::ParallelFor(BENCHMARK_VERTEX_COUNT, MESH_PARALLEL_GRAIN_SIZE, *this);
+    }
+};
+
+void RunTransformBenchmark(bool normalize)
+{
+    MeshBenchmarkData data;
+    Math::Mat44 posMat;
+    Math::Mat33 normMat;
+    BuildBenchmarkMatrices(posMat, normMat);
+
+    ReferenceTransformRun reference = { &data, posMat, normMat, normalize };
+    SoaTransformRun soa = { &data, posMat, normMat, normalize };
+
+    const double referenceTime = BenchmarkMeasure(reference);
+    const double soaTime = BenchmarkMeasure(soa);
+    BenchmarkReport("Interleaved scalar", referenceTime, BENCHMARK_VERTEX_COUNT);
+    BenchmarkReport("SoA SIMD", soaTime, BENCHMARK_VERTEX_COUNT);
+    BenchmarkReportSpeedup("Speedup", referenceTime, soaTime);
+}
+
+//! Grid size of the optimize benchmark. Every triangle has its own 3 vertices, like an unwelded mesh
+const int BENCHMARK_OPTIMIZE_GRID_SIZE = 100;
+
+//! Unwelded grid with shuffled triangles, and the buffers of the optimization steps
+struct OptimizeBenchmarkData
+{
+    StdVertex* mVertices;
+    unsigned short* mIndices;
+    unsigned short* mWelded;
+    unsigned short* mOptimized;
+    int* mRemap;
+    int mVertexCount;
+    int mIndexCount;
+    int mOptimizedIndexCount;
+    int mOptimizedVertexCount;
+
+    OptimizeBenchmarkData()
+    {
+        Alloc::IAllocator* allocator = Memory::GetGlobalAllocator();
+        const int n = BENCHMARK_OPTIMIZE_GRID_SIZE;
+        const int triangleCount = n * n * 2;
+        mVertexCount = triangleCount * 3;
+        mIndexCount = triangleCount * 3;
+        mOptimizedIndexCount = 0;
+        mOptimizedVertexCount = 0;
+        mVertices = PG_NEW_ARRAY(allocator, -1, "Benchmark optimize vertices", Alloc::PG_MEM_TEMP, StdVertex, mVertexCount);
+        mIndices = PG_NEW_ARRAY(allocator, -1, "Benchmark optimize indices", Alloc::PG_MEM_TEMP, unsigned short, mIndexCount);
+        mWelded = PG_NEW_ARRAY(allocator, -1, "Benchmark optimize welded", Alloc::PG_MEM_TEMP, unsigned short, mIndexCount);
+        mOptimized = PG_NEW_ARRAY(allocator, -1, "Benchmark optimize optimized", Alloc::PG_MEM_TEMP, unsigned short, mIndexCount);
+        mRemap = PG_NEW_ARRAY(allocator, -1, "Benchmark optimize remap", Alloc::PG_MEM_TEMP, int, mVertexCount);
+
+        //deterministic shuffle of the grid cells
+        int* cells = PG_NEW_ARRAY(allocator, -1, "Benchmark optimize cells", Alloc::PG_MEM_TEMP, int, n * n);
+        unsigned int seed = 1234567u;
+        for (int c = 0; c < n * n; ++c)
+        {
+            cells[c] = c;
+        }
+        for (int c = n * n - 1; c > 0; --c)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            const int other = static_cast<int>((seed >> 8) % static_cast<unsigned int>(c + 1));
+            const int tmp = cells[c];
+            cells[c] = cells[other];
+            cells[other] = tmp;
+        }
+
+        int v = 0;
+        for (int c = 0; c < n * n; ++c)
+        {
+            const float x = static_cast<float>(cells[c] % n);
+            const float z = static_cast<float>(cells[c] / n);
+            const float corners[6][2] = {
+                { x, z }, { x + 1.0f, z }, { x, z + 1.0f },
+                { x + 1.0f, z }, { x + 1.0f, z + 1.0f }, { x, z + 1.0f }
+            };
+            for (int k = 0; k < 6; ++k, ++v)
+            {
+                StdVertex& vert = mVertices[v];
+                vert.position = Math::Vec4(corners[k][0], 0.0f, corners[k][1], 1.0f);
+                vert.normal = Math::Vec3(0.0f, 1.0f, 0.0f);
+                vert.uv = Math::Vec2(corners[k][0] / n, corners[k][1] / n);
+                mIndices[v] = static_cast<unsigned short>(v);
+            }
+        }
+
+        PG_DELETE_ARRAY(allocator, cells);
+    }
+
+    ~OptimizeBenchmarkData()
+    {
+        Alloc::IAllocator* allocator = Memory::GetGlobalAllocator();
+        PG_DELETE_ARRAY(allocator, mRemap);
+        PG_DELETE_ARRAY(allocator, mOptimized);
+        PG_DELETE_ARRAY(allocator, mWelded);
+        PG_DELETE_ARRAY(allocator, mIndices);
+        PG_DELETE_ARRAY(allocator, mVertices);
+    }
+};
+
+//! Same steps as the OptimizeOperator
+struct OptimizeRun
+{
+    OptimizeBenchmarkData* mData;
+
+    void operator()() const
+    {
+        Alloc::IAllocator* allocator = Memory::GetGlobalAllocator();
+        OptimizeBenchmarkData& d = *mData;
+        WeldStdVertices(d.mVertices, d.mVertexCount, 0.0001f, 0.001f, 0.0001f, d.mRemap, allocator);
+        for (int i = 0; i < d.mIndexCount; ++i)
+        {
+            d.mWelded[i] = static_cast<unsigned short>(d.mRemap[d.mIndices[i]]);
+        }
+        d.mOptimizedIndexCount = RemoveDegenerateTriangles(d.mWelded, d.mIndexCount);
+        OptimizeVertexCache(d.mWelded, d.mOptimizedIndexCount, d.mVertexCount, MESH_DEFAULT_VERTEX_CACHE_SIZE, d.mOptimized, allocator);
+        d.mOptimizedVertexCount = OptimizeVertexFetch(d.mOptimized, d.mOptimizedIndexCount, d.mVertexCount, d.mRemap);
+    }
+};
+
+//! Icosphere degrees of the simplify benchmark, same meaning as the IcosphereGenerator Degree property.
+//! Degree 7 is the last one fitting 16 bit indices
+const int BENCHMARK_SIMPLIFY_DEGREES[3] = { 5, 6, 7 };
+
+//! Levels of detail of the simplify benchmark, each one with half the triangles of the previous one
+const int BENCHMARK_SIMPLIFY_LOD_COUNT = 4;
+
+//! Icosphere with the subdivision of the IcosphereGenerator, and the results of the simplification
+struct SimplifyBenchmarkData
+{
+    StdVertex* mVertices;
+    unsigned short* mIndices;
+    int mVertexCount;
+    int mIndexCount;
+    int mLodIndexCounts[BENCHMARK_SIMPLIFY_LOD_COUNT];
+    float mLodErrors[BENCHMARK_SIMPLIFY_LOD_COUNT];
+
+    explicit SimplifyBenchmarkData(int degree)
+    {
+        Alloc::IAllocator* allocator = Memory::GetGlobalAllocator();
+        const int triangleCount = 20 << (2 * (degree - 1));
+        const int maxVertexCount = triangleCount / 2 + 2;
+        mVertices = PG_NEW_ARRAY(allocator, -1, "Benchmark simplify vertices", Alloc::PG_MEM_TEMP, StdVertex, maxVertexCount);
+        mIndices = PG_NEW_ARRAY(allocator, -1, "Benchmark simplify indices", Alloc::PG_MEM_TEMP, unsigned short, triangleCount * 3);
+        unsigned short* temp = PG_NEW_ARRAY(allocator, -1, "Benchmark simplify temp", Alloc::PG_MEM_TEMP, unsigned short, triangleCount * 3);
+
+        static const float g = (1.0f + 2.2360679775f) / 2.0f;
+        static const float icosahedron[] = {
+            -g, 1, 0,   g, 1, 0,   -g, -1, 0,   g, -1, 0,
+            -1, 0, -g,  -1, 0, g,  1, 0, -g,    1, 0, g,
+            0, g, 1,    0, -g, 1,  0, g, -1,    0, -g, -1
+        };
+        static const unsigned short icotriangles[] = {
+            1, 6, 3,   1, 3, 7,   1, 10, 6,  1, 7, 8,   1, 8, 10,
+            3, 6, 11,  3, 9, 7,   3, 11, 9,  0, 2, 4,   0, 5, 2,
+            0, 10, 8,  0, 4, 10,  0, 8, 5,   2, 11, 4,  2, 5, 9,
+            2, 9, 11,  10, 4, 6,  4, 11, 6,  8, 7, 5,   7, 9, 5
+        };
+
+        mVertexCount = 0;
+        for (int v = 0; v < 12; ++v)
+        {
+            AddVertex(Math::Vec3(icosahedron[v * 3], icosahedron[v * 3 + 1], icosahedron[v * 3 + 2]));
+        }
+        mIndexCount = 60;
+        Utils::Memcpy(mIndices, icotriangles, sizeof(icotriangles));
+
+        //every level splits each triangle in 4, the midpoints are shared through the table
+        Utils::TesselationTable midpoints(allocator, sizeof(unsigned short));
+        for (int level = 1; level < degree; ++level)
+        {
+            int outputCount = 0;
+            for (int i = 0; i < mIndexCount; i += 3)
+            {
+                const unsigned short a = mIndices[i];
+                const unsigned short b = mIndices[i + 1];
+                const unsigned short c = mIndices[i + 2];
+                const unsigned short ab = GetMidpoint(midpoints, a, b);
+                const unsigned short bc = GetMidpoint(midpoints, b, c);
+                const unsigned short ca = GetMidpoint(midpoints, c, a);
+                const unsigned short children[12] = { a, ab, ca,  ab, b, bc,  bc, c, ca,  ab, bc, ca };
+                Utils::Memcpy(temp + outputCount, children, sizeof(children));
+                outputCount += 12;
+            }
+            mIndexCount = outputCount;
+            Utils::Memcpy(mIndices, temp, mIndexCount * sizeof(unsigned short));
+        }
+
+        PG_DELETE_ARRAY(allocator, temp);
+    }
+
+    ~SimplifyBenchmarkData()
+    {
+        Alloc::IAllocator* allocator = Memory::GetGlobalAllocator();
+        PG_DELETE_ARRAY(allocator, mIndices);
+        PG_DELETE_ARRAY(allocator, mVertices);
+    }
+
+    unsigned short AddVertex(const Math::Vec3& p)
+    {
+        Math::Vec3 n = p;
+        Math::Normalize(n);
+        StdVertex& vert = mVertices[mVertexCount];
+        vert.position = Math::Vec4(n, 1.0f);
+        vert.normal = n;
+        vert.uv = Math::Vec2(0.0f, 0.0f);
+        return static_cast<unsigned short>(mVertexCount++);
+    }
+
+    //! the table starts filled with 0, the stored indices are offset by 1
+    unsigned short GetMidpoint(Utils::TesselationTable& midpoints, unsigned short a, unsigned short b)
+    {
+        unsigned short midpoint = 0;
+        midpoints.Get(a, b, midpoint);
+        if (midpoint == 0)
+        {
+            const Math::Vec4 p = (mVertices[a].position + mVertices[b].position) * 0.5f;
+            midpoint = AddVertex(Math::Vec3(p.x, p.y, p.z)) + 1;
+            midpoints.Insert(a, b, midpoint);
+        }
+        return midpoint - 1;
+    }
+};
+
+//! Same steps as the LodOperator, without the per level vertex cache optimization
+struct SimplifyRun
+{
+    SimplifyBenchmarkData* mData;
+
+    void operator()() const
+    {
+        SimplifyBenchmarkData& d = *mData;
+        MeshSimplifier simplifier(Memory::GetGlobalAllocator());
+        simplifier.Initialize(d.mVertices, d.mVertexCount, d.mIndices, d.mIndexCount);
+        d.mLodIndexCounts[0] = simplifier.GetIndexCount();
+        d.mLodErrors[0] = 0.0f;
+        for (int lod = 1; lod < BENCHMARK_SIMPLIFY_LOD_COUNT; ++lod)
+        {
+            d.mLodIndexCounts[lod] = simplifier.Simplify((d.mLodIndexCounts[lod - 1] / 6) * 3);
+            d.mLodErrors[lod] = simplifier.GetError();
+        }
+    }
+};
+
+#if RENDER_SYSTEM_CONFIG_ENABLE_VOLUMES
+
+//! Samples per side of the polygonized density grid
+const int BENCHMARK_DENSITY_DIM = 96;
+
+//! Bumpy sphere density field, the surface stays under the 16 bit index limit
+struct MarchingCubesBenchmarkData
+{
+    float* mSamples;
+    RenderSystems::CaseTable mCaseTable;
+    MeshDataRef mMeshData;
+
+    MarchingCubesBenchmarkData()
+    {
+        Alloc::IAllocator* allocator = Memory::GetGlobalAllocator();
+        const int sampleCount = BENCHMARK_DENSITY_DIM * BENCHMARK_DENSITY_DIM * BENCHMARK_DENSITY_DIM;
+        mSamples = PG_NEW_ARRAY(allocator, -1, "Benchmark density", Alloc::PG_MEM_TEMP, float, sampleCount);
+
+        const float center = static_cast<float>(BENCHMARK_DENSITY_DIM - 1) * 0.5f;
+        const float radius = center * 0.75f;
+        for (int z = 0; z < BENCHMARK_DENSITY_DIM; ++z)
+        {
+            for (int y = 0; y < BENCHMARK_DENSITY_DIM; ++y)
+            {
+                for (int x = 0; x < BENCHMARK_DENSITY_DIM; ++x)
+                {
+                    const float dx = static_cast<float>(x) - center;
+                    const float dy = static_cast<float>(y) - center;
+                    const float dz = static_cast<float>(z) - center;
+                    const float bumps = 1.5f * sinf(dx * 0.4f) * sinf(dy * 0.4f) * sinf(dz * 0.4f);
+                    mSamples[(z * BENCHMARK_DENSITY_DIM + y) * BENCHMARK_DENSITY_DIM + x] = radius + bumps - sqrtf(dx * dx + dy * dy + dz * dz);
+                }
+            }
+        }
+
+        mCaseTable.Initialize();
+
+        MeshConfiguration configuration;
+        MeshInputLayout layout;
+        layout.GenerateEditorLayout(MeshInputLayout::USE_POSITION | MeshInputLayout::USE_UV | MeshInputLayout::USE_NORMAL);
+        configuration.SetInputLayout(layout);
+        mMeshData = PG_NEW(allocator, -1, "Benchmark marching cubes mesh", Alloc::PG_MEM_TEMP) MeshData(configuration, Graph::Node::STANDARD, allocator);
+    }
+
+    ~MarchingCubesBenchmarkData()
+    {
+        PG_DELETE_ARRAY(Memory::GetGlobalAllocator(), mSamples);
+    }
+};
+
+//! Same call as the DensityMeshGenerator
+struct MarchingCubesRun
+{
+    MarchingCubesBenchmarkData* mData;
+
+    void operator()() const
+    {
+        RenderSystems::DensityGrid grid = { mData->mSamples, BENCHMARK_DENSITY_DIM, BENCHMARK_DENSITY_DIM, BENCHMARK_DENSITY_DIM };
+        RenderSystems::PolygonizeDensityGrid(mData->mCaseTable, grid, 0.0f, Math::Vec3(0.0f, 0.0f, 0.0f), 1.0f, &(*mData->mMeshData), Memory::GetGlobalAllocator());
+    }
+};
+
+#endif
+
+}
+
+//----------------------------------------------------------------------------------------
+
+void BENCHMARK_MeshWaveField()
+{
+    MeshBenchmarkData data;
+    const Math::Vec3 waves[BENCHMARK_WAVE_COUNT] = {
+        Math::Vec3(1.0f, 0.5f, 0.0f),
+        Math::Vec3(2.3f, 0.25f, 1.0f),
+        Math::Vec3(4.1f, 0.125f, 2.0f),
+        Math::Vec3(7.9f, 0.0625f, 3.0f)
+    };
+    const Math::Vec3 timeDir(0.0f, 0.0f, 1.0f);
+    const Math::Vec3 dispDir(0.0f, 1.0f, 0.0f);
+
+    ReferenceWaveFieldRun reference = { &data, timeDir, dispDir, waves };
+    SoaWaveFieldRun soa = { &data, timeDir, dispDir, waves };
+
+    const double referenceTime = BenchmarkMeasure(reference);
+    const double soaTime = BenchmarkMeasure(soa);
+    BenchmarkReport("Interleaved scalar", referenceTime, BENCHMARK_VERTEX_COUNT);
+    BenchmarkReport("SoA SIMD", soaTime, BENCHMARK_VERTEX_COUNT);
+    BenchmarkReportSpeedup("Speedup", referenceTime, soaTime);
+}
+
+void BENCHMARK_MeshParallelScaling()
+{
+    MeshBenchmarkData data;
+    const Math::Vec3 waves[BENCHMARK_WAVE_COUNT] = {
+        Math::Vec3(1.0f, 0.5f, 0.0f),
+        Math::Vec3(2.3f, 0.25f, 1.0f),
+        Math::Vec3(4.1f, 0.125f, 2.0f),
+        Math::Vec3(7.9f, 0.0625f, 3.0f)
+    };
+    ParallelWaveFieldRun run = { &data, Math::Vec3(0.0f, 0.0f, 1.0f), Math::Vec3(0.0f, 1.0f, 0.0f), waves };
+
+    //single thread result, every other thread count has to match it exactly
+    const int floatCount = data.mPitch * STDVERTEX_SOA_COMPONENT_COUNT;
+    float* expected = PG_NEW_ARRAY(Memory::GetGlobalAllocator(), -1, "Benchmark expected", Alloc::PG_MEM_TEMP, float, floatCount);
+
+    double singleThreadTime = 0.0;
+    for (int threads = 1; threads <= Core::GetParallelForThreadCount(); ++threads)
+    {
+        Core::SetParallelForThreadLimit(threads);
+        const double time = BenchmarkMeasure(run);
+
+        char label[64];
+        sprintf_s(label, sizeof(label), "Wave field, %d thread(s)", threads);
+        BenchmarkReport(label, time, BENCHMARK_VERTEX_COUNT);
+        if (threads == 1)
+        {
+            singleThreadTime = time;
+            Utils::Memcpy(expected, data.mSoaDst, floatCount * sizeof(float));
+        }
+        else
+        {
+            BenchmarkReportSpeedup("Speedup", singleThreadTime, time);
+            bool match = true;
+            for (int f = 0; match && f < floatCount; ++f)
+            {
+                match = expected[f] == data.mSoaDst[f];
+            }
+
+            if (!match)
+            {
+                printf("  ERROR: result differs from the single thread result!\n");
+            }
+        }
+    }
+    Core::SetParallelForThreadLimit(0);
+
+    PG_DELETE_ARRAY(Memory::GetGlobalAllocator(), expected);
+}
+
+void BENCHMARK_MeshTransform()
+{
+    RunTransformBenchmark(false);
+}
+
+void BENCHMARK_MeshTransformNormalize()
+{
+    RunTransformBenchmark(true);
+}
+
+void BENCHMARK_MeshOptimize()
+{
+    OptimizeBenchmarkData data;
+    OptimizeRun run = { &data };
+
+    const double time = BenchmarkMeasure(run);
+    BenchmarkReport("Weld + vertex cache + vertex fetch", time, data.mIndexCount / 3);
+
+    Alloc::IAllocator* allocator = Memory::GetGlobalAllocator();
+    const float acmrBefore = ComputeAcmr(data.mIndices, data.mIndexCount, data.mVertexCount, MESH_DEFAULT_VERTEX_CACHE_SIZE, allocator);
+    const float acmrAfter = ComputeAcmr(data.mOptimized, data.mOptimizedIndexCount, data.mOptimizedVertexCount, MESH_DEFAULT_VERTEX_CACHE_SIZE, allocator);
+    printf("  Vertices %d -> %d, triangles %d -> %d\n", data.mVertexCount, data.mOptimizedVertexCount, data.mIndexCount / 3, data.mOptimizedIndexCount / 3);
+    printf("  ACMR %.3f -> %.3f\n", acmrBefore, acmrAfter);
+
+    const int gridVertexCount = (BENCHMARK_OPTIMIZE_GRID_SIZE + 1) * (BENCHMARK_OPTIMIZE_GRID_SIZE + 1);
+    if (data.mOptimizedVertexCount != gridVertexCount || data.mOptimizedIndexCount != data.mIndexCount)
+    {
+        printf("  ERROR: expected %d welded vertices and no triangle removed!\n", gridVertexCount);
+    }
+}
+
+void BENCHMARK_MeshMarchingCubes()
+{
+#if RENDER_SYSTEM_CONFIG_ENABLE_VOLUMES
+    MarchingCubesBenchmarkData data;
+    MarchingCubesRun run = { &data };
+
+    double singleThreadTime = 0.0;
+    int singleThreadIndexCount = 0;
+    const int threadCounts[2] = { 1, Core::GetParallelForThreadCount() };
+    for (int i = 0; i < 2; ++i)
+    {
+        Core::SetParallelForThreadLimit(threadCounts[i]);
+        const double time = BenchmarkMeasure(run);
+        const int triangleCount = data.mMeshData->GetIndexCount() / 3;
+
+        char label[64];
+        sprintf_s(label, sizeof(label), "Marching cubes %d^3, %d thread(s)", BENCHMARK_DENSITY_DIM, threadCounts[i]);
+        BenchmarkReport(label, time, triangleCount);
+        printf("  %d vertices, %d triangles, %.2f M triangles/s\n", data.mMeshData->GetVertexCount(), triangleCount,
+               time > 0.0 ? static_cast<double>(triangleCount) / time / 1000000.0 : 0.0);
+
+        if (i == 0)
+        {
+            singleThreadTime = time;
+            singleThreadIndexCount = data.mMeshData->GetIndexCount();
+        }
+        else
+        {
+            BenchmarkReportSpeedup("Speedup", singleThreadTime, time);
+            if (data.mMeshData->GetIndexCount() != singleThreadIndexCount)
+            {
+                printf("  ERROR: result differs from the single thread result!\n");
+            }
+        }
+    }
+    Core::SetParallelForThreadLimit(0);
+#else
+    printf("  Volumes render system disabled, skipped.\n");
+#endif
+}
+
+void BENCHMARK_MeshSimplify()
+{
+    for (int i = 0; i < 3; ++i)
+    {
+        SimplifyBenchmarkData data(BENCHMARK_SIMPLIFY_DEGREES[i]);
+        SimplifyRun run = { &data };
+        const double time = BenchmarkMeasure(run);
+
+        char label[64];
+        sprintf_s(label, sizeof(label), "Icosphere degree %d, %d levels", BENCHMARK_SIMPLIFY_DEGREES[i], BENCHMARK_SIMPLIFY_LOD_COUNT);
+        BenchmarkReport(label, time, data.mIndexCount / 3);
+        printf("  %d vertices, %.2f M input triangles/s\n", data.mVertexCount,
+               time > 0.0 ? static_cast<double>(data.mIndexCount / 3) / time / 1000000.0 : 0.0);
+        for (int lod = 0; lod < BENCHMARK_SIMPLIFY_LOD_COUNT; ++lod)
+        {
+            printf("  LOD %d: %d triangles, error %.5f\n", lod, data.mLodIndexCounts[lod] / 3, data.mLodErrors[lod]);
+        }
+
+        const int lastTarget = (data.mIndexCount / 3) >> (BENCHMARK_SIMPLIFY_LOD_COUNT - 1);
+        if (data.mLodIndexCounts[BENCHMARK_SIMPLIFY_LOD_COUNT - 1] / 3 > lastTarget)
+        {
+            printf("  ERROR: the last level did not reach %d triangles!\n", lastTarget);
+        }
+    }
+}
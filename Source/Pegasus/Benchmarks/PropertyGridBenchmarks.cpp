@@ -0,0 +1,715 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Benchmarks                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   PropertyGridBenchmarks.cpp
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Pegasus benchmarks for the PropertyGrid package, implementation.
+//!         The reference load looks up the name of every property in the asset object,
+//!         the reference layout match compares every property name with every layout name,
+//!         and the reference writes send one change event per write.
+
+#include "Pegasus/Benchmarks/Benchmarks.h"
+#include "Pegasus/Benchmarks/PropertyGridBenchmarks.h"
+#include "Pegasus/PropertyGrid/PropertyGridObject.h"
+#include "Pegasus/AssetLib/AssetLib.h"
+#include "Pegasus/AssetLib/Asset.h"
+#include "Pegasus/AssetLib/ASTree.h"
+#include "Pegasus/Core/Io.h"
+#include "Pegasus/Math/Vector.h"
+#include "Pegasus/Math/Color.h"
+#include "Pegasus/Memory/MemoryManager.h"
+#include "Pegasus/Utils/Memcpy.h"
+#include "Pegasus/Utils/Memset.h"
+#include "Pegasus/Utils/String.h"
+#include <stdio.h>
+
+using namespace Pegasus;
+using namespace Pegasus::PropertyGrid;
+using namespace Pegasus::AssetLib;
+
+//! Node of the benchmarked graph, with as many properties as a large generator or timeline block
+class BenchmarkPropertyNode : public PropertyGridObject
+{
+    BEGIN_DECLARE_PROPERTIES_BASE(BenchmarkPropertyNode)
+        DECLARE_PROPERTY(bool, Enable, true)
+        DECLARE_PROPERTY(bool, Visible, true)
+        DECLARE_PROPERTY(unsigned int, Seed, 0)
+        DECLARE_PROPERTY(unsigned int, Layer, 0)
+        DECLARE_PROPERTY(int, Count, 1)
+        DECLARE_PROPERTY(int, Offset, 0)
+        DECLARE_PROPERTY(int, Steps, 8)
+        DECLARE_PROPERTY(int, Priority, 0)
+        DECLARE_PROPERTY(float, Speed, 1.0f)
+        DECLARE_PROPERTY(float, Scale, 1.0f)
+        DECLARE_PROPERTY(float, Intensity, 1.0f)
+        DECLARE_PROPERTY(float, Radius, 1.0f)
+        DECLARE_PROPERTY(float, Phase, 0.0f)
+        DECLARE_PROPERTY(float, Frequency, 1.0f)
+        DECLARE_PROPERTY(float, Amplitude, 1.0f)
+        DECLARE_PROPERTY(float, Falloff, 0.5f)
+        DECLARE_PROPERTY(Math::Vec3, Origin, Math::Vec3(0.0f, 0.0f, 0.0f))
+        DECLARE_PROPERTY(Math::Vec3, Direction, Math::Vec3(0.0f, 0.0f, 1.0f))
+        DECLARE_PROPERTY(Math::Vec3, Extent, Math::Vec3(1.0f, 1.0f, 1.0f))
+        DECLARE_PROPERTY(Math::Vec2, Uv0, Math::Vec2(0.0f, 0.0f))
+        DECLARE_PROPERTY(Math::Vec2, Uv1, Math::Vec2(1.0f, 1.0f))
+        DECLARE_PROPERTY(Math::Vec4, Rotation, Math::Vec4(0.0f, 0.0f, 0.0f, 1.0f))
+        DECLARE_PROPERTY(Math::Vec4, Params, Math::Vec4(0.0f, 0.0f, 0.0f, 0.0f))
+        DECLARE_PROPERTY(Math::Color8RGB, Tint, Math::Color8RGB(255, 255, 255))
+        DECLARE_PROPERTY(Math::Color8RGB, Ambient, Math::Color8RGB(0, 0, 0))
+        DECLARE_PROPERTY(Math::Color8RGBA, Diffuse, Math::Color8RGBA(255, 255, 255, 255))
+        DECLARE_PROPERTY(Math::Color8RGBA, Specular, Math::Color8RGBA(255, 255, 255, 255))
+        DECLARE_PROPERTY(String64, Script, "")
+        DECLARE_PROPERTY(String64, Texture, "")
+    END_DECLARE_PROPERTIES()
+
+public:
+    BenchmarkPropertyNode();
+    virtual ~BenchmarkPropertyNode() {}
+};
+
+BEGIN_IMPLEMENT_PROPERTIES(BenchmarkPropertyNode)
+    IMPLEMENT_PROPERTY(BenchmarkPropertyNode, Enable)
+    IMPLEMENT_PROPERTY(BenchmarkPropertyNode, Visible)
+    IMPLEMENT_PROPERTY(BenchmarkPropertyNode, Seed)
+    IMPLEMENT_PROPERTY(BenchmarkPropertyNode, Layer)
+    IMPLEMENT_PROPERTY(BenchmarkPropertyNode, Count)
+    IMPLEMENT_PROPERTY(BenchmarkPropertyNode, Offset)
+    IMPLEMENT_PROPERTY(BenchmarkPropertyNode, Steps)
+    IMPLEMENT_PROPERTY(BenchmarkPropertyNode, Priority)
+    IMPLEMENT_PROPERTY(BenchmarkPropertyNode, Speed)
+    IMPLEMENT_PROPERTY(BenchmarkPropertyNode, Scale)
+    IMPLEMENT_PROPERTY(BenchmarkPropertyNode, Intensity)
+    IMPLEMENT_PROPERTY(BenchmarkPropertyNode, Radius)
+    IMPLEMENT_PROPERTY(BenchmarkPropertyNode, Phase)
+    IMPLEMENT_PROPERTY(BenchmarkPropertyNode, Frequency)
+    IMPLEMENT_PROPERTY(BenchmarkPropertyNode, Amplitude)
+    IMPLEMENT_PROPERTY(BenchmarkPropertyNode, Falloff)
+    IMPLEMENT_PROPERTY(BenchmarkPropertyNode, Origin)
+    IMPLEMENT_PROPERTY(BenchmarkPropertyNode, Direction)
+    IMPLEMENT_PROPERTY(BenchmarkPropertyNode, Extent)
+    IMPLEMENT_PROPERTY(BenchmarkPropertyNode, Uv0)
+    IMPLEMENT_PROPERTY(BenchmarkPropertyNode, Uv1)
+    IMPLEMENT_PROPERTY(BenchmarkPropertyNode, Rotation)
+    IMPLEMENT_PROPERTY(BenchmarkPropertyNode, Params)
+    IMPLEMENT_PROPERTY(BenchmarkPropertyNode, Tint)
+    IMPLEMENT_PROPERTY(BenchmarkPropertyNode, Ambient)
+    IMPLEMENT_PROPERTY(BenchmarkPropertyNode, Diffuse)
+    IMPLEMENT_PROPERTY(BenchmarkPropertyNode, Specular)
+    IMPLEMENT_PROPERTY(BenchmarkPropertyNode, Script)
+    IMPLEMENT_PROPERTY(BenchmarkPropertyNode, Texture)
+END_IMPLEMENT_PROPERTIES(BenchmarkPropertyNode)
+
+BenchmarkPropertyNode::BenchmarkPropertyNode()
+{
+    BEGIN_INIT_PROPERTIES(BenchmarkPropertyNode)
+        INIT_PROPERTY(Enable)
+        INIT_PROPERTY(Visible)
+        INIT_PROPERTY(Seed)
+        INIT_PROPERTY(Layer)
+        INIT_PROPERTY(Count)
+        INIT_PROPERTY(Offset)
+        INIT_PROPERTY(Steps)
+        INIT_PROPERTY(Priority)
+        INIT_PROPERTY(Speed)
+        INIT_PROPERTY(Scale)
+        INIT_PROPERTY(Intensity)
+        INIT_PROPERTY(Radius)
+        INIT_PROPERTY(Phase)
+        INIT_PROPERTY(Frequency)
+        INIT_PROPERTY(Amplitude)
+        INIT_PROPERTY(Falloff)
+        INIT_PROPERTY(Origin)
+        INIT_PROPERTY(Direction)
+        INIT_PROPERTY(Extent)
+        INIT_PROPERTY(Uv0)
+        INIT_PROPERTY(Uv1)
+        INIT_PROPERTY(Rotation)
+        INIT_PROPERTY(Params)
+        INIT_PROPERTY(Tint)
+        INIT_PROPERTY(Ambient)
+        INIT_PROPERTY(Diffuse)
+        INIT_PROPERTY(Specular)
+        INIT_PROPERTY(Script)
+        INIT_PROPERTY(Texture)
+    END_INIT_PROPERTIES()
+}
+
+namespace
+{
+
+//! Nodes of the benchmarked graph
+const int BENCHMARK_GRAPH_NODE_COUNT = 4096;
+
+//! Names of a render collection layout that no node property has, matched along with the node properties
+const int BENCHMARK_LAYOUT_MISSING_COUNT = 8;
+
+//! Largest layout matched against the nodes
+const int BENCHMARK_LAYOUT_MAX_SIZE = 64;
+
+//! Nodes written by the script of the batched writes, properties written per node, and writes per property and frame
+const int BENCHMARK_WRITE_NODE_COUNT = 1024;
+const int BENCHMARK_WRITE_PROPERTY_COUNT = 8;
+const int BENCHMARK_WRITES_PER_PROPERTY = 4;
+const int BENCHMARK_WRITE_FRAME_COUNT = 16;
+
+//! \return the next value of a linear congruential sequence
+inline unsigned int NextRandom(unsigned int& seed)
+{
+    seed = seed * 1664525u + 1013904223u;
+    return seed;
+}
+
+//! Sets a property to a value derived from a random sequence.
+//! Floats are multiples of 1/64, so every value is stored exactly in the asset.
+void RandomizeProperty(const PropertyRecord& r, PropertyAccessor a, unsigned int& seed)
+{
+    switch (r.type)
+    {
+    case PROPERTYTYPE_BOOL:
+        a.Set<bool>(((NextRandom(seed) >> 9) & 1) != 0);
+        break;
+    case PROPERTYTYPE_INT:
+        a.Set<int>(static_cast<int>(NextRandom(seed) >> 8) - 0x400000);
+        break;
+    case PROPERTYTYPE_UINT:
+        a.Set<unsigned int>(NextRandom(seed) >> 4);
+        break;
+    case PROPERTYTYPE_FLOAT:
+        a.Set<float>(static_cast<float>((NextRandom(seed) >> 12) & 1023) / 64.0f);
+        break;
+    case PROPERTYTYPE_VEC2:
+    case PROPERTYTYPE_VEC3:
+    case PROPERTYTYPE_VEC4:
+        {
+            Math::Vec4 v;
+            for (int c = 0; c < 4; ++c)
+            {
+                v.v[c] = -static_cast<float>((NextRandom(seed) >> 12) & 1023) / 64.0f;
+            }
+            a.Write(&v, r.size);
+        }
+        break;
+    case PROPERTYTYPE_COLOR8RGB:
+    case PROPERTYTYPE_COLOR8RGBA:
+        {
+            Math::Color8RGBA color;
+            for (int c = 0; c < 4; ++c)
+            {
+                color.v[c] = static_cast<unsigned char>(NextRandom(seed) >> 16);
+            }
+            a.Write(&color, r.size);
+        }
+        break;
+    case PROPERTYTYPE_STRING64:
+        {
+            char str64[64];
+            Utils::Memset8(str64, 0, sizeof(str64));
+            sprintf_s(str64, sizeof(str64), "Textures/Node_%u.pas", NextRandom(seed) >> 16);
+            a.Write(str64, sizeof(str64));
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+//! Reference read of one property: the name of the property is looked up in the block of its type
+void ReferenceReadProperty(const PropertyRecord& r, PropertyAccessor a, const Object* obj)
+{
+    switch (r.type)
+    {
+    case PROPERTYTYPE_BOOL:
+    case PROPERTYTYPE_INT:
+    case PROPERTYTYPE_UINT:
+        {
+            const int index = obj->FindInt(r.name);
+            if (index == -1) return;
+            if (r.type == PROPERTYTYPE_BOOL)
+            {
+                a.Set<bool>(obj->GetInt(index) != 0);
+            }
+            else
+            {
+                a.Set<int>(obj->GetInt(index));
+            }
+        }
+        break;
+    case PROPERTYTYPE_FLOAT:
+        {
+            const int index = obj->FindFloat(r.name);
+            if (index == -1) return;
+            a.Set<float>(obj->GetFloat(index));
+        }
+        break;
+    case PROPERTYTYPE_VEC2:
+    case PROPERTYTYPE_VEC3:
+    case PROPERTYTYPE_VEC4:
+    case PROPERTYTYPE_COLOR8RGB:
+    case PROPERTYTYPE_COLOR8RGBA:
+        {
+            const int index = obj->FindArray(r.name);
+            if (index == -1) return;
+            const Array* arr = obj->GetArray(index);
+            const bool isColor = r.type == PROPERTYTYPE_COLOR8RGB || r.type == PROPERTYTYPE_COLOR8RGBA;
+            Math::Vec4 v;
+            Math::Color8RGBA color;
+            for (int c = 0; c < arr->GetSize() && c < 4; ++c)
+            {
+                if (isColor)
+                {
+                    color.v[c] = static_cast<unsigned char>(arr->GetElement(c).i);
+                }
+                else
+                {
+                    v.v[c] = arr->GetElement(c).f;
+                }
+            }
+            if (isColor)
+            {
+                a.Write(&color, r.size);
+            }
+            else
+            {
+                a.Write(&v, r.size);
+            }
+        }
+        break;
+    case PROPERTYTYPE_STRING64:
+        {
+            const int index = obj->FindString(r.name);
+            if (index == -1) return;
+            const char* str = obj->GetString(index);
+            const int len = Utils::Strlen(str);
+            if (len < 64)
+            {
+                char str64[64];
+                Utils::Memset8(str64, 0, sizeof(str64));
+                Utils::Memcpy(str64, str, len + 1);
+                a.Write(str64, sizeof(str64));
+            }
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+//! Reference read of a node, as ReadFromObject did before the layouts were compiled:
+//! every class and object property looks up its own name
+void ReferenceReadFromObject(PropertyGridObject* node, const Object* obj)
+{
+    for (unsigned int i = 0; i < node->GetNumClassProperties(); ++i)
+    {
+        ReferenceReadProperty(node->GetClassPropertyRecord(i), node->GetClassPropertyAccessor(i), obj);
+    }
+
+    const int objPropIndex = obj->FindObject("_o_p_");
+    if (objPropIndex == -1)
+    {
+        return;
+    }
+
+    const Object* objPropObj = obj->GetObject(objPropIndex);
+    const Object* schemaObject = objPropObj->GetObject(objPropObj->FindObject("__schema__"));
+    const Array* sizeTypesArray = schemaObject->GetArray(schemaObject->FindArray("sizetypes"));
+    const Array* namesArray = schemaObject->GetArray(schemaObject->FindArray("names"));
+    const Array* typeNamesArray = schemaObject->GetArray(schemaObject->FindArray("typeNames"));
+
+    char str64[64];
+    Utils::Memset8(str64, 0, sizeof(str64));
+    for (int i = 0; i < sizeTypesArray->GetSize(); ++i)
+    {
+        const int packedValue = sizeTypesArray->GetElement(i).i;
+        node->AddObjectProperty(static_cast<PropertyType>(packedValue >> 16), packedValue & 0xffff,
+                                namesArray->GetElement(i).s, typeNamesArray->GetElement(i).s, str64);
+    }
+
+    for (unsigned int i = 0; i < node->GetNumObjectProperties(); ++i)
+    {
+        ReferenceReadProperty(node->GetObjectPropertyRecord(i), node->GetObjectPropertyAccessor(i), objPropObj);
+    }
+}
+
+//! \return true if both properties hold the same bytes
+bool PropertyValuesMatch(const PropertyRecord& r, const PropertyReadAccessor& a, const PropertyReadAccessor& b)
+{
+    unsigned char valueA[64];
+    unsigned char valueB[64];
+    a.Read(valueA, r.size);
+    b.Read(valueB, r.size);
+    for (int i = 0; i < r.size; ++i)
+    {
+        if (valueA[i] != valueB[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//! \return true if both nodes have the same properties, with the same values
+bool NodesMatch(const PropertyGridObject* a, const PropertyGridObject* b)
+{
+    if (a->GetNumClassProperties() != b->GetNumClassProperties() || a->GetNumObjectProperties() != b->GetNumObjectProperties())
+    {
+        return false;
+    }
+
+    bool match = true;
+    for (unsigned int i = 0; match && i < a->GetNumClassProperties(); ++i)
+    {
+        match = PropertyValuesMatch(a->GetClassPropertyRecord(i), a->GetClassReadPropertyAccessor(i), b->GetClassReadPropertyAccessor(i));
+    }
+    for (unsigned int i = 0; match && i < a->GetNumObjectProperties(); ++i)
+    {
+        const PropertyRecord& r = a->GetObjectPropertyRecord(i);
+        match = r.type == b->GetObjectPropertyRecord(i).type
+             && Utils::Strcmp(r.name, b->GetObjectPropertyRecord(i).name) == 0
+             && PropertyValuesMatch(r, a->GetObjectReadPropertyAccessor(i), b->GetObjectReadPropertyAccessor(i));
+    }
+    return match;
+}
+
+//! Reads the graph with a lookup of every property name
+struct ReferenceReadRun
+{
+    const Object* const* mNodeObjects; BenchmarkPropertyNode* const* mNodes;
+    void operator()()
+    {
+        for (int n = 0; n < BENCHMARK_GRAPH_NODE_COUNT; ++n)
+        {
+            mNodes[n]->ClearObjectProperties();
+            ReferenceReadFromObject(mNodes[n], mNodeObjects[n]);
+        }
+    }
+};
+
+//! Reads the graph with ReadFromObject, which maps the blocks of the objects through the property layouts
+struct LayoutReadRun
+{
+    const Asset* mAsset; const Object* const* mNodeObjects; BenchmarkPropertyNode* const* mNodes;
+    void operator()()
+    {
+        for (int n = 0; n < BENCHMARK_GRAPH_NODE_COUNT; ++n)
+        {
+            mNodes[n]->ClearObjectProperties();
+            mNodes[n]->ReadFromObject(mAsset, mNodeObjects[n]);
+        }
+    }
+};
+
+//! Matches a render collection layout against the node properties, comparing every pair of names
+struct ReferenceMatchRun
+{
+    BenchmarkPropertyNode* const* mNodes; const char* const* mLayoutNames; int mLayoutSize; int* mIndices;
+    void operator()()
+    {
+        for (int n = 0; n < BENCHMARK_GRAPH_NODE_COUNT; ++n)
+        {
+            int* indices = mIndices + n * mLayoutSize;
+            for (int propId = 0; propId < mLayoutSize; ++propId)
+            {
+                indices[propId] = -1;
+            }
+            for (unsigned int i = 0; i < mNodes[n]->GetNumClassProperties(); ++i)
+            {
+                const PropertyRecord& record = mNodes[n]->GetClassPropertyRecord(i);
+                for (int propId = 0; propId < mLayoutSize; ++propId)
+                {
+                    if (!Utils::Strcmp(record.name, mLayoutNames[propId]))
+                    {
+                        indices[propId] = static_cast<int>(i);
+                        break;
+                    }
+                }
+            }
+        }
+    }
+};
+
+//! Matches a render collection layout against the node properties through the compiled class layout
+struct LayoutMatchRun
+{
+    BenchmarkPropertyNode* const* mNodes; const char* const* mLayoutNames; int mLayoutSize; int* mIndices;
+    void operator()()
+    {
+        for (int n = 0; n < BENCHMARK_GRAPH_NODE_COUNT; ++n)
+        {
+            int* indices = mIndices + n * mLayoutSize;
+            for (int propId = 0; propId < mLayoutSize; ++propId)
+            {
+                indices[propId] = mNodes[n]->FindClassProperty(mLayoutNames[propId]);
+            }
+        }
+    }
+};
+
+#if PEGASUS_USE_EVENTS
+//! Listener counting the change events, standing for the editor
+class CountingPropertyListener : public IPropertyListener
+{
+public:
+    CountingPropertyListener() : mValueChangedCount(0) {}
+    virtual ~CountingPropertyListener() {}
+    virtual void OnEvent(Core::IEventUserData* d, ValueChangedEventIndexed& e) { ++mValueChangedCount; }
+    virtual void OnEvent(Core::IEventUserData* d, ObjectPropertiesLayoutChanged& e) {}
+    virtual void OnEvent(Core::IEventUserData* d, PropertyGridDestroyed& e) {}
+    virtual void OnEvent(Core::IEventUserData* d, PropertyGridRenderRequest& e) {}
+    int mValueChangedCount;
+};
+#endif
+
+//! Writes the frames of an animation script: every property of the nodes is written several times per frame,
+//! the last write of a frame is the value kept, and the odd frames only write again the values of the frame before
+struct ScriptWritesRun
+{
+    BenchmarkPropertyNode* const* mNodes; const int* mPropertyIndices; bool mUseBatches;
+    void operator()()
+    {
+        for (int f = 0; f < BENCHMARK_WRITE_FRAME_COUNT; ++f)
+        {
+            const int keyFrame = f & ~1;
+            const bool isRepeat = (f & 1) != 0;
+            for (int n = 0; n < BENCHMARK_WRITE_NODE_COUNT; ++n)
+            {
+                BenchmarkPropertyNode* node = mNodes[n];
+                if (mUseBatches)
+                {
+                    node->BeginPropertyBatch();
+                }
+                for (int p = 0; p < BENCHMARK_WRITE_PROPERTY_COUNT; ++p)
+                {
+                    PropertyAccessor a = node->GetClassPropertyAccessor(mPropertyIndices[p]);
+                    for (int w = 0; w < BENCHMARK_WRITES_PER_PROPERTY; ++w)
+                    {
+                        const int step = isRepeat ? (BENCHMARK_WRITES_PER_PROPERTY - 1) : w;
+                        const float value = static_cast<float>(keyFrame * 64 + step * 8 + p) / 64.0f;
+                        a.Write(&value, sizeof(value));
+                    }
+                }
+                if (mUseBatches)
+                {
+                    node->EndPropertyBatch();
+                }
+            }
+        }
+    }
+};
+
+}
+
+//----------------------------------------------------------------------------------------
+
+void BENCHMARK_PropertyGridGraphLoad()
+{
+    Alloc::IAllocator* allocator = Memory::GetGlobalAllocator();
+    Io::IOManager ioManager("");
+    Pegasus::AssetLib::AssetLib lib(allocator, &ioManager);
+
+    // the source graph, with random class properties and a few object properties per node
+    BenchmarkPropertyNode** sourceNodes = PG_NEW_ARRAY(allocator, -1, "Source nodes", Alloc::PG_MEM_TEMP, BenchmarkPropertyNode*, BENCHMARK_GRAPH_NODE_COUNT);
+    BenchmarkPropertyNode** referenceNodes = PG_NEW_ARRAY(allocator, -1, "Reference nodes", Alloc::PG_MEM_TEMP, BenchmarkPropertyNode*, BENCHMARK_GRAPH_NODE_COUNT);
+    BenchmarkPropertyNode** layoutNodes = PG_NEW_ARRAY(allocator, -1, "Layout nodes", Alloc::PG_MEM_TEMP, BenchmarkPropertyNode*, BENCHMARK_GRAPH_NODE_COUNT);
+    const Object** nodeObjects = PG_NEW_ARRAY(allocator, -1, "Node objects", Alloc::PG_MEM_TEMP, const Object*, BENCHMARK_GRAPH_NODE_COUNT);
+
+    Asset* asset = lib.CreateAsset("PropertyGridGraph.pas", true);
+    Object* root = asset->NewObject();
+    Array* nodesArray = asset->NewArray();
+    nodesArray->CommitType(Array::AS_TYPE_OBJECT);
+    root->AddArray("nodes", nodesArray);
+    asset->SetRootObject(root);
+
+    const float defaultFloat = 0.0f;
+    const Math::Vec3 defaultVec3(0.0f, 0.0f, 0.0f);
+    const int defaultInt = 0;
+    const Math::Color8RGBA defaultColor(0, 0, 0, 0);
+    unsigned int seed = 24681357u;
+    for (int n = 0; n < BENCHMARK_GRAPH_NODE_COUNT; ++n)
+    {
+        BenchmarkPropertyNode* node = PG_NEW(allocator, -1, "Source node", Alloc::PG_MEM_TEMP) BenchmarkPropertyNode();
+        node->AddObjectProperty<float>("Weight", &defaultFloat);
+        node->AddObjectProperty<Math::Vec3>("Pivot", &defaultVec3);
+        node->AddObjectProperty<int>("Slot", &defaultInt);
+        node->AddObjectProperty<Math::Color8RGBA>("Key", &defaultColor);
+        for (unsigned int i = 0; i < node->GetNumClassProperties(); ++i)
+        {
+            RandomizeProperty(node->GetClassPropertyRecord(i), node->GetClassPropertyAccessor(i), seed);
+        }
+        for (unsigned int i = 0; i < node->GetNumObjectProperties(); ++i)
+        {
+            RandomizeProperty(node->GetObjectPropertyRecord(i), node->GetObjectPropertyAccessor(i), seed);
+        }
+        sourceNodes[n] = node;
+
+        Object* nodeObject = asset->NewObject();
+        nodeObject->AddString("class", "BenchmarkPropertyNode");
+        node->WriteToObject(asset, nodeObject);
+        nodeObjects[n] = nodeObject;
+
+        Array::Element el;
+        el.o = nodeObject;
+        nodesArray->PushElement(el);
+
+        referenceNodes[n] = PG_NEW(allocator, -1, "Reference node", Alloc::PG_MEM_TEMP) BenchmarkPropertyNode();
+        layoutNodes[n] = PG_NEW(allocator, -1, "Layout node", Alloc::PG_MEM_TEMP) BenchmarkPropertyNode();
+    }
+
+    ReferenceReadRun referenceReadRun = { nodeObjects, referenceNodes };
+    LayoutReadRun layoutReadRun = { asset, nodeObjects, layoutNodes };
+    const double referenceReadTime = BenchmarkMeasure(referenceReadRun);
+    const double layoutReadTime = BenchmarkMeasure(layoutReadRun);
+
+    const int propertyCount = static_cast<int>(sourceNodes[0]->GetNumClassProperties() + sourceNodes[0]->GetNumObjectProperties());
+    printf("  %d nodes, %d properties per node\n", BENCHMARK_GRAPH_NODE_COUNT, propertyCount);
+    BenchmarkReport("Read, lookup per property", referenceReadTime, BENCHMARK_GRAPH_NODE_COUNT);
+    BenchmarkReport("Read, compiled layouts", layoutReadTime, BENCHMARK_GRAPH_NODE_COUNT);
+    BenchmarkReportSpeedup("Speedup", referenceReadTime, layoutReadTime);
+
+    for (int n = 0; n < BENCHMARK_GRAPH_NODE_COUNT; ++n)
+    {
+        if (!NodesMatch(sourceNodes[n], referenceNodes[n]) || !NodesMatch(sourceNodes[n], layoutNodes[n]))
+        {
+            printf("  ERROR: node %d does not match the node it was written from!\n", n);
+            break;
+        }
+    }
+
+    // the layout of a render collection, named from script: the node properties in another order, and names no node has
+    const int layoutSize = static_cast<int>(sourceNodes[0]->GetNumClassProperties()) + BENCHMARK_LAYOUT_MISSING_COUNT;
+    PG_ASSERT(layoutSize <= BENCHMARK_LAYOUT_MAX_SIZE);
+    char layoutNameStrings[BENCHMARK_LAYOUT_MAX_SIZE][64];
+    const char* layoutNames[BENCHMARK_LAYOUT_MAX_SIZE];
+    for (int propId = 0; propId < layoutSize; ++propId)
+    {
+        const int i = layoutSize - 1 - propId;
+        if (i < BENCHMARK_LAYOUT_MISSING_COUNT)
+        {
+            sprintf_s(layoutNameStrings[propId], 64, "Missing%d", i);
+        }
+        else
+        {
+            const char* name = sourceNodes[0]->GetClassPropertyRecord(i - BENCHMARK_LAYOUT_MISSING_COUNT).name;
+            Utils::Memcpy(layoutNameStrings[propId], name, Utils::Strlen(name) + 1);
+        }
+        layoutNames[propId] = layoutNameStrings[propId];
+    }
+
+    int* referenceIndices = PG_NEW_ARRAY(allocator, -1, "Reference layout indices", Alloc::PG_MEM_TEMP, int, BENCHMARK_GRAPH_NODE_COUNT * layoutSize);
+    int* layoutIndices = PG_NEW_ARRAY(allocator, -1, "Compiled layout indices", Alloc::PG_MEM_TEMP, int, BENCHMARK_GRAPH_NODE_COUNT * layoutSize);
+    ReferenceMatchRun referenceMatchRun = { layoutNodes, layoutNames, layoutSize, referenceIndices };
+    LayoutMatchRun layoutMatchRun = { layoutNodes, layoutNames, layoutSize, layoutIndices };
+    const double referenceMatchTime = BenchmarkMeasure(referenceMatchRun);
+    const double layoutMatchTime = BenchmarkMeasure(layoutMatchRun);
+
+    printf("  %d layout names per node\n", layoutSize);
+    BenchmarkReport("Layout match, name pairs", referenceMatchTime, BENCHMARK_GRAPH_NODE_COUNT);
+    BenchmarkReport("Layout match, compiled layout", layoutMatchTime, BENCHMARK_GRAPH_NODE_COUNT);
+    BenchmarkReportSpeedup("Speedup", referenceMatchTime, layoutMatchTime);
+
+    for (int i = 0; i < BENCHMARK_GRAPH_NODE_COUNT * layoutSize; ++i)
+    {
+        if (referenceIndices[i] != layoutIndices[i])
+        {
+            printf("  ERROR: layout name %s matched property %d, %d expected!\n", layoutNames[i % layoutSize], layoutIndices[i], referenceIndices[i]);
+            break;
+        }
+    }
+
+    PG_DELETE_ARRAY(allocator, layoutIndices);
+    PG_DELETE_ARRAY(allocator, referenceIndices);
+    for (int n = 0; n < BENCHMARK_GRAPH_NODE_COUNT; ++n)
+    {
+        PG_DELETE(allocator, layoutNodes[n]);
+        PG_DELETE(allocator, referenceNodes[n]);
+        PG_DELETE(allocator, sourceNodes[n]);
+    }
+    lib.UnloadAsset(asset);
+    PG_DELETE_ARRAY(allocator, nodeObjects);
+    PG_DELETE_ARRAY(allocator, layoutNodes);
+    PG_DELETE_ARRAY(allocator, referenceNodes);
+    PG_DELETE_ARRAY(allocator, sourceNodes);
+}
+
+//----------------------------------------------------------------------------------------
+
+void BENCHMARK_PropertyGridBatchedWrites()
+{
+    Alloc::IAllocator* allocator = Memory::GetGlobalAllocator();
+
+    const char* propertyNames[BENCHMARK_WRITE_PROPERTY_COUNT] = { "Speed", "Scale", "Intensity", "Radius", "Phase", "Frequency", "Amplitude", "Falloff" };
+    int propertyIndices[BENCHMARK_WRITE_PROPERTY_COUNT];
+    for (int p = 0; p < BENCHMARK_WRITE_PROPERTY_COUNT; ++p)
+    {
+        propertyIndices[p] = BenchmarkPropertyNode::GetStaticClassInfo()->FindClassProperty(propertyNames[p]);
+        if (propertyIndices[p] == -1)
+        {
+            printf("  ERROR: property %s not found!\n", propertyNames[p]);
+            return;
+        }
+    }
+
+    BenchmarkPropertyNode** nodes = PG_NEW_ARRAY(allocator, -1, "Written nodes", Alloc::PG_MEM_TEMP, BenchmarkPropertyNode*, BENCHMARK_WRITE_NODE_COUNT);
+    for (int n = 0; n < BENCHMARK_WRITE_NODE_COUNT; ++n)
+    {
+        nodes[n] = PG_NEW(allocator, -1, "Written node", Alloc::PG_MEM_TEMP) BenchmarkPropertyNode();
+    }
+
+#if PEGASUS_USE_EVENTS
+    CountingPropertyListener listener;
+    for (int n = 0; n < BENCHMARK_WRITE_NODE_COUNT; ++n)
+    {
+        nodes[n]->SetEventListener(&listener);
+    }
+#endif
+
+    ScriptWritesRun immediateRun = { nodes, propertyIndices, false };
+    ScriptWritesRun batchedRun = { nodes, propertyIndices, true };
+    const double immediateTime = BenchmarkMeasure(immediateRun);
+    const double batchedTime = BenchmarkMeasure(batchedRun);
+
+    const int writeCount = BENCHMARK_WRITE_FRAME_COUNT * BENCHMARK_WRITE_NODE_COUNT * BENCHMARK_WRITE_PROPERTY_COUNT * BENCHMARK_WRITES_PER_PROPERTY;
+    printf("  %d nodes, %d properties written %d times per frame, %d frames\n", BENCHMARK_WRITE_NODE_COUNT, BENCHMARK_WRITE_PROPERTY_COUNT, BENCHMARK_WRITES_PER_PROPERTY, BENCHMARK_WRITE_FRAME_COUNT);
+    BenchmarkReport("Writes, event per write", immediateTime, writeCount);
+    BenchmarkReport("Writes, property batches", batchedTime, writeCount);
+    BenchmarkReportSpeedup("Speedup", immediateTime, batchedTime);
+
+#if PEGASUS_USE_EVENTS
+    // Within a batch, one event per property changed during the frame.
+    // The properties change on the even frames only, the odd frames write values already stored
+    const int expectedEventCount = (BENCHMARK_WRITE_FRAME_COUNT / 2) * BENCHMARK_WRITE_NODE_COUNT * BENCHMARK_WRITE_PROPERTY_COUNT;
+    listener.mValueChangedCount = 0;
+    batchedRun();
+    printf("  %d change events per run in batches, %d expected\n", listener.mValueChangedCount, expectedEventCount);
+    if (listener.mValueChangedCount != expectedEventCount)
+    {
+        printf("  ERROR: the property batches did not send one event per changed property!\n");
+    }
+#endif
+
+    // Writes of the current values leave the property grid valid
+    bool unchangedIsValid = true;
+    for (int n = 0; n < BENCHMARK_WRITE_NODE_COUNT; ++n)
+    {
+        BenchmarkPropertyNode* node = nodes[n];
+        node->ValidatePropertyGrid();
+        node->SetSpeed(node->GetSpeed());
+        PropertyAccessor a = node->GetClassPropertyAccessor(propertyIndices[1]);
+        const float scale = node->GetScale();
+        a.Write(&scale, sizeof(scale));
+        unchangedIsValid = unchangedIsValid && !node->IsPropertyGridDirty();
+    }
+    if (!unchangedIsValid)
+    {
+        printf("  ERROR: writes that change nothing invalidated the property grid!\n");
+    }
+
+    for (int n = 0; n < BENCHMARK_WRITE_NODE_COUNT; ++n)
+    {
+        PG_DELETE(allocator, nodes[n]);
+    }
+    PG_DELETE_ARRAY(allocator, nodes);
+}
@@ -0,0 +1,1979 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Benchmarks                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   RenderBenchmarks.cpp
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Pegasus benchmarks for the Render package, implementation.
+//!         Run on the null backend, so only the CPU side of the submission is measured.
+
+#include "Pegasus/Benchmarks/Benchmarks.h"
+#include "Pegasus/Benchmarks/RenderBenchmarks.h"
+#include "Pegasus/Render/NullCommandLog.h"
+#include "Pegasus/Render/CommandBuffer.h"
+#include "Pegasus/Render/UniformRing.h"
+#include "Pegasus/Render/UniformLookup.h"
+#include "Pegasus/Memory/MemoryManager.h"
+#include "Pegasus/Utils/Memcpy.h"
+#include "Pegasus/Utils/String.h"
+#include <stdio.h>
+
+using namespace Pegasus;
+using namespace Pegasus::Render;
+
+namespace
+{
+
+//! Uniforms of the program of the uniform location benchmark
+const int UNIFORM_LOCATION_NAME_COUNT = 64;
+
+//! Name of a uniform of the uniform location benchmark. The names share a long prefix,
+//! as the uniforms of a shader often do, so the comparisons of the names are not free.
+//! \param index Index of the uniform, in [0, 100)
+//! \param outName Name, at least PEGASUS_RENDER_MAX_UNIFORM_NAME_LEN characters
+void GetBenchmarkUniformName(int index, char * outName)
+{
+    outName[0] = '\0';
+    Utils::Strcat(outName, "materialLayerConstants");
+    const char digits[3] = { static_cast<char>('0' + (index / 10) % 10), static_cast<char>('0' + index % 10), '\0' };
+    Utils::Strcat(outName, digits);
+}
+
+}   // anonymous namespace
+
+#if PEGASUS_GAPI_NULL
+
+#include "Pegasus/Render/Render.h"
+#include "Pegasus/Render/RenderContext.h"
+#include "Pegasus/Render/IDevice.h"
+#include "Pegasus/Render/ShaderFactory.h"
+#include "Pegasus/Render/MeshFactory.h"
+#include "Pegasus/Graph/NodeManager.h"
+#include "Pegasus/Shader/ShaderManager.h"
+#include "Pegasus/Shader/ProgramLinkage.h"
+#include "Pegasus/Shader/ShaderStage.h"
+#include "Pegasus/Mesh/MeshManager.h"
+#include "Pegasus/Mesh/Mesh.h"
+#include "Pegasus/BlockScript/BlockScriptManager.h"
+#include "Pegasus/BlockScript/BlockScript.h"
+#include "Pegasus/BlockScript/BsVm.h"
+#include "Pegasus/Core/Io.h"
+#include "Pegasus/Core/ParallelFor.h"
+#include "Pegasus/Core/Atomic.h"
+#include "Pegasus/Application/Application.h"
+#include "Pegasus/AssetLib/AssetLib.h"
+#include "Pegasus/PegasusAssetTypes.h"
+#include "Pegasus/Timeline/TimelineManager.h"
+#include "Pegasus/Timeline/Timeline.h"
+#include "Pegasus/Timeline/Lane.h"
+#include "Pegasus/Timeline/Block.h"
+#include "Pegasus/Timeline/TimelineScript.h"
+#include "Pegasus/Timeline/TimelineTrace.h"
+#include "Pegasus/Mesh/Generator/QuadGenerator.h"
+#include "Pegasus/Application/RenderCollection.h"
+
+namespace
+{
+
+//! Number of draws of a benchmarked frame
+const int BENCHMARK_DRAW_COUNT = 512;
+
+//! Number of frames of a measured run
+const int BENCHMARK_FRAME_COUNT = 64;
+
+//! Headless render state of the benchmark: device, context, managers and the resources of the frame
+struct NullSubmissionScene
+{
+    IDevice * mDevice;
+    Context * mContext;
+    Graph::NodeManager * mNodeManager;
+    Shader::ShaderManager * mShaderManager;
+    Mesh::MeshManager * mMeshManager;
+
+    Shader::ProgramLinkageRef mProgram;
+    Mesh::MeshRef mQuad;
+    BufferRef mObjectBuffer;
+    Uniform mObjectUniform;
+    RasterizerStateRef mRasterState;
+    BlendingStateRef mBlendState;
+
+    NullSubmissionScene()
+    {
+        Alloc::IAllocator * renderAlloc = Memory::GetRenderAllocator();
+        Alloc::IAllocator * nodeAlloc = Memory::GetNodeAllocator();
+        Alloc::IAllocator * nodeDataAlloc = Memory::GetNodeDataAllocator();
+
+        DeviceConfig deviceConfig;
+        deviceConfig.mModuleHandle = 0;
+        mDevice = IDevice::CreatePlatformDevice(deviceConfig, renderAlloc);
+
+        ContextConfig contextConfig;
+        contextConfig.mAllocator = renderAlloc;
+        contextConfig.mDevice = mDevice;
+        contextConfig.mWidth = 1280;
+        contextConfig.mHeight = 720;
+        mContext = PG_NEW(renderAlloc, -1, "Benchmark Context", Alloc::PG_MEM_TEMP) Context(contextConfig);
+
+        Shader::IShaderFactory * shaderFactory = GetRenderShaderFactory();
+        Mesh::IMeshFactory * meshFactory = GetRenderMeshFactory();
+        shaderFactory->Initialize(nodeDataAlloc);
+        meshFactory->Initialize(nodeDataAlloc);
+
+        mNodeManager = PG_NEW(nodeAlloc, -1, "Benchmark NodeManager", Alloc::PG_MEM_TEMP) Graph::NodeManager(nodeAlloc, nodeDataAlloc);
+        mShaderManager = PG_NEW(nodeAlloc, -1, "Benchmark ShaderManager", Alloc::PG_MEM_TEMP) Shader::ShaderManager(mNodeManager, shaderFactory);
+        mMeshManager = PG_NEW(nodeAlloc, -1, "Benchmark MeshManager", Alloc::PG_MEM_TEMP) Mesh::MeshManager(mNodeManager, meshFactory);
+        shaderFactory->RegisterShaderManager(mShaderManager);
+
+        //the null backend does not compile, any source links
+        static const char vsSource[] = "float4 main(float4 p : POSITION) : SV_Position { return p; }";
+        static const char psSource[] = "float4 main() : SV_Target { return 1.0; }";
+        Shader::ShaderStageRef vertexShader = mShaderManager->CreateShader();
+        vertexShader->SetSource(Shader::VERTEX, vsSource, sizeof(vsSource));
+        Shader::ShaderStageRef pixelShader = mShaderManager->CreateShader();
+        pixelShader->SetSource(Shader::FRAGMENT, psSource, sizeof(psSource));
+        mProgram = mShaderManager->CreateProgram();
+        mProgram->SetShaderStage(vertexShader);
+        mProgram->SetShaderStage(pixelShader);
+        GetUniformLocation(mProgram, "objectConstants", mObjectUniform);
+
+        mQuad = mMeshManager->CreateMeshNode();
+        Mesh::MeshGeneratorRef quadGen = mMeshManager->CreateMeshGeneratorNode("QuadGenerator");
+        mQuad->SetGeneratorInput(quadGen);
+
+        mObjectBuffer = CreateUniformBuffer(sizeof(Math::Vec4) * 4);
+
+        RasterizerConfig rasterConfig;
+        rasterConfig.mCullMode = RasterizerConfig::NONE_CM;
+        rasterConfig.mDepthFunc = RasterizerConfig::NONE_DF;
+        mRasterState = CreateRasterizerState(rasterConfig);
+
+        BlendingConfig blendConfig;
+        blendConfig.mBlendingOperator = BlendingConfig::NONE_BO;
+        mBlendState = CreateBlendingState(blendConfig);
+    }
+
+    ~NullSubmissionScene()
+    {
+        Alloc::IAllocator * renderAlloc = Memory::GetRenderAllocator();
+        Alloc::IAllocator * nodeAlloc = Memory::GetNodeAllocator();
+
+        mProgram = nullptr;
+        mQuad = nullptr;
+        mObjectBuffer = nullptr;
+        mRasterState = nullptr;
+        mBlendState = nullptr;
+        CleanInternalState();
+
+        PG_DELETE(nodeAlloc, mMeshManager);
+        PG_DELETE(nodeAlloc, mShaderManager);
+        PG_DELETE(nodeAlloc, mNodeManager);
+        PG_DELETE(renderAlloc, mContext);
+        PG_DELETE(renderAlloc, mDevice);
+    }
+
+    //! Submit a frame the way a render system does: targets, states, then one uniform update and one draw per object
+    void SubmitFrame()
+    {
+        CleanInternalState();
+        BeginMarker("Benchmark frame");
+        DispatchDefaultRenderTarget();
+        SetViewport(Viewport(1280, 720));
+        SetClearColorValue(Math::ColorRGBA(0.0f, 0.0f, 0.0f, 1.0f));
+        Clear(true, true, false);
+        SetRasterizerState(mRasterState);
+        SetBlendingState(mBlendState);
+        SetProgram(mProgram);
+        SetMesh(mQuad);
+
+        Math::Vec4 objectConstants[4];
+        for (int d = 0; d < BENCHMARK_DRAW_COUNT; ++d)
+        {
+            const float offset = static_cast<float>(d) * 0.01f;
+            objectConstants[0] = Math::Vec4(1.0f, 0.0f, 0.0f, offset);
+            objectConstants[1] = Math::Vec4(0.0f, 1.0f, 0.0f, -offset);
+            objectConstants[2] = Math::Vec4(0.0f, 0.0f, 1.0f, 0.0f);
+            objectConstants[3] = Math::Vec4(0.0f, 0.0f, 0.0f, 1.0f);
+            SetBuffer(mObjectBuffer, objectConstants);
+            SetUniformBuffer(mObjectUniform, mObjectBuffer);
+            Draw();
+        }
+
+        UnbindMesh();
+        EndMarker();
+        mContext->Swap();
+    }
+};
+
+//! Submission of BENCHMARK_FRAME_COUNT frames, the log is cleared every frame as a golden test would do
+struct SubmitFramesRun
+{
+    NullSubmissionScene * mScene;
+    NullCommandLog * mLog;
+
+    void operator()()
+    {
+        for (int f = 0; f < BENCHMARK_FRAME_COUNT; ++f)
+        {
+            mLog->Clear();
+            mScene->SubmitFrame();
+        }
+    }
+};
+
+//! Immediate render API with the functions of the command buffer, so a frame is written once for both
+struct ImmediateApi
+{
+    void CleanInternalState() { Render::CleanInternalState(); }
+    void BeginMarker(const char * marker) { Render::BeginMarker(marker); }
+    void EndMarker() { Render::EndMarker(); }
+    void DispatchDefaultRenderTarget() { Render::DispatchDefaultRenderTarget(); }
+    void SetViewport(const Viewport& viewport) { Render::SetViewport(viewport); }
+    void SetClearColorValue(const Math::ColorRGBA& col) { Render::SetClearColorValue(col); }
+    void Clear(bool color, bool depth, bool stencil) { Render::Clear(color, depth, stencil); }
+    void SetProgram(Shader::ProgramLinkageInOut program) { Render::SetProgram(program); }
+    void SetMesh(Mesh::MeshInOut mesh) { Render::SetMesh(mesh); }
+    void UnbindMesh() { Render::UnbindMesh(); }
+    void SetRasterizerState(const RasterizerStateRef& rasterState) { Render::SetRasterizerState(rasterState); }
+    void SetBlendingState(const BlendingStateRef blendingState) { Render::SetBlendingState(blendingState); }
+    void SetBuffer(BufferRef& buffer, const void * src) { Render::SetBuffer(buffer, src); }
+    bool SetUniformBuffer(Uniform& u, const BufferRef& buffer) { return Render::SetUniformBuffer(u, buffer); }
+    void Draw() { Render::Draw(); }
+};
+
+//! Frame of a render system drawing objects of 4 materials and 2 meshes in a mixed order,
+//! setting the whole state of every draw the way the blocks and the scripts do
+struct MixedStateFrame
+{
+    static const int MATERIAL_COUNT = 4;
+
+    NullSubmissionScene * mScene;
+    Shader::ProgramLinkageRef mPrograms[2];
+    Mesh::MeshRef mMeshes[2];
+    RasterizerStateRef mRasterStates[2];
+    BufferRef mMaterialBuffer;
+    Uniform mObjectUniforms[2];
+    Uniform mMaterialUniforms[2];
+    Math::Vec4 mMaterialColors[MATERIAL_COUNT];
+
+    explicit MixedStateFrame(NullSubmissionScene * scene)
+    :   mScene(scene)
+    {
+        static const char vsSource[] = "float4 main(float4 p : POSITION) : SV_Position { return p; }";
+        static const char psSource[] = "float4 main() : SV_Target { return 0.5; }";
+        Shader::ShaderStageRef vertexShader = scene->mShaderManager->CreateShader();
+        vertexShader->SetSource(Shader::VERTEX, vsSource, sizeof(vsSource));
+        Shader::ShaderStageRef pixelShader = scene->mShaderManager->CreateShader();
+        pixelShader->SetSource(Shader::FRAGMENT, psSource, sizeof(psSource));
+        mPrograms[0] = scene->mProgram;
+        mPrograms[1] = scene->mShaderManager->CreateProgram();
+        mPrograms[1]->SetShaderStage(vertexShader);
+        mPrograms[1]->SetShaderStage(pixelShader);
+        for (int p = 0; p < 2; ++p)
+        {
+            GetUniformLocation(mPrograms[p], "objectConstants", mObjectUniforms[p]);
+            GetUniformLocation(mPrograms[p], "materialConstants", mMaterialUniforms[p]);
+        }
+
+        mMeshes[0] = scene->mQuad;
+        mMeshes[1] = scene->mMeshManager->CreateMeshNode();
+        Mesh::MeshGeneratorRef boxGen = scene->mMeshManager->CreateMeshGeneratorNode("BoxGenerator");
+        mMeshes[1]->SetGeneratorInput(boxGen);
+
+        //strict depth tests, the command buffer sorts these draws (see CommandBuffer.h)
+        RasterizerConfig rasterConfig;
+        rasterConfig.mCullMode = RasterizerConfig::NONE_CM;
+        rasterConfig.mDepthFunc = RasterizerConfig::LESSER_DF;
+        mRasterStates[0] = CreateRasterizerState(rasterConfig);
+        rasterConfig.mCullMode = RasterizerConfig::CW_CM;
+        rasterConfig.mDepthFunc = RasterizerConfig::GREATER_DF;
+        mRasterStates[1] = CreateRasterizerState(rasterConfig);
+
+        mMaterialBuffer = CreateUniformBuffer(sizeof(Math::Vec4));
+        for (int m = 0; m < MATERIAL_COUNT; ++m)
+        {
+            mMaterialColors[m] = Math::Vec4(static_cast<float>(m) * 0.25f, 0.5f, 1.0f, 1.0f);
+        }
+    }
+
+    //! Submit the frame to the immediate render API or record it into a command buffer
+    template <class Api>
+    void RecordFrame(Api & api)
+    {
+        api.CleanInternalState();
+        api.BeginMarker("Benchmark mixed frame");
+        api.DispatchDefaultRenderTarget();
+        api.SetViewport(Viewport(1280, 720));
+        api.SetClearColorValue(Math::ColorRGBA(0.0f, 0.0f, 0.0f, 1.0f));
+        api.Clear(true, true, false);
+
+        for (int d = 0; d < BENCHMARK_DRAW_COUNT; ++d)
+        {
+            RecordDraw(api, d, static_cast<float>(d) * 0.01f);
+        }
+
+        api.UnbindMesh();
+        api.EndMarker();
+    }
+
+    //! Set the whole state of an object and draw it
+    //! \param d index of the object, selects its material and its mesh
+    //! \param offset translation of the object
+    template <class Api>
+    void RecordDraw(Api & api, int d, float offset)
+    {
+        const int material = d % MATERIAL_COUNT;
+        const int program = material & 1;
+        api.SetProgram(mPrograms[program]);
+        api.SetMesh(mMeshes[(d / MATERIAL_COUNT) & 1]);
+        api.SetRasterizerState(mRasterStates[material >> 1]);
+        api.SetBlendingState(mScene->mBlendState);
+        api.SetBuffer(mMaterialBuffer, &mMaterialColors[material]);
+        api.SetUniformBuffer(mMaterialUniforms[program], mMaterialBuffer);
+
+        Math::Vec4 objectConstants[4];
+        objectConstants[0] = Math::Vec4(1.0f, 0.0f, 0.0f, offset);
+        objectConstants[1] = Math::Vec4(0.0f, 1.0f, 0.0f, -offset);
+        objectConstants[2] = Math::Vec4(0.0f, 0.0f, 1.0f, 0.0f);
+        objectConstants[3] = Math::Vec4(0.0f, 0.0f, 0.0f, 1.0f);
+        api.SetBuffer(mScene->mObjectBuffer, objectConstants);
+        api.SetUniformBuffer(mObjectUniforms[program], mScene->mObjectBuffer);
+        api.Draw();
+    }
+};
+
+//! Immediate submission of BENCHMARK_FRAME_COUNT mixed frames
+struct ImmediateFramesRun
+{
+    MixedStateFrame * mFrame;
+    NullCommandLog * mLog;
+
+    void operator()()
+    {
+        ImmediateApi api;
+        for (int f = 0; f < BENCHMARK_FRAME_COUNT; ++f)
+        {
+            mLog->Clear();
+            mFrame->RecordFrame(api);
+        }
+    }
+};
+
+//! Recording, sorting and filtered submission of BENCHMARK_FRAME_COUNT mixed frames
+struct DeferredFramesRun
+{
+    MixedStateFrame * mFrame;
+    NullCommandLog * mLog;
+    CommandBuffer * mBuffer;
+
+    void operator()()
+    {
+        for (int f = 0; f < BENCHMARK_FRAME_COUNT; ++f)
+        {
+            mLog->Clear();
+            mBuffer->Reset();
+            mFrame->RecordFrame(*mBuffer);
+            mBuffer->Submit();
+        }
+    }
+};
+
+//! Number of lanes of the lane recording benchmark, draws per lane and frames of a measured run
+const int BENCHMARK_LANE_COUNT = 32;
+const int BENCHMARK_LANE_DRAW_COUNT = 32;
+const int BENCHMARK_LANE_FRAME_COUNT = 8;
+
+//! Render function of the script of every lane, run once per draw to compute the position of the object
+const char* BENCHMARK_LANE_SCRIPT =
+    "float Benchmark_Render(seed : float)\n"
+    "{\n"
+    "    acc = 0.0;\n"
+    "    i = 0;\n"
+    "    while (i < 64)\n"
+    "    {\n"
+    "        acc = acc + sin(seed + acc) * 0.5;\n"
+    "        i = i + 1;\n"
+    "    }\n"
+    "    return acc;\n"
+    "}\n";
+
+//! Timeline of script heavy lanes: each lane runs its script for every object it draws, as the blocks of a timeline do.
+//! One compiled script shared by every lane, one virtual machine state and one command buffer per lane.
+struct ScriptLanesFrame
+{
+    MixedStateFrame * mFrame;
+    BlockScript::BlockScriptManager mManager;
+    Io::FileBuffer mFileBuffer;
+    BlockScript::BlockScript* mScript;
+    BlockScript::FunBindPoint mRenderFunction;
+    BlockScript::BsVmState mVmStates[BENCHMARK_LANE_COUNT];
+    CommandBuffer mBuffers[BENCHMARK_LANE_COUNT];
+    bool mCompiled;
+
+    explicit ScriptLanesFrame(MixedStateFrame * frame)
+    : mFrame(frame), mManager(Memory::GetGlobalAllocator()), mScript(nullptr), mRenderFunction(BlockScript::FUN_INVALID_BIND_POINT), mCompiled(false)
+    {
+        Alloc::IAllocator* allocator = Memory::GetGlobalAllocator();
+        const int scriptLength = static_cast<int>(Utils::Strlen(BENCHMARK_LANE_SCRIPT));
+        char* source = PG_NEW_ARRAY(allocator, -1, "Benchmark lane script", Alloc::PG_MEM_TEMP, char, scriptLength + 1);
+        Utils::Memcpy(source, BENCHMARK_LANE_SCRIPT, scriptLength + 1);
+        mFileBuffer.OwnBuffer(allocator, source, scriptLength + 1);
+        mFileBuffer.SetFileSize(scriptLength);
+
+        mScript = mManager.CreateBlockScript();
+        mCompiled = mScript->Compile(&mFileBuffer);
+        if (mCompiled)
+        {
+            const char* argTypes[] = { "float" };
+            mRenderFunction = mScript->GetFunctionBindPoint("Benchmark_Render", argTypes, 1);
+            mCompiled = mRenderFunction != BlockScript::FUN_INVALID_BIND_POINT;
+        }
+
+        for (int lane = 0; lane < BENCHMARK_LANE_COUNT; ++lane)
+        {
+            mVmStates[lane].Initialize(allocator);
+            if (mCompiled)
+            {
+                mScript->Run(&mVmStates[lane]);
+            }
+        }
+    }
+
+    ~ScriptLanesFrame()
+    {
+        for (int lane = 0; lane < BENCHMARK_LANE_COUNT; ++lane)
+        {
+            mBuffers[lane].Reset();
+        }
+        mManager.DestroyBlockScript(mScript);
+    }
+
+    //! Render of a lane: the script places every object of the lane, then the object is drawn
+    template <class Api>
+    void RecordLane(Api & api, int lane)
+    {
+        api.BeginMarker("Benchmark lane");
+        for (int d = 0; d < BENCHMARK_LANE_DRAW_COUNT; ++d)
+        {
+            const float seed = static_cast<float>(lane * BENCHMARK_LANE_DRAW_COUNT + d) * 0.01f;
+            float offset = 0.0f;
+            mScript->ExecuteFunction(&mVmStates[lane], mRenderFunction, &seed, sizeof(seed), &offset, sizeof(offset));
+            mFrame->RecordDraw(api, lane + d, offset);
+        }
+        api.EndMarker();
+    }
+
+    //! ParallelFor functor, records the lanes [begin, end) into their command buffers
+    void operator()(int begin, int end)
+    {
+        for (int lane = begin; lane < end; ++lane)
+        {
+            RecordLane(mBuffers[lane], lane);
+        }
+    }
+};
+
+//! Render of BENCHMARK_LANE_FRAME_COUNT frames, the lanes one after the other with the immediate render API
+struct SerialLanesRun
+{
+    ScriptLanesFrame * mLanes;
+    NullCommandLog * mLog;
+
+    void operator()()
+    {
+        ImmediateApi api;
+        for (int f = 0; f < BENCHMARK_LANE_FRAME_COUNT; ++f)
+        {
+            mLog->Clear();
+            api.CleanInternalState();
+            for (int lane = 0; lane < BENCHMARK_LANE_COUNT; ++lane)
+            {
+                mLanes->RecordLane(api, lane);
+            }
+        }
+    }
+};
+
+//! Render of BENCHMARK_LANE_FRAME_COUNT frames, the lanes recorded concurrently then submitted in the order of the lanes
+struct ConcurrentLanesRun
+{
+    ScriptLanesFrame * mLanes;
+    NullCommandLog * mLog;
+
+    void operator()()
+    {
+        CommandBuffer * buffers[BENCHMARK_LANE_COUNT];
+        for (int lane = 0; lane < BENCHMARK_LANE_COUNT; ++lane)
+        {
+            buffers[lane] = &mLanes->mBuffers[lane];
+        }
+
+        for (int f = 0; f < BENCHMARK_LANE_FRAME_COUNT; ++f)
+        {
+            mLog->Clear();
+            CleanInternalState();
+            Core::ParallelFor(BENCHMARK_LANE_COUNT, 1, *mLanes);
+            CommandBuffer::Submit(buffers, BENCHMARK_LANE_COUNT);
+            for (int lane = 0; lane < BENCHMARK_LANE_COUNT; ++lane)
+            {
+                buffers[lane]->Reset();
+            }
+        }
+    }
+};
+
+//! Uniforms bound by every draw of the uniform binding frames
+const int UNIFORM_BINDINGS_PER_DRAW = 4;
+
+//! Vertex shader of the uniform binding program, set again to link the program again
+const char UNIFORM_BINDING_VS_SOURCE[] = "float4 main(float4 p : POSITION) : SV_Position { return p * 2.0; }";
+
+//! Program of UNIFORM_LOCATION_NAME_COUNT uniforms, a few of them bound by every draw the way
+//! the render function of a script binds them
+struct UniformBindingFrame
+{
+    NullSubmissionScene * mScene;
+    Shader::ShaderStageRef mVertexShader;
+    Shader::ProgramLinkageRef mProgram;
+    char mNames[UNIFORM_LOCATION_NAME_COUNT][PEGASUS_RENDER_MAX_UNIFORM_NAME_LEN];
+    Uniform mUniforms[UNIFORM_LOCATION_NAME_COUNT];
+
+    //! True to get the location of every uniform bound, false to bind the locations found once
+    bool mLocateEveryDraw;
+
+    explicit UniformBindingFrame(NullSubmissionScene * scene)
+    :   mScene(scene), mLocateEveryDraw(false)
+    {
+        static const char psSource[] = "float4 main() : SV_Target { return 0.25; }";
+        mVertexShader = scene->mShaderManager->CreateShader();
+        mVertexShader->SetSource(Shader::VERTEX, UNIFORM_BINDING_VS_SOURCE, sizeof(UNIFORM_BINDING_VS_SOURCE));
+        Shader::ShaderStageRef pixelShader = scene->mShaderManager->CreateShader();
+        pixelShader->SetSource(Shader::FRAGMENT, psSource, sizeof(psSource));
+        mProgram = scene->mShaderManager->CreateProgram();
+        mProgram->SetShaderStage(mVertexShader);
+        mProgram->SetShaderStage(pixelShader);
+
+        for (int u = 0; u < UNIFORM_LOCATION_NAME_COUNT; ++u)
+        {
+            GetBenchmarkUniformName(u, mNames[u]);
+            GetUniformLocation(mProgram, mNames[u], mUniforms[u]);
+        }
+    }
+
+    //! Set the source of the vertex shader again, the program links again before its next use
+    void Relink()
+    {
+        mVertexShader->SetSource(Shader::VERTEX, UNIFORM_BINDING_VS_SOURCE, sizeof(UNIFORM_BINDING_VS_SOURCE));
+    }
+
+    void SubmitFrame()
+    {
+        CleanInternalState();
+        SetProgram(mProgram);
+        SetMesh(mScene->mQuad);
+        for (int d = 0; d < BENCHMARK_DRAW_COUNT; ++d)
+        {
+            for (int b = 0; b < UNIFORM_BINDINGS_PER_DRAW; ++b)
+            {
+                const int u = (d * UNIFORM_BINDINGS_PER_DRAW + b) % UNIFORM_LOCATION_NAME_COUNT;
+                Uniform uniform;
+                if (mLocateEveryDraw)
+                {
+                    GetUniformLocation(mProgram, mNames[u], uniform);
+                }
+                else
+                {
+                    //the scripts pass the uniform by value, a location found again is not kept
+                    uniform = mUniforms[u];
+                }
+                SetUniformBuffer(uniform, mScene->mObjectBuffer);
+            }
+            Draw();
+        }
+        UnbindMesh();
+    }
+};
+
+//! Submission of BENCHMARK_FRAME_COUNT uniform binding frames
+struct UniformBindingRun
+{
+    UniformBindingFrame * mFrame;
+    NullCommandLog * mLog;
+
+    void operator()()
+    {
+        for (int f = 0; f < BENCHMARK_FRAME_COUNT; ++f)
+        {
+            mLog->Clear();
+            mFrame->SubmitFrame();
+        }
+    }
+};
+
+//! Number of lanes of the timeline benchmark, one block per lane
+const int BENCHMARK_TIMELINE_LANE_COUNT = 16;
+
+//! Lane of the block resolving its uniform location in its render, which keeps it on the main thread
+const int BENCHMARK_TIMELINE_RESOLVING_LANE = 5;
+
+//! Draws of the render of each block, and frames of a measured run of the timeline
+const int BENCHMARK_TIMELINE_DRAW_COUNT = 32;
+const int BENCHMARK_TIMELINE_FRAME_COUNT = 8;
+
+//! Path of the program of the block scripts, created in memory by the benchmark
+const char BENCHMARK_TIMELINE_PROGRAM_PATH[] = "Benchmark/TimelineLane.pas";
+
+//! Globals of the block scripts: the program, the constants and the quad of the draws, created when the blocks initialize
+#define BENCHMARK_TIMELINE_SCRIPT_GLOBALS \
+    "struct ObjectConstants\n" \
+    "{\n" \
+    "    row0 : float4;\n" \
+    "    row1 : float4;\n" \
+    "    row2 : float4;\n" \
+    "    row3 : float4;\n" \
+    "};\n" \
+    "gConstants = ObjectConstants();\n" \
+    "gProgram = LoadProgram(\"Benchmark/TimelineLane.pas\");\n" \
+    "gObjectUniform = GetUniformLocation(gProgram, \"objectConstants\");\n" \
+    "gObjectBuffer = CreateUniformBuffer(sizeof(ObjectConstants));\n" \
+    "gQuadGenerator = CreateMeshGenerator(\"QuadGenerator\");\n" \
+    "gQuad = CreateMesh();\n" \
+    "gQuad->SetGeneratorInput(gQuadGenerator);\n" \
+    "float Place(seed : float)\n" \
+    "{\n" \
+    "    acc = 0.0;\n" \
+    "    i = 0;\n" \
+    "    while (i < 64)\n" \
+    "    {\n" \
+    "        acc = acc + sin(seed + acc) * 0.5;\n" \
+    "        i = i + 1;\n" \
+    "    }\n" \
+    "    return acc;\n" \
+    "}\n"
+
+//! Draws of the render of the block scripts, the script places every object it draws
+#define BENCHMARK_TIMELINE_SCRIPT_DRAWS \
+    "    SetProgram(gProgram);\n" \
+    "    SetMesh(gQuad);\n" \
+    "    d = 0;\n" \
+    "    while (d < 32)\n" \
+    "    {\n" \
+    "        offset = Place(info.beat + (float)d * 0.01);\n" \
+    "        gConstants.row0 = float4(1.0, 0.0, 0.0, offset);\n" \
+    "        gConstants.row1 = float4(0.0, 1.0, 0.0, 0.0 - offset);\n" \
+    "        gConstants.row2 = float4(0.0, 0.0, 1.0, 0.0);\n" \
+    "        gConstants.row3 = float4(0.0, 0.0, 0.0, 1.0);\n" \
+    "        SetBuffer(gObjectBuffer, gConstants);\n" \
+    "        SetUniformBuffer(gObjectUniform, gObjectBuffer);\n" \
+    "        Draw();\n" \
+    "        d = d + 1;\n" \
+    "    }\n" \
+    "    return 0;\n"
+
+//! Script of the blocks recorded on the worker threads
+const char* BENCHMARK_TIMELINE_SCRIPT =
+    BENCHMARK_TIMELINE_SCRIPT_GLOBALS
+    "int Timeline_Render(info : RenderInfo)\n"
+    "{\n"
+    BENCHMARK_TIMELINE_SCRIPT_DRAWS
+    "}\n";
+
+//! Script of the block resolving its uniform location every render, so rendering on the main thread
+const char* BENCHMARK_TIMELINE_RESOLVING_SCRIPT =
+    BENCHMARK_TIMELINE_SCRIPT_GLOBALS
+    "int Timeline_Render(info : RenderInfo)\n"
+    "{\n"
+    "    gObjectUniform = GetUniformLocation(gProgram, \"objectConstants\");\n"
+    BENCHMARK_TIMELINE_SCRIPT_DRAWS
+    "}\n";
+
+//! Script of the blocks of the snapshot benchmark: the update animates the extends of a quad generator, the render
+//! clears with them, halves them and clears with what it reads back. The generator is the last one of the script.
+const char* BENCHMARK_TIMELINE_SNAPSHOT_SCRIPT =
+    BENCHMARK_TIMELINE_SCRIPT_GLOBALS
+    "gAnimated = CreateMeshGenerator(\"QuadGenerator\");\n"
+    "int Timeline_Update(info : UpdateInfo)\n"
+    "{\n"
+    "    p = Place(info.beat);\n"
+    "    gAnimated.QuadExtends = float2(0.5 + 0.25 * sin(p), 0.5 + 0.25 * cos(p));\n"
+    "    return 0;\n"
+    "}\n"
+    "int Timeline_Render(info : RenderInfo)\n"
+    "{\n"
+    "    e = gAnimated.QuadExtends;\n"
+    "    SetClearColorValue(float4(e.x, e.y, 0.0, 1.0));\n"
+    "    gAnimated.QuadExtends = e * 0.5;\n"
+    "    h = gAnimated.QuadExtends;\n"
+    "    SetClearColorValue(float4(h.x, h.y, 0.0, 1.0));\n"
+    BENCHMARK_TIMELINE_SCRIPT_DRAWS
+    "}\n";
+
+//! Number of errors logged while the timeline benchmark runs, by the scripts of any thread
+volatile long sTimelineErrorCount = 0;
+
+//! Log handler of the application of the timeline benchmark, counting the errors
+void TimelineBenchmarkLogHandler(Core::LogChannel logChannel, const char* msgStr)
+{
+    if (logChannel == 'ERR_')
+    {
+        Core::AtomicIncrement(&sTimelineErrorCount);
+    }
+}
+
+//! Application without a window, giving the timeline of the benchmark its managers and the render API of its scripts
+class TimelineBenchmarkApp : public App::Application
+{
+public:
+    explicit TimelineBenchmarkApp(const App::ApplicationConfig& config)
+    : App::Application(config)
+    {
+        // Done by Load() in an application, the scripts include their libraries when they are created
+        GetTimelineManager()->GetLibs().PushEmpty() = GetRenderBsApi();
+    }
+
+    virtual ~TimelineBenchmarkApp() {}
+
+    virtual const char* GetAppName() const { return "Benchmarks"; }
+
+protected:
+    virtual void InitializeApp() {}
+    virtual void ShutdownApp() {}
+};
+
+//! Timeline of script heavy lanes played by a headless application, one block per lane covering the whole timeline.
+//! The application sets up its own worker threads, the ones of the benchmarks are stopped while it exists.
+struct TimelineLanesScene
+{
+    TimelineBenchmarkApp * mApp;
+    Shader::ProgramLinkageRef mProgram;
+    Timeline::TimelineRef mTimeline;
+    Timeline::Block * mBlocks[BENCHMARK_TIMELINE_LANE_COUNT];
+    bool mScriptsActive;
+
+    //! \param script source of the script of every block, nullptr for BENCHMARK_TIMELINE_SCRIPT
+    //!               and BENCHMARK_TIMELINE_RESOLVING_SCRIPT on BENCHMARK_TIMELINE_RESOLVING_LANE
+    explicit TimelineLanesScene(const char * script = nullptr)
+    : mScriptsActive(true)
+    {
+        Core::ShutdownParallelFor();
+
+        App::ApplicationConfig config;
+        config.mBasePath = ".";
+#if PEGASUS_ENABLE_LOG
+        config.mLoghandler = TimelineBenchmarkLogHandler;
+#endif
+        mApp = PG_NEW(Memory::GetGlobalAllocator(), -1, "Benchmark application", Alloc::PG_MEM_TEMP) TimelineBenchmarkApp(config);
+
+        // The program loaded by the scripts only exists in memory, the null backend does not compile, any source links
+        AssetLib::AssetLib * assetLib = mApp->GetAssetLib();
+        assetLib->SetParallelLoading(false);
+        Shader::ProgramLinkageRef program = assetLib->CreateObject(BENCHMARK_TIMELINE_PROGRAM_PATH, &ASSET_TYPE_PROGRAM);
+        mProgram = program;
+        static const char vsSource[] = "float4 main(float4 p : POSITION) : SV_Position { return p; }";
+        static const char psSource[] = "float4 main() : SV_Target { return 1.0; }";
+        Shader::ShaderStageRef vertexShader = mApp->GetShaderManager()->CreateShader();
+        vertexShader->SetSource(Shader::VERTEX, vsSource, sizeof(vsSource));
+        Shader::ShaderStageRef pixelShader = mApp->GetShaderManager()->CreateShader();
+        pixelShader->SetSource(Shader::FRAGMENT, psSource, sizeof(psSource));
+        mProgram->SetShaderStage(vertexShader);
+        mProgram->SetShaderStage(pixelShader);
+
+        Timeline::TimelineManager * timelineManager = mApp->GetTimelineManager();
+        mTimeline = timelineManager->CreateTimeline();
+        const Timeline::Duration duration = mTimeline->GetNumBeats() * mTimeline->GetNumTicksPerBeat();
+        for (int l = 0; l < BENCHMARK_TIMELINE_LANE_COUNT; ++l)
+        {
+            Timeline::Lane * lane = (l == 0) ? mTimeline->GetLane(0) : mTimeline->CreateLane();
+            const char * source = (script != nullptr) ? script
+                                : (l == BENCHMARK_TIMELINE_RESOLVING_LANE) ? BENCHMARK_TIMELINE_RESOLVING_SCRIPT : BENCHMARK_TIMELINE_SCRIPT;
+            Timeline::TimelineScriptRef script = timelineManager->CreateScript();
+            script->SetSource(source, static_cast<int>(Utils::Strlen(source)));
+
+            mBlocks[l] = mTimeline->CreateBlock("Block");
+            mBlocks[l]->AttachScript(script);
+            lane->InsertBlock(mBlocks[l], 0, duration);
+            mScriptsActive = mScriptsActive && script->IsScriptActive();
+        }
+        mTimeline->InitializeBlocks();
+        mTimeline->SetPlayMode(Timeline::PLAYMODE_FIXED_STEP);
+    }
+
+    ~TimelineLanesScene()
+    {
+        // The timeline manager of the application destroys the timeline and its blocks
+        mTimeline = nullptr;
+        mProgram = nullptr;
+        PG_DELETE(Memory::GetGlobalAllocator(), mApp);
+
+        Core::InitializeParallelFor();
+    }
+};
+
+//! Update and render of BENCHMARK_TIMELINE_FRAME_COUNT frames of the timeline, from its start
+struct TimelineFramesRun
+{
+    Timeline::Timeline * mTimeline;
+    NullCommandLog * mLog;
+
+    void operator()()
+    {
+        mTimeline->SetCurrentBeat(0.0f);
+        for (int f = 0; f < BENCHMARK_TIMELINE_FRAME_COUNT; ++f)
+        {
+            mLog->Clear();
+            mTimeline->Update();
+            mTimeline->Render(0, 1280, 720);
+        }
+    }
+};
+
+//! Updates of the offline evaluation of the timeline, and frames updated and rendered for the trace
+const unsigned int BENCHMARK_TIMELINE_UPDATE_ONLY_FRAME_COUNT = 1024;
+const unsigned int BENCHMARK_TIMELINE_TRACE_FRAME_COUNT = 64;
+
+//! Path of the trace of the timeline benchmark, relative to the working directory
+const char BENCHMARK_TIMELINE_TRACE_PATH[] = "TimelineBenchmarkTrace.csv";
+
+//! Offline evaluation of the timeline: updates at the fixed step from its start, no render, traced
+struct TimelineUpdateOnlyRun
+{
+    Timeline::Timeline * mTimeline;
+    Timeline::TimelineTrace * mTrace;
+
+    void operator()()
+    {
+        mTrace->Clear();
+        mTimeline->SetCurrentBeat(0.0f);
+        mTimeline->RunUpdateOnly(BENCHMARK_TIMELINE_UPDATE_ONLY_FRAME_COUNT);
+    }
+};
+
+//! Clear color component recorded by the null backend, in 1/255 units rounded to the nearest
+int ClearColorToFixed(float value)
+{
+    return static_cast<int>(value * 255.0f + ((value >= 0.0f) ? 0.5f : -0.5f));
+}
+
+//! Frames of the snapshot benchmark, with the hash of the command log of each frame
+struct TimelineSnapshotFrames
+{
+    Timeline::Timeline * mTimeline;
+    NullCommandLog * mLog;
+    Mesh::QuadGenerator * mGenerators[BENCHMARK_TIMELINE_LANE_COUNT];
+    unsigned int mHashes[BENCHMARK_TIMELINE_FRAME_COUNT];
+
+    //! Finds the animated generator of each block
+    //! \return true when every block has one
+    bool Initialize(Timeline::Timeline * timeline, NullCommandLog * log, Timeline::Block * const * blocks)
+    {
+        mTimeline = timeline;
+        mLog = log;
+        for (int l = 0; l < BENCHMARK_TIMELINE_LANE_COUNT; ++l)
+        {
+            Application::RenderCollection * collection = blocks[l]->GetScriptRunner().GetRenderCollection();
+            const int generatorCount = Application::RenderCollection::ResourceCount<Mesh::MeshGenerator>(collection);
+            mGenerators[l] = (generatorCount > 0) ? static_cast<Mesh::QuadGenerator*>(Application::RenderCollection::GetResource<Mesh::MeshGenerator>(collection, generatorCount - 1)) : nullptr;
+            if (mGenerators[l] == nullptr)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //! Updates and renders the frames from the start of the timeline
+    //! \param edit true to overwrite the animated extends in between the update and the render of each frame
+    //! \param check true to check the clear colors of each frame against the extends written by the update
+    void Run(bool edit, bool check)
+    {
+        mTimeline->SetCurrentBeat(0.0f);
+        for (int f = 0; f < BENCHMARK_TIMELINE_FRAME_COUNT; ++f)
+        {
+            mLog->Clear();
+            mTimeline->Update();
+
+            Math::Vec2 updated[BENCHMARK_TIMELINE_LANE_COUNT];
+            for (int l = 0; l < BENCHMARK_TIMELINE_LANE_COUNT; ++l)
+            {
+                updated[l] = mGenerators[l]->GetQuadExtends();
+                if (edit)
+                {
+                    mGenerators[l]->SetQuadExtends(Math::Vec2(-1.0f - static_cast<float>(f), 2.0f + static_cast<float>(l)));
+                }
+            }
+
+            mTimeline->Render(0, 1280, 720);
+            mHashes[f] = mLog->ComputeHash();
+            if (check)
+            {
+                CheckClearColors(f, updated);
+            }
+        }
+    }
+
+    //! Checks each lane cleared with the extends of its update, then with the half it wrote in its render
+    void CheckClearColors(int frame, const Math::Vec2 * updated) const
+    {
+        int clearCount = 0;
+        for (unsigned int c = 0; c < mLog->GetCommandCount(); ++c)
+        {
+            const NullCommand & command = mLog->GetCommand(c);
+            if (command.mType != NULL_CMD_SET_CLEAR_COLOR)
+            {
+                continue;
+            }
+            if (clearCount < 2 * BENCHMARK_TIMELINE_LANE_COUNT)
+            {
+                const int lane = clearCount / 2;
+                const float scale = ((clearCount & 1) == 0) ? 1.0f : 0.5f;
+                const int expectedX = ClearColorToFixed(updated[lane].x * scale);
+                const int expectedY = ClearColorToFixed(updated[lane].y * scale);
+                if (command.mArgs[0] != expectedX || command.mArgs[1] != expectedY)
+                {
+                    BenchmarkReportError("frame %d, lane %d cleared with (%d, %d), expected (%d, %d) %s", frame, lane,
+                                         command.mArgs[0], command.mArgs[1], expectedX, expectedY,
+                                         (scale == 1.0f) ? "from its update" : "from its own render write");
+                }
+            }
+            ++clearCount;
+        }
+        if (clearCount != 2 * BENCHMARK_TIMELINE_LANE_COUNT)
+        {
+            BenchmarkReportError("frame %d cleared %d times, expected %d", frame, clearCount, 2 * BENCHMARK_TIMELINE_LANE_COUNT);
+        }
+    }
+};
+
+//! Measured run of the snapshot benchmark, neither edited nor checked
+struct TimelineSnapshotRun
+{
+    TimelineSnapshotFrames * mFrames;
+
+    void operator()()
+    {
+        mFrames->Run(false, false);
+    }
+};
+
+}   // anonymous namespace
+
+void BENCHMARK_RenderNullSubmission()
+{
+    NullCommandLog * log = GetNullCommandLog();
+    NullSubmissionScene scene;
+
+    // Golden log check, two submissions of the same frame record the same commands
+    log->SetRecording(true);
+    log->Clear();
+    scene.SubmitFrame();
+    const unsigned int hash0 = log->ComputeHash();
+    const unsigned int commandCount = log->GetCommandCount();
+    const unsigned int drawCount = log->GetCount(NULL_CMD_DRAW);
+    const unsigned int stateChangeCount = log->GetStateChangeCount();
+    const unsigned int errorCount = log->GetErrorCount();
+    log->Clear();
+    scene.SubmitFrame();
+    const unsigned int hash1 = log->ComputeHash();
+
+    printf("  Frame: %u commands, %u draws, %u state changes, %.2f calls per draw, hash 0x%08x\n",
+           commandCount, drawCount, stateChangeCount,
+           drawCount > 0 ? static_cast<double>(commandCount) / static_cast<double>(drawCount) : 0.0, hash0);
+    if (hash0 != hash1)
+    {
+        printf("  ERROR: command log of the same frame differs between two runs (0x%08x vs 0x%08x)\n", hash0, hash1);
+    }
+    if (errorCount != 0)
+    {
+        printf("  ERROR: %u validation errors in the benchmarked frame\n", errorCount);
+    }
+    if (drawCount != static_cast<unsigned int>(BENCHMARK_DRAW_COUNT))
+    {
+        printf("  ERROR: %u draws recorded, expected %d\n", drawCount, BENCHMARK_DRAW_COUNT);
+    }
+
+    // The validation has to catch a draw without a mesh
+    log->Clear();
+    CleanInternalState();
+    SetProgram(scene.mProgram);
+    Draw();
+    if (log->GetErrorCount(NULL_ERR_NO_MESH) != 1)
+    {
+        printf("  ERROR: draw without a mesh not detected by the null backend\n");
+    }
+
+    SubmitFramesRun run = { &scene, log };
+    const int totalDraws = BENCHMARK_DRAW_COUNT * BENCHMARK_FRAME_COUNT;
+
+    log->SetRecording(true);
+    const double recordSeconds = BenchmarkMeasure(run);
+    BenchmarkReport("Submission, recorded (draws)", recordSeconds, totalDraws);
+
+    log->SetRecording(false);
+    const double countSeconds = BenchmarkMeasure(run);
+    BenchmarkReport("Submission, counted only (draws)", countSeconds, totalDraws);
+    BenchmarkReportSpeedup("Counted only vs recorded", recordSeconds, countSeconds);
+
+    log->SetRecording(true);
+    log->Clear();
+}
+
+void BENCHMARK_RenderCommandBuffer()
+{
+    NullCommandLog * log = GetNullCommandLog();
+    NullSubmissionScene scene;
+    MixedStateFrame frame(&scene);
+    CommandBuffer buffer;
+
+    // Commands reaching the backend, immediate then deferred with and without the sort
+    log->SetRecording(true);
+    log->Clear();
+    ImmediateApi immediate;
+    frame.RecordFrame(immediate);
+    const unsigned int immediateCommandCount = log->GetCommandCount();
+    const unsigned int immediateStateChangeCount = log->GetStateChangeCount();
+    const unsigned int immediateDrawCount = log->GetCount(NULL_CMD_DRAW);
+    const unsigned int immediateErrorCount = log->GetErrorCount();
+
+    unsigned int deferredCommandCount[2];
+    unsigned int deferredStateChangeCount[2];
+    for (int sorted = 0; sorted < 2; ++sorted)
+    {
+        buffer.Reset();
+        buffer.SetSortDraws(sorted != 0);
+        frame.RecordFrame(buffer);
+        log->Clear();
+        buffer.Submit();
+        deferredCommandCount[sorted] = log->GetCommandCount();
+        deferredStateChangeCount[sorted] = log->GetStateChangeCount();
+
+        const CommandBufferStats & stats = buffer.GetStats();
+        printf("  Deferred %-8s: %u commands recorded, %u submitted, %u filtered, %u segments\n",
+               sorted ? "sorted" : "unsorted", stats.mRecordedCommandCount, stats.mSubmittedCommandCount, stats.mFilteredCommandCount, stats.mSegmentCount);
+        if (log->GetCount(NULL_CMD_DRAW) != immediateDrawCount)
+        {
+            printf("  ERROR: %u draws submitted by the command buffer, expected %u\n", log->GetCount(NULL_CMD_DRAW), immediateDrawCount);
+        }
+        if (log->GetErrorCount() != 0)
+        {
+            printf("  ERROR: %u validation errors in the command buffer submission\n", log->GetErrorCount());
+        }
+        //every draw has its own object constants, none of these writes can be filtered
+        if (log->GetCount(NULL_CMD_SET_BUFFER) < static_cast<unsigned int>(BENCHMARK_DRAW_COUNT))
+        {
+            printf("  ERROR: %u buffer writes submitted, at least %d expected\n", log->GetCount(NULL_CMD_SET_BUFFER), BENCHMARK_DRAW_COUNT);
+        }
+    }
+
+    // Draws without depth test depend on their order, each one gets a segment of its own
+    buffer.Reset();
+    buffer.SetSortDraws(true);
+    buffer.SetProgram(scene.mProgram);
+    buffer.SetMesh(scene.mQuad);
+    buffer.SetRasterizerState(scene.mRasterState);
+    for (int d = 0; d < MixedStateFrame::MATERIAL_COUNT; ++d)
+    {
+        buffer.Draw();
+    }
+    log->Clear();
+    buffer.Submit();
+    if (buffer.GetStats().mSegmentCount != static_cast<unsigned int>(MixedStateFrame::MATERIAL_COUNT))
+    {
+        printf("  ERROR: %u segments for %d draws without depth test, their order is not kept\n",
+               buffer.GetStats().mSegmentCount, MixedStateFrame::MATERIAL_COUNT);
+    }
+
+    // As in the render API, a uniform that was never located is rejected, and the uniforms stay bound when the program changes
+    Uniform unlocated;
+    log->Clear();
+    SetProgram(frame.mPrograms[0]);
+    SetUniformBuffer(frame.mObjectUniforms[0], scene.mObjectBuffer);
+    SetProgram(frame.mPrograms[1]);
+    SetMesh(scene.mQuad);
+    SetRasterizerState(scene.mRasterState);
+    Draw();
+    const unsigned int immediateUniformCount = log->GetCount(NULL_CMD_SET_UNIFORM_BUFFER);
+    buffer.Reset();
+    buffer.SetProgram(frame.mPrograms[0]);
+    if (buffer.SetUniformBuffer(unlocated, scene.mObjectBuffer))
+    {
+        BenchmarkReportError("the command buffer accepts a uniform that was never located");
+    }
+    if (!buffer.SetUniformBuffer(frame.mObjectUniforms[0], scene.mObjectBuffer))
+    {
+        BenchmarkReportError("the command buffer rejects a located uniform");
+    }
+    buffer.SetProgram(frame.mPrograms[1]);
+    buffer.SetMesh(scene.mQuad);
+    buffer.SetRasterizerState(scene.mRasterState);
+    buffer.Draw();
+    log->Clear();
+    buffer.Submit();
+    if (log->GetCount(NULL_CMD_SET_UNIFORM_BUFFER) != immediateUniformCount || immediateUniformCount == 0)
+    {
+        BenchmarkReportError("%u uniform buffers bound by the command buffer after a program change, %u by the render API",
+                             log->GetCount(NULL_CMD_SET_UNIFORM_BUFFER), immediateUniformCount);
+    }
+
+    printf("  Immediate        : %u commands, %u state changes per frame\n", immediateCommandCount, immediateStateChangeCount);
+    printf("  Deferred unsorted: %u commands, %u state changes per frame\n", deferredCommandCount[0], deferredStateChangeCount[0]);
+    printf("  Deferred sorted  : %u commands, %u state changes per frame\n", deferredCommandCount[1], deferredStateChangeCount[1]);
+    if (immediateErrorCount != 0)
+    {
+        printf("  ERROR: %u validation errors in the immediate frame\n", immediateErrorCount);
+    }
+    if (deferredCommandCount[1] >= immediateCommandCount)
+    {
+        printf("  ERROR: the sorted command buffer does not submit fewer commands than the immediate frame\n");
+    }
+
+    // CPU cost per frame, the log only counts the commands
+    log->SetRecording(false);
+    ImmediateFramesRun immediateRun = { &frame, log };
+    const double immediateSeconds = BenchmarkMeasure(immediateRun);
+    printf("  %-40s %10.2f us per frame\n", "Immediate submission", immediateSeconds * 1000000.0 / BENCHMARK_FRAME_COUNT);
+
+    DeferredFramesRun deferredRun = { &frame, log, &buffer };
+    buffer.SetSortDraws(false);
+    const double unsortedSeconds = BenchmarkMeasure(deferredRun);
+    printf("  %-40s %10.2f us per frame\n", "Deferred record + submit, unsorted", unsortedSeconds * 1000000.0 / BENCHMARK_FRAME_COUNT);
+
+    buffer.SetSortDraws(true);
+    const double sortedSeconds = BenchmarkMeasure(deferredRun);
+    printf("  %-40s %10.2f us per frame\n", "Deferred record + submit, sorted", sortedSeconds * 1000000.0 / BENCHMARK_FRAME_COUNT);
+    BenchmarkReportSpeedup("Deferred sorted vs immediate", immediateSeconds, sortedSeconds);
+
+    buffer.Reset();
+    log->SetRecording(true);
+    log->Clear();
+}
+
+void BENCHMARK_RenderConcurrentLanes()
+{
+    NullCommandLog * log = GetNullCommandLog();
+    NullSubmissionScene scene;
+    MixedStateFrame frame(&scene);
+    ScriptLanesFrame lanes(&frame);
+    if (!lanes.mCompiled)
+    {
+        printf("  ERROR: the lane script did not compile!\n");
+        return;
+    }
+
+    const int totalDraws = BENCHMARK_LANE_COUNT * BENCHMARK_LANE_DRAW_COUNT * BENCHMARK_LANE_FRAME_COUNT;
+    printf("  %d lanes, %d draws per lane, one script call per draw\n", BENCHMARK_LANE_COUNT, BENCHMARK_LANE_DRAW_COUNT);
+
+    log->SetRecording(true);
+    SerialLanesRun serialRun = { &lanes, log };
+    const double serialSeconds = BenchmarkMeasure(serialRun);
+    BenchmarkReport("Serial lanes, immediate (draws)", serialSeconds, totalDraws);
+    const unsigned int serialDrawCount = log->GetCount(NULL_CMD_DRAW);
+    if (log->GetErrorCount() != 0)
+    {
+        printf("  ERROR: %u validation errors in the serial render of the lanes\n", log->GetErrorCount());
+    }
+
+    // The submission only depends on the recordings, the command log has to be identical for any thread count
+    ConcurrentLanesRun concurrentRun = { &lanes, log };
+    unsigned int expectedHash = 0;
+    double singleThreadSeconds = 0.0;
+    for (int threads = 1; threads <= Core::GetParallelForThreadCount(); ++threads)
+    {
+        Core::SetParallelForThreadLimit(threads);
+        const double seconds = BenchmarkMeasure(concurrentRun);
+
+        char label[64];
+        sprintf_s(label, sizeof(label), "Recorded lanes, %d thread(s) (draws)", threads);
+        BenchmarkReport(label, seconds, totalDraws);
+        if (log->GetCount(NULL_CMD_DRAW) != serialDrawCount)
+        {
+            printf("  ERROR: %u draws submitted by the recorded lanes, expected %u\n", log->GetCount(NULL_CMD_DRAW), serialDrawCount);
+        }
+        if (log->GetErrorCount() != 0)
+        {
+            printf("  ERROR: %u validation errors in the submission of the recorded lanes\n", log->GetErrorCount());
+        }
+
+        if (threads == 1)
+        {
+            singleThreadSeconds = seconds;
+            expectedHash = log->ComputeHash();
+            BenchmarkReportSpeedup("Speedup vs serial lanes", serialSeconds, seconds);
+        }
+        else
+        {
+            BenchmarkReportSpeedup("Speedup vs 1 thread", singleThreadSeconds, seconds);
+            BenchmarkReportSpeedup("Speedup vs serial lanes", serialSeconds, seconds);
+            if (log->ComputeHash() != expectedHash)
+            {
+                printf("  ERROR: command log differs from the single thread recording (0x%08x vs 0x%08x)\n", log->ComputeHash(), expectedHash);
+            }
+        }
+    }
+    Core::SetParallelForThreadLimit(0);
+
+    log->Clear();
+}
+
+void BENCHMARK_RenderTimelineLanes()
+{
+    NullCommandLog * log = GetNullCommandLog();
+    sTimelineErrorCount = 0;
+    TimelineLanesScene scene;
+    if (!scene.mScriptsActive)
+    {
+        printf("  ERROR: the block scripts did not compile!\n");
+        return;
+    }
+
+    Timeline::Timeline * timeline = scene.mTimeline;
+    const int frameDraws = BENCHMARK_TIMELINE_LANE_COUNT * BENCHMARK_TIMELINE_DRAW_COUNT;
+    const int totalDraws = frameDraws * BENCHMARK_TIMELINE_FRAME_COUNT;
+    printf("  %d lanes of one block, %d draws per block, one script call per draw\n", BENCHMARK_TIMELINE_LANE_COUNT, BENCHMARK_TIMELINE_DRAW_COUNT);
+
+    log->SetRecording(true);
+    TimelineFramesRun run = { timeline, log };
+    timeline->SetConcurrentRender(false);
+    const double serialSeconds = BenchmarkMeasure(run);
+    BenchmarkReport("Serial lanes (draws)", serialSeconds, totalDraws);
+    const unsigned int serialDrawCount = log->GetCount(NULL_CMD_DRAW);
+    if (serialDrawCount != static_cast<unsigned int>(frameDraws))
+    {
+        printf("  ERROR: %u draws submitted by the serial render of the timeline, expected %d\n", serialDrawCount, frameDraws);
+    }
+    if (log->GetErrorCount() != 0)
+    {
+        printf("  ERROR: %u validation errors in the serial render of the timeline\n", log->GetErrorCount());
+    }
+
+    // The block resolving its uniform renders on the main thread in between the recordings,
+    // the command log has to be identical for any thread count
+    timeline->SetConcurrentRender(true);
+    unsigned int expectedHash = 0;
+    double singleThreadSeconds = 0.0;
+    for (int threads = 1; threads <= Core::GetParallelForThreadCount(); ++threads)
+    {
+        Core::SetParallelForThreadLimit(threads);
+        const double seconds = BenchmarkMeasure(run);
+
+        char label[64];
+        sprintf_s(label, sizeof(label), "Concurrent lanes, %d thread(s) (draws)", threads);
+        BenchmarkReport(label, seconds, totalDraws);
+        if (log->GetCount(NULL_CMD_DRAW) != serialDrawCount)
+        {
+            printf("  ERROR: %u draws submitted by the concurrent render of the timeline, expected %u\n", log->GetCount(NULL_CMD_DRAW), serialDrawCount);
+        }
+        if (log->GetErrorCount() != 0)
+        {
+            printf("  ERROR: %u validation errors in the concurrent render of the timeline\n", log->GetErrorCount());
+        }
+
+        if (threads == 1)
+        {
+            singleThreadSeconds = seconds;
+            expectedHash = log->ComputeHash();
+            BenchmarkReportSpeedup("Speedup vs serial lanes", serialSeconds, seconds);
+        }
+        else
+        {
+            BenchmarkReportSpeedup("Speedup vs 1 thread", singleThreadSeconds, seconds);
+            BenchmarkReportSpeedup("Speedup vs serial lanes", serialSeconds, seconds);
+            if (log->ComputeHash() != expectedHash)
+            {
+                printf("  ERROR: command log differs from the single thread render (0x%08x vs 0x%08x)\n", log->ComputeHash(), expectedHash);
+            }
+        }
+    }
+    Core::SetParallelForThreadLimit(0);
+
+    for (int l = 0; l < BENCHMARK_TIMELINE_LANE_COUNT; ++l)
+    {
+        const bool expectedConcurrent = (l != BENCHMARK_TIMELINE_RESOLVING_LANE);
+        if (scene.mBlocks[l]->CanRenderConcurrently() != expectedConcurrent)
+        {
+            printf("  ERROR: the block of lane %d %s\n", l, expectedConcurrent ? "does not record on the worker threads" : "records on the worker threads, its render resolves a uniform");
+        }
+    }
+    if (sTimelineErrorCount != 0)
+    {
+        printf("  ERROR: %ld errors logged by the block scripts\n", sTimelineErrorCount);
+    }
+
+    log->Clear();
+}
+
+void BENCHMARK_RenderTimelineFixedStep()
+{
+    NullCommandLog * log = GetNullCommandLog();
+    sTimelineErrorCount = 0;
+    TimelineLanesScene scene;
+    if (!scene.mScriptsActive)
+    {
+        printf("  ERROR: the block scripts did not compile!\n");
+        return;
+    }
+
+    Timeline::Timeline * timeline = scene.mTimeline;
+    Timeline::TimelineTrace trace(Memory::GetGlobalAllocator());
+    timeline->SetTrace(&trace);
+    timeline->SetConcurrentRender(true);
+    log->SetRecording(false);
+    printf("  %d lanes of one block, %.1f beats per minute, %.1f updates per second of the timeline\n",
+           BENCHMARK_TIMELINE_LANE_COUNT, timeline->GetBeatsPerMinute(), timeline->GetFixedStepFrameRate());
+
+    // Offline evaluation, the beats of the updates only depend on the tempo and the fixed step
+    TimelineUpdateOnlyRun updateOnlyRun = { timeline, &trace };
+    const double updateOnlySeconds = BenchmarkMeasure(updateOnlyRun);
+    BenchmarkReport("Updates only (frames)", updateOnlySeconds, static_cast<int>(BENCHMARK_TIMELINE_UPDATE_ONLY_FRAME_COUNT));
+    printf("  %-40s %10.1f fps\n", "Updates only, traced", trace.GetFramesPerSecond());
+    const unsigned int lastFrame = BENCHMARK_TIMELINE_UPDATE_ONLY_FRAME_COUNT - 1;
+    const float lastBeat = static_cast<float>(static_cast<double>(lastFrame) * static_cast<double>(timeline->GetFixedStep()));
+    if (trace.GetFrameCount() != BENCHMARK_TIMELINE_UPDATE_ONLY_FRAME_COUNT)
+    {
+        printf("  ERROR: %u frames traced by the updates only, expected %u\n", trace.GetFrameCount(), BENCHMARK_TIMELINE_UPDATE_ONLY_FRAME_COUNT);
+    }
+    else if (trace.GetFrame(lastFrame).mBeat != lastBeat)
+    {
+        printf("  ERROR: last update at beat %f, expected %f\n", trace.GetFrame(lastFrame).mBeat, lastBeat);
+    }
+
+    // Frames updated and rendered at the fixed step, the renders are part of the traced frames
+    trace.Clear();
+    timeline->SetCurrentBeat(0.0f);
+    for (unsigned int f = 0; f < BENCHMARK_TIMELINE_TRACE_FRAME_COUNT; ++f)
+    {
+        log->Clear();
+        timeline->Update();
+        timeline->Render(0, 1280, 720);
+    }
+    printf("  %-40s %10.1f fps\n", "Update and render, traced", trace.GetFramesPerSecond());
+    for (unsigned int f = 0; f < trace.GetFrameCount(); ++f)
+    {
+        if (trace.GetFrame(f).mRenderSeconds <= 0.0)
+        {
+            printf("  ERROR: no render traced in frame %u\n", f);
+            break;
+        }
+    }
+    timeline->SetTrace(nullptr);
+
+    // One line per frame after the header
+    Io::IOManager ioManager("");
+    if (trace.SaveCsv(&ioManager, BENCHMARK_TIMELINE_TRACE_PATH) != Io::ERR_NONE)
+    {
+        printf("  ERROR: could not write %s!\n", BENCHMARK_TIMELINE_TRACE_PATH);
+    }
+    else
+    {
+        Io::FileBuffer fileBuffer;
+        unsigned int lineCount = 0;
+        if (ioManager.OpenFileToBuffer(BENCHMARK_TIMELINE_TRACE_PATH, fileBuffer, true, Memory::GetGlobalAllocator()) == Io::ERR_NONE)
+        {
+            for (int c = 0; c < fileBuffer.GetFileSize(); ++c)
+            {
+                lineCount += (fileBuffer.GetBuffer()[c] == '\n') ? 1 : 0;
+            }
+        }
+        if (lineCount != trace.GetFrameCount() + 1)
+        {
+            printf("  ERROR: %u lines in %s, expected %u\n", lineCount, BENCHMARK_TIMELINE_TRACE_PATH, trace.GetFrameCount() + 1);
+        }
+        else
+        {
+            printf("  Trace of %u frames saved to %s\n", trace.GetFrameCount(), BENCHMARK_TIMELINE_TRACE_PATH);
+        }
+    }
+
+    if (sTimelineErrorCount != 0)
+    {
+        printf("  ERROR: %ld errors logged by the block scripts\n", sTimelineErrorCount);
+    }
+    log->SetRecording(true);
+    log->Clear();
+}
+
+void BENCHMARK_RenderTimelineSnapshot()
+{
+    NullCommandLog * log = GetNullCommandLog();
+    sTimelineErrorCount = 0;
+    TimelineLanesScene scene(BENCHMARK_TIMELINE_SNAPSHOT_SCRIPT);
+    if (!scene.mScriptsActive)
+    {
+        BenchmarkReportError("the block scripts did not compile!");
+        return;
+    }
+
+    TimelineSnapshotFrames frames;
+    if (!frames.Initialize(scene.mTimeline, log, scene.mBlocks))
+    {
+        BenchmarkReportError("a block script did not create its animated quad generator");
+        return;
+    }
+    printf("  %d lanes of one block, the render reads the node animated by the update from the snapshot\n", BENCHMARK_TIMELINE_LANE_COUNT);
+
+    log->SetRecording(true);
+    scene.mTimeline->SetConcurrentRender(true);
+    TimelineSnapshotRun run = { &frames };
+    const double seconds = BenchmarkMeasure(run);
+    BenchmarkReport("Snapshot and concurrent render (frames)", seconds, BENCHMARK_TIMELINE_FRAME_COUNT);
+
+    // Reference frames, then the same frames with the live nodes edited in between the update and the render:
+    // the renders read the snapshots of the updates, so the submission is identical
+    unsigned int referenceHashes[BENCHMARK_TIMELINE_FRAME_COUNT];
+    frames.Run(false, true);
+    for (int f = 0; f < BENCHMARK_TIMELINE_FRAME_COUNT; ++f)
+    {
+        referenceHashes[f] = frames.mHashes[f];
+    }
+    frames.Run(true, true);
+    for (int f = 0; f < BENCHMARK_TIMELINE_FRAME_COUNT; ++f)
+    {
+        if (frames.mHashes[f] != referenceHashes[f])
+        {
+            BenchmarkReportError("frame %d submitted differently with the nodes edited before its render (0x%08x vs 0x%08x)", f, frames.mHashes[f], referenceHashes[f]);
+        }
+    }
+
+    if (log->GetErrorCount() != 0)
+    {
+        BenchmarkReportError("%u validation errors in the render of the timeline", log->GetErrorCount());
+    }
+    if (sTimelineErrorCount != 0)
+    {
+        BenchmarkReportError("%ld errors logged by the block scripts", sTimelineErrorCount);
+    }
+
+    log->Clear();
+}
+
+//! Frames of the benchmark scene with the object constants in a transient uniform buffer, against a dedicated buffer
+static void RunTransientUniformBufferFrames()
+{
+    NullCommandLog * log = GetNullCommandLog();
+    NullSubmissionScene scene;
+    SubmitFramesRun run = { &scene, log };
+    const int totalDraws = BENCHMARK_DRAW_COUNT * BENCHMARK_FRAME_COUNT;
+
+    log->SetRecording(false);
+    const double dedicatedSeconds = BenchmarkMeasure(run);
+
+    // Every write of the frame takes a range of the ring, the frame has to validate
+    scene.mObjectBuffer = CreateUniformBuffer(sizeof(Math::Vec4) * 4, true);
+    const unsigned int allocationCount = GetUniformRing().GetStats().mAllocationCount;
+    log->SetRecording(true);
+    log->Clear();
+    scene.SubmitFrame();
+    const unsigned int frameAllocationCount = GetUniformRing().GetStats().mAllocationCount - allocationCount;
+    if (log->GetErrorCount() != 0)
+    {
+        printf("  ERROR: %u validation errors in the frame with a transient uniform buffer\n", log->GetErrorCount());
+    }
+    if (frameAllocationCount != static_cast<unsigned int>(BENCHMARK_DRAW_COUNT))
+    {
+        printf("  ERROR: %u ranges of the uniform ring allocated by the frame, expected %d\n", frameAllocationCount, BENCHMARK_DRAW_COUNT);
+    }
+
+    // The frame ended with the swap, binding the buffer without writing it again is an error
+    log->Clear();
+    CleanInternalState();
+    SetProgram(scene.mProgram);
+    SetUniformBuffer(scene.mObjectUniform, scene.mObjectBuffer);
+    if (log->GetErrorCount(NULL_ERR_STALE_TRANSIENT_BUFFER) != 1)
+    {
+        printf("  ERROR: transient uniform buffer bound after the end of its frame not detected by the null backend\n");
+    }
+
+    log->SetRecording(false);
+    const double transientSeconds = BenchmarkMeasure(run);
+    BenchmarkReport("Frames, dedicated uniform buffer (draws)", dedicatedSeconds, totalDraws);
+    BenchmarkReport("Frames, transient uniform buffer (draws)", transientSeconds, totalDraws);
+
+    log->SetRecording(true);
+    log->Clear();
+}
+
+//! Uniform bindings of the frames of a program of many uniforms: locations found every draw, locations found once,
+//! and locations found once then used after the program linked again
+static void RunScriptedUniformBinding()
+{
+    NullCommandLog * log = GetNullCommandLog();
+    NullSubmissionScene scene;
+    UniformBindingFrame frame(&scene);
+    UniformBindingRun run = { &frame, log };
+    const int totalBindings = BENCHMARK_DRAW_COUNT * UNIFORM_BINDINGS_PER_DRAW * BENCHMARK_FRAME_COUNT;
+
+    log->SetRecording(false);
+    frame.mLocateEveryDraw = true;
+    const double locateSeconds = BenchmarkMeasure(run);
+    frame.mLocateEveryDraw = false;
+    const double cachedSeconds = BenchmarkMeasure(run);
+
+    // Once the program linked again, the locations found before are found again from the name hash
+    frame.Relink();
+    log->SetRecording(true);
+    log->Clear();
+    frame.SubmitFrame();
+    if (log->GetErrorCount() != 0)
+    {
+        printf("  ERROR: %u validation errors binding the uniforms after the program linked again\n", log->GetErrorCount());
+    }
+    for (int u = 0; u < UNIFORM_LOCATION_NAME_COUNT; ++u)
+    {
+        Uniform relocated;
+        Uniform stale = frame.mUniforms[u];
+        GetUniformLocation(frame.mProgram, frame.mNames[u], relocated);
+        if (!SetUniformBuffer(stale, scene.mObjectBuffer) || stale.mInternalIndex != relocated.mInternalIndex || stale.mInternalVersion != relocated.mInternalVersion)
+        {
+            printf("  ERROR: location of %s not found again after the program linked again\n", frame.mNames[u]);
+            break;
+        }
+    }
+
+    log->SetRecording(false);
+    const double staleSeconds = BenchmarkMeasure(run);
+    BenchmarkReport("Location found every draw (bindings)", locateSeconds, totalBindings);
+    BenchmarkReport("Location found once (bindings)", cachedSeconds, totalBindings);
+    BenchmarkReport("Location found before a relink (bindings)", staleSeconds, totalBindings);
+    BenchmarkReportSpeedup("Found once vs found every draw", locateSeconds, cachedSeconds);
+
+    log->SetRecording(true);
+    log->Clear();
+}
+
+#else
+
+void BENCHMARK_RenderNullSubmission()
+{
+    printf("  Skipped, requires the render library built with the null backend (Dev-Null configuration)\n");
+}
+
+void BENCHMARK_RenderCommandBuffer()
+{
+    printf("  Skipped, requires the render library built with the null backend (Dev-Null configuration)\n");
+}
+
+void BENCHMARK_RenderConcurrentLanes()
+{
+    printf("  Skipped, requires the render library built with the null backend (Dev-Null configuration)\n");
+}
+
+void BENCHMARK_RenderTimelineLanes()
+{
+    printf("  Skipped, requires the render library built with the null backend (Dev-Null configuration)\n");
+}
+
+void BENCHMARK_RenderTimelineFixedStep()
+{
+    printf("  Skipped, requires the render library built with the null backend (Dev-Null configuration)\n");
+}
+
+void BENCHMARK_RenderTimelineSnapshot()
+{
+    printf("  Skipped, requires the render library built with the null backend (Dev-Null configuration)\n");
+}
+
+static void RunTransientUniformBufferFrames()
+{
+    printf("  Transient uniform buffer frames skipped, requires the render library built with the null backend (_PEGASUS_GAPI_NULL)\n");
+}
+
+static void RunScriptedUniformBinding()
+{
+    printf("  Uniform binding frames skipped, requires the render library built with the null backend (_PEGASUS_GAPI_NULL)\n");
+}
+
+#endif
+
+namespace
+{
+
+//! Uniform ring of the bookkeeping check, small so the allocations wrap and fill it
+const unsigned int RING_CHECK_CAPACITY = 64 * 1024;
+const unsigned int RING_CHECK_ALIGNMENT = 256;
+const unsigned int RING_CHECK_LATENCY = 3;
+const int RING_CHECK_FRAME_COUNT = 512;
+
+//! Uniform ring of the upload run, the size of the ring of the backends, written by the draws of the frames
+const unsigned int RING_UPLOAD_CAPACITY = 1024 * 1024;
+const unsigned int RING_UPLOAD_LATENCY = 2;
+const int RING_UPLOAD_DRAW_COUNT = 512;
+const int RING_UPLOAD_FRAME_COUNT = 64;
+
+//! Range given by the uniform ring, the GPU reads it until its frame retires
+struct RingRange
+{
+    unsigned int mOffset;
+    unsigned int mSize;
+    unsigned int mFence;
+};
+
+//! Memory standing for the persistently mapped buffer of the upload run
+char gRingUploadMemory[RING_UPLOAD_CAPACITY];
+
+//! Allocation and copy of the constants of RING_UPLOAD_DRAW_COUNT draws per frame, frames retired after
+//! RING_UPLOAD_LATENCY frames, what a backend does for the transient uniform buffers
+struct RingUploadRun
+{
+    UniformRing * mRing;
+
+    void operator()()
+    {
+        float constants[16];
+        for (int f = 0; f < RING_UPLOAD_FRAME_COUNT; ++f)
+        {
+            for (int d = 0; d < RING_UPLOAD_DRAW_COUNT; ++d)
+            {
+                constants[0] = static_cast<float>(d);
+                constants[15] = static_cast<float>(f);
+                unsigned int offset = 0;
+                while (!mRing->Allocate(sizeof(constants), offset))
+                {
+                    mRing->RetireFrame();
+                }
+                Utils::Memcpy(gRingUploadMemory + offset, constants, sizeof(constants));
+            }
+            mRing->EndFrame();
+            while (mRing->GetPendingFrameCount() > RING_UPLOAD_LATENCY)
+            {
+                mRing->RetireFrame();
+            }
+        }
+    }
+};
+
+//! Pseudo random sequence of the bookkeeping check, identical on every run
+unsigned int NextRandom(unsigned int & state)
+{
+    state = state * 1664525u + 1013904223u;
+    return state >> 8;
+}
+
+//! Simulate frames of random allocations on a small ring with a GPU completing the frames
+//! RING_CHECK_LATENCY frames late, checking every range against the ranges still in use
+//! \return Number of errors found
+int CheckUniformRingBookkeeping(UniformRingStats & outStats)
+{
+    //every live range is at least one alignment unit, so the ring never holds more of them
+    const unsigned int maxRangeCount = RING_CHECK_CAPACITY / RING_CHECK_ALIGNMENT;
+    RingRange ranges[RING_CHECK_CAPACITY / RING_CHECK_ALIGNMENT];
+    unsigned int firstRange = 0;
+    unsigned int rangeCount = 0;
+
+    UniformRing ring;
+    ring.Initialize(RING_CHECK_CAPACITY, RING_CHECK_ALIGNMENT);
+    unsigned int randomState = 1;
+    int errors = 0;
+
+    for (int f = 0; f < RING_CHECK_FRAME_COUNT && errors == 0; ++f)
+    {
+        const unsigned int allocationCount = 1 + NextRandom(randomState) % 48;
+        for (unsigned int a = 0; a < allocationCount && errors == 0; ++a)
+        {
+            //mostly small constant blocks, sometimes a large one so the ring fills and wraps
+            const unsigned int size = (NextRandom(randomState) % 8 == 0) ? 16 * (1 + NextRandom(randomState) % 256) : 16 * (1 + NextRandom(randomState) % 16);
+            const unsigned int alignedSize = (size + RING_CHECK_ALIGNMENT - 1) & ~(RING_CHECK_ALIGNMENT - 1);
+            unsigned int offset = 0;
+            bool allocated = true;
+            while (allocated && !ring.Allocate(size, offset))
+            {
+                if (ring.GetPendingFrameCount() == 0)
+                {
+                    //the current frame alone fills the ring, the frame goes on without this range
+                    if (ring.GetUsedBytes() + alignedSize <= RING_CHECK_CAPACITY / 2)
+                    {
+                        printf("  ERROR: uniform ring refused %u bytes with %u bytes in use\n", size, ring.GetUsedBytes());
+                        ++errors;
+                    }
+                    allocated = false;
+                    continue;
+                }
+
+                //wait for the GPU: the oldest frame retires, its ranges can be written again
+                const unsigned int fence = ring.GetOldestPendingFence();
+                ring.RetireFrame();
+                while (rangeCount > 0 && ranges[firstRange].mFence == fence)
+                {
+                    firstRange = (firstRange + 1) % maxRangeCount;
+                    --rangeCount;
+                }
+            }
+            if (ring.GetUsedBytes() > RING_CHECK_CAPACITY)
+            {
+                printf("  ERROR: uniform ring uses %u bytes of %u\n", ring.GetUsedBytes(), RING_CHECK_CAPACITY);
+                ++errors;
+            }
+            if (!allocated || errors != 0)
+            {
+                continue;
+            }
+            if ((offset & (RING_CHECK_ALIGNMENT - 1)) != 0 || offset + alignedSize > RING_CHECK_CAPACITY)
+            {
+                printf("  ERROR: uniform ring range [%u, %u) unaligned or out of the ring\n", offset, offset + alignedSize);
+                ++errors;
+            }
+            for (unsigned int r = 0; r < rangeCount && errors == 0; ++r)
+            {
+                const RingRange & range = ranges[(firstRange + r) % maxRangeCount];
+                if (offset < range.mOffset + range.mSize && range.mOffset < offset + alignedSize)
+                {
+                    printf("  ERROR: uniform ring range [%u, %u) of frame %d overlaps [%u, %u) of frame %u still in use\n",
+                           offset, offset + alignedSize, f, range.mOffset, range.mOffset + range.mSize, range.mFence);
+                    ++errors;
+                }
+            }
+            RingRange & newRange = ranges[(firstRange + rangeCount) % maxRangeCount];
+            newRange.mOffset = offset;
+            newRange.mSize = alignedSize;
+            newRange.mFence = static_cast<unsigned int>(f);
+            ++rangeCount;
+        }
+
+        const unsigned int fence = ring.EndFrame();
+        if (fence != static_cast<unsigned int>(f))
+        {
+            printf("  ERROR: uniform ring frame %d ended with the fence %u\n", f, fence);
+            ++errors;
+        }
+        while (ring.GetPendingFrameCount() > RING_CHECK_LATENCY)
+        {
+            const unsigned int retiredFence = ring.GetOldestPendingFence();
+            ring.RetireFrame();
+            while (rangeCount > 0 && ranges[firstRange].mFence == retiredFence)
+            {
+                firstRange = (firstRange + 1) % maxRangeCount;
+                --rangeCount;
+            }
+        }
+    }
+
+    // Once the GPU completed every frame, the whole ring is free again
+    while (ring.GetPendingFrameCount() > 0)
+    {
+        ring.RetireFrame();
+    }
+    if (ring.GetUsedBytes() != 0)
+    {
+        printf("  ERROR: %u bytes of the uniform ring still in use after every frame retired\n", ring.GetUsedBytes());
+        ++errors;
+    }
+    outStats = ring.GetStats();
+    return errors;
+}
+
+//! Wrap of a ring of 4 ranges of 256 bytes: the end of the ring skipped by a wrapping allocation
+//! stays in use, a range overlapping the oldest frame is refused until that frame retires
+//! \return Number of errors found
+int CheckUniformRingWrap()
+{
+    UniformRing ring;
+    ring.Initialize(1024, 256);
+    unsigned int offset0 = 0, offset1 = 0, offset2 = 0, offset3 = 0;
+    const bool frame0 = ring.Allocate(512, offset0);
+    ring.EndFrame();
+    const bool frame1 = ring.Allocate(100, offset1);
+    ring.EndFrame();
+    ring.RetireFrame();
+
+    //frame 1 uses [512, 768), 768 bytes do not fit before it without overwriting it
+    const bool refusedOverlap = !ring.Allocate(768, offset2);
+    const bool wrapped = ring.Allocate(512, offset2);
+    const bool refusedFull = !ring.Allocate(256, offset3);
+    ring.EndFrame();
+    ring.RetireFrame();
+    const bool reused = ring.Allocate(256, offset3);
+
+    if (!frame0 || !frame1 || offset0 != 0 || offset1 != 512 || !refusedOverlap || !wrapped || offset2 != 0 || !refusedFull || !reused || offset3 != 512)
+    {
+        printf("  ERROR: uniform ring wrap: ranges at %u, %u, %u, %u, overlap %s, full %s\n", offset0, offset1, offset2, offset3,
+               refusedOverlap ? "refused" : "accepted", refusedFull ? "refused" : "accepted");
+        return 1;
+    }
+    return 0;
+}
+
+}   // anonymous namespace
+
+void BENCHMARK_RenderUniformRing()
+{
+    // Bookkeeping of the ring, no GPU involved
+    UniformRingStats checkStats;
+    if (CheckUniformRingBookkeeping(checkStats) + CheckUniformRingWrap() == 0)
+    {
+        printf("  Bookkeeping: %u allocations, %u wraps, %u refused while full, %u frames retired, %.1f%% lost to wraps\n",
+               checkStats.mAllocationCount, checkStats.mWrapCount, checkStats.mFullCount, checkStats.mRetiredFrameCount,
+               checkStats.mAllocatedBytes > 0 ? 100.0 * static_cast<double>(checkStats.mWrapBytes) / static_cast<double>(checkStats.mAllocatedBytes + checkStats.mWrapBytes) : 0.0);
+    }
+    if (checkStats.mWrapCount == 0 || checkStats.mFullCount == 0)
+    {
+        printf("  ERROR: the bookkeeping check did not wrap or fill the uniform ring\n");
+    }
+
+    // CPU cost of the transient uniform writes
+    UniformRing ring;
+    ring.Initialize(RING_UPLOAD_CAPACITY, RING_CHECK_ALIGNMENT);
+    RingUploadRun run = { &ring };
+    const double uploadSeconds = BenchmarkMeasure(run);
+    BenchmarkReport("Ring allocation and copy of 64 bytes (draws)", uploadSeconds, RING_UPLOAD_DRAW_COUNT * RING_UPLOAD_FRAME_COUNT);
+
+    RunTransientUniformBufferFrames();
+}
+
+namespace
+{
+
+//! Lookups of every uniform name in a measured run
+const int UNIFORM_LOOKUP_ROUND_COUNT = 1024;
+
+//! Reflection data of a program of UNIFORM_LOCATION_NAME_COUNT uniforms, with the two ways to find a uniform by name
+struct UniformNameTable
+{
+    char mNames[UNIFORM_LOCATION_NAME_COUNT][PEGASUS_RENDER_MAX_UNIFORM_NAME_LEN];
+    UniformLookup mLookup;
+
+    UniformNameTable()
+    {
+        for (int u = 0; u < UNIFORM_LOCATION_NAME_COUNT; ++u)
+        {
+            GetBenchmarkUniformName(u, mNames[u]);
+            mLookup.Add(Memory::GetGlobalAllocator(), Utils::HashStr(mNames[u]), u);
+        }
+    }
+
+    //! Compare the name with every uniform, as the backends did before the lookup
+    int FindLinear(const char * name) const
+    {
+        for (int u = 0; u < UNIFORM_LOCATION_NAME_COUNT; ++u)
+        {
+            if (!Utils::Strcmp(name, mNames[u]))
+            {
+                return u;
+            }
+        }
+        return -1;
+    }
+
+    //! Compare the name with the uniforms sharing its hash, as the backends do
+    int FindHashed(const char * name, unsigned int nameHash) const
+    {
+        unsigned int cursor = 0;
+        for (int u = mLookup.Find(nameHash, cursor); u != -1; u = mLookup.Find(nameHash, cursor))
+        {
+            if (!Utils::Strcmp(name, mNames[u]))
+            {
+                return u;
+            }
+        }
+        return -1;
+    }
+};
+
+//! Lookup of every uniform name UNIFORM_LOOKUP_ROUND_COUNT times, by linear search or through the hashed lookup.
+//! The hashed lookup copies and hashes the name as GetUniformLocation() does.
+struct UniformLookupRun
+{
+    const UniformNameTable * mTable;
+    bool mHashed;
+    int mChecksum;
+
+    void operator()()
+    {
+        int checksum = 0;
+        Uniform uniform;
+        for (int r = 0; r < UNIFORM_LOOKUP_ROUND_COUNT; ++r)
+        {
+            for (int u = 0; u < UNIFORM_LOCATION_NAME_COUNT; ++u)
+            {
+                const char * name = mTable->mNames[(u * 7 + r) % UNIFORM_LOCATION_NAME_COUNT];
+                if (mHashed)
+                {
+                    SetUniformName(uniform, name);
+                    checksum += mTable->FindHashed(name, uniform.mNameHash);
+                }
+                else
+                {
+                    uniform.mName[0] = '\0';
+                    Utils::Strcat(uniform.mName, name);
+                    checksum += mTable->FindLinear(name);
+                }
+            }
+        }
+        mChecksum = checksum;
+    }
+};
+
+//! Check the hashed lookup against the linear search, for every name, for missing names,
+//! and for names sharing a hash
+//! \return Number of errors found
+int CheckUniformLookup(const UniformNameTable & table)
+{
+    int errors = 0;
+    for (int u = 0; u < UNIFORM_LOCATION_NAME_COUNT; ++u)
+    {
+        Uniform uniform;
+        SetUniformName(uniform, table.mNames[u]);
+        const int hashed = table.FindHashed(table.mNames[u], uniform.mNameHash);
+        if (uniform.mNameHash != Utils::HashStr(table.mNames[u]) || hashed != table.FindLinear(table.mNames[u]) || hashed != u)
+        {
+            printf("  ERROR: uniform lookup found %d for %s, expected %d\n", hashed, table.mNames[u], u);
+            ++errors;
+        }
+    }
+    if (table.FindHashed("materialLayerConstants", Utils::HashStr("materialLayerConstants")) != -1)
+    {
+        printf("  ERROR: uniform lookup found a uniform missing from the program\n");
+        ++errors;
+    }
+
+    // Every name with the same hash, the probes have to reach each of them once
+    UniformLookup collisions;
+    for (int u = 0; u < UNIFORM_LOCATION_NAME_COUNT; ++u)
+    {
+        collisions.Add(Memory::GetGlobalAllocator(), 0x1234u, u);
+    }
+    unsigned long long found = 0;
+    int foundCount = 0;
+    unsigned int cursor = 0;
+    for (int u = collisions.Find(0x1234u, cursor); u != -1; u = collisions.Find(0x1234u, cursor))
+    {
+        found |= 1ull << u;
+        ++foundCount;
+    }
+    if (foundCount != UNIFORM_LOCATION_NAME_COUNT || found != ~0ull)
+    {
+        printf("  ERROR: %d uniforms sharing a hash found by the lookup, expected %d\n", foundCount, UNIFORM_LOCATION_NAME_COUNT);
+        ++errors;
+    }
+    cursor = 0;
+    if (collisions.Find(0x1235u, cursor) != -1)
+    {
+        printf("  ERROR: uniform lookup found a hash never added\n");
+        ++errors;
+    }
+    return errors;
+}
+
+}   // anonymous namespace
+
+void BENCHMARK_RenderUniformLocation()
+{
+    UniformNameTable table;
+    CheckUniformLookup(table);
+
+    UniformLookupRun linearRun = { &table, false, 0 };
+    UniformLookupRun hashedRun = { &table, true, 0 };
+    const double linearSeconds = BenchmarkMeasure(linearRun);
+    const double hashedSeconds = BenchmarkMeasure(hashedRun);
+    if (linearRun.mChecksum != hashedRun.mChecksum)
+    {
+        printf("  ERROR: the hashed lookup and the linear search found different uniforms\n");
+    }
+
+    const int totalLookups = UNIFORM_LOOKUP_ROUND_COUNT * UNIFORM_LOCATION_NAME_COUNT;
+    printf("  %d uniforms in the program\n", UNIFORM_LOCATION_NAME_COUNT);
+    BenchmarkReport("Uniform location, linear search (lookups)", linearSeconds, totalLookups);
+    BenchmarkReport("Uniform location, hashed lookup (lookups)", hashedSeconds, totalLookups);
+    BenchmarkReportSpeedup("Hashed vs linear", linearSeconds, hashedSeconds);
+
+    RunScriptedUniformBinding();
+}
@@ -0,0 +1,400 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Benchmarks                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   TimelineBenchmarks.cpp
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Pegasus benchmarks for the Timeline package, implementation.
+//!         The reference function of the lookups is the linked list walk Lane::FindCurrentBlock()
+//!         did before the playback cursor.
+
+#include "Pegasus/Benchmarks/Benchmarks.h"
+#include "Pegasus/Benchmarks/TimelineBenchmarks.h"
+#include "Pegasus/Timeline/LaneCursor.h"
+#include "Pegasus/Timeline/Shared/LaneDefs.h"
+#include "Pegasus/Timeline/UpdateScheduler.h"
+#include "Pegasus/BlockScript/BlockScriptManager.h"
+#include "Pegasus/BlockScript/BlockScript.h"
+#include "Pegasus/BlockScript/BsVm.h"
+#include "Pegasus/Core/Io.h"
+#include "Pegasus/Core/ParallelFor.h"
+#include "Pegasus/Allocator/Alloc.h"
+#include "Pegasus/Memory/MemoryManager.h"
+#include "Pegasus/Utils/String.h"
+#include "Pegasus/Utils/Memcpy.h"
+#include <stdio.h>
+
+using namespace Pegasus;
+using namespace Pegasus::Timeline;
+
+namespace
+{
+
+//! Lanes of the benchmarked timeline
+const int BENCHMARK_LANE_COUNT = MAX_NUM_LANES;
+
+//! Blocks per lane, the timeline has BENCHMARK_LANE_COUNT times more
+const int BENCHMARK_BLOCKS_PER_LANE = 256;
+
+//! Ticks per beat, same default as the Timeline
+const unsigned int BENCHMARK_TICKS_PER_BEAT = 128;
+
+//! Number of frames of the playback, spread over the whole timeline
+const int BENCHMARK_FRAME_COUNT = 4096;
+
+//! Block stand-in, blocks are heap objects the walk has to dereference to read their position
+struct BenchmarkBlock
+{
+    Beat mBeat;
+    Duration mDuration;
+    char mPayload[120];
+};
+
+//! Same record as the lane linked list
+struct BenchmarkBlockRecord
+{
+    BenchmarkBlock* mBlock;
+    int mNext;
+};
+
+//! Lanes of blocks in both representations, the linked list of records in random order,
+//! and the sorted position arrays of the playback cursor
+struct TimelineBenchmarkData
+{
+    BenchmarkBlock* mBlocks;
+    BenchmarkBlockRecord* mRecords;
+    int mFirstRecords[BENCHMARK_LANE_COUNT];
+    Beat* mSortedBeats;
+    int* mSortedRecords;
+    LaneCursor mCursors[BENCHMARK_LANE_COUNT];
+    Beat mEndBeat;
+
+    TimelineBenchmarkData()
+    {
+        Alloc::IAllocator* allocator = Memory::GetGlobalAllocator();
+        const int blockCount = BENCHMARK_LANE_COUNT * BENCHMARK_BLOCKS_PER_LANE;
+        mBlocks = PG_NEW_ARRAY(allocator, -1, "Benchmark timeline blocks", Alloc::PG_MEM_TEMP, BenchmarkBlock, blockCount);
+        mRecords = PG_NEW_ARRAY(allocator, -1, "Benchmark timeline records", Alloc::PG_MEM_TEMP, BenchmarkBlockRecord, blockCount);
+        mSortedBeats = PG_NEW_ARRAY(allocator, -1, "Benchmark timeline sorted beats", Alloc::PG_MEM_TEMP, Beat, blockCount);
+        mSortedRecords = PG_NEW_ARRAY(allocator, -1, "Benchmark timeline sorted records", Alloc::PG_MEM_TEMP, int, blockCount);
+        mEndBeat = 0;
+
+        unsigned int seed = 1234567u;
+        int* slots = PG_NEW_ARRAY(allocator, -1, "Benchmark timeline slots", Alloc::PG_MEM_TEMP, int, BENCHMARK_BLOCKS_PER_LANE);
+        for (int lane = 0; lane < BENCHMARK_LANE_COUNT; ++lane)
+        {
+            // Records of a lane get used in random order, as after a session of editing
+            for (int b = 0; b < BENCHMARK_BLOCKS_PER_LANE; ++b)
+            {
+                slots[b] = b;
+            }
+            for (int b = BENCHMARK_BLOCKS_PER_LANE - 1; b > 0; --b)
+            {
+                seed = seed * 1664525u + 1013904223u;
+                const int other = static_cast<int>((seed >> 8) % static_cast<unsigned int>(b + 1));
+                const int tmp = slots[b];
+                slots[b] = slots[other];
+                slots[other] = tmp;
+            }
+
+            // Blocks of 1 to 8 beats, separated by gaps of 0 to 3 beats
+            const int laneBase = lane * BENCHMARK_BLOCKS_PER_LANE;
+            Beat beat = 0;
+            for (int b = 0; b < BENCHMARK_BLOCKS_PER_LANE; ++b)
+            {
+                seed = seed * 1664525u + 1013904223u;
+                beat += ((seed >> 12) & 3) * BENCHMARK_TICKS_PER_BEAT;
+                const int record = laneBase + slots[b];
+                BenchmarkBlock& block = mBlocks[record];
+                block.mBeat = beat;
+                block.mDuration = (1 + ((seed >> 20) & 7)) * BENCHMARK_TICKS_PER_BEAT;
+                beat += block.mDuration;
+
+                mRecords[record].mBlock = &block;
+                mRecords[record].mNext = laneBase + slots[(b + 1) % BENCHMARK_BLOCKS_PER_LANE];
+                mSortedBeats[laneBase + b] = block.mBeat;
+                mSortedRecords[laneBase + b] = record;
+            }
+            mFirstRecords[lane] = laneBase + slots[0];
+            mEndBeat = beat > mEndBeat ? beat : mEndBeat;
+        }
+        PG_DELETE_ARRAY(allocator, slots);
+    }
+
+    ~TimelineBenchmarkData()
+    {
+        Alloc::IAllocator* allocator = Memory::GetGlobalAllocator();
+        PG_DELETE_ARRAY(allocator, mSortedRecords);
+        PG_DELETE_ARRAY(allocator, mSortedBeats);
+        PG_DELETE_ARRAY(allocator, mRecords);
+        PG_DELETE_ARRAY(allocator, mBlocks);
+    }
+
+    //! \return the record of the block intersected by the beat, -1 if the beat is between blocks
+    int ReferenceFind(int lane, Beat beat) const
+    {
+        const int first = mFirstRecords[lane];
+        if (beat < mRecords[first].mBlock->mBeat)
+        {
+            return -1;
+        }
+
+        int current = first;
+        int next = mRecords[first].mNext;
+        while ((next != first) && (beat >= mRecords[next].mBlock->mBeat))
+        {
+            current = next;
+            next = mRecords[next].mNext;
+        }
+        return (beat - mRecords[current].mBlock->mBeat < mRecords[current].mBlock->mDuration) ? current : -1;
+    }
+
+    //! \return the record of the block intersected by the beat, -1 if the beat is between blocks
+    int CursorFind(int lane, Beat beat)
+    {
+        const int laneBase = lane * BENCHMARK_BLOCKS_PER_LANE;
+        const int position = mCursors[lane].Find(mSortedBeats + laneBase, BENCHMARK_BLOCKS_PER_LANE, beat);
+        if (position == LaneCursor::BEFORE_FIRST_BLOCK)
+        {
+            return -1;
+        }
+        const int record = mSortedRecords[laneBase + position];
+        return (beat - mRecords[record].mBlock->mBeat < mRecords[record].mBlock->mDuration) ? record : -1;
+    }
+
+    //! \return the beat of a frame, or of a random position when scrubbing
+    Beat GetFrameBeat(int frame, bool scrub) const
+    {
+        if (scrub)
+        {
+            const unsigned int hash = (static_cast<unsigned int>(frame) + 1u) * 2654435761u;
+            return (hash >> 4) % mEndBeat;
+        }
+        return static_cast<Beat>((static_cast<unsigned long long>(mEndBeat) * frame) / BENCHMARK_FRAME_COUNT);
+    }
+};
+
+//! Looks up the current block of every lane for every frame, the sum of the found records is the checksum
+struct ReferenceLookupRun
+{
+    TimelineBenchmarkData* mData; bool mScrub; int mChecksum;
+    void operator()()
+    {
+        mChecksum = 0;
+        for (int frame = 0; frame < BENCHMARK_FRAME_COUNT; ++frame)
+        {
+            const Beat beat = mData->GetFrameBeat(frame, mScrub);
+            for (int lane = 0; lane < BENCHMARK_LANE_COUNT; ++lane)
+            {
+                mChecksum += mData->ReferenceFind(lane, beat);
+            }
+        }
+    }
+};
+
+struct CursorLookupRun
+{
+    TimelineBenchmarkData* mData; bool mScrub; int mChecksum;
+    void operator()()
+    {
+        mChecksum = 0;
+        for (int frame = 0; frame < BENCHMARK_FRAME_COUNT; ++frame)
+        {
+            const Beat beat = mData->GetFrameBeat(frame, mScrub);
+            for (int lane = 0; lane < BENCHMARK_LANE_COUNT; ++lane)
+            {
+                mChecksum += mData->CursorFind(lane, beat);
+            }
+        }
+    }
+};
+
+void RunLookupBenchmark(bool scrub)
+{
+    TimelineBenchmarkData data;
+    ReferenceLookupRun reference = { &data, scrub, 0 };
+    CursorLookupRun cursor = { &data, scrub, 0 };
+
+    const int lookupCount = BENCHMARK_FRAME_COUNT * BENCHMARK_LANE_COUNT;
+    const double referenceTime = BenchmarkMeasure(reference);
+    const double cursorTime = BenchmarkMeasure(cursor);
+    printf("  %d lanes, %d blocks\n", BENCHMARK_LANE_COUNT, BENCHMARK_LANE_COUNT * BENCHMARK_BLOCKS_PER_LANE);
+    BenchmarkReport("Linked list walk", referenceTime, lookupCount);
+    BenchmarkReport(scrub ? "Binary search" : "Playback cursor", cursorTime, lookupCount);
+    BenchmarkReportSpeedup("Speedup", referenceTime, cursorTime);
+
+    if (reference.mChecksum != cursor.mChecksum)
+    {
+        printf("  ERROR: the cursor found different blocks than the linked list walk!\n");
+    }
+}
+
+//! Number of frames of the update benchmark
+const int BENCHMARK_UPDATE_FRAME_COUNT = 16;
+
+//! Number of lanes sharing a dependency group in the grouped update benchmark
+const int BENCHMARK_UPDATE_GROUP_SIZE = 4;
+
+//! Update function run by the block of every lane, a few thousand instructions of the virtual machine
+const char* BENCHMARK_UPDATE_SCRIPT =
+    "float Benchmark_Update(beat : float)\n"
+    "{\n"
+    "    acc = 0.0;\n"
+    "    i = 0;\n"
+    "    while (i < 256)\n"
+    "    {\n"
+    "        acc = acc + sin(beat + acc) * 0.5;\n"
+    "        i = i + 1;\n"
+    "    }\n"
+    "    return acc;\n"
+    "}\n";
+
+//! One compiled script shared by every lane, as a script asset shared by several blocks,
+//! and one virtual machine state per lane
+struct UpdateBenchmarkData
+{
+    BlockScript::BlockScriptManager mManager;
+    Io::FileBuffer mFileBuffer;
+    BlockScript::BlockScript* mScript;
+    BlockScript::FunBindPoint mUpdateFunction;
+    BlockScript::BsVmState mVmStates[BENCHMARK_LANE_COUNT];
+    int mGroups[BENCHMARK_LANE_COUNT];
+    float mResults[BENCHMARK_LANE_COUNT];
+    float mBeat;
+    bool mCompiled;
+
+    UpdateBenchmarkData()
+    : mManager(Memory::GetGlobalAllocator()), mScript(nullptr), mUpdateFunction(BlockScript::FUN_INVALID_BIND_POINT), mBeat(0.0f), mCompiled(false)
+    {
+        Alloc::IAllocator* allocator = Memory::GetGlobalAllocator();
+        const int scriptLength = static_cast<int>(Utils::Strlen(BENCHMARK_UPDATE_SCRIPT));
+        char* source = PG_NEW_ARRAY(allocator, -1, "Benchmark update script", Alloc::PG_MEM_TEMP, char, scriptLength + 1);
+        Utils::Memcpy(source, BENCHMARK_UPDATE_SCRIPT, scriptLength + 1);
+        mFileBuffer.OwnBuffer(allocator, source, scriptLength + 1);
+        mFileBuffer.SetFileSize(scriptLength);
+
+        mScript = mManager.CreateBlockScript();
+        mCompiled = mScript->Compile(&mFileBuffer);
+        if (mCompiled)
+        {
+            const char* argTypes[] = { "float" };
+            mUpdateFunction = mScript->GetFunctionBindPoint("Benchmark_Update", argTypes, 1);
+            mCompiled = mUpdateFunction != BlockScript::FUN_INVALID_BIND_POINT;
+        }
+
+        for (int lane = 0; lane < BENCHMARK_LANE_COUNT; ++lane)
+        {
+            mVmStates[lane].Initialize(allocator);
+            if (mCompiled)
+            {
+                mScript->Run(&mVmStates[lane]);
+            }
+            mGroups[lane] = Timeline::UpdateScheduler::INDEPENDENT_GROUP;
+            mResults[lane] = 0.0f;
+        }
+    }
+
+    ~UpdateBenchmarkData()
+    {
+        mManager.DestroyBlockScript(mScript);
+    }
+
+    //! Update task of the scheduler, same work as the script update of a block
+    static void UpdateLane(int task, void* userData)
+    {
+        UpdateBenchmarkData* data = static_cast<UpdateBenchmarkData*>(userData);
+        const float beat = data->mBeat + static_cast<float>(task);
+        data->mScript->ExecuteFunction(&data->mVmStates[task], data->mUpdateFunction, &beat, sizeof(beat), &data->mResults[task], sizeof(float));
+    }
+};
+
+//! Runs the script update of every lane for BENCHMARK_UPDATE_FRAME_COUNT frames
+struct ScheduledUpdateRun
+{
+    UpdateBenchmarkData* mData;
+    Timeline::UpdateScheduler mScheduler;
+
+    void operator()()
+    {
+        for (int frame = 0; frame < BENCHMARK_UPDATE_FRAME_COUNT; ++frame)
+        {
+            mData->mBeat = static_cast<float>(frame) * 0.25f;
+            mScheduler.Run(mData->mGroups, BENCHMARK_LANE_COUNT, &UpdateBenchmarkData::UpdateLane, mData);
+        }
+    }
+};
+
+}
+
+//----------------------------------------------------------------------------------------
+
+void BENCHMARK_TimelineBlockLookup()
+{
+    RunLookupBenchmark(false);
+}
+
+void BENCHMARK_TimelineBlockSeek()
+{
+    RunLookupBenchmark(true);
+}
+
+void BENCHMARK_TimelineParallelUpdate()
+{
+    UpdateBenchmarkData data;
+    if (!data.mCompiled)
+    {
+        printf("  ERROR: the update script did not compile!\n");
+        return;
+    }
+
+    ScheduledUpdateRun run;
+    run.mData = &data;
+    const int updateCount = BENCHMARK_UPDATE_FRAME_COUNT * BENCHMARK_LANE_COUNT;
+    printf("  %d lanes, one script update per lane and frame\n", BENCHMARK_LANE_COUNT);
+
+    //single thread result, every other run has to match it exactly
+    float expected[BENCHMARK_LANE_COUNT];
+    double singleThreadTime = 0.0;
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        //second pass with the lanes annotated as sharing resources by packs of BENCHMARK_UPDATE_GROUP_SIZE
+        const bool grouped = pass == 1;
+        for (int lane = 0; lane < BENCHMARK_LANE_COUNT; ++lane)
+        {
+            data.mGroups[lane] = grouped ? 1 + lane / BENCHMARK_UPDATE_GROUP_SIZE : Timeline::UpdateScheduler::INDEPENDENT_GROUP;
+        }
+
+        for (int threads = grouped ? Core::GetParallelForThreadCount() : 1; threads <= Core::GetParallelForThreadCount(); ++threads)
+        {
+            Core::SetParallelForThreadLimit(threads);
+            const double time = BenchmarkMeasure(run);
+
+            char label[64];
+            sprintf_s(label, sizeof(label), "%s, %d thread(s)", grouped ? "Grouped lanes" : "Independent lanes", threads);
+            BenchmarkReport(label, time, updateCount);
+            if (threads == 1)
+            {
+                singleThreadTime = time;
+                Utils::Memcpy(expected, data.mResults, sizeof(expected));
+            }
+            else
+            {
+                BenchmarkReportSpeedup("Speedup", singleThreadTime, time);
+                bool match = true;
+                for (int lane = 0; match && lane < BENCHMARK_LANE_COUNT; ++lane)
+                {
+                    match = expected[lane] == data.mResults[lane];
+                }
+
+                if (!match)
+                {
+                    printf("  ERROR: result differs from the single thread result!\n");
+                }
+            }
+        }
+    }
+    Core::SetParallelForThreadLimit(0);
+}
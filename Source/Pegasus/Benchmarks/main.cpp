@@ -0,0 +1,152 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   main.cpp (benchmarks entry point)
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Set of performance benchmarks, comparing optimized engine code paths
+//!         against reference implementations. Run in an optimized configuration.
+
+#include "Pegasus/Benchmarks/Benchmarks.h"
+#include "Pegasus/Benchmarks/AssetLibBenchmarks.h"
+#include "Pegasus/Benchmarks/MathBenchmarks.h"
+#include "Pegasus/Benchmarks/MeshBenchmarks.h"
+#include "Pegasus/Benchmarks/TimelineBenchmarks.h"
+#include "Pegasus/Benchmarks/PropertyGridBenchmarks.h"
+#include "Pegasus/Benchmarks/RenderBenchmarks.h"
+#include "Pegasus/Core/Time.h"
+#include "Pegasus/Core/ParallelFor.h"
+#include "Pegasus/PropertyGrid/PropertyGridManager.h"
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+
+typedef void (*BenchmarkFunc)(void);
+
+
+double BenchmarkGetTime()
+{
+    Pegasus::Core::UpdatePegasusTime();
+    return Pegasus::Core::GetPegasusTime();
+}
+
+void BenchmarkReport(const char* label, double seconds, int elementCount)
+{
+    const double msPerMillion = elementCount > 0 ? (seconds * 1000.0) * (1000000.0 / static_cast<double>(elementCount)) : 0.0;
+    printf("  %-40s %10.3f ms  %10.3f ms/M elements\n", label, seconds * 1000.0, msPerMillion);
+}
+
+void BenchmarkReportSpeedup(const char* label, double referenceSeconds, double seconds)
+{
+    printf("  %-40s %10.2fx\n", label, seconds > 0.0 ? referenceSeconds / seconds : 0.0);
+}
+
+//! Number of errors reported by the checks of the benchmarks
+static int sBenchmarkErrorCount = 0;
+
+void BenchmarkReportError(const char* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    printf("  ERROR: ");
+    vprintf(format, args);
+    printf("\n");
+    va_end(args);
+    ++sBenchmarkErrorCount;
+}
+
+//! Prefix of the names of the benchmarks to run, nullptr to run them all
+static const char * sBenchmarkFilter = nullptr;
+
+//! Utility function, presents and runs benchmarks to tty
+void RunBenchmark(BenchmarkFunc func, const char * benchmarkTitle)
+{
+    if (sBenchmarkFilter != nullptr && strncmp(benchmarkTitle, sBenchmarkFilter, strlen(sBenchmarkFilter)) != 0)
+    {
+        return;
+    }
+
+    printf("***********************\n");
+    printf("RUNNING BENCHMARK: %s\n", benchmarkTitle);
+    printf("***********************\n");
+    func();
+    printf("-------------------------\n\n");
+}
+
+//! Runs the benchmarks
+//! \param argc 1, or 2 with a prefix of the benchmark names to run (Render runs the Render* benchmarks)
+//! \return 0, or 1 when a check of the benchmark results reported an error
+int main(int argc, char ** argv)
+{
+    sBenchmarkFilter = argc > 1 ? argv[1] : nullptr;
+    Pegasus::Core::InitializePegasusTime();
+    Pegasus::Core::InitializeParallelFor();
+
+    // Link the property grid classes and compile their layouts, as the application does on startup
+    Pegasus::PropertyGrid::PropertyGridManager::GetInstance().ResolveInternalClassHierarchy();
+
+#define RUN_BENCHMARK(name) RunBenchmark(BENCHMARK_##name, #name)
+
+    ///////////////////////////////////////////////////////////////////
+    // BENCHMARKS - add here your benchmark executions               //
+    ///////////////////////////////////////////////////////////////////
+
+    //Math
+    RUN_BENCHMARK(MathAccuracy);
+    RUN_BENCHMARK(MathMult44_41);
+    RUN_BENCHMARK(MathMult44T_41);
+    RUN_BENCHMARK(MathMult44_44);
+    RUN_BENCHMARK(MathQuaternionMult);
+    RUN_BENCHMARK(MathRotateVector);
+    RUN_BENCHMARK(MathTransformPoints);
+    RUN_BENCHMARK(MathTransformNormals);
+    RUN_BENCHMARK(MathTransformPointsSoa);
+    RUN_BENCHMARK(MathTransformAabbs);
+    RUN_BENCHMARK(MathCullAabbs);
+    RUN_BENCHMARK(MathCullSpheres);
+    RUN_BENCHMARK(MathBvhBuild);
+    RUN_BENCHMARK(MathBvhQueries);
+    RUN_BENCHMARK(MathTranscendentalAccuracy);
+    RUN_BENCHMARK(MathTranscendentals);
+
+    //Mesh
+    RUN_BENCHMARK(MeshWaveField);
+    RUN_BENCHMARK(MeshTransform);
+    RUN_BENCHMARK(MeshTransformNormalize);
+    RUN_BENCHMARK(MeshParallelScaling);
+    RUN_BENCHMARK(MeshOptimize);
+    RUN_BENCHMARK(MeshMarchingCubes);
+    RUN_BENCHMARK(MeshSimplify);
+
+    //Timeline
+    RUN_BENCHMARK(TimelineBlockLookup);
+    RUN_BENCHMARK(TimelineBlockSeek);
+    RUN_BENCHMARK(TimelineParallelUpdate);
+
+    //AssetLib
+    RUN_BENCHMARK(AssetLibBinaryLoad);
+    RUN_BENCHMARK(AssetLibParallelLoad);
+    RUN_BENCHMARK(AssetLibPathLookup);
+
+    //PropertyGrid
+    RUN_BENCHMARK(PropertyGridGraphLoad);
+    RUN_BENCHMARK(PropertyGridBatchedWrites);
+
+    //Render
+    RUN_BENCHMARK(RenderNullSubmission);
+    RUN_BENCHMARK(RenderCommandBuffer);
+    RUN_BENCHMARK(RenderConcurrentLanes);
+    RUN_BENCHMARK(RenderTimelineLanes);
+    RUN_BENCHMARK(RenderTimelineFixedStep);
+    RUN_BENCHMARK(RenderTimelineSnapshot);
+    RUN_BENCHMARK(RenderUniformRing);
+    RUN_BENCHMARK(RenderUniformLocation);
+
+    ///////////////////////////////////////////////////////////
+
+    Pegasus::Core::ShutdownParallelFor();
+    return (sBenchmarkErrorCount != 0) ? 1 : 0;
+}
@@ -22,6 +22,7 @@
 #include "Pegasus/Math/Vector.h"
 #include "Pegasus/Math/Matrix.h"
 #include "Pegasus/Math/Quaternion.h"
+#include "Pegasus/Math/FastMath.h"
 #include "Pegasus/Core/Log.h"
 #include "Pegasus/Allocator/Alloc.h"
 
@@ -308,18 +309,66 @@ namespace Private_Math
         stream.SubmitReturn<T>(Math::Cross(v1, v2));
     }
 
-    void Sin(FunCallbackContext& context)
+    template<float F(float)>
+    void FloatFun(FunCallbackContext& context)
     {
         FunParamStream stream(context); 
         float v1 = stream.NextArgument<float>();
-        stream.SubmitReturn<float>(Math::Sin(v1));
+        stream.SubmitReturn<float>(F(v1));
     }
 
-    void Cos(FunCallbackContext& context)
+    //! Logs a math function called by a script outside of its domain, the function returns NaN instead of asserting
+    void ReportDomainError(const char* funName, float x)
     {
-        FunParamStream stream(context); 
-        float v1 = stream.NextArgument<float>();
-        stream.SubmitReturn<float>(Math::Cos(v1));
+        PG_LOG('ERR_', "%s(%f) called outside of its domain, returning NaN.", funName, x);
+    }
+
+    void LogFun(FunCallbackContext& context)
+    {
+        FunParamStream stream(context);
+        float v = stream.NextArgument<float>();
+        if (v > 0.0f)
+        {
+            stream.SubmitReturn<float>(Math::Log(v));
+        }
+        else
+        {
+            ReportDomainError("log", v);
+            stream.SubmitReturn<float>(PFLOAT_NAN);
+        }
+    }
+
+    void FastLogFun(FunCallbackContext& context)
+    {
+        FunParamStream stream(context);
+        float v = stream.NextArgument<float>();
+        if (v >= PFLOAT_MIN && v <= PFLOAT_MAX)
+        {
+            stream.SubmitReturn<float>(Math::FastLog(v));
+        }
+        else
+        {
+            ReportDomainError("fastLog", v);
+            stream.SubmitReturn<float>(PFLOAT_NAN);
+        }
+    }
+
+    //! Power of the scripts, a zero base with a negative exponent is outside of the domain of both versions
+    template<float F(float, float)>
+    void PowFun(FunCallbackContext& context)
+    {
+        FunParamStream stream(context);
+        float x = stream.NextArgument<float>();
+        float y = stream.NextArgument<float>();
+        if (x != 0.0f || y >= 0.0f)
+        {
+            stream.SubmitReturn<float>(F(x, y));
+        }
+        else
+        {
+            PG_LOG('ERR_', "pow(%f, %f) called with a zero base and a negative exponent, returning NaN.", x, y);
+            stream.SubmitReturn<float>(PFLOAT_NAN);
+        }
     }
 
     void Mat44_Rotation(FunCallbackContext& context)
@@ -512,8 +561,18 @@ void Pegasus::BlockScript::RegisterIntrinsics(BlockLib* lib)
         ///////////////////////////////////////////CROSS///////////////////////////////////////////////////////////////
         { "cross", "float3", { "float3", "float3", nullptr}, {"x", "y", nullptr}, Private_Math::Cross<Math::Vec3>},
         ///////////////////////////////////////////TRIG///////////////////////////////////////////////////////////////
-        { "sin", "float", { "float", nullptr}, {"v", nullptr}, Private_Math::Sin},
-        { "cos", "float", { "float", nullptr}, {"v", nullptr}, Private_Math::Cos},
+        { "sin", "float", { "float", nullptr}, {"v", nullptr}, Private_Math::FloatFun<Math::Sin>},
+        { "cos", "float", { "float", nullptr}, {"v", nullptr}, Private_Math::FloatFun<Math::Cos>},
+        { "fastSin", "float", { "float", nullptr}, {"v", nullptr}, Private_Math::FloatFun<Math::FastSin>},
+        { "fastCos", "float", { "float", nullptr}, {"v", nullptr}, Private_Math::FloatFun<Math::FastCos>},
+        ///////////////////////////////////////////EXP / LOG///////////////////////////////////////////////////////////////
+        { "exp", "float", { "float", nullptr}, {"v", nullptr}, Private_Math::FloatFun<Math::Exp>},
+        { "log", "float", { "float", nullptr}, {"v", nullptr}, Private_Math::LogFun},
+        { "pow", "float", { "float", "float", nullptr}, {"x", "y", nullptr}, Private_Math::PowFun<Math::Pow>},
+        { "fastExp", "float", { "float", nullptr}, {"v", nullptr}, Private_Math::FloatFun<Math::FastExp>},
+        { "fastLog", "float", { "float", nullptr}, {"v", nullptr}, Private_Math::FastLogFun},
+        { "fastPow", "float", { "float", "float", nullptr}, {"x", "y", nullptr}, Private_Math::PowFun<Math::FastPow>},
+        ///////////////////////////////////////////MISC///////////////////////////////////////////////////////////////
         { "divUp", "int", { "int", "int", nullptr}, {"a", "b", nullptr}, Private_Math::DivUp},
         { "GetRotation",   "float4x4", { "float3", "float", nullptr}, {"axis", "amount", nullptr}, Private_Math::Mat44_Rotation},
         { "GetProjection", "float4x4", { "float", "float", "float", "float", "float", "float", nullptr}, { "l", "r", "t", "b", "n", "f", nullptr}, Private_Math::Mat44_Proj1},
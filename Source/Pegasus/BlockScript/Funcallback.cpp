@@ -176,8 +176,8 @@ bool Pegasus::BlockScript::ExecuteFunction(
 #if PEGASUS_ENABLE_PROXIES
             int loopCount = 0;
             const int CheckTimeLoopCount = 100;
-            Pegasus::Core::UpdatePegasusTime();
-            double capturedTime = Pegasus::Core::GetPegasusTime();
+            //read the clock without updating it, this also runs on the worker threads of the timeline
+            double capturedTime = Pegasus::Core::ReadPegasusTime();
 #endif
             while (state.GetStackLevels() != 0)
             {
@@ -187,8 +187,7 @@ bool Pegasus::BlockScript::ExecuteFunction(
                 if (checkTime)
                 {
                     loopCount = 0;
-                    Pegasus::Core::UpdatePegasusTime();
-                    double newTime = Pegasus::Core::GetPegasusTime();
+                    double newTime = Pegasus::Core::ReadPegasusTime();
                     if (newTime - capturedTime > 4.0)
                     {
                         state.SetReg(Canon::R_IP, savedIp);
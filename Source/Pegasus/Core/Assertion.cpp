@@ -65,10 +65,11 @@ AssertReturnCode AssertionManager::AssertionError(const char * testStr,
         PG_ASSERTSTR(line >= 0, "Invalid line number for an assertion error");
 
         // If a message string is present, format it with the extra parameters if there are any
+        // The buffer lives on the stack, so assertions failing on worker threads do not overwrite each other
+        char buffer[ASSERTIONERRORARGS_BUFFER_SIZE];
         char * formattedString = nullptr;
         if (msgStr != nullptr)
         {
-            static char buffer[ASSERTIONERRORARGS_BUFFER_SIZE];
             va_list args;
             va_start(args, msgStr);
             vsnprintf_s(buffer, ASSERTIONERRORARGS_BUFFER_SIZE, ASSERTIONERRORARGS_BUFFER_SIZE - 1, msgStr, args);
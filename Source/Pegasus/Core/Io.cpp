@@ -20,6 +20,12 @@
 #if PEGASUS_USE_NATIVE_IO_CALLS
 #if PEGASUS_PLATFORM_WINDOWS
 #include <windows.h>
+#elif PEGASUS_PLATFORM_LINUX || PEGASUS_PLATFORM_MACOS
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #endif
 #endif
 
@@ -135,6 +141,231 @@ Pegasus::Io::IoError NativeSaveBufferToFile(const char* path, const Pegasus::Io:
     return Pegasus::Io::ERR_NONE;
 }
 
+Pegasus::Io::IoError NativeMapFileToBuffer(const char* path, Pegasus::Io::FileBuffer& outputBuffer, Alloc::IAllocator* alloc)
+{
+    HANDLE fileHandle = CreateFile(
+        path,
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        NULL, //win32 security attributes
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+        NULL //offset structures
+    );
+    if (fileHandle == INVALID_HANDLE_VALUE)
+    {
+        PG_LOG('FILE', "File not found \"%s\"", path);
+        return Pegasus::Io::ERR_FILE_NOT_FOUND;
+    }
+
+    LARGE_INTEGER fileSize;
+    fileSize.LowPart = 0;
+    fileSize.HighPart = 0;
+    GetFileSizeEx(fileHandle, &fileSize);
+    if (fileSize.HighPart != 0 || fileSize.LowPart > 0x7FFFFFFF)
+    {
+        PG_FAILSTR("Pegasus does not support files bigger than 2 gb!");
+        CloseHandle(fileHandle);
+        return Pegasus::Io::ERR_FILE_SIZE_TOO_BIG;
+    }
+
+    if (fileSize.LowPart == 0)
+    {
+        //empty files cannot be mapped, read them the regular way
+        CloseHandle(fileHandle);
+        return NativeOpenFileToBuffer(path, outputBuffer, true, alloc);
+    }
+
+    //copy on write mapping, the view can be written to without touching the file
+    HANDLE mappingHandle = CreateFileMapping(fileHandle, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+    char* view = nullptr;
+    if (mappingHandle != NULL)
+    {
+        view = static_cast<char*>(MapViewOfFile(mappingHandle, FILE_MAP_COPY, 0, 0, 0));
+        //the view keeps the file mapped, the handles are not needed anymore
+        CloseHandle(mappingHandle);
+    }
+    CloseHandle(fileHandle);
+
+    if (view == nullptr)
+    {
+        PG_LOG('FILE', "IO Error (MapViewOfFile): %s", path);
+        return Pegasus::Io::ERR_READING_FILE;
+    }
+
+    outputBuffer.OwnMapping(alloc, view, static_cast<int>(fileSize.LowPart));
+    PG_LOG('FILE', "Successfully mapped file \"%s\"", path);
+    return Pegasus::Io::ERR_NONE;
+}
+
+void NativeUnmapFile(char* mapping, int mappingSize)
+{
+    UnmapViewOfFile(mapping);
+}
+
+#elif PEGASUS_PLATFORM_LINUX || PEGASUS_PLATFORM_MACOS
+
+Pegasus::Io::IoError NativeOpenFileToBuffer(const char* path, Pegasus::Io::FileBuffer& outputBuffer, bool allocateBuffer, Alloc::IAllocator* alloc)
+{
+    int fileHandle = open(path, O_RDONLY);
+    if (fileHandle < 0)
+    {
+        PG_LOG('FILE', "File not found \"%s\"", path);
+        return Pegasus::Io::ERR_FILE_NOT_FOUND;
+    }
+
+    struct stat fileStat;
+    if (fstat(fileHandle, &fileStat) != 0)
+    {
+        close(fileHandle);
+        PG_LOG('FILE', "IO Error (fstat): %s", path);
+        return Pegasus::Io::ERR_READING_FILE;
+    }
+    if (fileStat.st_size > 0x7FFFFFFF)
+    {
+        PG_FAILSTR("Pegasus does not support files bigger than 2 gb!");
+        close(fileHandle);
+        return Pegasus::Io::ERR_FILE_SIZE_TOO_BIG;
+    }
+
+    const int fileSize = static_cast<int>(fileStat.st_size);
+    if (allocateBuffer)
+    {
+        outputBuffer.OwnBuffer(
+            alloc,
+            PG_NEW_ARRAY(alloc, -1, "file buffer", Pegasus::Alloc::PG_MEM_PERM, char, fileSize),
+            fileSize
+        );
+    }
+    else if (fileSize > outputBuffer.GetBufferSize())
+    {
+        close(fileHandle);
+        return Pegasus::Io::ERR_BUFFER_TOO_SMALL;
+    }
+
+    outputBuffer.SetFileSize(fileSize);
+
+    //read can return less than requested, loop until the whole file is in
+    int bytesRead = 0;
+    while (bytesRead < fileSize)
+    {
+        ssize_t res = read(fileHandle, outputBuffer.GetBuffer() + bytesRead, static_cast<size_t>(fileSize - bytesRead));
+        if (res < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (res <= 0)
+        {
+            break;
+        }
+        bytesRead += static_cast<int>(res);
+    }
+    close(fileHandle);
+
+    if (bytesRead != fileSize)
+    {
+        PG_LOG('FILE', "IO Error (read): %s", path);
+        if (allocateBuffer)
+        {
+            outputBuffer.DestroyBuffer();
+        }
+        return Pegasus::Io::ERR_READING_FILE;
+    }
+
+    PG_LOG('FILE', "Successfully opened file \"%s\"", path);
+    return Pegasus::Io::ERR_NONE;
+}
+
+Pegasus::Io::IoError NativeSaveBufferToFile(const char* path, const Pegasus::Io::FileBuffer& outputBuffer)
+{
+    int fileHandle = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fileHandle < 0)
+    {
+        PG_LOG('FILE', "IO Error (open): %s", path);
+        return Pegasus::Io::ERR_OPENING_FILE;
+    }
+
+    const int fileSize = outputBuffer.GetFileSize();
+    int bytesWritten = 0;
+    while (bytesWritten < fileSize)
+    {
+        ssize_t res = write(fileHandle, outputBuffer.GetBuffer() + bytesWritten, static_cast<size_t>(fileSize - bytesWritten));
+        if (res < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (res <= 0)
+        {
+            break;
+        }
+        bytesWritten += static_cast<int>(res);
+    }
+
+    if (close(fileHandle) != 0 || bytesWritten != fileSize)
+    {
+        PG_LOG('FILE', "IO Error (write): %s", path);
+        return Pegasus::Io::ERR_WRITING_FILE;
+    }
+    PG_LOG('FILE', "Saved: %s", path);
+    return Pegasus::Io::ERR_NONE;
+}
+
+Pegasus::Io::IoError NativeMapFileToBuffer(const char* path, Pegasus::Io::FileBuffer& outputBuffer, Alloc::IAllocator* alloc)
+{
+    int fileHandle = open(path, O_RDONLY);
+    if (fileHandle < 0)
+    {
+        PG_LOG('FILE', "File not found \"%s\"", path);
+        return Pegasus::Io::ERR_FILE_NOT_FOUND;
+    }
+
+    struct stat fileStat;
+    if (fstat(fileHandle, &fileStat) != 0)
+    {
+        close(fileHandle);
+        PG_LOG('FILE', "IO Error (fstat): %s", path);
+        return Pegasus::Io::ERR_READING_FILE;
+    }
+    if (fileStat.st_size > 0x7FFFFFFF)
+    {
+        PG_FAILSTR("Pegasus does not support files bigger than 2 gb!");
+        close(fileHandle);
+        return Pegasus::Io::ERR_FILE_SIZE_TOO_BIG;
+    }
+
+    if (fileStat.st_size == 0)
+    {
+        //empty files cannot be mapped, read them the regular way
+        close(fileHandle);
+        return NativeOpenFileToBuffer(path, outputBuffer, true, alloc);
+    }
+
+    //private mapping, the pages are copy on write and writes never reach the file
+    const int fileSize = static_cast<int>(fileStat.st_size);
+    void* view = mmap(nullptr, static_cast<size_t>(fileSize), PROT_READ | PROT_WRITE, MAP_PRIVATE, fileHandle, 0);
+
+    //the mapping keeps the file open, the descriptor is not needed anymore
+    close(fileHandle);
+
+    if (view == MAP_FAILED)
+    {
+        PG_LOG('FILE', "IO Error (mmap): %s", path);
+        return Pegasus::Io::ERR_READING_FILE;
+    }
+
+    //assets are parsed front to back
+    madvise(view, static_cast<size_t>(fileSize), MADV_SEQUENTIAL);
+
+    outputBuffer.OwnMapping(alloc, static_cast<char*>(view), fileSize);
+    PG_LOG('FILE', "Successfully mapped file \"%s\"", path);
+    return Pegasus::Io::ERR_NONE;
+}
+
+void NativeUnmapFile(char* mapping, int mappingSize)
+{
+    munmap(mapping, static_cast<size_t>(mappingSize));
+}
+
 #else
     #error No native implementation for IO functions in current platform!
 #endif //platform selection
@@ -146,7 +377,10 @@ Pegasus::Io::IoError NativeSaveBufferToFile(const char* path, const Pegasus::Io:
 IOManager::IOManager(const char* rootPath)
 {
     // Configure the path
-    sprintf_s(mRootDirectory, MAX_FILEPATH_LENGTH, "%s", rootPath); // Hardcode imported for now
+    mRootDirectory[0] = '\0';
+    PG_ASSERTSTR(Pegasus::Utils::Strlen(rootPath) < MAX_FILEPATH_LENGTH, "Root path is too long!");
+    Pegasus::Utils::Strcat(mRootDirectory, rootPath);
+    mRootDirectory[MAX_FILEPATH_LENGTH - 1] = '\0';
     PG_LOG('FILE', "Asset root set to \"%s\"", mRootDirectory);
 }
 
@@ -230,6 +464,28 @@ IoError IOManager::OpenFileToBuffer(const char* relativePath, FileBuffer& output
 
 //----------------------------------------------------------------------------------------
 
+IoError IOManager::MapFileToBuffer(const char* relativePath, FileBuffer& outputBuffer, Alloc::IAllocator* alloc)
+{
+#if PEGASUS_USE_NATIVE_IO_CALLS
+    char pathBuffer[MAX_FILEPATH_LENGTH];
+
+    // Configure the path
+    pathBuffer[0] = '\0';
+    PG_ASSERTSTR(Pegasus::Utils::Strlen(relativePath) < MAX_FILEPATH_LENGTH, "Path str is too little! be prepared for some mem stomps!");
+    Pegasus::Utils::Strcat(pathBuffer, mRootDirectory);
+    pathBuffer[MAX_FILEPATH_LENGTH - 1] = '\0';
+    Pegasus::Utils::Strcat(pathBuffer, relativePath);
+    pathBuffer[MAX_FILEPATH_LENGTH - 1] = '\0';
+
+    return internal::NativeMapFileToBuffer(pathBuffer, outputBuffer, alloc);
+#else
+    //no mapping with the c runtime, copy the file instead
+    return OpenFileToBuffer(relativePath, outputBuffer, true, alloc);
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+
 
 Pegasus::Io::IoError Pegasus::Io::IOManager::SaveFileToBuffer(const char* relativePath, const Pegasus::Io::FileBuffer& inputBuffer)
 {
@@ -274,7 +530,8 @@ Pegasus::Io::FileBuffer::FileBuffer()
 :   mAllocator(nullptr),
     mBuffer(nullptr), 
     mFileSize(0), 
-    mBufferSize(0)
+    mBufferSize(0),
+    mIsMapped(false)
 {
 }
 
@@ -298,24 +555,49 @@ void Pegasus::Io::FileBuffer::OwnBuffer(Alloc::IAllocator* bufferAlloc, char * b
 
 //----------------------------------------------------------------------------------------
 
+void Pegasus::Io::FileBuffer::OwnMapping(Alloc::IAllocator* bufferAlloc, char * mapping, int mappingSize)
+{
+    PG_ASSERTSTR(mBuffer == nullptr, "Dangerous operation! please call ForgetBuffer or DestroyBuffer before Setting a new buffer");
+    mAllocator = bufferAlloc;
+    mBuffer = mapping;
+    mBufferSize = mappingSize;
+    mFileSize = mappingSize;
+    mIsMapped = true;
+}
+
+//----------------------------------------------------------------------------------------
+
 void Pegasus::Io::FileBuffer::ForgetBuffer()
 {
     mAllocator = nullptr;
     mBuffer = nullptr;
     mBufferSize = 0;
     mFileSize = 0;
+    mIsMapped = false;
 }
 
 //----------------------------------------------------------------------------------------
 
 void Pegasus::Io::FileBuffer::DestroyBuffer()
 {
-    PG_DELETE_ARRAY(mAllocator, mBuffer);
+    if (mIsMapped)
+    {
+#if PEGASUS_USE_NATIVE_IO_CALLS
+        internal::NativeUnmapFile(mBuffer, mBufferSize);
+#else
+        PG_FAILSTR("Mapped buffer without native IO calls");
+#endif
+    }
+    else
+    {
+        PG_DELETE_ARRAY(mAllocator, mBuffer);
+    }
 
     mAllocator = nullptr;
     mBuffer = nullptr;
     mBufferSize = 0;
     mFileSize = 0;
+    mIsMapped = false;
 }
 
 //----------------------------------------------------------------------------------------
@@ -0,0 +1,412 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   IoThreads.cpp
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Asynchronous read requests, served by a pool of IO threads
+
+#include "Pegasus/Core/Io.h"
+#include "Pegasus/Core/Assertion.h"
+#include "Pegasus/Core/Log.h"
+#include "Pegasus/Utils/String.h"
+
+#if PEGASUS_PLATFORM_WINDOWS
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#elif PEGASUS_PLATFORM_LINUX || PEGASUS_PLATFORM_MACOS
+#include <pthread.h>
+#include <unistd.h>
+#else
+    #error No implementation of the IO threads in current platform!
+#endif
+
+namespace Pegasus {
+namespace Io {
+
+namespace internal
+{
+
+//! Lock with two condition variables, one for the IO threads waiting for requests,
+//! one for the threads waiting for requests to be done
+class IoLock
+{
+public:
+#if PEGASUS_PLATFORM_WINDOWS
+    void Initialize() { InitializeSRWLock(&mLock); InitializeConditionVariable(&mWorkCond); InitializeConditionVariable(&mDoneCond); }
+    void Destroy() {}
+    void Lock() { AcquireSRWLockExclusive(&mLock); }
+    void Unlock() { ReleaseSRWLockExclusive(&mLock); }
+    void WaitForWork() { SleepConditionVariableSRW(&mWorkCond, &mLock, INFINITE, 0); }
+    void WaitForDone() { SleepConditionVariableSRW(&mDoneCond, &mLock, INFINITE, 0); }
+    void SignalWork() { WakeConditionVariable(&mWorkCond); }
+    void BroadcastWork() { WakeAllConditionVariable(&mWorkCond); }
+    void BroadcastDone() { WakeAllConditionVariable(&mDoneCond); }
+
+private:
+    SRWLOCK mLock;
+    CONDITION_VARIABLE mWorkCond;
+    CONDITION_VARIABLE mDoneCond;
+#else
+    void Initialize() { pthread_mutex_init(&mLock, nullptr); pthread_cond_init(&mWorkCond, nullptr); pthread_cond_init(&mDoneCond, nullptr); }
+    void Destroy() { pthread_cond_destroy(&mDoneCond); pthread_cond_destroy(&mWorkCond); pthread_mutex_destroy(&mLock); }
+    void Lock() { pthread_mutex_lock(&mLock); }
+    void Unlock() { pthread_mutex_unlock(&mLock); }
+    void WaitForWork() { pthread_cond_wait(&mWorkCond, &mLock); }
+    void WaitForDone() { pthread_cond_wait(&mDoneCond, &mLock); }
+    void SignalWork() { pthread_cond_signal(&mWorkCond); }
+    void BroadcastWork() { pthread_cond_broadcast(&mWorkCond); }
+    void BroadcastDone() { pthread_cond_broadcast(&mDoneCond); }
+
+private:
+    pthread_mutex_t mLock;
+    pthread_cond_t mWorkCond;
+    pthread_cond_t mDoneCond;
+#endif
+};
+
+#if PEGASUS_PLATFORM_WINDOWS
+typedef HANDLE IoThreadHandle;
+#else
+typedef pthread_t IoThreadHandle;
+#endif
+
+}   // namespace internal
+
+//----------------------------------------------------------------------------------------
+
+//! Pool of IO threads, reading the submitted requests in FIFO order
+class IoThreadPool
+{
+public:
+    //! Maximum number of IO threads
+    static const int MAX_IO_THREADS = 8;
+
+    static void Initialize(int threadCount);
+    static void Shutdown();
+    static int GetThreadCount() { return sThreadCount; }
+    static void Submit(IoRequest* request);
+    static void Wait(IoRequest* request);
+    static bool IsDone(const IoRequest* request);
+
+private:
+#if PEGASUS_PLATFORM_WINDOWS
+    static DWORD WINAPI ThreadMain(LPVOID);
+#else
+    static void* ThreadMain(void*);
+#endif
+
+    //! Reads the queued requests until shutdown and an empty queue
+    static void RunThread();
+
+    static internal::IoLock sLock;
+    static internal::IoThreadHandle sThreads[MAX_IO_THREADS];
+    static int sThreadCount;
+    static bool sShutdown;
+
+    //! Intrusive FIFO of the pending requests, linked through IoRequest::mNext
+    static IoRequest* sQueueHead;
+    static IoRequest* sQueueTail;
+};
+
+internal::IoLock IoThreadPool::sLock;
+internal::IoThreadHandle IoThreadPool::sThreads[IoThreadPool::MAX_IO_THREADS];
+int IoThreadPool::sThreadCount = 0;
+bool IoThreadPool::sShutdown = false;
+IoRequest* IoThreadPool::sQueueHead = nullptr;
+IoRequest* IoThreadPool::sQueueTail = nullptr;
+
+//----------------------------------------------------------------------------------------
+
+#if PEGASUS_PLATFORM_WINDOWS
+DWORD WINAPI IoThreadPool::ThreadMain(LPVOID)
+{
+    RunThread();
+    return 0;
+}
+#else
+void* IoThreadPool::ThreadMain(void*)
+{
+    RunThread();
+    return nullptr;
+}
+#endif
+
+//----------------------------------------------------------------------------------------
+
+void IoThreadPool::RunThread()
+{
+    sLock.Lock();
+    for (;;)
+    {
+        while (sQueueHead == nullptr && !sShutdown)
+        {
+            sLock.WaitForWork();
+        }
+
+        //the queue is drained before exiting, so no submitted request is left pending
+        if (sQueueHead == nullptr)
+        {
+            break;
+        }
+
+        IoRequest* request = sQueueHead;
+        sQueueHead = request->mNext;
+        if (sQueueHead == nullptr)
+        {
+            sQueueTail = nullptr;
+        }
+        request->mNext = nullptr;
+
+        sLock.Unlock();
+        request->Execute();
+        sLock.Lock();
+
+        request->mState = IoRequest::STATE_DONE;
+        sLock.BroadcastDone();
+    }
+    sLock.Unlock();
+}
+
+//----------------------------------------------------------------------------------------
+
+void IoThreadPool::Initialize(int threadCount)
+{
+    PG_ASSERTSTR(sThreadCount == 0, "The IO threads are already initialized");
+
+    if (threadCount < 0)
+    {
+        //reads mostly wait on the disk, a few threads are enough to keep it busy
+#if PEGASUS_PLATFORM_WINDOWS
+        SYSTEM_INFO sysInfo;
+        GetSystemInfo(&sysInfo);
+        threadCount = static_cast<int>(sysInfo.dwNumberOfProcessors);
+#else
+        threadCount = static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN));
+#endif
+        threadCount = threadCount > 4 ? 4 : (threadCount < 1 ? 1 : threadCount);
+    }
+    threadCount = threadCount > MAX_IO_THREADS ? MAX_IO_THREADS : threadCount;
+
+    PG_LOG('CORE', "Initializing %d IO threads", threadCount);
+
+    sLock.Initialize();
+    sShutdown = false;
+    sQueueHead = nullptr;
+    sQueueTail = nullptr;
+
+    for (int t = 0; t < threadCount; ++t)
+    {
+#if PEGASUS_PLATFORM_WINDOWS
+        sThreads[t] = CreateThread(nullptr, 0, ThreadMain, nullptr, 0, nullptr);
+        const bool created = sThreads[t] != nullptr;
+#else
+        const bool created = pthread_create(&sThreads[t], nullptr, ThreadMain, nullptr) == 0;
+#endif
+        if (!created)
+        {
+            PG_LOG('ERR_', "Unable to create IO thread %d", t);
+            break;
+        }
+        ++sThreadCount;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void IoThreadPool::Shutdown()
+{
+    if (sThreadCount == 0)
+    {
+        return;
+    }
+
+    sLock.Lock();
+    sShutdown = true;
+    sLock.BroadcastWork();
+    sLock.Unlock();
+
+#if PEGASUS_PLATFORM_WINDOWS
+    WaitForMultipleObjects(sThreadCount, sThreads, TRUE, INFINITE);
+    for (int t = 0; t < sThreadCount; ++t)
+    {
+        CloseHandle(sThreads[t]);
+    }
+#else
+    for (int t = 0; t < sThreadCount; ++t)
+    {
+        pthread_join(sThreads[t], nullptr);
+    }
+#endif
+
+    PG_ASSERTSTR(sQueueHead == nullptr, "IO requests left in the queue after shutdown");
+    sLock.Destroy();
+    sThreadCount = 0;
+}
+
+//----------------------------------------------------------------------------------------
+
+void IoThreadPool::Submit(IoRequest* request)
+{
+    if (sThreadCount == 0)
+    {
+        //no IO thread, read on the submitting thread
+        request->Execute();
+        request->mState = IoRequest::STATE_DONE;
+        return;
+    }
+
+    sLock.Lock();
+    request->mNext = nullptr;
+    if (sQueueTail != nullptr)
+    {
+        sQueueTail->mNext = request;
+    }
+    else
+    {
+        sQueueHead = request;
+    }
+    sQueueTail = request;
+    sLock.SignalWork();
+    sLock.Unlock();
+}
+
+//----------------------------------------------------------------------------------------
+
+void IoThreadPool::Wait(IoRequest* request)
+{
+    if (sThreadCount == 0)
+    {
+        return;
+    }
+
+    sLock.Lock();
+    while (request->mState != IoRequest::STATE_DONE)
+    {
+        sLock.WaitForDone();
+    }
+    sLock.Unlock();
+}
+
+//----------------------------------------------------------------------------------------
+
+bool IoThreadPool::IsDone(const IoRequest* request)
+{
+    if (sThreadCount == 0)
+    {
+        return request->mState == IoRequest::STATE_DONE;
+    }
+
+    sLock.Lock();
+    const bool isDone = request->mState == IoRequest::STATE_DONE;
+    sLock.Unlock();
+    return isDone;
+}
+
+//----------------------------------------------------------------------------------------
+
+void InitializeIoThreads(int threadCount)
+{
+    IoThreadPool::Initialize(threadCount);
+}
+
+//----------------------------------------------------------------------------------------
+
+void ShutdownIoThreads()
+{
+    IoThreadPool::Shutdown();
+}
+
+//----------------------------------------------------------------------------------------
+
+int GetIoThreadCount()
+{
+    return IoThreadPool::GetThreadCount();
+}
+
+//----------------------------------------------------------------------------------------
+
+void IOManager::SubmitRead(IoRequest* request)
+{
+    PG_ASSERTSTR(request->mState != IoRequest::STATE_PENDING, "The IO request \"%s\" is already pending", request->mPath);
+    PG_ASSERTSTR(request->mPath[0] != '\0', "The IO request has no file set");
+
+    request->mManager = this;
+    request->mBuffer.DestroyBuffer();
+    request->mResult = ERR_NONE;
+    request->mState = IoRequest::STATE_PENDING;
+    IoThreadPool::Submit(request);
+}
+
+//----------------------------------------------------------------------------------------
+
+void IOManager::WaitForRequest(IoRequest* request)
+{
+    PG_ASSERTSTR(request->mState != IoRequest::STATE_IDLE, "Waiting for an IO request that was never submitted");
+    IoThreadPool::Wait(request);
+}
+
+//----------------------------------------------------------------------------------------
+
+IoRequest::IoRequest()
+:   mMapFile(false),
+    mAllocator(nullptr),
+    mCallback(nullptr),
+    mUserData(nullptr),
+    mManager(nullptr),
+    mResult(ERR_NONE),
+    mState(STATE_IDLE),
+    mNext(nullptr)
+{
+    mPath[0] = '\0';
+}
+
+//----------------------------------------------------------------------------------------
+
+IoRequest::~IoRequest()
+{
+    PG_ASSERTSTR(mState != STATE_PENDING || IsDone(), "Destroying the IO request \"%s\" while it is pending", mPath);
+}
+
+//----------------------------------------------------------------------------------------
+
+void IoRequest::SetFile(const char* relativePath, bool mapFile, Alloc::IAllocator* alloc)
+{
+    PG_ASSERTSTR(mState != STATE_PENDING || IsDone(), "Changing the IO request \"%s\" while it is pending", mPath);
+    PG_ASSERTSTR(Pegasus::Utils::Strlen(relativePath) < IOManager::MAX_FILEPATH_LENGTH, "Path str is too long for an IO request!");
+
+    mBuffer.DestroyBuffer();
+    mPath[0] = '\0';
+    Pegasus::Utils::Strcat(mPath, relativePath);
+    mPath[IOManager::MAX_FILEPATH_LENGTH - 1] = '\0';
+    mMapFile = mapFile;
+    mAllocator = alloc;
+    mResult = ERR_NONE;
+    mState = STATE_IDLE;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool IoRequest::IsDone() const
+{
+    return IoThreadPool::IsDone(this);
+}
+
+//----------------------------------------------------------------------------------------
+
+void IoRequest::Execute()
+{
+    mResult = mMapFile ? mManager->MapFileToBuffer(mPath, mBuffer, mAllocator)
+                       : mManager->OpenFileToBuffer(mPath, mBuffer, true, mAllocator);
+    if (mCallback != nullptr)
+    {
+        mCallback(this, mUserData);
+    }
+}
+
+
+} // namespace Io
+} // namespace Pegasus
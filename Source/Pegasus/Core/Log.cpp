@@ -59,10 +59,11 @@ void LogManager::Log(LogChannel logChannel, const char * msgStr, ...)
         // Handler defined. Call it.
 
         // Format the input string with the extra parameters if there are any
+        // The buffer lives on the stack, so messages logged from worker threads do not overwrite each other
+        char buffer[LOGARGS_BUFFER_SIZE];
         char * formattedString = nullptr;
         if (msgStr != nullptr)
         {
-            static char buffer[LOGARGS_BUFFER_SIZE];
             va_list args;
             va_start(args, msgStr);
             vsnprintf_s(buffer, LOGARGS_BUFFER_SIZE, LOGARGS_BUFFER_SIZE - 1, msgStr, args);
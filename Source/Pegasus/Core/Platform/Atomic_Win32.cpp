@@ -0,0 +1,34 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Atomic_Win32.cpp
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Backoff of the threads waiting on atomic locks (Win32 implementation)
+
+#if PEGASUS_PLATFORM_WINDOWS
+
+#include "Pegasus/Core/Atomic.h"
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+namespace Pegasus {
+namespace Core {
+
+
+void YieldThread()
+{
+    // Returns immediately when no other thread is ready to run on the processor,
+    // the caller keeps spinning in that case
+    SwitchToThread();
+}
+
+
+}   // namespace Core
+}   // namespace Pegasus
+
+#endif  // PEGASUS_PLATFORM_WINDOWS
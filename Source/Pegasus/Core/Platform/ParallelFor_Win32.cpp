@@ -0,0 +1,230 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   ParallelFor_Win32.cpp
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Parallel for loop over a pool of worker threads (Win32 implementation)
+
+#if PEGASUS_PLATFORM_WINDOWS
+
+#include "Pegasus/Core/ParallelFor.h"
+#include "Pegasus/Core/Log.h"
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+namespace Pegasus {
+namespace Core {
+
+
+//! Maximum number of worker threads, not counting the calling thread
+static const int MAX_PARALLELFOR_WORKERS = 31;
+
+//! Parallel for currently running. Only one runs at a time, others run serially
+struct ParallelForJob
+{
+    ParallelForCallback mCallback;
+    void* mUserData;
+    int mCount;
+    int mGrainSize;
+    LONG mChunkCount;
+
+    //! Next chunk to claim
+    volatile LONG mNextChunk;
+
+    //! Number of wake up tokens released for this job and not yet completed
+    volatile LONG mPendingWorkers;
+};
+
+static ParallelForJob gJob;
+
+//! Worker thread handles
+static HANDLE gWorkers[MAX_PARALLELFOR_WORKERS];
+
+//! Number of running worker threads
+static int gWorkerCount = 0;
+
+//! Max number of threads a parallel for can use, including the caller (0 means no limit)
+static int gThreadLimit = 0;
+
+//! One token per worker to wake up
+static HANDLE gWakeSemaphore = nullptr;
+
+//! Signaled when the last woken worker of a job is done
+static HANDLE gDoneEvent = nullptr;
+
+//! 1 while a parallel for is using the workers
+static volatile LONG gBusy = 0;
+
+//! 1 when the workers have to exit
+static volatile LONG gShutdown = 0;
+
+//----------------------------------------------------------------------------------------
+
+//! Claims and runs chunks of the current job until there are none left
+static void RunParallelForChunks(ParallelForJob& job)
+{
+    for (;;)
+    {
+        const LONG chunk = InterlockedIncrement(&job.mNextChunk) - 1;
+        if (chunk >= job.mChunkCount)
+        {
+            break;
+        }
+
+        const int begin = static_cast<int>(chunk) * job.mGrainSize;
+        const int end = begin + job.mGrainSize < job.mCount ? begin + job.mGrainSize : job.mCount;
+        job.mCallback(begin, end, job.mUserData);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+static DWORD WINAPI ParallelForWorkerMain(LPVOID)
+{
+    for (;;)
+    {
+        WaitForSingleObject(gWakeSemaphore, INFINITE);
+        if (gShutdown != 0)
+        {
+            break;
+        }
+
+        RunParallelForChunks(gJob);
+
+        //the caller waits for every woken worker, so the job is never touched after ParallelFor returns
+        if (InterlockedDecrement(&gJob.mPendingWorkers) == 0)
+        {
+            SetEvent(gDoneEvent);
+        }
+    }
+    return 0;
+}
+
+//----------------------------------------------------------------------------------------
+
+void InitializeParallelFor(int workerCount)
+{
+    PG_ASSERTSTR(gWorkerCount == 0, "The parallel for workers are already initialized");
+
+    if (workerCount < 0)
+    {
+        SYSTEM_INFO sysInfo;
+        GetSystemInfo(&sysInfo);
+        workerCount = static_cast<int>(sysInfo.dwNumberOfProcessors) - 1;
+    }
+    workerCount = workerCount > MAX_PARALLELFOR_WORKERS ? MAX_PARALLELFOR_WORKERS : workerCount;
+
+    PG_LOG('CORE', "Initializing the parallel for with %d worker threads", workerCount);
+
+    gShutdown = 0;
+    gBusy = 0;
+    gWakeSemaphore = CreateSemaphore(nullptr, 0, MAX_PARALLELFOR_WORKERS, nullptr);
+    gDoneEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+
+    for (int w = 0; w < workerCount; ++w)
+    {
+        gWorkers[w] = CreateThread(nullptr, 0, ParallelForWorkerMain, nullptr, 0, nullptr);
+        if (gWorkers[w] == nullptr)
+        {
+            PG_LOG('ERR_', "Unable to create parallel for worker thread %d", w);
+            break;
+        }
+        ++gWorkerCount;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void ShutdownParallelFor()
+{
+    if (gWakeSemaphore == nullptr)
+    {
+        return;
+    }
+
+    PG_ASSERTSTR(gBusy == 0, "Shutting down the parallel for while it is running");
+    InterlockedExchange(&gShutdown, 1);
+    if (gWorkerCount > 0)
+    {
+        ReleaseSemaphore(gWakeSemaphore, gWorkerCount, nullptr);
+        WaitForMultipleObjects(gWorkerCount, gWorkers, TRUE, INFINITE);
+        for (int w = 0; w < gWorkerCount; ++w)
+        {
+            CloseHandle(gWorkers[w]);
+            gWorkers[w] = nullptr;
+        }
+    }
+
+    CloseHandle(gWakeSemaphore);
+    CloseHandle(gDoneEvent);
+    gWakeSemaphore = nullptr;
+    gDoneEvent = nullptr;
+    gWorkerCount = 0;
+}
+
+//----------------------------------------------------------------------------------------
+
+int GetParallelForThreadCount()
+{
+    return gWorkerCount + 1;
+}
+
+//----------------------------------------------------------------------------------------
+
+void SetParallelForThreadLimit(int threadCount)
+{
+    PG_ASSERT(threadCount >= 0);
+    gThreadLimit = threadCount;
+}
+
+//----------------------------------------------------------------------------------------
+
+void ParallelFor(int count, int grainSize, ParallelForCallback callback, void* userData)
+{
+    PG_ASSERTSTR(grainSize > 0, "Invalid parallel for grain size");
+    if (count <= 0)
+    {
+        return;
+    }
+
+    const int chunkCount = (count + grainSize - 1) / grainSize;
+    int workers = gThreadLimit > 0 && gThreadLimit - 1 < gWorkerCount ? gThreadLimit - 1 : gWorkerCount;
+    workers = chunkCount - 1 < workers ? chunkCount - 1 : workers;
+
+    //serial path: nothing to share, or the workers are already taken (nested or concurrent call)
+    if (workers <= 0 || InterlockedCompareExchange(&gBusy, 1, 0) != 0)
+    {
+        for (int begin = 0; begin < count; begin += grainSize)
+        {
+            callback(begin, begin + grainSize < count ? begin + grainSize : count, userData);
+        }
+        return;
+    }
+
+    gJob.mCallback = callback;
+    gJob.mUserData = userData;
+    gJob.mCount = count;
+    gJob.mGrainSize = grainSize;
+    gJob.mChunkCount = chunkCount;
+    gJob.mPendingWorkers = workers;
+    InterlockedExchange(&gJob.mNextChunk, 0);
+
+    ReleaseSemaphore(gWakeSemaphore, workers, nullptr);
+    RunParallelForChunks(gJob);
+    WaitForSingleObject(gDoneEvent, INFINITE);
+
+    InterlockedExchange(&gBusy, 0);
+}
+
+
+}   // namespace Core
+}   // namespace Pegasus
+
+#else
+PEGASUS_AVOID_EMPTY_FILE_WARNING
+#endif  // PEGASUS_PLATFORM_WINDOWS
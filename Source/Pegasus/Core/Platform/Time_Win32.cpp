@@ -60,26 +60,33 @@ void InitializePegasusTime()
 //----------------------------------------------------------------------------------------
 
 void UpdatePegasusTime()
+{
+    gCurrentPegasusTime = ReadPegasusTime();
+}
+
+//----------------------------------------------------------------------------------------
+
+double GetPegasusTime()
+{
+    return gCurrentPegasusTime;
+}
+
+//----------------------------------------------------------------------------------------
+
+double ReadPegasusTime()
 {
     if (gPerfCounterSupported)
     {
         LARGE_INTEGER counter;
         QueryPerformanceCounter(&counter);
-        gCurrentPegasusTime = static_cast<double>(counter.QuadPart) * gPerfCounterPrecision;
+        return static_cast<double>(counter.QuadPart) * gPerfCounterPrecision;
     }
     else
     {
-        gCurrentPegasusTime = static_cast<double>(GetTickCount()) * 0.001;
+        return static_cast<double>(GetTickCount()) * 0.001;
     }
 }
 
-//----------------------------------------------------------------------------------------
-
-double GetPegasusTime()
-{
-    return gCurrentPegasusTime;
-}
-
 
 }   // namespace Core
 }   // namespace Pegasus
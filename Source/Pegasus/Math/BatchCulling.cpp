@@ -0,0 +1,193 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   BatchCulling.cpp
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Culling of arrays of bounding boxes and spheres against a convex volume.
+//!         Each plane is broadcast to all the lanes, each lane testing one volume.
+
+#include "Pegasus/Math/BatchCulling.h"
+#include "Pegasus/Math/Simd.h"
+
+namespace Pegasus {
+namespace Math {
+
+namespace
+{
+
+//! Largest number of planes of a culled volume
+const int MAX_CULL_PLANE_COUNT = 16;
+
+//! Largest number of float planes of the culled elements (the 6 of the boxes)
+const int MAX_CULL_ELEMENT_PLANE_COUNT = 6;
+
+//! Planes of the culled volume, each coefficient broadcast to a register
+struct CullPlanes
+{
+    SimdFloat4 mNormal[MAX_CULL_PLANE_COUNT][3];
+    SimdFloat4 mD[MAX_CULL_PLANE_COUNT];
+
+    //! For each normal component, the box plane (min or max) giving the corner of the box
+    //! the furthest in the back of the plane (n-vertex), and the one the furthest in the front (p-vertex)
+    int mBackBoxPlane[MAX_CULL_PLANE_COUNT][3];
+    int mFrontBoxPlane[MAX_CULL_PLANE_COUNT][3];
+    int mCount;
+
+    CullPlanes(const Plane * planes, int planeCount)
+    : mCount(planeCount < MAX_CULL_PLANE_COUNT ? planeCount : MAX_CULL_PLANE_COUNT)
+    {
+        PG_ASSERTSTR(planeCount <= MAX_CULL_PLANE_COUNT, "Too many planes to cull with (%d), the maximum is %d", planeCount, MAX_CULL_PLANE_COUNT);
+        for (int p = 0; p < mCount; ++p)
+        {
+            const Vec3 & normal = planes[p].GetNormal();
+            for (int c = 0; c < 3; ++c)
+            {
+                mNormal[p][c] = SimdSet1(normal.v[c]);
+                mBackBoxPlane[p][c] = normal.v[c] >= 0.0f ? c : c + 3;
+                mFrontBoxPlane[p][c] = normal.v[c] >= 0.0f ? c + 3 : c;
+            }
+            mD[p] = SimdSet1(planes[p].GetOriginDistance());
+        }
+    }
+
+    //! Signed distances of 4 points to a plane, negative in the back
+    SimdFloat4 GetDistance(int p, SimdFloat4 x, SimdFloat4 y, SimdFloat4 z) const
+    {
+        return SimdMulAdd(mNormal[p][0], x, SimdMulAdd(mNormal[p][1], y, SimdMulAdd(mNormal[p][2], z, mD[p])));
+    }
+};
+
+//! 4 box kernel, the boxes being in the back of the planes (inside) when their p-vertex is,
+//! and in the front (outside) when their n-vertex is not in the back
+struct AabbCullKernel
+{
+    const CullPlanes& mPlanes;
+
+    explicit AabbCullKernel(const CullPlanes& planes) : mPlanes(planes) {}
+
+    void operator()(int& insideBits, int& outsideBits, const PFloat32 * boxes, int pitch) const
+    {
+        SimdFloat4 b[6];
+        for (int i = 0; i < 6; ++i)
+        {
+            b[i] = SimdLoadU(boxes + i * pitch);
+        }
+
+        const SimdFloat4 zero = SimdZero();
+        int outside = 0;
+        int notInside = 0;
+        for (int p = 0; p < mPlanes.mCount && outside != 0xF; ++p)
+        {
+            const int* back = mPlanes.mBackBoxPlane[p];
+            const int* front = mPlanes.mFrontBoxPlane[p];
+            const SimdFloat4 nDist = mPlanes.GetDistance(p, b[back[0]], b[back[1]], b[back[2]]);
+            const SimdFloat4 pDist = mPlanes.GetDistance(p, b[front[0]], b[front[1]], b[front[2]]);
+            outside |= ~SimdMoveMask(SimdCmpGt(zero, nDist)) & 0xF;
+            notInside |= ~SimdMoveMask(SimdCmpGt(zero, pDist)) & 0xF;
+        }
+
+        outsideBits = outside;
+        insideBits = ~(outside | notInside) & 0xF;
+    }
+};
+
+//! 4 sphere kernel, the spheres being in the back of the planes (inside) when their distance is under -radius,
+//! and in the front (outside) when it is not under radius
+struct SphereCullKernel
+{
+    const CullPlanes& mPlanes;
+
+    explicit SphereCullKernel(const CullPlanes& planes) : mPlanes(planes) {}
+
+    void operator()(int& insideBits, int& outsideBits, const PFloat32 * spheres, int pitch) const
+    {
+        const SimdFloat4 x = SimdLoadU(spheres);
+        const SimdFloat4 y = SimdLoadU(spheres + pitch);
+        const SimdFloat4 z = SimdLoadU(spheres + 2 * pitch);
+        const SimdFloat4 r = SimdLoadU(spheres + 3 * pitch);
+
+        const SimdFloat4 zero = SimdZero();
+        int outside = 0;
+        int notInside = 0;
+        for (int p = 0; p < mPlanes.mCount && outside != 0xF; ++p)
+        {
+            const SimdFloat4 dist = mPlanes.GetDistance(p, x, y, z);
+            outside |= ~SimdMoveMask(SimdCmpGt(r, dist)) & 0xF;
+            notInside |= ~SimdMoveMask(SimdCmpGt(zero, SimdAdd(dist, r))) & 0xF;
+        }
+
+        outsideBits = outside;
+        insideBits = ~(outside | notInside) & 0xF;
+    }
+};
+
+//! Runs a 4 element culling kernel over count elements, and fills the masks.
+//! The remainder (count % 4) goes through a padded local copy, so nothing is read past count.
+template <class Kernel>
+void RunCullKernel(PUInt32 * insideMask, PUInt32 * outsideMask, const PFloat32 * src, int pitch, int count, int planeCount, const Kernel& kernel)
+{
+    const int maskSize = GetCullMaskSize(count);
+    for (int w = 0; w < maskSize; ++w)
+    {
+        insideMask[w] = 0;
+        outsideMask[w] = 0;
+    }
+
+    // SIMD_WIDTH divides 32, so the bits of a block never straddle two words
+    int insideBits;
+    int outsideBits;
+    int e = 0;
+    for (; e + SIMD_WIDTH <= count; e += SIMD_WIDTH)
+    {
+        kernel(insideBits, outsideBits, src + e, pitch);
+        insideMask[e >> 5] |= static_cast<PUInt32>(insideBits) << (e & 31);
+        outsideMask[e >> 5] |= static_cast<PUInt32>(outsideBits) << (e & 31);
+    }
+
+    const int remainder = count - e;
+    if (remainder > 0)
+    {
+        PFloat32 tmpSrc[MAX_CULL_ELEMENT_PLANE_COUNT * SIMD_WIDTH];
+        for (int p = 0; p < planeCount; ++p)
+        {
+            for (int l = 0; l < SIMD_WIDTH; ++l)
+            {
+                tmpSrc[p * SIMD_WIDTH + l] = l < remainder ? src[p * pitch + e + l] : 0.0f;
+            }
+        }
+
+        kernel(insideBits, outsideBits, tmpSrc, SIMD_WIDTH);
+
+        const int validBits = (1 << remainder) - 1;
+        insideMask[e >> 5] |= static_cast<PUInt32>(insideBits & validBits) << (e & 31);
+        outsideMask[e >> 5] |= static_cast<PUInt32>(outsideBits & validBits) << (e & 31);
+    }
+}
+
+}
+
+//----------------------------------------------------------------------------------------
+
+void CullAabbsSoa(PUInt32 * insideMask, PUInt32 * outsideMask, const PFloat32 * boxes, int pitch, int count,
+                  const Plane * planes, int planeCount)
+{
+    const CullPlanes cullPlanes(planes, planeCount);
+    RunCullKernel(insideMask, outsideMask, boxes, pitch, count, 6, AabbCullKernel(cullPlanes));
+}
+
+//----------------------------------------------------------------------------------------
+
+void CullSpheresSoa(PUInt32 * insideMask, PUInt32 * outsideMask, const PFloat32 * spheres, int pitch, int count,
+                    const Plane * planes, int planeCount)
+{
+    const CullPlanes cullPlanes(planes, planeCount);
+    RunCullKernel(insideMask, outsideMask, spheres, pitch, count, 4, SphereCullKernel(cullPlanes));
+}
+
+
+}   // namespace Math
+}   // namespace Pegasus
@@ -0,0 +1,398 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   BatchTransform.cpp
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Transforms of arrays of points, normals and bounding boxes by one matrix.
+//!         The point and normal transforms run the same kernels over planes, one component of 4 elements
+//!         per register (8 with AVX). The strided versions load a tile of elements and transpose it to planes.
+
+#include "Pegasus/Math/BatchTransform.h"
+#include "Pegasus/Math/Simd.h"
+
+namespace Pegasus {
+namespace Math {
+
+namespace
+{
+
+//! Advances a pointer of a strided array by stride bytes
+inline const PFloat32 * NextElement(const PFloat32 * element, int stride)
+{
+    return reinterpret_cast<const PFloat32 *>(reinterpret_cast<const char *>(element) + stride);
+}
+
+inline PFloat32 * NextElement(PFloat32 * element, int stride)
+{
+    return reinterpret_cast<PFloat32 *>(reinterpret_cast<char *>(element) + stride);
+}
+
+//! Columns of a 4x4 matrix, one register per column
+struct Mat44Columns
+{
+    SimdFloat4 mCol[4];
+
+    explicit Mat44Columns(Mat44In mat)
+    {
+        mCol[0] = SimdLoadU(&mat.m[0]);
+        mCol[1] = SimdLoadU(&mat.m[4]);
+        mCol[2] = SimdLoadU(&mat.m[8]);
+        mCol[3] = SimdLoadU(&mat.m[12]);
+        SimdTranspose4(mCol[0], mCol[1], mCol[2], mCol[3]);
+    }
+};
+
+//! Stores the first 3 lanes of a register
+inline void StoreXYZ(PFloat32 * dst, SimdFloat4 v)
+{
+    dst[0] = SimdGetX(v);
+    dst[1] = SimdGetX(SimdSwizzle<1, 1, 1, 1>(v));
+    dst[2] = SimdGetX(SimdSwizzle<2, 2, 2, 2>(v));
+}
+
+//! Width dependent operations of the kernels, for SimdFloat4 and SimdFloat8 registers
+template <class V> struct SimdLanes;
+
+template <> struct SimdLanes<SimdFloat4>
+{
+    static const int WIDTH = SIMD_WIDTH;
+    static SimdFloat4 Set1(PFloat32 s)                 { return SimdSet1(s); }
+    static SimdFloat4 LoadU(const PFloat32 * src)      { return SimdLoadU(src); }
+};
+
+#if PEGASUS_MATH_SIMD_AVX
+template <> struct SimdLanes<SimdFloat8>
+{
+    static const int WIDTH = SIMD_WIDTH8;
+    static SimdFloat8 Set1(PFloat32 s)                 { return SimdSet1_8(s); }
+    static SimdFloat8 LoadU(const PFloat32 * src)      { return SimdLoadU8(src); }
+};
+
+//! Register of the array loops, the widest one of the target
+typedef SimdFloat8 BatchFloat;
+#else
+typedef SimdFloat4 BatchFloat;
+#endif
+
+//! Largest number of lanes of the kernels
+const int MAX_BATCH_WIDTH = 8;
+
+//! Divides the vectors by their length, where the length is over PFLOAT_EPSILON
+//! \param len Length of the vectors
+//! \param v Vectors, normalized in place
+//! \param vectorCount Number of registers of v
+template <class V>
+inline void NormalizeWhereNotZero(V len, V * v, int vectorCount)
+{
+    const V eps = SimdLanes<V>::Set1(PFLOAT_EPSILON);
+    const V mask = SimdCmpGt(len, eps);
+    const V invLen = SimdDiv(SimdLanes<V>::Set1(1.0f), SimdMax(len, eps));
+    for (int i = 0; i < vectorCount; ++i)
+    {
+        v[i] = SimdSelect(mask, SimdMul(v[i], invLen), v[i]);
+    }
+}
+
+//! Largest number of planes of the SoA kernels
+const int MAX_SOA_PLANE_COUNT = 4;
+
+//! Runs a SoA kernel over count elements, Kernel::WIDTH elements at a time.
+//! The remainder goes through a padded local copy, so nothing is read or written past count.
+template <class Kernel>
+void RunSoaKernel(PFloat32 * dst, int dstPitch, const PFloat32 * src, int srcPitch, int count, int planeCount, const Kernel& kernel)
+{
+    const int width = Kernel::WIDTH;
+    int e = 0;
+    for (; e + width <= count; e += width)
+    {
+        kernel(dst + e, dstPitch, src + e, srcPitch);
+    }
+
+    const int remainder = count - e;
+    if (remainder > 0)
+    {
+        PFloat32 tmpSrc[MAX_SOA_PLANE_COUNT * MAX_BATCH_WIDTH];
+        PFloat32 tmpDst[MAX_SOA_PLANE_COUNT * MAX_BATCH_WIDTH];
+        for (int p = 0; p < planeCount; ++p)
+        {
+            for (int l = 0; l < width; ++l)
+            {
+                tmpSrc[p * width + l] = l < remainder ? src[p * srcPitch + e + l] : 0.0f;
+            }
+        }
+
+        kernel(tmpDst, width, tmpSrc, width);
+
+        for (int p = 0; p < planeCount; ++p)
+        {
+            for (int l = 0; l < remainder; ++l)
+            {
+                dst[p * dstPitch + e + l] = tmpDst[p * width + l];
+            }
+        }
+    }
+}
+
+//! Loads the element l of a strided array, 0 past elementCount.
+//! A 3 float element followed by another one is read with one 4 float load, the last lane being garbage.
+inline SimdFloat4 LoadElement(const PFloat32 * src, int srcStride, int l, int elementCount, int componentCount)
+{
+    if (l >= elementCount)
+    {
+        return SimdZero();
+    }
+    const PFloat32 * element = NextElement(src, l * srcStride);
+    return componentCount == 4 || l + 1 < elementCount ? SimdLoadU(element) : SimdSet(element[0], element[1], element[2], 0.0f);
+}
+
+//! Stores the first componentCount lanes of a register to the element l of a strided array, nothing past elementCount
+inline void StoreElement(PFloat32 * dst, int dstStride, int l, int elementCount, int componentCount, SimdFloat4 v)
+{
+    if (l < elementCount)
+    {
+        PFloat32 * element = NextElement(dst, l * dstStride);
+        if (componentCount == 4)
+        {
+            SimdStoreU(element, v);
+        }
+        else
+        {
+            StoreXYZ(element, v);
+        }
+    }
+}
+
+//! Loads up to 4 elements of a strided array and transposes them to 4 planes (x, y, z, w)
+inline void LoadTile(SimdFloat4 * planes, const PFloat32 * src, int srcStride, int elementCount, int componentCount)
+{
+    for (int l = 0; l < 4; ++l)
+    {
+        planes[l] = LoadElement(src, srcStride, l, elementCount, componentCount);
+    }
+    SimdTranspose4(planes[0], planes[1], planes[2], planes[3]);
+}
+
+//! Transposes 4 planes back to elements, and stores the first elementCount ones
+inline void StoreTile(PFloat32 * dst, int dstStride, SimdFloat4 * planes, int elementCount, int componentCount)
+{
+    SimdTranspose4(planes[0], planes[1], planes[2], planes[3]);
+    for (int l = 0; l < 4; ++l)
+    {
+        StoreElement(dst, dstStride, l, elementCount, componentCount, planes[l]);
+    }
+}
+
+#if PEGASUS_MATH_SIMD_AVX
+//! 8 element version, elements 0 to 3 in the low halves of the planes, 4 to 7 in the high halves
+inline void LoadTile(SimdFloat8 * planes, const PFloat32 * src, int srcStride, int elementCount, int componentCount)
+{
+    for (int l = 0; l < 4; ++l)
+    {
+        planes[l] = SimdCombine(LoadElement(src, srcStride, l, elementCount, componentCount),
+                                LoadElement(src, srcStride, l + 4, elementCount, componentCount));
+    }
+    SimdTranspose4(planes[0], planes[1], planes[2], planes[3]);
+}
+
+inline void StoreTile(PFloat32 * dst, int dstStride, SimdFloat8 * planes, int elementCount, int componentCount)
+{
+    SimdTranspose4(planes[0], planes[1], planes[2], planes[3]);
+    for (int l = 0; l < 4; ++l)
+    {
+        StoreElement(dst, dstStride, l, elementCount, componentCount, SimdGetLow(planes[l]));
+        StoreElement(dst, dstStride, l + 4, elementCount, componentCount, SimdGetHigh(planes[l]));
+    }
+}
+#endif
+
+//! Runs a SoA kernel over count elements of strided arrays: Kernel::WIDTH elements are loaded,
+//! transposed to planes, transformed and transposed back. All the elements of a tile are loaded
+//! before any is stored, so the destination can be the source.
+template <class Kernel>
+void RunStridedKernel(PFloat32 * dst, int dstStride, int dstComponentCount,
+                      const PFloat32 * src, int srcStride, int srcComponentCount, int count, const Kernel& kernel)
+{
+    typename Kernel::Register planes[4];
+    for (int e = 0; e < count; e += Kernel::WIDTH)
+    {
+        const int elementCount = Min(count - e, static_cast<int>(Kernel::WIDTH));
+        LoadTile(planes, NextElement(src, e * srcStride), srcStride, elementCount, srcComponentCount);
+        kernel.Transform(planes);
+        StoreTile(NextElement(dst, e * dstStride), dstStride, planes, elementCount, dstComponentCount);
+    }
+}
+
+//! Homogeneous point kernel, matrix pre-splatted
+template <class V>
+struct HomogeneousPointSoaKernel
+{
+    typedef V Register;
+    static const int WIDTH = SimdLanes<V>::WIDTH;
+    V mMat[16];
+
+    explicit HomogeneousPointSoaKernel(Mat44In mat)
+    {
+        for (int i = 0; i < 16; ++i) { mMat[i] = SimdLanes<V>::Set1(mat.m[i]); }
+    }
+
+    //! Transforms the planes (x, y, z, w) in place
+    void Transform(V * p) const
+    {
+        V o[4];
+        for (int r = 0; r < 4; ++r)
+        {
+            o[r] = SimdMul(mMat[r * 4 + 0], p[0]);
+            o[r] = SimdMulAdd(mMat[r * 4 + 1], p[1], o[r]);
+            o[r] = SimdMulAdd(mMat[r * 4 + 2], p[2], o[r]);
+            o[r] = SimdMulAdd(mMat[r * 4 + 3], p[3], o[r]);
+        }
+        for (int r = 0; r < 4; ++r) { p[r] = o[r]; }
+    }
+
+    void operator()(PFloat32 * dst, int dstPitch, const PFloat32 * src, int srcPitch) const
+    {
+        V p[4];
+        for (int r = 0; r < 4; ++r) { p[r] = SimdLanes<V>::LoadU(src + r * srcPitch); }
+        Transform(p);
+        for (int r = 0; r < 4; ++r) { SimdStoreU(dst + r * dstPitch, p[r]); }
+    }
+};
+
+//! Point kernel, the homogeneous one with w = 1
+template <class V>
+struct PointSoaKernel : public HomogeneousPointSoaKernel<V>
+{
+    V mOne;
+
+    explicit PointSoaKernel(Mat44In mat) : HomogeneousPointSoaKernel<V>(mat), mOne(SimdLanes<V>::Set1(1.0f)) {}
+
+    void Transform(V * p) const
+    {
+        p[3] = mOne;
+        HomogeneousPointSoaKernel<V>::Transform(p);
+    }
+};
+
+//! Normal kernel, matrix pre-splatted
+template <class V>
+struct NormalSoaKernel
+{
+    typedef V Register;
+    static const int WIDTH = SimdLanes<V>::WIDTH;
+    V mMat[9];
+    bool mNormalize;
+
+    NormalSoaKernel(Mat33In mat, bool normalize) : mNormalize(normalize)
+    {
+        for (int i = 0; i < 9; ++i) { mMat[i] = SimdLanes<V>::Set1(mat.m[i]); }
+    }
+
+    //! Transforms the planes (x, y, z) in place
+    void Transform(V * p) const
+    {
+        V n[3];
+        for (int r = 0; r < 3; ++r)
+        {
+            n[r] = SimdMul(mMat[r * 3 + 0], p[0]);
+            n[r] = SimdMulAdd(mMat[r * 3 + 1], p[1], n[r]);
+            n[r] = SimdMulAdd(mMat[r * 3 + 2], p[2], n[r]);
+        }
+
+        if (mNormalize)
+        {
+            const V len = SimdSqrt(SimdMulAdd(n[0], n[0], SimdMulAdd(n[1], n[1], SimdMul(n[2], n[2]))));
+            NormalizeWhereNotZero(len, n, 3);
+        }
+
+        for (int r = 0; r < 3; ++r) { p[r] = n[r]; }
+    }
+
+    void operator()(PFloat32 * dst, int dstPitch, const PFloat32 * src, int srcPitch) const
+    {
+        V p[3];
+        for (int r = 0; r < 3; ++r) { p[r] = SimdLanes<V>::LoadU(src + r * srcPitch); }
+        Transform(p);
+        for (int r = 0; r < 3; ++r) { SimdStoreU(dst + r * dstPitch, p[r]); }
+    }
+};
+
+}
+
+//----------------------------------------------------------------------------------------
+
+void TransformPoints(PFloat32 * dst, int dstStride, const PFloat32 * src, int srcStride, int count, Mat44In mat)
+{
+    const PointSoaKernel<BatchFloat> kernel(mat);
+    RunStridedKernel(dst, dstStride, 3, src, srcStride, 3, count, kernel);
+}
+
+//----------------------------------------------------------------------------------------
+
+void TransformHomogeneousPoints(PFloat32 * dst, int dstStride, const PFloat32 * src, int srcStride, int count, Mat44In mat)
+{
+    const HomogeneousPointSoaKernel<BatchFloat> kernel(mat);
+    RunStridedKernel(dst, dstStride, 4, src, srcStride, 4, count, kernel);
+}
+
+//----------------------------------------------------------------------------------------
+
+void TransformNormals(PFloat32 * dst, int dstStride, const PFloat32 * src, int srcStride, int count, Mat33In mat, bool normalize)
+{
+    const NormalSoaKernel<BatchFloat> kernel(mat, normalize);
+    RunStridedKernel(dst, dstStride, 3, src, srcStride, 3, count, kernel);
+}
+
+//----------------------------------------------------------------------------------------
+
+void TransformAabbs(PFloat32 * dst, int dstStride, const PFloat32 * src, int srcStride, int count, Mat44In mat)
+{
+    // Center and half size of the box: the center is transformed as a point,
+    // the half size by the absolute value of the matrix
+    const Mat44Columns cols(mat);
+    SimdFloat4 absCols[3];
+    for (int c = 0; c < 3; ++c)
+    {
+        absCols[c] = SimdMax(cols.mCol[c], SimdSub(SimdZero(), cols.mCol[c]));
+    }
+
+    for (int e = 0; e < count; ++e)
+    {
+        SimdFloat4 center = SimdMulAdd(cols.mCol[0], SimdSet1(0.5f * (src[0] + src[3])), cols.mCol[3]);
+        center = SimdMulAdd(cols.mCol[1], SimdSet1(0.5f * (src[1] + src[4])), center);
+        center = SimdMulAdd(cols.mCol[2], SimdSet1(0.5f * (src[2] + src[5])), center);
+
+        SimdFloat4 halfSize = SimdMul(absCols[0], SimdSet1(0.5f * (src[3] - src[0])));
+        halfSize = SimdMulAdd(absCols[1], SimdSet1(0.5f * (src[4] - src[1])), halfSize);
+        halfSize = SimdMulAdd(absCols[2], SimdSet1(0.5f * (src[5] - src[2])), halfSize);
+
+        StoreXYZ(dst, SimdSub(center, halfSize));
+        StoreXYZ(dst + 3, SimdAdd(center, halfSize));
+
+        src = NextElement(src, srcStride);
+        dst = NextElement(dst, dstStride);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void TransformHomogeneousPointsSoa(PFloat32 * dst, int dstPitch, const PFloat32 * src, int srcPitch, int count, Mat44In mat)
+{
+    const HomogeneousPointSoaKernel<BatchFloat> kernel(mat);
+    RunSoaKernel(dst, dstPitch, src, srcPitch, count, 4, kernel);
+}
+
+//----------------------------------------------------------------------------------------
+
+void TransformNormalsSoa(PFloat32 * dst, int dstPitch, const PFloat32 * src, int srcPitch, int count, Mat33In mat, bool normalize)
+{
+    const NormalSoaKernel<BatchFloat> kernel(mat, normalize);
+    RunSoaKernel(dst, dstPitch, src, srcPitch, count, 3, kernel);
+}
+
+
+}   // namespace Math
+}   // namespace Pegasus
@@ -0,0 +1,888 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   BoundingVolumeHierarchy.cpp
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Dynamic bounding volume hierarchy over axis-aligned bounding boxes, for frustum culling,
+//!         ray picking and overlap queries.
+
+#include "Pegasus/Math/BoundingVolumeHierarchy.h"
+#include "Pegasus/Allocator/Alloc.h"
+#include "Pegasus/Utils/Memcpy.h"
+
+namespace Pegasus {
+namespace Math {
+
+const PFloat32 BoundingVolumeHierarchy::REBUILD_COST_RATIO = 1.5f;
+
+namespace
+{
+
+//! Cost of testing the box of an inner node, relative to the cost of testing the box of an object
+const PFloat32 TRAVERSAL_COST = 1.0f;
+
+//! Number of bins along the split axis in the SAH build
+const int SAH_BIN_COUNT = 16;
+
+//! Depth from which the nodes are split in halves instead of with the SAH, bounding the depth of the tree
+//! to MAX_SAH_DEPTH + 30 levels, as a node of more than 4 objects is split in two halves
+const int MAX_SAH_DEPTH = 32;
+
+//! Size of the node stacks of the build and of the queries, larger than the depth of the tree
+const int NODE_STACK_SIZE = 64;
+
+//! Largest number of planes of QueryFrustum, one bit per plane
+const int MAX_QUERY_PLANE_COUNT = 32;
+
+//! Grow an array to hold at least count elements, doubling its capacity
+//! \param allocator Allocator of the array
+//! \param data Array to grow, replaced by the new array
+//! \param capacity Capacity of the array, updated
+//! \param count Required number of elements
+//! \param preservedCount Number of elements copied to the new array
+template<class T>
+void GrowArray(Alloc::IAllocator * allocator, T *& data, int & capacity, int count, int preservedCount)
+{
+    if (count <= capacity)
+    {
+        return;
+    }
+
+    int newCapacity = capacity < 64 ? 64 : capacity * 2;
+    newCapacity = newCapacity < count ? count : newCapacity;
+    T * newData = PG_NEW_ARRAY(allocator, -1, "BoundingVolumeHierarchy", Alloc::PG_MEM_PERM, T, newCapacity);
+    if (data != nullptr)
+    {
+        Utils::Memcpy(newData, data, preservedCount * sizeof(T));
+        PG_DELETE_ARRAY(allocator, data);
+    }
+    data = newData;
+    capacity = newCapacity;
+}
+
+//! Half the surface area of a box
+inline PFloat32 GetHalfArea(const PFloat32 boxMin[3], const PFloat32 boxMax[3])
+{
+    const PFloat32 x = boxMax[0] - boxMin[0];
+    const PFloat32 y = boxMax[1] - boxMin[1];
+    const PFloat32 z = boxMax[2] - boxMin[2];
+    return x * y + y * z + z * x;
+}
+
+//! Set a box to the empty box, any union with another box giving the other box
+inline void SetEmptyBox(PFloat32 boxMin[3], PFloat32 boxMax[3])
+{
+    for (int c = 0; c < 3; ++c)
+    {
+        boxMin[c] = PFLOAT_MAX;
+        boxMax[c] = -PFLOAT_MAX;
+    }
+}
+
+//! Grow a box to contain another box
+inline void AddBox(PFloat32 boxMin[3], PFloat32 boxMax[3], const PFloat32 otherMin[3], const PFloat32 otherMax[3])
+{
+    for (int c = 0; c < 3; ++c)
+    {
+        boxMin[c] = otherMin[c] < boxMin[c] ? otherMin[c] : boxMin[c];
+        boxMax[c] = otherMax[c] > boxMax[c] ? otherMax[c] : boxMax[c];
+    }
+}
+
+//! Test a box against the planes of a frustum that it intersects
+//! \param planeMask Bits of the planes the box intersects, cleared for the planes the box is in the back of
+//! \return false if the box is in the front of one of the planes (outside)
+inline bool CullBox(PUInt32 & planeMask, const PFloat32 boxMin[3], const PFloat32 boxMax[3], const Plane * planes, int planeCount)
+{
+    for (int p = 0; p < planeCount; ++p)
+    {
+        const PUInt32 bit = 1ul << p;
+        if ((planeMask & bit) != 0)
+        {
+            // n-vertex, the corner the furthest in the back, and p-vertex, the furthest in the front
+            const Vec3 & normal = planes[p].GetNormal();
+            PFloat32 backDistance = planes[p].GetOriginDistance();
+            PFloat32 frontDistance = backDistance;
+            for (int c = 0; c < 3; ++c)
+            {
+                const PFloat32 lo = normal.v[c] * boxMin[c];
+                const PFloat32 hi = normal.v[c] * boxMax[c];
+                backDistance += lo < hi ? lo : hi;
+                frontDistance += lo < hi ? hi : lo;
+            }
+
+            if (backDistance >= 0.0f)
+            {
+                return false;
+            }
+            else if (frontDistance < 0.0f)
+            {
+                planeMask &= ~bit;
+            }
+        }
+    }
+    return true;
+}
+
+//! Test if two boxes overlap, touching boxes overlapping
+inline bool AreOverlapping(const PFloat32 boxMin[3], const PFloat32 boxMax[3], const PFloat32 otherMin[3], const PFloat32 otherMax[3])
+{
+    return boxMin[0] <= otherMax[0] && boxMax[0] >= otherMin[0]
+        && boxMin[1] <= otherMax[1] && boxMax[1] >= otherMin[1]
+        && boxMin[2] <= otherMax[2] && boxMax[2] >= otherMin[2];
+}
+
+//! Test if a box is inside another box
+inline bool IsBoxInside(const PFloat32 boxMin[3], const PFloat32 boxMax[3], const PFloat32 otherMin[3], const PFloat32 otherMax[3])
+{
+    return boxMin[0] >= otherMin[0] && boxMax[0] <= otherMax[0]
+        && boxMin[1] >= otherMin[1] && boxMax[1] <= otherMax[1]
+        && boxMin[2] >= otherMin[2] && boxMax[2] <= otherMax[2];
+}
+
+//! Intersection of a ray with a box with the slab test. The components of the ray parallel to the
+//! slabs give infinite inverse directions, and the NaN of a ray starting on a slab are ignored.
+//! \param entry Receives the distance where the ray enters the box, 0 if it starts inside
+//! \param maxDistance Distance after which the hits are ignored
+//! \return true if the box is hit
+inline bool IntersectRayBox(PFloat32 & entry, const PFloat32 origin[3], const PFloat32 invDirection[3],
+                            const PFloat32 boxMin[3], const PFloat32 boxMax[3], PFloat32 maxDistance)
+{
+    PFloat32 tNear = 0.0f;
+    PFloat32 tFar = maxDistance;
+    for (int c = 0; c < 3; ++c)
+    {
+        PFloat32 t0 = (boxMin[c] - origin[c]) * invDirection[c];
+        PFloat32 t1 = (boxMax[c] - origin[c]) * invDirection[c];
+        if (t0 > t1)
+        {
+            const PFloat32 t = t0;
+            t0 = t1;
+            t1 = t;
+        }
+        tNear = t0 > tNear ? t0 : tNear;
+        tFar = t1 < tFar ? t1 : tFar;
+    }
+    entry = tNear;
+    return tNear <= tFar;
+}
+
+//! Store a query result if there is room for it
+inline void AddResult(int * results, int maxResults, int & resultCount, int userData)
+{
+    if (resultCount < maxResults)
+    {
+        results[resultCount] = userData;
+    }
+    ++resultCount;
+}
+
+//! Node waiting to be split by the build
+struct BuildTask
+{
+    int mNode;
+    int mDepth;
+};
+
+//! Bin of the SAH build
+struct SahBin
+{
+    PFloat32 mMin[3];
+    PFloat32 mMax[3];
+    int mCount;
+};
+
+}
+
+//----------------------------------------------------------------------------------------
+
+BoundingVolumeHierarchy::BoundingVolumeHierarchy(Alloc::IAllocator * allocator)
+:   mAllocator(allocator),
+    mObjects(nullptr),
+    mObjectCapacity(0),
+    mObjectSlotCount(0),
+    mObjectCount(0),
+    mFreeObject(-1),
+    mNodes(nullptr),
+    mNodeCapacity(0),
+    mNodeCount(0),
+    mLeafObjects(nullptr),
+    mLeafObjectCapacity(0),
+    mBuildObjects(nullptr),
+    mBuildObjectCapacity(0),
+    mRefitLeaves(nullptr),
+    mRefitLeafCount(0),
+    mCostSum(0.0),
+    mBuildCost(0.0f),
+    mNeedsBuild(false)
+{
+}
+
+//----------------------------------------------------------------------------------------
+
+BoundingVolumeHierarchy::~BoundingVolumeHierarchy()
+{
+    if (mObjects != nullptr)
+    {
+        PG_DELETE_ARRAY(mAllocator, mObjects);
+    }
+    if (mNodes != nullptr)
+    {
+        PG_DELETE_ARRAY(mAllocator, mNodes);
+        PG_DELETE_ARRAY(mAllocator, mRefitLeaves);
+    }
+    if (mLeafObjects != nullptr)
+    {
+        PG_DELETE_ARRAY(mAllocator, mLeafObjects);
+        PG_DELETE_ARRAY(mAllocator, mBuildObjects);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+BvhObjectHandle BoundingVolumeHierarchy::AddObject(const AxisAlignedBoundingBox & box, int userData)
+{
+    int index = mFreeObject;
+    if (index != -1)
+    {
+        mFreeObject = mObjects[index].mNextFree;
+    }
+    else
+    {
+        GrowArray(mAllocator, mObjects, mObjectCapacity, mObjectSlotCount + 1, mObjectSlotCount);
+        index = mObjectSlotCount++;
+    }
+
+    Object & object = mObjects[index];
+    for (int c = 0; c < 3; ++c)
+    {
+        object.mMin[c] = box.GetMin().v[c];
+        object.mMax[c] = box.GetMax().v[c];
+    }
+    object.mUserData = userData;
+    object.mLeaf = -1;
+    object.mNextFree = -1;
+
+    ++mObjectCount;
+    mNeedsBuild = true;
+    return index;
+}
+
+//----------------------------------------------------------------------------------------
+
+void BoundingVolumeHierarchy::RemoveObject(BvhObjectHandle object)
+{
+    if (!IsObjectValid(object))
+    {
+        PG_FAILSTR("Invalid BVH object handle %d", object);
+        return;
+    }
+
+    mObjects[object].mLeaf = REMOVED_OBJECT;
+    mObjects[object].mNextFree = mFreeObject;
+    mFreeObject = object;
+    --mObjectCount;
+    mNeedsBuild = true;
+}
+
+//----------------------------------------------------------------------------------------
+
+void BoundingVolumeHierarchy::UpdateObject(BvhObjectHandle object, const AxisAlignedBoundingBox & box)
+{
+    if (!IsObjectValid(object))
+    {
+        PG_FAILSTR("Invalid BVH object handle %d", object);
+        return;
+    }
+
+    Object & o = mObjects[object];
+    for (int c = 0; c < 3; ++c)
+    {
+        o.mMin[c] = box.GetMin().v[c];
+        o.mMax[c] = box.GetMax().v[c];
+    }
+
+    // Objects not in the tree yet are placed by the pending build
+    if (!mNeedsBuild && o.mLeaf >= 0 && !mNodes[o.mLeaf].mRefitQueued)
+    {
+        mNodes[o.mLeaf].mRefitQueued = true;
+        mRefitLeaves[mRefitLeafCount++] = o.mLeaf;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void BoundingVolumeHierarchy::Clear()
+{
+    mObjectSlotCount = 0;
+    mObjectCount = 0;
+    mFreeObject = -1;
+    mNodeCount = 0;
+    mRefitLeafCount = 0;
+    mCostSum = 0.0;
+    mBuildCost = 0.0f;
+    mNeedsBuild = false;
+}
+
+//----------------------------------------------------------------------------------------
+
+int BoundingVolumeHierarchy::GetUserData(BvhObjectHandle object) const
+{
+    if (!IsObjectValid(object))
+    {
+        PG_FAILSTR("Invalid BVH object handle %d", object);
+        return -1;
+    }
+    return mObjects[object].mUserData;
+}
+
+//----------------------------------------------------------------------------------------
+
+void BoundingVolumeHierarchy::Update()
+{
+    if (mNeedsBuild)
+    {
+        Build();
+    }
+    else if (mRefitLeafCount > 0)
+    {
+        Refit();
+        if (GetCost() > REBUILD_COST_RATIO * mBuildCost)
+        {
+            Build();
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void BoundingVolumeHierarchy::Build()
+{
+    mNeedsBuild = false;
+    mRefitLeafCount = 0;
+    mNodeCount = 0;
+    mCostSum = 0.0;
+    mBuildCost = 0.0f;
+    if (mObjectCount == 0)
+    {
+        return;
+    }
+
+    // A tree of n objects has at most 2n - 1 nodes, with one object per leaf
+    GrowArray(mAllocator, mLeafObjects, mLeafObjectCapacity, mObjectCount, 0);
+    GrowArray(mAllocator, mBuildObjects, mBuildObjectCapacity, mObjectCount, 0);
+    if (2 * mObjectCount - 1 > mNodeCapacity)
+    {
+        int refitCapacity = mNodeCapacity;
+        GrowArray(mAllocator, mNodes, mNodeCapacity, 2 * mObjectCount - 1, 0);
+        GrowArray(mAllocator, mRefitLeaves, refitCapacity, mNodeCapacity, 0);
+    }
+
+    // The boxes are copied next to each other, and partitioned in place from node to node
+    int buildObjectCount = 0;
+    for (int o = 0; o < mObjectSlotCount; ++o)
+    {
+        const Object & object = mObjects[o];
+        if (object.mLeaf != REMOVED_OBJECT)
+        {
+            BuildObject & buildObject = mBuildObjects[buildObjectCount++];
+            for (int c = 0; c < 3; ++c)
+            {
+                buildObject.mMin[c] = object.mMin[c];
+                buildObject.mMax[c] = object.mMax[c];
+            }
+            buildObject.mObject = o;
+        }
+    }
+    PG_ASSERT(buildObjectCount == mObjectCount);
+
+    Node & root = mNodes[mNodeCount++];
+    root.mParent = -1;
+    root.mFirstObject = 0;
+    root.mObjectCount = mObjectCount;
+
+    BuildTask stack[NODE_STACK_SIZE];
+    int stackSize = 0;
+    stack[stackSize].mNode = 0;
+    stack[stackSize].mDepth = 0;
+    ++stackSize;
+
+    while (stackSize > 0)
+    {
+        const BuildTask task = stack[--stackSize];
+        Node & node = mNodes[task.mNode];
+        node.mRefitQueued = false;
+        BuildObject * objects = mBuildObjects + node.mFirstObject;
+        const int count = node.mObjectCount;
+
+        // Box of the node, and box of the object centers (times 2, as min + max)
+        PFloat32 centerMin[3];
+        PFloat32 centerMax[3];
+        SetEmptyBox(node.mMin, node.mMax);
+        SetEmptyBox(centerMin, centerMax);
+        for (int i = 0; i < count; ++i)
+        {
+            AddBox(node.mMin, node.mMax, objects[i].mMin, objects[i].mMax);
+            for (int c = 0; c < 3; ++c)
+            {
+                const PFloat32 center = objects[i].mMin[c] + objects[i].mMax[c];
+                centerMin[c] = center < centerMin[c] ? center : centerMin[c];
+                centerMax[c] = center > centerMax[c] ? center : centerMax[c];
+            }
+        }
+
+        // Binned SAH split, the 3 axes binned in one pass. The cost of a split relative to the cost of a leaf is
+        // TRAVERSAL_COST + (area(left) * count(left) + area(right) * count(right)) / area(node)
+        const PFloat32 nodeArea = GetHalfArea(node.mMin, node.mMax);
+        PFloat32 bestCost = count <= MAX_LEAF_OBJECT_COUNT ? static_cast<PFloat32>(count) : PFLOAT_MAX;
+        int bestAxis = -1;
+        int bestBin = 0;
+        PFloat32 binScales[3];
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            const PFloat32 extent = centerMax[axis] - centerMin[axis];
+            binScales[axis] = extent > 0.0f ? static_cast<PFloat32>(SAH_BIN_COUNT) / extent : 0.0f;
+        }
+
+        if (task.mDepth < MAX_SAH_DEPTH && count > 1 && nodeArea > 0.0f)
+        {
+            SahBin bins[3][SAH_BIN_COUNT];
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                for (int b = 0; b < SAH_BIN_COUNT; ++b)
+                {
+                    SetEmptyBox(bins[axis][b].mMin, bins[axis][b].mMax);
+                    bins[axis][b].mCount = 0;
+                }
+            }
+
+            for (int i = 0; i < count; ++i)
+            {
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    int b = static_cast<int>((objects[i].mMin[axis] + objects[i].mMax[axis] - centerMin[axis]) * binScales[axis]);
+                    b = b < SAH_BIN_COUNT ? b : SAH_BIN_COUNT - 1;
+                    AddBox(bins[axis][b].mMin, bins[axis][b].mMax, objects[i].mMin, objects[i].mMax);
+                    ++bins[axis][b].mCount;
+                }
+            }
+
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                // All the centers in the same bin, no split
+                if (binScales[axis] == 0.0f)
+                {
+                    continue;
+                }
+
+                // Costs of the right sides, then sweep of the left sides
+                PFloat32 rightCosts[SAH_BIN_COUNT];
+                PFloat32 sideMin[3];
+                PFloat32 sideMax[3];
+                SetEmptyBox(sideMin, sideMax);
+                int sideCount = 0;
+                for (int b = SAH_BIN_COUNT - 1; b > 0; --b)
+                {
+                    AddBox(sideMin, sideMax, bins[axis][b].mMin, bins[axis][b].mMax);
+                    sideCount += bins[axis][b].mCount;
+                    rightCosts[b] = sideCount > 0 ? GetHalfArea(sideMin, sideMax) * static_cast<PFloat32>(sideCount) : 0.0f;
+                }
+
+                SetEmptyBox(sideMin, sideMax);
+                sideCount = 0;
+                for (int b = 0; b < SAH_BIN_COUNT - 1; ++b)
+                {
+                    AddBox(sideMin, sideMax, bins[axis][b].mMin, bins[axis][b].mMax);
+                    sideCount += bins[axis][b].mCount;
+                    if (sideCount == 0 || sideCount == count)
+                    {
+                        continue;
+                    }
+
+                    const PFloat32 cost = TRAVERSAL_COST
+                                        + (GetHalfArea(sideMin, sideMax) * static_cast<PFloat32>(sideCount) + rightCosts[b + 1]) / nodeArea;
+                    if (cost < bestCost)
+                    {
+                        bestCost = cost;
+                        bestAxis = axis;
+                        bestBin = b;
+                    }
+                }
+            }
+        }
+
+        int leftCount = 0;
+        if (bestAxis != -1)
+        {
+            // Partition the objects of the bins up to bestBin to the left
+            int right = count;
+            while (leftCount < right)
+            {
+                int b = static_cast<int>((objects[leftCount].mMin[bestAxis] + objects[leftCount].mMax[bestAxis] - centerMin[bestAxis]) * binScales[bestAxis]);
+                b = b < SAH_BIN_COUNT ? b : SAH_BIN_COUNT - 1;
+                if (b <= bestBin)
+                {
+                    ++leftCount;
+                }
+                else
+                {
+                    --right;
+                    const BuildObject swapped = objects[leftCount];
+                    objects[leftCount] = objects[right];
+                    objects[right] = swapped;
+                }
+            }
+        }
+        else if (count > MAX_LEAF_OBJECT_COUNT)
+        {
+            // Too many objects for a leaf and no SAH split (same centers, or a tree too deep)
+            leftCount = count / 2;
+        }
+
+        if (leftCount == 0)
+        {
+            node.mLeft = -1;
+            for (int i = 0; i < count; ++i)
+            {
+                mLeafObjects[node.mFirstObject + i] = objects[i].mObject;
+                mObjects[objects[i].mObject].mLeaf = task.mNode;
+            }
+            mCostSum += static_cast<PFloat64>(nodeArea) * count;
+        }
+        else
+        {
+            PG_ASSERT(mNodeCount + 2 <= mNodeCapacity);
+            PG_ASSERTSTR(stackSize + 2 <= NODE_STACK_SIZE, "The BVH is too deep");
+            const int left = mNodeCount;
+            mNodeCount += 2;
+            node.mLeft = left;
+            mCostSum += static_cast<PFloat64>(nodeArea * TRAVERSAL_COST);
+
+            Node & leftNode = mNodes[left];
+            leftNode.mParent = task.mNode;
+            leftNode.mFirstObject = node.mFirstObject;
+            leftNode.mObjectCount = leftCount;
+
+            Node & rightNode = mNodes[left + 1];
+            rightNode.mParent = task.mNode;
+            rightNode.mFirstObject = node.mFirstObject + leftCount;
+            rightNode.mObjectCount = count - leftCount;
+
+            stack[stackSize].mNode = left + 1;
+            stack[stackSize].mDepth = task.mDepth + 1;
+            ++stackSize;
+            stack[stackSize].mNode = left;
+            stack[stackSize].mDepth = task.mDepth + 1;
+            ++stackSize;
+        }
+    }
+
+    mBuildCost = GetCost();
+}
+
+//----------------------------------------------------------------------------------------
+
+void BoundingVolumeHierarchy::Refit()
+{
+    if (mNeedsBuild)
+    {
+        PG_LOG('ERR_', "Objects were added or removed, the BVH must be built instead of refitted");
+        return;
+    }
+
+    // Walk up from each moved leaf while the boxes change. The nodes above an unchanged
+    // box already contain the boxes of all their children.
+    for (int l = 0; l < mRefitLeafCount; ++l)
+    {
+        int nodeIndex = mRefitLeaves[l];
+        mNodes[nodeIndex].mRefitQueued = false;
+        while (nodeIndex != -1 && RefitNode(nodeIndex))
+        {
+            nodeIndex = mNodes[nodeIndex].mParent;
+        }
+    }
+    mRefitLeafCount = 0;
+}
+
+//----------------------------------------------------------------------------------------
+
+PFloat32 BoundingVolumeHierarchy::GetCost() const
+{
+    if (mNodeCount == 0)
+    {
+        return 0.0f;
+    }
+    const PFloat32 rootArea = GetHalfArea(mNodes[0].mMin, mNodes[0].mMax);
+    return rootArea > 0.0f ? static_cast<PFloat32>(mCostSum / rootArea) : static_cast<PFloat32>(mNodeCount);
+}
+
+//----------------------------------------------------------------------------------------
+
+int BoundingVolumeHierarchy::QueryFrustum(int * results, int maxResults, const Plane * planes, int planeCount) const
+{
+    PG_ASSERTSTR(IsUpToDate(), "The BVH must be updated before the queries");
+    PG_ASSERTSTR(planeCount <= MAX_QUERY_PLANE_COUNT, "Too many planes for a BVH query (%d), the maximum is %d", planeCount, MAX_QUERY_PLANE_COUNT);
+    planeCount = planeCount < MAX_QUERY_PLANE_COUNT ? planeCount : MAX_QUERY_PLANE_COUNT;
+
+    int resultCount = 0;
+    if (mNodeCount == 0)
+    {
+        return 0;
+    }
+
+    // Each entry holds the planes its parent intersects, the planes a node is in the back of
+    // being skipped for the whole subtree
+    struct StackEntry
+    {
+        int mNode;
+        PUInt32 mPlaneMask;
+    };
+    StackEntry stack[NODE_STACK_SIZE];
+    int stackSize = 0;
+    stack[stackSize].mNode = 0;
+    stack[stackSize].mPlaneMask = planeCount < 32 ? (1ul << planeCount) - 1 : 0xFFFFFFFFul;
+    ++stackSize;
+
+    while (stackSize > 0)
+    {
+        const StackEntry entry = stack[--stackSize];
+        const Node & node = mNodes[entry.mNode];
+        PUInt32 planeMask = entry.mPlaneMask;
+        if (!CullBox(planeMask, node.mMin, node.mMax, planes, planeCount))
+        {
+            continue;
+        }
+
+        if (planeMask == 0)
+        {
+            // Inside all the planes, so are all the objects of the subtree
+            for (int i = 0; i < node.mObjectCount; ++i)
+            {
+                AddResult(results, maxResults, resultCount, mObjects[mLeafObjects[node.mFirstObject + i]].mUserData);
+            }
+        }
+        else if (node.mLeft == -1)
+        {
+            for (int i = 0; i < node.mObjectCount; ++i)
+            {
+                const Object & object = mObjects[mLeafObjects[node.mFirstObject + i]];
+                PUInt32 objectPlaneMask = planeMask;
+                if (CullBox(objectPlaneMask, object.mMin, object.mMax, planes, planeCount))
+                {
+                    AddResult(results, maxResults, resultCount, object.mUserData);
+                }
+            }
+        }
+        else
+        {
+            stack[stackSize].mNode = node.mLeft + 1;
+            stack[stackSize].mPlaneMask = planeMask;
+            ++stackSize;
+            stack[stackSize].mNode = node.mLeft;
+            stack[stackSize].mPlaneMask = planeMask;
+            ++stackSize;
+        }
+    }
+
+    return resultCount;
+}
+
+//----------------------------------------------------------------------------------------
+
+int BoundingVolumeHierarchy::QueryOverlap(int * results, int maxResults, const AxisAlignedBoundingBox & box) const
+{
+    PG_ASSERTSTR(IsUpToDate(), "The BVH must be updated before the queries");
+
+    int resultCount = 0;
+    if (mNodeCount == 0)
+    {
+        return 0;
+    }
+
+    const PFloat32 * boxMin = box.GetMin().v;
+    const PFloat32 * boxMax = box.GetMax().v;
+    int stack[NODE_STACK_SIZE];
+    int stackSize = 0;
+    stack[stackSize++] = 0;
+
+    while (stackSize > 0)
+    {
+        const Node & node = mNodes[stack[--stackSize]];
+        if (!AreOverlapping(node.mMin, node.mMax, boxMin, boxMax))
+        {
+            continue;
+        }
+
+        if (IsBoxInside(node.mMin, node.mMax, boxMin, boxMax))
+        {
+            for (int i = 0; i < node.mObjectCount; ++i)
+            {
+                AddResult(results, maxResults, resultCount, mObjects[mLeafObjects[node.mFirstObject + i]].mUserData);
+            }
+        }
+        else if (node.mLeft == -1)
+        {
+            for (int i = 0; i < node.mObjectCount; ++i)
+            {
+                const Object & object = mObjects[mLeafObjects[node.mFirstObject + i]];
+                if (AreOverlapping(object.mMin, object.mMax, boxMin, boxMax))
+                {
+                    AddResult(results, maxResults, resultCount, object.mUserData);
+                }
+            }
+        }
+        else
+        {
+            stack[stackSize++] = node.mLeft + 1;
+            stack[stackSize++] = node.mLeft;
+        }
+    }
+
+    return resultCount;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool BoundingVolumeHierarchy::QueryRay(int & userData, PFloat32 & distance, RayIn ray, PFloat32 maxDistance) const
+{
+    PG_ASSERTSTR(IsUpToDate(), "The BVH must be updated before the queries");
+
+    if (mNodeCount == 0)
+    {
+        return false;
+    }
+
+    const PFloat32 * origin = ray.GetOrigin().v;
+    PFloat32 invDirection[3];
+    for (int c = 0; c < 3; ++c)
+    {
+        invDirection[c] = 1.0f / ray.GetDirection().v[c];
+    }
+
+    bool hit = false;
+    PFloat32 closest = maxDistance;
+    PFloat32 entry;
+    if (!IntersectRayBox(entry, origin, invDirection, mNodes[0].mMin, mNodes[0].mMax, closest))
+    {
+        return false;
+    }
+
+    // Front to back traversal, the nearest child on top of the stack, and the nodes
+    // entered after the closest hit skipped
+    struct StackEntry
+    {
+        int mNode;
+        PFloat32 mEntry;
+    };
+    StackEntry stack[NODE_STACK_SIZE];
+    int stackSize = 0;
+    stack[stackSize].mNode = 0;
+    stack[stackSize].mEntry = entry;
+    ++stackSize;
+
+    while (stackSize > 0)
+    {
+        const StackEntry current = stack[--stackSize];
+        if (current.mEntry > closest)
+        {
+            continue;
+        }
+
+        const Node & node = mNodes[current.mNode];
+        if (node.mLeft == -1)
+        {
+            for (int i = 0; i < node.mObjectCount; ++i)
+            {
+                const Object & object = mObjects[mLeafObjects[node.mFirstObject + i]];
+                if (IntersectRayBox(entry, origin, invDirection, object.mMin, object.mMax, closest)
+                    && (!hit || entry < closest))
+                {
+                    hit = true;
+                    closest = entry;
+                    userData = object.mUserData;
+                }
+            }
+        }
+        else
+        {
+            PFloat32 leftEntry;
+            PFloat32 rightEntry;
+            const bool leftHit = IntersectRayBox(leftEntry, origin, invDirection, mNodes[node.mLeft].mMin, mNodes[node.mLeft].mMax, closest);
+            const bool rightHit = IntersectRayBox(rightEntry, origin, invDirection, mNodes[node.mLeft + 1].mMin, mNodes[node.mLeft + 1].mMax, closest);
+            const bool leftFirst = !rightHit || (leftHit && leftEntry <= rightEntry);
+            if (leftFirst ? rightHit : leftHit)
+            {
+                stack[stackSize].mNode = leftFirst ? node.mLeft + 1 : node.mLeft;
+                stack[stackSize].mEntry = leftFirst ? rightEntry : leftEntry;
+                ++stackSize;
+            }
+            if (leftFirst ? leftHit : rightHit)
+            {
+                stack[stackSize].mNode = leftFirst ? node.mLeft : node.mLeft + 1;
+                stack[stackSize].mEntry = leftFirst ? leftEntry : rightEntry;
+                ++stackSize;
+            }
+        }
+    }
+
+    if (hit)
+    {
+        distance = closest;
+    }
+    return hit;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool BoundingVolumeHierarchy::RefitNode(int nodeIndex)
+{
+    Node & node = mNodes[nodeIndex];
+    PFloat32 boxMin[3];
+    PFloat32 boxMax[3];
+    SetEmptyBox(boxMin, boxMax);
+    if (node.mLeft == -1)
+    {
+        for (int i = 0; i < node.mObjectCount; ++i)
+        {
+            const Object & object = mObjects[mLeafObjects[node.mFirstObject + i]];
+            AddBox(boxMin, boxMax, object.mMin, object.mMax);
+        }
+    }
+    else
+    {
+        AddBox(boxMin, boxMax, mNodes[node.mLeft].mMin, mNodes[node.mLeft].mMax);
+        AddBox(boxMin, boxMax, mNodes[node.mLeft + 1].mMin, mNodes[node.mLeft + 1].mMax);
+    }
+
+    bool changed = false;
+    for (int c = 0; c < 3; ++c)
+    {
+        changed = changed || boxMin[c] != node.mMin[c] || boxMax[c] != node.mMax[c];
+    }
+    if (changed)
+    {
+        const PFloat32 weight = GetNodeCostWeight(node);
+        mCostSum += static_cast<PFloat64>((GetHalfArea(boxMin, boxMax) - GetHalfArea(node.mMin, node.mMax)) * weight);
+        for (int c = 0; c < 3; ++c)
+        {
+            node.mMin[c] = boxMin[c];
+            node.mMax[c] = boxMax[c];
+        }
+    }
+    return changed;
+}
+
+//----------------------------------------------------------------------------------------
+
+PFloat32 BoundingVolumeHierarchy::GetNodeCostWeight(const Node & node) const
+{
+    return node.mLeft == -1 ? static_cast<PFloat32>(node.mObjectCount) : TRAVERSAL_COST;
+}
+
+
+}   // namespace Math
+}   // namespace Pegasus
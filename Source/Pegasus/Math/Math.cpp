@@ -13,9 +13,6 @@
 
 // Includes specific to the IA32 architecture
 #if PEGASUS_ARCH_IA32 && !PEGASUS_MATH_FORCE_GENERIC
-#    ifdef _USE_INTEL_COMPILER
-#        include "Pegasus/Math/MatrixSSE.h"
-#    endif
 #    include "Pegasus/Math/MatrixFPU.h"
 #endif
 
@@ -25,26 +22,13 @@ namespace Math {
 
 void InitMathLibrary()
 {
-    // The initialization of the math library is only for the IA32 architecture
+    // The initialization of the math library is only for the IA32 architecture,
+    // the SIMD versions of the operations are selected at compile time (MatrixSimd.h)
 #if PEGASUS_ARCH_IA32 && !PEGASUS_MATH_FORCE_GENERIC
-    
-#ifdef _USE_INTEL_COMPILER
-    if (Engine::IsSSESupported())
-    {
-        // SSE functions
-        /*Mult22_21 = Mult22_21SSE;    Mult33_31 = Mult33_31SSE;    */Mult44_41 = Mult44_41SSE;
-        /*Mult22T_21 = Mult22T_21SSE;    Mult33T_31 = Mult33T_31SSE;    */Mult44T_41 = Mult44T_41SSE;
-    }
-    else
-    {
-#endif
-        // FPU functions
-        /*Mult22_21 = Mult22_21FPU;    Mult33_31 = Mult33_31FPU;    */Mult44_41 = Mult44_41FPU;
-        /*Mult22T_21 = Mult22T_21FPU;    Mult33T_31 = Mult33T_31FPU;    */Mult44T_41 = Mult44T_41FPU;
 
-#ifdef _USE_INTEL_COMPILER
-    }
-#endif
+    // FPU functions
+    /*Mult22_21 = Mult22_21FPU;    Mult33_31 = Mult33_31FPU;    */Mult44_41 = Mult44_41FPU;
+    /*Mult22T_21 = Mult22T_21FPU;    Mult33T_31 = Mult33T_31FPU;    */Mult44T_41 = Mult44T_41FPU;
 
 #endif    // PEGASUS_ARCH_IA32 && !PEGASUS_MATH_FORCE_GENERIC
 }
@@ -237,7 +237,7 @@ void Mult33_31(Vec3InOut dst, Mat33In mat, Vec3In vec)
 }
 
 /*************/
-#if !PEGASUS_ARCH_IA32 || PEGASUS_MATH_FORCE_GENERIC
+#if (!PEGASUS_ARCH_IA32 || PEGASUS_MATH_FORCE_GENERIC) && !PEGASUS_MATH_MATRIX_SIMD
 /*************/
 
 void Mult44_41(Vec4InOut dst, Mat44In mat, Vec4In vec)
@@ -277,6 +277,8 @@ void Mult33T_31(Vec3InOut dst, Mat33In mat, Vec3In vec)
 #if !PEGASUS_ARCH_IA32 || PEGASUS_MATH_FORCE_GENERIC
 /****************/
 
+#if !PEGASUS_MATH_MATRIX_SIMD
+
 void Mult44T_41(Vec4InOut dst, Mat44In mat, Vec4In vec)
 {
     const PFloat32 t0 =  mat.m11 * vec.x + mat.m21 * vec.y + mat.m31 * vec.z + mat.m41 * vec.w;
@@ -288,6 +290,8 @@ void Mult44T_41(Vec4InOut dst, Mat44In mat, Vec4In vec)
     dst.z             = t2;
 }
 
+#endif    // !PEGASUS_MATH_MATRIX_SIMD
+
 //----------------------------------------------------------------------------------------
 
 void Mult22_22(Mat22InOut dst, Mat22In mat1, Mat22In mat2)
@@ -324,6 +328,8 @@ void Mult33_33(Mat33InOut dst, Mat33In mat1, Mat33In mat2)
     dst.m11            = t11;
 }
 
+#if !PEGASUS_MATH_MATRIX_SIMD
+
 void Mult44_44(Mat44InOut dst, Mat44In mat1, Mat44In mat2)
 {
     const PFloat32 t11 =  mat1.m11 * mat2.m11 + mat1.m12 * mat2.m21 + mat1.m13 * mat2.m31 + mat1.m14 * mat2.m41;
@@ -365,6 +371,8 @@ void Mult44_44(Mat44InOut dst, Mat44In mat1, Mat44In mat2)
     dst.m11            = t11;
 }
 
+#endif    // !PEGASUS_MATH_MATRIX_SIMD
+
 /****************/
 #endif    // !PEGASUS_ARCH_IA32 || PEGASUS_MATH_FORCE_GENERIC
 /****************/
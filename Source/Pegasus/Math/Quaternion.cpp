@@ -11,6 +11,7 @@
 
 #include "Pegasus/Math/Quaternion.h"
 #include "Pegasus/Math/Constants.h"
+#include "Pegasus/Math/Simd.h"
 
 namespace Pegasus {
 namespace Math {
@@ -389,8 +390,36 @@ void Mat44TToQuaternion(QuaternionInOut quat, Mat44In mat)
 
 //----------------------------------------------------------------------------------------
 
+#if PEGASUS_MATH_SIMD_SSE
+
+//! Normalized product of two quaternions (SIMD version), lanes in the (w, x, y, z) order
+//! \param dst The resulting quaternion (= quat1 * quat2), can be quat1 or quat2
+//! \param quat1 The first quaternion of the product
+//! \param quat2 The second quaternion of the product
+static inline void MultNormalizeSimd(QuaternionInOut dst, QuaternionIn quat1, QuaternionIn quat2)
+{
+    const SimdFloat4 a = SimdLoadU(quat1.q);
+    const SimdFloat4 b = SimdLoadU(quat2.q);
+
+    // One term per component of quat1, the signs of the Hamilton product as constants
+    SimdFloat4 res = SimdMul(SimdSwizzle<0, 0, 0, 0>(a), b);
+    res = SimdMulAdd(SimdSwizzle<1, 1, 1, 1>(a), SimdMul(SimdSwizzle<1, 0, 3, 2>(b), SimdSet(-1.0f,  1.0f, -1.0f,  1.0f)), res);
+    res = SimdMulAdd(SimdSwizzle<2, 2, 2, 2>(a), SimdMul(SimdSwizzle<2, 3, 0, 1>(b), SimdSet(-1.0f,  1.0f,  1.0f, -1.0f)), res);
+    res = SimdMulAdd(SimdSwizzle<3, 3, 3, 3>(a), SimdMul(SimdSwizzle<3, 2, 1, 0>(b), SimdSet(-1.0f, -1.0f,  1.0f,  1.0f)), res);
+
+    const SimdFloat4 rcpNorm = SimdDiv(SimdSet1(1.0f), SimdSqrt(SimdDot4(res, res)));
+    SimdStoreU(dst.q, SimdMul(res, rcpNorm));
+}
+
+#endif    // PEGASUS_MATH_SIMD_SSE
+
+//----------------------------------------------------------------------------------------
+
 void LeftMult(QuaternionInOut quat1, QuaternionIn quat2)
 {
+#if PEGASUS_MATH_SIMD_SSE
+    MultNormalizeSimd(quat1, quat2, quat1);
+#else
     const PFloat32 w = quat2.w * quat1.w - quat2.x * quat1.x - quat2.y * quat1.y - quat2.z * quat1.z;
     const PFloat32 x = quat2.w * quat1.x + quat2.x * quat1.w + quat2.y * quat1.z - quat2.z * quat1.y;
     const PFloat32 y = quat2.w * quat1.y - quat2.x * quat1.z + quat2.y * quat1.w + quat2.z * quat1.x;
@@ -399,12 +428,16 @@ void LeftMult(QuaternionInOut quat1, QuaternionIn quat2)
     quat1.x          = x;
     quat1.y          = y;
     Normalize(quat1);
+#endif
 }
 
 //----------------------------------------------------------------------------------------
 
 void RightMult(QuaternionInOut quat1, QuaternionIn quat2)
 {
+#if PEGASUS_MATH_SIMD_SSE
+    MultNormalizeSimd(quat1, quat1, quat2);
+#else
     const PFloat32 w = quat1.w * quat2.w - quat1.x * quat2.x - quat1.y * quat2.y - quat1.z * quat2.z;
     const PFloat32 x = quat1.w * quat2.x + quat1.x * quat2.w + quat1.y * quat2.z - quat1.z * quat2.y;
     const PFloat32 y = quat1.w * quat2.y - quat1.x * quat2.z + quat1.y * quat2.w + quat1.z * quat2.x;
@@ -413,6 +446,7 @@ void RightMult(QuaternionInOut quat1, QuaternionIn quat2)
     quat1.x          = x;
     quat1.y          = y;
     Normalize(quat1);
+#endif
 }
 
 //----------------------------------------------------------------------------------------
@@ -21,6 +21,9 @@ MeshData::MeshData(const MeshConfiguration & configuration, Graph::Node::Mode mo
     mConfiguration(configuration),
     mIndexCount(0),
     mVertexCount(0),
+    mLodCount(0),
+    mInterleavedValid(true),
+    mSoaValid(true),
     mMode(mode)
 {
     
@@ -34,6 +37,13 @@ MeshData::MeshData(const MeshConfiguration & configuration, Graph::Node::Mode mo
         mVertexStreams[desc.mStreamIndex].SetStride(prevStride + size);
     }
 
+    //structure of arrays planes are made of 4 byte components
+    for (int s = 0; s < MESH_MAX_STREAMS; ++s)
+    {
+        PG_ASSERTSTR((mVertexStreams[s].GetStride() & 3) == 0, "Vertex streams must be made of 4 byte components");
+        mSoaStreams[s].SetStride(mVertexStreams[s].GetStride());
+    }
+
     mIndexBuffer.SetStride(sizeof(unsigned short));
 
 }
@@ -80,15 +90,116 @@ void MeshData::AllocateIndexes(int count)
 
 void MeshData::InternalAllocateVertexes(int count, bool preserveElements)
 {
-    mVertexCount = count;
-    
     if (mMode == Graph::Node::STANDARD)
     {
+        if (preserveElements)
+        {
+            //the interleaved streams carry the preserved elements
+            EnsureInterleavedStreams();
+            mSoaValid = false;
+        }
+        else
+        {
+            //contents are undefined in both layouts, so nothing to convert
+            mInterleavedValid = true;
+            mSoaValid = true;
+        }
+
         for (int stream = 0; stream < MESH_MAX_STREAMS; ++stream)
         {
             mVertexStreams[stream].Grow(GetAllocator(), count, preserveElements);        
         }
     }
+
+    mVertexCount = count;
+}
+
+float * MeshData::GetSoaStream(int streamId)
+{
+    EnsureSoaStreams();
+    mInterleavedValid = false;
+    return reinterpret_cast<float*>(mSoaStreams[streamId].GetBuffer());
+}
+
+const float * MeshData::GetConstSoaStream(int streamId)
+{
+    EnsureSoaStreams();
+    return reinterpret_cast<const float*>(mSoaStreams[streamId].GetBuffer());
+}
+
+void MeshData::EnsureInterleavedStreams()
+{
+    if (mInterleavedValid)
+    {
+        return;
+    }
+
+    PG_ASSERT(mSoaValid);
+    const int pitch = GetSoaPitch();
+    for (int stream = 0; stream < MESH_MAX_STREAMS; ++stream)
+    {
+        const int components = mVertexStreams[stream].GetStride() / sizeof(float);
+        if (components > 0)
+        {
+            float* dst = reinterpret_cast<float*>(mVertexStreams[stream].GetBuffer());
+            const float* src = reinterpret_cast<const float*>(mSoaStreams[stream].GetBuffer());
+            for (int c = 0; c < components; ++c)
+            {
+                const float* plane = src + c * pitch;
+                for (int v = 0; v < mVertexCount; ++v)
+                {
+                    dst[v * components + c] = plane[v];
+                }
+            }
+        }
+    }
+    mInterleavedValid = true;
+}
+
+void MeshData::EnsureSoaStreams()
+{
+    PG_ASSERTSTR(mMode == Graph::Node::STANDARD, "Function only available in mesh STANDARD mode.");
+    const int pitch = GetSoaPitch();
+    for (int stream = 0; stream < MESH_MAX_STREAMS; ++stream)
+    {
+        if (mSoaStreams[stream].GetStride() > 0 && mSoaStreams[stream].GetByteSize() < pitch * mSoaStreams[stream].GetStride())
+        {
+            //the planes are rebuilt from scratch below, no need to preserve
+            mSoaStreams[stream].Grow(GetAllocator(), pitch, false);
+            mSoaValid = false;
+        }
+    }
+
+    if (mSoaValid)
+    {
+        return;
+    }
+
+    PG_ASSERT(mInterleavedValid);
+    for (int stream = 0; stream < MESH_MAX_STREAMS; ++stream)
+    {
+        const int components = mVertexStreams[stream].GetStride() / sizeof(float);
+        if (components > 0)
+        {
+            const float* src = reinterpret_cast<const float*>(mVertexStreams[stream].GetBuffer());
+            float* dst = reinterpret_cast<float*>(mSoaStreams[stream].GetBuffer());
+            for (int c = 0; c < components; ++c)
+            {
+                float* plane = dst + c * pitch;
+                for (int v = 0; v < mVertexCount; ++v)
+                {
+                    plane[v] = src[v * components + c];
+                }
+
+                //padding lanes are kept at 0 so full width kernels never read garbage
+                for (int v = mVertexCount; v < pitch; ++v)
+                {
+                    plane[v] = 0.0f;
+                }
+            }
+        }
+    }
+    mSoaValid = true;
 }
 
 void MeshData::InternalAllocateIndexes(int count, bool preserveElements)
@@ -103,6 +214,23 @@ void MeshData::InternalAllocateIndexes(int count, bool preserveElements)
     }
 }
 
+void MeshData::SetLodCount(int count)
+{
+    PG_ASSERTSTR(count >= 0 && count <= MESH_MAX_LODS, "Invalid level of detail count.");
+    mLodCount = count;
+}
+
+int MeshData::SelectLod(float screenSize) const
+{
+    //levels get coarser and usable on smaller screen sizes
+    int lod = 0;
+    while (lod + 1 < mLodCount && screenSize <= mLods[lod + 1].mMaxScreenSize)
+    {
+        ++lod;
+    }
+    return lod;
+}
+
 void MeshData::Clear()
 {
     for (int s = 0; s < MESH_MAX_STREAMS; ++s)
@@ -111,6 +239,11 @@ void MeshData::Clear()
         {
             mVertexStreams[s].Destroy(GetAllocator());
         }
+
+        if (mSoaStreams[s].GetBuffer() != nullptr)
+        {
+            mSoaStreams[s].Destroy(GetAllocator());
+        }
     }
     
     if (mIndexBuffer.GetBuffer() != nullptr)
@@ -120,6 +253,9 @@ void MeshData::Clear()
     
     mVertexCount = 0;
     mIndexCount = 0;
+    mLodCount = 0;
+    mInterleavedValid = true;
+    mSoaValid = true;
 }
 
 MeshData::~MeshData()
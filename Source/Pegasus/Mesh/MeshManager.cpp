@@ -14,6 +14,8 @@
 #include "Pegasus/Mesh/Operator/CombineTransformOperator.h"
 #include "Pegasus/Mesh/Operator/MultiCopyOperator.h"
 #include "Pegasus/Mesh/Operator/WaveFieldOperator.h"
+#include "Pegasus/Mesh/Operator/OptimizeOperator.h"
+#include "Pegasus/Mesh/Operator/LodOperator.h"
 #include "Pegasus/Mesh/Generator/QuadGenerator.h"
 #include "Pegasus/Mesh/Generator/BoxGenerator.h"
 #include "Pegasus/Mesh/Generator/IcosphereGenerator.h"
@@ -213,6 +215,8 @@ void MeshManager::RegisterAllMeshNodes()
     REGISTER_MESH_NODE_OPERATOR(CombineTransformOperator);
     REGISTER_MESH_NODE_OPERATOR(MultiCopyOperator);
     REGISTER_MESH_NODE_OPERATOR(WaveFieldOperator);
+    REGISTER_MESH_NODE_OPERATOR(OptimizeOperator);
+    REGISTER_MESH_NODE_OPERATOR(LodOperator);
 
     // Register the generator nodes
     REGISTER_MESH_NODE_GENERATOR(QuadGenerator);
@@ -0,0 +1,335 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MeshOptimizer.cpp
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Index and vertex buffer optimizations for indexed triangle list meshes
+
+#include "Pegasus/Mesh/MeshOptimizer.h"
+#include "Pegasus/Mesh/MeshData.h"
+#include "Pegasus/Utils/Memset.h"
+#include <math.h>
+
+namespace Pegasus {
+namespace Mesh {
+
+namespace
+{
+
+//! Spatial hash of a position cell
+inline unsigned int HashCell(int x, int y, int z)
+{
+    return (static_cast<unsigned int>(x) * 73856093u) ^ (static_cast<unsigned int>(y) * 19349663u) ^ (static_cast<unsigned int>(z) * 83492791u);
+}
+
+//! \return true if a and b are no more than tolerance apart on every axis
+inline bool IsNear(const float* a, const float* b, int count, float tolerance)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        const float d = a[i] - b[i];
+        if (d > tolerance || d < -tolerance)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//! \return true if two vertices have to be welded
+inline bool IsSameVertex(const StdVertex& a, const StdVertex& b, float posTolerance, float normalTolerance, float uvTolerance)
+{
+    return IsNear(a.position.v, b.position.v, 4, posTolerance)
+        && IsNear(a.normal.v, b.normal.v, 3, normalTolerance)
+        && IsNear(a.uv.v, b.uv.v, 2, uvTolerance);
+}
+
+}
+
+//----------------------------------------------------------------------------------------
+
+int WeldStdVertices(const StdVertex* vertices, int vertexCount,
+                    float posTolerance, float normalTolerance, float uvTolerance,
+                    int* remap, Alloc::IAllocator* allocator)
+{
+    PG_ASSERTSTR(posTolerance > 0.0f, "The weld position tolerance has to be greater than 0");
+    if (vertexCount <= 0)
+    {
+        return 0;
+    }
+
+    //cells are as big as the tolerance, so a match is at most one cell away on each axis
+    const float invCellSize = 1.0f / posTolerance;
+    unsigned int bucketCount = 16;
+    while (bucketCount < static_cast<unsigned int>(vertexCount) * 2)
+    {
+        bucketCount <<= 1;
+    }
+    const unsigned int bucketMask = bucketCount - 1;
+
+    int* buckets = PG_NEW_ARRAY(allocator, -1, "WeldStdVertices::buckets", Alloc::PG_MEM_TEMP, int, bucketCount);
+    int* next = PG_NEW_ARRAY(allocator, -1, "WeldStdVertices::next", Alloc::PG_MEM_TEMP, int, vertexCount);
+    for (unsigned int b = 0; b < bucketCount; ++b)
+    {
+        buckets[b] = -1;
+    }
+
+    int uniqueCount = 0;
+    for (int v = 0; v < vertexCount; ++v)
+    {
+        const StdVertex& vertex = vertices[v];
+        const int cx = static_cast<int>(floorf(vertex.position.x * invCellSize));
+        const int cy = static_cast<int>(floorf(vertex.position.y * invCellSize));
+        const int cz = static_cast<int>(floorf(vertex.position.z * invCellSize));
+
+        int match = -1;
+        for (int dz = -1; dz <= 1 && match < 0; ++dz)
+        {
+            for (int dy = -1; dy <= 1 && match < 0; ++dy)
+            {
+                for (int dx = -1; dx <= 1 && match < 0; ++dx)
+                {
+                    const unsigned int bucket = HashCell(cx + dx, cy + dy, cz + dz) & bucketMask;
+                    for (int u = buckets[bucket]; u >= 0; u = next[u])
+                    {
+                        if (IsSameVertex(vertices[u], vertex, posTolerance, normalTolerance, uvTolerance))
+                        {
+                            match = u;
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+
+        if (match >= 0)
+        {
+            remap[v] = match;
+        }
+        else
+        {
+            const unsigned int bucket = HashCell(cx, cy, cz) & bucketMask;
+            next[v] = buckets[bucket];
+            buckets[bucket] = v;
+            remap[v] = v;
+            ++uniqueCount;
+        }
+    }
+
+    PG_DELETE_ARRAY(allocator, next);
+    PG_DELETE_ARRAY(allocator, buckets);
+    return uniqueCount;
+}
+
+//----------------------------------------------------------------------------------------
+
+int RemoveDegenerateTriangles(unsigned short* indices, int indexCount)
+{
+    PG_ASSERTSTR(indexCount % 3 == 0, "The index count of a triangle list has to be a multiple of 3");
+    int outCount = 0;
+    for (int i = 0; i < indexCount; i += 3)
+    {
+        const unsigned short a = indices[i];
+        const unsigned short b = indices[i + 1];
+        const unsigned short c = indices[i + 2];
+        if (a != b && b != c && a != c)
+        {
+            indices[outCount++] = a;
+            indices[outCount++] = b;
+            indices[outCount++] = c;
+        }
+    }
+    return outCount;
+}
+
+//----------------------------------------------------------------------------------------
+
+void OptimizeVertexCache(const unsigned short* indices, int indexCount, int vertexCount, int cacheSize,
+                         unsigned short* outIndices, Alloc::IAllocator* allocator)
+{
+    PG_ASSERTSTR(indexCount % 3 == 0, "The index count of a triangle list has to be a multiple of 3");
+    PG_ASSERTSTR(indices != outIndices, "OptimizeVertexCache cannot run in place");
+    if (indexCount == 0 || vertexCount <= 0)
+    {
+        return;
+    }
+
+    const int triangleCount = indexCount / 3;
+
+    //vertex to triangle adjacency, triangles of vertex v are adjacency[offsets[v] .. offsets[v + 1])
+    int* offsets = PG_NEW_ARRAY(allocator, -1, "OptimizeVertexCache::offsets", Alloc::PG_MEM_TEMP, int, vertexCount + 1);
+    int* adjacency = PG_NEW_ARRAY(allocator, -1, "OptimizeVertexCache::adjacency", Alloc::PG_MEM_TEMP, int, indexCount);
+    int* liveCount = PG_NEW_ARRAY(allocator, -1, "OptimizeVertexCache::liveCount", Alloc::PG_MEM_TEMP, int, vertexCount);
+    int* cacheTime = PG_NEW_ARRAY(allocator, -1, "OptimizeVertexCache::cacheTime", Alloc::PG_MEM_TEMP, int, vertexCount);
+    int* deadEnd = PG_NEW_ARRAY(allocator, -1, "OptimizeVertexCache::deadEnd", Alloc::PG_MEM_TEMP, int, indexCount);
+    unsigned char* emitted = PG_NEW_ARRAY(allocator, -1, "OptimizeVertexCache::emitted", Alloc::PG_MEM_TEMP, unsigned char, triangleCount);
+
+    Utils::Memset32(liveCount, 0, vertexCount * sizeof(int));
+    Utils::Memset32(cacheTime, 0, vertexCount * sizeof(int));
+    Utils::Memset8(emitted, 0, triangleCount);
+
+    for (int i = 0; i < indexCount; ++i)
+    {
+        PG_ASSERT(indices[i] < vertexCount);
+        ++liveCount[indices[i]];
+    }
+
+    offsets[0] = 0;
+    for (int v = 0; v < vertexCount; ++v)
+    {
+        offsets[v + 1] = offsets[v] + liveCount[v];
+    }
+
+    //use cacheTime as the insertion cursor while filling the adjacency
+    for (int i = 0; i < indexCount; ++i)
+    {
+        const int v = indices[i];
+        adjacency[offsets[v] + cacheTime[v]++] = i / 3;
+    }
+    Utils::Memset32(cacheTime, 0, vertexCount * sizeof(int));
+
+    int time = cacheSize + 1;
+    int deadEndTop = 0;
+    int cursor = 0;
+    int outCount = 0;
+    int fanning = 0;
+    while (fanning >= 0)
+    {
+        //emit every remaining triangle around the fanning vertex
+        const int fanStart = deadEndTop;
+        for (int a = offsets[fanning]; a < offsets[fanning + 1]; ++a)
+        {
+            const int t = adjacency[a];
+            if (emitted[t] != 0)
+            {
+                continue;
+            }
+
+            for (int k = 0; k < 3; ++k)
+            {
+                const int v = indices[t * 3 + k];
+                outIndices[outCount++] = static_cast<unsigned short>(v);
+                deadEnd[deadEndTop++] = v;
+                --liveCount[v];
+                if (time - cacheTime[v] > cacheSize)
+                {
+                    cacheTime[v] = time++;
+                }
+            }
+            emitted[t] = 1;
+        }
+
+        //pick the next fanning vertex among the ones just used: the oldest one still
+        //in the cache after its remaining triangles are emitted
+        int best = -1;
+        int bestPriority = -1;
+        for (int c = fanStart; c < deadEndTop; ++c)
+        {
+            const int v = deadEnd[c];
+            if (liveCount[v] > 0)
+            {
+                int priority = 0;
+                if (time - cacheTime[v] + 2 * liveCount[v] <= cacheSize)
+                {
+                    priority = time - cacheTime[v];
+                }
+
+                if (priority > bestPriority)
+                {
+                    bestPriority = priority;
+                    best = v;
+                }
+            }
+        }
+
+        //dead end, fall back to the most recent vertex still having triangles, then to the input order
+        while (best < 0 && deadEndTop > 0)
+        {
+            const int v = deadEnd[--deadEndTop];
+            if (liveCount[v] > 0)
+            {
+                best = v;
+            }
+        }
+
+        while (best < 0 && cursor < vertexCount)
+        {
+            if (liveCount[cursor] > 0)
+            {
+                best = cursor;
+            }
+            ++cursor;
+        }
+
+        fanning = best;
+    }
+
+    PG_ASSERT(outCount == indexCount);
+
+    PG_DELETE_ARRAY(allocator, emitted);
+    PG_DELETE_ARRAY(allocator, deadEnd);
+    PG_DELETE_ARRAY(allocator, cacheTime);
+    PG_DELETE_ARRAY(allocator, liveCount);
+    PG_DELETE_ARRAY(allocator, adjacency);
+    PG_DELETE_ARRAY(allocator, offsets);
+}
+
+//----------------------------------------------------------------------------------------
+
+int OptimizeVertexFetch(unsigned short* indices, int indexCount, int vertexCount, int* remap)
+{
+    for (int v = 0; v < vertexCount; ++v)
+    {
+        remap[v] = -1;
+    }
+
+    int nextVertex = 0;
+    for (int i = 0; i < indexCount; ++i)
+    {
+        const int v = indices[i];
+        PG_ASSERT(v < vertexCount);
+        if (remap[v] < 0)
+        {
+            remap[v] = nextVertex++;
+        }
+        indices[i] = static_cast<unsigned short>(remap[v]);
+    }
+
+    return nextVertex;
+}
+
+//----------------------------------------------------------------------------------------
+
+float ComputeAcmr(const unsigned short* indices, int indexCount, int vertexCount, int cacheSize, Alloc::IAllocator* allocator)
+{
+    if (indexCount < 3 || vertexCount <= 0)
+    {
+        return 0.0f;
+    }
+
+    //a vertex is in the FIFO if it was inserted less than cacheSize misses ago
+    int* insertTime = PG_NEW_ARRAY(allocator, -1, "ComputeAcmr::insertTime", Alloc::PG_MEM_TEMP, int, vertexCount);
+    Utils::Memset32(insertTime, 0, vertexCount * sizeof(int));
+
+    int time = cacheSize;
+    int misses = 0;
+    for (int i = 0; i < indexCount; ++i)
+    {
+        const int v = indices[i];
+        if (time - insertTime[v] >= cacheSize)
+        {
+            insertTime[v] = time++;
+            ++misses;
+        }
+    }
+
+    PG_DELETE_ARRAY(allocator, insertTime);
+    return static_cast<float>(misses) / static_cast<float>(indexCount / 3);
+}
+
+}   // namespace Mesh
+}   // namespace Pegasus
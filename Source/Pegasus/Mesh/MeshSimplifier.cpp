@@ -0,0 +1,780 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MeshSimplifier.cpp
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Quadric error metric simplification of indexed triangle lists
+
+#include "Pegasus/Mesh/MeshSimplifier.h"
+#include "Pegasus/Mesh/MeshData.h"
+#include "Pegasus/Mesh/MeshOptimizer.h"
+#include "Pegasus/Utils/Memcpy.h"
+#include "Pegasus/Utils/Memset.h"
+#include <math.h>
+
+namespace Pegasus {
+namespace Mesh {
+
+namespace
+{
+
+//! How a vertex is allowed to collapse
+enum VertexKind
+{
+    KIND_MANIFOLD,  //!< single vertex at its position, surrounded by triangles: collapses onto any neighbor
+    KIND_BORDER,    //!< on an open border: collapses onto a neighbor along the border
+    KIND_SEAM,      //!< one of two vertices at the same position: collapses along the seam with its sibling
+    KIND_LOCKED     //!< corners, seam ends and other complex vertices never collapse
+};
+
+//! Empty slot of the half edge table
+const unsigned int EMPTY_EDGE = 0xffffffffu;
+
+//! Weight of the border and seam planes, relative to the triangle planes
+const float BORDER_PLANE_WEIGHT = 10.0f;
+
+//! Cosine of the largest rotation of a triangle normal allowed by a collapse (about 75 degrees),
+//! stricter than a plain flip test so nearly flat slivers cannot fold over
+const float MAX_NORMAL_TURN_COS = 0.25f;
+
+//! Collapses of a pass can have up to this factor of the error of the collapse completing the pass target
+const float PASS_ERROR_SLACK = 1.5f;
+
+//! Integer finalizer, spreads the bits of a key before masking
+inline unsigned int HashInt(unsigned int key)
+{
+    key ^= key >> 16;
+    key *= 0x7feb352du;
+    key ^= key >> 15;
+    key *= 0x846ca68bu;
+    key ^= key >> 16;
+    return key;
+}
+
+//! \return the bits of a float, with -0 and 0 hashing the same
+inline unsigned int FloatBits(float f)
+{
+    union { float f; unsigned int u; } bits;
+    bits.f = (f == 0.0f) ? 0.0f : f;
+    return bits.u;
+}
+
+//! \return the table size for count keys, a power of 2 at most half full
+inline unsigned int HashTableSize(int count)
+{
+    unsigned int size = 16;
+    while (size < static_cast<unsigned int>(count) * 2)
+    {
+        size <<= 1;
+    }
+    return size;
+}
+
+inline Math::Vec3 GetPosition(const StdVertex& vertex)
+{
+    return Math::Vec3(vertex.position.x, vertex.position.y, vertex.position.z);
+}
+
+//! Stable least significant digit radix sort of 32 bit keys, 11 bits per pass
+//! \param keys keys to sort
+//! \param count number of keys
+//! \param order output, indices of the keys in increasing key order
+//! \param temp temporary buffer, count elements
+void RadixSort(const unsigned int* keys, int count, int* order, int* temp)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        order[i] = i;
+    }
+
+    int histogram[2048];
+    int* src = order;
+    int* dst = temp;
+    for (int shift = 0; shift < 32; shift += 11)
+    {
+        Utils::Memset32(histogram, 0, sizeof(histogram));
+        for (int i = 0; i < count; ++i)
+        {
+            ++histogram[(keys[i] >> shift) & 2047];
+        }
+
+        int offset = 0;
+        for (int b = 0; b < 2048; ++b)
+        {
+            const int bucketCount = histogram[b];
+            histogram[b] = offset;
+            offset += bucketCount;
+        }
+
+        for (int i = 0; i < count; ++i)
+        {
+            const int element = src[i];
+            dst[histogram[(keys[element] >> shift) & 2047]++] = element;
+        }
+
+        int* swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    //3 passes, the sorted order ended in temp
+    Utils::Memcpy(order, src, count * sizeof(int));
+}
+
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Symmetric 3x3 matrix A, vector b and scalar c of the quadric p.A.p + 2 b.p + c,
+//! summed over weighted planes. Accumulated in double: on dense meshes the error is a tiny
+//! difference of terms of the size of the squared plane distances to the origin.
+struct MeshSimplifier::Quadric
+{
+    double a00, a11, a22, a01, a12, a02;
+    double b0, b1, b2;
+    double c;
+    double w;
+
+    //! Adds the squared distance to the plane n.p + d = 0
+    void AddPlane(const Math::Vec3& n, float d, float weight)
+    {
+        const double nx = n.x;
+        const double ny = n.y;
+        const double nz = n.z;
+        const double dd = d;
+        a00 += weight * nx * nx;
+        a11 += weight * ny * ny;
+        a22 += weight * nz * nz;
+        a01 += weight * nx * ny;
+        a12 += weight * ny * nz;
+        a02 += weight * nx * nz;
+        b0 += weight * nx * dd;
+        b1 += weight * ny * dd;
+        b2 += weight * nz * dd;
+        c += weight * dd * dd;
+        w += weight;
+    }
+
+    void Add(const Quadric& q)
+    {
+        a00 += q.a00; a11 += q.a11; a22 += q.a22;
+        a01 += q.a01; a12 += q.a12; a02 += q.a02;
+        b0 += q.b0; b1 += q.b1; b2 += q.b2;
+        c += q.c;
+        w += q.w;
+    }
+
+    //! \return the weighted sum of the squared distances of p to the planes
+    double Evaluate(const Math::Vec3& p) const
+    {
+        const double x = p.x;
+        const double y = p.y;
+        const double z = p.z;
+        const double rx = a00 * x + a01 * y + a02 * z;
+        const double ry = a01 * x + a11 * y + a12 * z;
+        const double rz = a02 * x + a12 * y + a22 * z;
+        return x * rx + y * ry + z * rz + 2.0 * (b0 * x + b1 * y + b2 * z) + c;
+    }
+};
+
+//----------------------------------------------------------------------------------------
+
+MeshSimplifier::MeshSimplifier(Alloc::IAllocator* allocator)
+:   mAllocator(allocator),
+    mVertices(nullptr),
+    mVertexCount(0),
+    mIndices(nullptr),
+    mIndexCount(0),
+    mGroup(nullptr),
+    mGroupNext(nullptr),
+    mKind(nullptr),
+    mQuadrics(nullptr),
+    mAdjacencyOffsets(nullptr),
+    mAdjacency(nullptr),
+    mEdges(nullptr),
+    mEdgeMask(0),
+    mCandidateFrom(nullptr),
+    mCandidateTo(nullptr),
+    mCandidateError(nullptr),
+    mCandidateOrder(nullptr),
+    mRemap(nullptr),
+    mPassLocked(nullptr),
+    mMaxError(0.0f),
+    mRadius(0.0f)
+{
+}
+
+//----------------------------------------------------------------------------------------
+
+MeshSimplifier::~MeshSimplifier()
+{
+    Release();
+}
+
+//----------------------------------------------------------------------------------------
+
+void MeshSimplifier::Release()
+{
+    if (mIndices != nullptr)
+    {
+        PG_DELETE_ARRAY(mAllocator, mPassLocked);
+        PG_DELETE_ARRAY(mAllocator, mRemap);
+        PG_DELETE_ARRAY(mAllocator, mCandidateOrder);
+        PG_DELETE_ARRAY(mAllocator, mCandidateError);
+        PG_DELETE_ARRAY(mAllocator, mCandidateTo);
+        PG_DELETE_ARRAY(mAllocator, mCandidateFrom);
+        PG_DELETE_ARRAY(mAllocator, mEdges);
+        PG_DELETE_ARRAY(mAllocator, mAdjacency);
+        PG_DELETE_ARRAY(mAllocator, mAdjacencyOffsets);
+        PG_DELETE_ARRAY(mAllocator, mQuadrics);
+        PG_DELETE_ARRAY(mAllocator, mKind);
+        PG_DELETE_ARRAY(mAllocator, mGroupNext);
+        PG_DELETE_ARRAY(mAllocator, mGroup);
+        PG_DELETE_ARRAY(mAllocator, mIndices);
+        mIndices = nullptr;
+    }
+    mIndexCount = 0;
+    mVertexCount = 0;
+}
+
+//----------------------------------------------------------------------------------------
+
+void MeshSimplifier::Initialize(const StdVertex* vertices, int vertexCount, const unsigned short* indices, int indexCount)
+{
+    PG_ASSERTSTR(indexCount % 3 == 0, "The index count of a triangle list has to be a multiple of 3");
+    Release();
+
+    mVertices = vertices;
+    mVertexCount = vertexCount;
+    mMaxError = 0.0f;
+
+    //every half edge can produce up to 2 collapse candidates
+    const int vertexAllocCount = vertexCount > 0 ? vertexCount : 1;
+    const int indexAllocCount = indexCount > 0 ? indexCount : 1;
+    mIndices = PG_NEW_ARRAY(mAllocator, -1, "MeshSimplifier::mIndices", Alloc::PG_MEM_TEMP, unsigned short, indexAllocCount);
+    mGroup = PG_NEW_ARRAY(mAllocator, -1, "MeshSimplifier::mGroup", Alloc::PG_MEM_TEMP, int, vertexAllocCount);
+    mGroupNext = PG_NEW_ARRAY(mAllocator, -1, "MeshSimplifier::mGroupNext", Alloc::PG_MEM_TEMP, int, vertexAllocCount);
+    mKind = PG_NEW_ARRAY(mAllocator, -1, "MeshSimplifier::mKind", Alloc::PG_MEM_TEMP, unsigned char, vertexAllocCount);
+    mQuadrics = PG_NEW_ARRAY(mAllocator, -1, "MeshSimplifier::mQuadrics", Alloc::PG_MEM_TEMP, Quadric, vertexAllocCount);
+    mAdjacencyOffsets = PG_NEW_ARRAY(mAllocator, -1, "MeshSimplifier::mAdjacencyOffsets", Alloc::PG_MEM_TEMP, int, vertexAllocCount + 1);
+    mAdjacency = PG_NEW_ARRAY(mAllocator, -1, "MeshSimplifier::mAdjacency", Alloc::PG_MEM_TEMP, int, indexAllocCount);
+    const unsigned int edgeTableSize = HashTableSize(indexAllocCount);
+    mEdges = PG_NEW_ARRAY(mAllocator, -1, "MeshSimplifier::mEdges", Alloc::PG_MEM_TEMP, unsigned int, edgeTableSize);
+    mEdgeMask = edgeTableSize - 1;
+    mCandidateFrom = PG_NEW_ARRAY(mAllocator, -1, "MeshSimplifier::mCandidateFrom", Alloc::PG_MEM_TEMP, int, indexAllocCount * 2);
+    mCandidateTo = PG_NEW_ARRAY(mAllocator, -1, "MeshSimplifier::mCandidateTo", Alloc::PG_MEM_TEMP, int, indexAllocCount * 2);
+    mCandidateError = PG_NEW_ARRAY(mAllocator, -1, "MeshSimplifier::mCandidateError", Alloc::PG_MEM_TEMP, float, indexAllocCount * 2);
+    mCandidateOrder = PG_NEW_ARRAY(mAllocator, -1, "MeshSimplifier::mCandidateOrder", Alloc::PG_MEM_TEMP, int, indexAllocCount * 2);
+    mRemap = PG_NEW_ARRAY(mAllocator, -1, "MeshSimplifier::mRemap", Alloc::PG_MEM_TEMP, int, vertexAllocCount);
+    mPassLocked = PG_NEW_ARRAY(mAllocator, -1, "MeshSimplifier::mPassLocked", Alloc::PG_MEM_TEMP, unsigned char, vertexAllocCount);
+
+    Utils::Memcpy(mIndices, indices, indexCount * sizeof(unsigned short));
+    mIndexCount = RemoveDegenerateTriangles(mIndices, indexCount);
+
+    //bounding sphere around the center of the bounding box
+    mRadius = 0.0f;
+    if (vertexCount > 0)
+    {
+        Math::Vec3 minPos = GetPosition(vertices[0]);
+        Math::Vec3 maxPos = minPos;
+        for (int v = 1; v < vertexCount; ++v)
+        {
+            const Math::Vec3 p = GetPosition(vertices[v]);
+            minPos = Math::Vec3(Math::Min(minPos.x, p.x), Math::Min(minPos.y, p.y), Math::Min(minPos.z, p.z));
+            maxPos = Math::Vec3(Math::Max(maxPos.x, p.x), Math::Max(maxPos.y, p.y), Math::Max(maxPos.z, p.z));
+        }
+
+        const Math::Vec3 center = (minPos + maxPos) * 0.5f;
+        float radiusSq = 0.0f;
+        for (int v = 0; v < vertexCount; ++v)
+        {
+            const Math::Vec3 d = GetPosition(vertices[v]) - center;
+            const float distanceSq = Math::Dot(d, d);
+            radiusSq = distanceSq > radiusSq ? distanceSq : radiusSq;
+        }
+        mRadius = sqrtf(radiusSq);
+    }
+
+    BuildAdjacency();
+    BuildGroupsAndKinds();
+    BuildQuadrics();
+}
+
+//----------------------------------------------------------------------------------------
+
+float MeshSimplifier::GetError() const
+{
+    return sqrtf(mMaxError);
+}
+
+//----------------------------------------------------------------------------------------
+
+void MeshSimplifier::BuildAdjacency()
+{
+    Utils::Memset32(mAdjacencyOffsets, 0, (mVertexCount + 1) * sizeof(int));
+    for (int i = 0; i < mIndexCount; ++i)
+    {
+        ++mAdjacencyOffsets[mIndices[i] + 1];
+    }
+    for (int v = 0; v < mVertexCount; ++v)
+    {
+        mAdjacencyOffsets[v + 1] += mAdjacencyOffsets[v];
+    }
+
+    //use the remap as the insertion cursor
+    Utils::Memset32(mRemap, 0, mVertexCount * sizeof(int));
+    for (int i = 0; i < mIndexCount; ++i)
+    {
+        const int v = mIndices[i];
+        mAdjacency[mAdjacencyOffsets[v] + mRemap[v]++] = i / 3;
+    }
+
+    for (unsigned int e = 0; e <= mEdgeMask; ++e)
+    {
+        mEdges[e] = EMPTY_EDGE;
+    }
+    for (int i = 0; i < mIndexCount; ++i)
+    {
+        const unsigned int a = mIndices[i];
+        const unsigned int b = mIndices[i - (i % 3) + ((i + 1) % 3)];
+        const unsigned int key = (a << 16) | b;
+        unsigned int slot = HashInt(key) & mEdgeMask;
+        while (mEdges[slot] != EMPTY_EDGE && mEdges[slot] != key)
+        {
+            slot = (slot + 1) & mEdgeMask;
+        }
+        mEdges[slot] = key;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+bool MeshSimplifier::HasEdge(int a, int b) const
+{
+    const unsigned int key = (static_cast<unsigned int>(a) << 16) | static_cast<unsigned int>(b);
+    unsigned int slot = HashInt(key) & mEdgeMask;
+    while (mEdges[slot] != EMPTY_EDGE)
+    {
+        if (mEdges[slot] == key)
+        {
+            return true;
+        }
+        slot = (slot + 1) & mEdgeMask;
+    }
+    return false;
+}
+
+//----------------------------------------------------------------------------------------
+
+void MeshSimplifier::BuildGroupsAndKinds()
+{
+    if (mVertexCount == 0)
+    {
+        return;
+    }
+
+    //group the vertices by exact position
+    const unsigned int tableSize = HashTableSize(mVertexCount);
+    const unsigned int tableMask = tableSize - 1;
+    int* table = PG_NEW_ARRAY(mAllocator, -1, "MeshSimplifier::positionTable", Alloc::PG_MEM_TEMP, int, tableSize);
+    for (unsigned int s = 0; s < tableSize; ++s)
+    {
+        table[s] = -1;
+    }
+
+    for (int v = 0; v < mVertexCount; ++v)
+    {
+        const Math::Vec4& p = mVertices[v].position;
+        unsigned int slot = HashInt(FloatBits(p.x) ^ HashInt(FloatBits(p.y) ^ HashInt(FloatBits(p.z)))) & tableMask;
+        while (table[slot] >= 0)
+        {
+            const Math::Vec4& other = mVertices[table[slot]].position;
+            if (other.x == p.x && other.y == p.y && other.z == p.z)
+            {
+                break;
+            }
+            slot = (slot + 1) & tableMask;
+        }
+
+        if (table[slot] < 0)
+        {
+            table[slot] = v;
+            mGroup[v] = v;
+            mGroupNext[v] = v;
+        }
+        else
+        {
+            const int leader = table[slot];
+            mGroup[v] = leader;
+            mGroupNext[v] = mGroupNext[leader];
+            mGroupNext[leader] = v;
+        }
+    }
+    PG_DELETE_ARRAY(mAllocator, table);
+
+    //count the open half edges around each vertex. An edge without its opposite half edge is
+    //a seam when the opposite exists between other vertices at the same positions, a border otherwise
+    int* openCounts = PG_NEW_ARRAY(mAllocator, -1, "MeshSimplifier::openCounts", Alloc::PG_MEM_TEMP, int, mVertexCount * 4);
+    Utils::Memset32(openCounts, 0, mVertexCount * 4 * sizeof(int));
+    for (int i = 0; i < mIndexCount; ++i)
+    {
+        const int a = mIndices[i];
+        const int b = mIndices[i - (i % 3) + ((i + 1) % 3)];
+        if (HasEdge(b, a))
+        {
+            continue;
+        }
+
+        bool hasGeometricOpposite = false;
+        int otherB = b;
+        do
+        {
+            int otherA = a;
+            do
+            {
+                hasGeometricOpposite = HasEdge(otherB, otherA);
+                otherA = mGroupNext[otherA];
+            } while (!hasGeometricOpposite && otherA != a);
+            otherB = mGroupNext[otherB];
+        } while (!hasGeometricOpposite && otherB != b);
+
+        //border out, border in, seam out, seam in
+        const int kindOffset = hasGeometricOpposite ? 2 : 0;
+        ++openCounts[a * 4 + kindOffset];
+        ++openCounts[b * 4 + kindOffset + 1];
+    }
+
+    for (int v = 0; v < mVertexCount; ++v)
+    {
+        int groupSize = 1;
+        for (int other = mGroupNext[v]; other != v; other = mGroupNext[other])
+        {
+            ++groupSize;
+        }
+
+        const int* counts = &openCounts[v * 4];
+        if (counts[0] != 0 || counts[1] != 0)
+        {
+            mKind[v] = (groupSize == 1 && counts[0] == 1 && counts[1] == 1) ? KIND_BORDER : KIND_LOCKED;
+        }
+        else if (groupSize == 1)
+        {
+            mKind[v] = KIND_MANIFOLD;
+        }
+        else if (groupSize == 2 && counts[2] == 1 && counts[3] == 1)
+        {
+            mKind[v] = KIND_SEAM;
+        }
+        else
+        {
+            mKind[v] = KIND_LOCKED;
+        }
+    }
+
+    //both sides of a seam have to be able to follow each other
+    for (int v = 0; v < mVertexCount; ++v)
+    {
+        if (mKind[v] == KIND_SEAM && mKind[mGroupNext[v]] != KIND_SEAM)
+        {
+            mKind[v] = KIND_LOCKED;
+        }
+    }
+
+    PG_DELETE_ARRAY(mAllocator, openCounts);
+}
+
+//----------------------------------------------------------------------------------------
+
+void MeshSimplifier::BuildQuadrics()
+{
+    Utils::Memset32(mQuadrics, 0, mVertexCount * sizeof(Quadric));
+
+    for (int t = 0; t < mIndexCount; t += 3)
+    {
+        const Math::Vec3 p0 = GetPosition(mVertices[mIndices[t]]);
+        const Math::Vec3 p1 = GetPosition(mVertices[mIndices[t + 1]]);
+        const Math::Vec3 p2 = GetPosition(mVertices[mIndices[t + 2]]);
+        Math::Vec3 n = Math::Cross(p1 - p0, p2 - p0);
+        const float length = Math::Length(n);
+        if (length == 0.0f)
+        {
+            continue;
+        }
+        n = n * (1.0f / length);
+
+        //triangle plane, weighted by area
+        const float d = -Math::Dot(n, p0);
+        for (int k = 0; k < 3; ++k)
+        {
+            mQuadrics[mGroup[mIndices[t + k]]].AddPlane(n, d, length * 0.5f);
+        }
+
+        //planes perpendicular to the open edges keep borders and seams in place
+        for (int k = 0; k < 3; ++k)
+        {
+            const int a = mIndices[t + k];
+            const int b = mIndices[t + (k + 1) % 3];
+            if (HasEdge(b, a))
+            {
+                continue;
+            }
+
+            const Math::Vec3 pa = GetPosition(mVertices[a]);
+            const Math::Vec3 edge = GetPosition(mVertices[b]) - pa;
+            Math::Vec3 edgeNormal = Math::Cross(edge, n);
+            const float edgeNormalLength = Math::Length(edgeNormal);
+            if (edgeNormalLength == 0.0f)
+            {
+                continue;
+            }
+            edgeNormal = edgeNormal * (1.0f / edgeNormalLength);
+
+            const float edgeD = -Math::Dot(edgeNormal, pa);
+            const float weight = BORDER_PLANE_WEIGHT * Math::Dot(edge, edge);
+            mQuadrics[mGroup[a]].AddPlane(edgeNormal, edgeD, weight);
+            mQuadrics[mGroup[b]].AddPlane(edgeNormal, edgeD, weight);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+int MeshSimplifier::FindSeamSibling(int from, int to) const
+{
+    const int fromSibling = mGroupNext[from];
+    for (int toSibling = mGroupNext[to]; toSibling != to; toSibling = mGroupNext[toSibling])
+    {
+        //the other side of the seam is open too
+        if (HasEdge(fromSibling, toSibling) != HasEdge(toSibling, fromSibling))
+        {
+            return toSibling;
+        }
+    }
+    return -1;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool MeshSimplifier::CanCollapse(int from, int to) const
+{
+    if (mGroup[from] == mGroup[to])
+    {
+        return false;
+    }
+
+    switch (mKind[from])
+    {
+    case KIND_MANIFOLD:
+        return true;
+    case KIND_BORDER:
+    case KIND_SEAM:
+        //only along an open edge, onto a vertex of the same border or seam
+        return (mKind[to] == mKind[from] || mKind[to] == KIND_LOCKED) && HasEdge(from, to) != HasEdge(to, from);
+    default:
+        return false;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+float MeshSimplifier::ComputeError(int from, int to) const
+{
+    Quadric q = mQuadrics[mGroup[from]];
+    q.Add(mQuadrics[mGroup[to]]);
+    const double error = q.Evaluate(GetPosition(mVertices[to])) / (q.w > 0.0 ? q.w : 1.0);
+    return error > 0.0 ? static_cast<float>(error) : 0.0f;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool MeshSimplifier::HasTriangleFlips(int from, int to) const
+{
+    const Math::Vec3 target = GetPosition(mVertices[to]);
+    for (int a = mAdjacencyOffsets[from]; a < mAdjacencyOffsets[from + 1]; ++a)
+    {
+        const int t = mAdjacency[a] * 3;
+        const int i0 = mRemap[mIndices[t]];
+        const int i1 = mRemap[mIndices[t + 1]];
+        const int i2 = mRemap[mIndices[t + 2]];
+        if (i0 == to || i1 == to || i2 == to)
+        {
+            //collapses into a degenerate triangle, removed
+            continue;
+        }
+
+        const Math::Vec3 p0 = GetPosition(mVertices[i0]);
+        const Math::Vec3 p1 = GetPosition(mVertices[i1]);
+        const Math::Vec3 p2 = GetPosition(mVertices[i2]);
+        //zero area triangles, like the poles of a uv sphere, have no orientation to lose
+        const Math::Vec3 before = Math::Cross(p1 - p0, p2 - p0);
+        const Math::Vec3 after = Math::Cross((i1 == from ? target : p1) - (i0 == from ? target : p0),
+                                             (i2 == from ? target : p2) - (i0 == from ? target : p0));
+        const float beforeLength = Math::Length(before);
+        if (beforeLength > 0.0f && Math::Dot(before, after) <= MAX_NORMAL_TURN_COS * beforeLength * Math::Length(after))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//----------------------------------------------------------------------------------------
+
+int MeshSimplifier::CountSharedTriangles(int from, int to) const
+{
+    int count = 0;
+    for (int a = mAdjacencyOffsets[from]; a < mAdjacencyOffsets[from + 1]; ++a)
+    {
+        const int t = mAdjacency[a] * 3;
+        if (mRemap[mIndices[t]] == to || mRemap[mIndices[t + 1]] == to || mRemap[mIndices[t + 2]] == to)
+        {
+            ++count;
+        }
+    }
+    return count;
+}
+
+//----------------------------------------------------------------------------------------
+
+void MeshSimplifier::LockTriangles(int v)
+{
+    for (int a = mAdjacencyOffsets[v]; a < mAdjacencyOffsets[v + 1]; ++a)
+    {
+        const int t = mAdjacency[a] * 3;
+        mPassLocked[mIndices[t]] = 1;
+        mPassLocked[mIndices[t + 1]] = 1;
+        mPassLocked[mIndices[t + 2]] = 1;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+int MeshSimplifier::CollapsePass(int targetIndexCount)
+{
+    BuildAdjacency();
+    for (int v = 0; v < mVertexCount; ++v)
+    {
+        mRemap[v] = v;
+    }
+    Utils::Memset8(mPassLocked, 0, mVertexCount);
+
+    //one candidate per half edge, and the reverse direction of open edges
+    int candidateCount = 0;
+    for (int i = 0; i < mIndexCount; ++i)
+    {
+        const int a = mIndices[i];
+        const int b = mIndices[i - (i % 3) + ((i + 1) % 3)];
+        for (int direction = 0; direction < 2; ++direction)
+        {
+            const int from = direction == 0 ? a : b;
+            const int to = direction == 0 ? b : a;
+            if (CanCollapse(from, to))
+            {
+                mCandidateFrom[candidateCount] = from;
+                mCandidateTo[candidateCount] = to;
+                mCandidateError[candidateCount] = ComputeError(from, to);
+                ++candidateCount;
+            }
+
+            if (HasEdge(b, a))
+            {
+                break;
+            }
+        }
+    }
+
+    if (candidateCount == 0)
+    {
+        return 0;
+    }
+
+    //errors are positive, their bits sort like unsigned integers
+    int* sortTemp = PG_NEW_ARRAY(mAllocator, -1, "MeshSimplifier::sortTemp", Alloc::PG_MEM_TEMP, int, candidateCount);
+    RadixSort(reinterpret_cast<const unsigned int*>(mCandidateError), candidateCount, mCandidateOrder, sortTemp);
+    PG_DELETE_ARRAY(mAllocator, sortTemp);
+
+    //a collapse removes about 2 triangles
+    const int trianglesToRemove = (mIndexCount - targetIndexCount) / 3;
+    const int goalCandidate = trianglesToRemove / 2 < candidateCount ? trianglesToRemove / 2 : candidateCount - 1;
+    const float errorLimit = mCandidateError[mCandidateOrder[goalCandidate]] * PASS_ERROR_SLACK;
+
+    int removedTriangles = 0;
+    int collapseCount = 0;
+    for (int c = 0; c < candidateCount && removedTriangles < trianglesToRemove; ++c)
+    {
+        const int candidate = mCandidateOrder[c];
+        const float error = mCandidateError[candidate];
+        if (error > errorLimit)
+        {
+            break;
+        }
+
+        const int from = mCandidateFrom[candidate];
+        const int to = mCandidateTo[candidate];
+        if (mPassLocked[from] != 0 || mPassLocked[to] != 0)
+        {
+            continue;
+        }
+
+        int fromSibling = -1;
+        int toSibling = -1;
+        if (mKind[from] == KIND_SEAM)
+        {
+            fromSibling = mGroupNext[from];
+            toSibling = FindSeamSibling(from, to);
+            if (toSibling < 0 || mPassLocked[fromSibling] != 0 || mPassLocked[toSibling] != 0)
+            {
+                continue;
+            }
+        }
+
+        if (HasTriangleFlips(from, to) || (fromSibling >= 0 && HasTriangleFlips(fromSibling, toSibling)))
+        {
+            continue;
+        }
+
+        removedTriangles += CountSharedTriangles(from, to);
+        mRemap[from] = to;
+        LockTriangles(from);
+        if (fromSibling >= 0)
+        {
+            removedTriangles += CountSharedTriangles(fromSibling, toSibling);
+            mRemap[fromSibling] = toSibling;
+            LockTriangles(fromSibling);
+        }
+
+        mQuadrics[mGroup[to]].Add(mQuadrics[mGroup[from]]);
+        mMaxError = error > mMaxError ? error : mMaxError;
+        ++collapseCount;
+    }
+
+    //collapse targets are locked, so a single remap step is enough
+    for (int i = 0; i < mIndexCount; ++i)
+    {
+        mIndices[i] = static_cast<unsigned short>(mRemap[mIndices[i]]);
+    }
+    mIndexCount = RemoveDegenerateTriangles(mIndices, mIndexCount);
+
+    return collapseCount;
+}
+
+//----------------------------------------------------------------------------------------
+
+int MeshSimplifier::Simplify(int targetIndexCount)
+{
+    while (mIndexCount > targetIndexCount)
+    {
+        if (CollapsePass(targetIndexCount) == 0)
+        {
+            break;
+        }
+    }
+    return mIndexCount;
+}
+
+}   // namespace Mesh
+}   // namespace Pegasus
@@ -0,0 +1,183 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MeshSoaKernels.cpp
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  SIMD kernels working on structure-of-arrays StdVertex streams
+
+#include "Pegasus/Mesh/MeshSoaKernels.h"
+#include "Pegasus/Mesh/MeshData.h"
+#include "Pegasus/Math/Simd.h"
+#include "Pegasus/Math/BatchTransform.h"
+#include "Pegasus/Utils/Memcpy.h"
+
+namespace Pegasus {
+namespace Mesh {
+
+using namespace Math;
+
+namespace
+{
+
+//! Runs a 4 lane block kernel over count vertices.
+//! The remainder (count % 4) goes through a padded local copy, so nothing is written past count.
+template<class Kernel>
+void RunSoaBlocks(const float* src, int srcPitch, float* dst, int dstPitch, int count, const Kernel& kernel)
+{
+    int v = 0;
+    for (; v + SIMD_WIDTH <= count; v += SIMD_WIDTH)
+    {
+        kernel(src + v, srcPitch, dst + v, dstPitch);
+    }
+
+    const int remainder = count - v;
+    if (remainder > 0)
+    {
+        float tmpSrc[STDVERTEX_SOA_COMPONENT_COUNT * SIMD_WIDTH];
+        float tmpDst[STDVERTEX_SOA_COMPONENT_COUNT * SIMD_WIDTH];
+        for (int c = 0; c < STDVERTEX_SOA_COMPONENT_COUNT; ++c)
+        {
+            for (int l = 0; l < SIMD_WIDTH; ++l)
+            {
+                tmpSrc[c * SIMD_WIDTH + l] = l < remainder ? src[c * srcPitch + v + l] : 0.0f;
+            }
+        }
+
+        kernel(tmpSrc, SIMD_WIDTH, tmpDst, SIMD_WIDTH);
+
+        for (int c = 0; c < STDVERTEX_SOA_COMPONENT_COUNT; ++c)
+        {
+            for (int l = 0; l < remainder; ++l)
+            {
+                dst[c * dstPitch + v + l] = tmpDst[c * SIMD_WIDTH + l];
+            }
+        }
+    }
+}
+
+//! Copies the given planes of a 4 lane block
+inline void CopyPlanes(const float* src, int srcPitch, float* dst, int dstPitch, int firstPlane, int lastPlane)
+{
+    for (int c = firstPlane; c <= lastPlane; ++c)
+    {
+        SimdStoreU(dst + c * dstPitch, SimdLoadU(src + c * srcPitch));
+    }
+}
+
+//! Maximum number of waves the wave kernel supports
+const int MAX_SOA_WAVES = 8;
+
+//! 4 lane wave displacement kernel, parameters are pre-splatted
+struct WaveKernel
+{
+    SimdFloat4 mTimeDir[3];
+    SimdFloat4 mDispDir[3];
+    SimdFloat4 mFreq[MAX_SOA_WAVES];
+    SimdFloat4 mAmp[MAX_SOA_WAVES];
+    SimdFloat4 mOffset[MAX_SOA_WAVES];
+    int mWaveCount;
+    bool mIsRadial;
+
+    WaveKernel(const Vec3& timeDir, const Vec3& dispDir, const Vec3* waves, int waveCount, bool isRadial)
+    : mWaveCount(waveCount), mIsRadial(isRadial)
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            mTimeDir[i] = SimdSet1(timeDir.v[i]);
+            mDispDir[i] = SimdSet1(dispDir.v[i]);
+        }
+
+        for (int w = 0; w < waveCount; ++w)
+        {
+            mFreq[w] = SimdSet1(waves[w].x);
+            mAmp[w] = SimdSet1(waves[w].y);
+            mOffset[w] = SimdSet1(waves[w].z);
+        }
+    }
+
+    void operator()(const float* src, int srcPitch, float* dst, int dstPitch) const
+    {
+        SimdFloat4 p[3];
+        for (int i = 0; i < 3; ++i)
+        {
+            p[i] = SimdLoadU(src + (STDVERTEX_SOA_POSITION_X + i) * srcPitch);
+        }
+
+        const SimdFloat4 t = SimdMulAdd(p[0], mTimeDir[0], SimdMulAdd(p[1], mTimeDir[1], SimdMul(p[2], mTimeDir[2])));
+        SimdFloat4 d = SimdZero();
+        for (int w = 0; w < mWaveCount; ++w)
+        {
+            d = SimdMulAdd(mAmp[w], SimdSin(SimdMulAdd(t, mFreq[w], mOffset[w])), d);
+        }
+
+        SimdFloat4 dir[3];
+        if (mIsRadial)
+        {
+            for (int i = 0; i < 3; ++i)
+            {
+                dir[i] = SimdSub(p[i], SimdMul(t, mTimeDir[i]));
+            }
+
+            const SimdFloat4 eps = SimdSet1(PFLOAT_EPSILON);
+            const SimdFloat4 len = SimdSqrt(SimdMulAdd(dir[0], dir[0], SimdMulAdd(dir[1], dir[1], SimdMul(dir[2], dir[2]))));
+            const SimdFloat4 mask = SimdCmpGt(len, eps);
+            const SimdFloat4 invLen = SimdDiv(SimdSet1(1.0f), SimdMax(len, eps));
+            for (int i = 0; i < 3; ++i)
+            {
+                dir[i] = SimdSelect(mask, SimdMul(dir[i], invLen), SimdZero());
+            }
+        }
+        else
+        {
+            dir[0] = mDispDir[0];
+            dir[1] = mDispDir[1];
+            dir[2] = mDispDir[2];
+        }
+
+        for (int i = 0; i < 3; ++i)
+        {
+            SimdStoreU(dst + (STDVERTEX_SOA_POSITION_X + i) * dstPitch, SimdMulAdd(d, dir[i], p[i]));
+        }
+
+        CopyPlanes(src, srcPitch, dst, dstPitch, STDVERTEX_SOA_POSITION_W, STDVERTEX_SOA_UV_Y);
+    }
+};
+
+}
+
+//----------------------------------------------------------------------------------------
+
+void SoaTransformStdVertices(const float* src, int srcPitch, float* dst, int dstPitch, int count,
+                             const Mat44& posMat, const Mat33& normMat, bool normalizeNormals)
+{
+    TransformHomogeneousPointsSoa(dst + STDVERTEX_SOA_POSITION_X * dstPitch, dstPitch,
+                                  src + STDVERTEX_SOA_POSITION_X * srcPitch, srcPitch, count, posMat);
+    TransformNormalsSoa(dst + STDVERTEX_SOA_NORMAL_X * dstPitch, dstPitch,
+                        src + STDVERTEX_SOA_NORMAL_X * srcPitch, srcPitch, count, normMat, normalizeNormals);
+
+    if (src != dst)
+    {
+        for (int c = STDVERTEX_SOA_UV_X; c <= STDVERTEX_SOA_UV_Y; ++c)
+        {
+            Utils::Memcpy(dst + c * dstPitch, src + c * srcPitch, static_cast<unsigned>(count) * sizeof(float));
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void SoaWaveDisplaceStdVertices(const float* src, int srcPitch, float* dst, int dstPitch, int count,
+                                const Vec3& timeDir, const Vec3& dispDir,
+                                const Vec3* waves, int waveCount, bool isRadial)
+{
+    PG_ASSERTSTR(waveCount >= 0 && waveCount <= MAX_SOA_WAVES, "Too many waves for the wave kernel");
+    const WaveKernel kernel(timeDir, dispDir, waves, waveCount, isRadial);
+    RunSoaBlocks(src, srcPitch, dst, dstPitch, count, kernel);
+}
+
+}   // namespace Mesh
+}   // namespace Pegasus
@@ -11,6 +11,7 @@
 
 
 #include "Pegasus/Mesh/Operator/CombineTransformOperator.h"
+#include "Pegasus/Mesh/MeshSoaKernels.h"
 #include "Pegasus/Math/Quaternion.h"
 
 namespace Pegasus {
@@ -58,28 +59,42 @@ CombineTransformOperator::~CombineTransformOperator()
 {
 }
 
-static void TransformAppendMesh(const StdVertex* input, StdVertex* outputDest, int count, const Math::Mat44& targetTransform, const Math::Mat33& targetNormalTransform)
+namespace
 {
-    for (int v = 0; v < count; ++v)
+
+//! Transforms a chunk of the vertices of one input
+struct CombineVertexChunk
+{
+    const float* mInput;
+    int mInputPitch;
+    float* mOutput;
+    int mOutputPitch;
+    const Math::Mat44* mTransform;
+    const Math::Mat33* mNormalTransform;
+
+    void operator()(int begin, int end) const
     {
-        Math::Mult44_41(outputDest[v].position, targetTransform, input[v].position);
-        Math::Mult33_31(outputDest[v].normal, targetNormalTransform, input[v].normal);
-        float len = Math::Length(outputDest[v].normal);
-        if (Math::Abs(len) > PFLOAT_EPSILON)
-        {
-            outputDest[v].normal /= len;
-        }
-        
-        outputDest[v].uv = input[v].uv;
+        SoaTransformStdVertices(mInput + begin, mInputPitch, mOutput + begin, mOutputPitch, end - begin,
+                                *mTransform, *mNormalTransform, true);
     }
-}
+};
 
-static void AppendIndices(const unsigned short* inputIndices, unsigned short* outputIndices, int count, short newOffset)
+//! Appends a chunk of the indices of one input
+struct CombineIndexChunk
 {
-    for (int i = 0; i < count; ++i)
+    const unsigned short* mInput;
+    unsigned short* mOutput;
+    unsigned short mOffset;
+
+    void operator()(int begin, int end) const
     {
-        outputIndices[i] = inputIndices[i] + newOffset;
+        for (int i = begin; i < end; ++i)
+        {
+            mOutput[i] = mInput[i] + mOffset;
+        }
     }
+};
+
 }
 
 void CombineTransformOperator::GenerateData()
@@ -116,7 +131,8 @@ void CombineTransformOperator::GenerateData()
     meshData->AllocateIndexes(currentIndexCount);
     meshData->AllocateVertexes(currentVertexCount);
 
-    StdVertex* outputVertData = meshData->GetStream<StdVertex>(0);
+    float* outputVertData = meshData->GetSoaStream(0);
+    const int outputPitch = meshData->GetSoaPitch();
     unsigned short* outputIndices = meshData->GetIndexBuffer();
 
     //go for every single active child mesh and get all the counts.
@@ -128,13 +144,15 @@ void CombineTransformOperator::GenerateData()
         Math::Mat33& targetNormalTransform = normalMatrices[i];
         if (inputData != nullptr)
         {
-            const StdVertex* inputVertData = inputData->GetStream<StdVertex>(0);
-            StdVertex* currentMeshOutput = outputVertData + vertexSummedCounts[i];
-            TransformAppendMesh(inputVertData, currentMeshOutput, inputData->GetVertexCount(), targetTransform, targetNormalTransform);
+            const float* inputVertData = inputData->GetConstSoaStream(0);
+            float* currentMeshOutput = outputVertData + vertexSummedCounts[i];
+            CombineVertexChunk vertexChunk = { inputVertData, inputData->GetSoaPitch(), currentMeshOutput, outputPitch, &targetTransform, &targetNormalTransform };
+            Core::ParallelFor(inputData->GetVertexCount(), MESH_PARALLEL_GRAIN_SIZE, vertexChunk);
             
             const unsigned short* inputIndices = inputData->GetIndexBuffer();
             unsigned short* currentIndexOutput = outputIndices + indexSummedCounts[i];
-            AppendIndices(inputIndices, currentIndexOutput, inputData->GetIndexCount(), vertexSummedCounts[i]);
+            CombineIndexChunk indexChunk = { inputIndices, currentIndexOutput, static_cast<unsigned short>(vertexSummedCounts[i]) };
+            Core::ParallelFor(inputData->GetIndexCount(), MESH_PARALLEL_GRAIN_SIZE, indexChunk);
         }
     }
 
@@ -0,0 +1,143 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file	LodOperator.cpp
+//! \author	Kleber Garcia
+//! \date	October 18th 2026
+//! \brief	LodOperator, builds a chain of levels of detail with quadric error simplification
+
+#include "Pegasus/Mesh/Operator/LodOperator.h"
+#include "Pegasus/Mesh/MeshSimplifier.h"
+#include "Pegasus/Mesh/MeshOptimizer.h"
+#include "Pegasus/Math/Constants.h"
+
+namespace Pegasus {
+namespace Mesh {
+
+
+//! Property implementations
+BEGIN_IMPLEMENT_PROPERTIES(LodOperator)
+    IMPLEMENT_PROPERTY(LodOperator, LodCount)
+    IMPLEMENT_PROPERTY(LodOperator, LodRatio)
+    IMPLEMENT_PROPERTY(LodOperator, LodScreenError)
+END_IMPLEMENT_PROPERTIES(LodOperator)
+
+
+LodOperator::LodOperator(Pegasus::Alloc::IAllocator* nodeAllocator,
+              Pegasus::Alloc::IAllocator* nodeDataAllocator)
+: MeshOperator(nodeAllocator, nodeDataAllocator)
+{
+    //INIT properties
+    BEGIN_INIT_PROPERTIES(LodOperator)
+        INIT_PROPERTY(LodCount)
+        INIT_PROPERTY(LodRatio)
+        INIT_PROPERTY(LodScreenError)
+    END_INIT_PROPERTIES()
+}
+
+LodOperator::~LodOperator()
+{
+}
+
+void LodOperator::GenerateData()
+{
+    PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::BEGIN);
+
+    bool updated = false;
+    MeshDataRef inputMesh = static_cast<MeshData *>(&(*GetInput(0)->GetUpdatedData(updated)));
+    const StdVertex* inputVertex = inputMesh->GetConstStream<StdVertex>(0);
+    const unsigned short* inputIndexes = inputMesh->GetIndexBuffer();
+    const int vertexCount = inputMesh->GetVertexCount();
+    const int indexCount = inputMesh->GetIndexCount();
+
+    MeshDataRef meshData = GetData();
+    PG_ASSERT(meshData != nullptr);
+
+    //the levels only change the indices
+    meshData->AllocateVertexes(vertexCount);
+    Utils::Memcpy(meshData->GetStream<StdVertex>(0), inputVertex, sizeof(StdVertex) * vertexCount);
+
+    const MeshConfiguration& configuration = inputMesh->GetConfiguration();
+    if (!configuration.GetIsIndexed() || configuration.GetMeshPrimitiveType() != MeshConfiguration::TRIANGLE)
+    {
+        PG_LOG('ERR_', "LodOperator only supports indexed triangle lists, copying the mesh unchanged.");
+        meshData->AllocateIndexes(indexCount);
+        Utils::Memcpy(meshData->GetIndexBuffer(), inputIndexes, sizeof(unsigned short) * indexCount);
+        meshData->SetLodCount(0);
+        PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::END_SUCCESS);
+        return;
+    }
+
+    int lodCount = GetLodCount();
+    if (lodCount < 1 || lodCount > MESH_MAX_LODS)
+    {
+        PG_LOG('ERR_', "LodCount not allowed to be below 1 or above %d.", MESH_MAX_LODS);
+        lodCount = lodCount < 1 ? 1 : MESH_MAX_LODS;
+    }
+
+    float ratio = GetLodRatio();
+    if (ratio <= 0.0f || ratio >= 1.0f)
+    {
+        PG_LOG('ERR_', "LodRatio has to be between 0 and 1.");
+        ratio = 0.5f;
+    }
+
+    //every level can at most have as many indices as the input, the buffer is shrunk at the end
+    Alloc::IAllocator* allocator = GetNodeDataAllocator();
+    const int maxIndexCount = indexCount * lodCount;
+    unsigned short* lodIndexes = PG_NEW_ARRAY(allocator, -1, "LodOperator::lodIndexes", Alloc::PG_MEM_TEMP, unsigned short, maxIndexCount > 0 ? maxIndexCount : 1);
+    MeshLod lods[MESH_MAX_LODS];
+
+    MeshSimplifier simplifier(allocator);
+    simplifier.Initialize(inputVertex, vertexCount, inputIndexes, indexCount);
+
+    const float screenError = GetLodScreenError();
+    const float diameter = 2.0f * simplifier.GetRadius();
+    int outputIndexCount = 0;
+    int outputLodCount = 0;
+    while (outputLodCount < lodCount)
+    {
+        if (outputLodCount > 0)
+        {
+            const int previousCount = lods[outputLodCount - 1].mIndexCount;
+            const int target = static_cast<int>(static_cast<float>(previousCount / 3) * ratio) * 3;
+            if (target < 3 || simplifier.Simplify(target) >= previousCount)
+            {
+                //cannot simplify any further without breaking seams or folding triangles
+                break;
+            }
+        }
+
+        //the error of the level is a fraction error / diameter of the projected diameter of the mesh
+        MeshLod& lod = lods[outputLodCount];
+        const float error = simplifier.GetError();
+        lod.mIndexOffset = outputIndexCount;
+        lod.mIndexCount = simplifier.GetIndexCount();
+        lod.mMaxScreenSize = (outputLodCount == 0 || error <= 0.0f) ? PFLOAT_MAX : screenError * diameter / error;
+
+        //the vertices are shared by all the levels, only the triangle order can be optimized per level
+        OptimizeVertexCache(simplifier.GetIndices(), lod.mIndexCount, vertexCount, MESH_DEFAULT_VERTEX_CACHE_SIZE, lodIndexes + outputIndexCount, allocator);
+        outputIndexCount += lod.mIndexCount;
+        ++outputLodCount;
+    }
+
+    meshData->AllocateIndexes(outputIndexCount);
+    Utils::Memcpy(meshData->GetIndexBuffer(), lodIndexes, sizeof(unsigned short) * outputIndexCount);
+    meshData->SetLodCount(outputLodCount);
+    for (int l = 0; l < outputLodCount; ++l)
+    {
+        meshData->EditLod(l) = lods[l];
+        PG_LOG('MESH', "LodOperator: level %d, %d triangles, max screen size %.3f", l, lods[l].mIndexCount / 3, lods[l].mMaxScreenSize);
+    }
+
+    PG_DELETE_ARRAY(allocator, lodIndexes);
+
+    PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::END_SUCCESS);
+}
+
+
+}
+}
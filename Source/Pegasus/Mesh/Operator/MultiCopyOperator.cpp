@@ -9,6 +9,7 @@
 //! \date	May 21th 2017
 //! \brief	MultiCopyOperator
 #include "Pegasus/Mesh/Operator/MultiCopyOperator.h"
+#include "Pegasus/Mesh/MeshSoaKernels.h"
 #include "Pegasus/Math/Quaternion.h"
 
 namespace Pegasus {
@@ -41,88 +42,133 @@ MultiCopyOperator::~MultiCopyOperator()
 {
 }
 
+namespace
+{
+
+//! Transforms a chunk of the output vertices, a chunk can span several copies
+struct MultiCopyVertexChunk
+{
+    const float* mInput;
+    int mInputPitch;
+    float* mOutput;
+    int mOutputPitch;
+    int mVertexCount;
+    const Math::Mat44* mMatrices;
+    const Math::Mat33* mNormalMatrices;
+
+    void operator()(int begin, int end) const
+    {
+        while (begin < end)
+        {
+            const int copy = begin / mVertexCount;
+            const int v = begin - copy * mVertexCount;
+            const int count = end - begin < mVertexCount - v ? end - begin : mVertexCount - v;
+            SoaTransformStdVertices(mInput + v, mInputPitch, mOutput + begin, mOutputPitch, count,
+                                    mMatrices[copy], mNormalMatrices[copy], false);
+            begin += count;
+        }
+    }
+};
+
+//! Offsets a chunk of the output indices to point to their copy
+struct MultiCopyIndexChunk
+{
+    const unsigned short* mInput;
+    unsigned short* mOutput;
+    int mIndexCount;
+    int mVertexCount;
+
+    void operator()(int begin, int end) const
+    {
+        for (int k = begin; k < end; ++k)
+        {
+            const int copy = k / mIndexCount;
+            mOutput[k] = static_cast<unsigned short>(mInput[k - copy * mIndexCount] + copy * mVertexCount);
+        }
+    }
+};
+
+}
+
 void MultiCopyOperator::GenerateData()
 {
     PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::BEGIN);
 
-    //generate matrices
-    Math::Mat44 mat = Math::MAT44_IDENTITY;
-    Math::Mat33 normMat = Math::MAT33_IDENTITY;
-
     int iterCount = GetMultiCopyFactor();
-    if (iterCount <= 1 || iterCount > 64)
+    if (iterCount <= 1 || iterCount > MaxMultiCopyFactor)
     {
         PG_LOG('ERR_', "MultiCopyFactor not allowed to be below 1 or above 64.");
         iterCount = 1;
     }
     bool updated = false;
     MeshDataRef inputMesh = static_cast<MeshData *>(&(*GetInput(0)->GetUpdatedData(updated)));
-    const StdVertex* inputVertex = inputMesh->GetStream<StdVertex>(0);
+    const float* inputVertex = inputMesh->GetConstSoaStream(0);
+    const int inputPitch = inputMesh->GetSoaPitch();
     const unsigned short* inputIndexes = inputMesh->GetIndexBuffer();
 
     MeshDataRef meshData = GetData();
     PG_ASSERT(meshData != nullptr); 
     meshData->AllocateVertexes(inputMesh->GetVertexCount() * iterCount);
     meshData->AllocateIndexes(inputMesh->GetIndexCount() * iterCount);
-    StdVertex* outputVertex = meshData->GetStream<StdVertex>(0);
+    float* outputVertex = meshData->GetSoaStream(0);
+    const int outputPitch = meshData->GetSoaPitch();
     unsigned short* outputIndexes = meshData->GetIndexBuffer();
 
-    for (int i = 0; i < iterCount; ++i)
+    //prepare the offset transform, applied once more on each copy
+    Math::Mat44 newTransform;
+    Math::Mat33 newNormTransform;
+
+    Math::Vec3 s = GetScaleOffset();
+    Math::Mat44 scaleMat4 = Math::MAT44_IDENTITY;
+    Math::Mat33 scaleMat3 = Math::MAT33_IDENTITY;
+    scaleMat4.m11 = s.x;
+    scaleMat4.m22 = s.y;
+    scaleMat4.m33 = s.z;
+    scaleMat3.m11 = 1.0f/s.x;
+    scaleMat3.m22 = 1.0f/s.y;
+    scaleMat3.m33 = 1.0f/s.z;
+
+    Math::Vec3 t = GetTranslationOffset();
+
+    Math::Vec4 axisAngle = GetQuaternionRotOffset();
+    Math::Vec3 axisRot(axisAngle.x,axisAngle.y,axisAngle.z);
+    Math::Quaternion q(axisRot, axisAngle.w);
+    Math::QuaternionToMat44(newTransform, q);
+    Math::QuaternionToMat33(newNormTransform, q);
+
+    Math::Mult44_44(newTransform,newTransform,scaleMat4);
+    Math::Mult33_33(newNormTransform,newNormTransform,scaleMat3);
+
+    newTransform.m14 = t.x;
+    newTransform.m24 = t.y;
+    newTransform.m34 = t.z;
+    newTransform.m44 = 1.0f;
+
+    //generate the matrices of every copy up front, so copies can be processed in any order
+    Math::Mat44 matrices[MaxMultiCopyFactor];
+    Math::Mat33 normMatrices[MaxMultiCopyFactor];
+    matrices[0] = Math::MAT44_IDENTITY;
+    normMatrices[0] = Math::MAT33_IDENTITY;
+    for (int i = 1; i < iterCount; ++i)
     {
-        //transform current mesh
-        for (int v = 0; v < inputMesh->GetVertexCount(); ++v)
-        {
-            int vIdx = i*inputMesh->GetVertexCount() + v;
-            Math::Mult44_41(outputVertex[vIdx].position, mat, inputVertex[v].position);
-            Math::Mult33_31(outputVertex[vIdx].normal, normMat, inputVertex[v].normal);
-            outputVertex[vIdx].uv = inputVertex[v].uv;
-        }
-
-        for (int k = 0; k < inputMesh->GetIndexCount(); ++k)
-        {
-           int kIdx =  i*inputMesh->GetIndexCount() + k; 
-           outputIndexes[kIdx] = inputIndexes[k] + i*inputMesh->GetVertexCount();
-        }
+        Math::Mult44_44(matrices[i], matrices[i - 1], newTransform);
+        Math::Mult33_33(normMatrices[i], normMatrices[i - 1], newNormTransform);
+    }
 
-        //prepare transforms for next iteration
-        Math::Mat44 newTransform;
-        Math::Mat33 newNormTransform;
-
-        Math::Vec3 s = GetScaleOffset();
-        Math::Mat44 scaleMat4 = Math::MAT44_IDENTITY;
-        Math::Mat33 scaleMat3 = Math::MAT33_IDENTITY;
-        scaleMat4.m11 = s.x;
-        scaleMat4.m22 = s.y;
-        scaleMat4.m33 = s.z;
-        scaleMat3.m11 = 1.0f/s.x;
-        scaleMat3.m22 = 1.0f/s.y;
-        scaleMat3.m33 = 1.0f/s.z;
-        
-
-        Math::Vec3 t = GetTranslationOffset();
-
-        Math::Vec4 axisAngle = GetQuaternionRotOffset();
-        Math::Vec3 axisRot(axisAngle.x,axisAngle.y,axisAngle.z);
-        Math::Quaternion q(axisRot, axisAngle.w);
-        Math::QuaternionToMat44(newTransform, q);
-        Math::QuaternionToMat33(newNormTransform, q);
-
-        Math::Mult44_44(newTransform,newTransform,scaleMat4);
-        Math::Mult33_33(newNormTransform,newNormTransform,scaleMat3);
-
-        newTransform.m14 = t.x;
-        newTransform.m24 = t.y;
-        newTransform.m34 = t.z;
-        newTransform.m44 = 1.0f;
-
-        Math::Mult44_44(mat, mat, newTransform);
-        Math::Mult33_33(normMat, normMat, newNormTransform);
+    if (inputMesh->GetVertexCount() > 0)
+    {
+        MultiCopyVertexChunk vertexChunk = { inputVertex, inputPitch, outputVertex, outputPitch, inputMesh->GetVertexCount(), matrices, normMatrices };
+        Core::ParallelFor(meshData->GetVertexCount(), MESH_PARALLEL_GRAIN_SIZE, vertexChunk);
     }
 
+    if (inputMesh->GetIndexCount() > 0)
+    {
+        MultiCopyIndexChunk indexChunk = { inputIndexes, outputIndexes, inputMesh->GetIndexCount(), inputMesh->GetVertexCount() };
+        Core::ParallelFor(meshData->GetIndexCount(), MESH_PARALLEL_GRAIN_SIZE, indexChunk);
+    }
 
     PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::END_SUCCESS);
 }
 
-
 }
 }
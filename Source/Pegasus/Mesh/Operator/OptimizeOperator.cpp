@@ -0,0 +1,131 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file	OptimizeOperator.cpp
+//! \author	Kleber Garcia
+//! \date	October 18th 2026
+//! \brief	OptimizeOperator, welds and reorders a mesh for the GPU vertex caches
+
+#include "Pegasus/Mesh/Operator/OptimizeOperator.h"
+
+namespace Pegasus {
+namespace Mesh {
+
+
+//! Property implementations
+BEGIN_IMPLEMENT_PROPERTIES(OptimizeOperator)
+    IMPLEMENT_PROPERTY(OptimizeOperator, WeldPositionTolerance)
+    IMPLEMENT_PROPERTY(OptimizeOperator, WeldNormalTolerance)
+    IMPLEMENT_PROPERTY(OptimizeOperator, WeldUvTolerance)
+    IMPLEMENT_PROPERTY(OptimizeOperator, VertexCacheSize)
+END_IMPLEMENT_PROPERTIES(OptimizeOperator)
+
+
+OptimizeOperator::OptimizeOperator(Pegasus::Alloc::IAllocator* nodeAllocator, 
+              Pegasus::Alloc::IAllocator* nodeDataAllocator) 
+: MeshOperator(nodeAllocator, nodeDataAllocator)
+, mAcmrBefore(0.0f)
+, mAcmrAfter(0.0f)
+{
+    //INIT properties
+    BEGIN_INIT_PROPERTIES(OptimizeOperator)
+        INIT_PROPERTY(WeldPositionTolerance)
+        INIT_PROPERTY(WeldNormalTolerance)
+        INIT_PROPERTY(WeldUvTolerance)
+        INIT_PROPERTY(VertexCacheSize)
+    END_INIT_PROPERTIES()
+}
+
+OptimizeOperator::~OptimizeOperator()
+{
+}
+
+void OptimizeOperator::GenerateData()
+{
+    PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::BEGIN);
+
+    bool updated = false;
+    MeshDataRef inputMesh = static_cast<MeshData *>(&(*GetInput(0)->GetUpdatedData(updated)));
+    const StdVertex* inputVertex = inputMesh->GetConstStream<StdVertex>(0);
+    const unsigned short* inputIndexes = inputMesh->GetIndexBuffer();
+    const int vertexCount = inputMesh->GetVertexCount();
+    const int indexCount = inputMesh->GetIndexCount();
+
+    MeshDataRef meshData = GetData();
+    PG_ASSERT(meshData != nullptr); 
+
+    const MeshConfiguration& configuration = inputMesh->GetConfiguration();
+    if (!configuration.GetIsIndexed() || configuration.GetMeshPrimitiveType() != MeshConfiguration::TRIANGLE)
+    {
+        PG_LOG('ERR_', "OptimizeOperator only supports indexed triangle lists, copying the mesh unchanged.");
+        meshData->AllocateVertexes(vertexCount);
+        meshData->AllocateIndexes(indexCount);
+        Utils::Memcpy(meshData->GetStream<StdVertex>(0), inputVertex, sizeof(StdVertex) * vertexCount);
+        Utils::Memcpy(meshData->GetIndexBuffer(), inputIndexes, sizeof(unsigned short) * indexCount);
+        mAcmrBefore = mAcmrAfter = 0.0f;
+        PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::END_SUCCESS);
+        return;
+    }
+
+    int cacheSize = GetVertexCacheSize();
+    if (cacheSize < MinVertexCacheSize || cacheSize > MaxVertexCacheSize)
+    {
+        PG_LOG('ERR_', "VertexCacheSize not allowed to be below 4 or above 64.");
+        cacheSize = MESH_DEFAULT_VERTEX_CACHE_SIZE;
+    }
+
+    Alloc::IAllocator* allocator = GetNodeDataAllocator();
+    int* vertexRemap = PG_NEW_ARRAY(allocator, -1, "OptimizeOperator::vertexRemap", Alloc::PG_MEM_TEMP, int, vertexCount > 0 ? vertexCount : 1);
+    unsigned short* weldedIndexes = PG_NEW_ARRAY(allocator, -1, "OptimizeOperator::weldedIndexes", Alloc::PG_MEM_TEMP, unsigned short, indexCount > 0 ? indexCount : 1);
+
+    mAcmrBefore = ComputeAcmr(inputIndexes, indexCount, vertexCount, cacheSize, allocator);
+
+    //point every index to the vertex representing its welded group
+    const float weldTolerance = GetWeldPositionTolerance();
+    if (weldTolerance > 0.0f)
+    {
+        WeldStdVertices(inputVertex, vertexCount, weldTolerance, GetWeldNormalTolerance(), GetWeldUvTolerance(), vertexRemap, allocator);
+        for (int i = 0; i < indexCount; ++i)
+        {
+            weldedIndexes[i] = static_cast<unsigned short>(vertexRemap[inputIndexes[i]]);
+        }
+    }
+    else
+    {
+        Utils::Memcpy(weldedIndexes, inputIndexes, sizeof(unsigned short) * indexCount);
+    }
+    const int outputIndexCount = RemoveDegenerateTriangles(weldedIndexes, indexCount);
+
+    //triangle order first, then the vertex order follows the triangle order
+    meshData->AllocateIndexes(outputIndexCount);
+    unsigned short* outputIndexes = meshData->GetIndexBuffer();
+    OptimizeVertexCache(weldedIndexes, outputIndexCount, vertexCount, cacheSize, outputIndexes, allocator);
+    const int outputVertexCount = OptimizeVertexFetch(outputIndexes, outputIndexCount, vertexCount, vertexRemap);
+
+    meshData->AllocateVertexes(outputVertexCount);
+    StdVertex* outputVertex = meshData->GetStream<StdVertex>(0);
+    for (int v = 0; v < vertexCount; ++v)
+    {
+        if (vertexRemap[v] >= 0)
+        {
+            outputVertex[vertexRemap[v]] = inputVertex[v];
+        }
+    }
+
+    mAcmrAfter = ComputeAcmr(outputIndexes, outputIndexCount, outputVertexCount, cacheSize, allocator);
+
+    PG_DELETE_ARRAY(allocator, weldedIndexes);
+    PG_DELETE_ARRAY(allocator, vertexRemap);
+
+    PG_LOG('MESH', "OptimizeOperator: %d -> %d vertices, %d -> %d triangles, ACMR %.3f -> %.3f",
+           vertexCount, outputVertexCount, indexCount / 3, outputIndexCount / 3, mAcmrBefore, mAcmrAfter);
+
+    PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::END_SUCCESS);
+}
+
+
+}
+}
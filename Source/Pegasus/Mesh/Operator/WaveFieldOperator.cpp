@@ -9,6 +9,7 @@
 //! \date	May 21th 2017
 //! \brief	WaveFieldOperator
 #include "Pegasus/Mesh/Operator/WaveFieldOperator.h"
+#include "Pegasus/Mesh/MeshSoaKernels.h"
 #include "Pegasus/Math/Quaternion.h"
 
 namespace Pegasus {
@@ -45,6 +46,30 @@ WaveFieldOperator::~WaveFieldOperator()
 {
 }
 
+namespace
+{
+
+//! Displaces a chunk of vertices
+struct WaveFieldChunk
+{
+    const float* mInput;
+    int mInputPitch;
+    float* mOutput;
+    int mOutputPitch;
+    Math::Vec3 mTimeDir;
+    Math::Vec3 mDisplacementDir;
+    const Math::Vec3* mWaves;
+    bool mIsRadial;
+
+    void operator()(int begin, int end) const
+    {
+        SoaWaveDisplaceStdVertices(mInput + begin, mInputPitch, mOutput + begin, mOutputPitch, end - begin,
+                                   mTimeDir, mDisplacementDir, mWaves, WaveFieldOperator::NumOfWaves, mIsRadial);
+    }
+};
+
+}
+
 void WaveFieldOperator::GenerateData()
 {
     PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::BEGIN);
@@ -58,14 +83,15 @@ void WaveFieldOperator::GenerateData()
     
     bool updated = false;
     MeshDataRef inputMesh = static_cast<MeshData *>(&(*GetInput(0)->GetUpdatedData(updated)));
-    const StdVertex* inputVertex = inputMesh->GetStream<StdVertex>(0);
+    const float* inputVertex = inputMesh->GetConstSoaStream(0);
+    const int inputPitch = inputMesh->GetSoaPitch();
     const unsigned short* inputIndexes = inputMesh->GetIndexBuffer();
 
     MeshDataRef meshData = GetData();
     PG_ASSERT(meshData != nullptr); 
     meshData->AllocateVertexes(inputMesh->GetVertexCount());
     meshData->AllocateIndexes(inputMesh->GetIndexCount());
-    StdVertex* outputVertex = meshData->GetStream<StdVertex>(0);
+    float* outputVertex = meshData->GetSoaStream(0);
     unsigned short* outputIndexes = meshData->GetIndexBuffer();
 
     //copy indexes, which are exact replicas.
@@ -78,42 +104,10 @@ void WaveFieldOperator::GenerateData()
     waveParams[2] = GetWFFreqAmpOffset2();
     waveParams[3] = GetWFFreqAmpOffset3();
 
+    //todo, reconstruct normals
     bool isRadial = GetWFIsRadial() > 0;
-    for (int v = 0; v < meshData->GetVertexCount(); ++v)
-    {
-        const Math::Vec4& p4 = inputVertex[v].position;
-        Math::Vec3 p3(p4.x,p4.y,p4.z);
-
-        float t = Math::Dot(p3, timeDir);
-        float d = 0.0f;
-            
-        for (int w = 0; w < NumOfWaves; ++w)
-        {
-            Math::Vec3& wave = waveParams[w];
-            d += wave.y*(Math::Sin(t*wave.x + wave.z));
-        }
-
-        Math::Vec3 waveDispDir = displacementDir;
-        if (isRadial)
-        { 
-            Math::Vec3 radialDisp = p3-t*timeDir;
-            float radialDispLen = Math::Length(radialDisp);
-            if (radialDispLen > PFLOAT_EPSILON)
-            {
-                radialDisp /= radialDispLen;
-            }
-            else
-            {
-                radialDisp = Math::Vec3(0.0f,0.0f,0.0f);
-            }
-            waveDispDir = radialDisp;
-        }
-        outputVertex[v].position = inputVertex[v].position + Math::Vec4(d*waveDispDir,0.0f);
-
-        //todo, reconstruct normals
-        outputVertex[v].normal = inputVertex[v].normal;
-        outputVertex[v].uv = inputVertex[v].uv;
-    }
+    WaveFieldChunk chunk = { inputVertex, inputPitch, outputVertex, meshData->GetSoaPitch(), timeDir, displacementDir, waveParams, isRadial };
+    Core::ParallelFor(meshData->GetVertexCount(), MESH_PARALLEL_GRAIN_SIZE, chunk);
 
     PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::END_SUCCESS);
 }
@@ -23,6 +23,8 @@ PropertyGridClassInfo::PropertyGridClassInfo()
 ,   mParentClassInfo(nullptr)
 ,   mClassPropertyRecords(&PropertyGridStaticAllocator::GetInstance())
 ,   mNumClassProperties(0)
+,   mAllClassPropertyRecords(&PropertyGridStaticAllocator::GetInstance())
+,   mClassLayout(&PropertyGridStaticAllocator::GetInstance())
 #if PEGASUS_ENABLE_PROXIES
 ,   mProxy(this)
 #endif
@@ -44,6 +46,12 @@ const PropertyRecord & PropertyGridClassInfo::GetClassPropertyRecord(unsigned in
 {
     //! \todo Test for the validity of the index
 
+    // Once compiled, the records of the whole hierarchy are in a single list
+    if (index < mAllClassPropertyRecords.GetSize())
+    {
+        return *mAllClassPropertyRecords[index];
+    }
+
     if (mParentClassInfo != nullptr)
     {
         if (index < mParentClassInfo->GetNumClassProperties())
@@ -128,7 +136,8 @@ void PropertyGridClassInfo::DeclareProperty(PropertyType type, int size, const c
 
 void PropertyGridClassInfo::UpdateNumClassPropertiesFromParents()
 {
-    PG_ASSERT(mNumClassProperties == 0);
+    // Counted again from scratch, the hierarchy is resolved again by each application created
+    mNumClassProperties = 0;
 
     const PropertyGridClassInfo * classInfo = this;
     do
@@ -139,6 +148,27 @@ void PropertyGridClassInfo::UpdateNumClassPropertiesFromParents()
     while (classInfo != nullptr);
 }
 
+//----------------------------------------------------------------------------------------
+
+void PropertyGridClassInfo::CompileClassLayout()
+{
+    mAllClassPropertyRecords.Clear();
+
+    // Records are gathered through the parent classes, the list of this class is filled last
+    for (unsigned int p = 0; p < mNumClassProperties; ++p)
+    {
+        // The record is fetched before growing the list, which would otherwise return the new empty entry
+        const PropertyRecord * record = &GetClassPropertyRecord(p);
+        mAllClassPropertyRecords.PushEmpty() = record;
+    }
+
+    mClassLayout.Reset(mNumClassProperties);
+    for (unsigned int p = 0; p < mNumClassProperties; ++p)
+    {
+        mClassLayout.Add(mAllClassPropertyRecords[p]->name, static_cast<int>(p));
+    }
+}
+
 
 }   // namespace PropertyGrid
 }   // namespace Pegasus
@@ -94,6 +94,12 @@ void PropertyGridManager::ResolveInternalClassHierarchy()
     {
         mClassInfos[ci].UpdateNumClassPropertiesFromParents();
     }
+
+    // Compile the layout of every class, so class properties are found by name without walking the hierarchy
+    for (unsigned int ci = 0; ci < mClassInfos.GetSize(); ++ci)
+    {
+        mClassInfos[ci].CompileClassLayout();
+    }
 }
 
 //----------------------------------------------------------------------------------------
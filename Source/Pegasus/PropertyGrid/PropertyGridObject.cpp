@@ -10,6 +10,8 @@
 //! \brief	Property grid object, parent of every class that defines a set of editable properties
 
 #include "Pegasus/PropertyGrid/PropertyGridObject.h"
+#include "Pegasus/PropertyGrid/PropertyLayout.h"
+#include "Pegasus/Core/Atomic.h"
 #include "Pegasus/AssetLib/Asset.h"
 #include "Pegasus/AssetLib/ASTree.h"
 #include "Pegasus/Utils/Memcpy.h"
@@ -39,6 +41,16 @@ void PropertyReadAccessor::Read(void * outputBuffer, unsigned int outputBufferSi
 //----------------------------------------------------------------------------------------
 
 void PropertyAccessor::Write(const void * inputBuffer, unsigned int inputBufferSize) const
+{
+    if (WriteWithoutNotification(inputBuffer, inputBufferSize))
+    {
+        NotifyPropertyChanged();
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+bool PropertyAccessor::WriteWithoutNotification(const void * inputBuffer, unsigned int inputBufferSize) const
 {
     PG_ASSERTSTR(inputBuffer != nullptr, "Trying to write a property from a null buffer.");
     PG_ASSERTSTR(inputBufferSize > 0, "Trying to write a property from a buffer with an undefined size.");
@@ -46,12 +58,22 @@ void PropertyAccessor::Write(const void * inputBuffer, unsigned int inputBufferS
     PG_ASSERTSTR(inputBufferSize == mSize, "Trying to write a property from a buffer whose size is incorrect.");
 #endif
 
+    // Writes that change nothing do not invalidate the property grid
+    const unsigned char * inputBytes = static_cast<const unsigned char *>(inputBuffer);
+    const unsigned char * propertyBytes = static_cast<const unsigned char *>(mPtr);
+    unsigned int b = 0;
+    while (b < inputBufferSize && inputBytes[b] == propertyBytes[b])
+    {
+        ++b;
+    }
+    if (b == inputBufferSize)
+    {
+        return false;
+    }
+
     //! \todo Use a fast memcpy function that always take the fast path
     Utils::Memcpy(mPtr, inputBuffer, inputBufferSize);
-
-    PEGASUS_EVENT_DISPATCH(mObj, ValueChangedEventIndexed, mCategory, mIndex);
-
-    mObj->InvalidatePropertyGrid();
+    return true;
 }
 
 //----------------------------------------------------------------------------------------
@@ -65,6 +87,12 @@ END_IMPLEMENT_PROPERTIES(PropertyGridObject)
 PropertyGridObject::PropertyGridObject()
 :   mClassPropertyPointers(Memory::GetPropertyPointerAllocator())
 ,   mPropertyGridDirty(true)
+,   mPropertyBatchDepth(0)
+,   mPropertyLock(0)
+#if PEGASUS_USE_EVENTS
+,   mBatchedClassProperties(Memory::GetPropertyPointerAllocator())
+,   mBatchedObjectProperties(Memory::GetPropertyPointerAllocator())
+#endif
 #if PEGASUS_ENABLE_PROPGRID_SAFE_ACCESSOR
 ,   mClassPropertySizes(Memory::GetPropertyPointerAllocator())
 #endif
@@ -280,6 +308,10 @@ void PropertyGridObject::RemoveObjectProperty(unsigned int index)
         PG_DELETE_ARRAY(Memory::GetPropertyPointerAllocator(), mObjectProperties[index].record.name);
         PG_DELETE_ARRAY(Memory::GetPropertyPointerAllocator(), mObjectProperties[index].valuePtr);
         mObjectProperties.Delete(index);
+#if PEGASUS_USE_EVENTS
+        // The indices after the removed property change, the layout change event replaces the batched ones
+        mBatchedObjectProperties.Clear();
+#endif
 
         //notify the editor that the layout of this object has changed
         PEGASUS_EVENT_DISPATCH(this, ObjectPropertiesLayoutChanged);
@@ -297,9 +329,110 @@ void PropertyGridObject::ClearObjectProperties()
     for (unsigned int p = 0; p < mObjectProperties.GetSize(); ++p)
     {
         PG_DELETE_ARRAY(Memory::GetPropertyPointerAllocator(), mObjectProperties[p].record.defaultValuePtr);
+        PG_DELETE_ARRAY(Memory::GetPropertyPointerAllocator(), mObjectProperties[p].record.name);
         PG_DELETE_ARRAY(Memory::GetPropertyPointerAllocator(), mObjectProperties[p].valuePtr);
     }
     mObjectProperties.Clear();
+#if PEGASUS_USE_EVENTS
+    mBatchedObjectProperties.Clear();
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+
+void PropertyGridObject::NotifyPropertyChanged(PropertyCategory category, int index)
+{
+    InvalidatePropertyGrid();
+
+#if PEGASUS_USE_EVENTS
+    if (mPropertyBatchDepth == 0)
+    {
+        PEGASUS_EVENT_DISPATCH(this, ValueChangedEventIndexed, category, index);
+    }
+    else if (index >= 0)
+    {
+        // Only mark the property, the event is sent once when the batch ends
+        Utils::Vector<unsigned int>& batchedProperties = (category == PROPERTYCATEGORY_CLASS) ? mBatchedClassProperties : mBatchedObjectProperties;
+        const unsigned int word = static_cast<unsigned int>(index) >> 5;
+        while (batchedProperties.GetSize() <= word)
+        {
+            batchedProperties.PushEmpty() = 0;
+        }
+        batchedProperties[word] |= 1u << (index & 31);
+    }
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+
+void PropertyGridObject::BeginPropertyBatch()
+{
+    ++mPropertyBatchDepth;
+}
+
+//----------------------------------------------------------------------------------------
+
+void PropertyGridObject::EndPropertyBatch()
+{
+    PG_ASSERTSTR(mPropertyBatchDepth > 0, "Ending a property batch that has not been started");
+    if (mPropertyBatchDepth <= 0 || --mPropertyBatchDepth > 0)
+    {
+        return;
+    }
+
+#if PEGASUS_USE_EVENTS
+    // One event per changed property, however many times it was written during the batch
+    for (unsigned int w = 0; w < mBatchedClassProperties.GetSize(); ++w)
+    {
+        for (unsigned int bits = mBatchedClassProperties[w]; bits != 0; bits &= bits - 1)
+        {
+            int bit = 0;
+            while (((bits >> bit) & 1) == 0)
+            {
+                ++bit;
+            }
+            PEGASUS_EVENT_DISPATCH(this, ValueChangedEventIndexed, PROPERTYCATEGORY_CLASS, static_cast<int>(w * 32 + bit));
+        }
+    }
+    for (unsigned int w = 0; w < mBatchedObjectProperties.GetSize(); ++w)
+    {
+        for (unsigned int bits = mBatchedObjectProperties[w]; bits != 0; bits &= bits - 1)
+        {
+            int bit = 0;
+            while (((bits >> bit) & 1) == 0)
+            {
+                ++bit;
+            }
+            PEGASUS_EVENT_DISPATCH(this, ValueChangedEventIndexed, PROPERTYCATEGORY_OBJECT, static_cast<int>(w * 32 + bit));
+        }
+    }
+    mBatchedClassProperties.Clear();
+    mBatchedObjectProperties.Clear();
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+
+void PropertyGridObject::LockProperties() const
+{
+    Core::SpinBackoff backoff;
+    while (Core::AtomicCompareExchange(&mPropertyLock, 1, 0) != 0)
+    {
+        // Wait for the holder to release the lock before trying again. It only copies a value,
+        // so pause first, and yield only if the holder got preempted
+        do
+        {
+            backoff.Wait();
+        }
+        while (mPropertyLock != 0);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void PropertyGridObject::UnlockProperties() const
+{
+    Core::AtomicExchange(&mPropertyLock, 0);
 }
 
 //----------------------------------------------------------------------------------------
@@ -529,18 +662,11 @@ void PropertyGridObject::WriteToObject(AssetLib::Asset* parentAsset, AssetLib::O
 //----------------------------------------------------------------------------------------
 
 template<class C, int D>
-bool ReadVector(PropertyAccessor& a, const char* name, const AssetLib::Object* object)
+static void ReadVector(PropertyAccessor& a, const AssetLib::Array* arr)
 {
-    int index = object->FindArray(name);
-    if (index == -1)
-    {
-        return false;
-    }
-
-    AssetLib::Array* arr = object->GetArray(index);
     if (arr->GetType() != AssetLib::Array::AS_TYPE_FLOAT && arr->GetSize() != D)
     {
-        return false;
+        return;
     }
 
     C c;
@@ -550,24 +676,16 @@ bool ReadVector(PropertyAccessor& a, const char* name, const AssetLib::Object* o
     }
 
     a.Set<C>(c);
-    return true;
 }
 
 //----------------------------------------------------------------------------------------
 
 template<class C, int D>
-bool ReadColor(PropertyAccessor& a, const char* name, const AssetLib::Object* object)
+static void ReadColor(PropertyAccessor& a, const AssetLib::Array* arr)
 {
-    int index = object->FindArray(name);
-    if (index == -1)
-    {
-        return false;
-    }
-
-    AssetLib::Array* arr = object->GetArray(index);
     if (arr->GetType() != AssetLib::Array::AS_TYPE_INT && arr->GetSize() != D)
     {
-        return false;
+        return;
     }
 
     C c;
@@ -577,86 +695,97 @@ bool ReadColor(PropertyAccessor& a, const char* name, const AssetLib::Object* ob
     }
 
     a.Set<C>(c);
-    return true;
 }
 
-
 //----------------------------------------------------------------------------------------
 
-static void ReadProperty(const AssetLib::Asset* parentAsset, const PropertyRecord& r, PropertyAccessor& a, const AssetLib::Object* obj)
+void PropertyGridObject::ReadPropertyBlocks(const AssetLib::Object* obj, const PropertyLayout& layout, PropertyCategory category)
 {
-        switch(r.type)
+    // Each block is walked backwards, so when a name is repeated the first value is the one kept,
+    // as it was when every property looked up its name
+    for (int i = obj->GetIntCount() - 1; i >= 0; --i)
+    {
+        const int p = layout.Find(obj->GetIntName(i));
+        if (p == -1) continue;
+        const PropertyRecord& r = category == PROPERTYCATEGORY_CLASS ? GetClassPropertyRecord(p) : GetObjectPropertyRecord(p);
+        PropertyAccessor a = category == PROPERTYCATEGORY_CLASS ? GetClassPropertyAccessor(p) : GetObjectPropertyAccessor(p);
+        switch (r.type)
         {
         case PROPERTYTYPE_BOOL:
-            {
-                int index = obj->FindInt(r.name);
-                if (index == -1) return;
-                a.Set<bool>(obj->GetInt(index) != 0);
-            }
+            a.Set<bool>(obj->GetInt(i) != 0);
             break;
         case PROPERTYTYPE_UINT:
-            {
-                int index = obj->FindInt(r.name);
-                if (index == -1) return;
-                a.Set<unsigned int>(static_cast<unsigned int>(obj->GetInt(index)));
-            }
+            a.Set<unsigned int>(static_cast<unsigned int>(obj->GetInt(i)));
             break;
         case PROPERTYTYPE_INT:
-            {
-                int index = obj->FindInt(r.name);
-                if (index == -1) return;
-                a.Set<int>(obj->GetInt(index));
-            }
+            a.Set<int>(obj->GetInt(i));
             break;
-        case PROPERTYTYPE_FLOAT:
-            {
-                int index = obj->FindFloat(r.name);
-                if (index == -1) return;
-                a.Set<float>(obj->GetFloat(index));
-            }
+        default:
             break;
+        }
+    }
+
+    for (int i = obj->GetFloatCount() - 1; i >= 0; --i)
+    {
+        const int p = layout.Find(obj->GetFloatName(i));
+        if (p == -1) continue;
+        const PropertyRecord& r = category == PROPERTYCATEGORY_CLASS ? GetClassPropertyRecord(p) : GetObjectPropertyRecord(p);
+        if (r.type == PROPERTYTYPE_FLOAT)
+        {
+            PropertyAccessor a = category == PROPERTYCATEGORY_CLASS ? GetClassPropertyAccessor(p) : GetObjectPropertyAccessor(p);
+            a.Set<float>(obj->GetFloat(i));
+        }
+    }
+
+    for (int i = obj->GetStringCount() - 1; i >= 0; --i)
+    {
+        const int p = layout.Find(obj->GetStringName(i));
+        if (p == -1) continue;
+        const PropertyRecord& r = category == PROPERTYCATEGORY_CLASS ? GetClassPropertyRecord(p) : GetObjectPropertyRecord(p);
+        const char* str = obj->GetString(i);
+        const int len = Utils::Strlen(str);
+        if (r.type == PROPERTYTYPE_STRING64 && len < 64)
+        {
+            PropertyAccessor a = category == PROPERTYCATEGORY_CLASS ? GetClassPropertyAccessor(p) : GetObjectPropertyAccessor(p);
+            char tempString[64];
+            Utils::Memset8(tempString, 0, sizeof(tempString));
+            Utils::Memcpy(tempString, str, len + 1);
+            a.Write(tempString, 64);
+        }
+    }
+
+    for (int i = obj->GetArrayCount() - 1; i >= 0; --i)
+    {
+        const int p = layout.Find(obj->GetArrayName(i));
+        if (p == -1) continue;
+        const PropertyRecord& r = category == PROPERTYCATEGORY_CLASS ? GetClassPropertyRecord(p) : GetObjectPropertyRecord(p);
+        PropertyAccessor a = category == PROPERTYCATEGORY_CLASS ? GetClassPropertyAccessor(p) : GetObjectPropertyAccessor(p);
+        const AssetLib::Array* arr = obj->GetArray(i);
+        switch (r.type)
+        {
         case PROPERTYTYPE_VEC2:
-            {
-                if (!ReadVector<Math::Vec2, 2>(a, r.name, obj)) return;
-            }
+            ReadVector<Math::Vec2, 2>(a, arr);
             break;
         case PROPERTYTYPE_VEC3:
-            {
-                if (!ReadVector<Math::Vec3, 3>(a, r.name, obj)) return;
-            }
+            ReadVector<Math::Vec3, 3>(a, arr);
             break;
         case PROPERTYTYPE_VEC4:
-            {
-                if (!ReadVector<Math::Vec4, 4>(a, r.name, obj)) return;
-            }
+            ReadVector<Math::Vec4, 4>(a, arr);
             break;
         case PROPERTYTYPE_COLOR8RGB:
-            {
-                if (!ReadColor<Math::Color8RGB, 3>(a, r.name, obj)) return;
-            }
+            ReadColor<Math::Color8RGB, 3>(a, arr);
             break;
         case PROPERTYTYPE_COLOR8RGBA:
-            {
-                if (!ReadColor<Math::Color8RGBA, 4>(a, r.name, obj)) return;
-            }
+            ReadColor<Math::Color8RGBA, 4>(a, arr);
             break;
-        case PROPERTYTYPE_STRING64:
-            {
-                int index = obj->FindString(r.name);
-                if (index == -1) return;
-                const char* str = obj->GetString(index); 
-                int len = Utils::Strlen(str);
-                if (len < 64)
-                {
-                    char tempString[64];
-                    Utils::Memcpy(tempString, str, len + 1);
-                    a.Write(str, 64);
-                }
-            }
+        default:
             break;
         }
+    }
 }
 
+//----------------------------------------------------------------------------------------
+
 static const char* CopyString(Memory::BlockAllocator& ba, const char* str)
 {
     unsigned toAlloc = Utils::Strlen(str) + 1;
@@ -669,12 +798,8 @@ bool PropertyGridObject::ReadFromObject(const AssetLib::Asset* parentAsset, cons
 {
     mStringAllocator.Reset(); //for strings that will be copied.
 
-    for (unsigned int i = 0; i < GetNumClassProperties(); ++i)
-    {
-        const PropertyRecord& r = GetClassPropertyRecord(i);
-        PropertyAccessor a = GetClassPropertyAccessor(i);
-        ReadProperty(parentAsset,r,a,obj);
-    }
+    // The layout of the class is compiled already, values are mapped to the class properties in a single pass
+    ReadPropertyBlocks(obj, GetClassInfo()->GetClassLayout(), PROPERTYCATEGORY_CLASS);
 
     char str64[64];
     Utils::Memset32(str64, 0x0,sizeof(str64));
@@ -720,12 +845,14 @@ bool PropertyGridObject::ReadFromObject(const AssetLib::Asset* parentAsset, cons
                 AddObjectProperty(propTypeEnum, typeSize, CopyString(mStringAllocator, elName.s), CopyString(mStringAllocator, elTypeName.s), str64);
             }
 
+            // The schema gives the layout of the object properties, mapped the same way as the class properties
+            PropertyLayout objectLayout(Memory::GetPropertyPointerAllocator());
+            objectLayout.Reset(GetNumObjectProperties());
             for (unsigned int i = 0; i < GetNumObjectProperties(); ++i)
             {
-                const PropertyRecord& r = GetObjectPropertyRecord(i);
-                PropertyAccessor a = GetObjectPropertyAccessor(i);
-                ReadProperty(parentAsset, r, a, objPropObj);
+                objectLayout.Add(GetObjectPropertyRecord(i).name, static_cast<int>(i));
             }
+            ReadPropertyBlocks(objPropObj, objectLayout, PROPERTYCATEGORY_OBJECT);
         }
     }
 
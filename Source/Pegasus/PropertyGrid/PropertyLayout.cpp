@@ -0,0 +1,112 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file	PropertyLayout.cpp
+//! \author	Kleber Garcia
+//! \date	October 18th 2026
+//! \brief	Hashed table of property names, mapping a name to the index of its property
+
+#include "Pegasus/PropertyGrid/PropertyLayout.h"
+#include "Pegasus/Allocator/IAllocator.h"
+#include "Pegasus/Allocator/Alloc.h"
+#include "Pegasus/Core/Assertion.h"
+#include "Pegasus/Utils/String.h"
+
+namespace Pegasus {
+namespace PropertyGrid {
+
+
+PropertyLayout::PropertyLayout(Alloc::IAllocator * allocator)
+:   mAllocator(allocator)
+,   mSlots(nullptr)
+,   mCapacity(0)
+,   mCount(0)
+{
+}
+
+//----------------------------------------------------------------------------------------
+
+PropertyLayout::~PropertyLayout()
+{
+    if (mSlots != nullptr)
+    {
+        PG_DELETE_ARRAY(mAllocator, mSlots);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void PropertyLayout::Reset(unsigned int nameCount)
+{
+    // Keep the table at most half full, so the probe sequences stay short
+    unsigned int capacity = 8;
+    while (capacity < nameCount * 2)
+    {
+        capacity <<= 1;
+    }
+
+    if (capacity > mCapacity)
+    {
+        if (mSlots != nullptr)
+        {
+            PG_DELETE_ARRAY(mAllocator, mSlots);
+        }
+        mSlots = PG_NEW_ARRAY(mAllocator, -1, "PropertyLayout::Slots", Pegasus::Alloc::PG_MEM_PERM, Slot, capacity);
+        mCapacity = capacity;
+    }
+
+    for (unsigned int s = 0; s < mCapacity; ++s)
+    {
+        mSlots[s].name = nullptr;
+    }
+    mCount = 0;
+}
+
+//----------------------------------------------------------------------------------------
+
+void PropertyLayout::Add(const char * name, int index)
+{
+    PG_ASSERTSTR(name != nullptr, "Trying to add a property without name to a property layout");
+    PG_ASSERTSTR((mCount + 1) * 2 <= mCapacity, "The property layout is full, Reset() has to be called with the number of names");
+
+    const unsigned int hash = Utils::HashStr(name);
+    const unsigned int mask = mCapacity - 1;
+    unsigned int s = hash & mask;
+    while (mSlots[s].name != nullptr)
+    {
+        s = (s + 1) & mask;
+    }
+
+    mSlots[s].name = name;
+    mSlots[s].hash = hash;
+    mSlots[s].index = index;
+    ++mCount;
+}
+
+//----------------------------------------------------------------------------------------
+
+int PropertyLayout::Find(const char * name) const
+{
+    if (mCount == 0)
+    {
+        return -1;
+    }
+
+    const unsigned int hash = Utils::HashStr(name);
+    const unsigned int mask = mCapacity - 1;
+    for (unsigned int s = hash & mask; mSlots[s].name != nullptr; s = (s + 1) & mask)
+    {
+        if (mSlots[s].hash == hash && Utils::Strcmp(mSlots[s].name, name) == 0)
+        {
+            return mSlots[s].index;
+        }
+    }
+    return -1;
+}
+
+
+}   // namespace PropertyGrid
+}   // namespace Pegasus
@@ -0,0 +1,338 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file	PropertySnapshot.cpp
+//! \author	Kleber Garcia
+//! \date	October 18th 2026
+//! \brief	Copy of the property values of a set of property grid objects at a point in time
+
+#include "Pegasus/PropertyGrid/PropertySnapshot.h"
+#include "Pegasus/PropertyGrid/PropertyGridObject.h"
+#include "Pegasus/Allocator/IAllocator.h"
+#include "Pegasus/Allocator/Alloc.h"
+#include "Pegasus/Core/Assertion.h"
+#include "Pegasus/Utils/Memcpy.h"
+
+namespace Pegasus {
+namespace PropertyGrid {
+
+
+//! Grows an array to hold at least a number of elements, keeping its content
+//! \param allocator Allocator of the array
+//! \param array Array to grow, nullptr when not allocated yet
+//! \param count Number of elements to keep
+//! \param capacity Current capacity, updated with the new one
+//! \param required Number of elements the array has to hold
+template <typename T>
+static void GrowArray(Alloc::IAllocator * allocator, T *& array, unsigned int count, unsigned int & capacity, unsigned int required)
+{
+    if (required > capacity)
+    {
+        unsigned int newCapacity = (capacity == 0) ? 16 : capacity;
+        while (newCapacity < required)
+        {
+            newCapacity <<= 1;
+        }
+
+        T * newArray = PG_NEW_ARRAY(allocator, -1, "PropertySnapshot", Pegasus::Alloc::PG_MEM_PERM, T, newCapacity);
+        if (array != nullptr)
+        {
+            Utils::Memcpy(newArray, array, count * sizeof(T));
+            PG_DELETE_ARRAY(allocator, array);
+        }
+        array = newArray;
+        capacity = newCapacity;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+PropertySnapshot::PropertySnapshot(Alloc::IAllocator * allocator)
+:   mAllocator(allocator)
+,   mData(nullptr)
+,   mDataSize(0)
+,   mDataCapacity(0)
+,   mEntries(nullptr)
+,   mNumEntries(0)
+,   mEntryCapacity(0)
+,   mSlots(nullptr)
+,   mSlotCapacity(0)
+,   mObjectSlots(nullptr)
+,   mNumObjects(0)
+,   mObjectSlotCapacity(0)
+{
+    PG_ASSERTSTR(allocator != nullptr, "Invalid allocator given to a property snapshot");
+}
+
+//----------------------------------------------------------------------------------------
+
+PropertySnapshot::~PropertySnapshot()
+{
+    if (mData != nullptr)
+    {
+        PG_DELETE_ARRAY(mAllocator, mData);
+    }
+    if (mEntries != nullptr)
+    {
+        PG_DELETE_ARRAY(mAllocator, mEntries);
+    }
+    if (mSlots != nullptr)
+    {
+        PG_DELETE_ARRAY(mAllocator, mSlots);
+    }
+    if (mObjectSlots != nullptr)
+    {
+        PG_DELETE_ARRAY(mAllocator, mObjectSlots);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void PropertySnapshot::Clear()
+{
+    for (unsigned int s = 0; s < mSlotCapacity; ++s)
+    {
+        mSlots[s] = -1;
+    }
+    for (unsigned int s = 0; s < mObjectSlotCapacity; ++s)
+    {
+        mObjectSlots[s] = nullptr;
+    }
+    mDataSize = 0;
+    mNumEntries = 0;
+    mNumObjects = 0;
+}
+
+//----------------------------------------------------------------------------------------
+
+void PropertySnapshot::Capture(const PropertyGridObject * object)
+{
+    PG_ASSERTSTR(object != nullptr, "Trying to capture an invalid property grid object in a snapshot");
+    if (IsCaptured(object))
+    {
+        return;
+    }
+
+    AddObject(object);
+
+    const unsigned int numClassProperties = object->GetNumClassProperties();
+    for (unsigned int p = 0; p < numClassProperties; ++p)
+    {
+        const PropertyReadAccessor accessor = object->GetClassReadPropertyAccessor(p);
+        AddProperty(accessor.GetAddress(), accessor.GetAddress(), static_cast<unsigned int>(object->GetClassPropertyRecord(p).size));
+    }
+
+    const unsigned int numObjectProperties = object->GetNumObjectProperties();
+    for (unsigned int p = 0; p < numObjectProperties; ++p)
+    {
+        const PropertyReadAccessor accessor = object->GetObjectReadPropertyAccessor(p);
+        AddProperty(accessor.GetAddress(), accessor.GetAddress(), static_cast<unsigned int>(object->GetObjectPropertyRecord(p).size));
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+bool PropertySnapshot::IsCaptured(const PropertyGridObject * object) const
+{
+    if (mNumObjects == 0)
+    {
+        return false;
+    }
+
+    const unsigned int mask = mObjectSlotCapacity - 1;
+    for (unsigned int s = HashAddress(object) & mask; mObjectSlots[s] != nullptr; s = (s + 1) & mask)
+    {
+        if (mObjectSlots[s] == object)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool PropertySnapshot::Read(const PropertyReadAccessor & accessor, void * outputBuffer, unsigned int outputBufferSize) const
+{
+    if (mNumEntries == 0)
+    {
+        return false;
+    }
+
+    const void * address = accessor.GetAddress();
+    const unsigned int mask = mSlotCapacity - 1;
+    for (unsigned int s = HashAddress(address) & mask; mSlots[s] != -1; s = (s + 1) & mask)
+    {
+        const Entry & entry = mEntries[mSlots[s]];
+        if (entry.address == address)
+        {
+            // A different size means the address now belongs to another property, not captured
+            if (entry.size != outputBufferSize)
+            {
+                return false;
+            }
+            Utils::Memcpy(outputBuffer, mData + entry.offset, outputBufferSize);
+            return true;
+        }
+    }
+    return false;
+}
+
+//----------------------------------------------------------------------------------------
+
+void PropertySnapshot::Write(const PropertyReadAccessor & accessor, const void * inputBuffer, unsigned int inputBufferSize)
+{
+    PG_ASSERTSTR(inputBuffer != nullptr, "Trying to write a property of a snapshot from a null buffer");
+
+    const void * address = accessor.GetAddress();
+    if (mNumEntries > 0)
+    {
+        const unsigned int mask = mSlotCapacity - 1;
+        for (unsigned int s = HashAddress(address) & mask; mSlots[s] != -1; s = (s + 1) & mask)
+        {
+            const Entry & entry = mEntries[mSlots[s]];
+            if (entry.address == address && entry.size == inputBufferSize)
+            {
+                Utils::Memcpy(mData + entry.offset, inputBuffer, inputBufferSize);
+                return;
+            }
+        }
+    }
+    AddProperty(address, inputBuffer, inputBufferSize);
+}
+
+//----------------------------------------------------------------------------------------
+
+void PropertySnapshot::AddProperty(const void * address, const void * value, unsigned int size)
+{
+    if (address == nullptr)
+    {
+        return;
+    }
+
+    // Keep the values aligned on 4 bytes, most properties are floats and vectors
+    const unsigned int offset = (mDataSize + 3) & ~3u;
+    GrowArray(mAllocator, mData, mDataSize, mDataCapacity, offset + size);
+    Utils::Memcpy(mData + offset, value, size);
+    mDataSize = offset + size;
+
+    GrowArray(mAllocator, mEntries, mNumEntries, mEntryCapacity, mNumEntries + 1);
+    Entry & entry = mEntries[mNumEntries];
+    entry.address = address;
+    entry.offset = offset;
+    entry.size = size;
+
+    // Keep the table at most half full, so the probe sequences stay short
+    if ((mNumEntries + 1) * 2 > mSlotCapacity)
+    {
+        GrowTable(mNumEntries + 1);
+    }
+    const unsigned int mask = mSlotCapacity - 1;
+    unsigned int s = HashAddress(address) & mask;
+    while (mSlots[s] != -1)
+    {
+        s = (s + 1) & mask;
+    }
+    mSlots[s] = static_cast<int>(mNumEntries);
+    ++mNumEntries;
+}
+
+//----------------------------------------------------------------------------------------
+
+void PropertySnapshot::GrowTable(unsigned int entryCount)
+{
+    unsigned int capacity = (mSlotCapacity == 0) ? 64 : mSlotCapacity;
+    while (capacity < entryCount * 2)
+    {
+        capacity <<= 1;
+    }
+
+    if (mSlots != nullptr)
+    {
+        PG_DELETE_ARRAY(mAllocator, mSlots);
+    }
+    mSlots = PG_NEW_ARRAY(mAllocator, -1, "PropertySnapshot::Slots", Pegasus::Alloc::PG_MEM_PERM, int, capacity);
+    mSlotCapacity = capacity;
+
+    const unsigned int mask = mSlotCapacity - 1;
+    for (unsigned int s = 0; s < mSlotCapacity; ++s)
+    {
+        mSlots[s] = -1;
+    }
+    for (unsigned int e = 0; e < mNumEntries; ++e)
+    {
+        unsigned int s = HashAddress(mEntries[e].address) & mask;
+        while (mSlots[s] != -1)
+        {
+            s = (s + 1) & mask;
+        }
+        mSlots[s] = static_cast<int>(e);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void PropertySnapshot::AddObject(const PropertyGridObject * object)
+{
+    // Keep the table at most half full, like the table of the properties
+    if ((mNumObjects + 1) * 2 > mObjectSlotCapacity)
+    {
+        unsigned int capacity = (mObjectSlotCapacity == 0) ? 64 : mObjectSlotCapacity;
+        while (capacity < (mNumObjects + 1) * 2)
+        {
+            capacity <<= 1;
+        }
+
+        const PropertyGridObject ** oldSlots = mObjectSlots;
+        const unsigned int oldCapacity = mObjectSlotCapacity;
+        mObjectSlots = PG_NEW_ARRAY(mAllocator, -1, "PropertySnapshot::ObjectSlots", Pegasus::Alloc::PG_MEM_PERM, const PropertyGridObject *, capacity);
+        mObjectSlotCapacity = capacity;
+        for (unsigned int s = 0; s < mObjectSlotCapacity; ++s)
+        {
+            mObjectSlots[s] = nullptr;
+        }
+
+        const unsigned int mask = mObjectSlotCapacity - 1;
+        for (unsigned int o = 0; o < oldCapacity; ++o)
+        {
+            if (oldSlots[o] != nullptr)
+            {
+                unsigned int s = HashAddress(oldSlots[o]) & mask;
+                while (mObjectSlots[s] != nullptr)
+                {
+                    s = (s + 1) & mask;
+                }
+                mObjectSlots[s] = oldSlots[o];
+            }
+        }
+        if (oldSlots != nullptr)
+        {
+            PG_DELETE_ARRAY(mAllocator, oldSlots);
+        }
+    }
+
+    const unsigned int mask = mObjectSlotCapacity - 1;
+    unsigned int s = HashAddress(object) & mask;
+    while (mObjectSlots[s] != nullptr)
+    {
+        s = (s + 1) & mask;
+    }
+    mObjectSlots[s] = object;
+    ++mNumObjects;
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int PropertySnapshot::HashAddress(const void * address)
+{
+    // Most properties are aligned on 4 bytes, the low bits carry little information
+    const unsigned long long a = reinterpret_cast<unsigned long long>(address) >> 2;
+    return static_cast<unsigned int>((a ^ (a >> 32)) * 2654435761u);
+}
+
+
+}   // namespace PropertyGrid
+}   // namespace Pegasus
@@ -0,0 +1,1637 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   CommandBuffer.cpp
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Deferred render command buffer, implementation.
+//!         Built with every backend, it only calls the render API.
+
+#include "Pegasus/Render/CommandBuffer.h"
+#include "Pegasus/Allocator/IAllocator.h"
+#include "Pegasus/Allocator/Alloc.h"
+#include "Pegasus/Memory/MemoryManager.h"
+#include "Pegasus/Utils/Memcpy.h"
+#include "Pegasus/Utils/Memset.h"
+#include "Pegasus/Utils/String.h"
+
+namespace Pegasus
+{
+namespace Render
+{
+
+//! Initial number of elements of the storage arrays
+static const unsigned int COMMAND_BUFFER_INITIAL_CAPACITY = 64;
+
+//! Largest sort ids, the key is 11 bits of program, 11 bits of mesh and 10 bits of material
+static const unsigned int COMMAND_BUFFER_MAX_PROGRAM_ID = 2047;
+static const unsigned int COMMAND_BUFFER_MAX_MESH_ID = 2047;
+static const unsigned int COMMAND_BUFFER_MAX_MATERIAL_ID = 1023;
+
+//! Segments up to this number of draws are sorted by insertion, larger ones by radix
+static const unsigned int COMMAND_BUFFER_INSERTION_SORT_MAX = 32;
+
+//! Sizes of the caches of the submission. Bindings not fitting in the caches are always submitted.
+static const int APPLIED_UPLOAD_COUNT = 64;
+static const int APPLIED_UNIFORM_COUNT = 64;
+static const int APPLIED_SAMPLER_SLOT_COUNT = 16;
+static const int APPLIED_COMPUTE_OUTPUT_COUNT = 8;
+
+//! Types of the recorded bindings
+enum BindingType
+{
+    BINDING_BUFFER_DATA,
+    BINDING_UNIFORM_TEXTURE,
+    BINDING_UNIFORM_BUFFER,
+    BINDING_UNIFORM_BUFFER_RESOURCE,
+    BINDING_UNIFORM_RENDER_TARGET,
+    BINDING_UNIFORM_DEPTH,
+    BINDING_UNIFORM_STENCIL,
+    BINDING_UNIFORM_CUBE_MAP,
+    BINDING_UNIFORM_VOLUME,
+    BINDING_SAMPLER,
+    BINDING_COMPUTE_OUTPUT_BUFFER,
+    BINDING_COMPUTE_OUTPUT_VOLUME,
+    BINDING_COMPUTE_OUTPUT_RENDER_TARGET
+};
+
+//! Types of the recorded draws
+enum PacketType
+{
+    PACKET_DRAW,
+    PACKET_DRAW_INSTANCED,
+    PACKET_DRAW_LOD,
+    PACKET_DISPATCH
+};
+
+//! Types of the recorded pass commands
+enum PassType
+{
+    PASS_VIEWPORT,
+    PASS_VIEWPORT_RENDER_TARGET,
+    PASS_VIEWPORT_DEPTH_STENCIL,
+    PASS_RENDER_TARGETS,
+    PASS_UNBIND_RENDER_TARGETS,
+    PASS_DEFAULT_RENDER_TARGET,
+    PASS_CLEAR,
+    PASS_CLEAR_COLOR,
+    PASS_DEPTH_CLEAR_VALUE,
+    PASS_CLEAN_INTERNAL_STATE,
+    PASS_UNBIND_COMPUTE_OUTPUTS,
+    PASS_UNBIND_COMPUTE_RESOURCES,
+    PASS_UNBIND_PIXEL_RESOURCES,
+    PASS_UNBIND_VERTEX_RESOURCES,
+    PASS_GENERATE_MIPS_RENDER_TARGET,
+    PASS_GENERATE_MIPS_CUBE_MAP,
+    PASS_BEGIN_MARKER,
+    PASS_END_MARKER
+};
+
+struct CommandBuffer::Binding
+{
+    int mType;                      //!< BindingType
+    int mSlot;                      //!< Sampler or compute output slot, offset of a buffer write
+    int mStage;                     //!< Shader stage of a sampler
+    int mSize;                      //!< Size of a buffer write
+    unsigned int mDataOffset;       //!< Offset of the data of a buffer write in the buffer data
+    Core::RefCounted * mResource;   //!< Bound resource, retained by the buffer
+    Uniform mUniform;               //!< Copy of the uniform of a uniform binding
+    Shader::ProgramLinkage * mProgram;  //!< Program current when the uniform was set, nullptr for the other bindings
+};
+
+struct CommandBuffer::Packet
+{
+    int mType;                      //!< PacketType
+    unsigned int mArgs[3];          //!< Instance count or thread group counts
+    float mScreenSize;              //!< Screen size of a level of detail draw
+    unsigned int mSegment;          //!< Draws of the same segment can be sorted
+    unsigned int mKey;              //!< Sort key, program, mesh and material ids
+    Shader::ProgramLinkage * mProgram;
+    Mesh::Mesh * mMesh;
+    RasterizerState * mRasterState;
+    unsigned int mStencilRefValue;
+    bool mHasStencilRefValue;
+    BlendingState * mBlendState;
+    int mPrimitiveMode;             //!< PrimitiveMode, -1 if never set
+    unsigned int mFirstBinding;     //!< Range of the snapshot of the bindings
+    unsigned int mBindingCount;
+};
+
+struct CommandBuffer::Pass
+{
+    int mType;                      //!< PassType
+    unsigned int mPacketIndex;      //!< Number of packets recorded before the pass
+    int mArgs[4];                   //!< Viewport, target count, clear flags
+    float mValues[4];               //!< Clear color or depth
+    Core::RefCounted * mResources[Constants::MAX_RENDER_TARGETS + 1];   //!< Targets then depth stencil, or the resource of the command
+    unsigned int mDataOffset;       //!< Offset of the name of a marker in the buffer data
+};
+
+struct CommandBuffer::Material
+{
+    const RasterizerState * mRasterState;
+    const BlendingState * mBlendState;
+    unsigned int mStencilRefValue;
+};
+
+//! State that is current in the render API during a submission
+struct CommandBuffer::AppliedState
+{
+    //! Last upload of a buffer range
+    struct Upload
+    {
+        const Buffer * mBuffer;
+        int mOffset;
+        int mSize;
+        const char * mData;
+    };
+
+    //! Last resource bound to a uniform of the current program
+    struct UniformBinding
+    {
+        int mType;
+        int mIndex;
+        int mOwner;
+        const Core::RefCounted * mResource;
+    };
+
+    bool mProgramKnown;
+    const Shader::ProgramLinkage * mProgram;
+    bool mMeshKnown;
+    const Mesh::Mesh * mMesh;
+    bool mRasterKnown;
+    const RasterizerState * mRasterState;
+    unsigned int mStencilRefValue;
+    bool mHasStencilRefValue;
+    bool mBlendKnown;
+    const BlendingState * mBlendState;
+    int mPrimitiveMode;
+
+    Upload mUploads[APPLIED_UPLOAD_COUNT];
+    int mUploadCount;
+    UniformBinding mUniforms[APPLIED_UNIFORM_COUNT];
+    int mUniformCount;
+    const Core::RefCounted * mSamplers[3][APPLIED_SAMPLER_SLOT_COUNT];
+    const Core::RefCounted * mComputeOutputs[APPLIED_COMPUTE_OUTPUT_COUNT];
+
+    //! Counters of the buffer being submitted
+    CommandBufferStats * mStats;
+
+    AppliedState() : mStats(nullptr)
+    {
+        Invalidate();
+    }
+
+    //! Forget the whole state, the next draw sets everything
+    void Invalidate()
+    {
+        mProgramKnown = false;
+        mProgram = nullptr;
+        mMeshKnown = false;
+        mMesh = nullptr;
+        mRasterKnown = false;
+        mRasterState = nullptr;
+        mStencilRefValue = 0;
+        mHasStencilRefValue = false;
+        mBlendKnown = false;
+        mBlendState = nullptr;
+        mPrimitiveMode = -1;
+        mUploadCount = 0;
+        mUniformCount = 0;
+        Utils::Memset32(mSamplers, 0, sizeof(mSamplers));
+        Utils::Memset32(mComputeOutputs, 0, sizeof(mComputeOutputs));
+    }
+
+    //! Forget the uniform resources, keeping the uniform buffers
+    void InvalidateUniformResources()
+    {
+        int kept = 0;
+        for (int u = 0; u < mUniformCount; ++u)
+        {
+            if (mUniforms[u].mType == BINDING_UNIFORM_BUFFER)
+            {
+                mUniforms[kept++] = mUniforms[u];
+            }
+        }
+        mUniformCount = kept;
+    }
+
+    void Submitted() { ++mStats->mSubmittedCommandCount; }
+    void Filtered() { ++mStats->mFilteredCommandCount; }
+};
+
+//----------------------------------------------------------------------------------------
+
+//! Get the pointer of a reference without changing its reference count
+template <class C>
+static inline C * GetPointer(const Core::Ref<C> & ref)
+{
+    return const_cast<C *>(static_cast<const C *>(ref));
+}
+
+//! Compare two blocks of bytes
+static bool DataEquals(const char * a, const char * b, int size)
+{
+    int i = 0;
+    for (; i + 4 <= size; i += 4)
+    {
+        if (*reinterpret_cast<const int *>(a + i) != *reinterpret_cast<const int *>(b + i))
+        {
+            return false;
+        }
+    }
+    for (; i < size; ++i)
+    {
+        if (a[i] != b[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//! Test if a binding is a uniform
+static inline bool IsUniformBinding(int type)
+{
+    return type >= BINDING_UNIFORM_TEXTURE && type <= BINDING_UNIFORM_VOLUME;
+}
+
+//! Test if a binding is a compute output
+static inline bool IsComputeOutputBinding(int type)
+{
+    return type >= BINDING_COMPUTE_OUTPUT_BUFFER;
+}
+
+//! Get the index of the samplers of a shader stage in the submission cache
+static inline int GetSamplerStageIndex(int stage)
+{
+    return stage == Shader::COMPUTE ? 0 : (stage == Shader::FRAGMENT ? 1 : 2);
+}
+
+//----------------------------------------------------------------------------------------
+
+template <class T>
+T & CommandBuffer::Storage<T>::Push(Alloc::IAllocator * allocator)
+{
+    return *PushArray(allocator, 1);
+}
+
+//----------------------------------------------------------------------------------------
+
+template <class T>
+T * CommandBuffer::Storage<T>::PushArray(Alloc::IAllocator * allocator, unsigned int count)
+{
+    if (mCount + count > mCapacity)
+    {
+        unsigned int newCapacity = (mCapacity == 0) ? COMMAND_BUFFER_INITIAL_CAPACITY : mCapacity * 2;
+        while (newCapacity < mCount + count)
+        {
+            newCapacity *= 2;
+        }
+        T * newData = PG_NEW_ARRAY(allocator, -1, "CommandBuffer", Pegasus::Alloc::PG_MEM_PERM, T, newCapacity);
+        if (mData != nullptr)
+        {
+            Utils::Memcpy(newData, mData, mCount * sizeof(T));
+            PG_DELETE_ARRAY(allocator, mData);
+        }
+        mData = newData;
+        mCapacity = newCapacity;
+    }
+    T * elements = mData + mCount;
+    mCount += count;
+    return elements;
+}
+
+//----------------------------------------------------------------------------------------
+
+template <class T>
+void CommandBuffer::Storage<T>::Free(Alloc::IAllocator * allocator)
+{
+    if (mData != nullptr)
+    {
+        PG_DELETE_ARRAY(allocator, mData);
+    }
+    mData = nullptr;
+    mCount = 0;
+    mCapacity = 0;
+}
+
+//----------------------------------------------------------------------------------------
+
+template <class T>
+void CommandBuffer::Storage<T>::Remove(unsigned int index)
+{
+    PG_ASSERT(index < mCount);
+    for (unsigned int i = index + 1; i < mCount; ++i)
+    {
+        mData[i - 1] = mData[i];
+    }
+    --mCount;
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Test if the draws using a rasterizer state depend on their order.
+//! Without depth test, with a depth test passing on equal depths, or with stencil writes,
+//! the result of two overlapping draws changes when they are swapped. The draws without
+//! rasterizer state inherit the state of the previous draw, so they keep their order too.
+//! \param rasterState Rasterizer state of the draws, can be nullptr
+//! \return True if the draws keep their recording order
+static bool IsOrderDependent(const RasterizerState * rasterState)
+{
+    if (rasterState == nullptr)
+    {
+        return true;
+    }
+
+    const RasterizerConfig & config = rasterState->GetConfig();
+    const bool strictDepthTest = (config.mDepthFunc == RasterizerConfig::LESSER_DF)
+                              || (config.mDepthFunc == RasterizerConfig::GREATER_DF)
+                              || (config.mDepthFunc == RasterizerConfig::NEVER_DF);
+    const bool stencilWrites = (config.mStencilFunc != RasterizerConfig::NONE_DF)
+                            && (config.mStencilWriteMask != 0)
+                            && (config.mStencilFailOp != RasterizerConfig::KEEP_SO
+                                || config.mStencilDepthFailOp != RasterizerConfig::KEEP_SO
+                                || config.mStencilPassOp != RasterizerConfig::KEEP_SO);
+    return !strictDepthTest || stencilWrites;
+}
+
+//----------------------------------------------------------------------------------------
+
+CommandBuffer::CommandBuffer(Alloc::IAllocator * allocator)
+:   mAllocator(allocator != nullptr ? allocator : Memory::GetRenderAllocator())
+,   mSortDraws(true)
+{
+    Reset();
+}
+
+//----------------------------------------------------------------------------------------
+
+CommandBuffer::~CommandBuffer()
+{
+    Reset();
+    mBindingSet.Free(mAllocator);
+    mPackets.Free(mAllocator);
+    mPasses.Free(mAllocator);
+    mBindingSnapshots.Free(mAllocator);
+    mData.Free(mAllocator);
+    mRetained.Free(mAllocator);
+    mProgramIds.Free(mAllocator);
+    mMeshIds.Free(mAllocator);
+    mMaterials.Free(mAllocator);
+    mOrder.Free(mAllocator);
+    mSortTemp.Free(mAllocator);
+    mSortKeys.Free(mAllocator);
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::Reset()
+{
+    for (unsigned int r = 0; r < mRetained.mCount; ++r)
+    {
+        mRetained.mData[r]->Release();
+    }
+    mRetained.Clear();
+
+    mStats = CommandBufferStats();
+    mProgram = nullptr;
+    mMesh = nullptr;
+    mRasterState = nullptr;
+    mStencilRefValue = 0;
+    mHasStencilRefValue = false;
+    mRasterOrdered = true;
+    mBlendState = nullptr;
+    mBlendEnabled = false;
+    mPrimitiveMode = -1;
+    mSegment = 0;
+
+    mBindingSet.Clear();
+    mBindingSetDirty = false;
+    mSnapshotFirst = 0;
+    mSnapshotCount = 0;
+
+    mPackets.Clear();
+    mPasses.Clear();
+    mBindingSnapshots.Clear();
+    mData.Clear();
+    mProgramIds.Clear();
+    mMeshIds.Clear();
+    mMaterials.Clear();
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::Retain(Core::RefCounted * object)
+{
+    if (object != nullptr)
+    {
+        object->AddRef();
+        mRetained.Push(mAllocator) = object;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int CommandBuffer::CopyData(const void * src, unsigned int size)
+{
+    const unsigned int padding = (16 - (mData.mCount & 15)) & 15;
+    char * dst = mData.PushArray(mAllocator, padding + size) + padding;
+    Utils::Memcpy(dst, src, size);
+    return mData.mCount - size;
+}
+
+//----------------------------------------------------------------------------------------
+
+CommandBuffer::Pass & CommandBuffer::PushPass(int type)
+{
+    ++mStats.mRecordedCommandCount;
+    ++mSegment;
+    Pass & pass = mPasses.Push(mAllocator);
+    Utils::Memset32(&pass, 0, sizeof(Pass));
+    pass.mType = type;
+    pass.mPacketIndex = mPackets.mCount;
+    return pass;
+}
+
+//----------------------------------------------------------------------------------------
+
+CommandBuffer::Packet & CommandBuffer::PushPacket(int type)
+{
+    ++mStats.mRecordedCommandCount;
+    ++mStats.mDrawCount;
+
+    if (mBindingSetDirty)
+    {
+        mSnapshotFirst = mBindingSnapshots.mCount;
+        mSnapshotCount = mBindingSet.mCount;
+        Binding * snapshot = mBindingSnapshots.PushArray(mAllocator, mBindingSet.mCount);
+        for (unsigned int b = 0; b < mBindingSet.mCount; ++b)
+        {
+            snapshot[b] = mBindingSet.mData[b];
+        }
+        mBindingSetDirty = false;
+    }
+
+    //dispatches, blended draws and draws whose depth or stencil result depends on the order
+    //get a segment of their own
+    const bool ordered = (type == PACKET_DISPATCH) || mBlendEnabled || mRasterOrdered;
+    if (ordered)
+    {
+        ++mSegment;
+    }
+
+    const unsigned int key = (GetSortId(mProgramIds, mProgram, COMMAND_BUFFER_MAX_PROGRAM_ID) << 21)
+                           | (GetSortId(mMeshIds, mMesh, COMMAND_BUFFER_MAX_MESH_ID) << 10)
+                           | GetMaterialId();
+
+    Packet & packet = mPackets.Push(mAllocator);
+    packet.mType = type;
+    packet.mArgs[0] = packet.mArgs[1] = packet.mArgs[2] = 0;
+    packet.mScreenSize = 0.0f;
+    packet.mSegment = mSegment;
+    packet.mKey = key;
+    packet.mProgram = mProgram;
+    packet.mMesh = mMesh;
+    packet.mRasterState = mRasterState;
+    packet.mStencilRefValue = mStencilRefValue;
+    packet.mHasStencilRefValue = mHasStencilRefValue;
+    packet.mBlendState = mBlendState;
+    packet.mPrimitiveMode = mPrimitiveMode;
+    packet.mFirstBinding = mSnapshotFirst;
+    packet.mBindingCount = mSnapshotCount;
+
+    if (ordered)
+    {
+        ++mSegment;
+    }
+    return packet;
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int CommandBuffer::GetSortId(Storage<const void *> & ids, const void * pointer, unsigned int maxId)
+{
+    //the same program or mesh is usually used by consecutive draws, search from the end
+    for (unsigned int i = ids.mCount; i > 0; --i)
+    {
+        if (ids.mData[i - 1] == pointer)
+        {
+            return i - 1;
+        }
+    }
+    if (ids.mCount < maxId)
+    {
+        ids.Push(mAllocator) = pointer;
+        return ids.mCount - 1;
+    }
+    return maxId;
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int CommandBuffer::GetMaterialId()
+{
+    const unsigned int stencilRefValue = mHasStencilRefValue ? mStencilRefValue : 0;
+    for (unsigned int i = mMaterials.mCount; i > 0; --i)
+    {
+        const Material & material = mMaterials.mData[i - 1];
+        if (material.mRasterState == mRasterState && material.mBlendState == mBlendState && material.mStencilRefValue == stencilRefValue)
+        {
+            return i - 1;
+        }
+    }
+    if (mMaterials.mCount < COMMAND_BUFFER_MAX_MATERIAL_ID)
+    {
+        Material & material = mMaterials.Push(mAllocator);
+        material.mRasterState = mRasterState;
+        material.mBlendState = mBlendState;
+        material.mStencilRefValue = stencilRefValue;
+        return mMaterials.mCount - 1;
+    }
+    return COMMAND_BUFFER_MAX_MATERIAL_ID;
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::SetBinding(const Binding & binding)
+{
+    mBindingSetDirty = true;
+    unsigned int b = 0;
+    while (b < mBindingSet.mCount)
+    {
+        Binding & current = mBindingSet.mData[b];
+        bool replaced = false;
+        bool overlapping = false;
+        if (binding.mType == BINDING_BUFFER_DATA)
+        {
+            if (current.mType == BINDING_BUFFER_DATA && current.mResource == binding.mResource)
+            {
+                replaced = (current.mSlot == binding.mSlot && current.mSize == binding.mSize);
+                overlapping = (current.mSlot < binding.mSlot + binding.mSize) && (binding.mSlot < current.mSlot + current.mSize);
+            }
+        }
+        else if (IsUniformBinding(binding.mType))
+        {
+            //a uniform of another program with the same name is bound to the same variable once rebound by name
+            replaced = IsUniformBinding(current.mType)
+                    && ((current.mUniform.mInternalIndex == binding.mUniform.mInternalIndex && current.mUniform.mInternalOwner == binding.mUniform.mInternalOwner)
+                        || !Utils::Strcmp(current.mUniform.mName, binding.mUniform.mName));
+        }
+        else if (binding.mType == BINDING_SAMPLER)
+        {
+            replaced = current.mType == BINDING_SAMPLER && current.mStage == binding.mStage && current.mSlot == binding.mSlot;
+        }
+        else
+        {
+            replaced = IsComputeOutputBinding(current.mType) && current.mSlot == binding.mSlot;
+        }
+
+        if (replaced)
+        {
+            current = binding;
+            return;
+        }
+        else if (overlapping)
+        {
+            //the new write covers a part of an older one, only the new one is replayed
+            mBindingSet.Remove(b);
+        }
+        else
+        {
+            ++b;
+        }
+    }
+    mBindingSet.Push(mAllocator) = binding;
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::RemoveBindings(bool uniformResourcesOnly)
+{
+    for (unsigned int b = mBindingSet.mCount; b > 0; --b)
+    {
+        const int type = mBindingSet.mData[b - 1].mType;
+        const bool remove = uniformResourcesOnly ? (IsUniformBinding(type) && type != BINDING_UNIFORM_BUFFER)
+                                                 : IsComputeOutputBinding(type);
+        if (remove)
+        {
+            mBindingSet.Remove(b - 1);
+            mBindingSetDirty = true;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+bool CommandBuffer::SetUniform(int type, Uniform& u, Core::RefCounted * resource)
+{
+    ++mStats.mRecordedCommandCount;
+
+    //as the render API, no binding without a program or with a uniform that was never located
+    if (mProgram == nullptr || resource == nullptr || u.mInternalIndex < 0)
+    {
+        return false;
+    }
+    Retain(resource);
+
+    Binding binding;
+    binding.mType = type;
+    binding.mSlot = 0;
+    binding.mStage = 0;
+    binding.mSize = 0;
+    binding.mDataOffset = 0;
+    binding.mResource = resource;
+    binding.mUniform = u;
+    binding.mProgram = mProgram;
+    SetBinding(binding);
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::SetSampler(int stage, SamplerStateRef& sampler, int slot)
+{
+    ++mStats.mRecordedCommandCount;
+    Core::RefCounted * resource = GetPointer(sampler);
+    Retain(resource);
+
+    Binding binding;
+    binding.mType = BINDING_SAMPLER;
+    binding.mSlot = slot;
+    binding.mStage = stage;
+    binding.mSize = 0;
+    binding.mDataOffset = 0;
+    binding.mResource = resource;
+    binding.mProgram = nullptr;
+    SetBinding(binding);
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::SetComputeOutputBinding(int type, Core::RefCounted * resource, int slot)
+{
+    ++mStats.mRecordedCommandCount;
+    Retain(resource);
+
+    Binding binding;
+    binding.mType = type;
+    binding.mSlot = slot;
+    binding.mStage = 0;
+    binding.mSize = 0;
+    binding.mDataOffset = 0;
+    binding.mResource = resource;
+    binding.mProgram = nullptr;
+    SetBinding(binding);
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::SetProgram(Shader::ProgramLinkageInOut program)
+{
+    ++mStats.mRecordedCommandCount;
+    Shader::ProgramLinkage * programPtr = GetPointer(program);
+    if (programPtr != mProgram)
+    {
+        //the uniforms stay bound, the draws of the new program rebind them by name on submission
+        Retain(programPtr);
+        mProgram = programPtr;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::SetMesh(Mesh::MeshInOut mesh)
+{
+    ++mStats.mRecordedCommandCount;
+    Mesh::Mesh * meshPtr = GetPointer(mesh);
+    if (meshPtr != mMesh)
+    {
+        Retain(meshPtr);
+        mMesh = meshPtr;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::UnbindMesh()
+{
+    ++mStats.mRecordedCommandCount;
+    mMesh = nullptr;
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::SetViewport(const Viewport& viewport)
+{
+    Pass & pass = PushPass(PASS_VIEWPORT);
+    pass.mArgs[0] = viewport.mXOffset;
+    pass.mArgs[1] = viewport.mYOffset;
+    pass.mArgs[2] = viewport.mWidth;
+    pass.mArgs[3] = viewport.mHeight;
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::SetViewport(const RenderTargetRef& renderTarget)
+{
+    Core::RefCounted * resource = GetPointer(renderTarget);
+    Retain(resource);
+    PushPass(PASS_VIEWPORT_RENDER_TARGET).mResources[0] = resource;
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::SetViewport(const DepthStencilRef& depthStencil)
+{
+    Core::RefCounted * resource = GetPointer(depthStencil);
+    Retain(resource);
+    PushPass(PASS_VIEWPORT_DEPTH_STENCIL).mResources[0] = resource;
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::SetRenderTarget(RenderTargetRef& renderTarget)
+{
+    SetRenderTargets(1, &renderTarget);
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::SetRenderTarget(RenderTargetRef& renderTarget, DepthStencilRef& depthStencil)
+{
+    SetRenderTargets(1, &renderTarget, depthStencil);
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::SetRenderTargets(int renderTargetCount, RenderTargetRef* renderTargets)
+{
+    DepthStencilRef noDepthStencil = nullptr;
+    SetRenderTargets(renderTargetCount, renderTargets, noDepthStencil);
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::SetRenderTargets(int renderTargetCount, RenderTargetRef* renderTargets, DepthStencilRef& depthStencil)
+{
+    PG_ASSERTSTR(renderTargetCount >= 0 && renderTargetCount <= Constants::MAX_RENDER_TARGETS, "Invalid render target count (%d)", renderTargetCount);
+    Pass & pass = PushPass(PASS_RENDER_TARGETS);
+    pass.mArgs[0] = renderTargetCount;
+    for (int t = 0; t < renderTargetCount && t < Constants::MAX_RENDER_TARGETS; ++t)
+    {
+        pass.mResources[t] = GetPointer(renderTargets[t]);
+        Retain(pass.mResources[t]);
+    }
+    pass.mResources[Constants::MAX_RENDER_TARGETS] = GetPointer(depthStencil);
+    Retain(pass.mResources[Constants::MAX_RENDER_TARGETS]);
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::UnbindRenderTargets()
+{
+    PushPass(PASS_UNBIND_RENDER_TARGETS);
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::DispatchDefaultRenderTarget()
+{
+    PushPass(PASS_DEFAULT_RENDER_TARGET);
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::Clear(bool color, bool depth, bool stencil)
+{
+    Pass & pass = PushPass(PASS_CLEAR);
+    pass.mArgs[0] = color ? 1 : 0;
+    pass.mArgs[1] = depth ? 1 : 0;
+    pass.mArgs[2] = stencil ? 1 : 0;
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::SetClearColorValue(const Math::ColorRGBA& col)
+{
+    Pass & pass = PushPass(PASS_CLEAR_COLOR);
+    pass.mValues[0] = col.red;
+    pass.mValues[1] = col.green;
+    pass.mValues[2] = col.blue;
+    pass.mValues[3] = col.alpha;
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::SetRasterizerState(const RasterizerStateRef& rasterState)
+{
+    ++mStats.mRecordedCommandCount;
+    mRasterState = GetPointer(rasterState);
+    Retain(mRasterState);
+    mRasterOrdered = IsOrderDependent(mRasterState);
+    mStencilRefValue = 0;
+    mHasStencilRefValue = false;
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::SetRasterizerState(const RasterizerStateRef& rasterState, unsigned int stencilRefValue)
+{
+    ++mStats.mRecordedCommandCount;
+    mRasterState = GetPointer(rasterState);
+    Retain(mRasterState);
+    mRasterOrdered = IsOrderDependent(mRasterState);
+    mStencilRefValue = stencilRefValue;
+    mHasStencilRefValue = true;
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::SetBlendingState(const BlendingStateRef blendingState)
+{
+    ++mStats.mRecordedCommandCount;
+    mBlendState = GetPointer(blendingState);
+    Retain(mBlendState);
+    mBlendEnabled = (mBlendState != nullptr) && (mBlendState->GetConfig().mBlendingOperator != BlendingConfig::NONE_BO);
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::SetDepthClearValue(float d)
+{
+    PushPass(PASS_DEPTH_CLEAR_VALUE).mValues[0] = d;
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::SetPrimitiveMode(PrimitiveMode mode)
+{
+    ++mStats.mRecordedCommandCount;
+    mPrimitiveMode = mode;
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::Draw()
+{
+    PushPacket(PACKET_DRAW);
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::DrawInstanced(unsigned int instanceCount)
+{
+    PushPacket(PACKET_DRAW_INSTANCED).mArgs[0] = instanceCount;
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::DrawLod(float screenSize)
+{
+    PushPacket(PACKET_DRAW_LOD).mScreenSize = screenSize;
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::SetBuffer(BufferRef& dstBuffer, const void * src, int size, int offset)
+{
+    ++mStats.mRecordedCommandCount;
+    Buffer * buffer = GetPointer(dstBuffer);
+    PG_ASSERTSTR(buffer != nullptr && src != nullptr, "Invalid buffer write recorded in a command buffer");
+    size = (size == -1) ? buffer->GetConfig().mSize : size;
+    Retain(buffer);
+
+    Binding binding;
+    binding.mType = BINDING_BUFFER_DATA;
+    binding.mSlot = offset;
+    binding.mStage = 0;
+    binding.mSize = size;
+    binding.mDataOffset = CopyData(src, static_cast<unsigned int>(size));
+    binding.mResource = buffer;
+    binding.mProgram = nullptr;
+    SetBinding(binding);
+}
+
+//----------------------------------------------------------------------------------------
+
+bool CommandBuffer::SetUniformTexture(Uniform& u, Texture::TextureInOut texture)
+{
+    return SetUniform(BINDING_UNIFORM_TEXTURE, u, GetPointer(texture));
+}
+
+//----------------------------------------------------------------------------------------
+
+bool CommandBuffer::SetUniformBuffer(Uniform& u, const BufferRef& buffer)
+{
+    return SetUniform(BINDING_UNIFORM_BUFFER, u, GetPointer(buffer));
+}
+
+//----------------------------------------------------------------------------------------
+
+bool CommandBuffer::SetUniformBufferResource(Uniform& u, const BufferRef& buffer)
+{
+    return SetUniform(BINDING_UNIFORM_BUFFER_RESOURCE, u, GetPointer(buffer));
+}
+
+//----------------------------------------------------------------------------------------
+
+bool CommandBuffer::SetUniformTextureRenderTarget(Uniform& u, const RenderTargetRef& renderTarget)
+{
+    return SetUniform(BINDING_UNIFORM_RENDER_TARGET, u, GetPointer(renderTarget));
+}
+
+//----------------------------------------------------------------------------------------
+
+bool CommandBuffer::SetUniformDepth(Uniform& u, const DepthStencilRef& depth)
+{
+    return SetUniform(BINDING_UNIFORM_DEPTH, u, GetPointer(depth));
+}
+
+//----------------------------------------------------------------------------------------
+
+bool CommandBuffer::SetUniformStencil(Uniform& u, const DepthStencilRef& stencil)
+{
+    return SetUniform(BINDING_UNIFORM_STENCIL, u, GetPointer(stencil));
+}
+
+//----------------------------------------------------------------------------------------
+
+bool CommandBuffer::SetUniformCubeMap(Uniform& u, CubeMapRef& cubeMap)
+{
+    return SetUniform(BINDING_UNIFORM_CUBE_MAP, u, GetPointer(cubeMap));
+}
+
+//----------------------------------------------------------------------------------------
+
+bool CommandBuffer::SetUniformVolume(Uniform& u, const VolumeTextureRef& volume)
+{
+    return SetUniform(BINDING_UNIFORM_VOLUME, u, GetPointer(volume));
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::SetComputeSampler(SamplerStateRef& sampler, int slot)
+{
+    SetSampler(Shader::COMPUTE, sampler, slot);
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::SetPixelSampler(SamplerStateRef& sampler, int slot)
+{
+    SetSampler(Shader::FRAGMENT, sampler, slot);
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::SetVertexSampler(SamplerStateRef& sampler, int slot)
+{
+    SetSampler(Shader::VERTEX, sampler, slot);
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::CleanInternalState()
+{
+    PushPass(PASS_CLEAN_INTERNAL_STATE);
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::SetComputeOutput(BufferRef buffer, int slot)
+{
+    SetComputeOutputBinding(BINDING_COMPUTE_OUTPUT_BUFFER, GetPointer(buffer), slot);
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::SetComputeOutput(VolumeTextureRef volume, int slot)
+{
+    SetComputeOutputBinding(BINDING_COMPUTE_OUTPUT_VOLUME, GetPointer(volume), slot);
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::SetComputeOutput(RenderTargetRef target, int slot)
+{
+    SetComputeOutputBinding(BINDING_COMPUTE_OUTPUT_RENDER_TARGET, GetPointer(target), slot);
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::UnbindComputeOutputs()
+{
+    PushPass(PASS_UNBIND_COMPUTE_OUTPUTS);
+    RemoveBindings(false);
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::UnbindComputeResources()
+{
+    PushPass(PASS_UNBIND_COMPUTE_RESOURCES);
+    RemoveBindings(true);
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::UnbindPixelResources()
+{
+    PushPass(PASS_UNBIND_PIXEL_RESOURCES);
+    RemoveBindings(true);
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::UnbindVertexResources()
+{
+    PushPass(PASS_UNBIND_VERTEX_RESOURCES);
+    RemoveBindings(true);
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::Dispatch(unsigned int x, unsigned int y, unsigned int z)
+{
+    Packet & packet = PushPacket(PACKET_DISPATCH);
+    packet.mArgs[0] = x;
+    packet.mArgs[1] = y;
+    packet.mArgs[2] = z;
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::GenerateMips(RenderTargetRef& renderTarget)
+{
+    Core::RefCounted * resource = GetPointer(renderTarget);
+    Retain(resource);
+    PushPass(PASS_GENERATE_MIPS_RENDER_TARGET).mResources[0] = resource;
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::GenerateMips(CubeMapRef& cubeMap)
+{
+    Core::RefCounted * resource = GetPointer(cubeMap);
+    Retain(resource);
+    PushPass(PASS_GENERATE_MIPS_CUBE_MAP).mResources[0] = resource;
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::BeginMarker(const char* marker)
+{
+    const unsigned int dataOffset = CopyData(marker, Utils::Strlen(marker) + 1);
+    PushPass(PASS_BEGIN_MARKER).mDataOffset = dataOffset;
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::EndMarker()
+{
+    PushPass(PASS_END_MARKER);
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::SortSegment(unsigned int first, unsigned int count)
+{
+    int * order = mOrder.mData + first;
+    const Packet * packets = mPackets.mData + first;
+
+    //stable sort of the segment, equal keys keep their recording order
+    if (count <= COMMAND_BUFFER_INSERTION_SORT_MAX)
+    {
+        for (unsigned int i = 1; i < count; ++i)
+        {
+            const int element = order[i];
+            const unsigned int key = packets[element - first].mKey;
+            unsigned int j = i;
+            while (j > 0 && packets[order[j - 1] - first].mKey > key)
+            {
+                order[j] = order[j - 1];
+                --j;
+            }
+            order[j] = element;
+        }
+        return;
+    }
+
+    //least significant digit radix sort, 11 bits per pass
+    mSortTemp.Clear();
+    mSortKeys.Clear();
+    int * temp = mSortTemp.PushArray(mAllocator, count);
+    unsigned int * keys = mSortKeys.PushArray(mAllocator, count);
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        keys[i] = packets[i].mKey;
+    }
+
+    int histogram[2048];
+    int * src = order;
+    int * dst = temp;
+    for (int shift = 0; shift < 32; shift += 11)
+    {
+        Utils::Memset32(histogram, 0, sizeof(histogram));
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            ++histogram[(keys[i] >> shift) & 2047];
+        }
+
+        int offset = 0;
+        for (int b = 0; b < 2048; ++b)
+        {
+            const int bucketCount = histogram[b];
+            histogram[b] = offset;
+            offset += bucketCount;
+        }
+
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            const int element = src[i];
+            dst[histogram[(keys[element - first] >> shift) & 2047]++] = element;
+        }
+
+        int * swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    //3 passes, the sorted order ended in the temporary array
+    Utils::Memcpy(order, src, count * sizeof(int));
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::SubmitPackets(AppliedState & state, unsigned int first, unsigned int end)
+{
+    unsigned int segmentBegin = first;
+    while (segmentBegin < end)
+    {
+        const unsigned int segment = mPackets.mData[segmentBegin].mSegment;
+        unsigned int segmentEnd = segmentBegin + 1;
+        while (segmentEnd < end && mPackets.mData[segmentEnd].mSegment == segment)
+        {
+            ++segmentEnd;
+        }
+
+        ++mStats.mSegmentCount;
+        if (mSortDraws && segmentEnd - segmentBegin > 1)
+        {
+            SortSegment(segmentBegin, segmentEnd - segmentBegin);
+        }
+        for (unsigned int p = segmentBegin; p < segmentEnd; ++p)
+        {
+            SubmitPacket(state, mPackets.mData[mOrder.mData[p]]);
+        }
+        segmentBegin = segmentEnd;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::SubmitPacket(AppliedState & state, const Packet & packet)
+{
+    if (packet.mProgram != nullptr)
+    {
+        if (!state.mProgramKnown || state.mProgram != packet.mProgram)
+        {
+            Shader::ProgramLinkageRef program = packet.mProgram;
+            Render::SetProgram(program);
+            state.mProgramKnown = true;
+            state.mProgram = packet.mProgram;
+            state.mUniformCount = 0;
+            state.Submitted();
+        }
+        else
+        {
+            state.Filtered();
+        }
+    }
+
+    if (packet.mType != PACKET_DISPATCH)
+    {
+        if (!state.mMeshKnown || state.mMesh != packet.mMesh)
+        {
+            if (packet.mMesh != nullptr)
+            {
+                Mesh::MeshRef mesh = packet.mMesh;
+                Render::SetMesh(mesh);
+            }
+            else
+            {
+                Render::UnbindMesh();
+            }
+            state.mMeshKnown = true;
+            state.mMesh = packet.mMesh;
+            state.Submitted();
+        }
+        else
+        {
+            state.Filtered();
+        }
+
+        if (packet.mRasterState != nullptr)
+        {
+            if (!state.mRasterKnown || state.mRasterState != packet.mRasterState
+                || state.mHasStencilRefValue != packet.mHasStencilRefValue || state.mStencilRefValue != packet.mStencilRefValue)
+            {
+                RasterizerStateRef rasterState = packet.mRasterState;
+                if (packet.mHasStencilRefValue)
+                {
+                    Render::SetRasterizerState(rasterState, packet.mStencilRefValue);
+                }
+                else
+                {
+                    Render::SetRasterizerState(rasterState);
+                }
+                state.mRasterKnown = true;
+                state.mRasterState = packet.mRasterState;
+                state.mHasStencilRefValue = packet.mHasStencilRefValue;
+                state.mStencilRefValue = packet.mStencilRefValue;
+                state.Submitted();
+            }
+            else
+            {
+                state.Filtered();
+            }
+        }
+
+        if (packet.mBlendState != nullptr)
+        {
+            if (!state.mBlendKnown || state.mBlendState != packet.mBlendState)
+            {
+                Render::SetBlendingState(BlendingStateRef(packet.mBlendState));
+                state.mBlendKnown = true;
+                state.mBlendState = packet.mBlendState;
+                state.Submitted();
+            }
+            else
+            {
+                state.Filtered();
+            }
+        }
+
+        if (packet.mPrimitiveMode != -1)
+        {
+            if (state.mPrimitiveMode != packet.mPrimitiveMode)
+            {
+                Render::SetPrimitiveMode(static_cast<PrimitiveMode>(packet.mPrimitiveMode));
+                state.mPrimitiveMode = packet.mPrimitiveMode;
+                state.Submitted();
+            }
+            else
+            {
+                state.Filtered();
+            }
+        }
+    }
+
+    SubmitBindings(state, packet);
+
+    switch (packet.mType)
+    {
+    case PACKET_DRAW:
+        Render::Draw();
+        break;
+    case PACKET_DRAW_INSTANCED:
+        Render::DrawInstanced(packet.mArgs[0]);
+        break;
+    case PACKET_DRAW_LOD:
+        Render::DrawLod(packet.mScreenSize);
+        break;
+    case PACKET_DISPATCH:
+        Render::Dispatch(packet.mArgs[0], packet.mArgs[1], packet.mArgs[2]);
+        //the dispatch can write any buffer, the uploaded content is unknown
+        state.mUploadCount = 0;
+        break;
+    default:
+        PG_FAILSTR("Invalid command buffer packet type (%d)", packet.mType);
+    }
+    state.Submitted();
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::SubmitBindings(AppliedState & state, const Packet & packet)
+{
+    const Binding * bindings = mBindingSnapshots.mData + packet.mFirstBinding;
+    for (unsigned int b = 0; b < packet.mBindingCount; ++b)
+    {
+        const Binding & binding = bindings[b];
+        if (binding.mType == BINDING_BUFFER_DATA)
+        {
+            const Buffer * bufferPtr = static_cast<const Buffer *>(binding.mResource);
+            const char * data = mData.mData + binding.mDataOffset;
+            int u = 0;
+            while (u < state.mUploadCount && (state.mUploads[u].mBuffer != bufferPtr || state.mUploads[u].mOffset != binding.mSlot))
+            {
+                ++u;
+            }
+            if (u < state.mUploadCount && state.mUploads[u].mSize == binding.mSize
+                && (state.mUploads[u].mData == data || DataEquals(state.mUploads[u].mData, data, binding.mSize)))
+            {
+                state.Filtered();
+                continue;
+            }
+
+            BufferRef buffer = static_cast<Buffer *>(binding.mResource);
+            Render::SetBuffer(buffer, data, binding.mSize, binding.mSlot);
+            state.Submitted();
+
+            //the write replaces the cached uploads it overlaps
+            for (int o = state.mUploadCount - 1; o >= 0; --o)
+            {
+                const AppliedState::Upload & upload = state.mUploads[o];
+                if (upload.mBuffer == bufferPtr && upload.mOffset < binding.mSlot + binding.mSize && binding.mSlot < upload.mOffset + upload.mSize)
+                {
+                    state.mUploads[o] = state.mUploads[--state.mUploadCount];
+                }
+            }
+            if (state.mUploadCount < APPLIED_UPLOAD_COUNT)
+            {
+                AppliedState::Upload & upload = state.mUploads[state.mUploadCount++];
+                upload.mBuffer = bufferPtr;
+                upload.mOffset = binding.mSlot;
+                upload.mSize = binding.mSize;
+                upload.mData = data;
+            }
+        }
+        else if (IsUniformBinding(binding.mType))
+        {
+            int u = 0;
+            while (u < state.mUniformCount && (state.mUniforms[u].mIndex != binding.mUniform.mInternalIndex || state.mUniforms[u].mOwner != binding.mUniform.mInternalOwner))
+            {
+                ++u;
+            }
+            if (u < state.mUniformCount && state.mUniforms[u].mType == binding.mType && state.mUniforms[u].mResource == binding.mResource)
+            {
+                state.Filtered();
+                continue;
+            }
+
+            //a uniform set with another program is bound to the variable of the same name of the program of the draw,
+            //the render API keeps it bound to its slots the same way, it is skipped if the program has no such variable
+            Uniform uniform = binding.mUniform;
+            if (binding.mProgram != packet.mProgram)
+            {
+                if (packet.mProgram == nullptr)
+                {
+                    continue;
+                }
+                Shader::ProgramLinkageRef program = packet.mProgram;
+                if (!Render::GetUniformLocation(program, binding.mUniform.mName, uniform))
+                {
+                    continue;
+                }
+            }
+            switch (binding.mType)
+            {
+            case BINDING_UNIFORM_TEXTURE:
+                {
+                    Texture::TextureRef texture = static_cast<Texture::Texture *>(binding.mResource);
+                    Render::SetUniformTexture(uniform, texture);
+                }
+                break;
+            case BINDING_UNIFORM_BUFFER:
+                Render::SetUniformBuffer(uniform, BufferRef(static_cast<Buffer *>(binding.mResource)));
+                break;
+            case BINDING_UNIFORM_BUFFER_RESOURCE:
+                Render::SetUniformBufferResource(uniform, BufferRef(static_cast<Buffer *>(binding.mResource)));
+                break;
+            case BINDING_UNIFORM_RENDER_TARGET:
+                Render::SetUniformTextureRenderTarget(uniform, RenderTargetRef(static_cast<RenderTarget *>(binding.mResource)));
+                break;
+            case BINDING_UNIFORM_DEPTH:
+                Render::SetUniformDepth(uniform, DepthStencilRef(static_cast<DepthStencil *>(binding.mResource)));
+                break;
+            case BINDING_UNIFORM_STENCIL:
+                Render::SetUniformStencil(uniform, DepthStencilRef(static_cast<DepthStencil *>(binding.mResource)));
+                break;
+            case BINDING_UNIFORM_CUBE_MAP:
+                {
+                    CubeMapRef cubeMap = static_cast<CubeMap *>(binding.mResource);
+                    Render::SetUniformCubeMap(uniform, cubeMap);
+                }
+                break;
+            case BINDING_UNIFORM_VOLUME:
+                Render::SetUniformVolume(uniform, VolumeTextureRef(static_cast<VolumeTexture *>(binding.mResource)));
+                break;
+            }
+            state.Submitted();
+
+            if (u == state.mUniformCount && state.mUniformCount < APPLIED_UNIFORM_COUNT)
+            {
+                ++state.mUniformCount;
+            }
+            if (u < state.mUniformCount)
+            {
+                state.mUniforms[u].mType = binding.mType;
+                state.mUniforms[u].mIndex = binding.mUniform.mInternalIndex;
+                state.mUniforms[u].mOwner = binding.mUniform.mInternalOwner;
+                state.mUniforms[u].mResource = binding.mResource;
+            }
+        }
+        else if (binding.mType == BINDING_SAMPLER)
+        {
+            const bool cached = binding.mSlot >= 0 && binding.mSlot < APPLIED_SAMPLER_SLOT_COUNT;
+            const Core::RefCounted ** applied = cached ? &state.mSamplers[GetSamplerStageIndex(binding.mStage)][binding.mSlot] : nullptr;
+            if (applied != nullptr && *applied == binding.mResource)
+            {
+                state.Filtered();
+                continue;
+            }
+
+            SamplerStateRef sampler = static_cast<SamplerState *>(binding.mResource);
+            if (binding.mStage == Shader::COMPUTE)
+            {
+                Render::SetComputeSampler(sampler, binding.mSlot);
+            }
+            else if (binding.mStage == Shader::FRAGMENT)
+            {
+                Render::SetPixelSampler(sampler, binding.mSlot);
+            }
+            else
+            {
+                Render::SetVertexSampler(sampler, binding.mSlot);
+            }
+            state.Submitted();
+            if (applied != nullptr)
+            {
+                *applied = binding.mResource;
+            }
+        }
+        else
+        {
+            const bool cached = binding.mSlot >= 0 && binding.mSlot < APPLIED_COMPUTE_OUTPUT_COUNT;
+            if (cached && state.mComputeOutputs[binding.mSlot] == binding.mResource)
+            {
+                state.Filtered();
+                continue;
+            }
+
+            switch (binding.mType)
+            {
+            case BINDING_COMPUTE_OUTPUT_BUFFER:
+                Render::SetComputeOutput(BufferRef(static_cast<Buffer *>(binding.mResource)), binding.mSlot);
+                break;
+            case BINDING_COMPUTE_OUTPUT_VOLUME:
+                Render::SetComputeOutput(VolumeTextureRef(static_cast<VolumeTexture *>(binding.mResource)), binding.mSlot);
+                break;
+            default:
+                Render::SetComputeOutput(RenderTargetRef(static_cast<RenderTarget *>(binding.mResource)), binding.mSlot);
+                break;
+            }
+            state.Submitted();
+            if (cached)
+            {
+                state.mComputeOutputs[binding.mSlot] = binding.mResource;
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::SubmitPass(AppliedState & state, const Pass & pass)
+{
+    switch (pass.mType)
+    {
+    case PASS_VIEWPORT:
+        Render::SetViewport(Viewport(pass.mArgs[0], pass.mArgs[1], pass.mArgs[2], pass.mArgs[3]));
+        break;
+    case PASS_VIEWPORT_RENDER_TARGET:
+        Render::SetViewport(RenderTargetRef(static_cast<RenderTarget *>(pass.mResources[0])));
+        break;
+    case PASS_VIEWPORT_DEPTH_STENCIL:
+        Render::SetViewport(DepthStencilRef(static_cast<DepthStencil *>(pass.mResources[0])));
+        break;
+    case PASS_RENDER_TARGETS:
+        {
+            RenderTargetRef renderTargets[Constants::MAX_RENDER_TARGETS];
+            for (int t = 0; t < pass.mArgs[0]; ++t)
+            {
+                renderTargets[t] = static_cast<RenderTarget *>(pass.mResources[t]);
+            }
+            DepthStencilRef depthStencil = static_cast<DepthStencil *>(pass.mResources[Constants::MAX_RENDER_TARGETS]);
+            if (depthStencil != nullptr)
+            {
+                Render::SetRenderTargets(pass.mArgs[0], renderTargets, depthStencil);
+            }
+            else
+            {
+                Render::SetRenderTargets(pass.mArgs[0], renderTargets);
+            }
+        }
+        break;
+    case PASS_UNBIND_RENDER_TARGETS:
+        Render::UnbindRenderTargets();
+        break;
+    case PASS_DEFAULT_RENDER_TARGET:
+        Render::DispatchDefaultRenderTarget();
+        break;
+    case PASS_CLEAR:
+        Render::Clear(pass.mArgs[0] != 0, pass.mArgs[1] != 0, pass.mArgs[2] != 0);
+        break;
+    case PASS_CLEAR_COLOR:
+        Render::SetClearColorValue(Math::ColorRGBA(pass.mValues[0], pass.mValues[1], pass.mValues[2], pass.mValues[3]));
+        break;
+    case PASS_DEPTH_CLEAR_VALUE:
+        Render::SetDepthClearValue(pass.mValues[0]);
+        break;
+    case PASS_CLEAN_INTERNAL_STATE:
+        Render::CleanInternalState();
+        state.Invalidate();
+        break;
+    case PASS_UNBIND_COMPUTE_OUTPUTS:
+        Render::UnbindComputeOutputs();
+        Utils::Memset32(state.mComputeOutputs, 0, sizeof(state.mComputeOutputs));
+        break;
+    case PASS_UNBIND_COMPUTE_RESOURCES:
+        Render::UnbindComputeResources();
+        state.InvalidateUniformResources();
+        break;
+    case PASS_UNBIND_PIXEL_RESOURCES:
+        Render::UnbindPixelResources();
+        state.InvalidateUniformResources();
+        break;
+    case PASS_UNBIND_VERTEX_RESOURCES:
+        Render::UnbindVertexResources();
+        state.InvalidateUniformResources();
+        break;
+    case PASS_GENERATE_MIPS_RENDER_TARGET:
+        {
+            RenderTargetRef renderTarget = static_cast<RenderTarget *>(pass.mResources[0]);
+            Render::GenerateMips(renderTarget);
+        }
+        break;
+    case PASS_GENERATE_MIPS_CUBE_MAP:
+        {
+            CubeMapRef cubeMap = static_cast<CubeMap *>(pass.mResources[0]);
+            Render::GenerateMips(cubeMap);
+        }
+        break;
+    case PASS_BEGIN_MARKER:
+        Render::BeginMarker(mData.mData + pass.mDataOffset);
+        break;
+    case PASS_END_MARKER:
+        Render::EndMarker();
+        break;
+    default:
+        PG_FAILSTR("Invalid command buffer pass type (%d)", pass.mType);
+    }
+    state.Submitted();
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::Submit()
+{
+    CommandBuffer * buffer = this;
+    Submit(&buffer, 1);
+}
+
+//----------------------------------------------------------------------------------------
+
+void CommandBuffer::Submit(CommandBuffer * const * buffers, unsigned int count)
+{
+    AppliedState state;
+    for (unsigned int b = 0; b < count; ++b)
+    {
+        CommandBuffer * buffer = buffers[b];
+        if (buffer == nullptr)
+        {
+            continue;
+        }
+
+        buffer->mStats.mSubmittedCommandCount = 0;
+        buffer->mStats.mFilteredCommandCount = 0;
+        buffer->mStats.mSegmentCount = 0;
+        state.mStats = &buffer->mStats;
+
+        //the packets are submitted in recording order unless sorted
+        buffer->mOrder.Clear();
+        int * order = buffer->mOrder.PushArray(buffer->mAllocator, buffer->mPackets.mCount);
+        for (unsigned int p = 0; p < buffer->mPackets.mCount; ++p)
+        {
+            order[p] = static_cast<int>(p);
+        }
+
+        unsigned int packetIndex = 0;
+        for (unsigned int p = 0; p < buffer->mPasses.mCount; ++p)
+        {
+            const Pass & pass = buffer->mPasses.mData[p];
+            buffer->SubmitPackets(state, packetIndex, pass.mPacketIndex);
+            packetIndex = pass.mPacketIndex;
+            buffer->SubmitPass(state, pass);
+        }
+        buffer->SubmitPackets(state, packetIndex, buffer->mPackets.mCount);
+    }
+}
+
+}
+}
@@ -19,6 +19,7 @@
 #include "Pegasus/Shader/Shared/ShaderDefs.h"
 #include "Pegasus/Mesh/MeshInputLayout.h"
 #include "Pegasus/Render/Render.h"
+#include "Pegasus/Render/UniformLookup.h"
 
 #define MAX_UNIFORM_NAME 64
 #define UNIFORM_DATA_INCREMENT 16
@@ -89,6 +90,9 @@ struct DXProgramGPUData
     }* mReflectionData;
     int mReflectionDataCount;
     int mReflectionDataCapacity;
+
+    //! Index of mReflectionData by uniform name hash, built when the program links
+    Render::UniformLookup mReflectionLookup;
     int mProgramGuid;
     int mProgramVersion;
     bool mProgramValid;
@@ -109,6 +113,10 @@ struct DXBufferGPUData
     D3D11_BUFFER_DESC mDesc;
     D3D11_UNORDERED_ACCESS_VIEW_DESC mUavDesc;
     D3D11_SHADER_RESOURCE_VIEW_DESC mSrvDesc;
+
+    //transient uniform buffers: range of the last write in the uniform ring, -1 if it went to mBuffer
+    int mRingOffset;
+    unsigned int mRingFence;
 };
 
 struct DXMeshGPUData
@@ -148,6 +156,10 @@ struct DXMeshGPUData
 
     int mIndexCount;
     int mVertexCount;
+
+    //levels of detail, ranges of the index stream. mIndexCount is the count of the most detailed one.
+    Mesh::MeshLod mLods[Mesh::MESH_MAX_LODS];
+    int mLodCount;
 };
 
 
@@ -234,7 +246,7 @@ void DXCreateBuffer(
     int bufferSize,
     int elementCount,
     bool isDynamic,
-    void* initData,
+    const void* initData,
     D3D11_BIND_FLAG bindFlags,
     DXBufferGPUData& outBuffer,
     UINT extraMiscFlags = 0);
@@ -93,6 +93,7 @@ Pegasus::Render::DXMeshGPUData* DXMeshFactory::GetOrAllocateGPUData(Pegasus::Mes
         meshGpuData->mIsIndirect = false;
         meshGpuData->mVertexCount = 0;
         meshGpuData->mIndexCount = 0;
+        meshGpuData->mLodCount = 0;
 
         for (unsigned i = 0; i < MESH_MAX_STREAMS; ++i)
         {
@@ -188,7 +189,7 @@ void DXMeshFactory::GenerateMeshGPUData(Pegasus::Mesh::MeshData * nodeData)
                     streamByteSize,
                     meshGpuData->mVertexCount,
                     configuration.GetIsDynamic(),
-                    isCompute ? nullptr : nodeData->GetStream<void>(streamIndex),
+                    isCompute ? nullptr : nodeData->GetConstStream<void>(streamIndex),
                     (D3D11_BIND_FLAG)(D3D11_BIND_VERTEX_BUFFER | (isCompute ? (D3D11_BIND_UNORDERED_ACCESS | D3D11_BIND_SHADER_RESOURCE) : 0)),
                     bufferData
                 );
@@ -200,7 +201,7 @@ void DXMeshFactory::GenerateMeshGPUData(Pegasus::Mesh::MeshData * nodeData)
                 if (context->Map(bufferData.mBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource) == S_OK)
                 {
                     PG_ASSERTSTR(mappedResource.pData != nullptr,"map returned a null pointer of data!");
-                    Pegasus::Utils::Memcpy(mappedResource.pData, nodeData->GetStream<void>(streamIndex), streamByteSize);
+                    Pegasus::Utils::Memcpy(mappedResource.pData, nodeData->GetConstStream<void>(streamIndex), streamByteSize);
                     context->Unmap(bufferData.mBuffer, 0);
                 }
                 else
@@ -250,6 +251,17 @@ void DXMeshFactory::GenerateMeshGPUData(Pegasus::Mesh::MeshData * nodeData)
                 PG_FAILSTR("GPU Map failed!");
             }
         }
+
+        //all the levels of detail live in the index stream, a plain draw only renders the most detailed one
+        meshGpuData->mLodCount = nodeData->GetLodCount();
+        for (int lod = 0; lod < meshGpuData->mLodCount; ++lod)
+        {
+            meshGpuData->mLods[lod] = nodeData->GetLod(lod);
+        }
+        if (meshGpuData->mLodCount > 0)
+        {
+            meshGpuData->mIndexCount = meshGpuData->mLods[0].mIndexCount;
+        }
     }
 
     if (configuration.GetIsDrawIndirect())
@@ -14,6 +14,7 @@
 
 
 #include "Pegasus/Render/RenderContext.h"
+#include "Pegasus/Render/UniformRing.h"
 #include "../Source/Pegasus/Render/DX11/DXRenderContext.h"
 #include "../Source/Pegasus/Render/DX11/DXDevice.h"
 
@@ -305,6 +306,7 @@ void Context::Swap() const
 {
     DXRenderContext * context = static_cast<DXRenderContext*>(mPrivateData);
     context->Present();
+    EndUniformRingFrame();
 }
 
 void Context::Resize(int width, int height)
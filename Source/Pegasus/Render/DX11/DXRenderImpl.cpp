@@ -15,6 +15,10 @@
 #include "Pegasus/Allocator/IAllocator.h"
 #include "Pegasus/Render/MeshFactory.h"
 #include "Pegasus/Render/Render.h"
+#include "Pegasus/Render/UniformRing.h"
+#include "Pegasus/Render/UniformLookup.h"
+#include "Pegasus/Core/Atomic.h"
+#include "Pegasus/Math/Constants.h"
 #include "Pegasus/Utils/Memcpy.h"
 #include "Pegasus/Utils/Memset.h"
 #include "Pegasus/Utils/String.h"
@@ -24,6 +28,10 @@
 /// MACROS ///
 #define MAX_UAV_SLOT_COUNT 8
 
+//size of the uniform ring, and offset granularity of the constant buffers (16 constants)
+#define DX_UNIFORM_RING_SIZE (1024 * 1024)
+#define DX_UNIFORM_RING_ALIGNMENT 256
+
 #define RENDER_NEW(__type) \
         PG_NEW(Pegasus::Memory::GetRenderAllocator(), -1, #__type, Pegasus::Alloc::PG_MEM_PERM) __type(Pegasus::Memory::GetRenderAllocator())
 
@@ -62,8 +70,226 @@ struct DXState
     bool mComputeOutputsDirty;
     int  mComputeOutputsCount;
 
+    //uniform buffer bound to each constant buffer slot of each stage, the writes of a transient buffer bind it again
+    const Pegasus::Render::DXBufferGPUData* mUniformBuffers[Pegasus::Shader::SHADER_STAGES_COUNT][D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT];
+
 } gDXState;// = { 0, nullptr, 0, nullptr, Pegasus::Math::ColorRGBA(0.0, 0.0, 0.0, 0.0), Pegasus::Render::PM_AUTOMATIC };
 
+//! Uniform ring of the transient uniform buffers. A dynamic constant buffer written with no overwrite
+//! maps and bound with constant offsets (DirectX 11.1), the frames are fenced with event queries.
+//! Without the 11.1 features the transient buffers are written in their own buffer.
+struct DXUniformRing
+{
+    Pegasus::Render::UniformRing mRing;
+    CComPtr<ID3D11Buffer> mBuffer;
+    CComPtr<ID3D11DeviceContext1> mContext1;
+    CComPtr<ID3D11Query> mFences[Pegasus::Render::UniformRing::MAX_FRAMES_IN_FLIGHT];
+    bool mInitialized;
+    bool mSupported;
+
+    DXUniformRing() : mInitialized(false), mSupported(false) {}
+} gDXUniformRing;
+
+static bool DXInitUniformRing()
+{
+    if (!gDXUniformRing.mInitialized)
+    {
+        gDXUniformRing.mInitialized = true;
+        ID3D11DeviceContext * context;
+        ID3D11Device * device;
+        Pegasus::Render::GetDeviceAndContext(&device, &context);
+
+        D3D11_FEATURE_DATA_D3D11_OPTIONS options;
+        Pegasus::Utils::Memset8(&options, 0x0, sizeof(options));
+        if (device->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &options, sizeof(options)) != S_OK
+            || !options.ConstantBufferOffsetting
+            || !options.MapNoOverwriteOnDynamicConstantBuffer
+            || context->QueryInterface(__uuidof(ID3D11DeviceContext1), reinterpret_cast<void**>(&gDXUniformRing.mContext1)) != S_OK)
+        {
+            PG_LOG('ERR_', "Constant buffer offsets not supported, transient uniform buffers are written in their own buffer.");
+            return false;
+        }
+
+        D3D11_BUFFER_DESC desc;
+        Pegasus::Utils::Memset8(&desc, 0x0, sizeof(desc));
+        desc.ByteWidth = DX_UNIFORM_RING_SIZE;
+        desc.Usage = D3D11_USAGE_DYNAMIC;
+        desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+        desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+        VALID_DECLARE(device->CreateBuffer(&desc, nullptr, &gDXUniformRing.mBuffer));
+
+        D3D11_QUERY_DESC queryDesc;
+        queryDesc.Query = D3D11_QUERY_EVENT;
+        queryDesc.MiscFlags = 0;
+        for (unsigned int i = 0; i < Pegasus::Render::UniformRing::MAX_FRAMES_IN_FLIGHT; ++i)
+        {
+            VALID(device->CreateQuery(&queryDesc, &gDXUniformRing.mFences[i]));
+        }
+
+        gDXUniformRing.mRing.Initialize(DX_UNIFORM_RING_SIZE, DX_UNIFORM_RING_ALIGNMENT);
+        gDXUniformRing.mSupported = true;
+    }
+    return gDXUniformRing.mSupported;
+}
+
+//! Retire the frames of the uniform ring the GPU completed
+//! \param wait True to wait for the oldest frame and only retire it
+static void DXRetireUniformRingFrames(bool wait)
+{
+    ID3D11DeviceContext * context;
+    ID3D11Device * device;
+    Pegasus::Render::GetDeviceAndContext(&device, &context);
+
+    Pegasus::Render::UniformRing& ring = gDXUniformRing.mRing;
+    while (ring.GetPendingFrameCount() > 0)
+    {
+        ID3D11Query * fence = gDXUniformRing.mFences[ring.GetOldestPendingFence() % Pegasus::Render::UniformRing::MAX_FRAMES_IN_FLIGHT];
+        HRESULT result = context->GetData(fence, nullptr, 0, wait ? 0 : D3D11_ASYNC_GETDATA_DONOTFLUSH);
+        Pegasus::Core::SpinBackoff backoff;
+        while (wait && result == S_FALSE)
+        {
+            backoff.Wait();
+            result = context->GetData(fence, nullptr, 0, 0);
+        }
+        if (result != S_OK)
+        {
+            return;
+        }
+        ring.RetireFrame();
+        if (wait)
+        {
+            return;
+        }
+    }
+}
+
+//! Allocate a range of the uniform ring, waiting for the GPU if the frames in flight use the space
+//! \return False if the range does not fit in the current frame
+static bool DXAllocateUniformRing(unsigned int size, unsigned int& outOffset)
+{
+    Pegasus::Render::UniformRing& ring = gDXUniformRing.mRing;
+    while (!ring.Allocate(size, outOffset))
+    {
+        if (ring.GetPendingFrameCount() == 0)
+        {
+            return false;
+        }
+        DXRetireUniformRingFrames(true);
+    }
+    return true;
+}
+
+//! Bind a uniform buffer to a constant buffer slot of a stage, a transient buffer as the range of its last write
+//! in the uniform ring. The slot is tracked so the next writes of a transient buffer bind it again.
+static void DXBindUniformBuffer(Pegasus::Shader::ShaderType pipelineType, UINT bindPoint, const Pegasus::Render::BufferConfig& config, const Pegasus::Render::DXBufferGPUData* gpuData)
+{
+    ID3D11DeviceContext * context;
+    ID3D11Device * device;
+    Pegasus::Render::GetDeviceAndContext(&device, &context);
+
+    ID3D11Buffer* d3dBuffer = gpuData->mBuffer;
+    PG_ASSERT(d3dBuffer != nullptr);
+    PG_ASSERT(bindPoint < D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT);
+    gDXState.mUniformBuffers[pipelineType][bindPoint] = gpuData;
+
+    //transient buffers are bound as their range of the uniform ring, in units of constants (16 bytes)
+    if (config.mTransient && gpuData->mRingOffset >= 0)
+    {
+        ID3D11DeviceContext1 * context1 = gDXUniformRing.mContext1;
+        ID3D11Buffer* ringBuffer = gDXUniformRing.mBuffer;
+        const UINT firstConstant = static_cast<UINT>(gpuData->mRingOffset) / 16;
+        const UINT constantCount = ((static_cast<UINT>(config.mSize) + DX_UNIFORM_RING_ALIGNMENT - 1) & ~(DX_UNIFORM_RING_ALIGNMENT - 1)) / 16;
+        switch(pipelineType)
+        {
+        case Pegasus::Shader::FRAGMENT:
+            context1->PSSetConstantBuffers1(bindPoint, 1, &ringBuffer, &firstConstant, &constantCount);
+            break;
+        case Pegasus::Shader::VERTEX:
+            context1->VSSetConstantBuffers1(bindPoint, 1, &ringBuffer, &firstConstant, &constantCount);
+            break;
+        case Pegasus::Shader::TESSELATION_CONTROL:
+            context1->HSSetConstantBuffers1(bindPoint, 1, &ringBuffer, &firstConstant, &constantCount);
+            break;
+        case Pegasus::Shader::TESSELATION_EVALUATION:
+            context1->DSSetConstantBuffers1(bindPoint, 1, &ringBuffer, &firstConstant, &constantCount);
+            break;
+        case Pegasus::Shader::GEOMETRY:
+            context1->GSSetConstantBuffers1(bindPoint, 1, &ringBuffer, &firstConstant, &constantCount);
+            break;
+        case Pegasus::Shader::COMPUTE:
+            context1->CSSetConstantBuffers1(bindPoint, 1, &ringBuffer, &firstConstant, &constantCount);
+            break;
+        default:
+            PG_FAIL();
+        };
+        return;
+    }
+
+    //binding without offsets also resets the range of a transient buffer bound in the ring before
+    switch(pipelineType)
+    {
+    case Pegasus::Shader::FRAGMENT:
+        context->PSSetConstantBuffers(bindPoint, 1, &d3dBuffer);
+        break;
+    case Pegasus::Shader::VERTEX:
+        context->VSSetConstantBuffers(bindPoint, 1, &d3dBuffer);
+        break;
+    case Pegasus::Shader::TESSELATION_CONTROL:
+        context->HSSetConstantBuffers(bindPoint, 1, &d3dBuffer);
+        break;
+    case Pegasus::Shader::TESSELATION_EVALUATION:
+        context->DSSetConstantBuffers(bindPoint, 1, &d3dBuffer);
+        break;
+    case Pegasus::Shader::GEOMETRY:
+        context->GSSetConstantBuffers(bindPoint, 1, &d3dBuffer);
+        break;
+    case Pegasus::Shader::COMPUTE:
+        context->CSSetConstantBuffers(bindPoint, 1, &d3dBuffer);
+        break;
+    default:
+        PG_FAIL();
+    };
+}
+
+//! Bind a transient buffer again to every slot it is bound to, after a write moved it in the uniform ring or out of it
+static void DXRebindUniformBuffer(const Pegasus::Render::BufferConfig& config, const Pegasus::Render::DXBufferGPUData* gpuData)
+{
+    for (int stage = 0; stage < Pegasus::Shader::SHADER_STAGES_COUNT; ++stage)
+    {
+        for (UINT slot = 0; slot < D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT; ++slot)
+        {
+            if (gDXState.mUniformBuffers[stage][slot] == gpuData)
+            {
+                DXBindUniformBuffer(static_cast<Pegasus::Shader::ShaderType>(stage), slot, config, gpuData);
+            }
+        }
+    }
+}
+
+const Pegasus::Render::UniformRing& Pegasus::Render::GetUniformRing()
+{
+    return gDXUniformRing.mRing;
+}
+
+void Pegasus::Render::EndUniformRingFrame()
+{
+    if (gDXUniformRing.mSupported)
+    {
+        ID3D11DeviceContext * context;
+        ID3D11Device * device;
+        Pegasus::Render::GetDeviceAndContext(&device, &context);
+
+        Pegasus::Render::UniformRing& ring = gDXUniformRing.mRing;
+        if (ring.GetPendingFrameCount() == Pegasus::Render::UniformRing::MAX_FRAMES_IN_FLIGHT)
+        {
+            DXRetireUniformRingFrames(true);
+        }
+        context->End(gDXUniformRing.mFences[ring.GetCurrentFence() % Pegasus::Render::UniformRing::MAX_FRAMES_IN_FLIGHT]);
+        ring.EndFrame();
+        DXRetireUniformRingFrames(false);
+    }
+}
+
         
        
 const D3D_PRIMITIVE_TOPOLOGY gPrimitiveModeTranslation[] = {
@@ -661,7 +887,7 @@ void Pegasus::Render::SetPrimitiveMode(Pegasus::Render::PrimitiveMode mode)
 /////////////   DRAW FUNCTION IMPLEMENTATION      /////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 
-static void DrawInternal(unsigned int instanceCount)
+static void DrawInternal(unsigned int instanceCount, float screenSize)
 {
     ID3D11DeviceContext * context;
     ID3D11Device * device;
@@ -685,6 +911,15 @@ static void DrawInternal(unsigned int instanceCount)
 
     if (mesh->mIsIndexed)
     {
+        //levels of detail are ranges of the index stream, selected the same way as Mesh::MeshData::SelectLod()
+        int lod = 0;
+        while (lod + 1 < mesh->mLodCount && screenSize <= mesh->mLods[lod + 1].mMaxScreenSize)
+        {
+            ++lod;
+        }
+        const UINT indexCount = mesh->mLodCount > 0 ? mesh->mLods[lod].mIndexCount : mesh->mIndexCount;
+        const UINT indexOffset = mesh->mLodCount > 0 ? mesh->mLods[lod].mIndexOffset : 0;
+
         if (mesh->mIsIndirect)
         {
             context->DrawIndexedInstancedIndirect(
@@ -697,9 +932,9 @@ static void DrawInternal(unsigned int instanceCount)
             if (instanceCount > 0)
             {
                 context->DrawIndexedInstanced(
-                    mesh->mIndexCount,
+                    indexCount,
                     instanceCount,
-                    0,
+                    indexOffset,
                     0,
                     0
                 );
@@ -707,8 +942,8 @@ static void DrawInternal(unsigned int instanceCount)
             else
             {
                 context->DrawIndexed(
-                    mesh->mIndexCount,
-                    0,
+                    indexCount,
+                    indexOffset,
                     0
                 );
             }
@@ -738,17 +973,23 @@ static void DrawInternal(unsigned int instanceCount)
 
 void Pegasus::Render::Draw()
 {
-    DrawInternal(0);
+    //largest screen size, the most detailed level
+    DrawInternal(0, PFLOAT_MAX);
 }
 
 void Pegasus::Render::DrawInstanced(unsigned int instanceCount)
 {
     if (instanceCount > 0)
     {
-        DrawInternal(instanceCount);
+        DrawInternal(instanceCount, PFLOAT_MAX);
     }
 }
 
+void Pegasus::Render::DrawLod(float screenSize)
+{
+    DrawInternal(0, screenSize);
+}
+
 void Pegasus::Render::Dispatch(unsigned int x, unsigned int y, unsigned int z)
 {
     ID3D11DeviceContext * context;
@@ -771,11 +1012,13 @@ void Pegasus::Render::Dispatch(unsigned int x, unsigned int y, unsigned int z)
 ///////////////////////////////////////////////////////////////////////////////
 /////////////   GET UNIFORM FUNCTION IMPLEMENTATIONS    ///////////////////////
 ///////////////////////////////////////////////////////////////////////////////
-bool UpdateUniformLocation(Pegasus::Render::DXProgramGPUData* programGPUData, const char * name, Pegasus::Render::Uniform& outputUniform)
+bool UpdateUniformLocation(Pegasus::Render::DXProgramGPUData* programGPUData, const char * name, unsigned int nameHash, Pegasus::Render::Uniform& outputUniform)
 {
     if (programGPUData->mProgramValid && programGPUData->mReflectionData != nullptr)
     {
-        for (int r = 0; r < programGPUData->mReflectionDataCount; ++r)
+        //only the uniforms sharing the hash of the name are compared
+        unsigned int cursor = 0;
+        for (int r = programGPUData->mReflectionLookup.Find(nameHash, cursor); r != -1; r = programGPUData->mReflectionLookup.Find(nameHash, cursor))
         {
             Pegasus::Render::DXProgramGPUData::UniformReflectionData& foundData = programGPUData->mReflectionData[r];
             if (!Pegasus::Utils::Strcmp(name, foundData.mUniformName))
@@ -793,9 +1036,14 @@ bool UpdateUniformLocation(Pegasus::Render::DXProgramGPUData* programGPUData, co
 
 static bool ProcessUpdateUniform(Pegasus::Render::Uniform& u, Pegasus::Render::DXProgramGPUData * programGpuData)
 {
-    if (u.mInternalVersion != programGpuData->mProgramVersion)
+    //the location stays valid until the program links again, or the uniform is used with another program
+    if (u.mInternalVersion != programGpuData->mProgramVersion || u.mInternalOwner != programGpuData->mProgramGuid)
     {
-        return UpdateUniformLocation(programGpuData, u.mName, u);
+        if (u.mNameHash == 0)
+        {
+            u.mNameHash = Pegasus::Utils::HashStr(u.mName);
+        }
+        return UpdateUniformLocation(programGpuData, u.mName, u.mNameHash, u);
     }
     return true;
 }
@@ -810,9 +1058,8 @@ bool Pegasus::Render::GetUniformLocation(Pegasus::Shader::ProgramLinkageInOut pr
     Pegasus::Graph::NodeGPUData * nodeGPUData = nodeData->GetNodeGPUData();
     PG_ASSERT(nodeGPUData != nullptr);
     Pegasus::Render::DXProgramGPUData * programGPUData = PEGASUS_GRAPH_GPUDATA_SAFECAST(Pegasus::Render::DXProgramGPUData, nodeGPUData);
-	outputUniform.mName[0] = '\0';
-    Pegasus::Utils::Strcat(outputUniform.mName, name);
-    return UpdateUniformLocation(programGPUData, name, outputUniform);
+    Pegasus::Render::SetUniformName(outputUniform, name);
+    return UpdateUniformLocation(programGPUData, name, outputUniform.mNameHash, outputUniform);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -824,6 +1071,8 @@ void Pegasus::Render::DXInitBufferData(Pegasus::Render::DXBufferGPUData& outBuff
     Pegasus::Utils::Memset8(&outBuffer.mDesc   ,  0x0, sizeof(outBuffer.mDesc));
     Pegasus::Utils::Memset8(&outBuffer.mUavDesc,  0x0, sizeof(outBuffer.mUavDesc));
     Pegasus::Utils::Memset8(&outBuffer.mSrvDesc,  0x0, sizeof(outBuffer.mSrvDesc));
+    outBuffer.mRingOffset = -1;
+    outBuffer.mRingFence = ~0u;
 }
 
 void Pegasus::Render::DXCreateBuffer(
@@ -831,7 +1080,7 @@ void Pegasus::Render::DXCreateBuffer(
     int bufferSize,
     int elementCount,
     bool isDynamic,
-    void* initData,
+    const void* initData,
     D3D11_BIND_FLAG bindFlags,
     Pegasus::Render::DXBufferGPUData& outBuffer,
     UINT extraMiscFlags)
@@ -900,7 +1149,7 @@ void Pegasus::Render::DXCreateBuffer(
     }
 }
 
-Pegasus::Render::BufferRef Pegasus::Render::CreateUniformBuffer(int size)
+Pegasus::Render::BufferRef Pegasus::Render::CreateUniformBuffer(int size, bool transient)
 {
     Pegasus::Render::Buffer* b = RENDER_NEW(Pegasus::Render::Buffer);
     ID3D11DeviceContext * context;
@@ -921,6 +1170,7 @@ Pegasus::Render::BufferRef Pegasus::Render::CreateUniformBuffer(int size)
 
     BufferConfig bc;
     bc.mSize = size;
+    bc.mTransient = transient;
     b->SetConfig(bc);
     b->SetInternalData(bufferGpuData);
     return b;
@@ -985,6 +1235,16 @@ Pegasus::Render::BasicResource<Pegasus::Render::BufferConfig>::~BasicResource()
     if (GetInternalData() != nullptr)
     {
         Pegasus::Render::DXBufferGPUData * gpuData = PEGASUS_GRAPH_GPUDATA_SAFECAST(Pegasus::Render::DXBufferGPUData, GetInternalData());
+        for (int stage = 0; stage < Pegasus::Shader::SHADER_STAGES_COUNT; ++stage)
+        {
+            for (int slot = 0; slot < D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT; ++slot)
+            {
+                if (gDXState.mUniformBuffers[stage][slot] == gpuData)
+                {
+                    gDXState.mUniformBuffers[stage][slot] = nullptr;
+                }
+            }
+        }
         gpuData->mBuffer = nullptr;
         gpuData->mUav = nullptr;
         gpuData->mSrv = nullptr;
@@ -1193,10 +1453,40 @@ void Pegasus::Render::SetBuffer(Pegasus::Render::BufferRef& dstBuffer, const voi
     Pegasus::Render::GetDeviceAndContext(&device, &context);
 
     D3D11_MAPPED_SUBRESOURCE srd;
+    unsigned int ringOffset = 0;
+    if (dstBuffer->GetConfig().mTransient && DXInitUniformRing() && DXAllocateUniformRing(dstBuffer->GetConfig().mSize, ringOffset))
+    {
+        //no overwrite: the ranges of the frames in flight are never written, the GPU does not need to finish them
+        if (context->Map(gDXUniformRing.mBuffer, 0, D3D11_MAP_WRITE_NO_OVERWRITE, 0, &srd) == S_OK)
+        {
+            Pegasus::Utils::Memcpy(static_cast<char*>(srd.pData) + ringOffset, static_cast<const char*>(src) + offset, size);
+            context->Unmap(gDXUniformRing.mBuffer, 0);
+            bufferGpuData->mRingOffset = static_cast<int>(ringOffset);
+            bufferGpuData->mRingFence = gDXUniformRing.mRing.GetCurrentFence();
+
+            //the write moved the buffer in the ring, the slots it is bound to see the new range
+            DXRebindUniformBuffer(dstBuffer->GetConfig(), bufferGpuData);
+        }
+        else
+        {
+            PG_FAILSTR("Map of the uniform ring failed");
+        }
+        return;
+    }
+
+    //not transient, or the ring is full for this frame: the write goes to the own buffer
+    bufferGpuData->mRingOffset = -1;
+    bufferGpuData->mRingFence = gDXUniformRing.mRing.GetCurrentFence();
     if (context->Map(d3dBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &srd) == S_OK)
     {
         Pegasus::Utils::Memcpy(srd.pData, static_cast<const char*>(src) + offset, size);
         context->Unmap(d3dBuffer, 0);
+
+        //a transient buffer may be bound to a range of the ring, its slots see the own buffer
+        if (dstBuffer->GetConfig().mTransient)
+        {
+            DXRebindUniformBuffer(dstBuffer->GetConfig(), bufferGpuData);
+        }
     }
     else
     {
@@ -1295,9 +1585,6 @@ bool Pegasus::Render::SetUniformTexture(Pegasus::Render::Uniform& u, Pegasus::Te
 
 bool Pegasus::Render::SetUniformBuffer(Pegasus::Render::Uniform& u, const BufferRef& buffer)
 {
-    ID3D11DeviceContext * context;
-    ID3D11Device * device;
-    Pegasus::Render::GetDeviceAndContext(&device, &context);
     DXProgramGPUData * programData = gDXState.mDispatchedShader;
 	if (programData != nullptr && programData->mProgramValid && ProcessUpdateUniform(u,programData))
     {
@@ -1307,8 +1594,10 @@ bool Pegasus::Render::SetUniformBuffer(Pegasus::Render::Uniform& u, const Buffer
             return false;
         }
         Pegasus::Render::DXBufferGPUData* gpuData = PEGASUS_GRAPH_GPUDATA_SAFECAST(Pegasus::Render::DXBufferGPUData, buffer->GetInternalData());
-        ID3D11Buffer* d3dBuffer = gpuData->mBuffer;
-        PG_ASSERT(d3dBuffer != nullptr);
+        if (buffer->GetConfig().mTransient && gpuData->mRingFence != gDXUniformRing.mRing.GetCurrentFence())
+        {
+            PG_LOG('ERR_', "Transient uniform buffer bound to \"%s\" was not written this frame, its contents are undefined.", u.mName);
+        }
         Pegasus::Render::DXProgramGPUData::UniformReflectionData& reflectionData = programData->mReflectionData[u.mInternalIndex];
 		for (int s = 0; s < reflectionData.mStageCount; ++s)
         {
@@ -1318,29 +1607,7 @@ bool Pegasus::Render::SetUniformBuffer(Pegasus::Render::Uniform& u, const Buffer
                 PG_LOG('ERR_', "Size of cbuffer too small. Target size of \"%s\" must be %d bytes, instead expecting %d bytes", u.mName, binding.mSize, buffer->GetConfig().mSize);
                 continue;
             }
-            switch(binding.mPipelineType)
-            {
-            case Pegasus::Shader::FRAGMENT:
-                context->PSSetConstantBuffers(binding.mBindPoint, 1, &d3dBuffer);
-                break;
-            case Pegasus::Shader::VERTEX:
-                context->VSSetConstantBuffers(binding.mBindPoint, 1, &d3dBuffer);
-                break;
-            case Pegasus::Shader::TESSELATION_CONTROL:
-                context->HSSetConstantBuffers(binding.mBindPoint, 1, &d3dBuffer);
-                break;
-            case Pegasus::Shader::TESSELATION_EVALUATION:
-                context->DSSetConstantBuffers(binding.mBindPoint, 1, &d3dBuffer);
-                break;
-            case Pegasus::Shader::GEOMETRY:
-                context->GSSetConstantBuffers(binding.mBindPoint, 1, &d3dBuffer);
-                break;
-            case Pegasus::Shader::COMPUTE:
-                context->CSSetConstantBuffers(binding.mBindPoint, 1, &d3dBuffer);
-                break;
-            default:
-                PG_FAIL();
-            };
+            DXBindUniformBuffer(binding.mPipelineType, binding.mBindPoint, buffer->GetConfig(), gpuData);
         }
         return true;
     }
@@ -438,6 +438,7 @@ void DXShaderFactory::GenerateProgramGPUData(Pegasus::Shader::ProgramLinkage * p
     programGPUData->mInputLayoutBlob = nullptr;
     programGPUData->mProgramValid = false;
     programGPUData->mReflectionDataCount = 0; //empty the reflection data
+    programGPUData->mReflectionLookup.Clear();
     for (int i = 0; i < programGPUData->mGlobalUniformCount; ++i) 
     {
         programGPUData->mGlobalUniforms[i] = Render::Uniform();
@@ -567,7 +568,9 @@ void DXShaderFactory::PopulateReflectionData(Pegasus::Render::DXProgramGPUData*
 
         //find semantic
         Pegasus::Render::DXProgramGPUData::UniformReflectionData* targetReflectionData = nullptr;
-        for (int r = 0; r < programData->mReflectionDataCount; ++r)
+        const unsigned int nameHash = Pegasus::Utils::HashStr(inputBindDesc.Name);
+        unsigned int cursor = 0;
+        for (int r = programData->mReflectionLookup.Find(nameHash, cursor); r != -1; r = programData->mReflectionLookup.Find(nameHash, cursor))
         {
             Pegasus::Render::DXProgramGPUData::UniformReflectionData& candidate = programData->mReflectionData[r];
             if (!Pegasus::Utils::Strcmp(inputBindDesc.Name, candidate.mUniformName))
@@ -600,6 +603,7 @@ void DXShaderFactory::PopulateReflectionData(Pegasus::Render::DXProgramGPUData*
                 programData->mReflectionData = newList;
                 programData->mReflectionDataCapacity = newCapacity;
             }
+            programData->mReflectionLookup.Add(mAllocator, nameHash, programData->mReflectionDataCount);
             targetReflectionData = &programData->mReflectionData[programData->mReflectionDataCount++];
             targetReflectionData->mUniformName[0] = '\0';
             targetReflectionData->mStageCount = 0;
@@ -616,7 +620,7 @@ void DXShaderFactory::PopulateReflectionData(Pegasus::Render::DXProgramGPUData*
     }
 }
 
-extern bool UpdateUniformLocation(Pegasus::Render::DXProgramGPUData* programGPUData, const char * name, Pegasus::Render::Uniform& outputUniform);
+extern bool UpdateUniformLocation(Pegasus::Render::DXProgramGPUData* programGPUData, const char * name, unsigned int nameHash, Pegasus::Render::Uniform& outputUniform);
 
 void DXShaderFactory::PopulateGlobalUniformData(Pegasus::Render::DXProgramGPUData* programGPUData)
 {
@@ -626,7 +630,8 @@ void DXShaderFactory::PopulateGlobalUniformData(Pegasus::Render::DXProgramGPUDat
         GlobalShaderConstantDesc& desc = mGlobalConstants[i];
         Render::Uniform& candidateUniform = programGPUData->mGlobalUniforms[programGPUData->mGlobalUniformCount];
         Render::BufferRef& candidateBuffer = programGPUData->mGlobalBuffers[programGPUData->mGlobalUniformCount];
-        if (UpdateUniformLocation(programGPUData, desc.name, candidateUniform))
+        Render::SetUniformName(candidateUniform, desc.name);
+        if (UpdateUniformLocation(programGPUData, desc.name, candidateUniform.mNameHash, candidateUniform))
         {
             candidateBuffer = desc.buffer;
             ++programGPUData->mGlobalUniformCount;
@@ -149,13 +149,13 @@ void GLMeshFactory::GenerateMeshGPUData(Pegasus::Mesh::MeshData * nodeData)
             glBindBuffer(GL_COPY_WRITE_BUFFER, gpuData->mBufferTable[stream]);
             if (newlyAllocated)
             {
-                glBufferData(GL_COPY_WRITE_BUFFER, byteSize, nodeData->GetStream<void>(stream),
+                glBufferData(GL_COPY_WRITE_BUFFER, byteSize, nodeData->GetConstStream<void>(stream),
                              meshConfig.GetIsDynamic() ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
             }
             else
             {
                 //! \todo Investigate the use of glMapBuffer(), may be faster
-                glBufferSubData(GL_COPY_WRITE_BUFFER, 0, byteSize, nodeData->GetStream<void>(stream));
+                glBufferSubData(GL_COPY_WRITE_BUFFER, 0, byteSize, nodeData->GetConstStream<void>(stream));
             }
         }
     }
@@ -0,0 +1,263 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   NullCommandLog.cpp
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Log of the render API calls recorded by the null render backend.
+//!         Built with every backend so tools can link against it, only filled by the null backend.
+
+#include "Pegasus/Render/NullCommandLog.h"
+#include "Pegasus/Allocator/IAllocator.h"
+#include "Pegasus/Allocator/Alloc.h"
+#include "Pegasus/Memory/MemoryManager.h"
+#include "Pegasus/Utils/Memcpy.h"
+#include "Pegasus/Utils/Memset.h"
+#include "Pegasus/Utils/String.h"
+
+namespace Pegasus
+{
+namespace Render
+{
+
+//! Initial number of commands of the log, about the size of a small frame
+static const unsigned int NULL_COMMAND_LOG_INITIAL_CAPACITY = 1024;
+
+//! Names of the commands, must match NullCommandType
+static const char * const gNullCommandNames[NULL_CMD_COUNT] =
+{
+    "SetProgram",
+    "SetMesh",
+    "UnbindMesh",
+    "SetViewport",
+    "SetRenderTargets",
+    "SetDefaultRenderTarget",
+    "Clear",
+    "SetClearColor",
+    "SetDepthClearValue",
+    "SetRasterizerState",
+    "SetBlendingState",
+    "SetPrimitiveMode",
+    "SetBuffer",
+    "SetUniformBuffer",
+    "SetUniformResource",
+    "SetSampler",
+    "SetComputeOutput",
+    "UnbindComputeOutputs",
+    "UnbindResources",
+    "Draw",
+    "DrawIndirect",
+    "Dispatch",
+    "GenerateMips",
+    "BeginMarker",
+    "EndMarker",
+    "Error"
+};
+
+//! Names of the validation errors, must match NullValidationError
+static const char * const gNullErrorNames[NULL_ERR_COUNT] =
+{
+    "NoProgram",
+    "NoMesh",
+    "InvalidUniform",
+    "BufferOverflow",
+    "RenderTargetCount",
+    "UnbalancedMarker",
+    "NotComputeProgram",
+    "InvalidResource",
+    "StaleTransientBuffer"
+};
+
+//----------------------------------------------------------------------------------------
+
+NullCommandLog::NullCommandLog(Alloc::IAllocator * allocator)
+:   mAllocator(allocator)
+,   mCommands(nullptr)
+,   mCommandCount(0)
+,   mCommandCapacity(0)
+,   mRecording(true)
+{
+    Clear();
+}
+
+//----------------------------------------------------------------------------------------
+
+NullCommandLog::~NullCommandLog()
+{
+    if (mCommands != nullptr)
+    {
+        PG_DELETE_ARRAY(mAllocator, mCommands);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void NullCommandLog::Record(NullCommandType type, int arg0, int arg1, int arg2, int arg3)
+{
+    PG_ASSERTSTR(type >= 0 && type < NULL_CMD_COUNT, "Invalid null render command type (%d)", type);
+    ++mCounters[type];
+
+    if (mRecording)
+    {
+        if (mCommandCount == mCommandCapacity)
+        {
+            Grow();
+        }
+        NullCommand & command = mCommands[mCommandCount++];
+        command.mType = type;
+        command.mArgs[0] = arg0;
+        command.mArgs[1] = arg1;
+        command.mArgs[2] = arg2;
+        command.mArgs[3] = arg3;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void NullCommandLog::RecordError(NullValidationError error, NullCommandType failedCommand)
+{
+    PG_ASSERTSTR(error >= 0 && error < NULL_ERR_COUNT, "Invalid null render validation error (%d)", error);
+    ++mErrorCounters[error];
+    PG_LOG('ERR_', "Null render: %s error in %s", gNullErrorNames[error], gNullCommandNames[failedCommand]);
+    Record(NULL_CMD_ERROR, error, failedCommand);
+}
+
+//----------------------------------------------------------------------------------------
+
+void NullCommandLog::Clear()
+{
+    mCommandCount = 0;
+    Utils::Memset32(mCounters, 0, sizeof(mCounters));
+    Utils::Memset32(mErrorCounters, 0, sizeof(mErrorCounters));
+}
+
+//----------------------------------------------------------------------------------------
+
+const NullCommand & NullCommandLog::GetCommand(unsigned int index) const
+{
+    PG_ASSERTSTR(index < mCommandCount, "Invalid null render command index (%u), the log has %u commands", index, mCommandCount);
+    return mCommands[index];
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int NullCommandLog::GetStateChangeCount() const
+{
+    unsigned int count = 0;
+    for (int type = 0; type < NULL_CMD_COUNT; ++type)
+    {
+        switch (type)
+        {
+        case NULL_CMD_DRAW:
+        case NULL_CMD_DRAW_INDIRECT:
+        case NULL_CMD_DISPATCH:
+        case NULL_CMD_BEGIN_MARKER:
+        case NULL_CMD_END_MARKER:
+        case NULL_CMD_ERROR:
+            break;
+        default:
+            count += mCounters[type];
+        }
+    }
+    return count;
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int NullCommandLog::ComputeHash() const
+{
+    unsigned int hash = 2166136261u;
+    const unsigned char * bytes = reinterpret_cast<const unsigned char *>(mCommands);
+    const unsigned int byteCount = mCommandCount * sizeof(NullCommand);
+    for (unsigned int b = 0; b < byteCount; ++b)
+    {
+        hash = (hash ^ bytes[b]) * 16777619u;
+    }
+    return hash;
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int NullCommandLog::Print(char * buffer, unsigned int bufferSize) const
+{
+    PG_ASSERTSTR(buffer != nullptr && bufferSize > 0, "Invalid buffer to print the null render command log");
+    buffer[0] = '\0';
+    unsigned int length = 0;
+    unsigned int c = 0;
+    for (; c < mCommandCount; ++c)
+    {
+        const NullCommand & command = mCommands[c];
+        char line[128];
+        line[0] = '\0';
+        Utils::Strcat(line, gNullCommandNames[command.mType]);
+        for (int a = 0; a < NullCommand::ARG_COUNT; ++a)
+        {
+            Utils::Strcat(line, " ");
+            Utils::Strcat(line, command.mArgs[a]);
+        }
+        Utils::Strcat(line, "\n");
+
+        const unsigned int lineLength = Utils::Strlen(line);
+        if (length + lineLength + 1 > bufferSize)
+        {
+            break;
+        }
+        Utils::Memcpy(buffer + length, line, lineLength + 1);
+        length += lineLength;
+    }
+    return c;
+}
+
+//----------------------------------------------------------------------------------------
+
+const char * NullCommandLog::GetCommandName(NullCommandType type)
+{
+    PG_ASSERTSTR(type >= 0 && type < NULL_CMD_COUNT, "Invalid null render command type (%d)", type);
+    return gNullCommandNames[type];
+}
+
+//----------------------------------------------------------------------------------------
+
+const char * NullCommandLog::GetErrorName(NullValidationError error)
+{
+    PG_ASSERTSTR(error >= 0 && error < NULL_ERR_COUNT, "Invalid null render validation error (%d)", error);
+    return gNullErrorNames[error];
+}
+
+//----------------------------------------------------------------------------------------
+
+void NullCommandLog::Grow()
+{
+    if (mAllocator == nullptr)
+    {
+        mAllocator = Memory::GetRenderAllocator();
+    }
+
+    const unsigned int newCapacity = (mCommandCapacity == 0) ? NULL_COMMAND_LOG_INITIAL_CAPACITY : mCommandCapacity * 2;
+    NullCommand * newCommands = PG_NEW_ARRAY(mAllocator, -1, "NullCommandLog", Pegasus::Alloc::PG_MEM_PERM, NullCommand, newCapacity);
+    if (mCommands != nullptr)
+    {
+        Utils::Memcpy(newCommands, mCommands, mCommandCount * sizeof(NullCommand));
+        PG_DELETE_ARRAY(mAllocator, mCommands);
+    }
+    mCommands = newCommands;
+    mCommandCapacity = newCapacity;
+}
+
+//----------------------------------------------------------------------------------------
+
+NullCommandLog * GetNullCommandLog()
+{
+#if PEGASUS_GAPI_NULL
+    static NullCommandLog sNullCommandLog;
+    return &sNullCommandLog;
+#else
+    return nullptr;
+#endif
+}
+
+}
+}
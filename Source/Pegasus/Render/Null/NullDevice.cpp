@@ -0,0 +1,43 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   NullDevice.cpp
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Device of the null render backend, owns no GPU
+
+#if PEGASUS_GAPI_NULL
+
+#include "../Source/Pegasus/Render/Null/NullDevice.h"
+
+namespace Pegasus
+{
+namespace Render
+{
+
+NullDevice::NullDevice(const DeviceConfig& config, Alloc::IAllocator * allocator)
+: IDevice(config, allocator)
+{
+}
+
+NullDevice::~NullDevice()
+{
+}
+
+//! platform implementation of device
+IDevice * IDevice::CreatePlatformDevice(const DeviceConfig& config, Alloc::IAllocator * allocator)
+{
+    return PG_NEW(allocator, -1, "Device", Pegasus::Alloc::PG_MEM_PERM) NullDevice(config, allocator);
+}
+
+}//namespace Render
+}//namespace Pegasus
+
+#else
+
+PEGASUS_AVOID_EMPTY_FILE_WARNING
+
+#endif
@@ -0,0 +1,38 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   NullDevice.h
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Device of the null render backend, owns no GPU
+
+#ifndef PEGASUS_NULLDEVICE_H
+#define PEGASUS_NULLDEVICE_H
+
+#include "Pegasus/Render/IDevice.h"
+
+
+namespace Pegasus
+{
+namespace Render
+{
+
+//! Headless device, the render API calls are recorded into the null command log
+class NullDevice : public IDevice
+{
+public:
+    //! Constructor
+    //! \param config the configuration needed
+    //! \param render allocator for internal allocations
+    NullDevice(const DeviceConfig& config, Alloc::IAllocator * allocator);
+    virtual ~NullDevice();
+};
+
+}
+}
+
+
+#endif
@@ -0,0 +1,120 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   NullGpuDataDefs.h
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Pegasus null backend definitions of gpu data for render elements.
+//!         No GPU object exists, the data only holds what the validation and the command log need.
+
+#ifndef PEGASUS_NULLGPUDATADEF_H
+#define PEGASUS_NULLGPUDATADEF_H
+
+#include "Pegasus/Graph/NodeGpuData.h"
+#include "Pegasus/Shader/Shared/ShaderDefs.h"
+#include "Pegasus/Mesh/MeshData.h"
+#include "Pegasus/Render/Render.h"
+#include "Pegasus/Render/UniformLookup.h"
+#include "Pegasus/Render/NullCommandLog.h"
+
+#define NULL_MAX_UNIFORM_NAME 64
+#define NULL_UNIFORM_DATA_INCREMENT 16
+#define NULL_GLOBAL_UNIFORM_COUNT 8
+
+namespace Pegasus
+{
+namespace Render
+{
+
+//! Gives the id of a new resource, in creation order starting at 1
+int NullCreateResourceId();
+
+//! Allocator of the shader factory, owning the uniform tables of the programs
+Alloc::IAllocator * GetNullShaderAllocator();
+
+struct NullShaderGPUData
+{
+    PEGASUS_GRAPH_REGISTER_GPUDATA_RTTI(NullShaderGPUData, 0x1);
+    Pegasus::Shader::ShaderType mType;
+    bool mCompiled;
+};
+
+struct NullProgramGPUData
+{
+    PEGASUS_GRAPH_REGISTER_GPUDATA_RTTI(NullProgramGPUData, 0x2);
+
+    //! Uniform names requested from the program. Without a shader compiler there is no reflection,
+    //! so every name requested gets a slot, in request order.
+    struct UniformData
+    {
+        char mUniformName[NULL_MAX_UNIFORM_NAME];
+    }* mUniforms;
+    int mUniformCount;
+    int mUniformCapacity;
+
+    //! Index of mUniforms by uniform name hash
+    Render::UniformLookup mUniformLookup;
+
+    int mProgramGuid;
+    int mProgramVersion;
+    bool mProgramValid;
+    bool mIsCompute;
+
+    // Global uniforms pushed by render systems. For example, cameras.
+    Render::Uniform   mGlobalUniforms[NULL_GLOBAL_UNIFORM_COUNT];
+    Render::BufferRef mGlobalBuffers[NULL_GLOBAL_UNIFORM_COUNT];
+    int mGlobalUniformCount;
+};
+
+struct NullBufferGPUData
+{
+    PEGASUS_GRAPH_REGISTER_GPUDATA_RTTI(NullBufferGPUData, 0x3);
+    int mId;
+    int mSize;
+
+    //transient uniform buffers: range of the last write in the uniform ring, -1 if it did not fit in the ring
+    int mRingOffset;
+    unsigned int mRingFence;
+};
+
+struct NullMeshGPUData
+{
+    PEGASUS_GRAPH_REGISTER_GPUDATA_RTTI(NullMeshGPUData, 0x4);
+    int mId;
+    bool mIsIndexed;
+    bool mIsIndirect;
+    int mIndexCount;
+    int mVertexCount;
+
+    // buffer description
+    NullBufferGPUData mVertexStreams[MESH_MAX_STREAMS];
+    NullBufferGPUData mIndexStream;
+    NullBufferGPUData mIndirectDrawStream;
+
+    // internal buffers so user can access them. Just wrap the vertex streams.
+    Render::BufferRef mVertexBuffers[MESH_MAX_STREAMS];
+    Render::BufferRef mIndexBuffer;
+    Render::BufferRef mDrawIndirectBuffer;
+
+    //levels of detail, ranges of the index stream. mIndexCount is the count of the most detailed one.
+    Mesh::MeshLod mLods[Mesh::MESH_MAX_LODS];
+    int mLodCount;
+};
+
+//! Gpu data of every other resource: textures, render targets, depth stencils, cube maps,
+//! volume textures, samplers, rasterizer and blending states
+struct NullResourceGPUData
+{
+    PEGASUS_GRAPH_REGISTER_GPUDATA_RTTI(NullResourceGPUData, 0x5);
+    int mId;
+    int mWidth;
+    int mHeight;
+};
+
+} //namespace Render
+} //namespace Pegasus
+
+#endif
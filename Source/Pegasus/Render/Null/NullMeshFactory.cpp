@@ -0,0 +1,175 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   NullMeshFactory.cpp
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Null backend mesh factory implementation, keeps the counts and levels of detail the draws need
+
+#if PEGASUS_GAPI_NULL
+
+#include "Pegasus/Render/MeshFactory.h"
+#include "Pegasus/Mesh/MeshData.h"
+#include "Pegasus/Mesh/MeshConfiguration.h"
+#include "Pegasus/Graph/Node.h"
+#include "Pegasus/Memory/MemoryManager.h"
+
+#include "../Source/Pegasus/Render/Null/NullGpuDataDefs.h"
+
+class NullMeshFactory : public Pegasus::Mesh::IMeshFactory
+{
+public:
+    NullMeshFactory() : mAllocator(nullptr){}
+    virtual ~NullMeshFactory(){}
+
+
+    virtual void Initialize(Pegasus::Alloc::IAllocator * allocator);
+
+    virtual void GenerateMeshGPUData(Pegasus::Mesh::MeshData * nodeData);
+
+    virtual void DestroyNodeGPUData(Pegasus::Mesh::MeshData * nodeData);
+
+    virtual Pegasus::Alloc::IAllocator * GetAllocator() { return mAllocator; }
+
+private:
+    Pegasus::Render::NullMeshGPUData* GetOrAllocateGPUData(Pegasus::Mesh::MeshData * nodeData);
+
+    //! Wrap a stream of the mesh into a render buffer
+    Pegasus::Render::BufferRef CreateBufferWrapper(Pegasus::Render::NullBufferGPUData& stream, const char * debugName);
+
+    Pegasus::Alloc::IAllocator* mAllocator;
+};
+
+Pegasus::Render::BufferRef NullMeshFactory::CreateBufferWrapper(Pegasus::Render::NullBufferGPUData& stream, const char * debugName)
+{
+    stream.mId = Pegasus::Render::NullCreateResourceId();
+    stream.mSize = 0;
+    stream.mRingOffset = -1;
+    stream.mRingFence = ~0u;
+    Pegasus::Render::Buffer* bufferWrapper = PG_NEW(Pegasus::Memory::GetRenderAllocator(), -1, debugName, Pegasus::Alloc::PG_MEM_TEMP) Pegasus::Render::Buffer(Pegasus::Memory::GetRenderAllocator());
+    bufferWrapper->SetInternalData(&stream);
+    return bufferWrapper;
+}
+
+Pegasus::Render::NullMeshGPUData* NullMeshFactory::GetOrAllocateGPUData(Pegasus::Mesh::MeshData * nodeData)
+{
+    Pegasus::Graph::NodeGPUData* nodeGpuData = nodeData->GetNodeGPUData();
+    if (nodeGpuData == nullptr)
+    {
+        Pegasus::Render::NullMeshGPUData* meshGpuData = PG_NEW(
+            mAllocator,
+            -1,
+            "NullMeshGPUData",
+            Pegasus::Alloc::PG_MEM_PERM
+        ) Pegasus::Render::NullMeshGPUData;
+
+        meshGpuData->mId = Pegasus::Render::NullCreateResourceId();
+        meshGpuData->mIsIndexed = false;
+        meshGpuData->mIsIndirect = false;
+        meshGpuData->mVertexCount = 0;
+        meshGpuData->mIndexCount = 0;
+        meshGpuData->mLodCount = 0;
+
+        for (unsigned i = 0; i < MESH_MAX_STREAMS; ++i)
+        {
+            meshGpuData->mVertexBuffers[i] = CreateBufferWrapper(meshGpuData->mVertexStreams[i], "VertexStreamBuffer");
+        }
+        meshGpuData->mDrawIndirectBuffer = CreateBufferWrapper(meshGpuData->mIndirectDrawStream, "IndirectDrawBufferStream");
+        meshGpuData->mIndexBuffer = CreateBufferWrapper(meshGpuData->mIndexStream, "IndexStreamBuffer");
+
+        nodeGpuData = reinterpret_cast<Pegasus::Graph::NodeGPUData*>(meshGpuData);
+        nodeData->SetNodeGPUData(nodeGpuData);
+    };
+
+    return PEGASUS_GRAPH_GPUDATA_SAFECAST(Pegasus::Render::NullMeshGPUData, nodeGpuData);
+
+}
+
+void NullMeshFactory::Initialize(Pegasus::Alloc::IAllocator * allocator)
+{
+    mAllocator = allocator;
+}
+
+void NullMeshFactory::GenerateMeshGPUData(Pegasus::Mesh::MeshData * nodeData)
+{
+    const Pegasus::Mesh::MeshConfiguration& configuration = nodeData->GetConfiguration();
+    Pegasus::Render::NullMeshGPUData*   meshGpuData = GetOrAllocateGPUData(nodeData);
+    meshGpuData->mIsIndexed = configuration.GetIsIndexed();
+    meshGpuData->mIsIndirect = configuration.GetIsDrawIndirect();
+
+    int vertexCount = nodeData->GetVertexCount();
+    meshGpuData->mVertexCount = vertexCount;
+    PG_ASSERTSTR(vertexCount != 0, "Cannot pass 0 size vertex buffer. Forgot to call AllocVertices on meshData?");
+    for (int streamIndex = 0; streamIndex < MESH_MAX_STREAMS; ++streamIndex)
+    {
+        meshGpuData->mVertexStreams[streamIndex].mSize = nodeData->GetStreamStride(streamIndex) * vertexCount;
+    }
+
+    meshGpuData->mIndexCount = 0;
+    meshGpuData->mLodCount = 0;
+    meshGpuData->mIndexStream.mSize = 0;
+    if (configuration.GetIsIndexed())
+    {
+        meshGpuData->mIndexCount = nodeData->GetIndexCount();
+        meshGpuData->mIndexStream.mSize = nodeData->GetIndexCount() * sizeof(unsigned short);
+        PG_ASSERTSTR( nodeData->GetIndexCount() != 0, "Cannot pass 0 size index buffer. Forgot to call AllocIndices on meshData?");
+
+        //all the levels of detail live in the index stream, a plain draw only renders the most detailed one
+        meshGpuData->mLodCount = nodeData->GetLodCount();
+        for (int lod = 0; lod < meshGpuData->mLodCount; ++lod)
+        {
+            meshGpuData->mLods[lod] = nodeData->GetLod(lod);
+        }
+        if (meshGpuData->mLodCount > 0)
+        {
+            meshGpuData->mIndexCount = meshGpuData->mLods[0].mIndexCount;
+        }
+    }
+
+    meshGpuData->mIndirectDrawStream.mSize = configuration.GetIsDrawIndirect() ? 5 * 4 : 0; //5 arguments, 4 bytes each.
+
+    nodeData->ValidateGPUData();
+}
+
+void NullMeshFactory::DestroyNodeGPUData(Pegasus::Mesh::MeshData * nodeData)
+{
+    Pegasus::Graph::NodeGPUData* nodeGpuData = nodeData->GetNodeGPUData();
+    if (nodeGpuData != nullptr)
+    {
+        Pegasus::Render::NullMeshGPUData* meshGpuData = PEGASUS_GRAPH_GPUDATA_SAFECAST(Pegasus::Render::NullMeshGPUData, nodeGpuData);
+        //the wrappers can outlive the mesh, they must not point to its streams anymore
+        for (int i = 0; i < MESH_MAX_STREAMS; ++i)
+        {
+            meshGpuData->mVertexBuffers[i]->SetInternalData(nullptr);
+        }
+        meshGpuData->mIndexBuffer->SetInternalData(nullptr);
+        meshGpuData->mDrawIndirectBuffer->SetInternalData(nullptr);
+
+        PG_DELETE(mAllocator, meshGpuData);
+        nodeData->SetNodeGPUData(nullptr);
+    }
+}
+
+namespace Pegasus
+{
+
+namespace Render
+{
+
+NullMeshFactory gMeshFactory;
+
+Mesh::IMeshFactory * GetRenderMeshFactory()
+{
+    return &gMeshFactory;
+}
+
+}
+
+}
+
+#else
+PEGASUS_AVOID_EMPTY_FILE_WARNING
+#endif
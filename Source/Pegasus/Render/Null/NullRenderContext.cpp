@@ -0,0 +1,111 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   NullRenderContext.cpp
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Null backend implementation of render context
+
+#if PEGASUS_GAPI_NULL
+
+#include "Pegasus/Render/RenderContext.h"
+#include "Pegasus/Render/UniformRing.h"
+#include "../Source/Pegasus/Render/Null/NullRenderContext.h"
+#include "../Source/Pegasus/Render/Null/NullDevice.h"
+
+namespace RenderPrivate
+{
+    Pegasus::Render::NullRenderContext * gBindedContext = nullptr;
+};
+
+namespace Pegasus {
+namespace Render {
+
+NullRenderContext* NullRenderContext::GetBindedContext()
+{
+    return RenderPrivate::gBindedContext;
+}
+
+void NullRenderContext::BindRenderContext(NullRenderContext* context)
+{
+    RenderPrivate::gBindedContext = context;
+}
+
+NullRenderContext::NullRenderContext(const ContextConfig& config)
+ :
+  mDevice(static_cast<NullDevice*>(config.mDevice)),
+  mFrameBufferWidth(config.mWidth),
+  mFrameBufferHeight(config.mHeight),
+  mFrameCount(0)
+{
+}
+
+void NullRenderContext::Resize(int width, int height)
+{
+    mFrameBufferWidth = width;
+    mFrameBufferHeight = height;
+}
+
+Context::Context(const ContextConfig& config)
+    : mAllocator(config.mAllocator),
+      mParentDevice(config.mDevice),
+      mPrivateData(nullptr)
+{
+    PG_ASSERT(mParentDevice != nullptr);
+    NullRenderContext * renderContext = PG_NEW(
+        mAllocator,
+        -1,
+        "NullRenderContext",
+        Alloc::PG_MEM_PERM
+    ) NullRenderContext(config);
+
+    mPrivateData = static_cast<PrivateContextData>(renderContext);
+    Bind();
+}
+
+
+Context::~Context()
+{
+    NullRenderContext * context = static_cast<NullRenderContext*>(mPrivateData);
+    if (context == RenderPrivate::gBindedContext)
+        Unbind();
+    PG_DELETE(mAllocator, context);
+}
+
+
+void Context::Bind() const
+{
+    NullRenderContext * context = static_cast<NullRenderContext*>(mPrivateData);
+    NullRenderContext::BindRenderContext(context);
+}
+
+
+void Context::Unbind() const
+{ 
+    NullRenderContext::BindRenderContext(nullptr);
+}
+
+
+void Context::Swap() const
+{
+    NullRenderContext * context = static_cast<NullRenderContext*>(mPrivateData);
+    context->Present();
+    EndUniformRingFrame();
+}
+
+void Context::Resize(int width, int height)
+{
+    NullRenderContext * context = static_cast<NullRenderContext*>(mPrivateData);
+    context->Resize(width, height);
+}
+
+}//namespace Render
+}//namespace Pegasus
+#else
+
+PEGASUS_AVOID_EMPTY_FILE_WARNING
+
+#endif
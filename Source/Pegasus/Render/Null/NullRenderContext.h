@@ -0,0 +1,65 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   NullRenderContext.h
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Render context of the null render backend, a frame buffer size without a swap chain
+
+#ifndef PEGASUS_NULL_CONTEXT_H
+#define PEGASUS_NULL_CONTEXT_H
+
+#include "Pegasus/Render/RenderContextConfig.h"
+
+namespace Pegasus
+{
+namespace Render
+{
+
+class NullDevice;
+
+//! Class that wraps the active context in the application
+class NullRenderContext
+{
+public:
+
+    //! constructor
+    //! \param config configuration of the context, the window handle is ignored
+    explicit NullRenderContext(const ContextConfig& config);
+
+    //! \return the binded context, nullptr if none
+    static NullRenderContext* GetBindedContext();
+
+    //! bind the current context passed for global access
+    static void BindRenderContext(NullRenderContext* context);
+
+    //! callback when the window has resized
+    void Resize(int width, int height);
+
+    //! get the device
+    NullDevice* GetDevice() const { return mDevice; }
+
+    //! get the size of the frame buffer
+    int GetWidth() const { return mFrameBufferWidth; }
+    int GetHeight() const { return mFrameBufferHeight; }
+
+    //! get the number of presented frames
+    int GetFrameCount() const { return mFrameCount; }
+
+    //! count a presented frame
+    void Present() { ++mFrameCount; }
+
+private:
+    NullDevice * mDevice;
+    int mFrameBufferWidth;
+    int mFrameBufferHeight;
+    int mFrameCount;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,945 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   NullRenderImpl.cpp
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Null implementation of PARR. No GPU object is created, every call is validated
+//!         the way the DirectX backend does it and recorded in the null command log
+
+#if PEGASUS_GAPI_NULL
+
+#include "Pegasus/Memory/MemoryManager.h"
+#include "Pegasus/Allocator/IAllocator.h"
+#include "Pegasus/Render/MeshFactory.h"
+#include "Pegasus/Render/Render.h"
+#include "Pegasus/Render/NullCommandLog.h"
+#include "Pegasus/Render/UniformRing.h"
+#include "Pegasus/Render/UniformLookup.h"
+#include "Pegasus/Math/Constants.h"
+#include "Pegasus/Texture/Texture.h"
+#include "Pegasus/Utils/Memcpy.h"
+#include "Pegasus/Utils/String.h"
+#include "../Source/Pegasus/Render/Null/NullRenderContext.h"
+#include "../Source/Pegasus/Render/Null/NullGpuDataDefs.h"
+
+/// MACROS ///
+#define MAX_UAV_SLOT_COUNT 8
+
+//uniform ring with the size and alignment of the DirectX backend,
+//the null GPU completes a frame that many frames after its end
+#define NULL_UNIFORM_RING_SIZE (1024 * 1024)
+#define NULL_UNIFORM_RING_ALIGNMENT 256
+#define NULL_UNIFORM_RING_LATENCY 2
+
+#define RENDER_NEW(__type) \
+        PG_NEW(Pegasus::Memory::GetRenderAllocator(), -1, #__type, Pegasus::Alloc::PG_MEM_PERM) __type(Pegasus::Memory::GetRenderAllocator())
+
+#define RENDER_NEW_GPU_DATA(__type) \
+        PG_NEW(Pegasus::Memory::GetRenderAllocator(), -1, #__type, Pegasus::Alloc::PG_MEM_PERM) __type()
+
+//////////////
+
+//////////////////        GLOBALS CODE BLOCK     //////////////////////////////
+//         All globals holding state data are declared on this block       ////
+///////////////////////////////////////////////////////////////////////////////
+
+struct NullState
+{
+    int mDispatchedProgramVersion;
+    Pegasus::Render::NullProgramGPUData * mDispatchedShader;
+    Pegasus::Render::NullMeshGPUData    * mDispatchedMeshGpuData;
+    Pegasus::Render::PrimitiveMode        mPrimitiveMode;
+    int mTargetsCount;
+    int mComputeOutputs[MAX_UAV_SLOT_COUNT];
+    int mMarkerDepth;
+} gNullState = { 0, nullptr, nullptr, Pegasus::Render::PRIMITIVE_AUTOMATIC, 0, { 0 }, 0 };
+
+//! Uniform ring of the transient uniform buffers, the memory stands for the persistently mapped buffer
+static Pegasus::Render::UniformRing gNullUniformRing;
+static char gNullUniformRingData[NULL_UNIFORM_RING_SIZE];
+
+//! Allocate a range of the uniform ring. The null GPU completes the oldest frame when the CPU waits for it.
+//! \return False if the range does not fit in the current frame
+static bool NullAllocateUniformRing(unsigned int size, unsigned int& outOffset)
+{
+    if (gNullUniformRing.GetCapacity() == 0)
+    {
+        gNullUniformRing.Initialize(NULL_UNIFORM_RING_SIZE, NULL_UNIFORM_RING_ALIGNMENT);
+    }
+    while (!gNullUniformRing.Allocate(size, outOffset))
+    {
+        if (gNullUniformRing.GetPendingFrameCount() == 0)
+        {
+            return false;
+        }
+        gNullUniformRing.RetireFrame();
+    }
+    return true;
+}
+
+const Pegasus::Render::UniformRing& Pegasus::Render::GetUniformRing()
+{
+    return gNullUniformRing;
+}
+
+void Pegasus::Render::EndUniformRingFrame()
+{
+    if (gNullUniformRing.GetCapacity() != 0)
+    {
+        gNullUniformRing.EndFrame();
+        while (gNullUniformRing.GetPendingFrameCount() > NULL_UNIFORM_RING_LATENCY)
+        {
+            gNullUniformRing.RetireFrame();
+        }
+    }
+}
+
+//! Next id given to a created resource
+static int gNextResourceId = 1;
+
+int Pegasus::Render::NullCreateResourceId()
+{
+    return gNextResourceId++;
+}
+
+//! Id of the resource behind the internal data of a render resource, 0 if there is none
+static int NullGetResourceId(void * internalData)
+{
+    if (internalData == nullptr)
+    {
+        return 0;
+    }
+    Pegasus::Render::NullResourceGPUData * resourceData = PEGASUS_GRAPH_GPUDATA_SAFECAST(Pegasus::Render::NullResourceGPUData, internalData);
+    return resourceData->mId;
+}
+
+//! Id of a buffer, 0 if there is none
+static int NullGetBufferId(const Pegasus::Render::BufferRef& buffer)
+{
+    if (buffer == nullptr || buffer->GetInternalData() == nullptr)
+    {
+        return 0;
+    }
+    Pegasus::Render::NullBufferGPUData * bufferData = PEGASUS_GRAPH_GPUDATA_SAFECAST(Pegasus::Render::NullBufferGPUData, buffer->GetInternalData());
+    return bufferData->mId;
+}
+
+//! Convert a [0, 1] float into fixed point units, so the log holds no floating point value
+static int NullToFixed(float value, float units)
+{
+    return static_cast<int>(value * units + (value >= 0.0f ? 0.5f : -0.5f));
+}
+
+// ---------------------------------------------------------------------------
+
+///////////////////////////////////////////////////////////////////////////////
+/////////////   SetProgram FUNCTION IMPLEMENTATION /////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+void Pegasus::Render::SetProgram (Pegasus::Shader::ProgramLinkageInOut program)
+{
+    bool updated = false;
+    Pegasus::Graph::NodeGPUData * nodeGpuData = program->GetUpdatedData(updated)->GetNodeGPUData();
+    Pegasus::Render::NullProgramGPUData * shaderGpuData = PEGASUS_GRAPH_GPUDATA_SAFECAST(Pegasus::Render::NullProgramGPUData, nodeGpuData);
+    if (shaderGpuData->mProgramValid)
+    {
+        if (gNullState.mDispatchedShader != shaderGpuData || gNullState.mDispatchedProgramVersion != shaderGpuData->mProgramVersion)
+        {
+            gNullState.mDispatchedShader = shaderGpuData;
+            gNullState.mDispatchedProgramVersion = shaderGpuData->mProgramVersion;
+            GetNullCommandLog()->Record(NULL_CMD_SET_PROGRAM, shaderGpuData->mProgramGuid, shaderGpuData->mProgramVersion);
+
+            //set the global uniforms this program might have.
+            for (int i = 0; i < shaderGpuData->mGlobalUniformCount; ++i)
+            {
+                SetUniformBuffer(shaderGpuData->mGlobalUniforms[i], shaderGpuData->mGlobalBuffers[i]);
+            }
+        }
+    }
+    else
+    {
+        gNullState.mDispatchedShader = nullptr;
+        gNullState.mDispatchedProgramVersion = 0;
+        GetNullCommandLog()->RecordError(NULL_ERR_NO_PROGRAM, NULL_CMD_SET_PROGRAM);
+    }
+}
+
+int Pegasus::Render::GetProgramVersion (Pegasus::Shader::ProgramLinkageInOut program)
+{
+    bool updated = false;
+    Pegasus::Graph::NodeGPUData * nodeGpuData = program->GetUpdatedData(updated)->GetNodeGPUData();
+    Pegasus::Render::NullProgramGPUData * shaderGpuData = PEGASUS_GRAPH_GPUDATA_SAFECAST(Pegasus::Render::NullProgramGPUData, nodeGpuData);
+    return shaderGpuData->mProgramVersion;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+/////////////   Samplers FUNCTION IMPLEMENTATION /////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+Pegasus::Render::SamplerStateRef Pegasus::Render::CreateSamplerState(const Pegasus::Render::SamplerStateConfig& config)
+{
+    Pegasus::Render::SamplerStateRef sampler = RENDER_NEW(Pegasus::Render::SamplerState);
+    Pegasus::Render::NullResourceGPUData* samplerData = RENDER_NEW_GPU_DATA(Pegasus::Render::NullResourceGPUData);
+    samplerData->mId = NullCreateResourceId();
+    samplerData->mWidth = 0;
+    samplerData->mHeight = 0;
+    sampler->SetConfig(config);
+    sampler->SetInternalData(samplerData);
+    return sampler;
+}
+
+static void NullSetSampler(Pegasus::Shader::ShaderType stage, Pegasus::Render::SamplerStateRef& sampler, int slot)
+{
+    const int samplerId = NullGetResourceId(sampler->GetInternalData());
+    if (samplerId == 0)
+    {
+        Pegasus::Render::GetNullCommandLog()->RecordError(Pegasus::Render::NULL_ERR_INVALID_RESOURCE, Pegasus::Render::NULL_CMD_SET_SAMPLER);
+        return;
+    }
+    Pegasus::Render::GetNullCommandLog()->Record(Pegasus::Render::NULL_CMD_SET_SAMPLER, stage, slot, samplerId);
+}
+
+void Pegasus::Render::SetComputeSampler(Pegasus::Render::SamplerStateRef& sampler, int slot)
+{
+    NullSetSampler(Pegasus::Shader::COMPUTE, sampler, slot);
+}
+
+void Pegasus::Render::SetPixelSampler(Pegasus::Render::SamplerStateRef& sampler, int slot)
+{
+    NullSetSampler(Pegasus::Shader::FRAGMENT, sampler, slot);
+}
+
+void Pegasus::Render::SetVertexSampler(Pegasus::Render::SamplerStateRef& sampler, int slot)
+{
+    NullSetSampler(Pegasus::Shader::VERTEX, sampler, slot);
+}
+
+template<>
+Pegasus::Render::BasicResource<Pegasus::Render::SamplerStateConfig>::~BasicResource()
+{
+    if (GetInternalData() != nullptr)
+    {
+        Pegasus::Render::NullResourceGPUData* samplerData = PEGASUS_GRAPH_GPUDATA_SAFECAST(Pegasus::Render::NullResourceGPUData, GetInternalData());
+        PG_DELETE(Pegasus::Memory::GetRenderAllocator(), samplerData);
+    }
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+/////////////   SetMesh FUNCTION IMPLEMENTATION /////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+void Pegasus::Render::SetMesh (Pegasus::Mesh::MeshInOut mesh)
+{
+    Pegasus::Mesh::MeshDataRef meshData = mesh->GetUpdatedMeshData();
+    if (meshData == nullptr)
+    {
+        PG_LOG('ERR_',"Attempting to set invalid node data.");
+        GetNullCommandLog()->RecordError(NULL_ERR_INVALID_RESOURCE, NULL_CMD_SET_MESH);
+        return;
+    }
+
+    if (gNullState.mDispatchedShader == nullptr)
+    {
+        PG_LOG('ERR_', "Must dispatch a program before trying to set a mesh.");
+        GetNullCommandLog()->RecordError(NULL_ERR_NO_PROGRAM, NULL_CMD_SET_MESH);
+        return;
+    }
+
+    Pegasus::Graph::NodeGPUData * nodeGpuData = meshData->GetNodeGPUData();
+    Pegasus::Render::NullMeshGPUData * meshGpuData = PEGASUS_GRAPH_GPUDATA_SAFECAST(Pegasus::Render::NullMeshGPUData, nodeGpuData);
+    gNullState.mDispatchedMeshGpuData = meshGpuData;
+    GetNullCommandLog()->Record(NULL_CMD_SET_MESH, meshGpuData->mId, meshGpuData->mVertexCount, meshGpuData->mIndexCount);
+}
+
+void Pegasus::Render::UnbindMesh()
+{
+    gNullState.mDispatchedMeshGpuData = nullptr;
+    GetNullCommandLog()->Record(NULL_CMD_UNBIND_MESH);
+}
+
+Pegasus::Render::BufferRef Pegasus::Render::GetIndexBuffer(Pegasus::Mesh::MeshDataRef nodeData)
+{
+    PG_ASSERT(nodeData->GetConfiguration().GetIsIndexed());
+    Pegasus::Render::NullMeshGPUData * meshGpuData = PEGASUS_GRAPH_GPUDATA_SAFECAST(Pegasus::Render::NullMeshGPUData, nodeData->GetNodeGPUData());
+    return meshGpuData->mIndexBuffer;
+}
+
+Pegasus::Render::BufferRef Pegasus::Render::GetVertexBuffer(Pegasus::Mesh::MeshDataRef nodeData, int streamId)
+{
+    PG_ASSERT(streamId >= 0 && streamId < MESH_MAX_STREAMS);
+    Pegasus::Render::NullMeshGPUData * meshGpuData = PEGASUS_GRAPH_GPUDATA_SAFECAST(Pegasus::Render::NullMeshGPUData, nodeData->GetNodeGPUData());
+    return meshGpuData->mVertexBuffers[streamId];
+}
+
+Pegasus::Render::BufferRef Pegasus::Render::GetDrawIndirectBuffer(Pegasus::Mesh::MeshDataRef nodeData)
+{
+    Pegasus::Render::NullMeshGPUData * meshGpuData = PEGASUS_GRAPH_GPUDATA_SAFECAST(Pegasus::Render::NullMeshGPUData, nodeData->GetNodeGPUData());
+    return meshGpuData->mDrawIndirectBuffer;
+}
+
+// ---------------------------------------------------------------------------
+///////////////////////////////////////////////////////////////////////////////
+/////////////   SetViewport FUNCTION IMPLEMENTATION //////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void Pegasus::Render::SetViewport(const Pegasus::Render::Viewport& viewport)
+{
+    PG_ASSERTSTR(NullRenderContext::GetBindedContext() != nullptr, "must bind a context!!");
+    GetNullCommandLog()->Record(NULL_CMD_SET_VIEWPORT, viewport.mXOffset, viewport.mYOffset, viewport.mWidth, viewport.mHeight);
+}
+
+void Pegasus::Render::SetViewport(const Pegasus::Render::RenderTargetRef& viewport)
+{
+    PG_ASSERTSTR(NullRenderContext::GetBindedContext() != nullptr, "must bind a context!!");
+    GetNullCommandLog()->Record(NULL_CMD_SET_VIEWPORT, 0, 0, viewport->GetConfig().mWidth, viewport->GetConfig().mHeight);
+}
+
+void Pegasus::Render::SetViewport(const Pegasus::Render::DepthStencilRef& viewport)
+{
+    PG_ASSERTSTR(NullRenderContext::GetBindedContext() != nullptr, "must bind a context!!");
+    GetNullCommandLog()->Record(NULL_CMD_SET_VIEWPORT, 0, 0, viewport->GetConfig().mWidth, viewport->GetConfig().mHeight);
+}
+
+// ---------------------------------------------------------------------------
+///////////////////////////////////////////////////////////////////////////////
+/////////////   SetRenderTargets FUNCTION IMPLEMENTATION //////////////////////
+///////////////////////////////////////////////////////////////////////////////
+void Pegasus::Render::SetRenderTarget (Pegasus::Render::RenderTargetRef& renderTarget)
+{
+    Pegasus::Render::SetRenderTargets(1, &renderTarget);
+}
+
+void Pegasus::Render::SetRenderTarget (Pegasus::Render::RenderTargetRef& renderTarget, Pegasus::Render::DepthStencilRef& depthStencil)
+{
+    Pegasus::Render::SetRenderTargets(1, &renderTarget, depthStencil);
+}
+
+void Pegasus::Render::SetRenderTargets (int renderTargetCount, Pegasus::Render::RenderTargetRef* renderTarget)
+{
+    DepthStencilRef ds = nullptr;
+    Pegasus::Render::SetRenderTargets(renderTargetCount, renderTarget, ds);
+}
+
+void Pegasus::Render::SetRenderTargets (int renderTargetNum, Pegasus::Render::RenderTargetRef* renderTarget, Pegasus::Render::DepthStencilRef& depthStencil)
+{
+    PG_ASSERTSTR(NullRenderContext::GetBindedContext() != nullptr, "must bind a context!!");
+    if (renderTargetNum < 0 || renderTargetNum > Pegasus::Render::Constants::MAX_RENDER_TARGETS)
+    {
+        GetNullCommandLog()->RecordError(NULL_ERR_RENDER_TARGET_COUNT, NULL_CMD_SET_RENDER_TARGETS);
+        return;
+    }
+
+    for (int i = 0; i < renderTargetNum; ++i)
+    {
+        if (renderTarget[i] == nullptr || renderTarget[i]->GetInternalData() == nullptr)
+        {
+            GetNullCommandLog()->RecordError(NULL_ERR_INVALID_RESOURCE, NULL_CMD_SET_RENDER_TARGETS);
+            return;
+        }
+    }
+
+    gNullState.mTargetsCount = renderTargetNum;
+    const int firstTargetId = renderTargetNum > 0 ? NullGetResourceId(renderTarget[0]->GetInternalData()) : 0;
+    const int depthStencilId = depthStencil != nullptr ? NullGetResourceId(depthStencil->GetInternalData()) : 0;
+    GetNullCommandLog()->Record(NULL_CMD_SET_RENDER_TARGETS, renderTargetNum, firstTargetId, depthStencilId);
+}
+
+void Pegasus::Render::SetComputeOutput(BufferRef buffer, int slot)
+{
+    PG_ASSERT(slot < MAX_UAV_SLOT_COUNT);
+    gNullState.mComputeOutputs[slot] = NullGetBufferId(buffer);
+    GetNullCommandLog()->Record(NULL_CMD_SET_COMPUTE_OUTPUT, slot, gNullState.mComputeOutputs[slot]);
+}
+
+void Pegasus::Render::SetComputeOutput(VolumeTextureRef buffer, int slot)
+{
+    PG_ASSERT(slot < MAX_UAV_SLOT_COUNT);
+    gNullState.mComputeOutputs[slot] = NullGetResourceId(buffer->GetInternalData());
+    GetNullCommandLog()->Record(NULL_CMD_SET_COMPUTE_OUTPUT, slot, gNullState.mComputeOutputs[slot]);
+}
+
+void Pegasus::Render::SetComputeOutput(RenderTargetRef renderTarget, int slot)
+{
+    PG_ASSERT(slot < MAX_UAV_SLOT_COUNT);
+    gNullState.mComputeOutputs[slot] = NullGetResourceId(renderTarget->GetInternalData());
+    GetNullCommandLog()->Record(NULL_CMD_SET_COMPUTE_OUTPUT, slot, gNullState.mComputeOutputs[slot]);
+}
+
+void Pegasus::Render::UnbindComputeOutputs()
+{
+    for (int i = 0; i < MAX_UAV_SLOT_COUNT; ++i)
+    {
+        gNullState.mComputeOutputs[i] = 0;
+    }
+    GetNullCommandLog()->Record(NULL_CMD_UNBIND_COMPUTE_OUTPUTS);
+}
+
+// ---------------------------------------------------------------------------
+
+void Pegasus::Render::UnbindRenderTargets()
+{
+    gNullState.mTargetsCount = 0;
+    GetNullCommandLog()->Record(NULL_CMD_SET_RENDER_TARGETS, 0, 0, 0);
+}
+
+// ---------------------------------------------------------------------------
+
+void Pegasus::Render::DispatchDefaultRenderTarget()
+{
+    NullRenderContext * ctx = NullRenderContext::GetBindedContext();
+    PG_ASSERTSTR(ctx != nullptr, "must bind a context!!");
+    gNullState.mTargetsCount = 1;
+    GetNullCommandLog()->Record(NULL_CMD_SET_DEFAULT_RENDER_TARGET, ctx->GetWidth(), ctx->GetHeight());
+}
+
+// ---------------------------------------------------------------------------
+
+///////////////////////////////////////////////////////////////////////////////
+/////////////   Clear FUNCTION IMPLEMENTATION           ///////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void Pegasus::Render::Clear(bool color, bool depth, bool stencil)
+{
+    GetNullCommandLog()->Record(NULL_CMD_CLEAR, color ? 1 : 0, depth ? 1 : 0, stencil ? 1 : 0);
+}
+
+// ---------------------------------------------------------------------------
+
+void Pegasus::Render::SetClearColorValue(const Pegasus::Math::ColorRGBA& color)
+{
+    GetNullCommandLog()->Record(
+        NULL_CMD_SET_CLEAR_COLOR,
+        NullToFixed(color.red, 255.0f),
+        NullToFixed(color.green, 255.0f),
+        NullToFixed(color.blue, 255.0f),
+        NullToFixed(color.alpha, 255.0f)
+    );
+}
+
+// ---------------------------------------------------------------------------
+
+void Pegasus::Render::SetRasterizerState(const Pegasus::Render::RasterizerStateRef& rasterState)
+{
+    Pegasus::Render::SetRasterizerState(rasterState, 0);
+}
+
+void Pegasus::Render::SetRasterizerState(const Pegasus::Render::RasterizerStateRef& rasterState, unsigned int stencilRefValue)
+{
+    const int rasterizerId = NullGetResourceId(rasterState->GetInternalData());
+    if (rasterizerId == 0)
+    {
+        GetNullCommandLog()->RecordError(NULL_ERR_INVALID_RESOURCE, NULL_CMD_SET_RASTERIZER_STATE);
+        return;
+    }
+    GetNullCommandLog()->Record(NULL_CMD_SET_RASTERIZER_STATE, rasterizerId, static_cast<int>(stencilRefValue));
+}
+
+// ---------------------------------------------------------------------------
+
+void Pegasus::Render::SetBlendingState(const Pegasus::Render::BlendingStateRef blendingState)
+{
+    const int blendingId = NullGetResourceId(blendingState->GetInternalData());
+    if (blendingId == 0)
+    {
+        GetNullCommandLog()->RecordError(NULL_ERR_INVALID_RESOURCE, NULL_CMD_SET_BLENDING_STATE);
+        return;
+    }
+    GetNullCommandLog()->Record(NULL_CMD_SET_BLENDING_STATE, blendingId);
+}
+
+// ---------------------------------------------------------------------------
+
+void Pegasus::Render::SetDepthClearValue(float d)
+{
+    GetNullCommandLog()->Record(NULL_CMD_SET_DEPTH_CLEAR_VALUE, NullToFixed(d, 65535.0f));
+}
+
+// ---------------------------------------------------------------------------
+
+void Pegasus::Render::SetPrimitiveMode(Pegasus::Render::PrimitiveMode mode)
+{
+    PG_ASSERT(mode >= 0 && mode < Pegasus::Render::PRIMITIVE_COUNT);
+    gNullState.mPrimitiveMode = mode;
+    GetNullCommandLog()->Record(NULL_CMD_SET_PRIMITIVE_MODE, mode);
+}
+
+// ---------------------------------------------------------------------------
+
+///////////////////////////////////////////////////////////////////////////////
+/////////////   Draw FUNCTION IMPLEMENTATION            ///////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+static void DrawInternal(unsigned int instanceCount, float screenSize)
+{
+    Pegasus::Render::NullCommandLog * log = Pegasus::Render::GetNullCommandLog();
+    if (gNullState.mDispatchedShader == nullptr)
+    {
+        log->RecordError(Pegasus::Render::NULL_ERR_NO_PROGRAM, Pegasus::Render::NULL_CMD_DRAW);
+        return;
+    }
+    if (gNullState.mDispatchedMeshGpuData == nullptr)
+    {
+        PG_LOG('ERR_', "A mesh must be set properly before calling draw!.");
+        log->RecordError(Pegasus::Render::NULL_ERR_NO_MESH, Pegasus::Render::NULL_CMD_DRAW);
+        return;
+    }
+    Pegasus::Render::NullMeshGPUData* mesh = gNullState.mDispatchedMeshGpuData;
+
+    if (mesh->mIsIndirect)
+    {
+        log->Record(Pegasus::Render::NULL_CMD_DRAW_INDIRECT, mesh->mId);
+    }
+    else if (mesh->mIsIndexed)
+    {
+        //levels of detail are ranges of the index stream, selected the same way as Mesh::MeshData::SelectLod()
+        int lod = 0;
+        while (lod + 1 < mesh->mLodCount && screenSize <= mesh->mLods[lod + 1].mMaxScreenSize)
+        {
+            ++lod;
+        }
+        const int indexCount = mesh->mLodCount > 0 ? mesh->mLods[lod].mIndexCount : mesh->mIndexCount;
+        const int indexOffset = mesh->mLodCount > 0 ? mesh->mLods[lod].mIndexOffset : 0;
+        log->Record(Pegasus::Render::NULL_CMD_DRAW, indexCount, static_cast<int>(instanceCount), indexOffset, lod);
+    }
+    else
+    {
+        log->Record(Pegasus::Render::NULL_CMD_DRAW, mesh->mVertexCount, static_cast<int>(instanceCount), 0, 0);
+    }
+}
+
+void Pegasus::Render::Draw()
+{
+    DrawInternal(0, PFLOAT_MAX);
+}
+
+void Pegasus::Render::DrawInstanced(unsigned int instanceCount)
+{
+    if (instanceCount > 0)
+    {
+        DrawInternal(instanceCount, PFLOAT_MAX);
+    }
+}
+
+void Pegasus::Render::DrawLod(float screenSize)
+{
+    DrawInternal(0, screenSize);
+}
+
+void Pegasus::Render::Dispatch(unsigned int x, unsigned int y, unsigned int z)
+{
+    if (gNullState.mDispatchedShader == nullptr)
+    {
+        GetNullCommandLog()->RecordError(NULL_ERR_NO_PROGRAM, NULL_CMD_DISPATCH);
+        return;
+    }
+    if (!gNullState.mDispatchedShader->mIsCompute)
+    {
+        GetNullCommandLog()->RecordError(NULL_ERR_NOT_COMPUTE_PROGRAM, NULL_CMD_DISPATCH);
+        return;
+    }
+    GetNullCommandLog()->Record(NULL_CMD_DISPATCH, static_cast<int>(x), static_cast<int>(y), static_cast<int>(z));
+}
+
+// ---------------------------------------------------------------------------
+
+///////////////////////////////////////////////////////////////////////////////
+/////////////   GET UNIFORM FUNCTION IMPLEMENTATIONS    ///////////////////////
+///////////////////////////////////////////////////////////////////////////////
+bool NullUpdateUniformLocation(Pegasus::Render::NullProgramGPUData* programGPUData, const char * name, unsigned int nameHash, Pegasus::Render::Uniform& outputUniform)
+{
+    if (!programGPUData->mProgramValid)
+    {
+        return false;
+    }
+
+    //only the uniforms sharing the hash of the name are compared
+    int r = -1;
+    unsigned int cursor = 0;
+    for (int candidate = programGPUData->mUniformLookup.Find(nameHash, cursor); candidate != -1; candidate = programGPUData->mUniformLookup.Find(nameHash, cursor))
+    {
+        if (!Pegasus::Utils::Strcmp(name, programGPUData->mUniforms[candidate].mUniformName))
+        {
+            r = candidate;
+            break;
+        }
+    }
+
+    //no reflection without a shader compiler, a name requested for the first time gets the next slot
+    if (r == -1)
+    {
+        r = programGPUData->mUniformCount;
+        if (Pegasus::Utils::Strlen(name) >= NULL_MAX_UNIFORM_NAME)
+        {
+            PG_LOG('ERR_', "Uniform name %s is too long for the null backend.", name);
+            return false;
+        }
+
+        if (programGPUData->mUniformCount == programGPUData->mUniformCapacity)
+        {
+            Pegasus::Alloc::IAllocator * allocator = Pegasus::Render::GetNullShaderAllocator();
+            programGPUData->mUniformCapacity += NULL_UNIFORM_DATA_INCREMENT;
+            Pegasus::Render::NullProgramGPUData::UniformData * newUniforms = PG_NEW_ARRAY(
+                allocator,
+                -1,
+                "NullProgramGPUData uniforms",
+                Pegasus::Alloc::PG_MEM_PERM,
+                Pegasus::Render::NullProgramGPUData::UniformData,
+                programGPUData->mUniformCapacity
+            );
+            if (programGPUData->mUniforms != nullptr)
+            {
+                Pegasus::Utils::Memcpy(newUniforms, programGPUData->mUniforms, programGPUData->mUniformCount * sizeof(Pegasus::Render::NullProgramGPUData::UniformData));
+                PG_DELETE_ARRAY(allocator, programGPUData->mUniforms);
+            }
+            programGPUData->mUniforms = newUniforms;
+        }
+
+        char * uniformName = programGPUData->mUniforms[r].mUniformName;
+        uniformName[0] = '\0';
+        Pegasus::Utils::Strcat(uniformName, name);
+        ++programGPUData->mUniformCount;
+        programGPUData->mUniformLookup.Add(Pegasus::Render::GetNullShaderAllocator(), nameHash, r);
+    }
+
+    outputUniform.mInternalIndex = r;
+    outputUniform.mInternalOwner = programGPUData->mProgramGuid;
+    outputUniform.mInternalVersion = programGPUData->mProgramVersion;
+    return true;
+}
+
+static bool ProcessUpdateUniform(Pegasus::Render::Uniform& u, Pegasus::Render::NullProgramGPUData * programGpuData)
+{
+    //the location stays valid until the program links again, or the uniform is used with another program
+    if (u.mInternalVersion != programGpuData->mProgramVersion || u.mInternalOwner != programGpuData->mProgramGuid)
+    {
+        if (u.mNameHash == 0)
+        {
+            u.mNameHash = Pegasus::Utils::HashStr(u.mName);
+        }
+        return NullUpdateUniformLocation(programGpuData, u.mName, u.mNameHash, u);
+    }
+    return true;
+}
+
+
+bool Pegasus::Render::GetUniformLocation(Pegasus::Shader::ProgramLinkageInOut program, const char * name, Pegasus::Render::Uniform& outputUniform)
+{
+    PG_ASSERT(program != nullptr);
+    bool dummy = false;
+    Pegasus::Graph::NodeDataRef nodeData = program->GetUpdatedData(dummy);
+    Pegasus::Graph::NodeGPUData * nodeGPUData = nodeData->GetNodeGPUData();
+    PG_ASSERT(nodeGPUData != nullptr);
+    Pegasus::Render::NullProgramGPUData * programGPUData = PEGASUS_GRAPH_GPUDATA_SAFECAST(Pegasus::Render::NullProgramGPUData, nodeGPUData);
+    Pegasus::Render::SetUniformName(outputUniform, name);
+    return NullUpdateUniformLocation(programGPUData, name, outputUniform.mNameHash, outputUniform);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/////////////   CREATEUNIFORMBUFFER IMPLEMENTATION      ///////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+static Pegasus::Render::BufferRef NullCreateBuffer(int bufferSize, bool transient = false)
+{
+    Pegasus::Render::Buffer* b = RENDER_NEW(Pegasus::Render::Buffer);
+    Pegasus::Render::NullBufferGPUData* bufferGpuData = RENDER_NEW_GPU_DATA(Pegasus::Render::NullBufferGPUData);
+    bufferGpuData->mId = Pegasus::Render::NullCreateResourceId();
+    bufferGpuData->mSize = bufferSize;
+    bufferGpuData->mRingOffset = -1;
+    bufferGpuData->mRingFence = ~0u;
+
+    Pegasus::Render::BufferConfig bc;
+    bc.mSize = bufferSize;
+    bc.mTransient = transient;
+    b->SetConfig(bc);
+    b->SetInternalData(bufferGpuData);
+    return b;
+}
+
+Pegasus::Render::BufferRef Pegasus::Render::CreateUniformBuffer(int size, bool transient)
+{
+    return NullCreateBuffer(size, transient);
+}
+
+Pegasus::Render::BufferRef Pegasus::Render::CreateComputeBuffer(int bufferSize, int elementCount, bool makeUniformBuffer)
+{
+    PG_ASSERTSTR(elementCount <= 0 || (bufferSize % elementCount) == 0, "Compute buffer byte size is not a multiple of its stride.");
+    return NullCreateBuffer(bufferSize);
+}
+
+Pegasus::Render::BufferRef Pegasus::Render::CreateStructuredReadBuffer(int bufferSize, int elementCount)
+{
+    PG_ASSERTSTR(elementCount > 0 && (bufferSize % elementCount) == 0, "Structured buffer byte size is not a multiple of its stride.");
+    return NullCreateBuffer(bufferSize);
+}
+
+template<>
+Pegasus::Render::BasicResource<Pegasus::Render::BufferConfig>::~BasicResource()
+{
+    if (GetInternalData() != nullptr)
+    {
+        Pegasus::Render::NullBufferGPUData * gpuData = PEGASUS_GRAPH_GPUDATA_SAFECAST(Pegasus::Render::NullBufferGPUData, GetInternalData());
+        PG_DELETE(Pegasus::Memory::GetRenderAllocator(), gpuData);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/////////////   GENERIC MIP GENERATION                  ///////////////////////
+///////////////////////////////////////////////////////////////////////////////
+void Pegasus::Render::GenerateMips(Pegasus::Render::RenderTargetRef& renderTarget)
+{
+    GetNullCommandLog()->Record(NULL_CMD_GENERATE_MIPS, NullGetResourceId(renderTarget->GetInternalData()));
+}
+
+void Pegasus::Render::GenerateMips(Pegasus::Render::CubeMapRef& cubeMap)
+{
+    GetNullCommandLog()->Record(NULL_CMD_GENERATE_MIPS, NullGetResourceId(cubeMap->GetInternalData()));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/////////////   CREATERASTERSTATE IMPLEMENTATION      ///////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+Pegasus::Render::RasterizerStateRef Pegasus::Render::CreateRasterizerState(const Pegasus::Render::RasterizerConfig& config)
+{
+    Pegasus::Render::RasterizerState* rasterizerState = RENDER_NEW(Pegasus::Render::RasterizerState);
+    Pegasus::Render::NullResourceGPUData* stateData = RENDER_NEW_GPU_DATA(Pegasus::Render::NullResourceGPUData);
+    stateData->mId = NullCreateResourceId();
+    stateData->mWidth = 0;
+    stateData->mHeight = 0;
+    rasterizerState->SetConfig(config);
+    rasterizerState->SetInternalData(stateData);
+    return rasterizerState;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/////////////   CREATEBLENDIGNSTATE IMPLEMENTATION      ///////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+Pegasus::Render::BlendingStateRef Pegasus::Render::CreateBlendingState(const Pegasus::Render::BlendingConfig& config)
+{
+    Pegasus::Render::BlendingState* blendingState = RENDER_NEW(Pegasus::Render::BlendingState);
+    Pegasus::Render::NullResourceGPUData* stateData = RENDER_NEW_GPU_DATA(Pegasus::Render::NullResourceGPUData);
+    stateData->mId = NullCreateResourceId();
+    stateData->mWidth = 0;
+    stateData->mHeight = 0;
+    blendingState->SetConfig(config);
+    blendingState->SetInternalData(stateData);
+    return blendingState;
+}
+
+template<>
+Pegasus::Render::BasicResource<Pegasus::Render::RasterizerConfig>::~BasicResource()
+{
+    PG_ASSERT(GetInternalData() != nullptr);
+    Pegasus::Render::NullResourceGPUData* stateData = PEGASUS_GRAPH_GPUDATA_SAFECAST(Pegasus::Render::NullResourceGPUData, GetInternalData());
+    PG_DELETE(Pegasus::Memory::GetRenderAllocator(), stateData);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/////////////   DELETEBLENDIGNSTATE IMPLEMENTATION      ///////////////////////
+///////////////////////////////////////////////////////////////////////////////
+template<>
+Pegasus::Render::BasicResource<Pegasus::Render::BlendingConfig>::~BasicResource()
+{
+    PG_ASSERT(GetInternalData() != nullptr);
+    Pegasus::Render::NullResourceGPUData* stateData = PEGASUS_GRAPH_GPUDATA_SAFECAST(Pegasus::Render::NullResourceGPUData, GetInternalData());
+    PG_DELETE(Pegasus::Memory::GetRenderAllocator(), stateData);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/////////////   SETBUFFER IMPLEMENTATION                ///////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void Pegasus::Render::SetBuffer(Pegasus::Render::BufferRef& dstBuffer, const void * src, int size, int offset)
+{
+    const int bufferId = NullGetBufferId(dstBuffer);
+    if (bufferId == 0 || src == nullptr)
+    {
+        GetNullCommandLog()->RecordError(NULL_ERR_INVALID_RESOURCE, NULL_CMD_SET_BUFFER);
+        return;
+    }
+
+    size = size == -1 ? dstBuffer->GetConfig().mSize : size;
+    if (size + offset > dstBuffer->GetConfig().mSize)
+    {
+        GetNullCommandLog()->RecordError(NULL_ERR_BUFFER_OVERFLOW, NULL_CMD_SET_BUFFER);
+        return;
+    }
+    GetNullCommandLog()->Record(NULL_CMD_SET_BUFFER, bufferId, size, offset);
+
+    if (dstBuffer->GetConfig().mTransient)
+    {
+        //every write takes a new range of the ring, the bytes not written are undefined.
+        //Without space in the current frame the write goes to the own storage of the buffer.
+        Pegasus::Render::NullBufferGPUData * bufferData = PEGASUS_GRAPH_GPUDATA_SAFECAST(Pegasus::Render::NullBufferGPUData, dstBuffer->GetInternalData());
+        unsigned int ringOffset = 0;
+        if (NullAllocateUniformRing(dstBuffer->GetConfig().mSize, ringOffset))
+        {
+            Pegasus::Utils::Memcpy(gNullUniformRingData + ringOffset + offset, src, size);
+            bufferData->mRingOffset = static_cast<int>(ringOffset);
+        }
+        else
+        {
+            bufferData->mRingOffset = -1;
+        }
+        bufferData->mRingFence = gNullUniformRing.GetCurrentFence();
+
+        //the write moved the buffer in the ring, the global uniforms of the current program bind it again
+        Pegasus::Render::NullProgramGPUData * programData = gNullState.mDispatchedShader;
+        if (programData != nullptr)
+        {
+            for (int i = 0; i < programData->mGlobalUniformCount; ++i)
+            {
+                if (programData->mGlobalBuffers[i] == dstBuffer)
+                {
+                    SetUniformBuffer(programData->mGlobalUniforms[i], dstBuffer);
+                }
+            }
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+
+void Pegasus::Render::UnbindComputeResources()
+{
+    GetNullCommandLog()->Record(NULL_CMD_UNBIND_RESOURCES, Pegasus::Shader::COMPUTE);
+}
+
+void Pegasus::Render::UnbindPixelResources()
+{
+    GetNullCommandLog()->Record(NULL_CMD_UNBIND_RESOURCES, Pegasus::Shader::FRAGMENT);
+}
+
+void Pegasus::Render::UnbindVertexResources()
+{
+    GetNullCommandLog()->Record(NULL_CMD_UNBIND_RESOURCES, Pegasus::Shader::VERTEX);
+}
+
+//! Validate a uniform against the dispatched program and record its binding
+static bool InternalSetUniform(Pegasus::Render::Uniform& u, Pegasus::Render::NullCommandType command, int resourceId)
+{
+    Pegasus::Render::NullCommandLog * log = Pegasus::Render::GetNullCommandLog();
+    Pegasus::Render::NullProgramGPUData * programData = gNullState.mDispatchedShader;
+    if (programData == nullptr || !programData->mProgramValid)
+    {
+        log->RecordError(Pegasus::Render::NULL_ERR_NO_PROGRAM, command);
+        return false;
+    }
+    if (resourceId == 0)
+    {
+        log->RecordError(Pegasus::Render::NULL_ERR_INVALID_RESOURCE, command);
+        return false;
+    }
+    if (!ProcessUpdateUniform(u, programData) || u.mInternalIndex < 0 || u.mInternalIndex >= programData->mUniformCount)
+    {
+        PG_LOG('ERR_', "Fatal error when setting uniform %s. Does this uniform corresponds to the program?", u.mName);
+        log->RecordError(Pegasus::Render::NULL_ERR_INVALID_UNIFORM, command);
+        return false;
+    }
+    log->Record(command, programData->mProgramGuid, u.mInternalIndex, resourceId);
+    return true;
+}
+
+bool Pegasus::Render::SetUniformTexture(Pegasus::Render::Uniform& u, Pegasus::Texture::TextureInOut texture)
+{
+    Pegasus::Graph::NodeGPUData* nodeGpuData = texture->GetUpdatedTextureData()->GetNodeGPUData();
+    return InternalSetUniform(u, NULL_CMD_SET_UNIFORM_RESOURCE, NullGetResourceId(nodeGpuData));
+}
+
+// ---------------------------------------------------------------------------
+
+bool Pegasus::Render::SetUniformBuffer(Pegasus::Render::Uniform& u, const BufferRef& buffer)
+{
+    if (buffer != nullptr && buffer->GetConfig().mTransient && buffer->GetInternalData() != nullptr)
+    {
+        //the range of a previous frame may already hold the data of a later frame
+        Pegasus::Render::NullBufferGPUData * bufferData = PEGASUS_GRAPH_GPUDATA_SAFECAST(Pegasus::Render::NullBufferGPUData, buffer->GetInternalData());
+        if (bufferData->mRingFence != gNullUniformRing.GetCurrentFence())
+        {
+            GetNullCommandLog()->RecordError(NULL_ERR_STALE_TRANSIENT_BUFFER, NULL_CMD_SET_UNIFORM_BUFFER);
+            return false;
+        }
+    }
+    return InternalSetUniform(u, NULL_CMD_SET_UNIFORM_BUFFER, NullGetBufferId(buffer));
+}
+
+// ---------------------------------------------------------------------------
+
+bool Pegasus::Render::SetUniformTextureRenderTarget(Pegasus::Render::Uniform& u, const RenderTargetRef& renderTarget)
+{
+    return InternalSetUniform(u, NULL_CMD_SET_UNIFORM_RESOURCE, NullGetResourceId(renderTarget->GetInternalData()));
+}
+
+// ---------------------------------------------------------------------------
+
+bool Pegasus::Render::SetUniformDepth(Pegasus::Render::Uniform& u, const DepthStencilRef& depth)
+{
+    return InternalSetUniform(u, NULL_CMD_SET_UNIFORM_RESOURCE, NullGetResourceId(depth->GetInternalData()));
+}
+
+// ---------------------------------------------------------------------------
+
+bool Pegasus::Render::SetUniformStencil(Pegasus::Render::Uniform& u, const DepthStencilRef& stencil)
+{
+    return InternalSetUniform(u, NULL_CMD_SET_UNIFORM_RESOURCE, NullGetResourceId(stencil->GetInternalData()));
+}
+
+// ---------------------------------------------------------------------------
+
+bool Pegasus::Render::SetUniformBufferResource(Pegasus::Render::Uniform& u, const BufferRef& buffer)
+{
+    return InternalSetUniform(u, NULL_CMD_SET_UNIFORM_RESOURCE, NullGetBufferId(buffer));
+}
+
+bool Pegasus::Render::SetUniformVolume(Pegasus::Render::Uniform& u, const VolumeTextureRef& volume)
+{
+    return InternalSetUniform(u, NULL_CMD_SET_UNIFORM_RESOURCE, NullGetResourceId(volume->GetInternalData()));
+}
+
+// ---------------------------------------------------------------------------
+
+bool Pegasus::Render::SetUniformCubeMap(Pegasus::Render::Uniform& u, CubeMapRef& cubeMap)
+{
+    return InternalSetUniform(u, NULL_CMD_SET_UNIFORM_RESOURCE, NullGetResourceId(cubeMap->GetInternalData()));
+}
+
+// ---------------------------------------------------------------------------
+void Pegasus::Render::CleanInternalState()
+{
+    gNullState.mTargetsCount = 0;
+    gNullState.mDispatchedMeshGpuData = nullptr;
+    gNullState.mDispatchedShader = nullptr;
+    gNullState.mDispatchedProgramVersion = 0;
+    gNullState.mPrimitiveMode = Pegasus::Render::PRIMITIVE_AUTOMATIC;
+    for (int i = 0; i < MAX_UAV_SLOT_COUNT; ++i)
+    {
+        gNullState.mComputeOutputs[i] = 0;
+    }
+    gNullState.mMarkerDepth = 0;
+}
+
+void Pegasus::Render::BeginMarker(const char* marker)
+{
+    ++gNullState.mMarkerDepth;
+    GetNullCommandLog()->Record(NULL_CMD_BEGIN_MARKER, gNullState.mMarkerDepth);
+}
+
+void Pegasus::Render::EndMarker()
+{
+    if (gNullState.mMarkerDepth == 0)
+    {
+        GetNullCommandLog()->RecordError(NULL_ERR_UNBALANCED_MARKER, NULL_CMD_END_MARKER);
+        return;
+    }
+    --gNullState.mMarkerDepth;
+    GetNullCommandLog()->Record(NULL_CMD_END_MARKER, gNullState.mMarkerDepth);
+}
+
+#else
+PEGASUS_AVOID_EMPTY_FILE_WARNING
+#endif
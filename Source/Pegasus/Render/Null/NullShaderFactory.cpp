@@ -0,0 +1,344 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   NullShaderFactory.cpp
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Null backend shader factory implementation. Nothing gets compiled:
+//!         a stage compiles when it has a type and a source, a program links with the same rules as DirectX
+
+#if PEGASUS_GAPI_NULL
+
+#include "Pegasus/Core/Shared/CompilerEvents.h"
+#include "Pegasus/Render/ShaderFactory.h"
+#include "Pegasus/Graph/NodeData.h"
+#include "Pegasus/Shader/ProgramLinkage.h"
+#include "Pegasus/Shader/ShaderStage.h"
+#include "Pegasus/Shader/ShaderManager.h"
+#include "Pegasus/Utils/Vector.h"
+#include "../Source/Pegasus/Render/Null/NullGpuDataDefs.h"
+
+using namespace Pegasus;
+using namespace Pegasus::Core;
+
+static int gNextProgramGuid = 1;
+
+//! internal definition of shader factory API
+class NullShaderFactory : public Pegasus::Shader::IShaderFactory
+{
+public:
+    NullShaderFactory() : mShaderManager(nullptr), mAllocator(nullptr) {}
+    virtual ~NullShaderFactory(){}
+
+    virtual void Initialize(Pegasus::Alloc::IAllocator * allocator);
+
+    virtual void GenerateShaderGPUData(Pegasus::Shader::ShaderStage * shaderNode, Pegasus::Graph::NodeData * nodeData);
+
+    virtual void DestroyShaderGPUData (Pegasus::Graph::NodeData * nodeData);
+
+    virtual void GenerateProgramGPUData(Pegasus::Shader::ProgramLinkage * programNode, Pegasus::Graph::NodeData * nodeData);
+
+    virtual void DestroyProgramGPUData (Pegasus::Graph::NodeData * nodeData);
+
+    virtual void RegisterShaderManager(Pegasus::Shader::ShaderManager* shaderManager) { mShaderManager = shaderManager; }
+
+    void RegisterGlobalConstant(const char* globalConstantName, Render::BufferRef& buffer);
+
+    void ClearGlobalConstants() { mGlobalConstants.Clear(); }
+
+    Pegasus::Alloc::IAllocator * GetAllocator() { return mAllocator; }
+
+private:
+    Pegasus::Render::NullShaderGPUData* GetOrCreateShaderGpuData(Pegasus::Graph::NodeData* nodeData);
+    Pegasus::Render::NullProgramGPUData* GetOrCreateProgramGpuData(Pegasus::Graph::NodeData* nodeData);
+    void PopulateGlobalUniformData(Pegasus::Render::NullProgramGPUData* programData);
+    Pegasus::Alloc::IAllocator * mAllocator;
+    Pegasus::Shader::ShaderManager* mShaderManager;
+    struct GlobalShaderConstantDesc
+    {
+        const char* name;
+        Render::BufferRef buffer;
+    };
+    Utils::Vector<GlobalShaderConstantDesc> mGlobalConstants;
+};
+
+//! initializes the factory
+void NullShaderFactory::Initialize(Pegasus::Alloc::IAllocator * allocator)
+{
+    mAllocator = allocator;
+}
+
+void NullShaderFactory::RegisterGlobalConstant(const char* globalConstantName, Render::BufferRef& buffer)
+{
+    GlobalShaderConstantDesc& newDesc = mGlobalConstants.PushEmpty();
+    newDesc.name = globalConstantName;
+    newDesc.buffer = buffer;
+}
+
+//! allocates lazily or returns an existent shader gpu data
+Pegasus::Render::NullShaderGPUData* NullShaderFactory::GetOrCreateShaderGpuData(Pegasus::Graph::NodeData * data)
+{
+    Pegasus::Render::NullShaderGPUData* shaderGPUData = nullptr;
+    Pegasus::Graph::NodeGPUData* gpuData = data->GetNodeGPUData();
+    if (gpuData == nullptr)
+    {
+        shaderGPUData = PG_NEW(
+            mAllocator,
+            -1,
+            "Null Shader GPU Data",
+            Pegasus::Alloc::PG_MEM_TEMP
+        )
+        Pegasus::Render::NullShaderGPUData();
+        shaderGPUData->mType = Pegasus::Shader::SHADER_STAGE_INVALID;
+        shaderGPUData->mCompiled = false;
+        data->SetNodeGPUData(reinterpret_cast<Pegasus::Graph::NodeGPUData*>(shaderGPUData));
+    }
+    else
+    {
+        shaderGPUData = PEGASUS_GRAPH_GPUDATA_SAFECAST(Pegasus::Render::NullShaderGPUData, gpuData);
+    }
+
+    return shaderGPUData;
+}
+
+//! generator function that "compiles" a shader
+void NullShaderFactory::GenerateShaderGPUData(Pegasus::Shader::ShaderStage * shaderNode, Pegasus::Graph::NodeData * nodeData)
+{
+    const char * shaderSource = nullptr;
+    int shaderSourceSize = 0;
+    shaderNode->GetSource(&shaderSource, shaderSourceSize);
+
+    Pegasus::Render::NullShaderGPUData* shaderGPUData = GetOrCreateShaderGpuData(nodeData);
+    shaderGPUData->mType = shaderNode->GetStageType();
+    shaderGPUData->mCompiled = false;
+
+    if (shaderGPUData->mType < Pegasus::Shader::SHADER_STAGES_COUNT)
+    {
+        shaderGPUData->mCompiled = shaderSource != nullptr && shaderSourceSize > 0;
+        if (!shaderGPUData->mCompiled)
+        {
+            PG_LOG('CERR', "Shader Compilation Failure: empty source");
+        }
+
+        PEGASUS_EVENT_DISPATCH (
+            shaderNode,
+            CompilerEvents::CompilationEvent,
+            // Event specific arguments
+            shaderGPUData->mCompiled, //compilation success status
+            shaderGPUData->mCompiled ? "" : "Empty shader source"
+        );
+    }
+    nodeData->ValidateGPUData();
+}
+
+//!Destroy shader gpu data
+void NullShaderFactory::DestroyShaderGPUData (Pegasus::Graph::NodeData * nodeData)
+{
+    Pegasus::Graph::NodeGPUData* nodeGpuData = nodeData->GetNodeGPUData();
+    if (nodeGpuData != nullptr)
+    {
+        Pegasus::Render::NullShaderGPUData* shaderGPUData = PEGASUS_GRAPH_GPUDATA_SAFECAST(Pegasus::Render::NullShaderGPUData, nodeGpuData);
+        PG_DELETE(mAllocator, shaderGPUData);
+        nodeData->SetNodeGPUData(nullptr);
+    }
+}
+
+//! Create or inject new program gpu
+Pegasus::Render::NullProgramGPUData* NullShaderFactory::GetOrCreateProgramGpuData(Pegasus::Graph::NodeData* nodeData)
+{
+    Pegasus::Graph::NodeGPUData* nodeGPUData = nodeData->GetNodeGPUData();
+    Pegasus::Render::NullProgramGPUData* programGPUData = nullptr;
+    if (nodeGPUData == nullptr)
+    {
+        programGPUData = PG_NEW(
+            mAllocator,
+            -1,
+            "NullProgramGPUData",
+            Pegasus::Alloc::PG_MEM_PERM
+        ) Pegasus::Render::NullProgramGPUData;
+
+        nodeData->SetNodeGPUData(reinterpret_cast<Pegasus::Graph::NodeGPUData*>(programGPUData));
+        programGPUData->mProgramGuid = gNextProgramGuid++;
+        programGPUData->mProgramVersion = 0;
+        programGPUData->mProgramValid = false;
+        programGPUData->mIsCompute = false;
+        programGPUData->mUniforms = nullptr;
+        programGPUData->mUniformCount = 0;
+        programGPUData->mUniformCapacity = 0;
+        programGPUData->mGlobalUniformCount = 0;
+    }
+    else
+    {
+        programGPUData = PEGASUS_GRAPH_GPUDATA_SAFECAST(Pegasus::Render::NullProgramGPUData, nodeGPUData);
+    }
+    return programGPUData;
+}
+
+//! Create or inject new program gpu
+void NullShaderFactory::GenerateProgramGPUData(Pegasus::Shader::ProgramLinkage * programNode, Pegasus::Graph::NodeData * nodeData)
+{
+    Pegasus::Render::NullProgramGPUData* programGPUData = GetOrCreateProgramGpuData(nodeData);
+
+    programGPUData->mProgramValid = false;
+    programGPUData->mIsCompute = false;
+    programGPUData->mUniformCount = 0; //empty the uniform table
+    programGPUData->mUniformLookup.Clear();
+    for (int i = 0; i < programGPUData->mGlobalUniformCount; ++i)
+    {
+        programGPUData->mGlobalUniforms[i] = Render::Uniform();
+        programGPUData->mGlobalBuffers[i] = nullptr;
+    }
+    programGPUData->mGlobalUniformCount = 0;
+
+    bool hasStage[Pegasus::Shader::SHADER_STAGES_COUNT] = { false };
+    bool isProgramComplete = true; //assume true
+    for (unsigned i = 0; i < programNode->GetNumInputs(); ++i)
+    {
+        Pegasus::Shader::ShaderStageRef shaderStage = programNode->FindShaderStageInput(i);
+        if (shaderStage->GetStageType() != Pegasus::Shader::SHADER_STAGE_INVALID)
+        {
+            PG_ASSERT(shaderStage->GetStageType() < Pegasus::Shader::SHADER_STAGES_COUNT);
+            bool updated = false;
+            Pegasus::Graph::NodeDataRef shaderNodeDataRef = shaderStage->GetUpdatedData(updated);
+            Pegasus::Render::NullShaderGPUData * shaderStageGPUData = GetOrCreateShaderGpuData(&(*shaderNodeDataRef));
+            isProgramComplete = isProgramComplete && shaderStageGPUData->mCompiled;
+            hasStage[shaderStage->GetStageType()] = shaderStageGPUData->mCompiled;
+        }
+    }
+
+    // Same rule as DirectX, a vertex stage or a compute stage by itself
+    const bool isComputeOnly =
+        hasStage[Pegasus::Shader::COMPUTE] &&
+        !hasStage[Pegasus::Shader::VERTEX] &&
+        !hasStage[Pegasus::Shader::FRAGMENT] &&
+        !hasStage[Pegasus::Shader::TESSELATION_CONTROL] &&
+        !hasStage[Pegasus::Shader::TESSELATION_EVALUATION] &&
+        !hasStage[Pegasus::Shader::GEOMETRY];
+
+    if (!hasStage[Pegasus::Shader::VERTEX] && !isComputeOnly)
+    {
+        PEGASUS_EVENT_DISPATCH (
+            programNode,
+            CompilerEvents::LinkingEvent,
+            // Event specific arguments:
+            CompilerEvents::LinkingEvent::INCOMPLETE_STAGES_FAIL,
+            "Incomplete shader stages"
+        );
+#if PEGASUS_ENABLE_PROXIES
+        PG_LOG('CERR', "(%s)Program Link Failure, incomplete shader pipeline", programNode->GetName());
+#else
+        PG_LOG('CERR', "Program Link Failure, incomplete shader pipeline");
+#endif
+    }
+    else if (isProgramComplete)
+    {
+        programGPUData->mProgramValid = true;
+        programGPUData->mIsCompute = isComputeOnly;
+        ++programGPUData->mProgramVersion;
+        PopulateGlobalUniformData(programGPUData);
+        PEGASUS_EVENT_DISPATCH (
+            programNode,
+            CompilerEvents::LinkingEvent,
+            // Event specific arguments:
+            CompilerEvents::LinkingEvent::LINKING_SUCCESS,
+            ""
+        );
+    }
+    else
+    {
+        PEGASUS_EVENT_DISPATCH (
+            programNode,
+            CompilerEvents::LinkingEvent,
+            // Event specific arguments:
+            CompilerEvents::LinkingEvent::LINKING_FAIL,
+            "Linking failed"
+        );
+#if PEGASUS_ENABLE_PROXIES
+        PG_LOG('CERR', "(%s)Program Link Failure, compilation errors.", programNode->GetName());
+#else
+        PG_LOG('CERR', "Program Link Failure, compilation errors.");
+#endif
+    }
+    nodeData->ValidateGPUData();
+}
+
+extern bool NullUpdateUniformLocation(Pegasus::Render::NullProgramGPUData* programGPUData, const char * name, unsigned int nameHash, Pegasus::Render::Uniform& outputUniform);
+
+void NullShaderFactory::PopulateGlobalUniformData(Pegasus::Render::NullProgramGPUData* programGPUData)
+{
+    PG_ASSERT(programGPUData->mGlobalUniformCount == 0);
+    for (unsigned int i = 0; i < mGlobalConstants.GetSize() && i < NULL_GLOBAL_UNIFORM_COUNT; ++i)
+    {
+        GlobalShaderConstantDesc& desc = mGlobalConstants[i];
+        Render::Uniform& candidateUniform = programGPUData->mGlobalUniforms[programGPUData->mGlobalUniformCount];
+        Render::BufferRef& candidateBuffer = programGPUData->mGlobalBuffers[programGPUData->mGlobalUniformCount];
+        Render::SetUniformName(candidateUniform, desc.name);
+        if (NullUpdateUniformLocation(programGPUData, desc.name, candidateUniform.mNameHash, candidateUniform))
+        {
+            candidateBuffer = desc.buffer;
+            ++programGPUData->mGlobalUniformCount;
+        }
+    }
+}
+
+//Dedestroy gpu data of program
+void NullShaderFactory::DestroyProgramGPUData (Pegasus::Graph::NodeData * nodeData)
+{
+    Pegasus::Graph::NodeGPUData* nodeGPUData = nodeData->GetNodeGPUData();
+    if (nodeGPUData != nullptr)
+    {
+        Pegasus::Render::NullProgramGPUData* programData = PEGASUS_GRAPH_GPUDATA_SAFECAST(Pegasus::Render::NullProgramGPUData, nodeGPUData);
+        for (int i = 0; i < programData->mGlobalUniformCount; ++i)
+        {
+            programData->mGlobalUniforms[i] = Render::Uniform();
+            programData->mGlobalBuffers[i] = nullptr;
+        }
+        if (programData->mUniforms != nullptr)
+        {
+            PG_DELETE_ARRAY(mAllocator, programData->mUniforms);
+        }
+        PG_DELETE(mAllocator, programData);
+        nodeData->SetNodeGPUData(nullptr);
+    }
+}
+
+
+
+namespace Pegasus {
+namespace Render
+{
+
+//! The global shader factory
+NullShaderFactory gShaderFactory;
+
+//! return statically defined shader factory singleton
+Shader::IShaderFactory * GetRenderShaderFactory()
+{
+    return &gShaderFactory;
+}
+
+//! Allocator of the program uniform tables, used when the uniform table of a program grows
+Alloc::IAllocator * GetNullShaderAllocator()
+{
+    return gShaderFactory.GetAllocator();
+}
+
+void RegisterGlobalConstant(const char* name, Render::BufferRef& buffer)
+{
+    gShaderFactory.RegisterGlobalConstant(name, buffer);
+}
+
+void ClearGlobalConstants()
+{
+    gShaderFactory.ClearGlobalConstants();
+}
+
+}
+}
+
+#else
+PEGASUS_AVOID_EMPTY_FILE_WARNING
+#endif
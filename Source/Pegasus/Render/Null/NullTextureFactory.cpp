@@ -0,0 +1,237 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   NullTextureFactory.cpp
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Null backend texture factory implementation, textures and render targets only get an id and a size
+
+#if PEGASUS_GAPI_NULL
+
+#include "Pegasus/Render/Render.h"
+#include "Pegasus/Render/TextureFactory.h"
+#include "Pegasus/Texture/TextureData.h"
+#include "../Source/Pegasus/Render/Null/NullGpuDataDefs.h"
+#include "Pegasus/Memory/MemoryManager.h"
+
+using namespace Pegasus;
+using namespace Pegasus::Render;
+
+class NullTextureFactory : public Pegasus::Texture::ITextureFactory
+{
+public:
+    NullTextureFactory();
+    virtual ~NullTextureFactory(){}
+
+    virtual void Initialize(Pegasus::Alloc::IAllocator * allocator);
+
+    virtual void GenerateTextureGPUData(Pegasus::Texture::TextureData * nodeData);
+
+    virtual void DestroyNodeGPUData(Pegasus::Texture::TextureData * nodeData);
+
+    //! Create the gpu data of a render resource, an id and a size
+    void InternalCreateResource(int width, int height, void ** outInternalData);
+
+    //! Destroy the gpu data of a render resource
+    void InternalDestroyResource(void * internalData);
+
+private:
+    Pegasus::Alloc::IAllocator* mAllocator;
+};
+
+NullTextureFactory::NullTextureFactory()
+: mAllocator(nullptr)
+{
+}
+
+void NullTextureFactory::Initialize(Pegasus::Alloc::IAllocator * allocator)
+{
+    mAllocator = allocator;
+}
+
+void NullTextureFactory::GenerateTextureGPUData(Pegasus::Texture::TextureData * nodeData)
+{
+    const Pegasus::Texture::TextureConfiguration& config = nodeData->GetConfiguration();
+    PG_ASSERTSTR(config.GetType() == Pegasus::Texture::TextureConfiguration::TYPE_2D, "Currently only support for 2d textures");
+
+    Pegasus::Graph::NodeGPUData * nodeGpuData = nodeData->GetNodeGPUData();
+    Pegasus::Render::NullResourceGPUData * texGpuData = nullptr;
+    if (nodeGpuData == nullptr)
+    {
+        texGpuData = PG_NEW(
+            mAllocator,
+            -1,
+            "NullTextureGPUData",
+            Pegasus::Alloc::PG_MEM_TEMP
+        )
+        Pegasus::Render::NullResourceGPUData;
+        texGpuData->mId = NullCreateResourceId();
+        nodeData->SetNodeGPUData(reinterpret_cast<Pegasus::Graph::NodeGPUData*>(texGpuData));
+    }
+    else
+    {
+        texGpuData = PEGASUS_GRAPH_GPUDATA_SAFECAST(Pegasus::Render::NullResourceGPUData, nodeGpuData);
+    }
+
+    texGpuData->mWidth = config.GetWidth();
+    texGpuData->mHeight = config.GetHeight();
+    nodeData->ValidateGPUData();
+}
+
+void NullTextureFactory::DestroyNodeGPUData(Pegasus::Texture::TextureData * nodeData)
+{
+    Pegasus::Graph::NodeGPUData * nodeGpuData = nodeData->GetNodeGPUData();
+    if (nodeGpuData != nullptr)
+    {
+        Pegasus::Render::NullResourceGPUData* texGpuData = PEGASUS_GRAPH_GPUDATA_SAFECAST(Pegasus::Render::NullResourceGPUData, nodeGpuData);
+        PG_DELETE(mAllocator, texGpuData);
+        nodeData->SetNodeGPUData(nullptr);
+    }
+}
+
+void NullTextureFactory::InternalCreateResource(int width, int height, void ** outInternalData)
+{
+    Pegasus::Render::NullResourceGPUData* resourceGpuData = PG_NEW (
+        mAllocator,
+        -1,
+        "NullResourceGPUData",
+        Pegasus::Alloc::PG_MEM_PERM
+    ) Pegasus::Render::NullResourceGPUData;
+    resourceGpuData->mId = NullCreateResourceId();
+    resourceGpuData->mWidth = width;
+    resourceGpuData->mHeight = height;
+    *outInternalData = static_cast<void*>(resourceGpuData);
+}
+
+void NullTextureFactory::InternalDestroyResource(void * internalData)
+{
+    if (internalData != nullptr)
+    {
+        Pegasus::Render::NullResourceGPUData * resourceGpuData = PEGASUS_GRAPH_GPUDATA_SAFECAST(Pegasus::Render::NullResourceGPUData, internalData);
+        PG_DELETE(mAllocator, resourceGpuData);
+    }
+}
+
+namespace Pegasus
+{
+
+namespace Render
+{
+NullTextureFactory gTextureFactory;
+Texture::ITextureFactory * GetRenderTextureFactory()
+{
+    return &gTextureFactory;
+}
+
+}
+
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/////////////   CREATE RENDER TARGET IMPLEMENTATION ///////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+Pegasus::Render::RenderTargetRef Pegasus::Render::CreateRenderTarget(Pegasus::Render::RenderTargetConfig& config)
+{
+    RenderTarget* rt = PG_NEW(Pegasus::Memory::GetRenderAllocator(), -1, "RenderTarget", Pegasus::Alloc::PG_MEM_PERM) RenderTarget(Pegasus::Memory::GetRenderAllocator());
+    void * internalData = nullptr;
+    Pegasus::Render::gTextureFactory.InternalCreateResource(config.mWidth, config.mHeight, &internalData);
+    rt->SetConfig(config);
+    rt->SetInternalData(internalData);
+    return rt;
+}
+
+Pegasus::Render::DepthStencilRef Pegasus::Render::CreateDepthStencil(const Pegasus::Render::DepthStencilConfig& config)
+{
+    DepthStencil* ds = PG_NEW(Pegasus::Memory::GetRenderAllocator(), -1, "DepthStencil", Pegasus::Alloc::PG_MEM_PERM) DepthStencil(Pegasus::Memory::GetRenderAllocator());
+    void * internalData = nullptr;
+    Pegasus::Render::gTextureFactory.InternalCreateResource(config.mWidth, config.mHeight, &internalData);
+    ds->SetConfig(config);
+    ds->SetInternalData(internalData);
+    return ds;
+}
+
+Pegasus::Render::RenderTargetRef Pegasus::Render::CreateRenderTargetFromCubeMap(Pegasus::Render::CubeFace targetFace, Pegasus::Render::CubeMapRef& cubeMap)
+{
+    RenderTarget* rt = PG_NEW(Pegasus::Memory::GetRenderAllocator(), -1, "RenderTarget", Pegasus::Alloc::PG_MEM_PERM) RenderTarget(Pegasus::Memory::GetRenderAllocator());
+    const Pegasus::Render::CubeMapConfig& cubeConfig = cubeMap->GetConfig();
+    Pegasus::Render::RenderTargetConfig outputConfig;
+    outputConfig.mWidth  = cubeConfig.mWidth;
+    outputConfig.mHeight = cubeConfig.mHeight;
+    outputConfig.mFormat = cubeConfig.mFormat;
+    void * internalData = nullptr;
+    Pegasus::Render::gTextureFactory.InternalCreateResource(outputConfig.mWidth, outputConfig.mHeight, &internalData);
+    rt->SetConfig(outputConfig);
+    rt->SetInternalData(internalData);
+    return rt;
+}
+
+Pegasus::Render::RenderTargetRef Pegasus::Render::CreateRenderTargetFromVolumeTexture(int sliceIndex, Pegasus::Render::VolumeTextureRef& volTextureRef)
+{
+    RenderTarget* rt = PG_NEW(Pegasus::Memory::GetRenderAllocator(), -1, "RenderTarget", Pegasus::Alloc::PG_MEM_PERM) RenderTarget(Pegasus::Memory::GetRenderAllocator());
+    const Pegasus::Render::VolumeTextureConfig& volumeConfig = volTextureRef->GetConfig();
+    PG_ASSERT(sliceIndex >= 0 && sliceIndex < volumeConfig.mDepth);
+    Pegasus::Render::RenderTargetConfig outputConfig;
+    outputConfig.mWidth  = volumeConfig.mWidth;
+    outputConfig.mHeight = volumeConfig.mHeight;
+    outputConfig.mFormat = volumeConfig.mFormat;
+    void * internalData = nullptr;
+    Pegasus::Render::gTextureFactory.InternalCreateResource(outputConfig.mWidth, outputConfig.mHeight, &internalData);
+    rt->SetConfig(outputConfig);
+    rt->SetInternalData(internalData);
+    return rt;
+}
+
+Pegasus::Render::CubeMapRef Pegasus::Render::CreateCubeMap(const Pegasus::Render::CubeMapConfig& config)
+{
+    CubeMap* cubeMap = PG_NEW(Pegasus::Memory::GetRenderAllocator(), -1, "RenderTarget", Pegasus::Alloc::PG_MEM_PERM) CubeMap(Pegasus::Memory::GetRenderAllocator());
+    void * internalData = nullptr;
+    Pegasus::Render::gTextureFactory.InternalCreateResource(config.mWidth, config.mHeight, &internalData);
+    cubeMap->SetConfig(config);
+    cubeMap->SetInternalData(internalData);
+    return cubeMap;
+}
+
+Pegasus::Render::VolumeTextureRef Pegasus::Render::CreateVolumeTexture(const Pegasus::Render::VolumeTextureConfig& config)
+{
+    VolumeTexture* volTex = PG_NEW(Pegasus::Memory::GetRenderAllocator(), -1, "RenderTarget", Pegasus::Alloc::PG_MEM_PERM) VolumeTexture(Pegasus::Memory::GetRenderAllocator());
+    void * internalData = nullptr;
+    Pegasus::Render::gTextureFactory.InternalCreateResource(config.mWidth, config.mHeight, &internalData);
+    volTex->SetConfig(config);
+    volTex->SetInternalData(internalData);
+    return volTex;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/////////////   DELETE RENDER TARGET IMPLEMENTATION       /////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+template<>
+Pegasus::Render::BasicResource<Pegasus::Render::RenderTargetConfig>::~BasicResource()
+{
+    Pegasus::Render::gTextureFactory.InternalDestroyResource(GetInternalData());
+}
+
+template<>
+Pegasus::Render::BasicResource<Pegasus::Render::DepthStencilConfig>::~BasicResource()
+{
+    Pegasus::Render::gTextureFactory.InternalDestroyResource(GetInternalData());
+}
+
+template<>
+Pegasus::Render::BasicResource<Pegasus::Render::CubeMapConfig>::~BasicResource()
+{
+    Pegasus::Render::gTextureFactory.InternalDestroyResource(GetInternalData());
+}
+
+template<>
+Pegasus::Render::BasicResource<Pegasus::Render::VolumeTextureConfig>::~BasicResource()
+{
+    Pegasus::Render::gTextureFactory.InternalDestroyResource(GetInternalData());
+}
+
+#else
+PEGASUS_AVOID_EMPTY_FILE_WARNING
+#endif
@@ -0,0 +1,147 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   UniformLookup.cpp
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Hashed index of the uniforms of a program, implementation.
+//!         Built with every backend, it calls no render API.
+
+#include "Pegasus/Render/UniformLookup.h"
+#include "Pegasus/Allocator/IAllocator.h"
+#include "Pegasus/Allocator/Alloc.h"
+
+namespace Pegasus
+{
+namespace Render
+{
+
+//! Initial number of slots of the table, a power of 2
+static const unsigned int UNIFORM_LOOKUP_INITIAL_CAPACITY = 16;
+
+void SetUniformName(Uniform& outputUniform, const char * name)
+{
+    //same hash as Utils::HashStr (djb2), computed while copying
+    unsigned int hash = 5381;
+    int i = 0;
+    for (; i < PEGASUS_RENDER_MAX_UNIFORM_NAME_LEN - 1 && name[i] != '\0'; ++i)
+    {
+        outputUniform.mName[i] = name[i];
+        hash = ((hash << 5) + hash) + static_cast<unsigned int>(name[i]);
+    }
+    outputUniform.mName[i] = '\0';
+    outputUniform.mNameHash = hash;
+}
+
+//----------------------------------------------------------------------------------------
+
+UniformLookup::UniformLookup()
+:   mAllocator(nullptr),
+    mEntries(nullptr),
+    mCapacity(0),
+    mCount(0)
+{
+}
+
+//----------------------------------------------------------------------------------------
+
+UniformLookup::~UniformLookup()
+{
+    if (mEntries != nullptr)
+    {
+        PG_DELETE_ARRAY(mAllocator, mEntries);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void UniformLookup::Clear()
+{
+    for (unsigned int i = 0; i < mCapacity; ++i)
+    {
+        mEntries[i].mIndex = -1;
+    }
+    mCount = 0;
+}
+
+//----------------------------------------------------------------------------------------
+
+void UniformLookup::Add(Alloc::IAllocator * allocator, unsigned int nameHash, int index)
+{
+    PG_ASSERT(index >= 0);
+    PG_ASSERTSTR(mAllocator == nullptr || mAllocator == allocator, "The storage of a uniform lookup must use a single allocator");
+
+    //at most half full, so the probe sequences stay short
+    if (2 * (mCount + 1) > mCapacity)
+    {
+        Grow(allocator);
+    }
+
+    unsigned int slot = nameHash & (mCapacity - 1);
+    while (mEntries[slot].mIndex != -1)
+    {
+        slot = (slot + 1) & (mCapacity - 1);
+    }
+    mEntries[slot].mHash = nameHash;
+    mEntries[slot].mIndex = index;
+    ++mCount;
+}
+
+//----------------------------------------------------------------------------------------
+
+int UniformLookup::Find(unsigned int nameHash, unsigned int& cursor) const
+{
+    if (mCount == 0)
+    {
+        return -1;
+    }
+
+    //the cursor counts the slots already probed, an empty slot ends the sequence
+    for (; cursor < mCapacity; ++cursor)
+    {
+        const Entry& entry = mEntries[(nameHash + cursor) & (mCapacity - 1)];
+        if (entry.mIndex == -1)
+        {
+            cursor = mCapacity;
+            return -1;
+        }
+        if (entry.mHash == nameHash)
+        {
+            ++cursor;
+            return entry.mIndex;
+        }
+    }
+    return -1;
+}
+
+//----------------------------------------------------------------------------------------
+
+void UniformLookup::Grow(Alloc::IAllocator * allocator)
+{
+    Entry * oldEntries = mEntries;
+    const unsigned int oldCapacity = mCapacity;
+
+    mAllocator = allocator;
+    mCapacity = oldCapacity == 0 ? UNIFORM_LOOKUP_INITIAL_CAPACITY : 2 * oldCapacity;
+    mEntries = PG_NEW_ARRAY(mAllocator, -1, "UniformLookup", Alloc::PG_MEM_PERM, Entry, mCapacity);
+    mCount = 0;
+    Clear();
+
+    for (unsigned int i = 0; i < oldCapacity; ++i)
+    {
+        if (oldEntries[i].mIndex != -1)
+        {
+            Add(allocator, oldEntries[i].mHash, oldEntries[i].mIndex);
+        }
+    }
+    if (oldEntries != nullptr)
+    {
+        PG_DELETE_ARRAY(mAllocator, oldEntries);
+    }
+}
+
+}   // namespace Render
+}   // namespace Pegasus
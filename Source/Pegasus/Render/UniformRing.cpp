@@ -0,0 +1,122 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   UniformRing.cpp
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Ring sub-allocator of the transient uniform buffers, implementation.
+//!         Built with every backend, it calls no render API.
+
+#include "Pegasus/Render/UniformRing.h"
+
+namespace Pegasus
+{
+namespace Render
+{
+
+UniformRing::UniformRing()
+:   mCapacity(0),
+    mAlignment(1),
+    mHead(0),
+    mUsed(0),
+    mCurrentFrameBytes(0),
+    mCurrentFence(0),
+    mFirstFrame(0),
+    mFrameCount(0)
+{
+}
+
+//----------------------------------------------------------------------------------------
+
+void UniformRing::Initialize(unsigned int capacity, unsigned int alignment)
+{
+    PG_ASSERTSTR(alignment != 0 && (alignment & (alignment - 1)) == 0, "The alignment of the uniform ring must be a power of 2");
+    PG_ASSERTSTR((capacity & (alignment - 1)) == 0, "The size of the uniform ring must be a multiple of its alignment");
+    mCapacity = capacity;
+    mAlignment = alignment;
+    mHead = 0;
+    mUsed = 0;
+    mCurrentFrameBytes = 0;
+    mFirstFrame = 0;
+    mFrameCount = 0;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool UniformRing::Allocate(unsigned int size, unsigned int& outOffset)
+{
+    const unsigned int alignedSize = (size + mAlignment - 1) & ~(mAlignment - 1);
+    if (alignedSize == 0 || alignedSize > mCapacity)
+    {
+        ++mStats.mFullCount;
+        return false;
+    }
+
+    //nothing in use, restart at 0 so the allocation does not wrap
+    if (mUsed == 0)
+    {
+        mHead = 0;
+    }
+
+    //the head is always aligned, an allocation not fitting before the end starts again at 0
+    //and the end of the ring is lost until the frame retires
+    const unsigned int wrapBytes = mHead + alignedSize > mCapacity ? mCapacity - mHead : 0;
+    if (mUsed + wrapBytes + alignedSize > mCapacity)
+    {
+        ++mStats.mFullCount;
+        return false;
+    }
+
+    if (wrapBytes != 0 || mHead == mCapacity)
+    {
+        mHead = 0;
+        ++mStats.mWrapCount;
+    }
+    outOffset = mHead;
+    mHead += alignedSize;
+    mUsed += wrapBytes + alignedSize;
+    mCurrentFrameBytes += wrapBytes + alignedSize;
+
+    ++mStats.mAllocationCount;
+    mStats.mAllocatedBytes += alignedSize;
+    mStats.mWrapBytes += wrapBytes;
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int UniformRing::EndFrame()
+{
+    PG_ASSERTSTR(mFrameCount < MAX_FRAMES_IN_FLIGHT, "Too many frames of the uniform ring in flight, retire a frame first");
+    Frame& frame = mFrames[(mFirstFrame + mFrameCount) % MAX_FRAMES_IN_FLIGHT];
+    frame.mFence = mCurrentFence;
+    frame.mBytes = mCurrentFrameBytes;
+    ++mFrameCount;
+    mCurrentFrameBytes = 0;
+    return mCurrentFence++;
+}
+
+//----------------------------------------------------------------------------------------
+
+void UniformRing::RetireFrame()
+{
+    PG_ASSERTSTR(mFrameCount > 0, "No frame of the uniform ring in flight");
+    const Frame& frame = mFrames[mFirstFrame];
+    mUsed -= frame.mBytes;
+    mFirstFrame = (mFirstFrame + 1) % MAX_FRAMES_IN_FLIGHT;
+    --mFrameCount;
+    ++mStats.mRetiredFrameCount;
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int UniformRing::GetOldestPendingFence() const
+{
+    return mFrameCount > 0 ? mFrames[mFirstFrame].mFence : mCurrentFence;
+}
+
+}   // namespace Render
+}   // namespace Pegasus
@@ -14,6 +14,8 @@
 
 #include "Pegasus/Allocator/IAllocator.h"
 #include "Pegasus/Math/Quaternion.h"
+#include "Pegasus/Math/BatchTransform.h"
+#include "Pegasus/Math/BatchCulling.h"
 
 namespace Pegasus {
 namespace Camera {
@@ -201,10 +203,11 @@ bool Camera::WindowUpdate(unsigned int width, unsigned int height)
             Math::Vec4( 1.0f,-1.0f,1.0f,1.0f)  //F_R_B
         };
 
+        Math::Vec4 pointsOut[MAX_POINTS];
+        Math::TransformHomogeneousPoints(pointsOut[0].v, sizeof(Math::Vec4), sHomogeneousPoints[0].v, sizeof(Math::Vec4), MAX_POINTS, mGpuData.invViewProj);
         for (unsigned int i = 0; i < MAX_POINTS; ++i)
         {
-            Math::Vec4 pointOut;
-            Math::Mult44_41(pointOut, mGpuData.invViewProj, sHomogeneousPoints[i]);
+            Math::Vec4& pointOut = pointsOut[i];
             pointOut /= pointOut.w;
             Math::Vec3& p = mFrustum.points[i];
             p.x = pointOut.x;
@@ -245,52 +248,17 @@ void Camera::ForceUpdate()
 
 Camera::CollisionState Camera::Frustum::GetCollisionState(const Math::Vec3& aabbMin, const Math::Vec3& aabbMax) const
 {
-    static const Math::Vec3 sCubeMasks[8] = {
-        Math::Vec3(0.0f,0.0f,0.0f),
-        Math::Vec3(1.0f,0.0f,0.0f),
-        Math::Vec3(0.0f,1.0f,0.0f),
-        Math::Vec3(1.0f,1.0f,0.0f),
-        Math::Vec3(0.0f,0.0f,1.0f),
-        Math::Vec3(1.0f,0.0f,1.0f),
-        Math::Vec3(0.0f,1.0f,1.0f),
-        Math::Vec3(1.0f,1.0f,1.0f)
-    };
-
-    Math::Vec3 cubePoints[8];
-    for (int i = 0; i < 8; ++i)
-    {
-        cubePoints[i] = (Math::Vec3(1.0f,1.0f,1.0f) - sCubeMasks[i])*aabbMin + sCubeMasks[i]*aabbMax;
-    }
-
-  
-    Camera::CollisionState cs = Camera::INSIDE;
-    for (unsigned int pi = 0; pi < Camera::MAX_PLANE_COUNT; ++pi)
-    {
-        int in =0, out =0;
-        const Math::Plane& p = planes[pi];
-        for (unsigned int i = 0; i < Camera::MAX_POINTS && (in == 0 || out == 0); ++i)
-        {
-            if (p.IsInBack(cubePoints[i]))
-            {
-                ++in;
-            }
-            else
-            {
-                ++out;
-            }
-        }
-
-        if (in == 0)
-        {
-            return Camera::OUTSIDE;
-        }
-        else if (out > 0)
-        {
-            cs = Camera::INTERSECT;
-        }
-    }
+    //one box, pitch of 1
+    const float box[6] = { aabbMin.x, aabbMin.y, aabbMin.z, aabbMax.x, aabbMax.y, aabbMax.z };
+    Math::PUInt32 insideMask;
+    Math::PUInt32 outsideMask;
+    GetCollisionStates(&insideMask, &outsideMask, box, 1, 1);
+    return outsideMask != 0 ? Camera::OUTSIDE : (insideMask != 0 ? Camera::INSIDE : Camera::INTERSECT);
+}
 
-    return cs;
+void Camera::Frustum::GetCollisionStates(Math::PUInt32* insideMask, Math::PUInt32* outsideMask, const float* boxes, int pitch, int count) const
+{
+    Math::CullAabbsSoa(insideMask, outsideMask, boxes, pitch, count, planes, Camera::MAX_PLANE_COUNT);
 }
 
 
@@ -14,6 +14,7 @@
 
 #include "Pegasus/Application/RenderCollection.h"
 #include "Pegasus/RenderSystems/Camera/Camera.h"
+#include "Pegasus/RenderSystems/Camera/SceneBvh.h"
 #include "Pegasus/Memory/MemoryManager.h"
 #include "Pegasus/Window/Window.h"
 #include "Pegasus/BlockScript/BlockLib.h"
@@ -165,12 +166,19 @@ void CameraSystem::OnRegisterBlockscriptApi(BlockScript::BlockLib* blocklib, Cor
 
 
     blocklib->CreateIntrinsicFunctions(extraFuns, sizeof(extraFuns)/sizeof(extraFuns[0]));
+
+    //scene bvh, used by the scripts to cull their objects against the cameras
+    Utils::Vector<BlockScript::FunctionDeclarationDesc> methods;
+    Utils::Vector<BlockScript::FunctionDeclarationDesc> functions;
+    SceneBvh::GetBlockScriptApi(methods, functions);
+    Application::GenericResource::RegisterGenericResourceType(SceneBvh::GetStaticClassInfo(), blocklib, methods.Data(), methods.GetSize());
+    blocklib->CreateIntrinsicFunctions(functions.Data(), functions.GetSize());
 }
 
 void CameraSystem::OnRegisterShaderGlobalConstants(Utils::Vector<ShaderGlobalConstantDesc>& outConstants)
 {
     if (mCameraBuffer == nullptr)
-        mCameraBuffer = Render::CreateUniformBuffer(sizeof(Camera::GpuCamData));
+        mCameraBuffer = Render::CreateUniformBuffer(sizeof(Camera::GpuCamData), true /*transient, rewritten every frame*/);
 
     RenderSystem::ShaderGlobalConstantDesc& desc = outConstants.PushEmpty();
     desc.constantName = "__camera_cbuffer";
@@ -190,8 +198,9 @@ void CameraSystem::WindowUpdate(unsigned int width, unsigned int height)
 
     if (currentCamera != nullptr)
     {
+        //the camera buffer lives in the uniform ring, its contents only last until the end of the frame
         bool mustUpdate = currentCamera->WindowUpdate(width, height);
-        if (mustUpdate || mCamStateDirty)
+        if (mustUpdate || mCamStateDirty || mCameraBuffer->GetConfig().mTransient)
         {
             Pegasus::Render::SetBuffer(mCameraBuffer, &currentCamera->GetGpuData(), sizeof(Camera::GpuCamData));
             mCamStateDirty = false;
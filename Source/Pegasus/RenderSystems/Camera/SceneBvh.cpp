@@ -0,0 +1,407 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   SceneBvh.cpp
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Bounding volume hierarchy resource, letting the render scripts cull their objects
+//!         (instanced meshes, lights...) against a camera, or pick them with rays, before issuing draws.
+
+#include "Pegasus/RenderSystems/Camera/SceneBvh.h"
+#if RENDER_SYSTEM_CONFIG_ENABLE_CAMERA
+
+#include "Pegasus/RenderSystems/Camera/Camera.h"
+#include "Pegasus/Application/RenderCollection.h"
+#include "Pegasus/Memory/MemoryManager.h"
+#include "Pegasus/BlockScript/BlockLib.h"
+#include "Pegasus/BlockScript/FunCallback.h"
+#include "Pegasus/BlockScript/BsVm.h"
+
+namespace Pegasus {
+namespace Camera {
+
+BEGIN_IMPLEMENT_PROPERTIES(SceneBvh)
+END_IMPLEMENT_PROPERTIES(SceneBvh)
+
+SceneBvh::SceneBvh(Alloc::IAllocator* allocator)
+: Application::GenericResource(allocator), mAllocator(allocator), mBvh(allocator), mResults(nullptr), mResultCapacity(0), mResultCount(0), mRayHitDistance(0.0f)
+{
+    BEGIN_INIT_PROPERTIES(SceneBvh)
+    END_INIT_PROPERTIES()
+}
+
+SceneBvh::~SceneBvh()
+{
+    if (mResults != nullptr)
+    {
+        PG_DELETE_ARRAY(mAllocator, mResults);
+    }
+}
+
+void SceneBvh::Update()
+{
+    mBvh.Update();
+}
+
+void SceneBvh::PrepareQuery()
+{
+    mBvh.Update();
+
+    //a query never finds more objects than the tree has
+    const int objectCount = mBvh.GetObjectCount();
+    if (objectCount > mResultCapacity)
+    {
+        if (mResults != nullptr)
+        {
+            PG_DELETE_ARRAY(mAllocator, mResults);
+        }
+        mResultCapacity = objectCount * 2;
+        mResults = PG_NEW_ARRAY(mAllocator, -1, "SceneBvh results", Alloc::PG_MEM_PERM, int, mResultCapacity);
+    }
+}
+
+int SceneBvh::CullFrustum(const Camera& cam)
+{
+    PrepareQuery();
+    const Camera::Frustum& frustum = cam.GetWorldFrustum();
+    mResultCount = mBvh.QueryFrustum(mResults, mResultCapacity, frustum.planes, Camera::MAX_PLANE_COUNT);
+    return mResultCount;
+}
+
+int SceneBvh::QueryOverlap(const Math::AxisAlignedBoundingBox& box)
+{
+    PrepareQuery();
+    mResultCount = mBvh.QueryOverlap(mResults, mResultCapacity, box);
+    return mResultCount;
+}
+
+int SceneBvh::GetResult(int index) const
+{
+    if (index >= 0 && index < mResultCount)
+    {
+        return mResults[index];
+    }
+    return -1;
+}
+
+int SceneBvh::RayCast(const Math::Ray& ray, float maxDistance)
+{
+    mBvh.Update();
+    int userData = -1;
+    mRayHitDistance = maxDistance;
+    mBvh.QueryRay(userData, mRayHitDistance, ray, maxDistance);
+    return userData;
+}
+
+static SceneBvh* GetSceneBvh(Application::RenderCollection* collection, Application::RenderCollection::CollectionHandle handle, const char* functionName)
+{
+    if (handle == Application::RenderCollection::INVALID_HANDLE)
+    {
+        PG_LOG('ERR_', "Invalid SceneBvh handle in %s.", functionName);
+        return nullptr;
+    }
+    return static_cast<SceneBvh*>(Application::RenderCollection::GetResource<Application::GenericResource>(collection, handle));
+}
+
+static bool ReadBox(BlockScript::FunParamStream& stream, Math::AxisAlignedBoundingBox& box, const char* functionName)
+{
+    const Math::Vec3 boxMin = stream.NextArgument<Math::Vec3>();
+    const Math::Vec3 boxMax = stream.NextArgument<Math::Vec3>();
+    if (boxMin.x > boxMax.x || boxMin.y > boxMax.y || boxMin.z > boxMax.z)
+    {
+        PG_LOG('ERR_', "The min of the box is larger than its max in %s.", functionName);
+        return false;
+    }
+    box.SetMinMax(boxMin, boxMax);
+    return true;
+}
+
+static void CreateSceneBvh_Callback(BlockScript::FunCallbackContext& context)
+{
+    BlockScript::FunParamStream stream(context);
+    Application::RenderCollection* collection = static_cast<Application::RenderCollection*>(context.GetVmState()->GetUserContext());
+    SceneBvh* bvh = PG_NEW(Memory::GetRenderAllocator(), -1, "SceneBvh", Alloc::PG_MEM_TEMP) SceneBvh(Memory::GetRenderAllocator());
+    Application::RenderCollection::CollectionHandle handle = Application::RenderCollection::AddResource<Application::GenericResource>(collection, bvh);
+    stream.SubmitReturn<Application::RenderCollection::CollectionHandle>(handle);
+}
+
+static void AddObject_Callback(BlockScript::FunCallbackContext& context)
+{
+    BlockScript::FunParamStream stream(context);
+    Application::RenderCollection* collection = static_cast<Application::RenderCollection*>(context.GetVmState()->GetUserContext());
+    SceneBvh* bvh = GetSceneBvh(collection, stream.NextArgument<Application::RenderCollection::CollectionHandle>(), "AddObject");
+    Math::AxisAlignedBoundingBox box;
+    const bool validBox = ReadBox(stream, box, "AddObject");
+    const int userData = stream.NextArgument<int>();
+
+    Math::BvhObjectHandle object = Math::INVALID_BVH_OBJECT;
+    if (bvh != nullptr && validBox)
+    {
+        object = bvh->GetBvh().AddObject(box, userData);
+    }
+    stream.SubmitReturn<int>(object);
+}
+
+static void UpdateObject_Callback(BlockScript::FunCallbackContext& context)
+{
+    BlockScript::FunParamStream stream(context);
+    Application::RenderCollection* collection = static_cast<Application::RenderCollection*>(context.GetVmState()->GetUserContext());
+    SceneBvh* bvh = GetSceneBvh(collection, stream.NextArgument<Application::RenderCollection::CollectionHandle>(), "UpdateObject");
+    const Math::BvhObjectHandle object = stream.NextArgument<int>();
+    Math::AxisAlignedBoundingBox box;
+    const bool validBox = ReadBox(stream, box, "UpdateObject");
+
+    if (bvh != nullptr && validBox)
+    {
+        if (bvh->GetBvh().IsObjectValid(object))
+        {
+            bvh->GetBvh().UpdateObject(object, box);
+        }
+        else
+        {
+            PG_LOG('ERR_', "Invalid object %d in UpdateObject.", object);
+        }
+    }
+}
+
+static void RemoveObject_Callback(BlockScript::FunCallbackContext& context)
+{
+    BlockScript::FunParamStream stream(context);
+    Application::RenderCollection* collection = static_cast<Application::RenderCollection*>(context.GetVmState()->GetUserContext());
+    SceneBvh* bvh = GetSceneBvh(collection, stream.NextArgument<Application::RenderCollection::CollectionHandle>(), "RemoveObject");
+    const Math::BvhObjectHandle object = stream.NextArgument<int>();
+
+    if (bvh != nullptr)
+    {
+        if (bvh->GetBvh().IsObjectValid(object))
+        {
+            bvh->GetBvh().RemoveObject(object);
+        }
+        else
+        {
+            PG_LOG('ERR_', "Invalid object %d in RemoveObject.", object);
+        }
+    }
+}
+
+static void Clear_Callback(BlockScript::FunCallbackContext& context)
+{
+    BlockScript::FunParamStream stream(context);
+    Application::RenderCollection* collection = static_cast<Application::RenderCollection*>(context.GetVmState()->GetUserContext());
+    SceneBvh* bvh = GetSceneBvh(collection, stream.NextArgument<Application::RenderCollection::CollectionHandle>(), "Clear");
+    if (bvh != nullptr)
+    {
+        bvh->GetBvh().Clear();
+    }
+}
+
+static void CullFrustum_Callback(BlockScript::FunCallbackContext& context)
+{
+    BlockScript::FunParamStream stream(context);
+    Application::RenderCollection* collection = static_cast<Application::RenderCollection*>(context.GetVmState()->GetUserContext());
+    SceneBvh* bvh = GetSceneBvh(collection, stream.NextArgument<Application::RenderCollection::CollectionHandle>(), "CullFrustum");
+    Application::RenderCollection::CollectionHandle camHandle = stream.NextArgument<Application::RenderCollection::CollectionHandle>();
+
+    int resultCount = 0;
+    if (bvh != nullptr && camHandle != Application::RenderCollection::INVALID_HANDLE)
+    {
+        Camera* cam = static_cast<Camera*>(Application::RenderCollection::GetResource<Application::GenericResource>(collection, camHandle));
+        resultCount = bvh->CullFrustum(*cam);
+    }
+    else if (camHandle == Application::RenderCollection::INVALID_HANDLE)
+    {
+        PG_LOG('ERR_', "Invalid camera in CullFrustum.");
+    }
+    stream.SubmitReturn<int>(resultCount);
+}
+
+static void QueryOverlap_Callback(BlockScript::FunCallbackContext& context)
+{
+    BlockScript::FunParamStream stream(context);
+    Application::RenderCollection* collection = static_cast<Application::RenderCollection*>(context.GetVmState()->GetUserContext());
+    SceneBvh* bvh = GetSceneBvh(collection, stream.NextArgument<Application::RenderCollection::CollectionHandle>(), "QueryOverlap");
+    Math::AxisAlignedBoundingBox box;
+    const bool validBox = ReadBox(stream, box, "QueryOverlap");
+
+    int resultCount = 0;
+    if (bvh != nullptr && validBox)
+    {
+        resultCount = bvh->QueryOverlap(box);
+    }
+    stream.SubmitReturn<int>(resultCount);
+}
+
+static void GetResult_Callback(BlockScript::FunCallbackContext& context)
+{
+    BlockScript::FunParamStream stream(context);
+    Application::RenderCollection* collection = static_cast<Application::RenderCollection*>(context.GetVmState()->GetUserContext());
+    SceneBvh* bvh = GetSceneBvh(collection, stream.NextArgument<Application::RenderCollection::CollectionHandle>(), "GetResult");
+    const int index = stream.NextArgument<int>();
+    stream.SubmitReturn<int>(bvh != nullptr ? bvh->GetResult(index) : -1);
+}
+
+static void RayCast_Callback(BlockScript::FunCallbackContext& context)
+{
+    BlockScript::FunParamStream stream(context);
+    Application::RenderCollection* collection = static_cast<Application::RenderCollection*>(context.GetVmState()->GetUserContext());
+    SceneBvh* bvh = GetSceneBvh(collection, stream.NextArgument<Application::RenderCollection::CollectionHandle>(), "RayCast");
+    const Math::Vec3 origin = stream.NextArgument<Math::Vec3>();
+    Math::Vec3 direction = stream.NextArgument<Math::Vec3>();
+    const float maxDistance = stream.NextArgument<float>();
+
+    int userData = -1;
+    if (bvh != nullptr)
+    {
+        if (Math::Length(direction) > RAY_EPSILON)
+        {
+            Math::Normalize(direction);
+            userData = bvh->RayCast(Math::Ray(origin, direction), maxDistance);
+        }
+        else
+        {
+            PG_LOG('ERR_', "The ray direction of RayCast is null.");
+        }
+    }
+    stream.SubmitReturn<int>(userData);
+}
+
+static void GetRayHitDistance_Callback(BlockScript::FunCallbackContext& context)
+{
+    BlockScript::FunParamStream stream(context);
+    Application::RenderCollection* collection = static_cast<Application::RenderCollection*>(context.GetVmState()->GetUserContext());
+    SceneBvh* bvh = GetSceneBvh(collection, stream.NextArgument<Application::RenderCollection::CollectionHandle>(), "GetRayHitDistance");
+    stream.SubmitReturn<float>(bvh != nullptr ? bvh->GetRayHitDistance() : 0.0f);
+}
+
+void SceneBvh::GetBlockScriptApi(Utils::Vector<BlockScript::FunctionDeclarationDesc>& methods, Utils::Vector<BlockScript::FunctionDeclarationDesc>& functions)
+{
+    BlockScript::FunctionDeclarationDesc desc;
+    desc.functionName = "CreateSceneBvh";
+    desc.returnType = "SceneBvh";
+    desc.argumentTypes[0] = nullptr;
+    desc.argumentNames[0] = nullptr;
+    desc.callback = CreateSceneBvh_Callback;
+    functions.PushEmpty() = desc;
+
+    desc.functionName = "AddObject";
+    desc.returnType = "int";
+    desc.argumentTypes[0] = "SceneBvh";
+    desc.argumentNames[0] = "this";
+    desc.argumentTypes[1] = "float3";
+    desc.argumentNames[1] = "boxMin";
+    desc.argumentTypes[2] = "float3";
+    desc.argumentNames[2] = "boxMax";
+    desc.argumentTypes[3] = "int";
+    desc.argumentNames[3] = "userData";
+    desc.argumentTypes[4] = nullptr;
+    desc.argumentNames[4] = nullptr;
+    desc.callback = AddObject_Callback;
+    methods.PushEmpty() = desc;
+
+    desc.functionName = "UpdateObject";
+    desc.returnType = "int";
+    desc.argumentTypes[0] = "SceneBvh";
+    desc.argumentNames[0] = "this";
+    desc.argumentTypes[1] = "int";
+    desc.argumentNames[1] = "object";
+    desc.argumentTypes[2] = "float3";
+    desc.argumentNames[2] = "boxMin";
+    desc.argumentTypes[3] = "float3";
+    desc.argumentNames[3] = "boxMax";
+    desc.argumentTypes[4] = nullptr;
+    desc.argumentNames[4] = nullptr;
+    desc.callback = UpdateObject_Callback;
+    methods.PushEmpty() = desc;
+
+    desc.functionName = "RemoveObject";
+    desc.returnType = "int";
+    desc.argumentTypes[0] = "SceneBvh";
+    desc.argumentNames[0] = "this";
+    desc.argumentTypes[1] = "int";
+    desc.argumentNames[1] = "object";
+    desc.argumentTypes[2] = nullptr;
+    desc.argumentNames[2] = nullptr;
+    desc.callback = RemoveObject_Callback;
+    methods.PushEmpty() = desc;
+
+    desc.functionName = "Clear";
+    desc.returnType = "int";
+    desc.argumentTypes[0] = "SceneBvh";
+    desc.argumentNames[0] = "this";
+    desc.argumentTypes[1] = nullptr;
+    desc.argumentNames[1] = nullptr;
+    desc.callback = Clear_Callback;
+    methods.PushEmpty() = desc;
+
+    desc.functionName = "CullFrustum";
+    desc.returnType = "int";
+    desc.argumentTypes[0] = "SceneBvh";
+    desc.argumentNames[0] = "this";
+    desc.argumentTypes[1] = "Camera";
+    desc.argumentNames[1] = "cam";
+    desc.argumentTypes[2] = nullptr;
+    desc.argumentNames[2] = nullptr;
+    desc.callback = CullFrustum_Callback;
+    methods.PushEmpty() = desc;
+
+    desc.functionName = "QueryOverlap";
+    desc.returnType = "int";
+    desc.argumentTypes[0] = "SceneBvh";
+    desc.argumentNames[0] = "this";
+    desc.argumentTypes[1] = "float3";
+    desc.argumentNames[1] = "boxMin";
+    desc.argumentTypes[2] = "float3";
+    desc.argumentNames[2] = "boxMax";
+    desc.argumentTypes[3] = nullptr;
+    desc.argumentNames[3] = nullptr;
+    desc.callback = QueryOverlap_Callback;
+    methods.PushEmpty() = desc;
+
+    desc.functionName = "GetResult";
+    desc.returnType = "int";
+    desc.argumentTypes[0] = "SceneBvh";
+    desc.argumentNames[0] = "this";
+    desc.argumentTypes[1] = "int";
+    desc.argumentNames[1] = "index";
+    desc.argumentTypes[2] = nullptr;
+    desc.argumentNames[2] = nullptr;
+    desc.callback = GetResult_Callback;
+    methods.PushEmpty() = desc;
+
+    desc.functionName = "RayCast";
+    desc.returnType = "int";
+    desc.argumentTypes[0] = "SceneBvh";
+    desc.argumentNames[0] = "this";
+    desc.argumentTypes[1] = "float3";
+    desc.argumentNames[1] = "origin";
+    desc.argumentTypes[2] = "float3";
+    desc.argumentNames[2] = "direction";
+    desc.argumentTypes[3] = "float";
+    desc.argumentNames[3] = "maxDistance";
+    desc.argumentTypes[4] = nullptr;
+    desc.argumentNames[4] = nullptr;
+    desc.callback = RayCast_Callback;
+    methods.PushEmpty() = desc;
+
+    desc.functionName = "GetRayHitDistance";
+    desc.returnType = "float";
+    desc.argumentTypes[0] = "SceneBvh";
+    desc.argumentNames[0] = "this";
+    desc.argumentTypes[1] = nullptr;
+    desc.argumentNames[1] = nullptr;
+    desc.callback = GetRayHitDistance_Callback;
+    methods.PushEmpty() = desc;
+}
+
+
+}   // namespace Camera
+}   // namespace Pegasus
+
+#else
+
+PEGASUS_AVOID_EMPTY_FILE_WARNING
+
+#endif
@@ -0,0 +1,209 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   DensityMeshGenerator.cpp
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  CPU marching cubes mesh generator, polygonizes a density field without the GPU.
+
+#include "Pegasus/RenderSystems/Volumes/DensityMeshGenerator.h"
+
+#if RENDER_SYSTEM_CONFIG_ENABLE_VOLUMES
+
+#include "Pegasus/RenderSystems/Volumes/VolumesSystem.h"
+#include "Pegasus/RenderSystems/Volumes/MarchingCubes.h"
+#include "Pegasus/Mesh/Shared/MeshEvent.h"
+#include "Pegasus/Texture/TextureData.h"
+#include "Pegasus/Allocator/IAllocator.h"
+#include "Pegasus/Utils/Memset.h"
+
+using namespace Pegasus;
+using namespace Pegasus::Mesh;
+using namespace Pegasus::RenderSystems;
+using namespace Pegasus::Math;
+
+extern RenderSystems::VolumesSystem* gVolumesSystem;
+
+
+BEGIN_IMPLEMENT_PROPERTIES(DensityMeshGenerator)
+    IMPLEMENT_PROPERTY(DensityMeshGenerator, DensityDim)
+    IMPLEMENT_PROPERTY(DensityMeshGenerator, IsoLevel)
+    IMPLEMENT_PROPERTY(DensityMeshGenerator, VoxelSize)
+    IMPLEMENT_PROPERTY(DensityMeshGenerator, Origin)
+END_IMPLEMENT_PROPERTIES(DensityMeshGenerator)
+
+DensityMeshGenerator::DensityMeshGenerator(Pegasus::Alloc::IAllocator* nodeAllocator,
+                          Pegasus::Alloc::IAllocator* nodeDataAllocator)
+: MeshGenerator(nodeAllocator, nodeDataAllocator)
+, mSamples(nullptr)
+, mSampleDim(0)
+, mTextureSamples(nullptr)
+, mTextureSampleCount(0)
+{
+    BEGIN_INIT_PROPERTIES(DensityMeshGenerator)
+        INIT_PROPERTY(DensityDim)
+        INIT_PROPERTY(IsoLevel)
+        INIT_PROPERTY(VoxelSize)
+        INIT_PROPERTY(Origin)
+    END_INIT_PROPERTIES()
+}
+
+DensityMeshGenerator::~DensityMeshGenerator()
+{
+    if (mSamples != nullptr)
+    {
+        PG_DELETE_ARRAY(GetNodeAllocator(), mSamples);
+    }
+    if (mTextureSamples != nullptr)
+    {
+        PG_DELETE_ARRAY(GetNodeAllocator(), mTextureSamples);
+    }
+}
+
+bool DensityMeshGenerator::Update()
+{
+    bool updated = MeshGenerator::Update();
+    if (mDensityTexture != nullptr && mDensityTexture->Update())
+    {
+        //the texture data gets regenerated when read back in GenerateData()
+        InvalidateData();
+        updated = true;
+    }
+    return updated;
+}
+
+void DensityMeshGenerator::UpdateSampleGrid()
+{
+    int dim = GetDensityDim();
+    dim = dim < MinDensityDim ? MinDensityDim : (dim > MaxDensityDim ? MaxDensityDim : dim);
+    if (dim != mSampleDim)
+    {
+        if (mSamples != nullptr)
+        {
+            PG_DELETE_ARRAY(GetNodeAllocator(), mSamples);
+        }
+        const int sampleCount = dim * dim * dim;
+        mSamples = PG_NEW_ARRAY(GetNodeAllocator(), -1, "DensityMeshGenerator::mSamples", Alloc::PG_MEM_PERM, float, sampleCount);
+        Utils::Memset32(mSamples, 0, sampleCount * sizeof(float));
+        mSampleDim = dim;
+    }
+}
+
+void DensityMeshGenerator::SetDensitySample(int x, int y, int z, float density)
+{
+    UpdateSampleGrid();
+    if (x < 0 || y < 0 || z < 0 || x >= mSampleDim || y >= mSampleDim || z >= mSampleDim)
+    {
+        return;
+    }
+
+    mSamples[(z * mSampleDim + y) * mSampleDim + x] = density;
+    InvalidateData();
+}
+
+void DensityMeshGenerator::SetDensityTexture(Texture::TextureIn texture)
+{
+    mDensityTexture = texture;
+    InvalidateData();
+}
+
+bool DensityMeshGenerator::ReadDensityTexture(int& dimX, int& dimY, int& dimZ)
+{
+    Texture::TextureDataRef textureData = mDensityTexture->GetUpdatedTextureData();
+    const Texture::TextureConfiguration& config = textureData->GetConfiguration();
+    if (config.GetType() != Texture::TextureConfiguration::TYPE_3D)
+    {
+        PG_LOG('ERR_', "DensityMeshGenerator needs a 3d texture as density field.");
+        return false;
+    }
+
+    dimX = static_cast<int>(config.GetWidth());
+    dimY = static_cast<int>(config.GetHeight());
+    dimZ = static_cast<int>(config.GetDepth());
+    if (dimX < 2 || dimY < 2 || dimZ < 2)
+    {
+        PG_LOG('ERR_', "DensityMeshGenerator needs a density texture with at least 2 pixels per dimension.");
+        return false;
+    }
+
+    const int sampleCount = dimX * dimY * dimZ;
+    if (sampleCount != mTextureSampleCount)
+    {
+        if (mTextureSamples != nullptr)
+        {
+            PG_DELETE_ARRAY(GetNodeAllocator(), mTextureSamples);
+        }
+        mTextureSamples = PG_NEW_ARRAY(GetNodeAllocator(), -1, "DensityMeshGenerator::mTextureSamples", Alloc::PG_MEM_PERM, float, sampleCount);
+        mTextureSampleCount = sampleCount;
+    }
+
+    const unsigned char* pixels = textureData->GetLayerImageData(0);
+    switch (config.GetPixelFormat())
+    {
+    case Core::FORMAT_R8_UNORM:
+        for (int s = 0; s < sampleCount; ++s)
+        {
+            mTextureSamples[s] = static_cast<float>(pixels[s]) * (1.0f / 255.0f);
+        }
+        break;
+    case Core::FORMAT_RGBA_8_UNORM:
+        for (int s = 0; s < sampleCount; ++s)
+        {
+            mTextureSamples[s] = static_cast<float>(pixels[s * 4]) * (1.0f / 255.0f);
+        }
+        break;
+    case Core::FORMAT_R32_FLOAT:
+        {
+            const float* texels = reinterpret_cast<const float*>(pixels);
+            for (int s = 0; s < sampleCount; ++s)
+            {
+                mTextureSamples[s] = texels[s];
+            }
+        }
+        break;
+    default:
+        PG_LOG('ERR_', "Unsupported density texture format. Use R8_UNORM, RGBA_8_UNORM or R32_FLOAT.");
+        return false;
+    }
+
+    return true;
+}
+
+void DensityMeshGenerator::GenerateData()
+{
+    PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::BEGIN);
+
+    MeshDataRef meshData = GetData();
+    DensityGrid grid;
+    bool validGrid = true;
+    if (mDensityTexture != nullptr)
+    {
+        validGrid = ReadDensityTexture(grid.mDimX, grid.mDimY, grid.mDimZ);
+        grid.mSamples = mTextureSamples;
+    }
+    else
+    {
+        UpdateSampleGrid();
+        grid.mSamples = mSamples;
+        grid.mDimX = grid.mDimY = grid.mDimZ = mSampleDim;
+    }
+
+    if (validGrid)
+    {
+        PolygonizeDensityGrid(*gVolumesSystem->GetCaseTable(), grid, GetIsoLevel(), GetOrigin(), GetVoxelSize(), &(*meshData), GetNodeDataAllocator());
+    }
+    else
+    {
+        meshData->AllocateVertexes(0);
+        meshData->AllocateIndexes(0);
+    }
+
+    PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::END_SUCCESS);
+}
+
+#else
+PEGASUS_AVOID_EMPTY_FILE_WARNING
+#endif
@@ -0,0 +1,340 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MarchingCubes.cpp
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  CPU marching cubes over a density grid.
+
+#include "Pegasus/RenderSystems/Volumes/MarchingCubes.h"
+
+#if RENDER_SYSTEM_CONFIG_ENABLE_VOLUMES
+
+#include "Pegasus/RenderSystems/Volumes/CaseTable.h"
+#include "Pegasus/Mesh/MeshData.h"
+#include "Pegasus/Core/ParallelFor.h"
+#include "Pegasus/Allocator/Alloc.h"
+#include <math.h>
+
+using namespace Pegasus;
+using namespace Pegasus::Mesh;
+using namespace Pegasus::RenderSystems;
+using namespace Pegasus::Math;
+
+//same corner numbering as meshProducer.cs
+static const int sCornerOffsets[8][3] =
+{
+    { 0, 0, 0 },
+    { 1, 0, 0 },
+    { 1, 1, 0 },
+    { 0, 1, 0 },
+    { 0, 0, 1 },
+    { 1, 0, 1 },
+    { 1, 1, 1 },
+    { 0, 1, 1 }
+};
+
+//every sample owns the edges leaving it along +x (0), +y (1) and +z (2).
+//For each cube edge: offset of the sample owning it, and the owned edge axis (same as meshProducer.cs)
+static const int sEdgeOwners[12][4] =
+{
+    { 0, 0, 0, 0 },
+    { 1, 0, 0, 1 },
+    { 0, 1, 0, 0 },
+    { 0, 0, 0, 1 },
+    { 0, 0, 1, 0 },
+    { 1, 0, 1, 1 },
+    { 0, 1, 1, 0 },
+    { 0, 0, 1, 1 },
+    { 0, 0, 0, 2 },
+    { 1, 0, 0, 2 },
+    { 1, 1, 0, 2 },
+    { 0, 1, 0, 2 }
+};
+
+namespace
+{
+
+//! Shared state of the polygonization passes. Work items are z slices of the grid.
+struct MarchingCubesJob
+{
+    const CaseTable* mCaseTable;
+    DensityGrid mGrid;
+    float mIsoLevel;
+    Vec3 mOrigin;
+    float mVoxelSize;
+
+    //per voxel case
+    unsigned char* mCases;
+
+    //per sample and axis, index of the vertex on the owned edge (valid only for crossed edges)
+    int* mEdgeVertices;
+
+    //per slice, vertex and index counts, then offsets
+    int* mSliceVertexCounts;
+    int* mSliceIndexCounts;
+
+    StdVertex* mVertices;
+    unsigned short* mIndices;
+
+    float Sample(int x, int y, int z) const
+    {
+        return mGrid.mSamples[(z * mGrid.mDimY + y) * mGrid.mDimX + x];
+    }
+
+    int SampleIndex(int x, int y, int z) const
+    {
+        return (z * mGrid.mDimY + y) * mGrid.mDimX + x;
+    }
+
+    int VoxelIndex(int x, int y, int z) const
+    {
+        return (z * (mGrid.mDimY - 1) + y) * (mGrid.mDimX - 1) + x;
+    }
+
+    //! \return true if the edge leaving sample (x, y, z) along axis crosses the surface
+    bool IsEdgeCrossed(int x, int y, int z, int axis) const
+    {
+        const int dims[3] = { mGrid.mDimX, mGrid.mDimY, mGrid.mDimZ };
+        int end[3] = { x, y, z };
+        ++end[axis];
+        if (end[axis] >= dims[axis])
+        {
+            return false;
+        }
+        return (Sample(x, y, z) > mIsoLevel) != (Sample(end[0], end[1], end[2]) > mIsoLevel);
+    }
+
+    //! Central difference gradient of the density, one sided on the grid borders
+    Vec3 Gradient(int x, int y, int z) const
+    {
+        const int xa = x > 0 ? x - 1 : x, xb = x < mGrid.mDimX - 1 ? x + 1 : x;
+        const int ya = y > 0 ? y - 1 : y, yb = y < mGrid.mDimY - 1 ? y + 1 : y;
+        const int za = z > 0 ? z - 1 : z, zb = z < mGrid.mDimZ - 1 ? z + 1 : z;
+        return Vec3(
+            (Sample(xb, y, z) - Sample(xa, y, z)) / static_cast<float>(xb - xa),
+            (Sample(x, yb, z) - Sample(x, ya, z)) / static_cast<float>(yb - ya),
+            (Sample(x, y, zb) - Sample(x, y, za)) / static_cast<float>(zb - za));
+    }
+};
+
+//! Pass 1: cases of the voxels of a slice, and vertex / index counts of the slice
+struct CountPass
+{
+    MarchingCubesJob* mJob;
+
+    void operator()(int begin, int end) const
+    {
+        MarchingCubesJob& job = *mJob;
+        const DensityGrid& g = job.mGrid;
+        for (int z = begin; z < end; ++z)
+        {
+            int vertexCount = 0;
+            for (int y = 0; y < g.mDimY; ++y)
+            {
+                for (int x = 0; x < g.mDimX; ++x)
+                {
+                    for (int axis = 0; axis < 3; ++axis)
+                    {
+                        vertexCount += job.IsEdgeCrossed(x, y, z, axis) ? 1 : 0;
+                    }
+                }
+            }
+
+            int indexCount = 0;
+            if (z < g.mDimZ - 1)
+            {
+                for (int y = 0; y < g.mDimY - 1; ++y)
+                {
+                    for (int x = 0; x < g.mDimX - 1; ++x)
+                    {
+                        unsigned int caseId = 0;
+                        for (int c = 0; c < 8; ++c)
+                        {
+                            const float s = job.Sample(x + sCornerOffsets[c][0], y + sCornerOffsets[c][1], z + sCornerOffsets[c][2]);
+                            caseId |= (s > job.mIsoLevel ? 1u : 0u) << c;
+                        }
+                        job.mCases[job.VoxelIndex(x, y, z)] = static_cast<unsigned char>(caseId);
+                        indexCount += job.mCaseTable->GetCase(caseId).triangleCount * 3;
+                    }
+                }
+            }
+
+            job.mSliceVertexCounts[z] = vertexCount;
+            job.mSliceIndexCounts[z] = indexCount;
+        }
+    }
+};
+
+//! Pass 2: vertices of the edges owned by the samples of a slice
+struct VertexPass
+{
+    MarchingCubesJob* mJob;
+
+    void operator()(int begin, int end) const
+    {
+        MarchingCubesJob& job = *mJob;
+        const DensityGrid& g = job.mGrid;
+        const float invDims[3] = {
+            1.0f / static_cast<float>(g.mDimX - 1),
+            1.0f / static_cast<float>(g.mDimY - 1),
+            1.0f / static_cast<float>(g.mDimZ - 1)
+        };
+
+        for (int z = begin; z < end; ++z)
+        {
+            int vertex = job.mSliceVertexCounts[z];
+            for (int y = 0; y < g.mDimY; ++y)
+            {
+                for (int x = 0; x < g.mDimX; ++x)
+                {
+                    for (int axis = 0; axis < 3; ++axis)
+                    {
+                        if (!job.IsEdgeCrossed(x, y, z, axis))
+                        {
+                            continue;
+                        }
+
+                        int b[3] = { x, y, z };
+                        ++b[axis];
+                        const float densityA = job.Sample(x, y, z);
+                        const float densityB = job.Sample(b[0], b[1], b[2]);
+                        const float t = (job.mIsoLevel - densityA) / (densityB - densityA);
+
+                        Vec3 gridPos(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z));
+                        gridPos.v[axis] += t;
+
+                        //density grows towards the inside, the normal points against the gradient
+                        const Vec3 gradientA = job.Gradient(x, y, z);
+                        const Vec3 gradient = gradientA + (job.Gradient(b[0], b[1], b[2]) - gradientA) * t;
+                        const float gradientLength = Length(gradient);
+
+                        StdVertex& v = job.mVertices[vertex];
+                        v.position = Vec4(job.mOrigin + gridPos * job.mVoxelSize, 1.0f);
+                        v.normal = gradientLength > PFLOAT_EPSILON ? gradient * (-1.0f / gradientLength) : Vec3(0.0f, 1.0f, 0.0f);
+                        v.uv = Vec2(gridPos.x * invDims[0], gridPos.z * invDims[2]);
+
+                        job.mEdgeVertices[job.SampleIndex(x, y, z) * 3 + axis] = vertex++;
+                    }
+                }
+            }
+        }
+    }
+};
+
+//! Pass 3: triangles of the voxels of a slice
+struct IndexPass
+{
+    MarchingCubesJob* mJob;
+
+    void operator()(int begin, int end) const
+    {
+        MarchingCubesJob& job = *mJob;
+        const DensityGrid& g = job.mGrid;
+        for (int z = begin; z < end; ++z)
+        {
+            int index = job.mSliceIndexCounts[z];
+            for (int y = 0; y < g.mDimY - 1; ++y)
+            {
+                for (int x = 0; x < g.mDimX - 1; ++x)
+                {
+                    const Case& c = job.mCaseTable->GetCase(job.mCases[job.VoxelIndex(x, y, z)]);
+                    for (int t = 0; t < c.triangleCount; ++t)
+                    {
+                        //the case table winds triangles around the inside, flip them to face outside
+                        static const int sWinding[3] = { 0, 2, 1 };
+                        for (int k = 0; k < 3; ++k)
+                        {
+                            const int* owner = sEdgeOwners[static_cast<int>(c.triangles[t * 3 + sWinding[k]])];
+                            const int sample = job.SampleIndex(x + owner[0], y + owner[1], z + owner[2]);
+                            job.mIndices[index++] = static_cast<unsigned short>(job.mEdgeVertices[sample * 3 + owner[3]]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+};
+
+//! Slices per parallel for chunk
+const int MARCHING_CUBES_GRAIN_SIZE = 2;
+
+}
+
+//----------------------------------------------------------------------------------------
+
+bool RenderSystems::PolygonizeDensityGrid(const CaseTable& caseTable, const DensityGrid& grid, float isoLevel,
+                                          const Vec3& origin, float voxelSize,
+                                          MeshData* meshData, Alloc::IAllocator* allocator)
+{
+    PG_ASSERTSTR(grid.mDimX >= 2 && grid.mDimY >= 2 && grid.mDimZ >= 2, "A density grid needs at least 2 samples per dimension");
+
+    const int sampleCount = grid.mDimX * grid.mDimY * grid.mDimZ;
+    const int voxelCount = (grid.mDimX - 1) * (grid.mDimY - 1) * (grid.mDimZ - 1);
+
+    MarchingCubesJob job;
+    job.mCaseTable = &caseTable;
+    job.mGrid = grid;
+    job.mIsoLevel = isoLevel;
+    job.mOrigin = origin;
+    job.mVoxelSize = voxelSize;
+    job.mCases = PG_NEW_ARRAY(allocator, -1, "MarchingCubes::mCases", Alloc::PG_MEM_TEMP, unsigned char, voxelCount);
+    job.mEdgeVertices = PG_NEW_ARRAY(allocator, -1, "MarchingCubes::mEdgeVertices", Alloc::PG_MEM_TEMP, int, sampleCount * 3);
+    job.mSliceVertexCounts = PG_NEW_ARRAY(allocator, -1, "MarchingCubes::mSliceVertexCounts", Alloc::PG_MEM_TEMP, int, grid.mDimZ);
+    job.mSliceIndexCounts = PG_NEW_ARRAY(allocator, -1, "MarchingCubes::mSliceIndexCounts", Alloc::PG_MEM_TEMP, int, grid.mDimZ);
+    job.mVertices = nullptr;
+    job.mIndices = nullptr;
+
+    CountPass countPass = { &job };
+    Core::ParallelFor(grid.mDimZ, MARCHING_CUBES_GRAIN_SIZE, countPass);
+
+    //turn the slice counts into offsets
+    int vertexCount = 0;
+    int indexCount = 0;
+    for (int z = 0; z < grid.mDimZ; ++z)
+    {
+        const int sliceVertexCount = job.mSliceVertexCounts[z];
+        const int sliceIndexCount = job.mSliceIndexCounts[z];
+        job.mSliceVertexCounts[z] = vertexCount;
+        job.mSliceIndexCounts[z] = indexCount;
+        vertexCount += sliceVertexCount;
+        indexCount += sliceIndexCount;
+    }
+
+    const bool fits = vertexCount <= 0x10000;
+    if (fits)
+    {
+        meshData->AllocateVertexes(vertexCount);
+        meshData->AllocateIndexes(indexCount);
+        if (indexCount > 0)
+        {
+            job.mVertices = meshData->GetStream<StdVertex>(0);
+            job.mIndices = meshData->GetIndexBuffer();
+
+            VertexPass vertexPass = { &job };
+            Core::ParallelFor(grid.mDimZ, MARCHING_CUBES_GRAIN_SIZE, vertexPass);
+
+            IndexPass indexPass = { &job };
+            Core::ParallelFor(grid.mDimZ - 1, MARCHING_CUBES_GRAIN_SIZE, indexPass);
+        }
+    }
+    else
+    {
+        PG_LOG('ERR_', "Marching cubes surface needs %d vertices, more than 16 bit indices can address.", vertexCount);
+        meshData->AllocateVertexes(0);
+        meshData->AllocateIndexes(0);
+    }
+
+    PG_DELETE_ARRAY(allocator, job.mSliceIndexCounts);
+    PG_DELETE_ARRAY(allocator, job.mSliceVertexCounts);
+    PG_DELETE_ARRAY(allocator, job.mEdgeVertices);
+    PG_DELETE_ARRAY(allocator, job.mCases);
+    return fits;
+}
+
+#else
+PEGASUS_AVOID_EMPTY_FILE_WARNING
+#endif
@@ -20,6 +20,7 @@
 #include "Pegasus/Window/Window.h"
 #include "Pegasus/BlockScript/BsVm.h"
 #include "Pegasus/Timeline/Timeline.h"
+#include "Pegasus/Math/BatchCulling.h"
 
 
 using namespace Pegasus;
@@ -46,7 +47,7 @@ END_IMPLEMENT_PROPERTIES(Terrain3d)
 
 Terrain3d::Terrain3d(Alloc::IAllocator* allocator, Mesh::MeshManager* meshManager)
     : Application::GenericResource(allocator),
-      mSegmentListSize(0), mSegmentStackSize(0), mSegmentList(allocator), mSegmentStack(allocator), mMeshManager(meshManager), mMeshPool(allocator), mMeshPoolCount(0)
+      mSegmentListSize(0), mSegmentStackSize(0), mSegmentList(allocator), mSegmentStack(allocator), mCullBatch(allocator), mCullBoxes(allocator), mCullMasks(allocator), mMeshManager(meshManager), mMeshPool(allocator), mMeshPoolCount(0)
 {
     //INIT properties
     BEGIN_INIT_PROPERTIES(Terrain3d)
@@ -146,11 +147,25 @@ void Terrain3d::RegisterSegment(const Terrain3d::Segment& s)
     mSegmentListSize++;
 }
 
-Camera::Camera::CollisionState ComputeCollistion(const Terrain3d::Segment& s, const Camera::Camera::Frustum& f)
+//! Grows a vector to hold at least size elements
+template<class T>
+static void EnsureSize(Utils::Vector<T>& v, unsigned int size)
 {
-    Math::Vec3 aabbMin = Math::Vec3((float)s.offset[0],(float)s.offset[1],(float)s.offset[2]);
-    Math::Vec3 aabbMax = aabbMin + Math::Vec3((float)s.size[0],(float)s.size[1],(float)s.size[2]) * (float)Terrain3d::SEGMENT_UNIT_SIZE * (float)s.sizeResolution;
-    return f.GetCollisionState(aabbMin,aabbMax);
+    while (v.GetSize() < size)
+    {
+        v.PushEmpty();
+    }
+}
+
+//! Writes the box of a segment in the 6 planes of a batch of boxes
+static void SetSegmentBox(const Terrain3d::Segment& s, float* boxes, int pitch, int index)
+{
+    const float extent = (float)Terrain3d::SEGMENT_UNIT_SIZE * (float)s.sizeResolution;
+    for (int d = 0; d < 3; ++d)
+    {
+        boxes[d * pitch + index] = (float)s.offset[d];
+        boxes[(d + 3) * pitch + index] = (float)s.offset[d] + (float)s.size[d] * extent;
+    }
 }
 
 void Terrain3d::GenerateCullingData(unsigned int windowWidth, unsigned int windowHeight)
@@ -177,68 +192,44 @@ void Terrain3d::GenerateCullingData(unsigned int windowWidth, unsigned int windo
             PushStack(mTerrainCoverBoxes[i]);
         }
         
+        //Step 3, cull the whole stack in one batch, then push the pieces of the intersecting segments for the next batch.
         while (mSegmentStackSize > 0)
         {
 //! use this to debug the initial position of the lod boxes.
 #if 1
-            const Terrain3d::Segment s = PopStack();
-            Camera::Camera::CollisionState collisionState = ComputeCollistion(s, f);
-            switch(collisionState)
+            const unsigned int batchSize = mSegmentStackSize;
+            const int maskSize = Math::GetCullMaskSize(batchSize);
+            EnsureSize(mCullBatch, batchSize);
+            EnsureSize(mCullBoxes, 6 * batchSize);
+            EnsureSize(mCullMasks, 2 * maskSize);
+            for (unsigned int b = 0; b < batchSize; ++b)
+            {
+                mCullBatch[b] = PopStack();
+                SetSegmentBox(mCullBatch[b], mCullBoxes.Data(), batchSize, b);
+            }
+
+            PUInt32* insideMask = mCullMasks.Data();
+            PUInt32* outsideMask = insideMask + maskSize;
+            f.GetCollisionStates(insideMask, outsideMask, mCullBoxes.Data(), batchSize, batchSize);
+
+            for (unsigned int b = 0; b < batchSize; ++b)
             {
-            case Camera::Camera::INSIDE:                
-                RegisterSegment(s);  
-                break;
-            case Camera::Camera::INTERSECT:
-                //break the segment into 8 segments
-                if (s.size[0] == 1 && s.size[1] == 1 && s.size[2] == 1)
+                const PUInt32 bit = 1ul << (b & 31);
+                if ((outsideMask[b >> 5] & bit) != 0)
+                {
+                    continue;
+                }
+
+                const Terrain3d::Segment& s = mCullBatch[b];
+                if ((insideMask[b >> 5] & bit) != 0)
                 {
                     RegisterSegment(s);
                 }
-                else if (s.size[0] > 0 && s.size[1] > 0 && s.size[2] > 0)
+                else
                 {
-                    int divisions[3][2];
-                    int offset[3];
-                    for (int d = 0; d < 3; ++d)
-                    {
-                        divisions[d][0] = (s.size[d] % 2) == 0 ? s.size[d] / 2 : (s.size[d] / 2) + 1;
-                        divisions[d][1] = s.size[d] -  divisions[d][0];
-                    }
-
-                    offset[0] = 0;
-                    for (int i = 0; i < 2; ++i)
-                    {
-                        if (divisions[0][i] == 0) continue;
-                        offset[1] = 0;
-                        for (int j = 0; j < 2; ++j)
-                        {
-                            if (divisions[1][j] == 0) continue;
-                            offset[2] = 0;
-                            for (int k = 0; k < 2; ++k)
-                            {
-                                if (divisions[2][k] == 0) continue;
-                                Terrain3d::Segment newS = s;
-                                newS.offset[0] += offset[0];
-                                newS.offset[1] += offset[1];
-                                newS.offset[2] += offset[2];
-
-                                newS.size[0] = divisions[0][i];
-                                newS.size[1] = divisions[1][j];
-                                newS.size[2] = divisions[2][k];
-
-                                PushStack(newS);
-                                offset[2] += divisions[2][k]*SEGMENT_UNIT_SIZE*s.sizeResolution;
-                            }
-                            offset[1] += divisions[1][j]*SEGMENT_UNIT_SIZE*s.sizeResolution;
-                        }
-                        offset[0] += divisions[0][i]*SEGMENT_UNIT_SIZE*s.sizeResolution;
-                    }
+                    SplitSegment(s);
                 }
-                break;
-            case Camera::Camera::OUTSIDE:
-            default:
-                break;
             }
-            
 #else
             RegisterSegment(PopStack());
 #endif
@@ -250,6 +241,54 @@ void Terrain3d::GenerateCullingData(unsigned int windowWidth, unsigned int windo
     }
 }
 
+void Terrain3d::SplitSegment(const Terrain3d::Segment& s)
+{
+    //break the segment into 8 segments
+    if (s.size[0] == 1 && s.size[1] == 1 && s.size[2] == 1)
+    {
+        RegisterSegment(s);
+    }
+    else if (s.size[0] > 0 && s.size[1] > 0 && s.size[2] > 0)
+    {
+        int divisions[3][2];
+        int offset[3];
+        for (int d = 0; d < 3; ++d)
+        {
+            divisions[d][0] = (s.size[d] % 2) == 0 ? s.size[d] / 2 : (s.size[d] / 2) + 1;
+            divisions[d][1] = s.size[d] -  divisions[d][0];
+        }
+
+        offset[0] = 0;
+        for (int i = 0; i < 2; ++i)
+        {
+            if (divisions[0][i] == 0) continue;
+            offset[1] = 0;
+            for (int j = 0; j < 2; ++j)
+            {
+                if (divisions[1][j] == 0) continue;
+                offset[2] = 0;
+                for (int k = 0; k < 2; ++k)
+                {
+                    if (divisions[2][k] == 0) continue;
+                    Terrain3d::Segment newS = s;
+                    newS.offset[0] += offset[0];
+                    newS.offset[1] += offset[1];
+                    newS.offset[2] += offset[2];
+
+                    newS.size[0] = divisions[0][i];
+                    newS.size[1] = divisions[1][j];
+                    newS.size[2] = divisions[2][k];
+
+                    PushStack(newS);
+                    offset[2] += divisions[2][k]*SEGMENT_UNIT_SIZE*s.sizeResolution;
+                }
+                offset[1] += divisions[1][j]*SEGMENT_UNIT_SIZE*s.sizeResolution;
+            }
+            offset[0] += divisions[0][i]*SEGMENT_UNIT_SIZE*s.sizeResolution;
+        }
+    }
+}
+
 static void CreateTerrain3d_Callback(BlockScript::FunCallbackContext& context)
 {
     BlockScript::FunParamStream stream(context);
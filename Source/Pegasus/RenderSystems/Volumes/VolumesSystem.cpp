@@ -15,7 +15,12 @@
 #include "Pegasus/Mesh/MeshManager.h"
 #include "Pegasus/RenderSystems/Volumes/MarchingCubeMeshGenerator.h"
 #include "Pegasus/RenderSystems/Volumes/Terrain3dGenerator.h"
+#include "Pegasus/RenderSystems/Volumes/DensityMeshGenerator.h"
 #include "Pegasus/RenderSystems/Volumes/Terrain3d.h"
+#include "Pegasus/Application/RenderCollection.h"
+#include "Pegasus/BlockScript/BsVm.h"
+#include "Pegasus/BlockScript/FunCallback.h"
+#include "Pegasus/Utils/String.h"
 #include "Pegasus/Core/IApplicationContext.h"
 #include "Pegasus/Core/Formats.h"
 #include "Pegasus/Shader/ShaderManager.h"
@@ -189,12 +194,98 @@ void VolumesSystem::ComputeTerrainMesh(VolumesResources& resources, Render::Buff
     Render::UnbindComputeOutputs();
 }
 
+//! \return the density mesh generator of a blockscript handle, nullptr if the handle is not one
+static DensityMeshGenerator* GetDensityMeshGenerator(BlockScript::FunCallbackContext& context, Application::RenderCollection::CollectionHandle handle)
+{
+    if (handle == Application::RenderCollection::INVALID_HANDLE)
+    {
+        return nullptr;
+    }
+
+    Application::RenderCollection* collection = static_cast<Application::RenderCollection*>(context.GetVmState()->GetUserContext());
+    Mesh::MeshGenerator* generator = Application::RenderCollection::GetResource<Mesh::MeshGenerator>(collection, handle);
+    if (Utils::Strcmp(generator->GetClassInstanceName(), DensityMeshGenerator::GetClassName()) != 0)
+    {
+        return nullptr;
+    }
+    return static_cast<DensityMeshGenerator*>(generator);
+}
+
+static void SetDensitySample_Callback(BlockScript::FunCallbackContext& context)
+{
+    BlockScript::FunParamStream stream(context);
+    Application::RenderCollection::CollectionHandle genHandle = stream.NextArgument<Application::RenderCollection::CollectionHandle>();
+    int x = stream.NextArgument<int>();
+    int y = stream.NextArgument<int>();
+    int z = stream.NextArgument<int>();
+    float density = stream.NextArgument<float>();
+
+    DensityMeshGenerator* generator = GetDensityMeshGenerator(context, genHandle);
+    if (generator != nullptr)
+    {
+        generator->SetDensitySample(x, y, z, density);
+    }
+    else
+    {
+        PG_LOG('ERR_', "SetDensitySample needs a DensityMeshGenerator.");
+    }
+}
+
+static void SetDensityTexture_Callback(BlockScript::FunCallbackContext& context)
+{
+    BlockScript::FunParamStream stream(context);
+    Application::RenderCollection::CollectionHandle genHandle = stream.NextArgument<Application::RenderCollection::CollectionHandle>();
+    Application::RenderCollection::CollectionHandle texHandle = stream.NextArgument<Application::RenderCollection::CollectionHandle>();
+
+    DensityMeshGenerator* generator = GetDensityMeshGenerator(context, genHandle);
+    if (generator != nullptr && texHandle != Application::RenderCollection::INVALID_HANDLE)
+    {
+        Application::RenderCollection* collection = static_cast<Application::RenderCollection*>(context.GetVmState()->GetUserContext());
+        Texture::TextureRef texture = Application::RenderCollection::GetResource<Texture::Texture>(collection, texHandle);
+        generator->SetDensityTexture(texture);
+    }
+    else
+    {
+        PG_LOG('ERR_', "SetDensityTexture needs a DensityMeshGenerator and a valid texture.");
+    }
+}
+
 void VolumesSystem::OnRegisterBlockscriptApi(BlockScript::BlockLib* blocklib, Core::IApplicationContext* appContext)
 {
     Utils::Vector<BlockScript::FunctionDeclarationDesc> methods;
     Utils::Vector<BlockScript::FunctionDeclarationDesc> functions;
     Terrain3d::GetBlockScriptApi(methods, functions);
 
+    //density mesh generator inputs, the density function is evaluated by the script
+    BlockScript::FunctionDeclarationDesc desc;
+    desc.functionName = "SetDensitySample";
+    desc.returnType = "int";
+    desc.argumentTypes[0] = "MeshGenerator";
+    desc.argumentNames[0] = "densityGenerator";
+    desc.argumentTypes[1] = "int";
+    desc.argumentNames[1] = "x";
+    desc.argumentTypes[2] = "int";
+    desc.argumentNames[2] = "y";
+    desc.argumentTypes[3] = "int";
+    desc.argumentNames[3] = "z";
+    desc.argumentTypes[4] = "float";
+    desc.argumentNames[4] = "density";
+    desc.argumentTypes[5] = nullptr;
+    desc.argumentNames[5] = nullptr;
+    desc.callback = SetDensitySample_Callback;
+    functions.PushEmpty() = desc;
+
+    desc.functionName = "SetDensityTexture";
+    desc.returnType = "int";
+    desc.argumentTypes[0] = "MeshGenerator";
+    desc.argumentNames[0] = "densityGenerator";
+    desc.argumentTypes[1] = "Texture";
+    desc.argumentNames[1] = "densityTexture";
+    desc.argumentTypes[2] = nullptr;
+    desc.argumentNames[2] = nullptr;
+    desc.callback = SetDensityTexture_Callback;
+    functions.PushEmpty() = desc;
+
     //Include references to the camera render system.
     RenderSystemManager* renderSystemManager = appContext->GetRenderSystemManager();
     const RenderSystemManager::RenderSystemContainer* camSystem = renderSystemManager->FindSystem("CameraSystem");
@@ -215,6 +306,7 @@ void VolumesSystem::OnRegisterCustomMeshNodes(Pegasus::Mesh::MeshManager* meshMa
 {
     meshManager->RegisterMeshNode("MarchingCubeMeshGenerator", MarchingCubeMeshGenerator::CreateNode);
     meshManager->RegisterMeshNode("Terrain3dGenerator", Terrain3dGenerator::CreateNode);
+    meshManager->RegisterMeshNode("DensityMeshGenerator", DensityMeshGenerator::CreateNode);
 }
 
 #if PEGASUS_ENABLE_PROXIES
@@ -32,6 +32,7 @@ BEGIN_IMPLEMENT_PROPERTIES(Block)
     IMPLEMENT_PROPERTY(Block, Color)
     IMPLEMENT_PROPERTY(Block, Beat)
     IMPLEMENT_PROPERTY(Block, Duration)
+    IMPLEMENT_PROPERTY(Block, UpdateGroup)
 END_IMPLEMENT_PROPERTIES(Block)
 
 
@@ -55,6 +56,7 @@ Block::Block(Alloc::IAllocator * allocator, Core::IApplicationContext * appConte
         INIT_PROPERTY(Color)
         INIT_PROPERTY(Beat)
         INIT_PROPERTY(Duration)
+        INIT_PROPERTY(UpdateGroup)
     END_INIT_PROPERTIES()
 #if PEGASUS_ENABLE_PROXIES
     mGuid = sNextBlockGuid++;
@@ -95,9 +97,37 @@ TimelineScriptReturn Block::GetScript()
 
 //----------------------------------------------------------------------------------------
 
+void Block::PrepareUpdate()
+{
+    mScriptRunner.PrepareUpdate();
+}
+
+//----------------------------------------------------------------------------------------
+
+void Block::UpdateConcurrent(const UpdateInfo& updateInfo)
+{
+    mScriptRunner.CallUpdateScript(updateInfo);
+}
+
+//----------------------------------------------------------------------------------------
+
+void Block::FlushPropertyChanges()
+{
+    mScriptRunner.FlushPropertyChanges();
+}
+
+//----------------------------------------------------------------------------------------
+
 void Block::Update(const UpdateInfo& updateInfo)
 {
-    mScriptRunner.CallUpdate(updateInfo);
+    mScriptRunner.UpdateNodes();
+}
+
+//----------------------------------------------------------------------------------------
+
+void Block::CaptureRenderProperties(PropertyGrid::PropertySnapshot& snapshot)
+{
+    mScriptRunner.CaptureRenderProperties(snapshot);
 }
 
 //----------------------------------------------------------------------------------------
@@ -115,6 +145,19 @@ void Block::Render(const RenderInfo& renderInfo)
 
 //----------------------------------------------------------------------------------------
 
+void Block::PrepareRender(const RenderInfo& renderInfo)
+{
+#if PEGASUS_ENABLE_PROXIES
+    if (!mWindowIsInitialized[renderInfo.windowId])
+    {
+        OnWindowCreated(renderInfo.windowId);
+    }
+#endif
+    mScriptRunner.PrepareRender(renderInfo.windowId);
+}
+
+//----------------------------------------------------------------------------------------
+
 void Block::Initialize()
 {
     //! don't use asset categories because these are set externally already.
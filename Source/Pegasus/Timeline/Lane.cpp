@@ -36,6 +36,7 @@ Lane::Lane(Alloc::IAllocator * allocator, Timeline * timeline)
 ,   mTimeline(timeline)
 ,   mFirstBlockIndex(0)
 ,   mNumBlocks(0)
+,   mSortedBlocksDirty(true)
 #if PEGASUS_ENABLE_PROXIES
 ,   mProxy(this)
 #endif
@@ -43,8 +44,14 @@ Lane::Lane(Alloc::IAllocator * allocator, Timeline * timeline)
     PG_ASSERTSTR(allocator != nullptr, "Invalid allocator given to a timeline Lane object");
     PG_ASSERTSTR(timeline != nullptr, "Invalid timeline given to a timeline Lane object");
 
+    // Allocate the initial block records, the arrays grow with the number of blocks
+    mBlockCapacity = LANE_INITIAL_NUM_BLOCKS;
+    mBlockRecords = PG_NEW_ARRAY(mAllocator, -1, "Lane::mBlockRecords", Alloc::PG_MEM_PERM, BlockRecord, mBlockCapacity);
+    mSortedBlockBeats = PG_NEW_ARRAY(mAllocator, -1, "Lane::mSortedBlockBeats", Alloc::PG_MEM_PERM, Beat, mBlockCapacity);
+    mSortedBlockRecords = PG_NEW_ARRAY(mAllocator, -1, "Lane::mSortedBlockRecords", Alloc::PG_MEM_PERM, int, mBlockCapacity);
+
     // Set all block records as invalid
-    for (unsigned int b = 0; b < LANE_MAX_NUM_BLOCKS; ++b)
+    for (unsigned int b = 0; b < mBlockCapacity; ++b)
     {
         mBlockRecords[b].mBlock = nullptr;
         mBlockRecords[b].mNext = INVALID_RECORD_INDEX;
@@ -64,13 +71,17 @@ Lane::Lane(Alloc::IAllocator * allocator, Timeline * timeline)
 Lane::~Lane()
 {
     // Destroy the blocks allocated in the lane
-    for (unsigned int b = 0; b < LANE_MAX_NUM_BLOCKS; ++b)
+    for (unsigned int b = 0; b < mBlockCapacity; ++b)
     {
         if (mBlockRecords[b].mBlock != nullptr)
         {
             PG_DELETE(mAllocator, mBlockRecords[b].mBlock);
         }
     }
+
+    PG_DELETE_ARRAY(mAllocator, mBlockRecords);
+    PG_DELETE_ARRAY(mAllocator, mSortedBlockBeats);
+    PG_DELETE_ARRAY(mAllocator, mSortedBlockRecords);
 }
 
 //----------------------------------------------------------------------------------------
@@ -345,23 +356,44 @@ void Lane::UninitializeBlocks()
 //----------------------------------------------------------------------------------------
 void Lane::Update(UpdateInfo& updateInfo)
 {
-    //! \todo The current approach is extremely brute force and inefficient.
-    //! \todo Cache the current selected block in function of the timeline time.
+    Block * block = PrepareUpdate(updateInfo.beat, updateInfo.relativeBeat);
+    if (block != nullptr)
+    {
+        block->UpdateConcurrent(updateInfo);
+        block->FlushPropertyChanges();
+        block->Update(updateInfo);
+    }
+}
+
+//----------------------------------------------------------------------------------------
 
+Block * Lane::PrepareUpdate(float beat, float & relativeBeat)
+{
     Block * block = nullptr;
-    if (FindBlockAndComputeRelativeBeat(updateInfo.beat, block, updateInfo.relativeBeat))
+    if (FindBlockAndComputeRelativeBeat(beat, block, relativeBeat))
     {
-        block->Update(updateInfo);
+        block->PrepareUpdate();
+        return block;
     }
+    return nullptr;
 }
 
 //----------------------------------------------------------------------------------------
 
 void Lane::Render(RenderInfo& renderInfo)
 {
-    //! \todo The current approach is extremely brute force and inefficient.
-    //! \todo Cache the current selected block in function of the timeline time.
+    Block * block = nullptr;
+    if (!FindBlockAndComputeRelativeBeat(renderInfo.beat, block, renderInfo.relativeBeat))
+    {
+        block = nullptr;
+    }
+    RenderBlock(block, renderInfo);
+}
 
+//----------------------------------------------------------------------------------------
+
+void Lane::RenderBlock(Block* block, const RenderInfo& renderInfo)
+{
 #if PEGASUS_ENABLE_PROXIES
         //lazy initialization in case we missed the initial call, because of live editing.
         //In this context, live editing means the user creating a new timeline from scratch from the editor.
@@ -371,12 +403,27 @@ void Lane::Render(RenderInfo& renderInfo)
     }
 #endif
 
-    Block * block = nullptr;
-    if (FindBlockAndComputeRelativeBeat(renderInfo.beat, block, renderInfo.relativeBeat))
+    if (block != nullptr)
     {
         block->Render(renderInfo);
     }
+}
 
+//----------------------------------------------------------------------------------------
+
+void Lane::PrepareRenderBlock(Block* block, const RenderInfo& renderInfo)
+{
+#if PEGASUS_ENABLE_PROXIES
+    if (!mWindowIsInitialized[renderInfo.windowId])
+    {
+        OnWindowCreated(renderInfo.windowId);
+    }
+#endif
+
+    if (block != nullptr)
+    {
+        block->PrepareRender(renderInfo);
+    }
 }
 
 //----------------------------------------------------------------------------------------
@@ -474,37 +521,40 @@ void Lane::DumpToLog()
 
 //----------------------------------------------------------------------------------------
 
-int Lane::FindCurrentBlock(Beat beat) const
+int Lane::FindCurrentBlock(Beat beat)
 {
-    // If the list of blocks is empty, no valid index can be returned
-    if (mNumBlocks == 0)
-    {
-        PG_ASSERTSTR(mBlockRecords[mFirstBlockIndex].mBlock == nullptr, "Invalid first block record in the lane, it is supposed to be nullptr");
-        return INVALID_RECORD_INDEX;
-    }
+    UpdateSortedBlocks();
 
-    // Test if we are before the first block
-    PG_ASSERTSTR(mBlockRecords[mFirstBlockIndex].mBlock != nullptr, "Invalid first block record in the lane, it is supposed to be a valid one");
-    if (beat < mBlockRecords[mFirstBlockIndex].mBlock->GetBeat())
-    {
-        return INVALID_RECORD_INDEX;
-    }
+    const int position = mCursor.Find(mSortedBlockBeats, static_cast<int>(mNumBlocks), beat);
+    return (position == LaneCursor::BEFORE_FIRST_BLOCK) ? INVALID_RECORD_INDEX : mSortedBlockRecords[position];
+}
 
-    // Look for the space between two blocks where the beat can fit
-    int current = mFirstBlockIndex;
-    int next = mBlockRecords[mFirstBlockIndex].mNext;
-    PG_ASSERTSTR(mBlockRecords[next].mBlock != nullptr, "Invalid block record in the lane, it is supposed to be a valid one");
-    while (   (next != mFirstBlockIndex)
-           && (beat >= mBlockRecords[next].mBlock->GetBeat()) )
+//----------------------------------------------------------------------------------------
+
+void Lane::UpdateSortedBlocks()
+{
+    if (mSortedBlocksDirty)
     {
-        current = next;
-        next = mBlockRecords[next].mNext;
-        PG_ASSERTSTR(next != INVALID_RECORD_INDEX, "Invalid block record in the lane, it is supposed to have a next record");
-        PG_ASSERTSTR(mBlockRecords[next].mBlock != nullptr, "Invalid block record in the lane, it is supposed to be a valid one");
-    }
+        // Flatten the linked list, it is already sorted by position
+        if (mNumBlocks > 0)
+        {
+            int currentIndex = mFirstBlockIndex;
+            unsigned int b = 0;
+            do
+            {
+                PG_ASSERTSTR(mBlockRecords[currentIndex].mBlock != nullptr, "Invalid block record in the lane, it is supposed to be a valid one");
+                mSortedBlockBeats[b] = mBlockRecords[currentIndex].mBlock->GetBeat();
+                mSortedBlockRecords[b] = currentIndex;
+                ++b;
+                currentIndex = mBlockRecords[currentIndex].mNext;
+            }
+            while (currentIndex != mFirstBlockIndex);
+            PG_ASSERTSTR(b == mNumBlocks, "Invalid linked list of blocks in the lane");
+        }
 
-    // Output the block indexes
-    return current;
+        mCursor.Invalidate();
+        mSortedBlocksDirty = false;
+    }
 }
 
 //----------------------------------------------------------------------------------------
@@ -555,13 +605,13 @@ void Lane::FindCurrentAndNextBlocks(Beat beat, int & currentBlockIndex, int & ne
 int Lane::FindFirstAvailableBlockRecord() const
 {
     // No free block record found
-    if (mNumBlocks >= LANE_MAX_NUM_BLOCKS)
+    if (mNumBlocks >= mBlockCapacity)
     {
         return INVALID_RECORD_INDEX;
     }
 
     // Look for an available block record
-    for (unsigned int b = 0; b < LANE_MAX_NUM_BLOCKS; ++b)
+    for (unsigned int b = 0; b < mBlockCapacity; ++b)
     {
         if (mBlockRecords[b].mNext == INVALID_RECORD_INDEX)
         {
@@ -577,6 +627,45 @@ int Lane::FindFirstAvailableBlockRecord() const
 
 //----------------------------------------------------------------------------------------
 
+bool Lane::GrowBlockRecords()
+{
+    if (mBlockCapacity >= LANE_MAX_NUM_BLOCKS)
+    {
+        return false;
+    }
+
+    const unsigned int newCapacity = Math::Min(2 * mBlockCapacity, static_cast<unsigned int>(LANE_MAX_NUM_BLOCKS));
+    BlockRecord * const newBlockRecords = PG_NEW_ARRAY(mAllocator, -1, "Lane::mBlockRecords", Alloc::PG_MEM_PERM, BlockRecord, newCapacity);
+
+    // Keep the records at the same indices, the links stay valid
+    for (unsigned int b = 0; b < newCapacity; ++b)
+    {
+        if (b < mBlockCapacity)
+        {
+            newBlockRecords[b] = mBlockRecords[b];
+        }
+        else
+        {
+            newBlockRecords[b].mBlock = nullptr;
+            newBlockRecords[b].mNext = INVALID_RECORD_INDEX;
+        }
+    }
+    PG_DELETE_ARRAY(mAllocator, mBlockRecords);
+    mBlockRecords = newBlockRecords;
+
+    // The sorted arrays are rebuilt from the linked list
+    PG_DELETE_ARRAY(mAllocator, mSortedBlockBeats);
+    PG_DELETE_ARRAY(mAllocator, mSortedBlockRecords);
+    mSortedBlockBeats = PG_NEW_ARRAY(mAllocator, -1, "Lane::mSortedBlockBeats", Alloc::PG_MEM_PERM, Beat, newCapacity);
+    mSortedBlockRecords = PG_NEW_ARRAY(mAllocator, -1, "Lane::mSortedBlockRecords", Alloc::PG_MEM_PERM, int, newCapacity);
+    mSortedBlocksDirty = true;
+
+    mBlockCapacity = newCapacity;
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+
 int Lane::FindBlockIndex(Block * block) const
 {
     if (block != nullptr)
@@ -613,7 +702,7 @@ int Lane::FindBlockIndex(Block * block) const
 
 int Lane::FindPreviousBlockIndex(int blockIndex) const
 {
-    if ((blockIndex  >= 0) && (blockIndex < LANE_MAX_NUM_BLOCKS))
+    if ((blockIndex  >= 0) && (blockIndex < static_cast<int>(mBlockCapacity)))
     {
         Block * const block = mBlockRecords[blockIndex].mBlock;
         if (block != nullptr)
@@ -650,7 +739,7 @@ int Lane::FindPreviousBlockIndex(int blockIndex) const
     }
     else
     {
-        PG_FAILSTR("Invalid block record index (%d), it should be >= 0 and < %u", blockIndex, LANE_MAX_NUM_BLOCKS);
+        PG_FAILSTR("Invalid block record index (%d), it should be >= 0 and < %u", blockIndex, mBlockCapacity);
         return INVALID_RECORD_INDEX;
     }
 }
@@ -659,7 +748,7 @@ int Lane::FindPreviousBlockIndex(int blockIndex) const
 
 int Lane::FindNextBlockIndex(int blockIndex) const
 {
-    if ((blockIndex  >= 0) && (blockIndex < LANE_MAX_NUM_BLOCKS))
+    if ((blockIndex  >= 0) && (blockIndex < static_cast<int>(mBlockCapacity)))
     {
         Block * const block = mBlockRecords[blockIndex].mBlock;
         if (block != nullptr)
@@ -683,7 +772,7 @@ int Lane::FindNextBlockIndex(int blockIndex) const
     }
     else
     {
-        PG_FAILSTR("Invalid block record index (%d), it should be >= 0 and < %u", blockIndex, LANE_MAX_NUM_BLOCKS);
+        PG_FAILSTR("Invalid block record index (%d), it should be >= 0 and < %u", blockIndex, mBlockCapacity);
         return INVALID_RECORD_INDEX;
     }
 }
@@ -703,8 +792,10 @@ bool Lane::InsertBlock(Block * block)
 
         block->SetLane(this);
 
-        if (mNumBlocks < LANE_MAX_NUM_BLOCKS)
+        if ((mNumBlocks < mBlockCapacity) || GrowBlockRecords())
         {
+            mSortedBlocksDirty = true;
+
             // Find where to insert the block
             int currentBlockIndex, nextBlockIndex;
             FindCurrentAndNextBlocks(block->GetBeat(), currentBlockIndex, nextBlockIndex);
@@ -814,9 +905,10 @@ bool Lane::InsertBlock(Block * block)
 void Lane::RemoveBlock(int blockIndex)
 {
     if (   (blockIndex >= 0)
-        && (blockIndex < LANE_MAX_NUM_BLOCKS) )
+        && (blockIndex < static_cast<int>(mBlockCapacity)) )
     {
         PG_ASSERTSTR(mNumBlocks >= 1, "Internal error when removing a block from a lane");
+        mSortedBlocksDirty = true;
 
         if (mNumBlocks == 1)
         {
@@ -849,7 +941,7 @@ void Lane::RemoveBlock(int blockIndex)
     }
     else
     {
-        PG_FAILSTR("Invalid block record index (%d), it should be >= 0 and < %u", blockIndex, LANE_MAX_NUM_BLOCKS);
+        PG_FAILSTR("Invalid block record index (%d), it should be >= 0 and < %u", blockIndex, mBlockCapacity);
     }
 }
 
@@ -858,7 +950,7 @@ void Lane::RemoveBlock(int blockIndex)
 void Lane::SetBlockBeat(int blockIndex, Beat beat)
 {
     if (   (blockIndex >= 0)
-        && (blockIndex < LANE_MAX_NUM_BLOCKS) )
+        && (blockIndex < static_cast<int>(mBlockCapacity)) )
     {
         PG_ASSERTSTR(mNumBlocks >= 1, "Internal error when moving a block");
 
@@ -877,7 +969,7 @@ void Lane::SetBlockBeat(int blockIndex, Beat beat)
     }
     else
     {
-        PG_FAILSTR("Invalid block record index (%d), it should be >= 0 and < %u", blockIndex, LANE_MAX_NUM_BLOCKS);
+        PG_FAILSTR("Invalid block record index (%d), it should be >= 0 and < %u", blockIndex, mBlockCapacity);
     }
 }
 
@@ -886,7 +978,7 @@ void Lane::SetBlockBeat(int blockIndex, Beat beat)
 void Lane::SetBlockDuration(int blockIndex, Duration duration)
 {
     if (   (blockIndex >= 0)
-        && (blockIndex < LANE_MAX_NUM_BLOCKS) )
+        && (blockIndex < static_cast<int>(mBlockCapacity)) )
     {
         PG_ASSERTSTR(mNumBlocks >= 1, "Internal error when resizing a block");
 
@@ -905,7 +997,7 @@ void Lane::SetBlockDuration(int blockIndex, Duration duration)
     }
     else
     {
-        PG_FAILSTR("Invalid block record index (%d), it should be >= 0 and < %u", blockIndex, LANE_MAX_NUM_BLOCKS);
+        PG_FAILSTR("Invalid block record index (%d), it should be >= 0 and < %u", blockIndex, mBlockCapacity);
     }
 }
 
@@ -914,7 +1006,7 @@ void Lane::SetBlockDuration(int blockIndex, Duration duration)
 void Lane::MoveBlockToLane(int blockIndex, Lane * newLane, Beat beat)
 {
     if (   (blockIndex >= 0)
-        && (blockIndex < LANE_MAX_NUM_BLOCKS) )
+        && (blockIndex < static_cast<int>(mBlockCapacity)) )
     {
         PG_ASSERTSTR(mNumBlocks >= 1, "Internal error when moving a block to another lane");
 
@@ -942,7 +1034,7 @@ void Lane::MoveBlockToLane(int blockIndex, Lane * newLane, Beat beat)
     }
     else
     {
-        PG_FAILSTR("Invalid block record index (%d), it should be >= 0 and < %u", blockIndex, LANE_MAX_NUM_BLOCKS);
+        PG_FAILSTR("Invalid block record index (%d), it should be >= 0 and < %u", blockIndex, mBlockCapacity);
     }
 }
 
@@ -950,9 +1042,6 @@ void Lane::MoveBlockToLane(int blockIndex, Lane * newLane, Beat beat)
 
 bool Lane::FindBlockAndComputeRelativeBeat(float beat, Block * & block, float & relativeBeat)
 {
-    //! \todo The current approach is extremely brute force and inefficient.
-    //! \todo Cache the current selected block in function of the timeline time.
-
     if (mNumBlocks > 0)
     {
         // Convert the time in floating point format to a tick
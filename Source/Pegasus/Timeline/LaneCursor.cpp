@@ -0,0 +1,67 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file	LaneCursor.cpp
+//! \author	Kleber Garcia
+//! \date	October 18th 2026
+//! \brief	Playback cursor, finds the current block of a lane in amortized constant time
+
+#include "Pegasus/Timeline/LaneCursor.h"
+
+namespace Pegasus {
+namespace Timeline {
+
+
+int LaneCursor::Find(const Beat * beats, int numBlocks, Beat beat)
+{
+    // Playing forward from the previous block, step over the few blocks that got reached
+    if (mValid && mPosition < numBlocks && (mPosition == BEFORE_FIRST_BLOCK || beat >= beats[mPosition]))
+    {
+        int position = mPosition;
+        for (int step = 0; step < MAX_FORWARD_STEPS; ++step)
+        {
+            if (position + 1 >= numBlocks || beat < beats[position + 1])
+            {
+                mPosition = position;
+                return position;
+            }
+            ++position;
+        }
+    }
+
+    // Seek backward, long jump or blocks changed
+    mPosition = BinarySearch(beats, numBlocks, beat);
+    mValid = true;
+    return mPosition;
+}
+
+//----------------------------------------------------------------------------------------
+
+int LaneCursor::BinarySearch(const Beat * beats, int numBlocks, Beat beat)
+{
+    // Find the first block starting after the beat, the current block is the one before
+    int first = 0;
+    int count = numBlocks;
+    while (count > 0)
+    {
+        const int half = count >> 1;
+        if (beat >= beats[first + half])
+        {
+            first += half + 1;
+            count -= half + 1;
+        }
+        else
+        {
+            count = half;
+        }
+    }
+
+    return first - 1;
+}
+
+
+}   // namespace Timeline
+}   // namespace Pegasus
@@ -146,6 +146,13 @@ void LaneProxy::MoveBlockToLane(IBlockProxy * block, ILaneProxy * newLane, Beat
 
 //----------------------------------------------------------------------------------------
 
+unsigned int LaneProxy::GetNumBlocks() const
+{
+    return mLane->GetNumBlocks();
+}
+
+//----------------------------------------------------------------------------------------
+
 unsigned int LaneProxy::GetBlocks(IBlockProxy ** blocks) const
 {
     return mLane->GetBlocks(blocks);
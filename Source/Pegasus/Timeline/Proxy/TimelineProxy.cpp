@@ -194,16 +194,28 @@ IBlockProxy* TimelineProxy::FindBlockByGuid(unsigned blockGuid)
     for (unsigned l = 0; l < numOfLanes; ++l)
     {
         ILaneProxy* lane = GetLane(l);
-        IBlockProxy* blocks[LANE_MAX_NUM_BLOCKS]; 
+        if (lane->GetNumBlocks() == 0)
+        {
+            continue;
+        }
+
+        Alloc::IAllocator* allocator = mTimeline->GetAllocator();
+        IBlockProxy** blocks = PG_NEW_ARRAY(allocator, -1, "FindBlockByGuid blocks", Alloc::PG_MEM_TEMP, IBlockProxy*, lane->GetNumBlocks());
         unsigned numOfBlocks = lane->GetBlocks(blocks);
-        for (unsigned b = 0; b < numOfBlocks; ++b)
+        IBlockProxy* foundBlock = nullptr;
+        for (unsigned b = 0; (b < numOfBlocks) && (foundBlock == nullptr); ++b)
         {
-            IBlockProxy* blockProxy = blocks[b];
-            if (blockProxy->GetGuid() == blockGuid)
+            if (blocks[b]->GetGuid() == blockGuid)
             {
-                return blockProxy;
+                foundBlock = blocks[b];
             }
         }
+        PG_DELETE_ARRAY(allocator, blocks);
+
+        if (foundBlock != nullptr)
+        {
+            return foundBlock;
+        }
     }
     
     return nullptr;
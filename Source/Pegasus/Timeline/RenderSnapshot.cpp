@@ -0,0 +1,208 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file	RenderSnapshot.cpp
+//! \author	Kleber Garcia
+//! \date	October 18th 2026
+//! \brief	Versioned state of the timeline published by the update for the render,
+//!         double buffered so the next update never writes the snapshot being rendered
+
+#include "Pegasus/Timeline/RenderSnapshot.h"
+#include "Pegasus/Core/Assertion.h"
+#include "Pegasus/Core/Atomic.h"
+
+namespace Pegasus {
+namespace Timeline {
+
+//----------------------------------------------------------------------------------------
+
+RenderSnapshot::RenderSnapshot(Alloc::IAllocator * allocator)
+:   mVersion(0)
+,   mBeat(0.0f)
+,   mProperties(allocator)
+{
+    Reset(0.0f);
+}
+
+//----------------------------------------------------------------------------------------
+
+void RenderSnapshot::Reset(float beat)
+{
+    mBeat = beat;
+    for (unsigned int l = 0; l < MAX_NUM_LANES; ++l)
+    {
+        mLaneBlocks[l].mBlock = nullptr;
+        mLaneBlocks[l].mRelativeBeat = 0.0f;
+    }
+    mProperties.Clear();
+}
+
+//----------------------------------------------------------------------------------------
+
+void RenderSnapshot::SetLaneBlock(unsigned int lane, Block * block, float relativeBeat)
+{
+    PG_ASSERTSTR(lane < MAX_NUM_LANES, "Invalid lane index (%u) in a render snapshot", lane);
+    mLaneBlocks[lane].mBlock = block;
+    mLaneBlocks[lane].mRelativeBeat = relativeBeat;
+}
+
+//----------------------------------------------------------------------------------------
+
+Block * RenderSnapshot::GetLaneBlock(unsigned int lane, float & relativeBeat) const
+{
+    PG_ASSERTSTR(lane < MAX_NUM_LANES, "Invalid lane index (%u) in a render snapshot", lane);
+    relativeBeat = mLaneBlocks[lane].mRelativeBeat;
+    return mLaneBlocks[lane].mBlock;
+}
+
+//----------------------------------------------------------------------------------------
+
+RenderSnapshotBuffer::RenderSnapshotBuffer(Alloc::IAllocator * allocator)
+:   mSnapshot0(allocator)
+,   mSnapshot1(allocator)
+,   mState(0)
+,   mPublishedVersion(0)
+,   mAcquiredVersion(0)
+,   mWriteSlot(-1)
+,   mReadSlot(-1)
+{
+    mSnapshots[0] = &mSnapshot0;
+    mSnapshots[1] = &mSnapshot1;
+}
+
+//----------------------------------------------------------------------------------------
+
+RenderSnapshot * RenderSnapshotBuffer::BeginWrite()
+{
+    PG_ASSERTSTR(mWriteSlot == -1, "A render snapshot is already being written, Publish() has not been called");
+
+    // The slot that is not published, the render can only start reading it after the next publish
+    const long state = Core::AtomicLoad(&mState);
+    const int slot = ((state & STATE_HAS_PUBLISHED) != 0) ? 1 - static_cast<int>(state & STATE_PUBLISHED_SLOT) : 0;
+    const long readingFlag = (slot == 0) ? STATE_READING_SLOT0 : STATE_READING_SLOT1;
+
+    // The render is still reading the snapshot published two frames ago
+    Core::SpinBackoff backoff;
+    while ((Core::AtomicLoad(&mState) & readingFlag) != 0)
+    {
+        backoff.Wait();
+    }
+
+    mWriteSlot = slot;
+    RenderSnapshot * snapshot = mSnapshots[slot];
+    snapshot->mVersion = static_cast<unsigned int>(mPublishedVersion) + 1;
+    return snapshot;
+}
+
+//----------------------------------------------------------------------------------------
+
+void RenderSnapshotBuffer::Publish()
+{
+    PG_ASSERTSTR(mWriteSlot != -1, "No render snapshot to publish, BeginWrite() has not been called");
+
+    // Keep the reading flags, the render can still be reading the previous snapshot
+    long state = Core::AtomicLoad(&mState);
+    for (;;)
+    {
+        const long published = (state & (STATE_READING_SLOT0 | STATE_READING_SLOT1)) | STATE_HAS_PUBLISHED | static_cast<long>(mWriteSlot);
+        const long previous = Core::AtomicCompareExchange(&mState, published, state);
+        if (previous == state)
+        {
+            break;
+        }
+        state = previous;
+    }
+
+    Core::AtomicExchange(&mPublishedVersion, static_cast<long>(mSnapshots[mWriteSlot]->mVersion));
+    mWriteSlot = -1;
+}
+
+//----------------------------------------------------------------------------------------
+
+const RenderSnapshot * RenderSnapshotBuffer::AcquireRead()
+{
+    PG_ASSERTSTR(mReadSlot == -1, "A render snapshot is already acquired, ReleaseRead() has not been called");
+
+    long state = Core::AtomicLoad(&mState);
+    for (;;)
+    {
+        if ((state & STATE_HAS_PUBLISHED) == 0)
+        {
+            return nullptr;
+        }
+
+        // Flag the published slot as being read, fails if the update published in the meantime
+        const int slot = static_cast<int>(state & STATE_PUBLISHED_SLOT);
+        const long reading = state | ((slot == 0) ? STATE_READING_SLOT0 : STATE_READING_SLOT1);
+        const long previous = Core::AtomicCompareExchange(&mState, reading, state);
+        if (previous == state)
+        {
+            mReadSlot = slot;
+            break;
+        }
+        state = previous;
+    }
+
+    const RenderSnapshot * snapshot = mSnapshots[mReadSlot];
+    Core::AtomicExchange(&mAcquiredVersion, static_cast<long>(snapshot->mVersion));
+    return snapshot;
+}
+
+//----------------------------------------------------------------------------------------
+
+void RenderSnapshotBuffer::ReleaseRead()
+{
+    PG_ASSERTSTR(mReadSlot != -1, "No render snapshot to release, AcquireRead() has not been called");
+
+    const long readingFlag = (mReadSlot == 0) ? STATE_READING_SLOT0 : STATE_READING_SLOT1;
+    long state = Core::AtomicLoad(&mState);
+    for (;;)
+    {
+        const long previous = Core::AtomicCompareExchange(&mState, state & ~readingFlag, state);
+        if (previous == state)
+        {
+            break;
+        }
+        state = previous;
+    }
+    mReadSlot = -1;
+}
+
+//----------------------------------------------------------------------------------------
+
+void RenderSnapshotBuffer::Invalidate()
+{
+    PG_ASSERTSTR(mReadSlot == -1, "Invalidating the render snapshots while the render reads one of them");
+
+    long state = Core::AtomicLoad(&mState);
+    for (;;)
+    {
+        const long previous = Core::AtomicCompareExchange(&mState, state & ~STATE_HAS_PUBLISHED, state);
+        if (previous == state)
+        {
+            break;
+        }
+        state = previous;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int RenderSnapshotBuffer::GetPublishedVersion() const
+{
+    return static_cast<unsigned int>(Core::AtomicLoad(const_cast<volatile long *>(&mPublishedVersion)));
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int RenderSnapshotBuffer::GetAcquiredVersion() const
+{
+    return static_cast<unsigned int>(Core::AtomicLoad(const_cast<volatile long *>(&mAcquiredVersion)));
+}
+
+
+}   // namespace Timeline
+}   // namespace Pegasus
@@ -24,6 +24,8 @@
 #include "Pegasus/Window/Window.h"
 #include "Pegasus/Utils/Memset.h"
 #include "Pegasus/Sound/Sound.h"
+#include "Pegasus/Render/CommandBuffer.h"
+#include "Pegasus/Core/ParallelFor.h"
 
 namespace Pegasus {
 namespace Timeline {
@@ -31,6 +33,12 @@ namespace Timeline {
 
 const float Timeline::INVALID_BEAT = -1.0f;
 
+//! Reads the system time for the timings of the trace, without moving the Pegasus time of the frame
+static double GetTraceTime()
+{
+    return Core::ReadPegasusTime();
+}
+
 //----------------------------------------------------------------------------------------
 
 Timeline::Timeline(Alloc::IAllocator * allocator, Core::IApplicationContext* appContext)
@@ -48,9 +56,17 @@ Timeline::Timeline(Alloc::IAllocator * allocator, Core::IApplicationContext* app
 ,   mPlayMode(PLAYMODE_REALTIME)
 ,   mCurrentBeat(0.0)
 ,   mStartPegasusTime(0.0)
+,   mFixedStepFrameRate(60.0f)
+,   mFixedStep(mBeatsPerMinute / (60.0f * mFixedStepFrameRate))
+,   mFixedStepStartBeat(0.0f)
+,   mFixedStepFrame(0)
+,   mTrace(nullptr)
 ,   mSyncedToMusic(false)
 ,   mMusic(nullptr)
 ,   mGlobalCache(allocator)
+,   mRenderSnapshots(allocator)
+,   mLaneRenderInfo(nullptr)
+,   mConcurrentRender(false)
 ,   mScriptRunner(allocator, appContext, &mPropertyGrid
 #if PEGASUS_ASSETLIB_ENABLE_CATEGORIES
     ,   &mCategory
@@ -66,6 +82,8 @@ Timeline::Timeline(Alloc::IAllocator * allocator, Core::IApplicationContext* app
 
     mScriptRunner.SetGlobalCache(&mGlobalCache, true);
 
+    Utils::Memset8(mLaneCommandBuffers, 0, sizeof(mLaneCommandBuffers));
+
     // Create the initial default lane
     Clear();
 }
@@ -78,6 +96,14 @@ Timeline::~Timeline()
     {
         PG_DELETE(mAllocator, mLanes[lane]);
     }
+
+    for (unsigned int task = 0; task < MAX_NUM_LANES; ++task)
+    {
+        if (mLaneCommandBuffers[task] != nullptr)
+        {
+            PG_DELETE(mAllocator, mLaneCommandBuffers[task]);
+        }
+    }
 }
 
 //----------------------------------------------------------------------------------------
@@ -101,6 +127,9 @@ int Timeline::DeleteBlock(unsigned int blockGuid)
             //get target block
             Block* b = l->FindBlockByIndex(foundBlockIdx);
 
+            //the published render snapshot can refer to the block
+            mRenderSnapshots.Invalidate();
+
             //destroy all rendering resources
             b->Shutdown();
 
@@ -129,6 +158,9 @@ int Timeline::DeleteBlock(unsigned int blockGuid)
 
 void Timeline::InternalClear()
 {
+    // The published render snapshot refers to the blocks of the lanes
+    mRenderSnapshots.Invalidate();
+
     for (unsigned int lane = 0; lane < mNumLanes; ++lane)
     {
         PG_DELETE(mAllocator, mLanes[lane]);
@@ -197,6 +229,9 @@ void Timeline::SetBeatsPerMinute(float bpm)
 
     PG_LOG('TMLN', "Setting the tempo to %.2f BPM", mBeatsPerMinute);
 
+    // Keep the frame rate of the fixed step mode, the number of beats per update follows the tempo
+    UpdateFixedStep();
+
 #if PEGASUS_ENABLE_PROXIES
     // If the play mode is real-time, the Pegasus start time needs to be recomputed
     // to avoid the cursor jumping all over the place
@@ -293,6 +328,8 @@ void Timeline::ShutdownBlocks()
     
 void Timeline::Update()
 {
+    const double traceStartTime = (mTrace != nullptr) ? GetTraceTime() : 0.0;
+
     unsigned int musicPosition = 0;
     if (mMusic != nullptr)
     {
@@ -303,124 +340,384 @@ void Timeline::Update()
         mCurrentBeat = 0.0f;
         Core::UpdatePegasusTime();
         mStartPegasusTime = Core::GetPegasusTime();
+        mFixedStepStartBeat = 0.0f;
+        mFixedStepFrame = 0;
+
+        // In fixed step mode the first update evaluates beat 0 like any other frame,
+        // so offline runs always evaluate the same beats
+        if (mPlayMode != PLAYMODE_FIXED_STEP)
+        {
+            return;
+        }
     }
-    else
+
+    if (mPlayMode == PLAYMODE_REALTIME)
     {
-        if (mPlayMode == PLAYMODE_REALTIME)
+        if (mMusic != nullptr && !mMusic->IsPlayingMusic())
         {
-            if (mMusic != nullptr && !mMusic->IsPlayingMusic())
-            {
-                mMusic->Play();
-            }
-            // Update the internal clock for the next frame
-            Core::UpdatePegasusTime();
+            mMusic->Play();
+        }
+        // Update the internal clock for the next frame
+        Core::UpdatePegasusTime();
 
-            // Attempt to synchronize the timeline with the music
-            // (do not do it on the first frame to avoid potential invalid synchronization).
-            if (!mSyncedToMusic && (musicPosition > 0))
-            {
-                // Current time that we should have got from the timer for the current beat and the current tempo
-                double requiredCurrentTime = static_cast<double>(musicPosition) * 0.001;
+        // Attempt to synchronize the timeline with the music
+        // (do not do it on the first frame to avoid potential invalid synchronization).
+        if (!mSyncedToMusic && (musicPosition > 0))
+        {
+            // Current time that we should have got from the timer for the current beat and the current tempo
+            double requiredCurrentTime = static_cast<double>(musicPosition) * 0.001;
 
-                // Move the start Pegasus time to simulate a non-stop execution of the timeline until the current beat
-                mStartPegasusTime = static_cast<float>(Core::GetPegasusTime() - requiredCurrentTime);
+            // Move the start Pegasus time to simulate a non-stop execution of the timeline until the current beat
+            mStartPegasusTime = static_cast<float>(Core::GetPegasusTime() - requiredCurrentTime);
 
-                mSyncedToMusic = true;
-            }
+            mSyncedToMusic = true;
+        }
 
 #if PEGASUS_ENABLE_PROXIES
-            // If the start time needs to be recomputed (typically when the cursor position is changed,
-            // or when the play mode has just been set to real-time)
-            if (mRequiresStartTimeComputation)
-            {
-                // Current time that we should have got from the timer for the current beat and the current tempo
-                double requiredCurrentTime = static_cast<double>(mCurrentBeat / (mBeatsPerMinute * (1.0f / 60.0f)));
+        // If the start time needs to be recomputed (typically when the cursor position is changed,
+        // or when the play mode has just been set to real-time)
+        if (mRequiresStartTimeComputation)
+        {
+            // Current time that we should have got from the timer for the current beat and the current tempo
+            double requiredCurrentTime = static_cast<double>(mCurrentBeat / (mBeatsPerMinute * (1.0f / 60.0f)));
 
-                // Move the start Pegasus time to simulate a non-stop execution of the timeline until the current beat
-                mStartPegasusTime = static_cast<float>(Core::GetPegasusTime() - requiredCurrentTime);
+            // Move the start Pegasus time to simulate a non-stop execution of the timeline until the current beat
+            mStartPegasusTime = static_cast<float>(Core::GetPegasusTime() - requiredCurrentTime);
 
-                mRequiresStartTimeComputation = false;
-            }
+            mRequiresStartTimeComputation = false;
+        }
 #endif  // PEGASUS_ENABLE_PROXIES
 
-            // Update the current beat from the current time
-            const double currentTime = Core::GetPegasusTime() - mStartPegasusTime;
-            mCurrentBeat = static_cast<float>(currentTime * (mBeatsPerMinute * (1.0f / 60.0f)));
+        // Update the current beat from the current time
+        const double currentTime = Core::GetPegasusTime() - mStartPegasusTime;
+        mCurrentBeat = static_cast<float>(currentTime * (mBeatsPerMinute * (1.0f / 60.0f)));
 
 #if PEGASUS_ENABLE_PROXIES
-            // Fix precision issues when starting play mode in the editor
-            if (mCurrentBeat < 0.0f)
-            {
-                mCurrentBeat = 0.0f;
-            }
+        // Fix precision issues when starting play mode in the editor
+        if (mCurrentBeat < 0.0f)
+        {
+            mCurrentBeat = 0.0f;
+        }
 #endif  // PEGASUS_ENABLE_PROXIES
 
-        }
+    }
+    else if (mPlayMode == PLAYMODE_FIXED_STEP)
+    {
+        // Computed from the frame index rather than accumulated, so the beats are exact multiples of the step
+        mCurrentBeat = static_cast<float>(static_cast<double>(mFixedStepStartBeat) + static_cast<double>(mFixedStepFrame) * static_cast<double>(mFixedStep));
+        ++mFixedStepFrame;
+    }
 
-        UpdateInfo updateInfo(mCurrentBeat);
+    UpdateInfo updateInfo(mCurrentBeat);
 
-        updateInfo.relativeBeat = updateInfo.beat;
+    updateInfo.relativeBeat = updateInfo.beat;
 
-        mScriptRunner.CallUpdate(updateInfo);
-        // Update the content of each lane from top to bottom
-        for (unsigned int l = 0; l < mNumLanes; ++l)
+    mScriptRunner.CallUpdate(updateInfo);
+
+    // Find the current block of each lane and recompile the scripts that changed
+    int numTasks = 0;
+    for (unsigned int l = 0; l < mNumLanes; ++l)
+    {
+        Lane * lane = GetLane(l);
+        if (lane != nullptr)
         {
-            Lane * lane = GetLane(l);
-            if (lane != nullptr)
+            BlockUpdateTask & task = mBlockUpdateTasks[numTasks];
+            task.mBlock = lane->PrepareUpdate(updateInfo.beat, task.mRelativeBeat);
+            if (task.mBlock != nullptr)
             {
-                lane->Update(updateInfo);
+                task.mLane = l;
+                mBlockUpdateGroups[numTasks] = task.mBlock->GetUpdateGroup();
+                ++numTasks;
             }
         }
+    }
 
+    // Run the scripts of the blocks concurrently, following their dependency groups
+    mUpdateScheduler.Run(mBlockUpdateGroups, numTasks, &Timeline::RunBlockUpdateTask, this);
+
+    // Update the content of each lane from top to bottom, after sending the property changes of its script
+    for (int t = 0; t < numTasks; ++t)
+    {
+        updateInfo.relativeBeat = mBlockUpdateTasks[t].mRelativeBeat;
+        mBlockUpdateTasks[t].mBlock->FlushPropertyChanges();
+        mBlockUpdateTasks[t].mBlock->Update(updateInfo);
+    }
+
+    PublishRenderSnapshot(numTasks);
+
+    if (mTrace != nullptr)
+    {
+        mTrace->AddFrame(mCurrentBeat, GetTraceTime() - traceStartTime);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void Timeline::SetFixedStep(float beatStep)
+{
+    if (beatStep > 0.0f)
+    {
+        mFixedStepFrameRate = mBeatsPerMinute / (60.0f * beatStep);
+        UpdateFixedStep();
+    }
+    else
+    {
+        PG_FAILSTR("Invalid fixed step for the timeline (%f beats). It should be > 0.0f", beatStep);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void Timeline::SetFixedStepFrameRate(float framesPerSecond)
+{
+    if (framesPerSecond > 0.0f)
+    {
+        mFixedStepFrameRate = framesPerSecond;
+        UpdateFixedStep();
+    }
+    else
+    {
+        PG_FAILSTR("Invalid fixed step frame rate for the timeline (%f fps). It should be > 0.0f", framesPerSecond);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void Timeline::UpdateFixedStep()
+{
+    mFixedStep = mBeatsPerMinute / (60.0f * mFixedStepFrameRate);
+
+    // Restart the fixed step sequence from the current beat
+    mFixedStepStartBeat = (mCurrentBeat == INVALID_BEAT) ? 0.0f : mCurrentBeat;
+    mFixedStepFrame = 0;
+}
+
+//----------------------------------------------------------------------------------------
+
+void Timeline::RunUpdateOnly(unsigned int frameCount)
+{
+    if (mPlayMode == PLAYMODE_FIXED_STEP)
+    {
+        for (unsigned int f = 0; f < frameCount; ++f)
+        {
+            Update();
+        }
+    }
+    else
+    {
+        PG_FAILSTR("Offline updates of the timeline require the fixed step play mode");
     }
 }
 
 //----------------------------------------------------------------------------------------
 
+void Timeline::RunBlockUpdateTask(int task, void* userData)
+{
+    const Timeline * timeline = static_cast<const Timeline *>(userData);
+    const BlockUpdateTask & blockTask = timeline->mBlockUpdateTasks[task];
+
+    UpdateInfo updateInfo(timeline->mCurrentBeat);
+    updateInfo.relativeBeat = blockTask.mRelativeBeat;
+    blockTask.mBlock->UpdateConcurrent(updateInfo);
+}
+
+//----------------------------------------------------------------------------------------
+
+void Timeline::PublishRenderSnapshot(int numTasks)
+{
+    RenderSnapshot * snapshot = mRenderSnapshots.BeginWrite();
+    snapshot->Reset(mCurrentBeat);
+
+    PropertyGrid::PropertySnapshot & properties = snapshot->GetProperties();
+    mScriptRunner.CaptureRenderProperties(properties);
+    for (int t = 0; t < numTasks; ++t)
+    {
+        const BlockUpdateTask & task = mBlockUpdateTasks[t];
+        snapshot->SetLaneBlock(task.mLane, task.mBlock, task.mRelativeBeat);
+        task.mBlock->CaptureRenderProperties(properties);
+    }
+
+    mRenderSnapshots.Publish();
+}
+
+//----------------------------------------------------------------------------------------
+
 void Timeline::Render(int windowIndex, Wnd::Window* window)
 {
     if (window != nullptr)
     {
-        Render::BeginMarker("Timeline");
+        Render(windowIndex, window->GetWidth(), window->GetHeight());
+    }
+    else
+    {
+        PG_FAILSTR("Invalid window given to the timeline for rendering");
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void Timeline::Render(int windowIndex, unsigned int width, unsigned int height)
+{
+    const double traceStartTime = (mTrace != nullptr) ? GetTraceTime() : 0.0;
+
+    Render::BeginMarker("Timeline");
 #if PEGASUS_ENABLE_PROXIES
-        //lazy initialization in case we missed the initial call, because of live editing.
-        //In this context, live editing means the user creating a new timeline from scratch from the editor.
-        if (!mWindowIsInitialized[windowIndex])
-        {
-            OnWindowCreated(windowIndex);
-        }
+    //lazy initialization in case we missed the initial call, because of live editing.
+    //In this context, live editing means the user creating a new timeline from scratch from the editor.
+    if (!mWindowIsInitialized[windowIndex])
+    {
+        OnWindowCreated(windowIndex);
+    }
 #endif
-        RenderInfo renderInfo(
-           mCurrentBeat
-          ,windowIndex
-          ,static_cast<int>(window->GetWidth())
-          ,static_cast<int>(window->GetHeight())
-          ,static_cast<float>(window->GetWidth())
-          ,static_cast<float>(window->GetHeight())
-          ,window->GetRatio()
-          ,window->GetRatioInv()
-        );
-
-        Render::BeginMarker("MasterScript");
-        renderInfo.relativeBeat = renderInfo.beat;
-        // Render the content of each lane from top to bottom
-        mScriptRunner.CallRender(renderInfo);
-        Render::EndMarker();
-
-        //! \todo Add support for render passes
+    // State of the last update, the live state before the first one
+    const RenderSnapshot * snapshot = mRenderSnapshots.AcquireRead();
+
+    // Same ratios as the window of that size
+    const float ratio = (height > 0) ? static_cast<float>(width) / static_cast<float>(height) : 1.0f;
+    const float ratioInv = (width > 0) ? static_cast<float>(height) / static_cast<float>(width) : 1.0f;
+    RenderInfo renderInfo(
+       (snapshot != nullptr) ? snapshot->GetBeat() : mCurrentBeat
+      ,windowIndex
+      ,static_cast<int>(width)
+      ,static_cast<int>(height)
+      ,static_cast<float>(width)
+      ,static_cast<float>(height)
+      ,ratio
+      ,ratioInv
+    );
+    renderInfo.snapshot = snapshot;
+
+    Render::BeginMarker("MasterScript");
+    renderInfo.relativeBeat = renderInfo.beat;
+    // Render the content of each lane from top to bottom
+    mScriptRunner.CallRender(renderInfo);
+    Render::EndMarker();
+
+    //! \todo Add support for render passes
+    if (mConcurrentRender && snapshot != nullptr)
+    {
+        RenderLanesConcurrent(renderInfo, snapshot);
+    }
+    else
+    {
         for (unsigned int l = 0; l < mNumLanes; ++l)
         {
             Lane * lane = GetLane(l);
             if (lane != nullptr)
             {
-                lane->Render(renderInfo);
+                if (snapshot != nullptr)
+                {
+                    Block * block = snapshot->GetLaneBlock(l, renderInfo.relativeBeat);
+                    lane->RenderBlock(block, renderInfo);
+                }
+                else
+                {
+                    lane->Render(renderInfo);
+                }
             }
         }
-        Render::EndMarker();
     }
-    else
+    Render::EndMarker();
+
+    if (snapshot != nullptr)
     {
-        PG_FAILSTR("Invalid window given to the timeline for rendering");
+        mRenderSnapshots.ReleaseRead();
+    }
+
+    if (mTrace != nullptr)
+    {
+        mTrace->AddRender(GetTraceTime() - traceStartTime);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void Timeline::RenderLanesConcurrent(RenderInfo& renderInfo, const RenderSnapshot * snapshot)
+{
+    // Find the block of each lane, and run the lazy window initializations on this thread,
+    // they can create resources
+    int numTasks = 0;
+    for (unsigned int l = 0; l < mNumLanes; ++l)
+    {
+        Lane * lane = GetLane(l);
+        if (lane != nullptr)
+        {
+            LaneRenderTask & task = mLaneRenderTasks[numTasks];
+            task.mLane = lane;
+            task.mBlock = snapshot->GetLaneBlock(l, task.mRelativeBeat);
+            renderInfo.relativeBeat = task.mRelativeBeat;
+            lane->PrepareRenderBlock(task.mBlock, renderInfo);
+            if (task.mBlock != nullptr)
+            {
+                task.mRecorded = task.mBlock->CanRenderConcurrently();
+                if (task.mRecorded && mLaneCommandBuffers[numTasks] == nullptr)
+                {
+                    mLaneCommandBuffers[numTasks] = PG_NEW(mAllocator, -1, "Timeline lane command buffer", Alloc::PG_MEM_PERM) Render::CommandBuffer();
+                }
+                ++numTasks;
+            }
+        }
+    }
+
+    // Record the lanes concurrently, one command buffer per lane
+    mLaneRenderInfo = &renderInfo;
+    Core::ParallelFor(numTasks, 1, &Timeline::RunLaneRenderTasks, this);
+    mLaneRenderInfo = nullptr;
+
+    // The recorded scripts only queued the changes of the properties they wrote, send them from this thread
+    for (int t = 0; t < numTasks; ++t)
+    {
+        if (mLaneRenderTasks[t].mRecorded)
+        {
+            mLaneRenderTasks[t].mBlock->FlushPropertyChanges();
+        }
+    }
+
+    // Submit the command buffers in the order of the lanes, the blocks that cannot record render in between
+    Render::CommandBuffer * buffers[MAX_NUM_LANES];
+    unsigned int numBuffers = 0;
+    for (int t = 0; t < numTasks; ++t)
+    {
+        const LaneRenderTask & task = mLaneRenderTasks[t];
+        if (task.mRecorded)
+        {
+            buffers[numBuffers++] = mLaneCommandBuffers[t];
+        }
+        else
+        {
+            Render::CommandBuffer::Submit(buffers, numBuffers);
+            numBuffers = 0;
+            renderInfo.relativeBeat = task.mRelativeBeat;
+            task.mLane->RenderBlock(task.mBlock, renderInfo);
+        }
+    }
+    Render::CommandBuffer::Submit(buffers, numBuffers);
+
+    // Release the resources the recordings retained on this thread, releasing the last reference destroys the resource
+    for (int t = 0; t < numTasks; ++t)
+    {
+        if (mLaneRenderTasks[t].mRecorded)
+        {
+            mLaneCommandBuffers[t]->Reset();
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void Timeline::RunLaneRenderTasks(int begin, int end, void* userData)
+{
+    const Timeline * timeline = static_cast<const Timeline *>(userData);
+    for (int t = begin; t < end; ++t)
+    {
+        const LaneRenderTask & task = timeline->mLaneRenderTasks[t];
+        if (task.mRecorded)
+        {
+            RenderInfo renderInfo(*timeline->mLaneRenderInfo);
+            renderInfo.relativeBeat = task.mRelativeBeat;
+            renderInfo.commandBuffer = timeline->mLaneCommandBuffers[t];
+            task.mLane->RenderBlock(task.mBlock, renderInfo);
+        }
     }
 }
 
@@ -452,6 +749,16 @@ void Timeline::SetPlayMode(PlayMode playMode)
                 }
                 break;
 
+            case PLAYMODE_FIXED_STEP:
+                PG_LOG('TMLN', "Switched to fixed step mode for the timeline (%f beats per update)", mFixedStep);
+                if (mMusic != nullptr)
+                {
+                    mMusic->Pause();
+                }
+                mFixedStepStartBeat = (mCurrentBeat == INVALID_BEAT) ? 0.0f : mCurrentBeat;
+                mFixedStepFrame = 0;
+                break;
+
             default:
                 PG_LOG('TMLN', "Switched to an unknown mode for the timeline");
         }
@@ -473,7 +780,11 @@ void Timeline::SetCurrentBeat(float beat)
 
     PG_LOG('TMLN', "Set the current beat of the timeline to %f", mCurrentBeat);
 
-    if (mMusic != nullptr)
+    // The fixed step sequence restarts from the new beat
+    mFixedStepStartBeat = beat;
+    mFixedStepFrame = 0;
+
+    if (mMusic != nullptr && mPlayMode != PLAYMODE_FIXED_STEP)
     {
         float musicPosition = beat /(mBeatsPerMinute * 1.0f/60.0f);
         //compute new time
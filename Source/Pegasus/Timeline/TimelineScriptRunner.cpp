@@ -66,6 +66,7 @@ namespace Timeline
 #endif
     , mVmState(nullptr)
     , mGlobalCache(nullptr)
+    , mHasRenderedOnMainThread(false)
     , mControlGlobalCacheReset(false)
 #if PEGASUS_ASSETLIB_ENABLE_CATEGORIES
     , mCategory(category)
@@ -166,6 +167,7 @@ namespace Timeline
         if (HasScript() && mScriptVersion != mTimelineScript->GetSerialVersion() && mTimelineScript->IsScriptActive())
         {
             mScriptVersion = mTimelineScript->GetSerialVersion();
+            mHasRenderedOnMainThread = false;
 
             if (mVmState->GetUserContext() != nullptr)
             {
@@ -188,6 +190,7 @@ namespace Timeline
             static_cast<Application::RenderCollection*>(mVmState->GetUserContext())->SetPermissions(GetGlobalScopePermissions(mControlGlobalCacheReset));
 #endif
             mTimelineScript->CallGlobalScopeInit(mVmState); 
+            FlushPropertyChanges();
 
 #if PEGASUS_ASSETLIB_ENABLE_CATEGORIES
             if (useCategories) mAppContext->GetAssetLib()->EndCategory();
@@ -238,19 +241,61 @@ namespace Timeline
     }
 
     void TimelineScriptRunner::CallUpdate(const UpdateInfo& updateInfo)
+    {
+        PrepareUpdate();
+        CallUpdateScript(updateInfo);
+        FlushPropertyChanges();
+        UpdateNodes();
+    }
+
+    void TimelineScriptRunner::PrepareUpdate()
     {
         if (mTimelineScript != nullptr)
         {
             InitializeScript(); //in case a dirty compilation has been carried on.
-            Application::RenderCollection* nodeContainer = static_cast<Application::RenderCollection*>(mVmState->GetUserContext());
 #if PEGASUS_ENABLE_SCRIPT_PERMISSIONS
+            Application::RenderCollection* nodeContainer = static_cast<Application::RenderCollection*>(mVmState->GetUserContext());
             nodeContainer->SetPermissions(Application::PERMISSIONS_DEFAULT);
 #endif
+        }
+    }
+
+    void TimelineScriptRunner::CallUpdateScript(const UpdateInfo& updateInfo)
+    {
+        if (mTimelineScript != nullptr)
+        {
             mTimelineScript->CallUpdate(updateInfo, mVmState);
+        }
+    }
+
+    void TimelineScriptRunner::FlushPropertyChanges()
+    {
+        if (mTimelineScript != nullptr)
+        {
+            Application::RenderCollection* nodeContainer = static_cast<Application::RenderCollection*>(mVmState->GetUserContext());
+            nodeContainer->FlushPropertyChanges();
+        }
+    }
+
+    void TimelineScriptRunner::UpdateNodes()
+    {
+        if (mTimelineScript != nullptr)
+        {
+            Application::RenderCollection* nodeContainer = static_cast<Application::RenderCollection*>(mVmState->GetUserContext());
             nodeContainer->UpdateAll();
         }
     }
 
+    void TimelineScriptRunner::CaptureRenderProperties(PropertyGrid::PropertySnapshot& snapshot)
+    {
+        snapshot.Capture(mPropertyGrid);
+        if (mTimelineScript != nullptr)
+        {
+            Application::RenderCollection* nodeContainer = static_cast<Application::RenderCollection*>(mVmState->GetUserContext());
+            nodeContainer->CaptureProperties(snapshot);
+        }
+    }
+
     void TimelineScriptRunner::CallRender(const RenderInfo& renderInfo)
     {
         if (mTimelineScript != nullptr)
@@ -267,11 +312,40 @@ namespace Timeline
             nodeContainer->SetPermissions(Application::PERMISSIONS_RENDER_API_CALL);
 #endif
             nodeContainer->SetRenderInfo(&renderInfo);
+            nodeContainer->SetPropertySnapshot((renderInfo.snapshot != nullptr) ? &renderInfo.snapshot->GetProperties() : nullptr);
             mTimelineScript->CallRender(renderInfo, mVmState);
+            nodeContainer->SetPropertySnapshot(nullptr);
             nodeContainer->SetRenderInfo(nullptr);
+            if (renderInfo.commandBuffer == nullptr)
+            {
+                //on a worker thread, the timeline flushes the changes after the render of all the lanes
+                nodeContainer->FlushPropertyChanges();
+                mHasRenderedOnMainThread = true;
+            }
         }
     }
 
+    void TimelineScriptRunner::PrepareRender(int windowIndex)
+    {
+#if PEGASUS_ENABLE_PROXIES
+        if (mTimelineScript != nullptr && !mWindowIsInitialized[windowIndex])
+        {
+            CallWindowCreated(windowIndex);
+            FlushPropertyChanges();
+        }
+#endif
+    }
+
+    bool TimelineScriptRunner::CanRenderConcurrently() const
+    {
+        if (mTimelineScript != nullptr)
+        {
+            const Application::RenderCollection* nodeContainer = static_cast<const Application::RenderCollection*>(mVmState->GetUserContext());
+            return mHasRenderedOnMainThread && !nodeContainer->RenderResolvesResources();
+        }
+        return true;
+    }
+
     void TimelineScriptRunner::CallWindowCreated(int windowIndex)
     {
 #if PEGASUS_ENABLE_PROXIES
@@ -301,9 +375,15 @@ namespace Timeline
             nodeContainer->SetPermissions(GetWindowCreationPermissions(mControlGlobalCacheReset));
 #endif
             mTimelineScript->CallWindowDestroyed(windowIndex, mVmState);
+            FlushPropertyChanges();
         }
     }
 
+    Application::RenderCollection* TimelineScriptRunner::GetRenderCollection()
+    {
+        return static_cast<Application::RenderCollection*>(mVmState->GetUserContext());
+    }
+
     void TimelineScriptRunner::OnGlobalCacheDirty()
     {
         mScriptVersion = -1; // invalidate the script version, will force rerun of globals 
@@ -0,0 +1,110 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file	TimelineTrace.cpp
+//! \author	Kleber Garcia
+//! \date	October 18th 2026
+//! \brief	Per frame timings of the timeline update and render phases
+
+#include "Pegasus/Timeline/TimelineTrace.h"
+#include "Pegasus/Utils/ByteStream.h"
+#include "Pegasus/Utils/String.h"
+#include <stdio.h>
+
+namespace Pegasus {
+namespace Timeline {
+
+
+TimelineTrace::TimelineTrace(Alloc::IAllocator * allocator)
+:   mAllocator(allocator)
+,   mFrames(allocator)
+{
+    PG_ASSERTSTR(allocator != nullptr, "Invalid allocator given to a timeline trace");
+}
+
+//----------------------------------------------------------------------------------------
+
+TimelineTrace::~TimelineTrace()
+{
+}
+
+//----------------------------------------------------------------------------------------
+
+void TimelineTrace::Clear()
+{
+    mFrames.Clear();
+}
+
+//----------------------------------------------------------------------------------------
+
+void TimelineTrace::AddFrame(float beat, double updateSeconds)
+{
+    Frame & frame = mFrames.PushEmpty();
+    frame.mBeat = beat;
+    frame.mUpdateSeconds = updateSeconds;
+    frame.mRenderSeconds = 0.0;
+}
+
+//----------------------------------------------------------------------------------------
+
+void TimelineTrace::AddRender(double renderSeconds)
+{
+    // Renders happening before the first update are not part of a frame
+    if (mFrames.GetSize() > 0)
+    {
+        mFrames[mFrames.GetSize() - 1].mRenderSeconds += renderSeconds;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+double TimelineTrace::GetFramesPerSecond() const
+{
+    double totalSeconds = 0.0;
+    for (unsigned int f = 0; f < mFrames.GetSize(); ++f)
+    {
+        totalSeconds += mFrames[f].mUpdateSeconds + mFrames[f].mRenderSeconds;
+    }
+    return totalSeconds > 0.0 ? static_cast<double>(mFrames.GetSize()) / totalSeconds : 0.0;
+}
+
+//----------------------------------------------------------------------------------------
+
+Io::IoError TimelineTrace::SaveCsv(Io::IOManager * ioManager, const char * relativePath) const
+{
+    PG_ASSERTSTR(ioManager != nullptr, "Invalid IO manager given to save a timeline trace");
+
+    Utils::ByteStream stream(mAllocator);
+    const char header[] = "frame,beat,update_ms,render_ms\n";
+    stream.Append(header, sizeof(header) - 1);
+
+    char line[128];
+    for (unsigned int f = 0; f < mFrames.GetSize(); ++f)
+    {
+        const Frame & frame = mFrames[f];
+        const int length = sprintf_s(line, sizeof(line), "%u,%.6f,%.6f,%.6f\n",
+                                     f, frame.mBeat, frame.mUpdateSeconds * 1000.0, frame.mRenderSeconds * 1000.0);
+        if (length > 0)
+        {
+            stream.Append(line, length);
+        }
+    }
+
+    Io::FileBuffer fileBuffer;
+    fileBuffer.OwnBuffer(mAllocator, static_cast<char*>(stream.GetBuffer()), stream.GetSize());
+    const Io::IoError result = ioManager->SaveFileToBuffer(relativePath, fileBuffer);
+    fileBuffer.ForgetBuffer();
+
+    if (result != Io::ERR_NONE)
+    {
+        PG_LOG('ERR_', "Could not save the timeline trace to %s", relativePath);
+    }
+    return result;
+}
+
+
+}   // namespace Timeline
+}   // namespace Pegasus
@@ -0,0 +1,111 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file	UpdateScheduler.cpp
+//! \author	Kleber Garcia
+//! \date	October 18th 2026
+//! \brief	Runs the update tasks of the timeline lanes concurrently, following their dependency groups
+
+#include "Pegasus/Timeline/UpdateScheduler.h"
+#include "Pegasus/Core/ParallelFor.h"
+
+namespace Pegasus {
+namespace Timeline {
+
+
+UpdateScheduler::UpdateScheduler()
+:   mJobCount(0)
+,   mCallback(nullptr)
+,   mUserData(nullptr)
+{
+    mJobOffsets[0] = 0;
+}
+
+//----------------------------------------------------------------------------------------
+
+void UpdateScheduler::Run(const int * taskGroups, int taskCount, UpdateTaskCallback callback, void* userData)
+{
+    PG_ASSERTSTR(taskCount >= 0 && taskCount <= MAX_TASKS, "Invalid number of update tasks (%d)", taskCount);
+    PG_ASSERTSTR(callback != nullptr, "Invalid update task callback");
+
+    BuildJobs(taskGroups, taskCount);
+    mCallback = callback;
+    mUserData = userData;
+
+    // One job per chunk, jobs are few and each one is a full block update
+    Core::ParallelFor(mJobCount, 1, &UpdateScheduler::RunJobs, this);
+
+    mCallback = nullptr;
+    mUserData = nullptr;
+}
+
+//----------------------------------------------------------------------------------------
+
+void UpdateScheduler::BuildJobs(const int * taskGroups, int taskCount)
+{
+    // Group of each job, INDEPENDENT_GROUP for single task jobs
+    int jobGroups[MAX_TASKS];
+    int jobSizes[MAX_TASKS];
+    int taskJobs[MAX_TASKS];
+
+    // Jobs get created in the order of their first task, so a run on a single thread
+    // keeps the order of the lanes for the independent tasks
+    mJobCount = 0;
+    for (int t = 0; t < taskCount; ++t)
+    {
+        int job = mJobCount;
+        if (taskGroups[t] != INDEPENDENT_GROUP)
+        {
+            for (int j = 0; j < mJobCount; ++j)
+            {
+                if (jobGroups[j] == taskGroups[t])
+                {
+                    job = j;
+                    break;
+                }
+            }
+        }
+
+        if (job == mJobCount)
+        {
+            jobGroups[mJobCount] = taskGroups[t];
+            jobSizes[mJobCount] = 0;
+            ++mJobCount;
+        }
+        ++jobSizes[job];
+        taskJobs[t] = job;
+    }
+
+    // Prefix sum of the job sizes, then place the tasks in increasing order within each job
+    mJobOffsets[0] = 0;
+    for (int j = 0; j < mJobCount; ++j)
+    {
+        mJobOffsets[j + 1] = mJobOffsets[j] + jobSizes[j];
+        jobSizes[j] = mJobOffsets[j];
+    }
+    for (int t = 0; t < taskCount; ++t)
+    {
+        mJobTasks[jobSizes[taskJobs[t]]++] = t;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void UpdateScheduler::RunJobs(int begin, int end, void* userData)
+{
+    const UpdateScheduler * scheduler = static_cast<const UpdateScheduler *>(userData);
+    for (int j = begin; j < end; ++j)
+    {
+        for (int t = scheduler->mJobOffsets[j]; t < scheduler->mJobOffsets[j + 1]; ++t)
+        {
+            scheduler->mCallback(scheduler->mJobTasks[t], scheduler->mUserData);
+        }
+    }
+}
+
+
+}   // namespace Timeline
+}   // namespace Pegasus
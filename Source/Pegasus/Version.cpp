@@ -37,6 +37,9 @@ void Internal_GetEngineDesc(Pegasus::PegasusDesc& engineDesc)
 #elif PEGASUS_GAPI_DX
     engineDesc.mGapiType = Pegasus::PegasusDesc::DIRECT_3D;
     engineDesc.mGapiVersion = 11; 
+#elif PEGASUS_GAPI_NULL
+    engineDesc.mGapiType = Pegasus::PegasusDesc::NULL_GAPI;
+    engineDesc.mGapiVersion = 0;
 #elif PEGASUS_GAPI_GLES
     #error Unsupported Pegasus GAPI GLES
 #else
@@ -49,6 +49,9 @@ public:
 
     virtual void Update(const Pegasus::Timeline::UpdateInfo& updateInfo) override;
     virtual void Render(const Pegasus::Timeline::RenderInfo& renderInfo) override;
+
+    //! Renders with direct calls to the render API, on the main thread
+    virtual bool CanRenderConcurrently() const override { return false; }
     
 private:
     
@@ -49,6 +49,9 @@ namespace Mesh {
 namespace Timeline {
     struct RenderInfo;
 }
+namespace PropertyGrid {
+    class PropertySnapshot;
+}
 
 namespace Application {    
     class RenderCollectionImpl;
@@ -247,6 +250,28 @@ namespace Application
         //! Cleans / Deletes all references to the shaders/nodes/meshes/rendertargets/blendingstates/rasterstates being used
         void Clean();
 
+        //! Sends the change events of the properties written by the scripts since the last flush.
+        //! The written nodes are batched (see PropertyGridObject::BeginPropertyBatch()),
+        //! so a property written several times sends one event. Main thread only.
+        void FlushPropertyChanges();
+
+        //! Reads a property of a node for a script. During a render with a property snapshot, reads the value
+        //! written by the render scripts of this collection, or else the snapshot value. Otherwise reads the live
+        //! property, locking the node against the writes of the other threads
+        //! \param accessor accessor of the property
+        //! \param destBuffer receives the value
+        //! \param size size of the value in bytes
+        void ReadScriptProperty(const PropertyGrid::PropertyAccessor& accessor, void* destBuffer, unsigned int size);
+
+        //! Writes a property of a node for a script, locking the node against the accesses of the other threads.
+        //! The scripts of this collection can run on a worker thread, so the change is only queued,
+        //! the property grid is invalidated and the change notified by FlushPropertyChanges().
+        //! During a render with a property snapshot, the value is also kept for the next reads of this render
+        //! \param accessor accessor of the property
+        //! \param srcBuffer new value
+        //! \param size size of the value in bytes
+        void WriteScriptProperty(const PropertyGrid::PropertyAccessor& accessor, const void* srcBuffer, unsigned int size);
+
         //! Set render info of the current draw call
         //! \param Window the window
         void SetRenderInfo(const Timeline::RenderInfo* renderInfo) { mCurrentRenderInfo = renderInfo; }
@@ -255,6 +280,28 @@ namespace Application
         //! \return the current window
         const Timeline::RenderInfo* GetRenderInfo() const { return mCurrentRenderInfo; }
 
+        //! Tags the render of the scripts as creating resources or nodes, or resolving uniforms.
+        //! Those calls use the device and the node managers, so the render has to stay on the main thread
+        void SignalRenderResolvesResources() { mRenderResolvesResources = true; }
+
+        //! Test if the render of the scripts created resources or nodes, or resolved uniforms, since the last Clean()
+        //! \return true if the render has to run on the main thread
+        bool RenderResolvesResources() const { return mRenderResolvesResources; }
+
+        //! Set the property values the scripts read instead of the live node properties, during a render.
+        //! Properties written by the render scripts go to the live nodes, and are read back by the same render
+        //! (the shared snapshot is not written, the other lanes keep reading the values of the update)
+        //! \param snapshot the snapshot published by the update being rendered, nullptr to read the live properties
+        void SetPropertySnapshot(const PropertyGrid::PropertySnapshot* snapshot);
+
+        //! Gets the property values the scripts read instead of the live node properties
+        //! \return the current snapshot, nullptr when reading the live properties
+        const PropertyGrid::PropertySnapshot* GetPropertySnapshot() const { return mPropertySnapshot; }
+
+        //! Captures the values of the properties of every node of the collection
+        //! \param snapshot the snapshot receiving the values
+        void CaptureProperties(PropertyGrid::PropertySnapshot& snapshot);
+
         //! Gets the factory
         RenderCollectionFactory* GetFactory() { return mFactory; }
 
@@ -310,6 +357,12 @@ namespace Application
         //! The current window
         const Timeline::RenderInfo* mCurrentRenderInfo;
 
+        //! Property values read by the scripts during a render, nullptr to read the live properties
+        const PropertyGrid::PropertySnapshot* mPropertySnapshot;
+
+        //! Properties written by the render scripts since the last SetPropertySnapshot(), read before the snapshot
+        PropertyGrid::PropertySnapshot* mRenderWrites;
+
         //! Reference to the global cache
         Application::GlobalCache* mGlobalCache;
 
@@ -324,6 +377,13 @@ namespace Application
         //! boolean that tags if this render collection is sensitive to cache changes or is pointing to a resource that 
         //! has been resolved in the global cache
         bool mIsUsingGlobalCache;
+
+        //! true when the render of the scripts created resources or nodes, or resolved uniforms
+        bool mRenderResolvesResources;
+
+        //! properties changed by the scripts since the last FlushPropertyChanges(), only written by the thread
+        //! running the scripts of this collection (one per lane)
+        Utils::Vector<PropertyGrid::PropertyAccessor> mPendingPropertyChanges;
         
     };
 }
@@ -67,6 +67,13 @@ public:
         FMT_RAW,
         FMT_STRUCTURED
     };
+
+    //! Encoding of a structured asset in its file
+    enum Encoding
+    {
+        ENCODING_TEXT,  //!< Asset script grammar, parsed on load
+        ENCODING_BINARY //!< Binary layout of BinaryAsset.h, used in place on load
+    };
     
     //! Constructor for structured asset
     //! \param obj the root object used for this asset.
@@ -106,9 +113,19 @@ public:
     //! \return the full path of this asset
     const char* GetPath() const { return mPathString; }
 
-    //! dumps this asset (writes it) to a byte stream
+    //! dumps this asset (writes it) to a byte stream, in the encoding of the asset
     void DumpToStream(Utils::ByteStream& bs);
 
+    //! dumps this asset (writes it) to a byte stream
+    //! \param encoding text or binary encoding of the stream
+    void DumpToStream(Utils::ByteStream& bs, Encoding encoding);
+
+    //! Sets the encoding used when saving this asset. Loading sets the encoding of the file.
+    void SetEncoding(Encoding encoding) { mEncoding = encoding; }
+
+    //! Gets the encoding used when saving this asset
+    Encoding GetEncoding() const { return mEncoding; }
+
     //! Gets the format of this asset
     AssetFormat GetFormat() const { return mFormat; }
 
@@ -165,6 +182,9 @@ private:
     //! \param desc the type desc
     void SetTypeDesc(const PegasusAssetTypeDesc* desc) { mTypeDesc = desc; }
 
+    //! Takes the file buffer of a binary asset, the strings of the tree point into it
+    void SetBinaryBuffer(const Io::FileBuffer& fb);
+
     Alloc::IAllocator* mAllocator;
     RuntimeAssetObject*    mRuntimeData;
     Memory::BlockAllocator mAstAllocator;
@@ -175,6 +195,8 @@ private:
 
     Object* mRoot;
     Io::FileBuffer mRawAsset;
+    Io::FileBuffer mBinaryBuffer;
+    Encoding mEncoding;
     char mPathString[MAX_ASSET_PATH_STRING];
     AssetFormat mFormat;
 
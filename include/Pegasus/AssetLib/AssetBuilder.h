@@ -44,6 +44,7 @@ class AssetBuilder
 {
 public:
     friend class AssetLib;
+    friend class LoadGraph;
 
     //! Constructor 
     //! \param allcator to use
@@ -107,6 +108,12 @@ public:
     //! Enqueues the child asset of a particular asset path
     void EnqueueAssetArrayElement(const char* assetPath);
 
+    //! Enqueues the child asset of an object that is not on the object stack (binary assets)
+    void EnqueueChildAsset(Object* object, const char* name, const char* newAssetPath);
+
+    //! Enqueues an asset path element of an array that is not on the array stack (binary assets)
+    void EnqueueAssetArrayElement(Array* array, const char* assetPath);
+
 private:
     Alloc::IAllocator* mAllocator;
     Utils::Vector<Array*>  mArrStack;
@@ -14,6 +14,8 @@
 
 #include "Pegasus/AssetLib/RuntimeAssetObject.h"
 #include "Pegasus/AssetLib/AssetBuilder.h"
+#include "Pegasus/AssetLib/AssetPathIndex.h"
+#include "Pegasus/AssetLib/LoadGraph.h"
 #include "Pegasus/Utils/Vector.h"
 #include "Pegasus/Core/Io.h"
 #include "Pegasus/PegasusAssetTypes.h"
@@ -45,6 +47,8 @@ class Category;
 //! Asset Library class
 class AssetLib
 {
+    friend class LoadGraph;
+
 public:
 
     PEGASUS_EVENT_DECLARE_DISPATCHER(IAssetEventListener)
@@ -136,6 +140,29 @@ public:
     //! Sets an alternative IO Manager to handle IO
     void SetIoManager(Io::IOManager* ioMgr) { mIoMgr = ioMgr; }
 
+    //---- Parallel loading -----------------------------------------------------------------------//
+
+    //! Reads and parses assets and all the assets they reference in parallel, ahead of LoadObject / LoadAsset.
+    //! The preloaded assets wait until LoadAsset asks for them, runtime objects are still created by LoadObject
+    //! on the calling thread. LoadObject preloads the graph of its asset by itself when parallel loading is enabled.
+    //! \param paths the paths of the root assets
+    //! \param pathCount the number of root assets
+    void PreloadAssets(const char* const* paths, int pathCount);
+
+    //! Destroys the preloaded assets that no LoadAsset asked for
+    void ReleasePreloadedAssets();
+
+    //! Gets the timings of the last preload, critical path and speedup over a serial load
+    //! \return the stats of the last preload
+    const LoadGraphStats& GetPreloadStats() const { return mLoadGraph.GetStats(); }
+
+    //! Enables or disables the preload done by LoadObject. Enabled by default.
+    //! \param enable true to read and parse the asset graph of LoadObject in parallel, false to load it serially
+    void SetParallelLoading(bool enable) { mParallelLoading = enable; }
+
+    //! \return true if LoadObject preloads the asset graph in parallel
+    bool IsParallelLoading() const { return mParallelLoading; }
+
 #if PEGASUS_ENABLE_PROXIES
     IAssetLibProxy* GetProxy() { return &mProxy; }
 
@@ -175,9 +202,16 @@ public:
 private:
     Pegasus::AssetLib::AssetRuntimeFactory* FindFactory(Asset* asset, const char* ext, const PegasusAssetTypeDesc** outDesc) const;
     Io::IoError InternalBuildAsset(Asset** memory, bool isStructured, const char* path);   
+    RuntimeAssetObjectRef InternalLoadObject(const char* path);
+
+    // parses a structured asset from its file, text or binary. Safe to call from worker threads
+    void BuildStructuredAsset(Asset* asset, Io::FileBuffer& fileBuffer, AssetBuilder* builder) const;
+
+    // finds the extension of a path, and if the asset type using it is structured
+    static bool GetPathFormat(const char* path, const char** outExtension, bool* outIsStructured);
 
-    // resolves any pending child assets
-    void ResolvePendingChildAssets(Asset* asset);
+    // resolves any pending child assets requested by the builder of the asset
+    void ResolvePendingChildAssets(Asset* asset, const AssetBuilder& builder);
 
 #if PEGASUS_ENABLE_PROXIES
     AssetLibProxy mProxy;
@@ -186,7 +220,11 @@ private:
     AssetBuilder   mBuilder;
     Io::IOManager* mIoMgr;
     Utils::Vector<Asset*> mAssets;
+    AssetPathIndex mAssetIndex; //!< Assets by path, the user data of an asset is its position in mAssets
     Utils::Vector<AssetRuntimeFactory*> mFactories;
+    LoadGraph mLoadGraph;
+    int mLoadObjectDepth;
+    bool mParallelLoading;
 
 #if PEGASUS_ASSETLIB_ENABLE_CATEGORIES
     Category* mCurrentCategory;
@@ -0,0 +1,117 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   AssetPathIndex.h
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Hash index of assets by normalized path (case and kind of slashes ignored)
+
+#ifndef PEGASUS_ASSETLIB_ASSETPATHINDEX_H
+#define PEGASUS_ASSETLIB_ASSETPATHINDEX_H
+
+//fwd declarations
+namespace Pegasus
+{
+    namespace Alloc {
+        class IAllocator;
+    }
+}
+
+namespace Pegasus
+{
+namespace AssetLib
+{
+
+class Asset;
+
+//! Open addressing hash table of assets, keyed by their path.
+//! Paths are compared with the case and the kind of slashes ignored, so "Textures/A.png"
+//! and "textures\a.png" find the same asset. The path of an asset must not change while
+//! the asset is in the index.
+class AssetPathIndex
+{
+public:
+    //! Constructor, uses the global allocator
+    AssetPathIndex();
+
+    //! Constructor
+    //! \param allocator allocator of the table
+    explicit AssetPathIndex(Alloc::IAllocator* allocator);
+
+    //! Destructor
+    ~AssetPathIndex();
+
+    //! Adds an asset, keyed by its current path
+    //! \param asset the asset to add
+    //! \param userData value returned by Find along with the asset
+    void Insert(Asset* asset, int userData = 0);
+
+    //! Finds the asset of a path
+    //! \param path the path to look for
+    //! \param outUserData optional, receives the user data the asset was added with
+    //! \return the asset, or nullptr if no asset of the index has this path
+    Asset* Find(const char* path, int* outUserData = nullptr) const;
+
+    //! Looks for an asset itself, when several assets can share a path
+    //! \param asset the asset to look for
+    //! \param outUserData optional, receives the user data the asset was added with
+    //! \return true if the asset is in the index
+    bool Contains(const Asset* asset, int* outUserData = nullptr) const;
+
+    //! Changes the user data of an asset
+    //! \param asset the asset, in the index
+    //! \param userData the new user data
+    void SetUserData(Asset* asset, int userData);
+
+    //! Removes an asset
+    //! \param asset the asset to remove
+    //! \return true if the asset was in the index
+    bool Remove(Asset* asset);
+
+    //! Removes every asset, keeps the table memory
+    void Clear();
+
+    //! \return the number of assets in the index
+    unsigned int GetSize() const { return mCount; }
+
+    //! Hashes a path the way PathsAreEqual compares it
+    static unsigned int HashPath(const char* path);
+
+    //! Compares two asset paths, ignoring the case and the kind of slashes
+    static bool PathsAreEqual(const char* str1, const char* str2);
+
+private:
+    // No copies allowed
+    PG_DISABLE_COPY(AssetPathIndex);
+
+    //! Slot of the table. Removed slots are kept as tombstones until the next rehash,
+    //! so the probe sequences of the other assets stay intact
+    struct Slot
+    {
+        Asset* mAsset;          //!< Asset of the slot, nullptr if empty or removed
+        unsigned int mHash;     //!< Hash of the path of the asset
+        int mUserData;          //!< User data of the asset
+        bool mIsRemoved;        //!< True for a tombstone
+    };
+
+    //! \return the slot of an asset, nullptr if the asset is not in the index
+    Slot* FindSlot(const Asset* asset) const;
+
+    //! Reallocates the table, dropping the tombstones
+    //! \param capacity new number of slots, power of 2
+    void Rehash(unsigned int capacity);
+
+    Alloc::IAllocator* mAllocator;
+    Slot* mSlots;
+    unsigned int mCapacity;     //!< Number of slots, power of 2
+    unsigned int mCount;        //!< Number of assets
+    unsigned int mRemovedCount; //!< Number of tombstones
+};
+
+}
+}
+
+#endif  // PEGASUS_ASSETLIB_ASSETPATHINDEX_H
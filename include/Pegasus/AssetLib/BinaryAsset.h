@@ -0,0 +1,106 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   BinaryAsset.h
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Binary encoding of structured assets, same Object / Array tree as the text grammar
+
+#ifndef PEGASUS_ASSETLIB_BINARYASSET_H
+#define PEGASUS_ASSETLIB_BINARYASSET_H
+
+namespace Pegasus
+{
+    namespace Alloc {
+        class IAllocator;
+    }
+
+    namespace Utils {
+        class ByteStream;
+    }
+}
+
+namespace Pegasus
+{
+namespace AssetLib
+{
+
+class Object;
+class AssetBuilder;
+
+//! Layout of a binary asset. Every field is a 32 bit little endian unsigned int, and every
+//! record is 4 byte aligned, so the buffer is used in place without any parsing:
+//!
+//!   header         BinaryAssetHeader
+//!   records        object and array records, breadth first from the root object (object 0)
+//!   object table   mObjectCount offsets of the object records
+//!   array table    mArrayCount offsets of the array records
+//!   string table   mStringCount offsets of the strings
+//!   string data    null terminated strings, each key and value stored once
+//!
+//! Object record: BINARY_MEMBER_COUNT member counts (ints, floats, strings, objects, assets, arrays),
+//! followed by one (key string index, value) pair per member in the same order. The value is the bits
+//! of the int or float, a string index, an object or array index, or the string index of an asset path.
+//! Array record: Array::Type and element count, followed by the elements as one contiguous blob
+//! of values with the same meaning as the object values.
+struct BinaryAssetHeader
+{
+    unsigned int mMagic;        //!< BINARY_ASSET_MAGIC
+    unsigned int mVersion;      //!< BINARY_ASSET_VERSION
+    unsigned int mSize;         //!< Size of the whole asset, in bytes
+    unsigned int mObjectCount;  //!< Number of objects, the root is object 0
+    unsigned int mArrayCount;   //!< Number of arrays
+    unsigned int mStringCount;  //!< Number of unique strings
+    unsigned int mObjectTable;  //!< Offset of the object table
+    unsigned int mArrayTable;   //!< Offset of the array table
+    unsigned int mStringTable;  //!< Offset of the string table
+    unsigned int mStringData;   //!< Offset of the string data, which runs until the end of the asset
+};
+
+//! First bytes of a binary asset, "PGAB". Text assets always start with '{' or a white space.
+const unsigned int BINARY_ASSET_MAGIC = 0x42414750;
+
+//! Version of the layout, increment on any change
+const unsigned int BINARY_ASSET_VERSION = 1;
+
+//! Kinds of object members, in the order of the counts of an object record
+enum BinaryMember
+{
+    BINARY_MEMBER_INT,
+    BINARY_MEMBER_FLOAT,
+    BINARY_MEMBER_STRING,
+    BINARY_MEMBER_OBJECT,
+    BINARY_MEMBER_ASSET,
+    BINARY_MEMBER_ARRAY,
+    BINARY_MEMBER_COUNT
+};
+
+//! Tells if a buffer holds a binary asset
+//! \param buffer the file buffer
+//! \param size the size of the buffer in bytes
+//! \return true if the buffer starts with the binary asset magic number
+bool IsBinaryAsset(const char* buffer, int size);
+
+//! Writes an object tree as a binary asset
+//! \param root the root object of the asset
+//! \param allocator allocator for the temporary tables of the writer
+//! \param stream the stream to append the binary asset to
+void WriteBinaryAsset(const Object* root, Alloc::IAllocator* allocator, Utils::ByteStream& stream);
+
+//! Builds the object tree of a binary asset into the asset of a builder.
+//! The keys and strings of the tree point into the buffer, which has to live as long as the asset.
+//! Child assets are enqueued into the builder, like the text parser does.
+//! \param buffer the binary asset, 4 byte aligned
+//! \param size the size of the buffer in bytes
+//! \param allocator allocator for the temporary tables of the reader
+//! \param builder the builder, after BeginCompilation()
+//! \return true if successful, false if the buffer is not a valid binary asset
+bool ReadBinaryAsset(const char* buffer, int size, Alloc::IAllocator* allocator, AssetBuilder* builder);
+
+}
+}
+
+#endif  // PEGASUS_ASSETLIB_BINARYASSET_H
@@ -17,6 +17,7 @@
 #if PEGASUS_ASSETLIB_ENABLE_CATEGORIES
 
 #include "Pegasus/Utils/Vector.h"
+#include "Pegasus/AssetLib/AssetPathIndex.h"
 #include "Pegasus/AssetLib/Proxy/CategoryProxy.h"
 
 namespace Pegasus
@@ -52,6 +53,13 @@ public:
     //! \param calledFromAssetDestructor only true if called from an asset being unloaded completely.
     void UnregisterAsset(Asset* asset, bool calledFromAssetDestructor = false);
 
+    //! \return true if the asset is registered in this category
+    bool HasAsset(const Asset* asset) const;
+
+    //! Finds a registered asset by path, ignoring the case and the kind of slashes
+    //! \return the asset, nullptr if no asset of this category has this path
+    Asset* FindAsset(const char* path) const;
+
     //! Get the asset from the id passed
     Asset* GetAsset(unsigned i) const { return mAssets[i]; }
 
@@ -68,6 +76,7 @@ public:
 private:
     unsigned mUserData;
     Utils::Vector<Asset*> mAssets;
+    AssetPathIndex mAssetIndex; //!< Registered assets by path, the user data of an asset is its position in mAssets
 
 #if PEGASUS_ENABLE_PROXIES
     CategoryProxy mProxy;
@@ -0,0 +1,125 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   LoadGraph.h
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Graph of assets read and parsed in parallel ahead of their runtime objects
+
+#ifndef PEGASUS_ASSETLIB_LOADGRAPH_H
+#define PEGASUS_ASSETLIB_LOADGRAPH_H
+
+#include "Pegasus/Utils/Vector.h"
+#include "Pegasus/AssetLib/AssetPathIndex.h"
+
+//fwd declarations
+namespace Pegasus
+{
+    namespace Alloc {
+        class IAllocator;
+    }
+}
+
+namespace Pegasus
+{
+namespace AssetLib
+{
+
+class AssetLib;
+class Asset;
+class AssetBuilder;
+
+//! Timings of the last load of a graph, in seconds
+struct LoadGraphStats
+{
+    int mAssetCount;        //!< Number of assets of the graph
+    int mFailedCount;       //!< Number of assets that failed to read or parse
+    int mDepth;             //!< Longest chain of child asset references, each level is read and parsed in parallel
+    double mWallTime;       //!< Time of the whole load
+    double mReadTime;       //!< Sum of the read times of every asset
+    double mParseTime;      //!< Sum of the parse times of every asset
+    double mCriticalPath;   //!< Longest chain of dependent reads and parses, lower bound of the wall time
+
+    //! \return the sum of the read and parse times, which is the time a serial load would take
+    double GetSerialTime() const { return mReadTime + mParseTime; }
+};
+
+//! Graph of assets, discovered from the child asset references of each parsed asset.
+//! Reads and parses of the assets of a same level run on the parallel for workers,
+//! everything touching the asset library state (asset creation and the graph itself)
+//! runs on the calling thread. Runtime objects are not created here, the asset library
+//! takes the loaded assets out of the graph as its factories need them.
+class LoadGraph
+{
+public:
+    //! Constructor
+    //! \param allocator allocator of the nodes and the assets
+    //! \param lib the asset library owning this graph
+    LoadGraph(Alloc::IAllocator* allocator, AssetLib* lib);
+
+    //! Destructor, destroys the assets never taken out of the graph
+    ~LoadGraph();
+
+    //! Reads and parses assets and every asset they reference, directly or not.
+    //! Assets already in the asset library or already in the graph are skipped.
+    //! \param paths paths of the root assets
+    //! \param pathCount number of root assets
+    void Load(const char* const* paths, int pathCount);
+
+    //! Takes a successfully loaded asset out of the graph
+    //! \param path the path of the asset
+    //! \param isStructured the format expected for the asset
+    //! \param outAsset output asset, owned by the caller on success
+    //! \param outBuilder output builder holding the child asset requests of the asset, valid until Clear()
+    //! \return true if the asset was found and loaded, false to load it the regular way
+    bool TakeAsset(const char* path, bool isStructured, Asset** outAsset, const AssetBuilder** outBuilder);
+
+    //! Destroys the nodes, and the assets never taken out of the graph
+    void Clear();
+
+    //! \return true if no asset is waiting in the graph
+    bool IsEmpty() const { return mNodes.GetSize() == 0; }
+
+    //! \return the timings of the last call to Load()
+    const LoadGraphStats& GetStats() const { return mStats; }
+
+private:
+    // No copies allowed
+    PG_DISABLE_COPY(LoadGraph);
+
+    struct Node;
+
+    //! Adds the node of an asset, unless it is known already
+    //! \param path path of the asset
+    //! \param parent index of the node referencing the asset, -1 for a root
+    void AddNode(const char* path, int parent);
+
+    //! Adds the nodes of the child assets of a loaded node
+    void AddChildNodes(int nodeIndex);
+
+    //! Reads and parses a node, on a worker thread
+    void LoadNode(Node* node);
+
+    //! Parallel for callback, loads a range of the nodes of the current level
+    static void LoadNodes(int begin, int end, void* userData);
+
+    //! Fills the timings once every node is loaded
+    //! \param firstNode first node added by the last call to Load()
+    //! \param wallTime time of the last call to Load()
+    void ComputeStats(unsigned int firstNode, double wallTime);
+
+    Alloc::IAllocator* mAllocator;
+    AssetLib* mLib;
+    Utils::Vector<Node*> mNodes;
+    AssetPathIndex mNodeIndex; //!< Assets of the nodes not taken yet, the user data is the node index
+    int mLevelBegin; //!< First node of the level being loaded
+    LoadGraphStats mStats;
+};
+
+}
+}
+
+#endif  // PEGASUS_ASSETLIB_LOADGRAPH_H
@@ -0,0 +1,26 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Benchmarks                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   AssetLibBenchmarks.h
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Pegasus benchmarks for the AssetLib package
+
+//! ADD HERE YOUR BENCHMARK NAMES
+
+#ifndef PEGASUS_ASSETLIB_BENCHMARKS_H
+#define PEGASUS_ASSETLIB_BENCHMARKS_H
+
+//! Load of a large structured asset, text grammar vs binary encoding, with a round trip check of both encodings
+void BENCHMARK_AssetLibBinaryLoad();
+
+//! Preload of a graph of assets referencing child assets, serial vs parallel, with critical path timings
+void BENCHMARK_AssetLibParallelLoad();
+
+//! Lookup of loaded assets by path, linear scan vs the path index of the asset library
+void BENCHMARK_AssetLibPathLookup();
+
+#endif  // PEGASUS_ASSETLIB_BENCHMARKS_H
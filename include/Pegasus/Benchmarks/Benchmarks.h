@@ -0,0 +1,52 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Benchmarks                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Benchmarks.h
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Shared helpers of the Pegasus benchmarks executable
+
+#ifndef PEGASUS_BENCHMARKS_H
+#define PEGASUS_BENCHMARKS_H
+
+//! Number of times each measured section runs. The best run is reported.
+const int BENCHMARK_RUN_COUNT = 10;
+
+//! Returns the current time, in seconds
+double BenchmarkGetTime();
+
+//! Prints one line of results
+//! \param label name of what was measured
+//! \param seconds duration of the best run
+//! \param elementCount number of elements (vertices, keys...) processed by one run
+void BenchmarkReport(const char* label, double seconds, int elementCount);
+
+//! Prints the speedup of a measurement against its reference
+//! \param label name of what was measured
+//! \param referenceSeconds duration of the reference run
+//! \param seconds duration of the optimized run
+void BenchmarkReportSpeedup(const char* label, double referenceSeconds, double seconds);
+
+//! Prints an error of a check of the benchmark results, and counts it in the exit code of the executable
+//! \param format printf format of the message, followed by its arguments
+void BenchmarkReportError(const char* format, ...);
+
+//! Runs a functor BENCHMARK_RUN_COUNT times and returns the best duration
+template<class F>
+double BenchmarkMeasure(F& func)
+{
+    double best = 1e30;
+    for (int r = 0; r < BENCHMARK_RUN_COUNT; ++r)
+    {
+        const double start = BenchmarkGetTime();
+        func();
+        const double duration = BenchmarkGetTime() - start;
+        best = duration < best ? duration : best;
+    }
+    return best;
+}
+
+#endif  // PEGASUS_BENCHMARKS_H
@@ -0,0 +1,66 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Benchmarks                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MathBenchmarks.h
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Pegasus benchmarks for the Math package
+
+//! ADD HERE YOUR BENCHMARK NAMES
+
+#ifndef PEGASUS_MATH_BENCHMARKS_H
+#define PEGASUS_MATH_BENCHMARKS_H
+
+//! Compares the matrix and quaternion operations with the generic scalar code over random inputs. Reports the largest error.
+void BENCHMARK_MathAccuracy();
+
+//! Matrix times vector, generic scalar code vs the SIMD operation
+void BENCHMARK_MathMult44_41();
+
+//! Transposed matrix times vector, generic scalar code vs the SIMD operation
+void BENCHMARK_MathMult44T_41();
+
+//! Matrix times matrix, generic scalar code vs the SIMD operation
+void BENCHMARK_MathMult44_44();
+
+//! Normalized quaternion product, generic scalar code vs the SIMD operation
+void BENCHMARK_MathQuaternionMult();
+
+//! Vector rotation by a quaternion, generic scalar code vs the SIMD operation
+void BENCHMARK_MathRotateVector();
+
+//! Strided point transforms from 10K to 10M points, per element Mult44_41 loop vs TransformPoints
+void BENCHMARK_MathTransformPoints();
+
+//! Strided normal transforms with renormalization from 10K to 10M normals, per element Mult33_31 loop vs TransformNormals
+void BENCHMARK_MathTransformNormals();
+
+//! Structure-of-arrays homogeneous point transforms from 10K to 10M points, per element loop vs TransformHomogeneousPointsSoa
+void BENCHMARK_MathTransformPointsSoa();
+
+//! Bounding box transforms from 10K to 10M boxes, 8 transformed corners per box vs TransformAabbs
+void BENCHMARK_MathTransformAabbs();
+
+//! Frustum culling of 10K to 10M boxes, 8 corners per box against each plane vs CullAabbsSoa
+void BENCHMARK_MathCullAabbs();
+
+//! Frustum culling of 10K to 10M spheres, per sphere loop vs CullSpheresSoa
+void BENCHMARK_MathCullSpheres();
+
+//! Bounding volume hierarchy of 10K to 1M boxes, SAH build and refit after moving one box out of 10
+void BENCHMARK_MathBvhBuild();
+
+//! Frustum, overlap and ray queries of bounding volume hierarchies of 10K to 1M boxes vs per box loops
+void BENCHMARK_MathBvhQueries();
+
+//! Sweeps the inputs of the fast sin, cos, exp, log and pow, and checks their errors against double precision libm,
+//! then the negative and zero bases of pow against powf
+void BENCHMARK_MathTranscendentalAccuracy();
+
+//! Sin, cos, exp, log and pow, libm vs the fast scalar and 4-wide approximations
+void BENCHMARK_MathTranscendentals();
+
+#endif  // PEGASUS_MATH_BENCHMARKS_H
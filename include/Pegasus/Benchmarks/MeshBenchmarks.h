@@ -0,0 +1,38 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Benchmarks                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MeshBenchmarks.h
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Pegasus benchmarks for the Mesh package
+
+//! ADD HERE YOUR BENCHMARK NAMES
+
+#ifndef PEGASUS_MESH_BENCHMARKS_H
+#define PEGASUS_MESH_BENCHMARKS_H
+
+//! Wave field displacement, interleaved scalar loop vs structure-of-arrays SIMD kernel
+void BENCHMARK_MeshWaveField();
+
+//! Wave field kernel run through Core::ParallelFor, from 1 to all threads. Checks the results match.
+void BENCHMARK_MeshParallelScaling();
+
+//! Multi copy style transform, interleaved scalar loop vs structure-of-arrays SIMD kernel
+void BENCHMARK_MeshTransform();
+
+//! Combine transform style transform with normal renormalization, interleaved scalar loop vs structure-of-arrays SIMD kernel
+void BENCHMARK_MeshTransformNormalize();
+
+//! Weld, vertex cache and vertex fetch optimization of an unwelded grid with shuffled triangles. Reports the ACMR.
+void BENCHMARK_MeshOptimize();
+
+//! CPU marching cubes of a density grid, single thread vs all threads. Reports the triangles per second.
+void BENCHMARK_MeshMarchingCubes();
+
+//! Quadric error simplification of icospheres into a chain of levels of detail. Reports the triangles and error per level.
+void BENCHMARK_MeshSimplify();
+
+#endif  // PEGASUS_MESH_BENCHMARKS_H
@@ -0,0 +1,25 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Benchmarks                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   PropertyGridBenchmarks.h
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Pegasus benchmarks for the PropertyGrid package
+
+//! ADD HERE YOUR BENCHMARK NAMES
+
+#ifndef PEGASUS_PROPERTYGRID_BENCHMARKS_H
+#define PEGASUS_PROPERTYGRID_BENCHMARKS_H
+
+//! Load of a large graph of nodes from an asset, lookup of every property vs compiled layouts,
+//! and match of a render collection layout against the node properties
+void BENCHMARK_PropertyGridGraphLoad();
+
+//! Script writes of node properties, one change event per write vs property batches,
+//! with a check that writes of unchanged values leave the property grid valid
+void BENCHMARK_PropertyGridBatchedWrites();
+
+#endif  // PEGASUS_PROPERTYGRID_BENCHMARKS_H
@@ -0,0 +1,56 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Benchmarks                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   RenderBenchmarks.h
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Pegasus benchmarks for the Render package
+
+//! ADD HERE YOUR BENCHMARK NAMES
+
+#ifndef PEGASUS_RENDER_BENCHMARKS_H
+#define PEGASUS_RENDER_BENCHMARKS_H
+
+//! CPU cost of the render submission on the null backend, recording the commands vs only counting them.
+//! Checks the command log of a frame is identical from one run to the other. Requires _PEGASUS_GAPI_NULL.
+void BENCHMARK_RenderNullSubmission();
+
+//! Commands submitted and CPU microseconds per frame of a frame with redundant state, immediate vs
+//! recorded into a command buffer, sorted and filtered. Checks the uniforms the command buffer binds after a program
+//! change match the render API. Requires _PEGASUS_GAPI_NULL.
+void BENCHMARK_RenderCommandBuffer();
+
+//! Render of a timeline of script heavy lanes, the lanes one after the other with the immediate render API vs
+//! recorded concurrently into one command buffer per lane, then submitted in the order of the lanes.
+//! Checks the submission is identical for any thread count. Requires _PEGASUS_GAPI_NULL.
+void BENCHMARK_RenderConcurrentLanes();
+
+//! Update and render of a real timeline of script heavy lanes in a headless application, the lanes one after the other
+//! vs recorded concurrently (Timeline::SetConcurrentRender()). One block resolves a uniform in its render and stays
+//! on the main thread. Checks the submission is identical for any thread count. Requires _PEGASUS_GAPI_NULL.
+void BENCHMARK_RenderTimelineLanes();
+
+//! Offline evaluation of the timeline of BENCHMARK_RenderTimelineLanes: updates only (Timeline::RunUpdateOnly())
+//! in PLAYMODE_FIXED_STEP, then updates and renders, traced, the trace saved as CSV. Checks the beats of the updates,
+//! the traced frames and the lines of the saved trace. Requires _PEGASUS_GAPI_NULL.
+void BENCHMARK_RenderTimelineFixedStep();
+
+//! Render snapshots of the timeline of BENCHMARK_RenderTimelineLanes, whose block scripts animate a node in their update
+//! and read it in their render. Checks the render reads the values of the update, and its own writes, and that editing
+//! the live nodes between Timeline::Update() and Timeline::Render() does not change the submission. Requires _PEGASUS_GAPI_NULL.
+void BENCHMARK_RenderTimelineSnapshot();
+
+//! Uniform ring of the transient uniform buffers: checks the bookkeeping of random frames on a small ring
+//! (alignment, no range overlapping a frame in flight, space reused once the frames retire), then measures
+//! the allocation and copy of the draw constants. The frames with a transient uniform buffer require _PEGASUS_GAPI_NULL.
+void BENCHMARK_RenderUniformRing();
+
+//! Uniform location by name in a program of many uniforms, linear search vs hashed lookup of the reflection data,
+//! checked against each other. Then the uniform bindings of frames with locations found every draw, found once, and
+//! found once before the program linked again. The binding frames require _PEGASUS_GAPI_NULL.
+void BENCHMARK_RenderUniformLocation();
+
+#endif  // PEGASUS_RENDER_BENCHMARKS_H
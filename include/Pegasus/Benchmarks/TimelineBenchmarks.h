@@ -0,0 +1,26 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Benchmarks                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   TimelineBenchmarks.h
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Pegasus benchmarks for the Timeline package
+
+//! ADD HERE YOUR BENCHMARK NAMES
+
+#ifndef PEGASUS_TIMELINE_BENCHMARKS_H
+#define PEGASUS_TIMELINE_BENCHMARKS_H
+
+//! Current block lookup of every lane during playback, linked list walk vs lane playback cursor
+void BENCHMARK_TimelineBlockLookup();
+
+//! Current block lookup of every lane at random beats (scrubbing), linked list walk vs binary search
+void BENCHMARK_TimelineBlockSeek();
+
+//! Script update of many lanes on the update scheduler, scaling with the number of threads
+void BENCHMARK_TimelineParallelUpdate();
+
+#endif  // PEGASUS_TIMELINE_BENCHMARKS_H
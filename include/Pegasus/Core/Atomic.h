@@ -0,0 +1,136 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Atomic.h
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Atomic counter operations, used by the reference counters shared between threads,
+//!         atomic exchanges, used by the locks of the data written by several threads,
+//!         and the backoff of the threads waiting on those locks
+
+#ifndef PEGASUS_CORE_ATOMIC_H
+#define PEGASUS_CORE_ATOMIC_H
+
+#if PEGASUS_PLATFORM_WINDOWS
+#include <intrin.h>
+#endif
+
+namespace Pegasus {
+namespace Core {
+
+//! Atomic increment, full memory barrier
+//! \return Value of the counter after the increment
+inline long AtomicIncrement(volatile long * counter)
+{
+#if PEGASUS_PLATFORM_WINDOWS
+    return _InterlockedIncrement(counter);
+#else
+    return __sync_add_and_fetch(counter, 1);
+#endif
+}
+
+//! Atomic decrement, full memory barrier
+//! \return Value of the counter after the decrement
+inline long AtomicDecrement(volatile long * counter)
+{
+#if PEGASUS_PLATFORM_WINDOWS
+    return _InterlockedDecrement(counter);
+#else
+    return __sync_sub_and_fetch(counter, 1);
+#endif
+}
+
+//! Atomic compare and exchange, full memory barrier
+//! \return Previous value of the destination, the exchange happened if it equals comparand
+inline long AtomicCompareExchange(volatile long * destination, long exchange, long comparand)
+{
+#if PEGASUS_PLATFORM_WINDOWS
+    return _InterlockedCompareExchange(destination, exchange, comparand);
+#else
+    return __sync_val_compare_and_swap(destination, comparand, exchange);
+#endif
+}
+
+//! Atomic write, full memory barrier
+//! \return Previous value of the destination
+inline long AtomicExchange(volatile long * destination, long value)
+{
+#if PEGASUS_PLATFORM_WINDOWS
+    return _InterlockedExchange(destination, value);
+#else
+    const long previous = __sync_lock_test_and_set(destination, value);
+    __sync_synchronize();
+    return previous;
+#endif
+}
+
+//! Atomic read, full memory barrier
+//! \return Current value of the source
+inline long AtomicLoad(volatile long * source)
+{
+#if PEGASUS_PLATFORM_WINDOWS
+    return _InterlockedCompareExchange(source, 0, 0);
+#else
+    return __sync_val_compare_and_swap(source, 0, 0);
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Processor hint for the body of a spin loop, leaves the execution resources
+//! of the core to its other hardware thread while waiting
+inline void SpinPause()
+{
+#if PEGASUS_PLATFORM_WINDOWS
+    _mm_pause();
+#elif defined(__i386__) || defined(__x86_64__)
+    __builtin_ia32_pause();
+#endif
+}
+
+//! Give the rest of the time slice of the calling thread to another thread ready to run
+void YieldThread();
+
+//! Backoff of a thread waiting for another one (lock holder, fence, flag).
+//! The first waits only pause the processor, the holder is expected to finish soon,
+//! the next ones yield the time slice, so a holder preempted by the scheduler gets to run.
+//! Create one per wait loop, and call Wait() once per failed attempt
+class SpinBackoff
+{
+public:
+    SpinBackoff() : mNumWaits(0) {}
+
+    //! Wait once before the next attempt
+    inline void Wait()
+    {
+        if (mNumWaits < NUM_PAUSE_WAITS)
+        {
+            // Exponential number of pauses, up to 32 per wait
+            const int numPauses = 1 << ((mNumWaits < 5) ? mNumWaits : 5);
+            for (int p = 0; p < numPauses; ++p)
+            {
+                SpinPause();
+            }
+            ++mNumWaits;
+        }
+        else
+        {
+            YieldThread();
+        }
+    }
+
+private:
+    //! Number of waits pausing the processor before yielding the time slice
+    enum { NUM_PAUSE_WAITS = 16 };
+
+    //! Number of waits so far, saturates at NUM_PAUSE_WAITS
+    int mNumWaits;
+};
+
+}   // namespace Core
+}   // namespace Pegasus
+
+#endif  // PEGASUS_CORE_ATOMIC_H
@@ -44,6 +44,17 @@ public:
     //! \param bufferSize Size of the buffer.
     void OwnBuffer(Alloc::IAllocator* bufferAlloc, char * buffer, int bufferSize);
 
+    //! Takes ownership of a file mapping, as the contents of this object.
+    //! The mapping is copy on write, writes to the buffer never reach the file.
+    //! \param bufferAlloc Allocator for the buffers replacing the mapping, returned by GetAllocator().
+    //! \param mapping Address of the mapped view.
+    //! \param mappingSize Size of the mapped view.
+    void OwnMapping(Alloc::IAllocator* bufferAlloc, char * mapping, int mappingSize);
+
+    //! Tells if the contained buffer is a file mapping
+    //! \return true if the buffer is unmapped rather than deleted when destroyed.
+    bool IsMapped() const { return mIsMapped; }
+
     //! Releases ownership of any currently owned buffer
     void ForgetBuffer();
 
@@ -82,10 +93,34 @@ private:
     char* mBuffer; //!< Contained buffer
     int mFileSize; //!< Size of the file in the buiffer
     int mBufferSize; //!< Size of the buffer
+    bool mIsMapped; //!< True if the buffer is a file mapping
 };
 
 //----------------------------------------------------------------------------------------
 
+class IOManager;
+class IoRequest;
+
+//! Callback of an asynchronous read request, called on an IO thread once the file is read.
+//! The request is not done yet when the callback runs, so it must not be destroyed or resubmitted from there.
+//! \param request the request, with its result and buffer filled
+//! \param userData user pointer of the request
+typedef void (*IoRequestCallback)(IoRequest* request, void* userData);
+
+//! Starts the IO threads serving the asynchronous read requests
+//! \param threadCount number of IO threads. A negative value uses a default suited to the platform.
+//! \note Without IO threads, requests are read on the submitting thread
+void InitializeIoThreads(int threadCount = -1);
+
+//! Finishes the queued requests, then stops and destroys the IO threads
+void ShutdownIoThreads();
+
+//! Gets the number of IO threads
+//! \return thread count, 0 if the requests are read on the submitting thread
+int GetIoThreadCount();
+
+//----------------------------------------------------------------------------------------
+
 //! IO manager, loads files/assets from a given root filesystem
 class IOManager
 {
@@ -112,12 +147,31 @@ public:
     //! \note Buffer must be deallocated by the caller
     IoError OpenFileToBuffer(const char* relativePath, FileBuffer& outputBuffer, bool allocateBuffer = false, Alloc::IAllocator* alloc = nullptr);
 
+    //! Maps a file in memory, read only and without any copy. The pages are read on first access.
+    //! Writes to the buffer are copy on write, they never reach the file.
+    //! \param relativePath Relative path to the file, within the asset root.
+    //! \param outputBuffer Output buffer, empty before the call, owning the mapping after a successful call.
+    //! \param alloc Allocator of the buffer when the file gets copied rather than mapped, and of the buffers replacing the mapping.
+    //! \return Error code.
+    //! \warning The file cannot be overwritten safely while it is mapped
+    IoError MapFileToBuffer(const char* relativePath, FileBuffer& outputBuffer, Alloc::IAllocator* alloc);
+
     //! Utility function that writes binary data to a file
     //! \param relativePath Relative path to the file, within the asset root.
     //! \param inputBuffer the file buffer to dump into the file.
     //! \return Error code.
     IoError SaveFileToBuffer(const char* relativePath, const FileBuffer& inputBuffer);
 
+    //! Queues an asynchronous read of a whole file, served by the IO threads.
+    //! Completion can be polled with IoRequest::IsDone(), waited for with WaitForRequest(),
+    //! or notified through the callback of the request.
+    //! \param request the request to read, set up with IoRequest::SetFile(). It must stay alive until it is done.
+    void SubmitRead(IoRequest* request);
+
+    //! Blocks until a submitted request is done
+    //! \param request the request to wait for
+    void WaitForRequest(IoRequest* request);
+
 
     static const unsigned int MAX_FILEPATH_LENGTH = 256; //!< Max length for a file path
 
@@ -130,6 +184,77 @@ private:
 };
 
 
+//----------------------------------------------------------------------------------------
+
+//! Asynchronous read of a whole file, see IOManager::SubmitRead()
+class IoRequest
+{
+    friend class IOManager;
+    friend class IoThreadPool;
+
+public:
+    //! Constructor
+    IoRequest();
+
+    //! Destructor
+    //! \warning The request must not be pending
+    ~IoRequest();
+
+    //! Sets the file to read. Destroys the buffer of the previous read, if any.
+    //! \param relativePath Relative path to the file, within the asset root. Copied.
+    //! \param mapFile true to map the file in memory (see IOManager::MapFileToBuffer()), false to copy it
+    //! \param alloc Allocator of the buffer
+    void SetFile(const char* relativePath, bool mapFile, Alloc::IAllocator* alloc);
+
+    //! Sets the callback called on the IO thread once the file is read
+    //! \param callback the callback, nullptr for none
+    //! \param userData user pointer passed to the callback
+    void SetCallback(IoRequestCallback callback, void* userData) { mCallback = callback; mUserData = userData; }
+
+    //! Tells if the request is done. Does not block.
+    //! \return true once the result and the buffer can be used
+    bool IsDone() const;
+
+    //! Gets the result of the read, once done
+    //! \return Error code.
+    IoError GetResult() const { return mResult; }
+
+    //! Gets the file read, once done. Forget the buffer to keep it after the request is destroyed.
+    //! \return the buffer of the file
+    FileBuffer& GetBuffer() { return mBuffer; }
+
+    //! Gets the path of the file
+    //! \return the relative path
+    const char* GetPath() const { return mPath; }
+
+private:
+    // No copies allowed
+    PG_DISABLE_COPY(IoRequest);
+
+    //! State of a request, changed under the lock of the IO threads
+    enum State
+    {
+        STATE_IDLE,
+        STATE_PENDING,
+        STATE_DONE
+    };
+
+    //! Reads the file and calls the callback, on the calling thread
+    void Execute();
+
+    char mPath[IOManager::MAX_FILEPATH_LENGTH]; //!< Relative path of the file
+    bool mMapFile; //!< True to map the file rather than copy it
+    Alloc::IAllocator* mAllocator; //!< Allocator of the buffer
+    IoRequestCallback mCallback; //!< Callback called once read, can be null
+    void* mUserData; //!< User pointer of the callback
+    IOManager* mManager; //!< Manager the request was submitted to
+    FileBuffer mBuffer; //!< Output buffer
+    IoError mResult; //!< Result of the read
+    volatile State mState; //!< State of the request
+    IoRequest* mNext; //!< Next request in the queue of the IO threads
+};
+
+
 } // namespace Io
 } // namespace Pegasus
 
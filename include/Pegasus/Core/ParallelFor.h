@@ -0,0 +1,68 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   ParallelFor.h
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Parallel for loop over a pool of worker threads
+
+#ifndef PEGASUS_CORE_PARALLELFOR_H
+#define PEGASUS_CORE_PARALLELFOR_H
+
+namespace Pegasus {
+namespace Core {
+
+//! Callback running one chunk of a parallel for
+//! \param begin first index of the chunk
+//! \param end one past the last index of the chunk
+//! \param userData user pointer given to ParallelFor
+typedef void (*ParallelForCallback)(int begin, int end, void* userData);
+
+//! Starts the worker threads
+//! \param workerCount number of worker threads, not counting the calling thread.
+//!                    A negative value uses one worker per logical core, minus one.
+//! \warning Has to be done before any call to \a ParallelFor() can use more than the calling thread
+void InitializeParallelFor(int workerCount = -1);
+
+//! Stops and destroys the worker threads
+void ShutdownParallelFor();
+
+//! Gets the number of threads a parallel for can run on, including the calling thread
+//! \return thread count, at least 1
+int GetParallelForThreadCount();
+
+//! Limits the number of threads used by the next parallel for calls, including the calling thread
+//! \param threadCount max number of threads to use, 0 to use all of them.
+//! \note Useful for scaling measurements, the result of a parallel for never depends on it
+void SetParallelForThreadLimit(int threadCount);
+
+//! Runs callback over [0, count), split in chunks of grainSize indices.
+//! Chunk boundaries only depend on count and grainSize, so as long as the callback writes
+//! disjoint data per index, the result is the same for any thread count.
+//! Returns when every chunk has completed.
+//! \param count number of indices
+//! \param grainSize number of indices per chunk, must be greater than 0
+//! \param callback function called once per chunk, possibly from several threads at once
+//! \param userData user pointer passed to every callback
+//! \note Calls made from inside a running parallel for are executed serially on the calling thread
+void ParallelFor(int count, int grainSize, ParallelForCallback callback, void* userData);
+
+//! Functor version of ParallelFor. func(begin, end) is called once per chunk.
+template<class F>
+void ParallelFor(int count, int grainSize, F& func)
+{
+    struct Invoker
+    {
+        static void Run(int begin, int end, void* userData) { (*static_cast<F*>(userData))(begin, end); }
+    };
+    ParallelFor(count, grainSize, &Invoker::Run, static_cast<void*>(&func));
+}
+
+
+}   // namespace Core
+}   // namespace Pegasus
+
+#endif  // PEGASUS_CORE_PARALLELFOR_H
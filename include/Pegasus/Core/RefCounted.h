@@ -13,6 +13,8 @@
 #ifndef PEGASUS_CORE_REFCOUNTED_H
 #define PEGASUS_CORE_REFCOUNTED_H
 
+#include "Pegasus/Core/Atomic.h"
+
 namespace Pegasus {
     namespace Alloc {
         class IAllocator;
@@ -32,8 +34,9 @@ public:
     //! Destructor
     virtual ~RefCounted();
 
-    //! Increment the reference counter, used by Ref<Node>
-    inline void AddRef() { mRefCount++; }
+    //! Increment the reference counter, used by Ref<Node>.
+    //! Atomic, the references to an object can be taken and released by several threads at once
+    inline void AddRef() { AtomicIncrement(&mRefCount); }
 
     //! Decrease the reference counter, and delete the current object
     //! if the counter reaches 0
@@ -41,12 +44,12 @@ public:
 
     //! Get the current reference count of this object
     //! \return the ref count
-    inline int GetRefCount() const { return mRefCount; }
+    inline int GetRefCount() const { return static_cast<int>(mRefCount); }
 
 private:
 
     //! Reference counter
-    int mRefCount;
+    volatile long mRefCount;
     
     //! Pointer to allocator
     Alloc::IAllocator* mAllocator;
@@ -31,6 +31,11 @@ void UpdatePegasusTime();
 //! \return System time in seconds
 double GetPegasusTime();
 
+//! Read the system time, without changing the current Pegasus time
+//! \note Safe to call from any thread, used to time work running on worker threads
+//! \return System time in seconds, on the same scale as \a GetPegasusTime()
+double ReadPegasusTime();
+
 
 }   // namespace Core
 }   // namespace Pegasus
@@ -13,6 +13,7 @@
 #define PEGASUS_GRAPH_NODEDATA_H
 
 #include "Pegasus/Core/Ref.h"
+#include "Pegasus/Core/Atomic.h"
 #include "Pegasus/Graph/NodeGPUData.h"
 
 namespace Pegasus {
@@ -84,11 +85,11 @@ private:
 
 
     //! Increment the reference counter, used by Ref<Node>
-    inline void AddRef() { mRefCount++; }
+    inline void AddRef() { Core::AtomicIncrement(&mRefCount); }
 
     //! Get the current reference counter
     //! \return Number of Ref<Node> objects pointing to the current object (>= 0)
-    inline int GetRefCount() const { return mRefCount; }
+    inline int GetRefCount() const { return static_cast<int>(mRefCount); }
 
     //! Decrease the reference counter, and delete the current object
     //! if the counter reaches 0
@@ -100,9 +101,8 @@ private:
     //! Allocator for this object
     Alloc::IAllocator * mAllocator;
 
-    //! Reference counter
-    //! \todo Use atomic integer
-    int mRefCount;
+    //! Reference counter, atomic
+    volatile long mRefCount;
 
     //! True when the data is dirty, meaning it will need to be recomputed to be valid
     bool mDirty;
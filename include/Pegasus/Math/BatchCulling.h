@@ -0,0 +1,58 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   BatchCulling.h
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Culling of arrays of bounding boxes and spheres against a convex volume (a camera frustum),
+//!         in one call. The volumes are stored as planes of floats (structure of arrays), pitch floats
+//!         apart, and the results are bit masks, one bit per volume.
+//!         A point is inside a plane when it is in its back (see Plane::IsInBack), so the normals
+//!         of the planes of a frustum point outwards.
+
+#ifndef PEGASUS_MATH_BATCHCULLING_H
+#define PEGASUS_MATH_BATCHCULLING_H
+
+#include "Pegasus/Math/Plane.h"
+
+namespace Pegasus {
+namespace Math {
+
+
+//! Number of words of the masks of the culling functions
+//! \param count Number of culled volumes
+//! \return Size of each mask, in words, bit i of the mask being bit (i % 32) of word (i / 32)
+inline int GetCullMaskSize(int count) { return (count + 31) / 32; }
+
+//! Culling of axis-aligned bounding boxes stored as 6 planes (min x, y, z then max x, y, z)
+//! \param insideMask Receives a bit set for each box inside all the planes, GetCullMaskSize(count) words
+//! \param outsideMask Receives a bit set for each box in the front of one of the planes, GetCullMaskSize(count) words.
+//!                    The boxes that are neither inside nor outside intersect the volume.
+//! \param boxes First box, in the min x plane
+//! \param pitch Float count between two planes of boxes
+//! \param count Number of boxes
+//! \param planes Planes of the convex volume
+//! \param planeCount Number of planes
+void CullAabbsSoa(PUInt32 * insideMask, PUInt32 * outsideMask, const PFloat32 * boxes, int pitch, int count,
+                  const Plane * planes, int planeCount);
+
+//! Culling of bounding spheres stored as 4 planes (center x, y, z then radius)
+//! \param insideMask Receives a bit set for each sphere inside all the planes, GetCullMaskSize(count) words
+//! \param outsideMask Receives a bit set for each sphere in the front of one of the planes, GetCullMaskSize(count) words.
+//!                    The spheres that are neither inside nor outside intersect the volume.
+//! \param spheres First sphere, in the center x plane
+//! \param pitch Float count between two planes of spheres
+//! \param count Number of spheres
+//! \param planes Planes of the convex volume
+//! \param planeCount Number of planes
+void CullSpheresSoa(PUInt32 * insideMask, PUInt32 * outsideMask, const PFloat32 * spheres, int pitch, int count,
+                    const Plane * planes, int planeCount);
+
+
+}   // namespace Math
+}   // namespace Pegasus
+
+#endif    // PEGASUS_MATH_BATCHCULLING_H
@@ -0,0 +1,88 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   BatchTransform.h
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Transforms of arrays of points, normals and bounding boxes by one matrix, in one call.
+//!         The strided versions walk interleaved elements (vertices, Vec3 / Vec4 arrays), the stride
+//!         being the size in bytes from one element to the next. The structure-of-arrays (SoA) versions
+//!         walk planes of floats, pitch floats apart (see MeshData::GetSoaStream).
+//!         Nothing is read or written past count elements, and the destination can be the source.
+
+#ifndef PEGASUS_MATH_BATCHTRANSFORM_H
+#define PEGASUS_MATH_BATCHTRANSFORM_H
+
+#include "Pegasus/Math/Matrix.h"
+
+namespace Pegasus {
+namespace Math {
+
+
+//! Transform of points, dst = mat * (src.x, src.y, src.z, 1), x, y and z of the result stored
+//! (no division by w, for affine transforms)
+//! \param dst First destination point, 3 floats
+//! \param dstStride Size in bytes from one destination point to the next
+//! \param src First source point, 3 floats
+//! \param srcStride Size in bytes from one source point to the next
+//! \param count Number of points
+//! \param mat The 4x4 transform
+void TransformPoints(PFloat32 * dst, int dstStride, const PFloat32 * src, int srcStride, int count, Mat44In mat);
+
+//! Transform of homogeneous points, dst = mat * src, 4 components
+//! \param dst First destination point, 4 floats
+//! \param dstStride Size in bytes from one destination point to the next
+//! \param src First source point, 4 floats
+//! \param srcStride Size in bytes from one source point to the next
+//! \param count Number of points
+//! \param mat The 4x4 transform
+void TransformHomogeneousPoints(PFloat32 * dst, int dstStride, const PFloat32 * src, int srcStride, int count, Mat44In mat);
+
+//! Transform of normals, dst = mat * src
+//! \param dst First destination normal, 3 floats
+//! \param dstStride Size in bytes from one destination normal to the next
+//! \param src First source normal, 3 floats
+//! \param srcStride Size in bytes from one source normal to the next
+//! \param count Number of normals
+//! \param mat The normal transform (inverse transpose of the point transform)
+//! \param normalize True to renormalize the results (zero length normals are left untouched)
+void TransformNormals(PFloat32 * dst, int dstStride, const PFloat32 * src, int srcStride, int count, Mat33In mat, bool normalize);
+
+//! Transform of axis-aligned bounding boxes, dst = smallest box containing the transformed src box
+//! \param dst First destination box, 6 floats (min x, y, z then max x, y, z)
+//! \param dstStride Size in bytes from one destination box to the next
+//! \param src First source box, 6 floats (min x, y, z then max x, y, z)
+//! \param srcStride Size in bytes from one source box to the next
+//! \param count Number of boxes
+//! \param mat The 4x4 affine transform
+void TransformAabbs(PFloat32 * dst, int dstStride, const PFloat32 * src, int srcStride, int count, Mat44In mat);
+
+//----------------------------------------------------------------------------------------
+
+//! Transform of homogeneous points stored as 4 planes (x, y, z, w), dst = mat * src
+//! \param dst First destination point, in the x plane
+//! \param dstPitch Float count between two destination planes
+//! \param src First source point, in the x plane
+//! \param srcPitch Float count between two source planes
+//! \param count Number of points
+//! \param mat The 4x4 transform
+void TransformHomogeneousPointsSoa(PFloat32 * dst, int dstPitch, const PFloat32 * src, int srcPitch, int count, Mat44In mat);
+
+//! Transform of normals stored as 3 planes (x, y, z), dst = mat * src
+//! \param dst First destination normal, in the x plane
+//! \param dstPitch Float count between two destination planes
+//! \param src First source normal, in the x plane
+//! \param srcPitch Float count between two source planes
+//! \param count Number of normals
+//! \param mat The normal transform (inverse transpose of the point transform)
+//! \param normalize True to renormalize the results (zero length normals are left untouched)
+void TransformNormalsSoa(PFloat32 * dst, int dstPitch, const PFloat32 * src, int srcPitch, int count, Mat33In mat, bool normalize);
+
+
+}   // namespace Math
+}   // namespace Pegasus
+
+#endif    // PEGASUS_MATH_BATCHTRANSFORM_H
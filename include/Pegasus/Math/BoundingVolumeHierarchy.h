@@ -0,0 +1,227 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   BoundingVolumeHierarchy.h
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Dynamic bounding volume hierarchy over axis-aligned bounding boxes, for frustum culling,
+//!         ray picking and overlap queries. The tree is built with the surface area heuristic (SAH),
+//!         and refitted in place when only the boxes of the objects move.
+
+#ifndef PEGASUS_MATH_BOUNDINGVOLUMEHIERARCHY_H
+#define PEGASUS_MATH_BOUNDINGVOLUMEHIERARCHY_H
+
+#include "Pegasus/Math/AxisAlignedBoundingBox.h"
+#include "Pegasus/Math/Ray.h"
+
+namespace Pegasus {
+
+namespace Alloc
+{
+    class IAllocator;
+}
+
+namespace Math {
+
+
+//! Handle of an object of a bounding volume hierarchy, valid until the object is removed
+typedef int BvhObjectHandle;
+
+//! Invalid object handle
+const BvhObjectHandle INVALID_BVH_OBJECT = -1;
+
+//----------------------------------------------------------------------------------------
+
+//! Bounding volume hierarchy over the boxes of a set of objects (meshes, lights...).
+//! Objects are added, moved and removed at any time, then Update brings the tree up to date
+//! before the queries: adding or removing objects rebuilds the tree, moving them refits the
+//! boxes of the tree nodes above them, and the tree is rebuilt once the refits made it
+//! REBUILD_COST_RATIO times more expensive to traverse than after its last build.
+//! The objects are not inserted or removed one by one: any add or remove between two Updates
+//! costs one full build, O(N log N) in the total number of objects. Add and remove objects
+//! in batches (at load time, on scene changes), and keep the objects that come and go every
+//! frame in the tree, moving them with UpdateObject, which only costs a refit.
+//! The queries return the user data of the objects.
+class BoundingVolumeHierarchy
+{
+public:
+
+    //! Constructor
+    //! \param allocator Allocator of the objects and of the tree
+    explicit BoundingVolumeHierarchy(Alloc::IAllocator * allocator);
+
+    //! Destructor
+    ~BoundingVolumeHierarchy();
+
+    //------------------------------------------------------------------------------------
+
+    //! Add an object, in the tree after the next Update.
+    //! For batch use only: the next Update rebuilds the whole tree (see the class description)
+    //! \param box Bounding box of the object
+    //! \param userData Value returned by the queries for this object
+    //! \return Handle of the new object
+    BvhObjectHandle AddObject(const AxisAlignedBoundingBox & box, int userData);
+
+    //! Remove an object, out of the tree after the next Update.
+    //! For batch use only: the next Update rebuilds the whole tree (see the class description)
+    //! \param object Handle of the object to remove, invalid after this call
+    void RemoveObject(BvhObjectHandle object);
+
+    //! Move an object, refitted in the tree by the next Update
+    //! \param object Handle of the object to move
+    //! \param box New bounding box of the object
+    void UpdateObject(BvhObjectHandle object, const AxisAlignedBoundingBox & box);
+
+    //! Remove all the objects
+    void Clear();
+
+    //! Get the number of objects
+    //! \return Number of objects added and not removed
+    inline int GetObjectCount() const { return mObjectCount; }
+
+    //! Test if an object handle is valid
+    //! \param object Handle of the object
+    //! \return true if the object was added and not removed
+    inline bool IsObjectValid(BvhObjectHandle object) const
+        { return object >= 0 && object < mObjectSlotCount && mObjects[object].mLeaf != REMOVED_OBJECT; }
+
+    //! Get the user data of an object
+    //! \param object Handle of the object
+    //! \return User data given to AddObject
+    int GetUserData(BvhObjectHandle object) const;
+
+    //------------------------------------------------------------------------------------
+
+    //! Bring the tree up to date with the objects, by a build or a refit
+    void Update();
+
+    //! Build the tree of all the objects, splitting the nodes with the binned surface area heuristic
+    void Build();
+
+    //! Refit the boxes of the nodes above the objects moved since the last build or refit
+    void Refit();
+
+    //! Test if the tree is up to date with the objects (the queries require it)
+    //! \return true if no object was added, moved or removed since the last Update
+    inline bool IsUpToDate() const { return !mNeedsBuild && mRefitLeafCount == 0; }
+
+    //! Get the cost of the tree according to the surface area heuristic
+    //! \return Expected number of box tests of a query going through the whole tree
+    PFloat32 GetCost() const;
+
+    //! Get the number of nodes of the tree
+    //! \return Number of nodes (leaves included)
+    inline int GetNodeCount() const { return mNodeCount; }
+
+    //------------------------------------------------------------------------------------
+
+    //! Find the objects inside or intersecting a convex volume (a camera frustum)
+    //! \param results Receives the user data of the first maxResults objects found
+    //! \param maxResults Size of results
+    //! \param planes Planes of the volume, the inside being the back of the planes (see Plane::IsInBack)
+    //! \param planeCount Number of planes (<= 32)
+    //! \return Number of objects found, larger than maxResults when results is too small
+    int QueryFrustum(int * results, int maxResults, const Plane * planes, int planeCount) const;
+
+    //! Find the objects whose box overlaps a box
+    //! \param results Receives the user data of the first maxResults objects found
+    //! \param maxResults Size of results
+    //! \param box Box to test
+    //! \return Number of objects found, larger than maxResults when results is too small
+    int QueryOverlap(int * results, int maxResults, const AxisAlignedBoundingBox & box) const;
+
+    //! Find the first object box hit by a ray
+    //! \param userData Receives the user data of the object hit
+    //! \param distance Receives the distance from the ray origin to the box (0 if the origin is inside)
+    //! \param ray Ray to test
+    //! \param maxDistance Distance from the ray origin after which hits are ignored
+    //! \return true if a box was hit
+    bool QueryRay(int & userData, PFloat32 & distance, RayIn ray, PFloat32 maxDistance) const;
+
+    //------------------------------------------------------------------------------------
+
+    //! Maximum number of objects of a leaf
+    static const int MAX_LEAF_OBJECT_COUNT = 4;
+
+    //! Cost increase of the refits triggering a rebuild in Update
+    static const PFloat32 REBUILD_COST_RATIO;
+
+private:
+
+    PG_DISABLE_COPY(BoundingVolumeHierarchy);
+
+    //! Node of the tree. The objects of a node are contiguous in mLeafObjects, for inner nodes too.
+    struct Node
+    {
+        PFloat32 mMin[3];
+        PFloat32 mMax[3];
+        int mLeft;          //!< Index of the left child (the right one follows), -1 for leaves
+        int mParent;        //!< Index of the parent, -1 for the root
+        int mFirstObject;   //!< First entry of mLeafObjects
+        int mObjectCount;   //!< Number of entries of mLeafObjects
+        bool mRefitQueued;  //!< true when the leaf is in mRefitLeaves
+    };
+
+    //! Object of the tree
+    struct Object
+    {
+        PFloat32 mMin[3];
+        PFloat32 mMax[3];
+        int mUserData;
+        int mLeaf;          //!< Leaf containing the object, -1 when not in the tree, REMOVED_OBJECT when removed
+        int mNextFree;      //!< Next removed object, when removed
+    };
+
+    //! Value of Object::mLeaf for the removed objects
+    static const int REMOVED_OBJECT = -2;
+
+    //! Copy of the box of an object partitioned by the build
+    struct BuildObject
+    {
+        PFloat32 mMin[3];
+        PFloat32 mMax[3];
+        int mObject;
+    };
+
+    //! Recompute the box of a node from its children, or its objects for leaves
+    //! \param nodeIndex Index of the node
+    //! \return true if the box changed
+    bool RefitNode(int nodeIndex);
+
+    //! Cost weight of a node, multiplied by its area in the SAH cost
+    PFloat32 GetNodeCostWeight(const Node & node) const;
+
+    Alloc::IAllocator * mAllocator;
+
+    Object * mObjects;
+    int mObjectCapacity;
+    int mObjectSlotCount;       //!< Number of objects used in mObjects, removed ones included
+    int mObjectCount;
+    int mFreeObject;            //!< First removed object, -1 if none
+
+    Node * mNodes;
+    int mNodeCapacity;
+    int mNodeCount;
+
+    int * mLeafObjects;         //!< Objects of the leaves, leaf after leaf
+    int mLeafObjectCapacity;
+
+    BuildObject * mBuildObjects;
+    int mBuildObjectCapacity;
+
+    int * mRefitLeaves;         //!< Leaves of the objects moved since the last refit
+    int mRefitLeafCount;
+
+    PFloat64 mCostSum;          //!< Sum of the node areas multiplied by their cost weights
+    PFloat32 mBuildCost;        //!< GetCost after the last build
+    bool mNeedsBuild;
+};
+
+
+}   // namespace Math
+}   // namespace Pegasus
+
+#endif    // PEGASUS_MATH_BOUNDINGVOLUMEHIERARCHY_H
@@ -15,6 +15,7 @@
 #include "Pegasus/Math/Types.h"
 
 #include <cfloat>
+#include <limits>
 
 
 namespace Pegasus {
@@ -32,6 +33,12 @@ namespace Math {
 //! Maximum positive value (about 3e38)
 #define PFLOAT_MAX            FLT_MAX
 
+//! Positive infinity
+#define PFLOAT_INFINITY       (std::numeric_limits<float>::infinity())
+
+//! Quiet NaN, result of the functions called outside of their domain
+#define PFLOAT_NAN            (std::numeric_limits<float>::quiet_NaN())
+
 //----------------------------------------------------------------------------------------
 
 //@{
@@ -0,0 +1,65 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   FastMath.h
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Fast approximations of the transcendental functions of Scalar.h.
+//!         Each call site picks between the precise libm version (Sin, Cos, Exp, Log, Pow)
+//!         and the fast one (FastSin, FastCos, FastExp, FastLog, FastPow). The fast versions
+//!         run the polynomials of Simd.h on one lane, so they return the same values as the
+//!         4-wide SimdSin, SimdCos, SimdExp, SimdLog and SimdPow, with the errors documented there.
+//!         The scalar sine and cosine are several times faster than libm, but table driven libm
+//!         exp, log and pow can be as fast as the scalar approximations: check with
+//!         BENCHMARK_MathTranscendentals before switching such a call site, the 4-wide versions
+//!         being where those gain.
+
+#ifndef PEGASUS_MATH_FASTMATH_H
+#define PEGASUS_MATH_FASTMATH_H
+
+#include "Pegasus/Math/Scalar.h"
+#include "Pegasus/Math/Simd.h"
+
+namespace Pegasus {
+namespace Math {
+
+
+//! Fast sine of an angle, 3 ULP max error in [-pi, pi] (see SimdSin)
+//! \param angle Angle in radians
+//! \return Sine of the input angle (in [-1,1])
+inline PFloat32 FastSin(PFloat32 angle) { return SimdGetX(SimdSin(SimdSet1(angle))); }
+
+//! Fast cosine of an angle, 3 ULP max error in [-pi, pi] (see SimdCos)
+//! \param angle Angle in radians
+//! \return Cosine of the input angle (in [-1,1])
+inline PFloat32 FastCos(PFloat32 angle) { return SimdGetX(SimdCos(SimdSet1(angle))); }
+
+//! Fast exponential of a value, 1.5 ULP max error (see SimdExp)
+//! \param x Input value
+//! \return Exponential of x (>= 0)
+inline PFloat32 FastExp(PFloat32 x) { return SimdGetX(SimdExp(SimdSet1(x))); }
+
+//! Fast natural logarithm of a value, 1 ULP max error (see SimdLog)
+//! \param x Input value (> 0.0, not denormal)
+//! \return Natural logarithm of x
+inline PFloat32 FastLog(PFloat32 x) { PG_ASSERT(x >= PFLOAT_MIN); return SimdGetX(SimdLog(SimdSet1(x))); }
+
+//! Fast x raised to the power of y, 2 + 2 * |y * log(x)| ULP max error (see SimdPow).
+//! Negative bases are handled as by Pow: NaN for non integer exponents.
+//! \param x Base
+//! \param y Exponent (>= 0 if x = 0)
+//! \return x^y
+inline PFloat32 FastPow(PFloat32 x, PFloat32 y)
+{
+    if (x == 0.0f) { PG_ASSERT(y >= 0.0f); }
+    return SimdGetX(SimdPow(SimdSet1(x), SimdSet1(y)));
+}
+
+
+}   // namespace Math
+}   // namespace Pegasus
+
+#endif    // PEGASUS_MATH_FASTMATH_H
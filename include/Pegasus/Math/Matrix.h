@@ -13,6 +13,15 @@
 #define PEGASUS_MATH_MATRIX_H
 
 #include "Pegasus/Math/Vector.h"
+#include "Pegasus/Math/Simd.h"
+
+//! Set to 1 when the 4x4 matrix operations use the SIMD versions of MatrixSimd.h (inlined),
+//! 0 when they use the generic versions of Matrix.cpp
+#if (!PEGASUS_ARCH_IA32 || PEGASUS_MATH_FORCE_GENERIC) && PEGASUS_MATH_SIMD_SSE
+#define PEGASUS_MATH_MATRIX_SIMD    1
+#else
+#define PEGASUS_MATH_MATRIX_SIMD    0
+#endif
 
 namespace Pegasus {
 namespace Math {
@@ -320,7 +329,11 @@ void Mult33_31(Vec3InOut dst, Mat33In mat, Vec3In vec);
 //! \param mat The 4x4 matrix for the multiplication
 //! \param vec The 4D vector for the multiplication
 //! \param dst The resulting 4D vector
+#if PEGASUS_MATH_MATRIX_SIMD
+inline void Mult44_41(Vec4InOut dst, Mat44In mat, Vec4In vec);
+#else
 void Mult44_41(Vec4InOut dst, Mat44In mat, Vec4In vec);
+#endif
 
 //! Multiplication of a transposed matrix and a vector,
 //! and the result stored in an other vector
@@ -341,7 +354,11 @@ void Mult33T_31(Vec3InOut dst, Mat33In mat, Vec3In vec);
 //! \param mat The 4x4 transposed matrix for the multiplication
 //! \param vec The 4D vector for the multiplication
 //! \param dst The resulting 4D vector
+#if PEGASUS_MATH_MATRIX_SIMD
+inline void Mult44T_41(Vec4InOut dst, Mat44In mat, Vec4In vec);
+#else
 void Mult44T_41(Vec4InOut dst, Mat44In mat, Vec4In vec);
+#endif
 
 //! Multiplication between two matrices, and the result stored in an other matrix
 //! \param mat1 The first 2x2 matrix for the multiplication
@@ -359,7 +376,11 @@ void Mult33_33(Mat33InOut dst, Mat33In mat1, Mat33In mat2);
 //! \param mat1 The first 4x4 matrix for the multiplication
 //! \param mat2 The second 4x4 matrix for the multiplication
 //! \param dst The resulting 4x4 matrix (= mat1 * mat2)
+#if PEGASUS_MATH_MATRIX_SIMD
+inline void Mult44_44(Mat44InOut dst, Mat44In mat1, Mat44In mat2);
+#else
 void Mult44_44(Mat44InOut dst, Mat44In mat1, Mat44In mat2);
+#endif
 
 #endif    // PEGASUS_ARCH_IA32 && !PEGASUS_MATH_FORCE_GENERIC
 
@@ -619,4 +640,7 @@ inline Mat44Return operator - (Mat44In m1) { return Mat44(-m1.m11, -m1.m12, -m1.
 }   // namespace Math
 }   // namespace Pegasus
 
+// Inline SIMD implementation of the 4x4 operations
+#include "Pegasus/Math/MatrixSimd.h"
+
 #endif    // PEGASUS_MATH_MATRIX_H
@@ -0,0 +1,101 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MatrixSimd.h
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Matrix operations (with other matrices and vectors) (SIMD implementation).
+//!         Written on top of Simd.h, so the same code maps to SSE2, SSE4.1 and FMA, or to the
+//!         scalar fallback, depending on the target. Included by Matrix.h, the functions inline.
+
+#ifndef PEGASUS_MATH_MATRIXSIMD_H
+#define PEGASUS_MATH_MATRIXSIMD_H
+
+#include "Pegasus/Math/Matrix.h"
+#include "Pegasus/Math/Simd.h"
+
+namespace Pegasus {
+namespace Math {
+
+
+//! Multiplication of a matrix and a vector, and the result stored in an other vector
+//! (SIMD version)
+//! \param mat The 4x4 matrix for the multiplication
+//! \param vec The 4D vector for the multiplication
+//! \param dst The result 4D vector, can be vec
+inline void Mult44_41Simd(Vec4InOut dst, Mat44In mat, Vec4In vec)
+{
+    const SimdFloat4 v = SimdLoadU(vec.v);
+    SimdFloat4 p0 = SimdMul(SimdLoadU(&mat.m[0]), v);
+    SimdFloat4 p1 = SimdMul(SimdLoadU(&mat.m[4]), v);
+    SimdFloat4 p2 = SimdMul(SimdLoadU(&mat.m[8]), v);
+    SimdFloat4 p3 = SimdMul(SimdLoadU(&mat.m[12]), v);
+
+    // The sums of the rows, each one in its own lane
+    SimdTranspose4(p0, p1, p2, p3);
+    SimdStoreU(dst.v, SimdAdd(SimdAdd(p0, p1), SimdAdd(p2, p3)));
+}
+
+//! Multiplication of a transposed matrix and a vector,
+//! and the result stored in an other vector (SIMD version)
+//! \param mat The 4x4 transposed matrix for the multiplication
+//! \param vec The 4D vector for the multiplication
+//! \param dst The result 4D vector, can be vec
+inline void Mult44T_41Simd(Vec4InOut dst, Mat44In mat, Vec4In vec)
+{
+    const SimdFloat4 v = SimdLoadU(vec.v);
+    SimdFloat4 res = SimdMul(SimdLoadU(&mat.m[0]), SimdSwizzle<0, 0, 0, 0>(v));
+    res = SimdMulAdd(SimdLoadU(&mat.m[4]), SimdSwizzle<1, 1, 1, 1>(v), res);
+    res = SimdMulAdd(SimdLoadU(&mat.m[8]), SimdSwizzle<2, 2, 2, 2>(v), res);
+    res = SimdMulAdd(SimdLoadU(&mat.m[12]), SimdSwizzle<3, 3, 3, 3>(v), res);
+    SimdStoreU(dst.v, res);
+}
+
+//! Multiplication between two matrices, and the result stored in an other matrix
+//! (SIMD version)
+//! \param mat1 The first 4x4 matrix for the multiplication
+//! \param mat2 The second 4x4 matrix for the multiplication
+//! \param dst The resulting 4x4 matrix (= mat1 * mat2), can be mat1 or mat2
+inline void Mult44_44Simd(Mat44InOut dst, Mat44In mat1, Mat44In mat2)
+{
+    const SimdFloat4 b0 = SimdLoadU(&mat2.m[0]);
+    const SimdFloat4 b1 = SimdLoadU(&mat2.m[4]);
+    const SimdFloat4 b2 = SimdLoadU(&mat2.m[8]);
+    const SimdFloat4 b3 = SimdLoadU(&mat2.m[12]);
+
+    // Every input is read before the first store
+    SimdFloat4 rows[4];
+    for (int r = 0; r < 4; ++r)
+    {
+        const SimdFloat4 a = SimdLoadU(&mat1.m[4 * r]);
+        SimdFloat4 res = SimdMul(b0, SimdSwizzle<0, 0, 0, 0>(a));
+        res = SimdMulAdd(b1, SimdSwizzle<1, 1, 1, 1>(a), res);
+        res = SimdMulAdd(b2, SimdSwizzle<2, 2, 2, 2>(a), res);
+        rows[r] = SimdMulAdd(b3, SimdSwizzle<3, 3, 3, 3>(a), res);
+    }
+    for (int r = 0; r < 4; ++r)
+    {
+        SimdStoreU(&dst.m[4 * r], rows[r]);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+#if PEGASUS_MATH_MATRIX_SIMD
+
+// The 4x4 operations declared by Matrix.h use the SIMD versions
+
+inline void Mult44_41(Vec4InOut dst, Mat44In mat, Vec4In vec)       { Mult44_41Simd(dst, mat, vec); }
+inline void Mult44T_41(Vec4InOut dst, Mat44In mat, Vec4In vec)      { Mult44T_41Simd(dst, mat, vec); }
+inline void Mult44_44(Mat44InOut dst, Mat44In mat1, Mat44In mat2)   { Mult44_44Simd(dst, mat1, mat2); }
+
+#endif    // PEGASUS_MATH_MATRIX_SIMD
+
+
+}   // namespace Math
+}   // namespace Pegasus
+
+#endif    // PEGASUS_MATH_MATRIXSIMD_H
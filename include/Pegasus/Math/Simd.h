@@ -0,0 +1,501 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Simd.h
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  4-wide float SIMD abstraction, used by the batch (SoA) kernels and the matrix operations.
+//!         Maps to SSE2 intrinsics when available (SSE4.1 and FMA when the target enables them),
+//!         and to a plain scalar struct otherwise, so the code written on top of it stays portable.
+//!         When the target enables AVX, the 8-wide SimdFloat8 is available too, for the long loops.
+
+#ifndef PEGASUS_MATH_SIMD_H
+#define PEGASUS_MATH_SIMD_H
+
+#include "Pegasus/Math/Scalar.h"
+
+//! Set to 1 to use the scalar fallback on every target (to check it, or to compare against it)
+#ifndef PEGASUS_MATH_SIMD_FORCE_SCALAR
+#define PEGASUS_MATH_SIMD_FORCE_SCALAR      0
+#endif
+
+//! Set to 1 when the SSE2 path is available for the current target
+#if !PEGASUS_MATH_SIMD_FORCE_SCALAR && (defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)) || defined(__SSE2__))
+#define PEGASUS_MATH_SIMD_SSE               1
+#else
+#define PEGASUS_MATH_SIMD_SSE               0
+#endif
+
+//! Set to 1 when the target enables SSE4.1 (/arch:AVX and above with MSVC, -msse4.1 with gcc and clang)
+#if PEGASUS_MATH_SIMD_SSE && (defined(__SSE4_1__) || defined(__AVX__))
+#define PEGASUS_MATH_SIMD_SSE41             1
+#else
+#define PEGASUS_MATH_SIMD_SSE41             0
+#endif
+
+//! Set to 1 when the target enables the fused multiply-add (/arch:AVX2 with MSVC, -mfma with gcc and clang)
+#if PEGASUS_MATH_SIMD_SSE && (defined(__FMA__) || defined(__AVX2__))
+#define PEGASUS_MATH_SIMD_FMA               1
+#else
+#define PEGASUS_MATH_SIMD_FMA               0
+#endif
+
+//! Set to 1 when the target enables AVX (/arch:AVX and above with MSVC, -mavx with gcc and clang)
+#if PEGASUS_MATH_SIMD_SSE && defined(__AVX__)
+#define PEGASUS_MATH_SIMD_AVX               1
+#else
+#define PEGASUS_MATH_SIMD_AVX               0
+#endif
+
+#if PEGASUS_MATH_SIMD_SSE
+#include <emmintrin.h>
+#endif
+#if PEGASUS_MATH_SIMD_SSE41
+#include <smmintrin.h>
+#endif
+#if PEGASUS_MATH_SIMD_FMA || PEGASUS_MATH_SIMD_AVX
+#include <immintrin.h>
+#endif
+
+
+namespace Pegasus {
+namespace Math {
+
+//! Number of float lanes of a SimdFloat4
+const int SIMD_WIDTH = 4;
+
+#if PEGASUS_MATH_SIMD_SSE
+
+//! 4-wide float register
+typedef __m128 SimdFloat4;
+
+//! Loads 4 floats from 16 byte aligned memory
+inline SimdFloat4 SimdLoad(const PFloat32* src)                     { return _mm_load_ps(src); }
+
+//! Loads 4 floats from unaligned memory
+inline SimdFloat4 SimdLoadU(const PFloat32* src)                    { return _mm_loadu_ps(src); }
+
+//! Stores 4 floats to 16 byte aligned memory
+inline void SimdStore(PFloat32* dst, SimdFloat4 v)                  { _mm_store_ps(dst, v); }
+
+//! Stores 4 floats to unaligned memory
+inline void SimdStoreU(PFloat32* dst, SimdFloat4 v)                 { _mm_storeu_ps(dst, v); }
+
+//! Broadcasts a scalar to all lanes
+inline SimdFloat4 SimdSet1(PFloat32 s)                              { return _mm_set1_ps(s); }
+
+//! Builds a register from 4 scalars (x in lane 0)
+inline SimdFloat4 SimdSet(PFloat32 x, PFloat32 y, PFloat32 z, PFloat32 w) { return _mm_setr_ps(x, y, z, w); }
+
+inline SimdFloat4 SimdZero()                                        { return _mm_setzero_ps(); }
+inline SimdFloat4 SimdAdd(SimdFloat4 a, SimdFloat4 b)               { return _mm_add_ps(a, b); }
+inline SimdFloat4 SimdSub(SimdFloat4 a, SimdFloat4 b)               { return _mm_sub_ps(a, b); }
+inline SimdFloat4 SimdMul(SimdFloat4 a, SimdFloat4 b)               { return _mm_mul_ps(a, b); }
+inline SimdFloat4 SimdDiv(SimdFloat4 a, SimdFloat4 b)               { return _mm_div_ps(a, b); }
+inline SimdFloat4 SimdSqrt(SimdFloat4 a)                            { return _mm_sqrt_ps(a); }
+inline SimdFloat4 SimdMin(SimdFloat4 a, SimdFloat4 b)               { return _mm_min_ps(a, b); }
+inline SimdFloat4 SimdMax(SimdFloat4 a, SimdFloat4 b)               { return _mm_max_ps(a, b); }
+
+//! a * b + c, fused (one rounding) when the target has FMA
+#if PEGASUS_MATH_SIMD_FMA
+inline SimdFloat4 SimdMulAdd(SimdFloat4 a, SimdFloat4 b, SimdFloat4 c) { return _mm_fmadd_ps(a, b, c); }
+#else
+inline SimdFloat4 SimdMulAdd(SimdFloat4 a, SimdFloat4 b, SimdFloat4 c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+#endif
+
+//! Lane mask, all bits set where a > b
+inline SimdFloat4 SimdCmpGt(SimdFloat4 a, SimdFloat4 b)             { return _mm_cmpgt_ps(a, b); }
+
+//! Lane mask, all bits set where a == b
+inline SimdFloat4 SimdCmpEq(SimdFloat4 a, SimdFloat4 b)             { return _mm_cmpeq_ps(a, b); }
+
+//! Per lane select, returns a where mask is set, b otherwise
+inline SimdFloat4 SimdSelect(SimdFloat4 mask, SimdFloat4 a, SimdFloat4 b)
+{
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+//! Rounds each lane to the nearest integer (ties to even), returned as float
+inline SimdFloat4 SimdRound(SimdFloat4 a)                           { return _mm_cvtepi32_ps(_mm_cvtps_epi32(a)); }
+
+//! Returns -a where the matching lane of the rounded integer value r is odd, a otherwise
+inline SimdFloat4 SimdFlipSignIfOdd(SimdFloat4 a, SimdFloat4 r)
+{
+    __m128i oddBit = _mm_slli_epi32(_mm_cvtps_epi32(r), 31);
+    return _mm_xor_ps(a, _mm_castsi128_ps(oddBit));
+}
+
+//! Reorders the lanes, lane i of the result is lane Ii of a
+template <int I0, int I1, int I2, int I3>
+inline SimdFloat4 SimdSwizzle(SimdFloat4 a)                         { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(I3, I2, I1, I0)); }
+
+//! Returns lane 0
+inline PFloat32 SimdGetX(SimdFloat4 a)                              { return _mm_cvtss_f32(a); }
+
+//! Packs a lane mask in the 4 low bits of an integer, bit i set where lane i is set
+inline int SimdMoveMask(SimdFloat4 mask)                            { return _mm_movemask_ps(mask); }
+
+//! Dot product of the 4 lanes, broadcast to all lanes
+inline SimdFloat4 SimdDot4(SimdFloat4 a, SimdFloat4 b)
+{
+#if PEGASUS_MATH_SIMD_SSE41
+    return _mm_dp_ps(a, b, 0xFF);
+#else
+    const SimdFloat4 m = _mm_mul_ps(a, b);
+    const SimdFloat4 s = _mm_add_ps(m, SimdSwizzle<1, 0, 3, 2>(m));
+    return _mm_add_ps(s, SimdSwizzle<2, 3, 0, 1>(s));
+#endif
+}
+
+//! Transposes the 4x4 matrix made of 4 registers (one row per register)
+inline void SimdTranspose4(SimdFloat4& r0, SimdFloat4& r1, SimdFloat4& r2, SimdFloat4& r3)
+{
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+}
+
+//! Returns a * 2^n, n holding integer values in [-252, 254]
+inline SimdFloat4 SimdScaleByPow2(SimdFloat4 a, SimdFloat4 n)
+{
+    //two factors built in the exponent bits, so 2^n itself does not have to be a normal float
+    const __m128i bias = _mm_set1_epi32(127);
+    const __m128i n0 = _mm_cvtps_epi32(n);
+    const __m128i n1 = _mm_srai_epi32(n0, 1);
+    const SimdFloat4 p0 = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_sub_epi32(n0, n1), bias), 23));
+    const SimdFloat4 p1 = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n1, bias), 23));
+    return _mm_mul_ps(_mm_mul_ps(a, p0), p1);
+}
+
+//! Splits positive normal floats in a mantissa and an exponent, a = mantissa * 2^exponent
+//! \param a Values to split (> 0, not denormal)
+//! \param exponent Exponents, integer values
+//! \return Mantissas, in [0.5, 1)
+inline SimdFloat4 SimdFrexp(SimdFloat4 a, SimdFloat4& exponent)
+{
+    const __m128i bits = _mm_castps_si128(a);
+    exponent = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(126)));
+    return _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F000000)));
+}
+
+#if PEGASUS_MATH_SIMD_AVX
+
+//! Number of float lanes of a SimdFloat8
+const int SIMD_WIDTH8 = 8;
+
+//! 8-wide float register, two halves of 4 lanes. The arithmetic overloads the SimdFloat4 functions,
+//! the loads and broadcasts have an 8 suffix
+typedef __m256 SimdFloat8;
+
+//! Loads 8 floats from unaligned memory
+inline SimdFloat8 SimdLoadU8(const PFloat32* src)                   { return _mm256_loadu_ps(src); }
+
+//! Stores 8 floats to unaligned memory
+inline void SimdStoreU(PFloat32* dst, SimdFloat8 v)                 { _mm256_storeu_ps(dst, v); }
+
+//! Broadcasts a scalar to all lanes
+inline SimdFloat8 SimdSet1_8(PFloat32 s)                            { return _mm256_set1_ps(s); }
+
+//! Builds a register from two halves (lo in lanes 0 to 3)
+inline SimdFloat8 SimdCombine(SimdFloat4 lo, SimdFloat4 hi)         { return _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1); }
+
+//! Returns lanes 0 to 3
+inline SimdFloat4 SimdGetLow(SimdFloat8 a)                          { return _mm256_castps256_ps128(a); }
+
+//! Returns lanes 4 to 7
+inline SimdFloat4 SimdGetHigh(SimdFloat8 a)                         { return _mm256_extractf128_ps(a, 1); }
+
+inline SimdFloat8 SimdAdd(SimdFloat8 a, SimdFloat8 b)               { return _mm256_add_ps(a, b); }
+inline SimdFloat8 SimdSub(SimdFloat8 a, SimdFloat8 b)               { return _mm256_sub_ps(a, b); }
+inline SimdFloat8 SimdMul(SimdFloat8 a, SimdFloat8 b)               { return _mm256_mul_ps(a, b); }
+inline SimdFloat8 SimdDiv(SimdFloat8 a, SimdFloat8 b)               { return _mm256_div_ps(a, b); }
+inline SimdFloat8 SimdSqrt(SimdFloat8 a)                            { return _mm256_sqrt_ps(a); }
+inline SimdFloat8 SimdMin(SimdFloat8 a, SimdFloat8 b)               { return _mm256_min_ps(a, b); }
+inline SimdFloat8 SimdMax(SimdFloat8 a, SimdFloat8 b)               { return _mm256_max_ps(a, b); }
+
+//! a * b + c, fused (one rounding) when the target has FMA
+#if PEGASUS_MATH_SIMD_FMA
+inline SimdFloat8 SimdMulAdd(SimdFloat8 a, SimdFloat8 b, SimdFloat8 c) { return _mm256_fmadd_ps(a, b, c); }
+#else
+inline SimdFloat8 SimdMulAdd(SimdFloat8 a, SimdFloat8 b, SimdFloat8 c) { return _mm256_add_ps(_mm256_mul_ps(a, b), c); }
+#endif
+
+//! Lane mask, all bits set where a > b
+inline SimdFloat8 SimdCmpGt(SimdFloat8 a, SimdFloat8 b)             { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+
+//! Per lane select, returns a where mask is set, b otherwise
+inline SimdFloat8 SimdSelect(SimdFloat8 mask, SimdFloat8 a, SimdFloat8 b) { return _mm256_blendv_ps(b, a, mask); }
+
+//! Transposes the two 4x4 matrices made of 4 registers (one row per register), one per half
+inline void SimdTranspose4(SimdFloat8& r0, SimdFloat8& r1, SimdFloat8& r2, SimdFloat8& r3)
+{
+    const SimdFloat8 t0 = _mm256_unpacklo_ps(r0, r1);
+    const SimdFloat8 t1 = _mm256_unpackhi_ps(r0, r1);
+    const SimdFloat8 t2 = _mm256_unpacklo_ps(r2, r3);
+    const SimdFloat8 t3 = _mm256_unpackhi_ps(r2, r3);
+    r0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+    r1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+    r2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    r3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+}
+
+#endif  // PEGASUS_MATH_SIMD_AVX
+
+#else
+
+//! 4-wide float register, scalar fallback
+struct SimdFloat4
+{
+    PFloat32 v[4];
+};
+
+inline SimdFloat4 SimdSet(PFloat32 x, PFloat32 y, PFloat32 z, PFloat32 w) { SimdFloat4 r; r.v[0] = x; r.v[1] = y; r.v[2] = z; r.v[3] = w; return r; }
+inline SimdFloat4 SimdLoad(const PFloat32* src)                     { return SimdSet(src[0], src[1], src[2], src[3]); }
+inline SimdFloat4 SimdLoadU(const PFloat32* src)                    { return SimdLoad(src); }
+inline void SimdStore(PFloat32* dst, SimdFloat4 a)                  { dst[0] = a.v[0]; dst[1] = a.v[1]; dst[2] = a.v[2]; dst[3] = a.v[3]; }
+inline void SimdStoreU(PFloat32* dst, SimdFloat4 a)                 { SimdStore(dst, a); }
+inline SimdFloat4 SimdSet1(PFloat32 s)                              { return SimdSet(s, s, s, s); }
+inline SimdFloat4 SimdZero()                                        { return SimdSet1(0.0f); }
+
+#define PEGASUS_SIMD_SCALAR_OP(name, expr) \
+    inline SimdFloat4 name(SimdFloat4 a, SimdFloat4 b) { SimdFloat4 r; for (int i = 0; i < 4; ++i) { r.v[i] = (expr); } return r; }
+
+PEGASUS_SIMD_SCALAR_OP(SimdAdd, a.v[i] + b.v[i])
+PEGASUS_SIMD_SCALAR_OP(SimdSub, a.v[i] - b.v[i])
+PEGASUS_SIMD_SCALAR_OP(SimdMul, a.v[i] * b.v[i])
+PEGASUS_SIMD_SCALAR_OP(SimdDiv, a.v[i] / b.v[i])
+PEGASUS_SIMD_SCALAR_OP(SimdMin, a.v[i] < b.v[i] ? a.v[i] : b.v[i])
+PEGASUS_SIMD_SCALAR_OP(SimdMax, a.v[i] > b.v[i] ? a.v[i] : b.v[i])
+PEGASUS_SIMD_SCALAR_OP(SimdCmpGt, a.v[i] > b.v[i] ? 1.0f : 0.0f)
+PEGASUS_SIMD_SCALAR_OP(SimdCmpEq, a.v[i] == b.v[i] ? 1.0f : 0.0f)
+
+#undef PEGASUS_SIMD_SCALAR_OP
+
+inline SimdFloat4 SimdSqrt(SimdFloat4 a)                            { SimdFloat4 r; for (int i = 0; i < 4; ++i) { r.v[i] = Sqrt(a.v[i]); } return r; }
+inline SimdFloat4 SimdMulAdd(SimdFloat4 a, SimdFloat4 b, SimdFloat4 c) { return SimdAdd(SimdMul(a, b), c); }
+
+//! Per lane select, the scalar fallback encodes the mask as 1.0f / 0.0f
+inline SimdFloat4 SimdSelect(SimdFloat4 mask, SimdFloat4 a, SimdFloat4 b)
+{
+    SimdFloat4 r;
+    for (int i = 0; i < 4; ++i) { r.v[i] = mask.v[i] != 0.0f ? a.v[i] : b.v[i]; }
+    return r;
+}
+
+//! From 2^23 on every float is an integer, and a + 0.5 would round up to the next one
+inline SimdFloat4 SimdRound(SimdFloat4 a)
+{
+    SimdFloat4 r;
+    for (int i = 0; i < 4; ++i) { r.v[i] = (Abs(a.v[i]) < 8388608.0f) ? Floor(a.v[i] + 0.5f) : a.v[i]; }
+    return r;
+}
+
+inline SimdFloat4 SimdFlipSignIfOdd(SimdFloat4 a, SimdFloat4 r)
+{
+    SimdFloat4 res;
+    for (int i = 0; i < 4; ++i) { res.v[i] = (static_cast<int>(r.v[i]) & 1) ? -a.v[i] : a.v[i]; }
+    return res;
+}
+
+template <int I0, int I1, int I2, int I3>
+inline SimdFloat4 SimdSwizzle(SimdFloat4 a)                         { return SimdSet(a.v[I0], a.v[I1], a.v[I2], a.v[I3]); }
+
+inline PFloat32 SimdGetX(SimdFloat4 a)                              { return a.v[0]; }
+
+inline int SimdMoveMask(SimdFloat4 mask)
+{
+    return (mask.v[0] != 0.0f ? 1 : 0) | (mask.v[1] != 0.0f ? 2 : 0) | (mask.v[2] != 0.0f ? 4 : 0) | (mask.v[3] != 0.0f ? 8 : 0);
+}
+
+inline SimdFloat4 SimdDot4(SimdFloat4 a, SimdFloat4 b)
+{
+    return SimdSet1(a.v[0] * b.v[0] + a.v[1] * b.v[1] + a.v[2] * b.v[2] + a.v[3] * b.v[3]);
+}
+
+inline void SimdTranspose4(SimdFloat4& r0, SimdFloat4& r1, SimdFloat4& r2, SimdFloat4& r3)
+{
+    const SimdFloat4 c0 = SimdSet(r0.v[0], r1.v[0], r2.v[0], r3.v[0]);
+    const SimdFloat4 c1 = SimdSet(r0.v[1], r1.v[1], r2.v[1], r3.v[1]);
+    const SimdFloat4 c2 = SimdSet(r0.v[2], r1.v[2], r2.v[2], r3.v[2]);
+    r3 = SimdSet(r0.v[3], r1.v[3], r2.v[3], r3.v[3]);
+    r0 = c0;
+    r1 = c1;
+    r2 = c2;
+}
+
+inline SimdFloat4 SimdScaleByPow2(SimdFloat4 a, SimdFloat4 n)
+{
+    SimdFloat4 r;
+    for (int i = 0; i < 4; ++i) { r.v[i] = ldexpf(a.v[i], static_cast<int>(n.v[i])); }
+    return r;
+}
+
+inline SimdFloat4 SimdFrexp(SimdFloat4 a, SimdFloat4& exponent)
+{
+    SimdFloat4 r;
+    for (int i = 0; i < 4; ++i)
+    {
+        int e;
+        r.v[i] = frexpf(a.v[i], &e);
+        exponent.v[i] = static_cast<PFloat32>(e);
+    }
+    return r;
+}
+
+#endif  // PEGASUS_MATH_SIMD_SSE
+
+//----------------------------------------------------------------------------------------
+
+// Transcendental function approximations.
+// Bounded error polynomial evaluations, the fast alternative to the libm calls of Scalar.h
+// (see FastMath.h for the scalar versions). The errors are measured against the double precision
+// libm over the input ranges by BENCHMARK_MathTranscendentalAccuracy, in units in the last place (ULP)
+// of the float result. The SSE, FMA and scalar fallback paths measure the same.
+
+//! Sine of angles in [-pi/2, pi/2], degree 11 odd polynomial
+inline SimdFloat4 SimdSinKernel(SimdFloat4 r)
+{
+    const SimdFloat4 r2 = SimdMul(r, r);
+    SimdFloat4 p = SimdSet1(-2.3889859e-08f);
+    p = SimdMulAdd(p, r2, SimdSet1( 2.7525562880444e-06f));
+    p = SimdMulAdd(p, r2, SimdSet1(-1.9840874911464783e-04f));
+    p = SimdMulAdd(p, r2, SimdSet1( 8.333329385889463e-03f));
+    p = SimdMulAdd(p, r2, SimdSet1(-1.6666666641626524e-01f));
+    return SimdMulAdd(SimdMul(p, r2), r, r);
+}
+
+//! Subtracts q * pi from x in three steps (Cody-Waite), the first two parts of pi
+//! having few enough bits for their products with q to be exact while |q| < 2^11
+inline SimdFloat4 SimdReducePi(SimdFloat4 x, SimdFloat4 q)
+{
+    SimdFloat4 r = SimdSub(x, SimdMul(q, SimdSet1(3.140625f)));
+    r = SimdSub(r, SimdMul(q, SimdSet1(9.675025939941406e-4f)));
+    return SimdSub(r, SimdMul(q, SimdSet1(1.5099580252808664e-7f)));
+}
+
+//! 4-wide sine approximation.
+//! The argument is reduced to [-pi/2, pi/2] around the nearest multiple of pi, then evaluated
+//! with a degree 11 odd polynomial. Max error is 3 ULP in [-pi, pi] and 8 ULP in [-100, 100].
+//! Further out the absolute error stays below 1.5e-7 up to |x| = 8192, the relative error
+//! growing only next to the zeros.
+//! \param x angles in radians
+//! \return sin(x) per lane
+inline SimdFloat4 SimdSin(SimdFloat4 x)
+{
+    const SimdFloat4 q = SimdRound(SimdMul(x, SimdSet1(P_1_OVER_PI)));
+
+    //sin(r + q*pi) = (-1)^q * sin(r)
+    return SimdSinKernel(SimdFlipSignIfOdd(SimdReducePi(x, q), q));
+}
+
+//! 4-wide cosine approximation.
+//! The argument is reduced to [-pi/2, pi/2] around the nearest odd multiple of pi/2,
+//! then evaluated with the polynomial of SimdSin. Same error as SimdSin.
+//! \param x angles in radians
+//! \return cos(x) per lane
+inline SimdFloat4 SimdCos(SimdFloat4 x)
+{
+    const SimdFloat4 q = SimdRound(SimdSub(SimdMul(x, SimdSet1(P_1_OVER_PI)), SimdSet1(0.5f)));
+
+    //cos(r + (q + 1/2)*pi) = -(-1)^q * sin(r), q + 1/2 keeping the reduction exact
+    const SimdFloat4 r = SimdReducePi(x, SimdAdd(q, SimdSet1(0.5f)));
+    return SimdSinKernel(SimdFlipSignIfOdd(SimdSub(SimdZero(), r), q));
+}
+
+//! 4-wide exponential approximation.
+//! x = n*ln(2) + r with |r| <= ln(2)/2, exp(r) from a degree 7 polynomial, then scaled by 2^n.
+//! Max error is 1.5 ULP. Results over FLT_MAX return +inf, results under FLT_MIN go through the
+//! denormals to 0.
+//! \param x exponents
+//! \return e^x per lane
+inline SimdFloat4 SimdExp(SimdFloat4 x)
+{
+    //past these bounds the result is +inf or 0 anyway, and 2^n stays in the range of SimdScaleByPow2
+    x = SimdMin(SimdMax(x, SimdSet1(-104.0f)), SimdSet1(89.0f));
+    const SimdFloat4 n = SimdRound(SimdMul(x, SimdSet1(1.44269504088896341f)));
+
+    //ln(2) split in a high part exactly representable and a low correction part
+    SimdFloat4 r = SimdSub(x, SimdMul(n, SimdSet1(0.693359375f)));
+    r = SimdSub(r, SimdMul(n, SimdSet1(-2.12194440e-4f)));
+
+    const SimdFloat4 r2 = SimdMul(r, r);
+    SimdFloat4 p = SimdSet1(1.9875691500e-4f);
+    p = SimdMulAdd(p, r, SimdSet1(1.3981999507e-3f));
+    p = SimdMulAdd(p, r, SimdSet1(8.3334519073e-3f));
+    p = SimdMulAdd(p, r, SimdSet1(4.1665795894e-2f));
+    p = SimdMulAdd(p, r, SimdSet1(1.6666665459e-1f));
+    p = SimdMulAdd(p, r, SimdSet1(5.0000001201e-1f));
+    p = SimdAdd(SimdMulAdd(p, r2, r), SimdSet1(1.0f));
+    return SimdScaleByPow2(p, n);
+}
+
+//! 4-wide natural logarithm approximation.
+//! x = m * 2^e with m in [sqrt(2)/2, sqrt(2)), log(m) from a degree 10 polynomial of m - 1.
+//! Max error is 1 ULP.
+//! \param x values, positive normal floats (no zero, denormal, infinite or NaN inputs)
+//! \return log(x) per lane
+inline SimdFloat4 SimdLog(SimdFloat4 x)
+{
+    SimdFloat4 e;
+    SimdFloat4 m = SimdFrexp(x, e);
+
+    //m in [0.5, 1) to [sqrt(2)/2, sqrt(2)) - 1
+    const SimdFloat4 one = SimdSet1(1.0f);
+    const SimdFloat4 isLow = SimdCmpGt(SimdSet1(P_1_OVER_SQRT_2), m);
+    e = SimdSub(e, SimdSelect(isLow, one, SimdZero()));
+    m = SimdSub(SimdAdd(m, SimdSelect(isLow, m, SimdZero())), one);
+
+    const SimdFloat4 m2 = SimdMul(m, m);
+    SimdFloat4 p = SimdSet1(7.0376836292e-2f);
+    p = SimdMulAdd(p, m, SimdSet1(-1.1514610310e-1f));
+    p = SimdMulAdd(p, m, SimdSet1( 1.1676998740e-1f));
+    p = SimdMulAdd(p, m, SimdSet1(-1.2420140846e-1f));
+    p = SimdMulAdd(p, m, SimdSet1( 1.4249322787e-1f));
+    p = SimdMulAdd(p, m, SimdSet1(-1.6668057665e-1f));
+    p = SimdMulAdd(p, m, SimdSet1( 2.0000714765e-1f));
+    p = SimdMulAdd(p, m, SimdSet1(-2.4999993993e-1f));
+    p = SimdMulAdd(p, m, SimdSet1( 3.3333331174e-1f));
+    p = SimdMul(SimdMul(p, m), m2);
+
+    //ln(2) split as in SimdExp, the small terms first
+    p = SimdMulAdd(e, SimdSet1(-2.12194440e-4f), p);
+    p = SimdMulAdd(m2, SimdSet1(-0.5f), p);
+    return SimdMulAdd(e, SimdSet1(0.693359375f), SimdAdd(m, p));
+}
+
+//! 4-wide power approximation, exp(y * log(|x|)) with the special cases of powf.
+//! The error of log(x) is scaled by y, so the max error grows with |y * log(x)|:
+//! below 2 + 2 * |y * log(x)| ULP.
+//! As powf, a negative base gives a negative result for odd integer exponents
+//! and NaN for non integer exponents, a zero base gives 1 for a zero exponent,
+//! 0 for a positive one and +infinity for a negative one (powf gives -0 and
+//! -infinity for -0 and odd exponents, the sign of zero is ignored here).
+//! \param x bases, normal floats or 0
+//! \param y finite exponents
+//! \return x^y per lane
+inline SimdFloat4 SimdPow(SimdFloat4 x, SimdFloat4 y)
+{
+    const SimdFloat4 zero = SimdZero();
+    const SimdFloat4 absX = SimdMax(x, SimdSub(zero, x));
+    const SimdFloat4 isNonZero = SimdCmpGt(absX, zero);
+    const SimdFloat4 safeX = SimdSelect(isNonZero, absX, SimdSet1(1.0f));
+    SimdFloat4 r = SimdExp(SimdMul(y, SimdLog(safeX)));
+
+    //negative bases, every float from 2^24 on is an even integer, clamped there to round in the int range
+    const SimdFloat4 maxOddY = SimdSet1(16777216.0f);
+    const SimdFloat4 clampedY = SimdMax(SimdMin(y, maxOddY), SimdSub(zero, maxOddY));
+    const SimdFloat4 roundedY = SimdRound(clampedY);
+    const SimdFloat4 signedR = SimdSelect(SimdCmpEq(roundedY, clampedY), SimdFlipSignIfOdd(r, roundedY), SimdSet1(PFLOAT_NAN));
+    r = SimdSelect(SimdCmpGt(zero, x), signedR, r);
+
+    //zero bases
+    const SimdFloat4 zeroBaseR = SimdSelect(SimdCmpGt(y, zero), zero,
+                                            SimdSelect(SimdCmpGt(zero, y), SimdSet1(PFLOAT_INFINITY), SimdSet1(1.0f)));
+    return SimdSelect(isNonZero, r, zeroBaseR);
+}
+
+}   // namespace Math
+}   // namespace Pegasus
+
+#endif  // PEGASUS_MATH_SIMD_H
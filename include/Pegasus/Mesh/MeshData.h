@@ -29,6 +29,37 @@ struct StdVertex {
     Math::Vec2 uv; 
 };
 
+//! Float planes of a StdVertex stream, when accessed in structure-of-arrays layout.
+//! Plane c of a stream starts at GetSoaStream(stream) + c * GetSoaPitch()
+enum StdVertexSoaComponent
+{
+    STDVERTEX_SOA_POSITION_X = 0,
+    STDVERTEX_SOA_POSITION_Y,
+    STDVERTEX_SOA_POSITION_Z,
+    STDVERTEX_SOA_POSITION_W,
+    STDVERTEX_SOA_NORMAL_X,
+    STDVERTEX_SOA_NORMAL_Y,
+    STDVERTEX_SOA_NORMAL_Z,
+    STDVERTEX_SOA_UV_X,
+    STDVERTEX_SOA_UV_Y,
+    STDVERTEX_SOA_COMPONENT_COUNT
+};
+
+//! Number of vertices (or indices) per chunk when mesh nodes split their work with Core::ParallelFor
+const int MESH_PARALLEL_GRAIN_SIZE = 4096;
+
+//! Maximum number of levels of detail of a mesh
+const int MESH_MAX_LODS = 8;
+
+//! Level of detail of a mesh, a range of its index buffer. All the levels share the vertex streams.
+struct MeshLod
+{
+    int mIndexOffset;       //!< first index of the level
+    int mIndexCount;        //!< number of indices of the level
+    float mMaxScreenSize;   //!< largest screen size the level can be used at, as the projected diameter of the
+                            //!< bounding sphere over the viewport height
+};
+
 //! Mesh node data, used by all mesh nodes, including generators and operators
 class MeshData : public Graph::NodeData
 {
@@ -47,17 +78,48 @@ public:
 
     Graph::Node::Mode GetMode() const { return mMode; }
 
-    //! Gets the stream, casted properly
+    //! Gets the stream in interleaved layout, casted properly, for writing.
     //! \param streamId the id of the stream
     //! \return the actual stream memory
+    //! \note invalidates the structure-of-arrays copy of the vertices
     template <class T> 
     T * GetStream(int streamId);    
     
-    //! Gets the stream, as a void pointer
+    //! Gets the stream in interleaved layout, as a void pointer, for writing.
     //! \param streamId the id of the stream
     //! \return the actual stream memory
+    //! \note invalidates the structure-of-arrays copy of the vertices
     template <> void * GetStream(int streamId);    
 
+    //! Gets the stream in interleaved layout, casted properly, for reading only.
+    //! This is the layout the GPU consumes, use this when uploading.
+    //! \param streamId the id of the stream
+    //! \return the actual stream memory
+    template <class T> 
+    const T * GetConstStream(int streamId);    
+
+    //! Gets the stream in interleaved layout, as a void pointer, for reading only.
+    //! \param streamId the id of the stream
+    //! \return the actual stream memory
+    template <> const void * GetConstStream(int streamId);    
+
+    //! Gets the stream in structure-of-arrays layout, for writing.
+    //! Every 4 byte component of the vertex gets its own plane of GetSoaPitch() floats.
+    //! Lanes past the vertex count are padding, so kernels can always read full SIMD width.
+    //! \param streamId the id of the stream
+    //! \return the first plane of the stream
+    //! \note invalidates the interleaved copy of the vertices, it gets rebuilt on the next interleaved access
+    float * GetSoaStream(int streamId);
+
+    //! Gets the stream in structure-of-arrays layout, for reading only.
+    //! \param streamId the id of the stream
+    //! \return the first plane of the stream
+    const float * GetConstSoaStream(int streamId);
+
+    //! Gets the float count between two consecutive planes of a structure-of-arrays stream.
+    //! Always a multiple of 8.
+    int GetSoaPitch() const { return (mVertexCount + 7) & ~7; }
+
     //! Pushes (and does respective allocations) a vertex element
     //! \param vertex the vertex structure to push
     //! \param streamId the target stream to set this vertex element to
@@ -98,6 +160,28 @@ public:
     //! \param count the number of indices to allocate
     void AllocateIndexes(int count);
 
+    //! Sets the number of levels of detail, their ranges have to be filled with EditLod().
+    //! Level 0 is the most detailed one. 0 levels means the whole index buffer is a single level.
+    //! \param count number of levels, up to MESH_MAX_LODS
+    void SetLodCount(int count);
+
+    //! Gets the number of levels of detail
+    //! \return the number of levels, 0 if the mesh has no level of detail chain
+    int GetLodCount() const { return mLodCount; }
+
+    //! Gets a level of detail, for reading
+    //! \param lod the level, from 0 to GetLodCount() - 1
+    const MeshLod& GetLod(int lod) const { PG_ASSERT(lod >= 0 && lod < mLodCount); return mLods[lod]; }
+
+    //! Gets a level of detail, for writing
+    //! \param lod the level, from 0 to GetLodCount() - 1
+    MeshLod& EditLod(int lod) { PG_ASSERT(lod >= 0 && lod < mLodCount); return mLods[lod]; }
+
+    //! Selects the coarsest level of detail that can be used at a screen size
+    //! \param screenSize projected diameter of the bounding sphere of the mesh over the viewport height
+    //! \return the selected level, 0 if the mesh has no level of detail chain
+    int SelectLod(float screenSize) const;
+
     //! Destroys all internal data and initializes this mesh data as completely new
     void Clear();
     
@@ -133,6 +217,12 @@ private:
     //!        the new buffer
     void InternalAllocateIndexes(int count, bool preserveElements);
 
+    //! Rebuilds the interleaved streams from the structure-of-arrays streams if they are stale
+    void EnsureInterleavedStreams();
+
+    //! Rebuilds the structure-of-arrays streams from the interleaved streams if they are stale
+    void EnsureSoaStreams();
+
     //!helper class, encoding a stream buffer of bytes
     class Stream
     {
@@ -177,9 +267,18 @@ private:
     //! Configuration of the mesh data
     MeshConfiguration mConfiguration;
 
-    //! Stream list of this mesh
+    //! Stream list of this mesh, interleaved layout
     Stream  mVertexStreams[MESH_MAX_STREAMS];
 
+    //! Stream list of this mesh, structure-of-arrays layout. Allocated on first use.
+    Stream  mSoaStreams[MESH_MAX_STREAMS];
+
+    //! true if mVertexStreams holds the latest vertices
+    bool mInterleavedValid;
+
+    //! true if mSoaStreams holds the latest vertices
+    bool mSoaValid;
+
     //! the index buffer of this mesh
     Stream  mIndexBuffer;
     
@@ -189,6 +288,12 @@ private:
     //! total count of indices
     int mIndexCount;
 
+    //! levels of detail, ranges of the index buffer
+    MeshLod mLods[MESH_MAX_LODS];
+
+    //! count of levels of detail, 0 when the mesh has no chain
+    int mLodCount;
+
     // mode of mesh data.
     Graph::Node::Mode mMode;
 };
@@ -198,12 +303,31 @@ template<class T>
 T * MeshData::GetStream(int streamId)
 {
     PG_ASSERTSTR(sizeof(T) == mVertexStreams[streamId].GetStride(), "stream strides must match!");
+    EnsureInterleavedStreams();
+    mSoaValid = false;
     return static_cast<T*>(mVertexStreams[streamId].GetBuffer());
 }
 
 template<>
 void * MeshData::GetStream(int stream)
 {
+    EnsureInterleavedStreams();
+    mSoaValid = false;
+    return (mVertexStreams[stream].GetBuffer());
+}
+
+template<class T>
+const T * MeshData::GetConstStream(int streamId)
+{
+    PG_ASSERTSTR(sizeof(T) == mVertexStreams[streamId].GetStride(), "stream strides must match!");
+    EnsureInterleavedStreams();
+    return static_cast<const T*>(mVertexStreams[streamId].GetBuffer());
+}
+
+template<>
+const void * MeshData::GetConstStream(int stream)
+{
+    EnsureInterleavedStreams();
     return (mVertexStreams[stream].GetBuffer());
 }
 
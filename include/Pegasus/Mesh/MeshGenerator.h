@@ -13,6 +13,7 @@
 #define PEGASUS_MESH_MESHGENERATOR_H
 
 #include "Pegasus/Core/Ref.h"
+#include "Pegasus/Core/ParallelFor.h"
 #include "Pegasus/Graph/GeneratorNode.h"
 #include "Pegasus/Mesh/Shared/MeshEvent.h"
 #include "Pegasus/Mesh/MeshConfiguration.h"
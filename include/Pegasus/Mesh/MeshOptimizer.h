@@ -0,0 +1,84 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MeshOptimizer.h
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Index and vertex buffer optimizations for indexed triangle list meshes:
+//!         vertex welding, post-transform vertex cache ordering (Tipsify) and
+//!         pre-transform vertex fetch ordering.
+
+#ifndef PEGASUS_MESH_MESHOPTIMIZER_H
+#define PEGASUS_MESH_MESHOPTIMIZER_H
+
+#include "Pegasus/Allocator/IAllocator.h"
+
+namespace Pegasus {
+namespace Mesh {
+
+struct StdVertex;
+
+//! Default post-transform vertex cache size used to order and measure triangles
+const int MESH_DEFAULT_VERTEX_CACHE_SIZE = 16;
+
+//! Finds vertices that are equal within tolerances, using a spatial hash of the positions.
+//! Two vertices are welded when their positions, normals and uvs are respectively no more than
+//! posTolerance, normalTolerance and uvTolerance apart on every axis.
+//! The first vertex of a welded group represents the group.
+//! \param vertices vertex list
+//! \param vertexCount number of vertices
+//! \param posTolerance position tolerance, must be greater than 0
+//! \param normalTolerance normal tolerance
+//! \param uvTolerance uv tolerance
+//! \param remap output, vertexCount elements. remap[v] is the index of the vertex representing v (remap[v] <= v)
+//! \param allocator allocator for the temporary hash table
+//! \return number of unique vertices
+int WeldStdVertices(const StdVertex* vertices, int vertexCount,
+                    float posTolerance, float normalTolerance, float uvTolerance,
+                    int* remap, Alloc::IAllocator* allocator);
+
+//! Removes the triangles using the same vertex more than once, preserving the order of the others
+//! \param indices triangle list, compacted in place
+//! \param indexCount number of indices, multiple of 3
+//! \return new number of indices
+int RemoveDegenerateTriangles(unsigned short* indices, int indexCount);
+
+//! Reorders the triangles of a triangle list for post-transform vertex cache efficiency,
+//! using Tipsify (Sander, Nehab and Barczak, "Fast Triangle Reordering for Vertex Locality
+//! and Reduced Overdraw", 2007). Runs in linear time on the index count.
+//! \param indices source triangle list
+//! \param indexCount number of indices, multiple of 3
+//! \param vertexCount number of vertices referenced by indices
+//! \param cacheSize target vertex cache size
+//! \param outIndices output triangle list, indexCount elements, must not alias indices
+//! \param allocator allocator for the temporary adjacency data
+void OptimizeVertexCache(const unsigned short* indices, int indexCount, int vertexCount, int cacheSize,
+                         unsigned short* outIndices, Alloc::IAllocator* allocator);
+
+//! Renumbers the vertices in the order they are first used by the index buffer, so vertex fetches
+//! walk the vertex buffer mostly forward. Unreferenced vertices are dropped.
+//! \param indices triangle list, renumbered in place
+//! \param indexCount number of indices
+//! \param vertexCount number of vertices referenced by indices
+//! \param remap output, vertexCount elements. remap[v] is the new index of vertex v, or -1 if unused
+//! \return number of referenced vertices
+int OptimizeVertexFetch(unsigned short* indices, int indexCount, int vertexCount, int* remap);
+
+//! Computes the average cache miss ratio (transformed vertices per triangle) of a triangle list,
+//! simulating a FIFO post-transform vertex cache. 0.5 is the best case of a regular grid,
+//! 3.0 means no reuse at all.
+//! \param indices triangle list
+//! \param indexCount number of indices, multiple of 3
+//! \param vertexCount number of vertices referenced by indices
+//! \param cacheSize simulated vertex cache size
+//! \param allocator allocator for the temporary cache timestamps
+//! \return the average cache miss ratio, 0 for an empty list
+float ComputeAcmr(const unsigned short* indices, int indexCount, int vertexCount, int cacheSize, Alloc::IAllocator* allocator);
+
+}   // namespace Mesh
+}   // namespace Pegasus
+
+#endif  // PEGASUS_MESH_MESHOPTIMIZER_H
@@ -0,0 +1,152 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MeshSimplifier.h
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Quadric error metric simplification of indexed triangle lists
+//!         (Garland and Heckbert, "Surface Simplification Using Quadric Error Metrics", 1997).
+
+#ifndef PEGASUS_MESH_MESHSIMPLIFIER_H
+#define PEGASUS_MESH_MESHSIMPLIFIER_H
+
+#include "Pegasus/Allocator/IAllocator.h"
+#include "Pegasus/Math/Vector.h"
+
+namespace Pegasus {
+namespace Mesh {
+
+struct StdVertex;
+
+//! Simplifies a triangle list with half edge collapses ordered by quadric error.
+//! Vertices are never moved or created, a collapse only points the triangles of a vertex
+//! to one of its neighbors, so every simplified index list is valid with the original vertex buffer.
+//! Vertices sharing a position with different attributes (uv seams) only collapse along the seam,
+//! both sides at once, and open borders only collapse along the border.
+//! Simplify() can be called with decreasing targets to build a chain of levels of detail,
+//! the quadrics are kept from one call to the next.
+class MeshSimplifier
+{
+public:
+
+    //! Constructor
+    //! \param allocator allocator for the internal buffers
+    explicit MeshSimplifier(Alloc::IAllocator* allocator);
+
+    //! Destructor
+    ~MeshSimplifier();
+
+    //! Prepares the simplification of a triangle list. The vertices are read during Simplify() calls,
+    //! and have to stay alive until the last one.
+    //! \param vertices vertex list
+    //! \param vertexCount number of vertices
+    //! \param indices triangle list, copied
+    //! \param indexCount number of indices, multiple of 3
+    void Initialize(const StdVertex* vertices, int vertexCount, const unsigned short* indices, int indexCount);
+
+    //! Collapses edges until the current triangle list has no more than targetIndexCount indices,
+    //! or until no collapse is possible without folding triangles over or breaking a seam.
+    //! \param targetIndexCount target number of indices
+    //! \return the new number of indices
+    int Simplify(int targetIndexCount);
+
+    //! \return the current triangle list
+    const unsigned short* GetIndices() const { return mIndices; }
+
+    //! \return the number of indices of the current triangle list
+    int GetIndexCount() const { return mIndexCount; }
+
+    //! \return the largest error of the collapses done so far, as a distance in position units
+    float GetError() const;
+
+    //! \return the radius of the bounding sphere of the vertices, centered on their bounding box
+    float GetRadius() const { return mRadius; }
+
+private:
+
+    //! Error quadric of a plane set, with the total weight of the planes
+    struct Quadric;
+
+    //! Releases all the internal buffers
+    void Release();
+
+    //! Finds the vertices sharing a position and classifies every vertex
+    void BuildGroupsAndKinds();
+
+    //! Accumulates the triangle and border quadrics of every position group
+    void BuildQuadrics();
+
+    //! Builds the vertex to triangle adjacency and the half edge table of the current triangle list
+    void BuildAdjacency();
+
+    //! \return true if the half edge a -> b is used by a triangle of the current list
+    bool HasEdge(int a, int b) const;
+
+    //! \return the vertex at the position of to that the other side of seam vertex from collapses onto,
+    //!         -1 if the other side of the seam cannot follow
+    int FindSeamSibling(int from, int to) const;
+
+    //! \return true if moving vertex from onto vertex to folds over or turns one of the triangles of from too much
+    bool HasTriangleFlips(int from, int to) const;
+
+    //! \return the number of triangles of vertex from that also use vertex to
+    int CountSharedTriangles(int from, int to) const;
+
+    //! Locks the vertices of the triangles of v for the rest of the pass, so the triangles checked for flips
+    //! do not change under another collapse
+    void LockTriangles(int v);
+
+    //! \return true if the kinds of the vertices and the current topology allow collapsing from onto to
+    bool CanCollapse(int from, int to) const;
+
+    //! \return the quadric error of collapsing vertex from onto vertex to
+    float ComputeError(int from, int to) const;
+
+    //! Runs one pass of non overlapping collapses
+    //! \return the number of collapses done
+    int CollapsePass(int targetIndexCount);
+
+    Alloc::IAllocator* mAllocator;
+
+    const StdVertex* mVertices;
+    int mVertexCount;
+
+    unsigned short* mIndices;
+    int mIndexCount;
+
+    //! first vertex of the position group of each vertex
+    int* mGroup;
+    //! next vertex of the same position group, circular list
+    int* mGroupNext;
+    //! VertexKind of each vertex
+    unsigned char* mKind;
+    //! quadric of each position group, valid on the first vertex of the group
+    Quadric* mQuadrics;
+
+    //! vertex to triangle adjacency, triangles of v are mAdjacency[mAdjacencyOffsets[v] .. mAdjacencyOffsets[v + 1])
+    int* mAdjacencyOffsets;
+    int* mAdjacency;
+
+    //! open addressing table of the half edges, (a << 16) | b
+    unsigned int* mEdges;
+    unsigned int mEdgeMask;
+
+    //! per pass collapse state: candidate edges and their errors, sort order, vertex remap and locks
+    int* mCandidateFrom;
+    int* mCandidateTo;
+    float* mCandidateError;
+    int* mCandidateOrder;
+    int* mRemap;
+    unsigned char* mPassLocked;
+
+    float mMaxError;
+    float mRadius;
+};
+
+}   // namespace Mesh
+}   // namespace Pegasus
+
+#endif  // PEGASUS_MESH_MESHSIMPLIFIER_H
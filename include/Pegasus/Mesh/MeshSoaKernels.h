@@ -0,0 +1,59 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MeshSoaKernels.h
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  SIMD kernels working on structure-of-arrays StdVertex streams (see MeshData::GetSoaStream).
+//!         Planes of a stream are laid out as StdVertexSoaComponent, pitch floats apart.
+//!         Source and destination ranges can start anywhere in a plane (no alignment requirement),
+//!         and the kernels never write past count, so disjoint ranges of the same stream
+//!         can be processed independently.
+
+#ifndef PEGASUS_MESH_MESHSOAKERNELS_H
+#define PEGASUS_MESH_MESHSOAKERNELS_H
+
+#include "Pegasus/Math/Vector.h"
+#include "Pegasus/Math/Matrix.h"
+
+namespace Pegasus {
+namespace Mesh {
+
+//! Transforms a range of StdVertex elements.
+//! position = posMat * position, normal = normMat * normal, uv is copied.
+//! \param src first source vertex, in the position x plane
+//! \param srcPitch float count between two source planes
+//! \param dst first destination vertex, in the position x plane
+//! \param dstPitch float count between two destination planes
+//! \param count number of vertices to process
+//! \param posMat position transform
+//! \param normMat normal transform
+//! \param normalizeNormals true to renormalize the transformed normals (zero length normals are left untouched)
+void SoaTransformStdVertices(const float* src, int srcPitch, float* dst, int dstPitch, int count,
+                             const Math::Mat44& posMat, const Math::Mat33& normMat, bool normalizeNormals);
+
+//! Displaces a range of StdVertex positions by a sum of sine waves.
+//! t = dot(position, timeDir), d = sum(wave.y * sin(t * wave.x + wave.z)),
+//! position += d * dispDir (or d * the unit direction from the timeDir axis to the position, when radial).
+//! Normals and uvs are copied.
+//! \param src first source vertex, in the position x plane
+//! \param srcPitch float count between two source planes
+//! \param dst first destination vertex, in the position x plane
+//! \param dstPitch float count between two destination planes
+//! \param count number of vertices to process
+//! \param timeDir direction the wave phase travels along
+//! \param dispDir displacement direction, when not radial
+//! \param waves wave list, each one encoded as (frequency, amplitude, offset)
+//! \param waveCount number of waves
+//! \param isRadial true to displace away from the timeDir axis instead of along dispDir
+void SoaWaveDisplaceStdVertices(const float* src, int srcPitch, float* dst, int dstPitch, int count,
+                                const Math::Vec3& timeDir, const Math::Vec3& dispDir,
+                                const Math::Vec3* waves, int waveCount, bool isRadial);
+
+}   // namespace Mesh
+}   // namespace Pegasus
+
+#endif  // PEGASUS_MESH_MESHSOAKERNELS_H
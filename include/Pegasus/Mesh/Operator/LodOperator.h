@@ -0,0 +1,61 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file	LodOperator.h
+//! \author	Kleber Garcia
+//! \date	October 18th 2026
+//! \brief	LodOperator, builds a chain of levels of detail with quadric error simplification
+
+#ifndef PEGASUS_LOD_OPERATOR_H
+#define PEGASUS_LOD_OPERATOR_H
+
+#include "Pegasus/Mesh/MeshOperator.h"
+
+namespace Pegasus
+{
+
+namespace Mesh
+{
+
+//! Mesh level of detail operator. Simplifies the input mesh LodCount - 1 times, every level keeping
+//! LodRatio of the triangles of the previous one, and stores the levels as ranges of one index buffer
+//! sharing the input vertices (see MeshData::GetLod()). UV seams and open borders are preserved.
+//! Every level gets the largest screen size it can be drawn at, so its error stays under LodScreenError
+//! times the viewport height. Only indexed triangle lists are simplified, other meshes are copied unchanged.
+//! \note operators after this one do not keep the levels of detail, it has to be the last one of the graph
+class LodOperator : public MeshOperator
+{
+    DECLARE_MESH_OPERATOR_NODE(LodOperator)
+
+    //! Property declarations
+    BEGIN_DECLARE_PROPERTIES(LodOperator, MeshOperator)
+        DECLARE_PROPERTY(int,   LodCount, 4)
+        DECLARE_PROPERTY(float, LodRatio, 0.5f)
+        DECLARE_PROPERTY(float, LodScreenError, 0.002f)
+    END_DECLARE_PROPERTIES()
+
+public:
+
+    //! constructor
+    LodOperator(Pegasus::Alloc::IAllocator* nodeAllocator, 
+                Pegasus::Alloc::IAllocator* nodeDataAllocator);
+
+    virtual ~LodOperator();
+
+    virtual unsigned int GetMinNumInputNodes() const override { return 1; }
+
+    virtual unsigned int GetMaxNumInputNodes() const override { return 1; }
+
+protected:
+
+    //! Generate the content of the data associated with the mesh operator
+    virtual void GenerateData();
+};
+}
+
+}
+
+#endif//PEGASUS_LOD_OPERATOR_H
@@ -36,6 +36,10 @@ class MultiCopyOperator : public MeshOperator
     END_DECLARE_PROPERTIES()
 
 public:
+
+    enum {
+        MaxMultiCopyFactor = 64
+    };
     
     //! constructor
     MultiCopyOperator(Pegasus::Alloc::IAllocator* nodeAllocator, 
@@ -0,0 +1,76 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file	OptimizeOperator.h
+//! \author	Kleber Garcia
+//! \date	October 18th 2026
+//! \brief	OptimizeOperator, welds and reorders a mesh for the GPU vertex caches
+
+#ifndef PEGASUS_OPTIMIZE_OPERATOR_H
+#define PEGASUS_OPTIMIZE_OPERATOR_H
+
+#include "Pegasus/Mesh/MeshOperator.h"
+#include "Pegasus/Mesh/MeshOptimizer.h"
+
+namespace Pegasus
+{
+
+namespace Mesh
+{
+
+//! Mesh optimize operator. Welds duplicate vertices, reorders the triangles for the
+//! post-transform vertex cache, then reorders the vertices in the order they are used.
+//! Only indexed triangle lists are optimized, other meshes are copied unchanged.
+class OptimizeOperator : public MeshOperator
+{
+    DECLARE_MESH_OPERATOR_NODE(OptimizeOperator)
+
+    //! Property declarations
+    BEGIN_DECLARE_PROPERTIES(OptimizeOperator, MeshOperator)
+        DECLARE_PROPERTY(float, WeldPositionTolerance, 0.0001f)
+        DECLARE_PROPERTY(float, WeldNormalTolerance, 0.001f)
+        DECLARE_PROPERTY(float, WeldUvTolerance, 0.0001f)
+        DECLARE_PROPERTY(int,   VertexCacheSize, MESH_DEFAULT_VERTEX_CACHE_SIZE)
+    END_DECLARE_PROPERTIES()
+
+public:
+
+    enum {
+        MinVertexCacheSize = 4,
+        MaxVertexCacheSize = 64
+    };
+
+    //! constructor
+    OptimizeOperator(Pegasus::Alloc::IAllocator* nodeAllocator, 
+                  Pegasus::Alloc::IAllocator* nodeDataAllocator);
+
+    virtual ~OptimizeOperator();
+
+    virtual unsigned int GetMinNumInputNodes() const override { return 1; }
+
+    virtual unsigned int GetMaxNumInputNodes() const override { return 1; }
+
+    //! \return average cache miss ratio of the input mesh, measured on the last generation
+    float GetAcmrBefore() const { return mAcmrBefore; }
+
+    //! \return average cache miss ratio of the optimized mesh, measured on the last generation
+    float GetAcmrAfter() const { return mAcmrAfter; }
+
+protected:
+
+    //! Generate the content of the data associated with the mesh operator
+    virtual void GenerateData();
+
+private:
+
+    float mAcmrBefore;
+    float mAcmrAfter;
+};
+}
+
+}
+
+#endif//PEGASUS_OPTIMIZE_OPERATOR_H
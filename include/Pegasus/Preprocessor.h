@@ -193,17 +193,28 @@
 //----------------------------------------------------------------------------------------
 
 // Graphics API
-#if PEGASUS_PLATFORM_WINDOWS
+// _PEGASUS_GAPI_NULL selects the headless null backend on any platform, it creates no GPU object
+// and records the render API calls instead (see Pegasus/Render/NullCommandLog.h)
+#if defined(_PEGASUS_GAPI_NULL)
+
+#define PEGASUS_GAPI_GL             0
+#define PEGASUS_GAPI_GLES           0
+#define PEGASUS_GAPI_DX             0
+#define PEGASUS_GAPI_NULL           1
+
+#elif PEGASUS_PLATFORM_WINDOWS
 
 #define PEGASUS_GAPI_GL             0
 #define PEGASUS_GAPI_GLES           0
 #define PEGASUS_GAPI_DX             1
+#define PEGASUS_GAPI_NULL           0
 
 #else
 
 #define PEGASUS_GAPI_GL             1
 #define PEGASUS_GAPI_GLES           0
 #define PEGASUS_GAPI_DX             0
+#define PEGASUS_GAPI_NULL           0
 
 #endif
 
@@ -304,6 +315,10 @@
 // See the implementation of the functions living in the Pegasus::Io namespace for more details
 #define PEGASUS_USE_NATIVE_IO_CALLS                     1
 
+// Map the asset files in memory rather than copying them into allocated buffers.
+// Disabled when assets can be edited and saved, since a mapped file cannot be overwritten safely
+#define PEGASUS_USE_MAPPED_ASSETS                       (PEGASUS_USE_NATIVE_IO_CALLS && !PEGASUS_ENABLE_PROXIES)
+
 //Enable events only if dev mode. In rel mode the boiler plate code gets removed
 //Events are used to communicate information to an editor app.
 #define PEGASUS_USE_EVENTS                        (PEGASUS_DEV)
@@ -43,6 +43,7 @@ class PropertyDefinition
             typedef enumTypeName & OutParamType;\
             typedef enumTypeName   ReturnType;\
             static void CopyProperty(OutParamType paramOut, ParamType paramIn) { paramOut = paramIn; }\
+            static bool AreEqual(const VarType & value, ParamType paramIn) { return value.GetValue() == paramIn.GetValue(); }\
             static const char* GetTypeName() { return enumTypeName##::GetTypeName(); }\
         };\
     }}
@@ -56,6 +57,7 @@ class PropertyDefinition
 //! (typically a const reference for non-primitive types).
 //! ReturnType is the type required to return a property from a function
 //! (typically a value, even for non-primitive types).
+//! AreEqual() compares a stored value with a parameter, so setters can skip the writes that change nothing.
 template <>
 struct PropertyDefinition<bool>
 {
@@ -65,6 +67,7 @@ struct PropertyDefinition<bool>
     typedef bool & OutParamType;
     typedef bool   ReturnType;
     static void CopyProperty(OutParamType paramOut, ParamType paramIn) { paramOut = paramIn; }
+    static bool AreEqual(const VarType & value, ParamType paramIn) { return value == paramIn; }
     static const char* GetTypeName() { return "bool"; }
 };
 
@@ -77,6 +80,7 @@ struct PropertyDefinition<unsigned int>
     typedef unsigned int & OutParamType;
     typedef unsigned int   ReturnType;
     static void CopyProperty(OutParamType paramOut, ParamType paramIn) { paramOut = paramIn; }
+    static bool AreEqual(const VarType & value, ParamType paramIn) { return value == paramIn; }
     static const char* GetTypeName() { return "uint"; }
 };
 
@@ -89,6 +93,7 @@ struct PropertyDefinition<int>
     typedef int & OutParamType;
     typedef int   ReturnType;
     static void CopyProperty(OutParamType paramOut, ParamType paramIn) { paramOut = paramIn; }
+    static bool AreEqual(const VarType & value, ParamType paramIn) { return value == paramIn; }
     static const char* GetTypeName() { return "int"; }
 };
 
@@ -101,6 +106,7 @@ struct PropertyDefinition<float>
     typedef float & OutParamType;
     typedef float   ReturnType;
     static void CopyProperty(OutParamType paramOut, ParamType paramIn) { paramOut = paramIn; }
+    static bool AreEqual(const VarType & value, ParamType paramIn) { return value == paramIn; }
     static const char* GetTypeName() { return "float"; }
 };
 
@@ -113,6 +119,7 @@ struct PropertyDefinition<Math::Vec2>
     typedef Math::Vec2InOut  OutParamType;
     typedef Math::Vec2Return ReturnType;
     static void CopyProperty(OutParamType paramOut, ParamType paramIn) { paramOut = paramIn; }
+    static bool AreEqual(const VarType & value, ParamType paramIn) { return value.v[0] == paramIn.v[0] && value.v[1] == paramIn.v[1]; }
     static const char* GetTypeName() { return "float2"; }
 };
 
@@ -125,6 +132,7 @@ struct PropertyDefinition<Math::Vec3>
     typedef Math::Vec3InOut  OutParamType;
     typedef Math::Vec3Return ReturnType;
     static void CopyProperty(OutParamType paramOut, ParamType paramIn) { paramOut = paramIn; }
+    static bool AreEqual(const VarType & value, ParamType paramIn) { return value.v[0] == paramIn.v[0] && value.v[1] == paramIn.v[1] && value.v[2] == paramIn.v[2]; }
     static const char* GetTypeName() { return "float3"; }
 };
 
@@ -137,6 +145,7 @@ struct PropertyDefinition<Math::Vec4>
     typedef Math::Vec4InOut  OutParamType;
     typedef Math::Vec4Return ReturnType;
     static void CopyProperty(OutParamType paramOut, ParamType paramIn) { paramOut = paramIn; }
+    static bool AreEqual(const VarType & value, ParamType paramIn) { return value.v[0] == paramIn.v[0] && value.v[1] == paramIn.v[1] && value.v[2] == paramIn.v[2] && value.v[3] == paramIn.v[3]; }
     static const char* GetTypeName() { return "float4"; }
 };
 
@@ -149,6 +158,7 @@ struct PropertyDefinition<Math::Color8RGB>
     typedef Math::Color8RGBInOut  OutParamType;
     typedef Math::Color8RGBReturn ReturnType;
     static void CopyProperty(OutParamType paramOut, ParamType paramIn) { paramOut = paramIn; }
+    static bool AreEqual(const VarType & value, ParamType paramIn) { return value.v[0] == paramIn.v[0] && value.v[1] == paramIn.v[1] && value.v[2] == paramIn.v[2]; }
     static const char* GetTypeName() { return "ubyte3"; }
 };
 
@@ -161,6 +171,7 @@ struct PropertyDefinition<Math::Color8RGBA>
     typedef Math::Color8RGBAInOut  OutParamType;
     typedef Math::Color8RGBAReturn ReturnType;
     static void CopyProperty(OutParamType paramOut, ParamType paramIn) { paramOut = paramIn; }
+    static bool AreEqual(const VarType & value, ParamType paramIn) { return value.v[0] == paramIn.v[0] && value.v[1] == paramIn.v[1] && value.v[2] == paramIn.v[2] && value.v[3] == paramIn.v[3]; }
     static const char* GetTypeName() { return "ubyte4"; }
 };
 
@@ -173,6 +184,15 @@ struct PropertyDefinition<String64>
     typedef       char * OutParamType;
     typedef const char * ReturnType;
     static void CopyProperty(OutParamType paramOut, ParamType paramIn) { Pegasus::Utils::Memcpy(paramOut, paramIn, sizeof(VarType)); }
+    static bool AreEqual(const VarType & value, ParamType paramIn)
+        {
+            for (unsigned int c = 0; c < sizeof(VarType); ++c)
+            {
+                if (value[c] != paramIn[c]) return false;
+                if (value[c] == '\0') return true;
+            }
+            return true;
+        }
     static const char* GetTypeName() { return "string64"; }
 };
 //@}
@@ -13,6 +13,7 @@
 #define PEGASUS_PROPERTYGRID_PROPERTYGRIDCLASSINFO_H
 
 #include "Pegasus/PropertyGrid/Property.h"
+#include "Pegasus/PropertyGrid/PropertyLayout.h"
 #include "Pegasus/PropertyGrid/Proxy/PropertyGridClassInfoProxy.h"
 #include "Pegasus/Utils/Vector.h"
 
@@ -64,6 +65,16 @@ public:
     //! \return Record of the class property
     const PropertyRecord & GetClassPropertyRecord(unsigned int index) const;
 
+    //! Find a class property by name, including parent classes (but not classes deriving from the current class)
+    //! \param name Name of the property
+    //! \return Index of the class property (0 <= index < GetNumClassProperties()), -1 if the class has no property with this name
+    //! \note Uses the layout compiled when resolving the class hierarchy, O(1)
+    inline int FindClassProperty(const char * name) const { return mClassLayout.Find(name); }
+
+    //! Get the compiled layout of the class properties, including parent classes
+    //! \return Hashed table mapping the name of a class property to its index
+    inline const PropertyLayout & GetClassLayout() const { return mClassLayout; }
+
     //------------------------------------------------------------------------------------
 
 #if PEGASUS_ENABLE_PROXIES
@@ -111,6 +122,11 @@ private:
     //!       the parent's number of class properties is not known yet at declaration time
     void UpdateNumClassPropertiesFromParents();
 
+    //! Compile the layout of the class properties: the records of the parent classes and of the current class
+    //! in a single list, and the hashed table of their names
+    //! \note Called once every class knows its number of class properties
+    void CompileClassLayout();
+
     //! Name of the class owning the property (non-empty when valid)
     //! \warning Not copied, the owner must be external
     const char * mClassName;
@@ -129,6 +145,13 @@ private:
     //! Number of class properties for the current class and parent classes combined
     unsigned int mNumClassProperties;
 
+    //! Records of the class properties of the parent classes and of the current class, in class property order,
+    //! empty until the layout is compiled
+    Utils::Vector<const PropertyRecord *> mAllClassPropertyRecords;
+
+    //! Hashed table mapping the name of a class property to its index, empty until the layout is compiled
+    PropertyLayout mClassLayout;
+
     // Give access to \a RegisterProperty from the manager
     friend class PropertyGridManager;
 
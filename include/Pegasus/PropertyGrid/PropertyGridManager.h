@@ -82,6 +82,7 @@ public:
 
     //! Must get called at the initialization of main() once. This will ensure all the metadata of class
     //! dependencies are linked properly. Otherwise, no parent-child relationship will exist
+    //! \note Calling it again (an application created after main() resolved the classes) gives the same links
     void ResolveInternalClassHierarchy();
 
     //! Called when an enumeration is started for registration.
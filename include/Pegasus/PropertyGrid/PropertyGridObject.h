@@ -136,7 +136,7 @@ namespace PropertyGrid {
 //! Macro to initialize a property in the implementation file, in the constructor of the class
 //! \param name Name of the property, starting with an uppercase letter
 #define INIT_PROPERTY(name)                                                                                        \
-    Set##name##ToDefault();                                                                                        \
+    Init##name##ToDefault();                                                                                       \
     mProperty##name##Index = APPEND_PROPERTY_POINTER(mProperty##name);                                             \
 
 
@@ -187,15 +187,19 @@ namespace PropertyGrid {
 //! Declare the property itself and the corresponding getter (Get<PropertyName>()) and setter (Set<PropertyName>(value))
 //! \param type Type of the property, use Math:: in front of types from the math library
 //! \param name Name of the property, starting with an uppercase letter
-//! \todo Handle the invalidation of the property when the setter is called
+//! \note The setter does nothing when the value does not change, so the property grid stays valid
+//! \note The setter locks the properties while copying the value, against the scripts reading the object
+//!       from worker threads, but it notifies the change, so it is called from the main thread only
 #define DECLARE_PROPERTY_MEMBER_AND_ACCESSORS(type, name)                                                           \
     public:                                                                                                         \
         inline PPG::PropertyDefinition<type>::ReturnType Get##name() const                                          \
             { return mProperty##name; }                                                                             \
         inline void Set##name(PPG::PropertyDefinition<type>::ParamType value)                                       \
-            { PPG::PropertyDefinition<type>::CopyProperty(mProperty##name, value);                                  \
-              PEGASUS_EVENT_DISPATCH(((Pegasus::PropertyGrid::PropertyGridObject*)this), Pegasus::PropertyGrid::ValueChangedEventIndexed, Pegasus::PropertyGrid::PROPERTYCATEGORY_CLASS, mProperty##name##Index ); \
-              InvalidatePropertyGrid(); }                                                                           \
+            { LockProperties();                                                                                     \
+              const bool changed = !PPG::PropertyDefinition<type>::AreEqual(mProperty##name, value);                \
+              if (changed) { PPG::PropertyDefinition<type>::CopyProperty(mProperty##name, value); }                 \
+              UnlockProperties();                                                                                   \
+              if (changed) { NotifyPropertyChanged(PPG::PROPERTYCATEGORY_CLASS, mProperty##name##Index); } }        \
     private:                                                                                                        \
         PPG::PropertyDefinition<type>::VarType mProperty##name;                                                     \
         int mProperty##name##Index;                                                                                 \
@@ -204,12 +208,17 @@ namespace PropertyGrid {
 //! Declare the property default value getter (Get<PropertyName>DefaultValue()) and setter (Set<PropertyName>ToDefault())
 //! \param type Type of the property, use Math:: in front of types from the math library
 //! \param name Name of the property, starting with an uppercase letter
+//! \note Init<PropertyName>ToDefault() initializes the member for INIT_PROPERTY(), without comparing
+//!       with the uninitialized value and without notifying the change
 #define DECLARE_PROPERTY_DEFAULT_VALUE_ACCESSORS(type, name)                                                        \
     public:                                                                                                         \
         inline PPG::PropertyDefinition<type>::ReturnType Get##name##DefaultValue() const                            \
             { return sPropertyDeclarationHelper##name.GetDefaultValue(); }                                          \
         inline void Set##name##ToDefault()                                                                          \
             { Set##name(Get##name##DefaultValue()); }                                                               \
+    private:                                                                                                        \
+        inline void Init##name##ToDefault()                                                                         \
+            { PPG::PropertyDefinition<type>::CopyProperty(mProperty##name, Get##name##DefaultValue()); }            \
 
 
 //! Declare a private helper class, whose constructor allows the initialization of the default value
@@ -306,6 +315,11 @@ public:
     //! \warning The output buffer size must match the registered size of this accessor
     void Read(void * outputBuffer, unsigned int outputBufferSize) const;
 
+    //! Get the address of the property, identifying it (for example in a PropertySnapshot)
+    //! \return Address of the property, nullptr if the accessor is invalid
+    //! \warning Never write through this address, the property grid would not be invalidated
+    inline const void * GetAddress() const { return mConstPtr; }
+
     //------------------------------------------------------------------------------------
 
 protected:
@@ -379,7 +393,7 @@ public:
     { }
 
     //! Setter of the property
-    //! \note Sets the dirty flag of the PropertyGridObject's property grid
+    //! \note Sets the dirty flag of the PropertyGridObject's property grid, unless the value does not change
     //! \param value New value of the property
     template <typename T>
     inline void Set(typename PPG::PropertyDefinition<T>::ParamType value) const
@@ -387,16 +401,40 @@ public:
 #if PEGASUS_ENABLE_PROPERTYGRID_SAFE_ACCESSOR
             PG_ASSERTSTR(sizeof(T) == mSize, "Wrong template type when setting the value of a property.");
 #endif
-            *static_cast<T *>(mPtr) = value;
-            InvalidatePropertyGrid();
-            PEGASUS_EVENT_DISPATCH(mObj, ValueChangedEventIndexed, mCategory, mIndex);
+            if (!PPG::PropertyDefinition<T>::AreEqual(*static_cast<const T *>(mPtr), value))
+            {
+                *static_cast<T *>(mPtr) = value;
+                NotifyPropertyChanged();
+            }
     }
 
     //! Write the property using the content of a buffer
     //! \param inputBuffer Input buffer with content to copy to the property (!= nullptr)
     //! \param inputBufferSize Size in bytes of the input buffer (> 0)
+    //! \note Sets the dirty flag of the PropertyGridObject's property grid, unless the content does not change
     void Write(const void * inputBuffer, unsigned int inputBufferSize) const;
 
+    //! Write the property using the content of a buffer, without notifying the change
+    //! \param inputBuffer Input buffer with content to copy to the property (!= nullptr)
+    //! \param inputBufferSize Size in bytes of the input buffer (> 0)
+    //! \return True if the content changed, NotifyPropertyChanged() has to be called later in that case
+    bool WriteWithoutNotification(const void * inputBuffer, unsigned int inputBufferSize) const;
+
+    //! Invalidate the property grid of the attached PropertyGridObject and notify the change of the property
+    //! \note Has to not be inline, because PropertyGridObject is not declared yet.
+    //!       We cannot move this class' declaration after PropertyGridObject
+    //!       since the latter has functions returning PropertyAccessor by value
+    inline void NotifyPropertyChanged() const;
+
+    //! Get the property grid object owning the property
+    //! \return Owner of the property, nullptr for a default constructed accessor
+    inline PropertyGridObject * GetOwner() const { return mObj; }
+
+    //! Test if two accessors give access to the same property
+    //! \param other Other accessor
+    //! \return True if both accessors point to the same property
+    inline bool IsSameProperty(const PropertyAccessor & other) const { return mPtr == other.mPtr; }
+
     //------------------------------------------------------------------------------------
 
 private:
@@ -435,12 +473,6 @@ private:
         ,   mPtr(ptr)
         { }
 
-    //! Invalidate the property grid of the attached PropertyGridObject
-    //! \note Has to not be inline, because PropertyGridObject is not declared yet.
-    //!       We cannot move this class' declaration after PropertyGridObject
-    //!       since the latter has functions returning PropertyAccessor by value
-    inline void InvalidatePropertyGrid() const;
-
     //! Non-null pointer to the property grid object owning the property
     //! (nullptr only if using the default constructor)
     PropertyGridObject * mObj;
@@ -529,6 +561,12 @@ public:
     //! \return Accessor for the property
     const PropertyReadAccessor GetClassReadPropertyAccessor(unsigned int index) const;
 
+    //! Find a class property by name, including parent classes (but not classes deriving from the current class)
+    //! \param name Name of the class property
+    //! \return Index of the class property (0 <= index < GetNumClassProperties()), -1 if not found
+    inline int FindClassProperty(const char * name) const
+        { return GetClassInfo()->FindClassProperty(name); }
+
     //------------------------------------------------------------------------------------
 
     // Object properties (defined at runtime, per instance)
@@ -597,6 +635,37 @@ public:
     //! \warning Make sure that function is called regularly, nothing else will reset the flag otherwise
     inline void ValidatePropertyGrid() { mPropertyGridDirty = false; }
 
+    //! Invalidate the property grid and notify the change of a property,
+    //! called by the setters and the accessors when a value changes
+    //! \param category Category of the property, PROPERTYCATEGORY_CLASS or PROPERTYCATEGORY_OBJECT
+    //! \param index Index of the property in its category
+    //! \note Inside a property batch, the change is only marked, and notified once by EndPropertyBatch()
+    //! \warning The dirty flag, the batch and the event listeners are not locked, notify from the main thread only.
+    //!          The scripts running on worker threads queue their changes in their render collection,
+    //!          notified by RenderCollection::FlushPropertyChanges() on the main thread
+    void NotifyPropertyChanged(PropertyCategory category, int index);
+
+    //! Start a property batch: the changes of properties keep invalidating the property grid,
+    //! but their ValueChangedEventIndexed events are coalesced until the end of the batch
+    //! \note Batches can be nested, the events are sent when the outermost batch ends
+    //! \warning The batch state belongs to the object and is not locked, open batches on the main thread only
+    void BeginPropertyBatch();
+
+    //! End a property batch, and send one event for each property that changed during the batch
+    void EndPropertyBatch();
+
+    //! Test if a property batch is open
+    //! \return True between BeginPropertyBatch() and the matching EndPropertyBatch()
+    inline bool IsPropertyBatchOpen() const { return mPropertyBatchDepth > 0; }
+
+    //! Lock the properties of the object, for the scripts of several threads sharing the object.
+    //! Held only while copying a value, the waiting threads spin, then yield if the holder got preempted.
+    //! \note The generated setters and the script property accesses lock, the accessors do not
+    void LockProperties() const;
+
+    //! Unlock the properties of the object, locked by LockProperties()
+    void UnlockProperties() const;
+
     //------------------------------------------------------------------------------------
 
 #if PEGASUS_ENABLE_PROXIES
@@ -644,6 +713,13 @@ protected:
     
 private:
 
+    //! Read the values of an object into properties, walking each block of values of the object once
+    //! and mapping the value names to properties through a layout
+    //! \param obj Object containing the values
+    //! \param layout Layout mapping the names of the properties to their index
+    //! \param category PROPERTYCATEGORY_CLASS or PROPERTYCATEGORY_OBJECT, category of the indices of the layout
+    void ReadPropertyBlocks(const AssetLib::Object* obj, const PropertyLayout& layout, PropertyCategory category);
+
     //! List of pointers to the class properties, from the base class down to the class
     //! the object is instantiated as
     Utils::Vector<void *> mClassPropertyPointers;
@@ -673,6 +749,18 @@ private:
     //! to tell the property grid object owner to regenerate its data
     bool mPropertyGridDirty;
 
+    //! Number of open property batches, 0 when the changes are notified immediately
+    int mPropertyBatchDepth;
+
+    //! 1 while a thread holds the lock of LockProperties(), 0 otherwise
+    mutable volatile long mPropertyLock;
+
+#if PEGASUS_USE_EVENTS
+    //! Bit masks of the class and object properties changed during the current batch, 32 properties per word
+    Utils::Vector<unsigned int> mBatchedClassProperties;
+    Utils::Vector<unsigned int> mBatchedObjectProperties;
+#endif
+
     //! Allocator for types of strings.
     Memory::BlockAllocator mStringAllocator;
 
@@ -688,9 +776,13 @@ private:
 
 // Implementation
 
-inline void PropertyAccessor::InvalidatePropertyGrid() const
+inline void PropertyAccessor::NotifyPropertyChanged() const
 {
-    mObj->InvalidatePropertyGrid();
+#if PEGASUS_USE_EVENTS
+    mObj->NotifyPropertyChanged(mCategory, mIndex);
+#else
+    mObj->NotifyPropertyChanged(PROPERTYCATEGORY_INVALID, -1);
+#endif
 }
 
 //----------------------------------------------------------------------------------------
@@ -0,0 +1,88 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file	PropertyLayout.h
+//! \author	Kleber Garcia
+//! \date	October 18th 2026
+//! \brief	Hashed table of property names, mapping a name to the index of its property
+
+#ifndef PEGASUS_PROPERTYGRID_PROPERTYLAYOUT_H
+#define PEGASUS_PROPERTYGRID_PROPERTYLAYOUT_H
+
+namespace Pegasus {
+namespace Alloc {
+    class IAllocator;
+}
+}
+
+namespace Pegasus {
+namespace PropertyGrid {
+
+
+//! Hashed table of property names, built once for a set of properties
+//! (the class properties of a class, the object properties read from a schema),
+//! then used to map names found in assets or scripts to property indices in O(1)
+class PropertyLayout
+{
+public:
+
+    //! Constructor
+    //! \param allocator Allocator of the table
+    explicit PropertyLayout(Alloc::IAllocator * allocator);
+
+    //! Destructor
+    ~PropertyLayout();
+
+    //! Clear the table and make room for a number of names
+    //! \param nameCount Number of names about to be added
+    void Reset(unsigned int nameCount);
+
+    //! Add the name of a property
+    //! \param name Name of the property (not copied, the owner must be external)
+    //! \param index Index of the property, returned by Find()
+    //! \note When a name is added twice, Find() returns the index added first
+    void Add(const char * name, int index);
+
+    //! Find the index of a property
+    //! \param name Name of the property
+    //! \return Index of the property, -1 if the name is not in the table
+    int Find(const char * name) const;
+
+    //! Get the number of names in the table
+    //! \return Number of names added since the last Reset()
+    inline unsigned int GetSize() const { return mCount; }
+
+private:
+
+    // No copies allowed
+    PG_DISABLE_COPY(PropertyLayout);
+
+    //! Slot of the table, empty when name is nullptr
+    struct Slot
+    {
+        const char * name;
+        unsigned int hash;
+        int index;
+    };
+
+    //! Allocator of the table
+    Alloc::IAllocator * mAllocator;
+
+    //! Slots of the table, open addressing with linear probing
+    Slot * mSlots;
+
+    //! Number of slots, power of 2, at least twice the number of names
+    unsigned int mCapacity;
+
+    //! Number of names in the table
+    unsigned int mCount;
+};
+
+
+}   // namespace PropertyGrid
+}   // namespace Pegasus
+
+#endif  // PEGASUS_PROPERTYGRID_PROPERTYLAYOUT_H
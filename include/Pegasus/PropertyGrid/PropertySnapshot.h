@@ -0,0 +1,139 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file	PropertySnapshot.h
+//! \author	Kleber Garcia
+//! \date	October 18th 2026
+//! \brief	Copy of the property values of a set of property grid objects at a point in time
+
+#ifndef PEGASUS_PROPERTYGRID_PROPERTYSNAPSHOT_H
+#define PEGASUS_PROPERTYGRID_PROPERTYSNAPSHOT_H
+
+namespace Pegasus {
+namespace Alloc {
+    class IAllocator;
+}
+}
+
+namespace Pegasus {
+namespace PropertyGrid {
+
+class PropertyGridObject;
+class PropertyReadAccessor;
+
+
+//! Copy of the class and object property values of a set of property grid objects.
+//! A copied value is found from the accessor of the live property, so code reading properties
+//! through accessors can read the snapshot instead, while the live objects keep changing.
+//! The storage is kept by Clear(), so a snapshot captured every frame stops allocating once it reached its size.
+class PropertySnapshot
+{
+public:
+
+    //! Constructor
+    //! \param allocator Allocator of the copied values and of the lookup table
+    explicit PropertySnapshot(Alloc::IAllocator * allocator);
+
+    //! Destructor
+    ~PropertySnapshot();
+
+    //! Remove every copied value, keeping the storage
+    void Clear();
+
+    //! Copy the current value of every class and object property of an object
+    //! \param object Object to copy (!= nullptr), captured only once when given several times
+    void Capture(const PropertyGridObject * object);
+
+    //! Test if an object has been captured
+    //! \param object Object to test
+    //! \return True if Capture() has been called for the object since the last Clear()
+    bool IsCaptured(const PropertyGridObject * object) const;
+
+    //! Read the copied value of a property
+    //! \param accessor Accessor of the live property
+    //! \param outputBuffer Buffer that is filled with the copied value (!= nullptr)
+    //! \param outputBufferSize Size of the output buffer in bytes, the size of the property
+    //! \return True if the property has been captured with that size, false if the live property has to be read instead
+    bool Read(const PropertyReadAccessor & accessor, void * outputBuffer, unsigned int outputBufferSize) const;
+
+    //! Overwrite the copied value of a property, or copy it when the property has not been captured
+    //! \param accessor Accessor of the live property, only used as the key of the value
+    //! \param inputBuffer Buffer with the new value (!= nullptr)
+    //! \param inputBufferSize Size of the input buffer in bytes, the size of the property
+    void Write(const PropertyReadAccessor & accessor, const void * inputBuffer, unsigned int inputBufferSize);
+
+    //! Get the number of copied properties
+    //! \return Number of properties captured since the last Clear()
+    inline unsigned int GetNumProperties() const { return mNumEntries; }
+
+    //! Get the copied values, in the order of the captures
+    //! \return Pointer to the copied values, GetDataSize() bytes
+    inline const void * GetData() const { return mData; }
+
+    //! Get the size of the copied values
+    //! \return Size in bytes of the copied values
+    inline unsigned int GetDataSize() const { return mDataSize; }
+
+private:
+
+    // No copies allowed
+    PG_DISABLE_COPY(PropertySnapshot);
+
+    //! Copied property
+    struct Entry
+    {
+        const void * address;   //!< Address of the live property, key of the lookups
+        unsigned int offset;    //!< Offset of the copied value in mData
+        unsigned int size;      //!< Size in bytes of the property
+    };
+
+    //! Copy one property
+    //! \param address Address of the live property
+    //! \param value Value to copy, the live property when capturing
+    //! \param size Size in bytes of the property
+    void AddProperty(const void * address, const void * value, unsigned int size);
+
+    //! Rebuild the lookup table for a number of entries
+    //! \param entryCount Number of entries the table has to hold
+    void GrowTable(unsigned int entryCount);
+
+    //! Add an object to the table of the captured objects
+    //! \param object Object to add, not captured yet
+    void AddObject(const PropertyGridObject * object);
+
+    //! \return the first slot of the probe sequence of an address
+    static unsigned int HashAddress(const void * address);
+
+    //! Allocator of the storage
+    Alloc::IAllocator * mAllocator;
+
+    //! Copied values
+    char * mData;
+    unsigned int mDataSize;
+    unsigned int mDataCapacity;
+
+    //! Copied properties
+    Entry * mEntries;
+    unsigned int mNumEntries;
+    unsigned int mEntryCapacity;
+
+    //! Lookup table from address to entry index, open addressing with linear probing,
+    //! a slot is empty when -1. Power of 2, at least twice the number of entries
+    int * mSlots;
+    unsigned int mSlotCapacity;
+
+    //! Captured objects, to skip an object given twice. Open addressing with linear probing
+    //! on the address of the object, a slot is empty when nullptr. Power of 2, at least twice the number of objects
+    const PropertyGridObject ** mObjectSlots;
+    unsigned int mNumObjects;
+    unsigned int mObjectSlotCapacity;
+};
+
+
+}   // namespace PropertyGrid
+}   // namespace Pegasus
+
+#endif  // PEGASUS_PROPERTYGRID_PROPERTYSNAPSHOT_H
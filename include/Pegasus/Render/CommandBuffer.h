@@ -0,0 +1,283 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   CommandBuffer.h
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Deferred render command buffer. Records the calls of the render API (Render.h),
+//!         sorts the draws by target, program, mesh and material, and replays them into the
+//!         render API without the state changes that are already current.
+
+#ifndef PEGASUS_RENDER_COMMANDBUFFER_H
+#define PEGASUS_RENDER_COMMANDBUFFER_H
+
+#include "Pegasus/Render/Render.h"
+
+namespace Pegasus
+{
+namespace Render
+{
+
+//! Counters of a command buffer, the recording counts are reset by CommandBuffer::Reset(),
+//! the submission counts at every submission
+struct CommandBufferStats
+{
+    unsigned int mRecordedCommandCount;     //!< Render API calls recorded
+    unsigned int mDrawCount;                //!< Draws and dispatches recorded
+    unsigned int mSegmentCount;             //!< Sorted ranges of draws of the last submission, split by passes, dispatches and order dependent draws
+    unsigned int mSubmittedCommandCount;    //!< Render API calls issued by the last submission
+    unsigned int mFilteredCommandCount;     //!< State and binding changes skipped by the last submission because already current
+
+    CommandBufferStats()
+    :   mRecordedCommandCount(0), mDrawCount(0), mSegmentCount(0), mSubmittedCommandCount(0), mFilteredCommandCount(0)
+    {
+    }
+};
+
+//! Deferred render command buffer.
+//! The recording functions have the names and arguments of the render API. State (program, mesh,
+//! rasterizer and blending states, primitive mode) and bindings (buffer writes, uniforms, samplers,
+//! compute outputs) are captured with every draw, so the draws between two target or pass changes
+//! can be sorted by program, mesh and material before the submission.
+//! Targets, viewports, clears, markers, unbinds and dispatches are executed in their recording order.
+//! A command buffer belongs to the thread recording it, only the submission calls the render API,
+//! on the render thread. The buffer keeps its storage when reset, so recording every frame stops
+//! allocating once the buffer reached the size of the frame.
+//! \note Only the draws with a strict depth test (less or greater) and without stencil writes are sorted.
+//!       Blended draws, draws without depth test or with a depth test passing on equal depths,
+//!       draws writing the stencil and draws without rasterizer state keep their order.
+//! \note As in the render API, the uniforms stay bound when the program changes. A draw with another program
+//!       binds them to its variables of the same names, and skips those its program does not have.
+//! \note State changes that are not followed by a draw or a dispatch are not submitted.
+class CommandBuffer
+{
+public:
+
+    //! Constructor
+    //! \param allocator Allocator of the recorded commands, the render allocator if nullptr
+    explicit CommandBuffer(Alloc::IAllocator * allocator = nullptr);
+
+    //! Destructor
+    ~CommandBuffer();
+
+    //! Remove the recorded commands, release the recorded resources and reset the counters, keeping the storage
+    void Reset();
+
+    //! Enable or disable the sorting of the draws
+    //! \param enabled True to sort the draws of a segment by program, mesh and material (default),
+    //!                false to submit them in their recording order
+    void SetSortDraws(bool enabled) { mSortDraws = enabled; }
+
+    //! Test if the draws are sorted
+    //! \return True if the draws are sorted on submission
+    bool GetSortDraws() const { return mSortDraws; }
+
+    //! Get the counters of the buffer
+    //! \return Counters of the recording and of the last submission
+    const CommandBufferStats & GetStats() const { return mStats; }
+
+    //! Replay the recorded commands into the render API, see Submit(CommandBuffer * const *, unsigned int).
+    //! The buffer is not reset, it can be submitted again.
+    void Submit();
+
+    //! Replay command buffers into the render API in the order of the array. The state
+    //! that is current is tracked across the buffers, so the first draws of a buffer do not
+    //! set the state the previous buffer left. The render API state is unknown before the first
+    //! buffer, so the first draw sets all its state.
+    //! \param buffers Command buffers to submit, null entries are skipped
+    //! \param count Number of entries of the array
+    static void Submit(CommandBuffer * const * buffers, unsigned int count);
+
+    //! \name Render API recording, see Render.h for the meaning of the arguments
+    //@{
+    void SetProgram(Shader::ProgramLinkageInOut program);
+    void SetMesh(Mesh::MeshInOut mesh);
+    void UnbindMesh();
+    void SetViewport(const Viewport& viewport);
+    void SetViewport(const RenderTargetRef& renderTarget);
+    void SetViewport(const DepthStencilRef& depthStencil);
+    void SetRenderTarget(RenderTargetRef& renderTarget);
+    void SetRenderTarget(RenderTargetRef& renderTarget, DepthStencilRef& depthStencil);
+    void SetRenderTargets(int renderTargetCount, RenderTargetRef* renderTargets);
+    void SetRenderTargets(int renderTargetCount, RenderTargetRef* renderTargets, DepthStencilRef& depthStencil);
+    void UnbindRenderTargets();
+    void DispatchDefaultRenderTarget();
+    void Clear(bool color, bool depth, bool stencil);
+    void SetClearColorValue(const Math::ColorRGBA& col);
+    void SetRasterizerState(const RasterizerStateRef& rasterState);
+    void SetRasterizerState(const RasterizerStateRef& rasterState, unsigned int stencilRefValue);
+    void SetBlendingState(const BlendingStateRef blendingState);
+    void SetDepthClearValue(float d);
+    void SetPrimitiveMode(PrimitiveMode mode);
+    void Draw();
+    void DrawInstanced(unsigned int instanceCount);
+    void DrawLod(float screenSize);
+    void SetBuffer(BufferRef& dstBuffer, const void * src, int size = -1, int offset = 0);
+    bool SetUniformTexture(Uniform& u, Texture::TextureInOut texture);
+    bool SetUniformBuffer(Uniform& u, const BufferRef& buffer);
+    bool SetUniformBufferResource(Uniform& u, const BufferRef& buffer);
+    bool SetUniformTextureRenderTarget(Uniform& u, const RenderTargetRef& renderTarget);
+    bool SetUniformDepth(Uniform& u, const DepthStencilRef& depth);
+    bool SetUniformStencil(Uniform& u, const DepthStencilRef& stencil);
+    bool SetUniformCubeMap(Uniform& u, CubeMapRef& cubeMap);
+    bool SetUniformVolume(Uniform& u, const VolumeTextureRef& volume);
+    void SetComputeSampler(SamplerStateRef& sampler, int slot);
+    void SetPixelSampler(SamplerStateRef& sampler, int slot);
+    void SetVertexSampler(SamplerStateRef& sampler, int slot);
+    void CleanInternalState();
+    void SetComputeOutput(BufferRef buffer, int slot);
+    void SetComputeOutput(VolumeTextureRef volume, int slot);
+    void SetComputeOutput(RenderTargetRef target, int slot);
+    void UnbindComputeOutputs();
+    void UnbindComputeResources();
+    void UnbindPixelResources();
+    void UnbindVertexResources();
+    void Dispatch(unsigned int x, unsigned int y, unsigned int z);
+    void GenerateMips(RenderTargetRef& renderTarget);
+    void GenerateMips(CubeMapRef& cubeMap);
+    void BeginMarker(const char* marker);
+    void EndMarker();
+    //@}
+
+private:
+
+    // No copies allowed
+    PG_DISABLE_COPY(CommandBuffer);
+
+    //! Internal state of a submission, the state that is current in the render API
+    struct AppliedState;
+
+    //! Recorded binding, a buffer write, a uniform, a sampler or a compute output
+    struct Binding;
+
+    //! Recorded draw or dispatch with the state and the bindings it uses
+    struct Packet;
+
+    //! Recorded command executed in order: targets, viewports, clears, markers, unbinds
+    struct Pass;
+
+    //! Rasterizer and blending states of a draw, the material part of the sort key
+    struct Material;
+
+    //! Growable array of plain structures keeping its storage when cleared
+    template <class T>
+    class Storage
+    {
+    public:
+        Storage() : mData(nullptr), mCount(0), mCapacity(0) {}
+        T & Push(Alloc::IAllocator * allocator);
+        T * PushArray(Alloc::IAllocator * allocator, unsigned int count);
+        void Free(Alloc::IAllocator * allocator);
+        void Remove(unsigned int index);
+        void Clear() { mCount = 0; }
+
+        T * mData;
+        unsigned int mCount;
+        unsigned int mCapacity;
+    };
+
+    //! Keep a resource alive until the buffer is reset
+    void Retain(Core::RefCounted * object);
+
+    //! Copy data into the buffer
+    //! \return Offset of the copy in the data of the buffer, 16 bytes aligned
+    unsigned int CopyData(const void * src, unsigned int size);
+
+    //! Record a pass command, it ends the segment of the draws recorded before it
+    Pass & PushPass(int type);
+
+    //! Record a draw or a dispatch with the current state and bindings
+    Packet & PushPacket(int type);
+
+    //! Add or replace a binding in the current binding set
+    void SetBinding(const Binding & binding);
+
+    //! Remove the bindings of a type from the current binding set
+    //! \param uniformResourcesOnly True to remove the uniform resources (every uniform except the uniform buffers),
+    //!                             false to remove the compute outputs
+    void RemoveBindings(bool uniformResourcesOnly);
+
+    //! Record a uniform binding
+    bool SetUniform(int type, Uniform& u, Core::RefCounted * resource);
+
+    //! Record a sampler binding
+    void SetSampler(int stage, SamplerStateRef& sampler, int slot);
+
+    //! Record a compute output binding
+    void SetComputeOutputBinding(int type, Core::RefCounted * resource, int slot);
+
+    //! Get a small id of a pointer, the first seen pointer is 0
+    //! \param ids Pointers seen since the last reset
+    //! \param maxId Largest id, pointers seen after the table is full share it
+    unsigned int GetSortId(Storage<const void *> & ids, const void * pointer, unsigned int maxId);
+
+    //! Get the small id of the current material, the first seen material is 0
+    unsigned int GetMaterialId();
+
+    //! Compute the order of the packets of a segment
+    void SortSegment(unsigned int first, unsigned int count);
+
+    //! Replay the packets of a range, in sorted order
+    void SubmitPackets(AppliedState & state, unsigned int first, unsigned int end);
+
+    //! Replay a packet
+    void SubmitPacket(AppliedState & state, const Packet & packet);
+
+    //! Replay the bindings of a packet
+    void SubmitBindings(AppliedState & state, const Packet & packet);
+
+    //! Replay a pass command
+    void SubmitPass(AppliedState & state, const Pass & pass);
+
+    //! Allocator of the storage
+    Alloc::IAllocator * mAllocator;
+
+    //! True to sort the draws of the segments
+    bool mSortDraws;
+
+    //! Counters
+    CommandBufferStats mStats;
+
+    //! Current state of the recording
+    Shader::ProgramLinkage * mProgram;
+    Mesh::Mesh * mMesh;
+    RasterizerState * mRasterState;
+    unsigned int mStencilRefValue;
+    bool mHasStencilRefValue;
+    bool mRasterOrdered;
+    BlendingState * mBlendState;
+    bool mBlendEnabled;
+    int mPrimitiveMode;
+    unsigned int mSegment;
+
+    //! Current binding set, and the range of the last snapshot of it
+    Storage<Binding> mBindingSet;
+    bool mBindingSetDirty;
+    unsigned int mSnapshotFirst;
+    unsigned int mSnapshotCount;
+
+    //! Recorded commands
+    Storage<Packet> mPackets;
+    Storage<Pass> mPasses;
+    Storage<Binding> mBindingSnapshots;
+    Storage<char> mData;
+    Storage<Core::RefCounted *> mRetained;
+
+    //! Sort ids of the programs, meshes and materials
+    Storage<const void *> mProgramIds;
+    Storage<const void *> mMeshIds;
+    Storage<Material> mMaterials;
+
+    //! Submission order of the packets and sort work arrays
+    Storage<int> mOrder;
+    Storage<int> mSortTemp;
+    Storage<unsigned int> mSortKeys;
+};
+
+}
+}
+
+#endif  // PEGASUS_RENDER_COMMANDBUFFER_H
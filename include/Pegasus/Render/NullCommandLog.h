@@ -0,0 +1,203 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   NullCommandLog.h
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Log of the render API calls recorded by the null render backend (PEGASUS_GAPI_NULL).
+//!         Used to measure the CPU cost of the render submission and for golden log regression tests.
+
+#ifndef PEGASUS_RENDER_NULLCOMMANDLOG_H
+#define PEGASUS_RENDER_NULLCOMMANDLOG_H
+
+namespace Pegasus
+{
+    namespace Alloc
+    {
+        class IAllocator;
+    }
+}
+
+namespace Pegasus
+{
+namespace Render
+{
+
+//! Commands recorded by the null backend, with the meaning of their arguments.
+//! Resources are identified by the ids the null backend gives them on creation, starting at 1
+//! in creation order, so a log is identical from one run to the other.
+enum NullCommandType
+{
+    NULL_CMD_SET_PROGRAM,               //!< program guid, program version
+    NULL_CMD_SET_MESH,                  //!< mesh id, vertex count, index count
+    NULL_CMD_UNBIND_MESH,               //!< -
+    NULL_CMD_SET_VIEWPORT,              //!< x, y, width, height
+    NULL_CMD_SET_RENDER_TARGETS,        //!< render target count, first render target id, depth stencil id (0 if none)
+    NULL_CMD_SET_DEFAULT_RENDER_TARGET, //!< width, height of the frame buffer
+    NULL_CMD_CLEAR,                     //!< color, depth, stencil (0 or 1)
+    NULL_CMD_SET_CLEAR_COLOR,           //!< r, g, b, a in 1/255 units
+    NULL_CMD_SET_DEPTH_CLEAR_VALUE,     //!< depth in 1/65535 units
+    NULL_CMD_SET_RASTERIZER_STATE,      //!< rasterizer state id, stencil reference value
+    NULL_CMD_SET_BLENDING_STATE,        //!< blending state id
+    NULL_CMD_SET_PRIMITIVE_MODE,        //!< PrimitiveMode
+    NULL_CMD_SET_BUFFER,                //!< buffer id, size, offset
+    NULL_CMD_SET_UNIFORM_BUFFER,        //!< program guid, uniform index, buffer id
+    NULL_CMD_SET_UNIFORM_RESOURCE,      //!< program guid, uniform index, resource id
+    NULL_CMD_SET_SAMPLER,               //!< shader stage (Shader::ShaderType), slot, sampler id
+    NULL_CMD_SET_COMPUTE_OUTPUT,        //!< slot, resource id
+    NULL_CMD_UNBIND_COMPUTE_OUTPUTS,    //!< -
+    NULL_CMD_UNBIND_RESOURCES,          //!< shader stage (Shader::ShaderType)
+    NULL_CMD_DRAW,                      //!< element count (indices or vertices), instance count, first index, level of detail
+    NULL_CMD_DRAW_INDIRECT,             //!< mesh id
+    NULL_CMD_DISPATCH,                  //!< x, y, z thread group counts
+    NULL_CMD_GENERATE_MIPS,             //!< resource id
+    NULL_CMD_BEGIN_MARKER,              //!< marker depth after the begin
+    NULL_CMD_END_MARKER,                //!< marker depth after the end
+    NULL_CMD_ERROR,                     //!< NullValidationError, command type that failed
+    NULL_CMD_COUNT
+};
+
+//! Invalid uses of the render API detected by the null backend, recorded as NULL_CMD_ERROR.
+//! The real backends either log the same errors or have undefined results.
+enum NullValidationError
+{
+    NULL_ERR_NO_PROGRAM,                //!< Mesh, uniform, draw or dispatch without a valid program
+    NULL_ERR_NO_MESH,                   //!< Draw without a mesh
+    NULL_ERR_INVALID_UNIFORM,           //!< Uniform not belonging to the current program
+    NULL_ERR_BUFFER_OVERFLOW,           //!< Buffer write larger than the buffer
+    NULL_ERR_RENDER_TARGET_COUNT,       //!< Render target count out of [0, MAX_RENDER_TARGETS]
+    NULL_ERR_UNBALANCED_MARKER,         //!< EndMarker() without a BeginMarker()
+    NULL_ERR_NOT_COMPUTE_PROGRAM,       //!< Dispatch with a program that is not a compute program
+    NULL_ERR_INVALID_RESOURCE,          //!< Null or destroyed resource given to the API
+    NULL_ERR_STALE_TRANSIENT_BUFFER,    //!< Transient uniform buffer bound without a write since the last Context::Swap()
+    NULL_ERR_COUNT
+};
+
+//! Recorded command, 20 bytes
+struct NullCommand
+{
+    static const int ARG_COUNT = 4;
+
+    int mType;              //!< NullCommandType
+    int mArgs[ARG_COUNT];   //!< Arguments, see NullCommandType, 0 when unused
+};
+
+//! Log of the commands recorded by the null backend.
+//! The log keeps its storage when cleared, so a frame recorded every frame stops allocating once it reached its size.
+class NullCommandLog
+{
+public:
+
+    //! Constructor
+    //! \param allocator Allocator of the commands, the render allocator if nullptr
+    explicit NullCommandLog(Alloc::IAllocator * allocator = nullptr);
+
+    //! Destructor
+    ~NullCommandLog();
+
+    //! Record a command
+    //! \param type Type of the command
+    //! \param arg0-3 Arguments of the command, see NullCommandType
+    void Record(NullCommandType type, int arg0 = 0, int arg1 = 0, int arg2 = 0, int arg3 = 0);
+
+    //! Record a validation error
+    //! \param error Type of the error
+    //! \param failedCommand Command that failed
+    void RecordError(NullValidationError error, NullCommandType failedCommand);
+
+    //! Remove the recorded commands and reset the counters, keeping the storage
+    void Clear();
+
+    //! Enable or disable the recording of the commands, the counters are always updated.
+    //! Disable it to measure the submission cost over many frames without growing the log.
+    //! \param enabled True to store the commands (default), false to only count them
+    void SetRecording(bool enabled) { mRecording = enabled; }
+
+    //! Test if the commands are stored
+    //! \return True if the commands are stored, false if they are only counted
+    bool IsRecording() const { return mRecording; }
+
+    //! Get the number of stored commands
+    //! \return Number of commands stored since the last Clear()
+    unsigned int GetCommandCount() const { return mCommandCount; }
+
+    //! Get a stored command
+    //! \param index Index of the command (< GetCommandCount())
+    //! \return Command
+    const NullCommand & GetCommand(unsigned int index) const;
+
+    //! Get the number of commands of a type, stored or not
+    //! \param type Type of the commands
+    //! \return Number of commands of the type since the last Clear()
+    unsigned int GetCount(NullCommandType type) const { return mCounters[type]; }
+
+    //! Get the number of validation errors of a type
+    //! \param error Type of the error
+    //! \return Number of errors of the type since the last Clear()
+    unsigned int GetErrorCount(NullValidationError error) const { return mErrorCounters[error]; }
+
+    //! Get the total number of validation errors
+    //! \return Number of errors since the last Clear()
+    unsigned int GetErrorCount() const { return mCounters[NULL_CMD_ERROR]; }
+
+    //! Get the number of state changes, every command except draws, dispatches, markers and errors
+    //! \return Number of state changes since the last Clear()
+    unsigned int GetStateChangeCount() const;
+
+    //! Compute a hash of the stored commands, to compare a log with a golden one
+    //! \return 32 bits FNV-1a hash of the commands
+    unsigned int ComputeHash() const;
+
+    //! Write the stored commands as text, one command per line (name then arguments)
+    //! \param buffer Buffer receiving the null terminated text
+    //! \param bufferSize Size of the buffer in bytes, the text is truncated on a line boundary to fit
+    //! \return Number of commands written
+    unsigned int Print(char * buffer, unsigned int bufferSize) const;
+
+    //! Get the name of a command type
+    //! \param type Type of the command
+    //! \return Name of the command, for example "Draw"
+    static const char * GetCommandName(NullCommandType type);
+
+    //! Get the name of a validation error
+    //! \param error Type of the error
+    //! \return Name of the error, for example "NoProgram"
+    static const char * GetErrorName(NullValidationError error);
+
+private:
+
+    // No copies allowed
+    PG_DISABLE_COPY(NullCommandLog);
+
+    //! Grow the storage of the commands
+    void Grow();
+
+    //! Allocator of the commands
+    Alloc::IAllocator * mAllocator;
+
+    //! Stored commands
+    NullCommand * mCommands;
+    unsigned int mCommandCount;
+    unsigned int mCommandCapacity;
+
+    //! True when the commands are stored
+    bool mRecording;
+
+    //! Number of commands of each type
+    unsigned int mCounters[NULL_CMD_COUNT];
+
+    //! Number of errors of each type
+    unsigned int mErrorCounters[NULL_ERR_COUNT];
+};
+
+//! Get the log of the null render backend
+//! \return Log of the commands, nullptr if the render library is not built with the null backend (PEGASUS_GAPI_NULL)
+NullCommandLog * GetNullCommandLog();
+
+}
+}
+
+#endif  // PEGASUS_RENDER_NULLCOMMANDLOG_H
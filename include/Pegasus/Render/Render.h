@@ -235,7 +235,8 @@ namespace Render
     struct BufferConfig
     {
         int mSize;
-        BufferConfig() : mSize(0) {}
+        bool mTransient; //!< True for a uniform buffer written in the uniform ring, see CreateUniformBuffer
+        BufferConfig() : mSize(0), mTransient(false) {}
     };
 
     //! Container specifying rectangle viewport in pixel coordinates
@@ -269,15 +270,18 @@ namespace Render
     //! Structure representing a uniform location in a particular shader
     //! The name holds a copy of the actual uniform name.
     //! The internal values are obfuscated, not to be used.
+    //! The location stays valid while the program is not linked again. When the program
+    //! changes, the location is found again from the hash of the name.
     struct Uniform
     {
         char mName[PEGASUS_RENDER_MAX_UNIFORM_NAME_LEN];
         int  mInternalIndex;
         int  mInternalOwner;
         int  mInternalVersion;
+        unsigned int mNameHash; //!< Utils::HashStr of mName, 0 when not computed yet
     public:
             Uniform()
-            : mInternalIndex(-1), mInternalVersion(-1), mInternalOwner(-1)
+            : mInternalIndex(-1), mInternalVersion(-1), mInternalOwner(-1), mNameHash(0)
             {
                 mName[0] = 0;
             }
@@ -461,6 +465,13 @@ namespace Render
     //!                 -Mesh to be dispatched
     void DrawInstanced(unsigned int instanceCount);
 
+    //! Draws the level of detail of the dispatched mesh that fits a screen size (see Mesh::MeshData::SelectLod()).
+    //! Meshes without levels of detail are drawn whole, like with Draw().
+    //! \param screenSize projected diameter of the bounding sphere of the mesh over the viewport height
+    //! \note Requires: -Shader to be dispatched
+    //!                 -Mesh to be dispatched
+    void DrawLod(float screenSize);
+
     //! Fills a uniform reference by name
     //! \param program, the program containing the uniform to get
     //! \param outputUniform, the empty uniform structure to be filled containing the metadata required
@@ -471,8 +482,12 @@ namespace Render
     //! Creates a buffer optimized for uniform usage
     //! \param bufferSize, the size of the buffer to be used in bytes
     //! \return outputBuffer the output struct to be filled
+    //! \param transient, true to write the buffer in the uniform ring (UniformRing.h) instead of its own storage.
+    //!        Every SetBuffer then takes a new range of the ring, so a buffer rewritten every frame or every draw
+    //!        does not wait for the GPU. The contents only last until the end of the frame (Context::Swap),
+    //!        a transient buffer must be written again every frame before it is bound.
     //! \note Uniform buffers are dynamic and unable to get written through compute. They can only be bound as cbuffers.
-    BufferRef CreateUniformBuffer(int bufferSize);
+    BufferRef CreateUniformBuffer(int bufferSize, bool transient = false);
     
     //! Creates a buffer that will contain read / write access for compute.
     //! \param the size of the buffer
@@ -561,6 +576,7 @@ namespace Render
     //! \param size, the size of the src buffer to copy to dstBuffer in bytes. If -1, 
     //!        it will use the size registered in dstBuffer
     //! \param offset, the offset to use
+    //! \note A write of a transient uniform buffer replaces all its contents, the bytes not written are undefined
     void SetBuffer(BufferRef& dstBuffer, const void * src, int size = -1, int offset = 0);
 
     //! Sets the uniform value to a texture
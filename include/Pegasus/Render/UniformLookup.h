@@ -0,0 +1,90 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   UniformLookup.h
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Hashed index of the uniforms of a program, shared by the render backends
+
+#ifndef PEGASUS_RENDER_UNIFORMLOOKUP_H
+#define PEGASUS_RENDER_UNIFORMLOOKUP_H
+
+#include "Pegasus/Render/Render.h"
+
+namespace Pegasus
+{
+namespace Alloc
+{
+    class IAllocator;
+}
+
+namespace Render
+{
+
+//! Set the name of a uniform and the hash of that name (Utils::HashStr), in one pass over the name
+//! \param outputUniform Uniform to name, its location is not changed
+//! \param name Name of the uniform, truncated to PEGASUS_RENDER_MAX_UNIFORM_NAME_LEN - 1 characters
+void SetUniformName(Uniform& outputUniform, const char * name);
+
+//! Hashed index of the uniforms of a program, from the hash of a uniform name (Uniform::mNameHash)
+//! to the index of the uniform in the reflection data of the backend.
+//! Built when the program links, so a uniform location is found without comparing the name with
+//! every uniform of the program. Different names can share a hash, the backend compares the name
+//! of each candidate.
+class UniformLookup
+{
+public:
+
+    //! Constructor, the index is empty
+    UniformLookup();
+
+    //! Destructor
+    ~UniformLookup();
+
+    //! Remove every uniform, keeping the storage
+    void Clear();
+
+    //! Add a uniform to the index
+    //! \param allocator Allocator of the storage, the same for every call
+    //! \param nameHash Hash of the name of the uniform
+    //! \param index Index of the uniform in the reflection data, >= 0
+    void Add(Alloc::IAllocator * allocator, unsigned int nameHash, int index);
+
+    //! Find the uniforms with a name hash
+    //! \param nameHash Hash of the name to find
+    //! \param cursor 0 to get the first candidate, then passed back to get the next one
+    //! \return Index of the next uniform with that hash, -1 if there are no more
+    int Find(unsigned int nameHash, unsigned int& cursor) const;
+
+    //! Get the number of uniforms of the index
+    //! \return Uniform count
+    unsigned int GetCount() const { return mCount; }
+
+private:
+
+    // No copies allowed
+    PG_DISABLE_COPY(UniformLookup);
+
+    //! Slot of the open addressing table, empty when the index is -1
+    struct Entry
+    {
+        unsigned int mHash;
+        int mIndex;
+    };
+
+    //! Double the size of the table and insert the uniforms again
+    void Grow(Alloc::IAllocator * allocator);
+
+    Alloc::IAllocator * mAllocator;
+    Entry * mEntries;
+    unsigned int mCapacity;
+    unsigned int mCount;
+};
+
+}
+}
+
+#endif  // PEGASUS_RENDER_UNIFORMLOOKUP_H
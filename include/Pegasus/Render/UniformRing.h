@@ -0,0 +1,153 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   UniformRing.h
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Ring sub-allocator of the transient uniform buffers. Keeps the offsets, the
+//!         alignment and the frames the GPU still reads, the backends own the memory.
+
+#ifndef PEGASUS_RENDER_UNIFORMRING_H
+#define PEGASUS_RENDER_UNIFORMRING_H
+
+namespace Pegasus
+{
+namespace Render
+{
+
+//! Counters of a uniform ring, reset by UniformRing::ResetStats()
+struct UniformRingStats
+{
+    unsigned int mAllocationCount;      //!< Successful allocations
+    unsigned int mAllocatedBytes;       //!< Bytes given to the allocations, sizes rounded up to the alignment
+    unsigned int mWrapBytes;            //!< Bytes skipped at the end of the ring when an allocation did not fit before the end
+    unsigned int mWrapCount;            //!< Times the allocations wrapped to the start of the ring
+    unsigned int mFullCount;            //!< Allocations refused because the frames in flight still use the space
+    unsigned int mRetiredFrameCount;    //!< Frames the GPU completed, their space was reused
+
+    UniformRingStats()
+    :   mAllocationCount(0), mAllocatedBytes(0), mWrapBytes(0), mWrapCount(0), mFullCount(0), mRetiredFrameCount(0)
+    {
+    }
+};
+
+//! Ring sub-allocator of uniform data written every frame.
+//! Every write of a transient uniform buffer takes a new range of the ring, so the GPU can still
+//! read the ranges of the previous frames while the CPU writes the current one, without a rename
+//! or a synchronization of the driver. The ranges of a frame are released together once the GPU
+//! completed the frame: EndFrame() closes the frame and gives its fence, the backend calls
+//! RetireFrame() for the oldest frame once that fence passed.
+//! The class only does the bookkeeping, no memory is allocated and no render API is called.
+class UniformRing
+{
+public:
+
+    //! Largest number of frames waiting for the GPU
+    static const unsigned int MAX_FRAMES_IN_FLIGHT = 8;
+
+    //! Constructor, the ring is empty until initialized
+    UniformRing();
+
+    //! Set the size of the ring and remove every allocation
+    //! \param capacity Size of the ring in bytes, multiple of the alignment
+    //! \param alignment Alignment of the offsets and of the sizes, power of 2.
+    //!                  256 bytes is the offset granularity of the DirectX 11.1 constant buffers
+    void Initialize(unsigned int capacity, unsigned int alignment);
+
+    //! Allocate a range of the current frame
+    //! \param size Size of the range in bytes, rounded up to the alignment
+    //! \param outOffset Offset of the range in the ring, multiple of the alignment
+    //! \return True on success, false if the frames in flight use the space, retire a frame and retry
+    bool Allocate(unsigned int size, unsigned int& outOffset);
+
+    //! Close the current frame. Its ranges stay in use until it is retired.
+    //! \note Fails if MAX_FRAMES_IN_FLIGHT frames are in flight, retire a frame first
+    //! \return Fence of the closed frame
+    unsigned int EndFrame();
+
+    //! Release the ranges of the oldest frame in flight, once the GPU completed it
+    void RetireFrame();
+
+    //! Get the number of frames closed and not retired
+    //! \return Frame count, up to MAX_FRAMES_IN_FLIGHT
+    unsigned int GetPendingFrameCount() const { return mFrameCount; }
+
+    //! Get the fence of the oldest frame in flight
+    //! \return Fence given by EndFrame() for that frame, the fence of the current frame if none is in flight
+    unsigned int GetOldestPendingFence() const;
+
+    //! Get the fence of the current frame, the one EndFrame() gives when closing it
+    //! \return Fence, incremented by every EndFrame()
+    unsigned int GetCurrentFence() const { return mCurrentFence; }
+
+    //! Get the offset of the next allocation when it does not wrap
+    //! \return Offset in bytes
+    unsigned int GetHead() const { return mHead; }
+
+    //! Get the offset of the oldest range in use, equal to the head when the ring is empty
+    //! \return Offset in bytes
+    unsigned int GetTail() const { return mUsed > mHead ? mCapacity - (mUsed - mHead) : mHead - mUsed; }
+
+    //! Get the bytes in use by the current frame and the frames in flight, wrap bytes included
+    //! \return Bytes in use
+    unsigned int GetUsedBytes() const { return mUsed; }
+
+    //! Get the size of the ring
+    //! \return Capacity in bytes
+    unsigned int GetCapacity() const { return mCapacity; }
+
+    //! Get the alignment of the allocations
+    //! \return Alignment in bytes
+    unsigned int GetAlignment() const { return mAlignment; }
+
+    //! Get the counters of the ring
+    //! \return Counters since the last reset
+    const UniformRingStats & GetStats() const { return mStats; }
+
+    //! Reset the counters
+    void ResetStats() { mStats = UniformRingStats(); }
+
+private:
+
+    //! Frame waiting for the GPU
+    struct Frame
+    {
+        unsigned int mFence;    //!< Fence given by EndFrame()
+        unsigned int mBytes;    //!< Bytes allocated during the frame, wrap bytes included
+    };
+
+    unsigned int mCapacity;
+    unsigned int mAlignment;
+    unsigned int mHead;
+    unsigned int mUsed;
+    unsigned int mCurrentFrameBytes;
+    unsigned int mCurrentFence;
+
+    //! Frames in flight, a circular queue starting at mFirstFrame
+    Frame mFrames[MAX_FRAMES_IN_FLIGHT];
+    unsigned int mFirstFrame;
+    unsigned int mFrameCount;
+
+    UniformRingStats mStats;
+};
+
+//! \name Uniform ring of the render backend, implemented by the backends
+//@{
+
+//! Get the uniform ring of the transient uniform buffers
+//! \return The ring, not initialized before the first write of a transient buffer
+const UniformRing & GetUniformRing();
+
+//! Close the frame of the uniform ring and retire the frames the GPU completed.
+//! Called by Context::Swap(), a transient uniform buffer must be written again after it.
+void EndUniformRingFrame();
+
+//@}
+
+}
+}
+
+#endif  // PEGASUS_RENDER_UNIFORMRING_H
@@ -126,6 +126,15 @@ public:
         Math::Plane planes[MAX_PLANE_COUNT];
         Math::Vec3 points[MAX_POINTS];
         CollisionState GetCollisionState(const Math::Vec3& aabbMin, const Math::Vec3& aabbMax) const;
+
+        //! Batch version of GetCollisionState, for boxes stored as 6 planes of floats (see Math::CullAabbsSoa)
+        //! \param insideMask Receives a bit set for each INSIDE box, Math::GetCullMaskSize(count) words
+        //! \param outsideMask Receives a bit set for each OUTSIDE box, Math::GetCullMaskSize(count) words.
+        //!                    The other boxes INTERSECT.
+        //! \param boxes First box, in the min x plane
+        //! \param pitch Float count between two planes of boxes
+        //! \param count Number of boxes
+        void GetCollisionStates(Math::PUInt32* insideMask, Math::PUInt32* outsideMask, const float* boxes, int pitch, int count) const;
     };
 
     //! Gets the camera world space frustum
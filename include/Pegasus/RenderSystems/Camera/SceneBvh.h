@@ -0,0 +1,104 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   SceneBvh.h
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  Bounding volume hierarchy resource, letting the render scripts cull their objects
+//!         (instanced meshes, lights...) against a camera, or pick them with rays, before issuing draws.
+
+#ifndef PEGASUS_CAMERA_SCENEBVH_H
+#define PEGASUS_CAMERA_SCENEBVH_H
+
+#include "Pegasus/RenderSystems/Config.h"
+#include "Pegasus/Application/GenericResource.h"
+#include "Pegasus/Math/BoundingVolumeHierarchy.h"
+#include "Pegasus/BlockScript/FunCallback.h"
+#include "Pegasus/Utils/Vector.h"
+#include "Pegasus/Core/Ref.h"
+
+#if RENDER_SYSTEM_CONFIG_ENABLE_CAMERA
+
+namespace Pegasus {
+namespace Camera {
+
+class Camera;
+
+//! Bounding volume hierarchy over the boxes of the objects of a render script.
+//! Each object has a user data (an index in the script, a light handle...), returned by the queries.
+//! The results of the last frustum or overlap query are kept, and read one by one by the script.
+//! AddObject and RemoveObject rebuild the whole tree at the next update, so scripts add their objects
+//! once (in their init) and move them every frame with UpdateObject, which only refits the tree.
+class SceneBvh : public Application::GenericResource
+{
+    BEGIN_DECLARE_PROPERTIES(SceneBvh, GenericResource)
+    END_DECLARE_PROPERTIES()
+
+public:
+
+    //! Constructor
+    //! \param allocator Allocator of the tree and of the results
+    SceneBvh(Alloc::IAllocator* allocator);
+
+    //! Destructor
+    virtual ~SceneBvh();
+
+    //! Brings the tree up to date with the objects added, moved and removed since the last update.
+    virtual void Update();
+
+    //! Gets the hierarchy of the objects
+    Math::BoundingVolumeHierarchy& GetBvh() { return mBvh; }
+
+    //! Finds the objects inside or intersecting the world frustum of a camera
+    //! \param cam the camera to cull with
+    //! \return the number of objects found, read with GetResult
+    int CullFrustum(const Camera& cam);
+
+    //! Finds the objects whose box overlaps a box
+    //! \param box the box to test
+    //! \return the number of objects found, read with GetResult
+    int QueryOverlap(const Math::AxisAlignedBoundingBox& box);
+
+    //! Gets the user data of an object found by the last CullFrustum or QueryOverlap
+    //! \param index index of the result, smaller than the count returned by the query
+    //! \return the user data of the object, -1 if the index is invalid
+    int GetResult(int index) const;
+
+    //! Finds the first object box hit by a ray
+    //! \param ray the ray to test
+    //! \param maxDistance distance after which the hits are ignored
+    //! \return the user data of the object hit, -1 if none
+    int RayCast(const Math::Ray& ray, float maxDistance);
+
+    //! Gets the distance of the hit of the last RayCast
+    //! \return the distance from the ray origin to the box hit, maxDistance if there was no hit
+    float GetRayHitDistance() const { return mRayHitDistance; }
+
+    //! Gets the block script functions and methods of this resource
+    //! \param methods receives the methods of SceneBvh
+    //! \param functions receives the functions creating SceneBvh
+    static void GetBlockScriptApi(Utils::Vector<BlockScript::FunctionDeclarationDesc>& methods, Utils::Vector<BlockScript::FunctionDeclarationDesc>& functions);
+
+private:
+    //! Brings the tree up to date, and grows the result array to hold all the objects
+    void PrepareQuery();
+
+    Alloc::IAllocator* mAllocator;
+    Math::BoundingVolumeHierarchy mBvh;
+    int* mResults;
+    int mResultCapacity;
+    int mResultCount;
+    float mRayHitDistance;
+};
+
+typedef Pegasus::Core::Ref<SceneBvh> SceneBvhRef;
+
+
+}   // namespace Camera
+}   // namespace Pegasus
+
+#endif // RENDER_SYSTEM_CONFIG_ENABLE_CAMERA
+#endif  // PEGASUS_CAMERA_SCENEBVH_H
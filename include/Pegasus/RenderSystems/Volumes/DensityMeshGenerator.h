@@ -0,0 +1,97 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   DensityMeshGenerator.h
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  CPU marching cubes mesh generator, polygonizes a density field without the GPU.
+
+#ifndef PEGASUS_DENSITY_MESH_GENERATOR
+#define PEGASUS_DENSITY_MESH_GENERATOR
+
+#include "Pegasus/RenderSystems/Config.h"
+#if RENDER_SYSTEM_CONFIG_ENABLE_VOLUMES
+
+#include "Pegasus/Mesh/MeshGenerator.h"
+#include "Pegasus/Texture/Texture.h"
+#include "Pegasus/Math/Vector.h"
+
+namespace Pegasus
+{
+namespace RenderSystems
+{
+
+//! Mesh generator polygonizing the iso surface of a density field on the CPU.
+//! The field is either a 3d texture set with SetDensityTexture(), or a cubic grid of
+//! DensityDim samples per side filled with SetDensitySample() (from blockscript for instance).
+//! Densities greater than IsoLevel are inside the surface.
+class DensityMeshGenerator : public Mesh::MeshGenerator
+{
+    DECLARE_MESH_GENERATOR_NODE(DensityMeshGenerator)
+
+    //! Property declarations
+    BEGIN_DECLARE_PROPERTIES(DensityMeshGenerator, MeshGenerator)
+        DECLARE_PROPERTY(int, DensityDim, 32)
+        DECLARE_PROPERTY(float, IsoLevel, 0.5f)
+        DECLARE_PROPERTY(float, VoxelSize, 1.0f)
+        DECLARE_PROPERTY(Math::Vec3, Origin, Math::Vec3(0.0f, 0.0f, 0.0f))
+    END_DECLARE_PROPERTIES()
+
+public:
+
+    //! Limits of the sample grid size, the largest surfaces have to fit 16 bit indices
+    enum
+    {
+        MinDensityDim = 2,
+        MaxDensityDim = 128
+    };
+
+    //! Density mesh generator constructor
+    //!\param nodeAllocator the allocator for the node properties (if any)
+    //!\param nodeDataAllocator the allocator of the node data
+    DensityMeshGenerator(Pegasus::Alloc::IAllocator* nodeAllocator,
+                  Pegasus::Alloc::IAllocator* nodeDataAllocator);
+
+    virtual ~DensityMeshGenerator();
+
+    //! Override of Update, also regenerates the mesh when the density texture is dirty
+    virtual bool Update();
+
+    //! Sets a sample of the density grid. Samples out of the grid are ignored.
+    //! Resizing the grid with DensityDim clears all the samples.
+    void SetDensitySample(int x, int y, int z, float density);
+
+    //! Sets a 3d texture as the density field, replacing the sample grid.
+    //! R8_UNORM, RGBA_8_UNORM (red channel) and R32_FLOAT textures are supported.
+    //! \param texture density texture, nullptr to go back to the sample grid
+    void SetDensityTexture(Texture::TextureIn texture);
+
+protected:
+
+    //! Generate the content of the data associated with the mesh generator
+    virtual void GenerateData();
+
+private:
+
+    //! Reallocates the sample grid if DensityDim changed
+    void UpdateSampleGrid();
+
+    //! Converts the density texture into samples
+    //! \return false if the texture cannot be used as a density field
+    bool ReadDensityTexture(int& dimX, int& dimY, int& dimZ);
+
+    float* mSamples;
+    int mSampleDim;
+    float* mTextureSamples;
+    int mTextureSampleCount;
+    Texture::TextureRef mDensityTexture;
+};
+
+}
+}
+
+#endif
+#endif
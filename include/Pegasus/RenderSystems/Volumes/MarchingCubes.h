@@ -0,0 +1,66 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MarchingCubes.h
+//! \author Kleber Garcia
+//! \date   October 18th 2026
+//! \brief  CPU marching cubes over a density grid, using the same case table and
+//!         edge conventions as the terrain compute shaders.
+
+#ifndef PEGASUS_MARCHING_CUBES_H
+#define PEGASUS_MARCHING_CUBES_H
+
+#include "Pegasus/RenderSystems/Config.h"
+
+#if RENDER_SYSTEM_CONFIG_ENABLE_VOLUMES
+
+#include "Pegasus/Math/Vector.h"
+#include "Pegasus/Allocator/IAllocator.h"
+
+namespace Pegasus
+{
+
+namespace Mesh
+{
+    class MeshData;
+}
+
+namespace RenderSystems
+{
+
+class CaseTable;
+
+//! Density samples on a regular grid. Sample (x, y, z) is mSamples[(z * mDimY + y) * mDimX + x]
+struct DensityGrid
+{
+    const float* mSamples;
+    int mDimX;
+    int mDimY;
+    int mDimZ;
+};
+
+//! Polygonizes the iso surface of a density grid into StdVertex triangles.
+//! Samples greater than the iso level are inside the surface.
+//! Each crossed grid edge produces one vertex shared by all the triangles touching it,
+//! with a normal computed from the density gradient. Slices of the grid are processed
+//! through Core::ParallelFor, and the output does not depend on the thread count.
+//! \param caseTable initialized case table
+//! \param grid density samples, at least 2 in each dimension
+//! \param isoLevel density of the surface
+//! \param origin position of the sample (0, 0, 0)
+//! \param voxelSize distance between two consecutive samples
+//! \param meshData output mesh, vertex stream 0 has to be StdVertex. Vertices and indices are reallocated.
+//! \param allocator allocator for the temporary buffers
+//! \return false if the surface needs more vertices than 16 bit indices can address, meshData is then left empty
+bool PolygonizeDensityGrid(const CaseTable& caseTable, const DensityGrid& grid, float isoLevel,
+                           const Math::Vec3& origin, float voxelSize,
+                           Mesh::MeshData* meshData, Alloc::IAllocator* allocator);
+
+}
+}
+
+#endif
+#endif
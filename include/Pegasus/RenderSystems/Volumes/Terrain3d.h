@@ -99,6 +99,7 @@ private:
     void PushStack(const Segment& s);
     const Segment& PopStack();
     void RegisterSegment(const Segment& s);
+    void SplitSegment(const Segment& s);
     void UpdateTerrainLodBoundingBoxes();
 
     Camera::CameraRef mCamera;
@@ -111,6 +112,11 @@ private:
     Utils::Vector<Segment> mSegmentStack;
     unsigned int mSegmentStackSize;
 
+    //! Segments culled in one batch, their boxes (6 planes of floats) and the culling masks (inside then outside)
+    Utils::Vector<Segment> mCullBatch;
+    Utils::Vector<float> mCullBoxes;
+    Utils::Vector<Math::PUInt32> mCullMasks;
+
     Box mLodBoundingBoxes[MAXIMUM_LODS];
     Segment mTerrainCoverBoxes[MAXIMUM_TERRAIN_COVER_BOXES];
 
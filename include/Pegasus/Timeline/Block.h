@@ -41,6 +41,10 @@ namespace Pegasus {
     namespace Wnd {
         class Window;
     }
+
+    namespace PropertyGrid {
+        class PropertySnapshot;
+    }
 }
 
 namespace Pegasus {
@@ -57,6 +61,8 @@ class Block : public PropertyGrid::PropertyGridObject
         DECLARE_PROPERTY(Math::Color8RGB, Color, Math::Color8RGB(128,128,128));
         DECLARE_PROPERTY(unsigned int, Beat, 0);
         DECLARE_PROPERTY(unsigned int, Duration, 1);
+        //! Dependency group of the concurrent update, see UpdateConcurrent()
+        DECLARE_PROPERTY(int, UpdateGroup, 0);
     END_DECLARE_PROPERTIES()
 
 public:
@@ -101,16 +107,51 @@ public:
     //! \return the script object, null if not attached
     TimelineScriptReturn GetScript();
 
-    //! Update the content of the block, called once at the beginning of each rendered frame
+    //! Prepare the update of the block, recompiling its script if needed.
+    //! Called on the main thread, before the concurrent updates of the frame.
+    void PrepareUpdate();
+
+    //! Update of the block running concurrently with the blocks of the other lanes, runs the script update.
+    //! Blocks with the same UpdateGroup property (when not 0) never run at the same time,
+    //! and run in the order of their lanes. Use a group for blocks whose scripts write to shared resources.
+    //! \param updateInfo Current beat relative to the beginning of the block,
+    //!             can have fractional part (>= 0.0f)
+    virtual void UpdateConcurrent(const UpdateInfo& updateInfo);
+
+    //! Send the change events of the node properties written by the script of the block
+    //! during UpdateConcurrent() or a render on a worker thread. Main thread only.
+    void FlushPropertyChanges();
+
+    //! Update the content of the block, called once at the beginning of each rendered frame.
+    //! Called on the main thread after every UpdateConcurrent() of the frame, in the order of the lanes,
+    //! updates the nodes of the script.
     //! \param updateInfo Current beat relative to the beginning of the block,
     //!             can have fractional part (>= 0.0f)
     virtual void Update(const UpdateInfo& updateInfo);
 
+    //! Capture the property values read by the render of the block, at the end of the update of the frame:
+    //! the properties of the block and of the nodes created by its script
+    //! \param snapshot snapshot of the frame, published for the render
+    virtual void CaptureRenderProperties(PropertyGrid::PropertySnapshot& snapshot);
+
     //! Render the content of the block
     //! \param renderInfo - beat Current beat relative to the beginning of the block,
     //!             can have fractional part (>= 0.0f)
     virtual void Render(const RenderInfo& renderInfo);
 
+    //! Prepare the render of the block, running the lazy window initializations of the block and of its script.
+    //! Called on the main thread before a Render() running on a worker thread.
+    //! \param renderInfo render information of the frame
+    void PrepareRender(const RenderInfo& renderInfo);
+
+    //! Test if the render of the block can run on a worker thread, recording into renderInfo.commandBuffer
+    //! (see Timeline::SetConcurrentRender()). The render API calls of the script are recorded,
+    //! blocks overriding Render() with direct calls to the render API have to return false.
+    //! Scripts creating resources or resolving uniforms in their render stay on the main thread
+    //! (see TimelineScriptRunner::CanRenderConcurrently()).
+    //! \return True if Render() can record into the command buffer of the render info
+    virtual bool CanRenderConcurrently() const { return mScriptRunner.CanRenderConcurrently(); }
+
     //! Callback for when a window is created.
     virtual void OnWindowCreated(int windowIndex);
 
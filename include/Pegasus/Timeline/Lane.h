@@ -14,6 +14,7 @@
 
 #include "Pegasus/Timeline/Shared/LaneDefs.h"
 #include "Pegasus/Timeline/Shared/TimelineDefs.h"
+#include "Pegasus/Timeline/LaneCursor.h"
 #include "Pegasus/Timeline/Proxy/LaneProxy.h"
 
 namespace Pegasus {
@@ -121,19 +122,38 @@ public:
     // Tell all the blocks of the lane to uninitialize their content
     void UninitializeBlocks();
 
-    //! Update the content of the lane for the given window (done once per frame if active)
+    //! Update the content of the lane for the given window (done once per frame if active).
+    //! Runs every update step of the current block on the calling thread.
     //! \param update information.
     void Update(UpdateInfo& updateInfo);
 
+    //! Find the current block of the lane and prepare its update (see Block::PrepareUpdate()).
+    //! The timeline then runs Block::UpdateConcurrent() and Block::Update() on the returned block.
+    //! \param beat Current beat of the timeline, measured in ticks
+    //! \param relativeBeat Output beat relative to the beginning of the block
+    //! \return Current block, nullptr if the beat is not on a block
+    Block * PrepareUpdate(float beat, float & relativeBeat);
+
     //! Render the content of the lane for the given window
     //! \param render information
     void Render(RenderInfo& renderInfo);
 
+    //! Render a block of the lane for the given window, found beforehand (for example by the update of a render snapshot)
+    //! \param block block to render, nullptr when the lane has no block at the beat
+    //! \param render information, with the relative beat of the block
+    void RenderBlock(Block* block, const RenderInfo& renderInfo);
+
+    //! Prepare the render of a block of the lane, running the lazy window initializations (see Block::PrepareRender()).
+    //! Called on the main thread before RenderBlock() runs on a worker thread.
+    //! \param block block to render, nullptr when the lane has no block at the beat
+    //! \param render information, with the relative beat of the block
+    void PrepareRenderBlock(Block* block, const RenderInfo& renderInfo);
+
 
 #if PEGASUS_ENABLE_PROXIES
 
     //! Get the list of blocks of the lane
-    //! \param blocks Allocated array of LANE_MAX_NUM_BLOCKS pointers to IBlockProxy,
+    //! \param blocks Allocated array of GetNumBlocks() pointers to IBlockProxy,
     //!               contains the resulting list of block proxy pointers.
     //! \note Only the valid blocks have their pointers updated
     //! \return Number of block proxy pointers written to the \a blockList array (<= LANE_MAX_NUM_BLOCKS)
@@ -174,12 +194,16 @@ public:
 
 private:
 
-    //! Given a beat on the timeline, return the index of the current (or previous) block
+    //! Given a beat on the timeline, return the index of the current (or previous) block.
+    //! Uses the playback cursor, so consecutive calls with increasing beats are amortized constant time
     //! \param beat Input beat, measured in ticks
     //! \return Resulting block index intersected by the given beat,
     //!         or just before the beat if the next block is not reached yet.
     //!         INVALID_RECORD_INDEX if the beat is before the first beat, or no block is defined on the timeline
-    int FindCurrentBlock(Beat beat) const;
+    int FindCurrentBlock(Beat beat);
+
+    //! Rebuild the sorted block arrays from the linked list if the blocks changed since the last build
+    void UpdateSortedBlocks();
 
     //! Given a beat on the timeline, return the index of the current (or previous) block and the next one (not reached yet)
     //! \param beat Input beat, measured in ticks
@@ -192,43 +216,47 @@ private:
     void FindCurrentAndNextBlocks(Beat beat, int & currentBlockIndex, int & nextBlockIndex) const;
 
     //! Find the index of a block record in the array that is not used yet
-    //! \return Index of a block record free to use (0 <= index < LANE_MAX_NUM_BLOCKS, when mNumBlocks < LANE_MAX_NUM_BLOCKS),
-    //!         INVALID_RECORD_INDEX if the array is full (mNumBlocks == LANE_MAX_NUM_BLOCKS), or in case of error
+    //! \return Index of a block record free to use (0 <= index < mBlockCapacity, when mNumBlocks < mBlockCapacity),
+    //!         INVALID_RECORD_INDEX if the array is full (mNumBlocks == mBlockCapacity), or in case of error
     int FindFirstAvailableBlockRecord() const;
 
+    //! Double the number of block records, keeping the existing ones at the same indices
+    //! \return True if succeeded, false if the capacity is already LANE_MAX_NUM_BLOCKS
+    bool GrowBlockRecords();
+
     //! Find the index of a block record in the linked list
     //! \param block Block to find
     //! \return Index of the block record for the input block, INVALID_RECORD_INDEX if not found or in case of error
     int FindBlockIndex(Block * block) const;
 
     //! Find the index of the previous block given a block index
-    //! \param blockIndex Index of the block in the \a mBlockRecords array, < LANE_MAX_NUM_BLOCKS
-    //! \return Index of the previous block in the \a mBlockRecords array, < LANE_MAX_NUM_BLOCKS,
+    //! \param blockIndex Index of the block in the \a mBlockRecords array, < mBlockCapacity
+    //! \return Index of the previous block in the \a mBlockRecords array, < mBlockCapacity,
     //!         INVALID_RECORD_INDEX if the tested block is the first one
     int FindPreviousBlockIndex(int blockIndex) const;
 
     //! Find the index of the next block given a block index
-    //! \param blockIndex Index of the block in the \a mBlockRecords array, < LANE_MAX_NUM_BLOCKS
-    //! \return Index of the next block in the \a mBlockRecords array, < LANE_MAX_NUM_BLOCKS,
+    //! \param blockIndex Index of the block in the \a mBlockRecords array, < mBlockCapacity
+    //! \return Index of the next block in the \a mBlockRecords array, < mBlockCapacity,
     //!         INVALID_RECORD_INDEX if the tested block is the last one
     int FindNextBlockIndex(int blockIndex) const;
 
     //! Remove a block from the lane given a block record index in the linked list
-    //! \param blockIndex Index of the block in the \a mBlockRecords array, < LANE_MAX_NUM_BLOCKS
+    //! \param blockIndex Index of the block in the \a mBlockRecords array, < mBlockCapacity
     void RemoveBlock(int blockIndex);
 
     //! Set the position of a block in the lane given a block record index in the linked list
-    //! \param blockIndex Index of the block in the \a mBlockRecords array, < LANE_MAX_NUM_BLOCKS
+    //! \param blockIndex Index of the block in the \a mBlockRecords array, < mBlockCapacity
     //! \param beat New position of the block, measured in ticks
     void SetBlockBeat(int blockIndex, Beat beat);
 
     //! Set the duration of a block in the lane given a block record index in the linked list
-    //! \param blockIndex Index of the block in the \a mBlockRecords array, < LANE_MAX_NUM_BLOCKS
+    //! \param blockIndex Index of the block in the \a mBlockRecords array, < mBlockCapacity
     //! \param duration New duration of the block, measured in ticks (> 0)
     void SetBlockDuration(int blockIndex, Duration duration);
 
     //! Move a block from this lane into another lane given a block record index in the linked list
-    //! \param blockIndex Index of the block in the \a mBlockRecords array, < LANE_MAX_NUM_BLOCKS
+    //! \param blockIndex Index of the block in the \a mBlockRecords array, < mBlockCapacity
     //! \param newLane Lane to move the block into, different from the current lane, != nullptr
     //! \param beat New position of the block, measured in ticks
     void MoveBlockToLane(int blockIndex, Lane * newLane, Beat beat);
@@ -302,10 +330,14 @@ private:
     //! Invalid index for the block records
     enum { INVALID_RECORD_INDEX = -1 };
 
-    //! Set of block records, stored as linked list in a fixed size array.
+    //! Set of block records, stored as linked list in an array of mBlockCapacity records.
     //! The blocks are ordered by position from beginning to end.
     //! Only mNumBlocks block records are valid, but are in a random order
-    BlockRecord mBlockRecords[LANE_MAX_NUM_BLOCKS];
+    BlockRecord * mBlockRecords;
+
+    //! Number of allocated records in mBlockRecords, mSortedBlockBeats and mSortedBlockRecords
+    //! (LANE_INITIAL_NUM_BLOCKS, doubled when full, <= LANE_MAX_NUM_BLOCKS)
+    unsigned int mBlockCapacity;
 
     //! Index of the first block record in the table (0 by default, but can change if a block is removed)
     unsigned int mFirstBlockIndex;
@@ -313,6 +345,18 @@ private:
     //! Number of used block records in mBlockRecords (<= LANE_MAX_NUM_BLOCKS)
     unsigned int mNumBlocks;
 
+    //! Position of the blocks, in the order of the linked list, for the binary searches of the playback cursor
+    Beat * mSortedBlockBeats;
+
+    //! Block record index of each entry of mSortedBlockBeats
+    int * mSortedBlockRecords;
+
+    //! True when the blocks changed since the last build of the sorted block arrays
+    bool mSortedBlocksDirty;
+
+    //! Playback cursor, shared by the update and the render of the lane
+    LaneCursor mCursor;
+
 
 #if PEGASUS_ENABLE_PROXIES
 
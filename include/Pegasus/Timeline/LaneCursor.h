@@ -0,0 +1,70 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file	LaneCursor.h
+//! \author	Kleber Garcia
+//! \date	October 18th 2026
+//! \brief	Playback cursor, finds the current block of a lane in amortized constant time
+
+#ifndef PEGASUS_TIMELINE_LANECURSOR_H
+#define PEGASUS_TIMELINE_LANECURSOR_H
+
+#include "Pegasus/Timeline/Shared/TimelineDefs.h"
+
+namespace Pegasus {
+namespace Timeline {
+
+
+//! Playback cursor over the block positions of a lane, sorted in increasing order.
+//! Remembers the block found by the last search: when the beat moves forward, as it does
+//! during playback, the cursor steps to the next blocks. Seeks backward and long jumps
+//! fall back to a binary search.
+class LaneCursor
+{
+public:
+
+    //! Constructor, the first search is a binary search
+    LaneCursor() : mPosition(BEFORE_FIRST_BLOCK), mValid(false) { }
+
+    //! Forget the current block, to call when the blocks change
+    inline void Invalidate() { mValid = false; }
+
+    //! Find the block the beat is on or right after
+    //! \param beats Position of the blocks, measured in ticks, sorted in increasing order
+    //! \param numBlocks Number of blocks
+    //! \param beat Input beat, measured in ticks
+    //! \return Position in \a beats of the last block starting on or before the beat,
+    //!         BEFORE_FIRST_BLOCK if the beat is before the first block or there is no block
+    int Find(const Beat * beats, int numBlocks, Beat beat);
+
+    //! Binary search of the block the beat is on or right after, without using the cursor
+    //! \param beats Position of the blocks, measured in ticks, sorted in increasing order
+    //! \param numBlocks Number of blocks
+    //! \param beat Input beat, measured in ticks
+    //! \return Position in \a beats of the last block starting on or before the beat,
+    //!         BEFORE_FIRST_BLOCK if the beat is before the first block or there is no block
+    static int BinarySearch(const Beat * beats, int numBlocks, Beat beat);
+
+    //! Result of the searches when the beat is before the first block
+    enum { BEFORE_FIRST_BLOCK = -1 };
+
+    //! Number of blocks the cursor steps over before switching to a binary search
+    enum { MAX_FORWARD_STEPS = 4 };
+
+private:
+
+    //! Position of the block found by the last search, BEFORE_FIRST_BLOCK if none
+    int mPosition;
+
+    //! True if mPosition can be used as the starting point of the next search
+    bool mValid;
+};
+
+
+}   // namespace Timeline
+}   // namespace Pegasus
+
+#endif  // PEGASUS_TIMELINE_LANECURSOR_H
@@ -98,8 +98,12 @@ public:
     virtual void MoveBlockToLane(IBlockProxy * block, ILaneProxy * newLane, Beat beat);
 
 
+    //! Get the number of blocks in the lane
+    //! \return Number of blocks in the lane (<= LANE_MAX_NUM_BLOCKS)
+    virtual unsigned int GetNumBlocks() const;
+
     //! Get the list of blocks of the lane
-    //! \param blocks Allocated array of LANE_MAX_NUM_BLOCKS pointers to IBlockProxy,
+    //! \param blocks Allocated array of GetNumBlocks() pointers to IBlockProxy,
     //!               contains the resulting list of block proxy pointers.
     //! \note Only the valid blocks have their pointers updated
     //! \return Number of block proxy pointers written to the \a blockList array (<= LANE_MAX_NUM_BLOCKS)
@@ -0,0 +1,177 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file	RenderSnapshot.h
+//! \author	Kleber Garcia
+//! \date	October 18th 2026
+//! \brief	Versioned state of the timeline published by the update for the render,
+//!         double buffered so the next update never writes the snapshot being rendered
+
+#ifndef PEGASUS_TIMELINE_RENDERSNAPSHOT_H
+#define PEGASUS_TIMELINE_RENDERSNAPSHOT_H
+
+#include "Pegasus/Timeline/Shared/TimelineDefs.h"
+#include "Pegasus/PropertyGrid/PropertySnapshot.h"
+
+namespace Pegasus {
+namespace Timeline {
+
+class Block;
+
+
+//! State of the timeline at the end of an update: the beat, the current block of each lane
+//! and the property values the render reads (timeline, blocks and nodes of their render collections).
+//! Immutable once published.
+//! \warning The global variables of the scripts are not captured: the render of a block runs on the virtual machine
+//!          state of its update, and reads the globals as the last update left them. So the update of the next frame
+//!          cannot overlap the render of a timeline, Timeline::Update() and Timeline::Render() are called one after
+//!          the other by the same thread. The snapshot only isolates the render from the node edits made in between
+//!          (editor, C++ blocks), and lets the lanes of the render read the same state from several threads.
+class RenderSnapshot
+{
+public:
+
+    //! Constructor
+    //! \param allocator Allocator of the property values
+    explicit RenderSnapshot(Alloc::IAllocator * allocator);
+
+    //! Clear the snapshot before capturing a new frame
+    //! \param beat Beat of the update
+    void Reset(float beat);
+
+    //! Set the current block of a lane
+    //! \param lane Index of the lane (< MAX_NUM_LANES)
+    //! \param block Current block of the lane
+    //! \param relativeBeat Beat relative to the beginning of the block
+    void SetLaneBlock(unsigned int lane, Block * block, float relativeBeat);
+
+    //! Get the current block of a lane
+    //! \param lane Index of the lane (< MAX_NUM_LANES)
+    //! \param relativeBeat Filled with the beat relative to the beginning of the block
+    //! \return Current block of the lane, nullptr if the lane has no block at the beat
+    Block * GetLaneBlock(unsigned int lane, float & relativeBeat) const;
+
+    //! Get the version of the snapshot
+    //! \return Number of the update that published the snapshot, starting at 1
+    inline unsigned int GetVersion() const { return mVersion; }
+
+    //! Get the beat of the update
+    //! \return Beat of the update that published the snapshot
+    inline float GetBeat() const { return mBeat; }
+
+    //! Get the property values captured by the update
+    //! @{
+    inline PropertyGrid::PropertySnapshot & GetProperties() { return mProperties; }
+    inline const PropertyGrid::PropertySnapshot & GetProperties() const { return mProperties; }
+    //! @}
+
+private:
+
+    // No copies allowed
+    PG_DISABLE_COPY(RenderSnapshot);
+
+    friend class RenderSnapshotBuffer;
+
+    //! Current block of a lane
+    struct LaneBlock
+    {
+        Block * mBlock;
+        float mRelativeBeat;
+    };
+
+    //! Number of the update that published the snapshot, set by RenderSnapshotBuffer
+    unsigned int mVersion;
+
+    //! Beat of the update
+    float mBeat;
+
+    //! Current block of each lane
+    LaneBlock mLaneBlocks[MAX_NUM_LANES];
+
+    //! Property values read by the render
+    PropertyGrid::PropertySnapshot mProperties;
+};
+
+//----------------------------------------------------------------------------------------
+
+//! Double buffer of render snapshots, written by one update thread and read by one render thread.
+//! The update writes the snapshot the render is not reading and publishes it with a single atomic operation,
+//! the render reads the last published snapshot. No lock is taken: the update only waits when it needs the
+//! snapshot the render is still reading, which bounds the update to one frame ahead of the render.
+class RenderSnapshotBuffer
+{
+public:
+
+    //! Constructor
+    //! \param allocator Allocator of the snapshots
+    explicit RenderSnapshotBuffer(Alloc::IAllocator * allocator);
+
+    //! Get the snapshot to write for the next frame, update thread only.
+    //! Waits while the render thread reads that snapshot.
+    //! \return Snapshot to fill, published by Publish(), with its new version
+    RenderSnapshot * BeginWrite();
+
+    //! Publish the snapshot returned by BeginWrite(), update thread only
+    void Publish();
+
+    //! Acquire the last published snapshot, render thread only
+    //! \return Last published snapshot, nullptr if none has been published. Has to be released by ReleaseRead()
+    const RenderSnapshot * AcquireRead();
+
+    //! Release the snapshot returned by AcquireRead(), render thread only
+    void ReleaseRead();
+
+    //! Drop the published snapshot, for example when the blocks it refers to are deleted.
+    //! The next reads return nullptr until the next publish.
+    //! \warning The render thread must not hold a snapshot
+    void Invalidate();
+
+    //! Get the version of the last published snapshot
+    //! \return Version of the last published snapshot, 0 if none
+    unsigned int GetPublishedVersion() const;
+
+    //! Get the version of the last snapshot acquired by the render thread
+    //! \return Version of the last acquired snapshot, 0 if none
+    unsigned int GetAcquiredVersion() const;
+
+private:
+
+    // No copies allowed
+    PG_DISABLE_COPY(RenderSnapshotBuffer);
+
+    //! Bits of mState
+    enum
+    {
+        STATE_PUBLISHED_SLOT = 0x1,     //!< Slot of the last published snapshot
+        STATE_HAS_PUBLISHED = 0x2,      //!< Set when a snapshot has been published
+        STATE_READING_SLOT0 = 0x4,      //!< Set while the render thread reads the snapshot of slot 0
+        STATE_READING_SLOT1 = 0x8       //!< Set while the render thread reads the snapshot of slot 1
+    };
+
+    //! Snapshots of both slots
+    RenderSnapshot mSnapshot0;
+    RenderSnapshot mSnapshot1;
+    RenderSnapshot * mSnapshots[2];
+
+    //! Published slot and reading flags, only changed with atomic compare and exchange
+    volatile long mState;
+
+    //! Versions of the last published and acquired snapshots
+    volatile long mPublishedVersion;
+    volatile long mAcquiredVersion;
+
+    //! Slot written by the update thread, -1 outside of BeginWrite() and Publish()
+    int mWriteSlot;
+
+    //! Slot read by the render thread, -1 outside of AcquireRead() and ReleaseRead()
+    int mReadSlot;
+};
+
+
+}   // namespace Timeline
+}   // namespace Pegasus
+
+#endif  // PEGASUS_TIMELINE_RENDERSNAPSHOT_H
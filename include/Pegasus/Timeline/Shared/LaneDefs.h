@@ -18,7 +18,11 @@ namespace Pegasus {
 
 
 //! Maximum number of blocks allowed in the lane
-enum { LANE_MAX_NUM_BLOCKS = 64 };
+enum { LANE_MAX_NUM_BLOCKS = 1024 };
+
+//! Number of block records allocated with a lane, doubled each time the lane is full,
+//! up to LANE_MAX_NUM_BLOCKS
+enum { LANE_INITIAL_NUM_BLOCKS = 64 };
 
 
     }   // namespace Timeline
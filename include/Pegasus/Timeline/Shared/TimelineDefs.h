@@ -44,6 +44,7 @@ enum PlayMode
 {
     PLAYMODE_REALTIME,      //!< Updates the beat from the current system time when calling \a Update().
     PLAYMODE_STOPPED,       //!< Does not change the current beat when calling \a Update(). Requires \a SetCurrentBeat().
+    PLAYMODE_FIXED_STEP,    //!< Advances the beat by \a SetFixedStep() beats when calling \a Update(), ignoring the system time and the music.
 
     NUM_PLAYMODES
 };
@@ -18,6 +18,9 @@
 #include "Pegasus/AssetLib/RuntimeAssetObject.h"
 #include "Pegasus/Timeline/TimelineScript.h"
 #include "Pegasus/Timeline/TimelineScriptRunner.h"
+#include "Pegasus/Timeline/UpdateScheduler.h"
+#include "Pegasus/Timeline/TimelineTrace.h"
+#include "Pegasus/Timeline/RenderSnapshot.h"
 #include "Pegasus/Core/RefCounted.h"
 
 #if PEGASUS_ASSETLIB_ENABLE_CATEGORIES
@@ -51,6 +54,10 @@ namespace Pegasus {
     namespace Sound {
         class Sound;
     }
+
+    namespace Render {
+        class CommandBuffer;
+    }
 }
 
 namespace Pegasus {
@@ -81,6 +88,8 @@ struct RenderInfo
     float viewportHeightF;//the viewport height as a float
     float aspect;         //the aspect ratio (height / width)
     float aspectInv;      // the inverse aspect ratio
+    const RenderSnapshot* snapshot; // state published by the update being rendered, nullptr to read the live state
+    Render::CommandBuffer* commandBuffer; // command buffer recording the render of the lane, nullptr to call the render API directly
 
     RenderInfo(
         float pBeat
@@ -101,6 +110,8 @@ struct RenderInfo
      ,aspect(pAspect)
      ,aspectInv(pAspectInv)
      ,relativeBeat(0.0f) //compute as we pass it down to blocks to recycle memory
+     ,snapshot(nullptr)
+     ,commandBuffer(nullptr)
     {
     }
 };
@@ -199,11 +210,69 @@ public:
     //! Update the current state of the timeline based on the play mode and the current time
     void Update();
 
-    //! Render the content of the timeline for the given window
+    //! Set the beat increment of each update in PLAYMODE_FIXED_STEP mode.
+    //! The step is stored as the matching frame rate, so it follows the changes of tempo.
+    //! The next update evaluates the current beat, the following ones add the step each time.
+    //! \param beatStep Number of beats per update, can have fractional part (> 0.0f)
+    void SetFixedStep(float beatStep);
+
+    //! Get the beat increment of each update in PLAYMODE_FIXED_STEP mode
+    //! \return Number of beats per update, GetBeatsPerMinute() / (60 * GetFixedStepFrameRate())
+    inline float GetFixedStep() const { return mFixedStep; }
+
+    //! Set the number of updates per second of time in PLAYMODE_FIXED_STEP mode (60 by default).
+    //! The beat increment of each update is GetBeatsPerMinute() / (60 * framesPerSecond).
+    //! \param framesPerSecond Simulated frame rate, can have fractional part (> 0.0f)
+    void SetFixedStepFrameRate(float framesPerSecond);
+
+    //! Get the number of updates per second of time in PLAYMODE_FIXED_STEP mode
+    //! \return Simulated frame rate
+    inline float GetFixedStepFrameRate() const { return mFixedStepFrameRate; }
+
+    //! Run updates back to back with no render, as fast as possible, to evaluate the timeline offline.
+    //! Requires PLAYMODE_FIXED_STEP, does not need a window nor sound.
+    //! \param frameCount Number of updates to run
+    void RunUpdateOnly(unsigned int frameCount);
+
+    //! Set the trace recording the update and render timings of each frame
+    //! \param trace Trace to record into, nullptr to stop recording
+    inline void SetTrace(TimelineTrace * trace) { mTrace = trace; }
+
+    //! Get the trace recording the update and render timings of each frame
+    //! \return Current trace, nullptr when not recording
+    inline TimelineTrace * GetTrace() const { return mTrace; }
+
+    //! Render the content of the timeline for the given window.
+    //! Renders the state published by the last update (beat, current blocks and property values),
+    //! so the render does not depend on the state the next update modifies
     //! \param enumeration of the window index bound for rendering.
     //! \param window - window used to render
     void Render(int windowIndex, Wnd::Window* window);
 
+    //! Render the content of the timeline without a window, into the render target bound by the caller
+    //! (offline renders, benchmarks). Same as Render() with a window of the given size.
+    //! \param windowIndex enumeration of the window index bound for rendering.
+    //! \param width width of the render target in pixels
+    //! \param height height of the render target in pixels
+    void Render(int windowIndex, unsigned int width, unsigned int height);
+
+    //! Enable the recording of the lanes on worker threads.
+    //! The render of the block of each lane runs on the threads of Core::ParallelFor and records into a command buffer
+    //! per lane, then the command buffers are submitted in the order of the lanes on the calling thread.
+    //! The master script, and the blocks that cannot record (see Block::CanRenderConcurrently()), render on the calling
+    //! thread at their place in the order of the lanes. The draws of a lane are sorted (see Render::CommandBuffer).
+    //! \param enabled True to record the lanes concurrently, false to render them one after the other (default)
+    //! \note Only the renders reading the state of an update record, the render before the first update is not concurrent
+    inline void SetConcurrentRender(bool enabled) { mConcurrentRender = enabled; }
+
+    //! Test if the lanes are recorded on worker threads
+    //! \return True if the lanes are recorded concurrently
+    inline bool GetConcurrentRender() const { return mConcurrentRender; }
+
+    //! Get the render snapshots published by the updates
+    //! \return Double buffer of the render snapshots, the last published one is read by Render()
+    inline RenderSnapshotBuffer * GetRenderSnapshots() { return &mRenderSnapshots; }
+
     //! Set the current beat of the timeline
     //! \param beat Current beat, in number of ticks, can have fractional part
     void SetCurrentBeat(float beat);
@@ -299,6 +368,29 @@ private:
 
     void InternalClear();
 
+    //! Update task callback of the scheduler, runs the concurrent update of one block
+    //! \param task index in mBlockUpdateTasks
+    //! \param userData the timeline
+    static void RunBlockUpdateTask(int task, void* userData);
+
+    //! Publishes the render snapshot of the current update: the beat, the block updated in each lane
+    //! and the properties of the timeline, of the updated blocks and of the nodes of their scripts
+    //! \param numTasks number of blocks updated, in mBlockUpdateTasks
+    void PublishRenderSnapshot(int numTasks);
+
+    //! Recompute the beat increment of the fixed step mode from the tempo and the frame rate,
+    //! and restart the fixed step sequence from the current beat
+    void UpdateFixedStep();
+
+    //! Renders the lanes, recording the blocks that can be recorded on the worker threads, see SetConcurrentRender()
+    //! \param renderInfo render info of the frame, its relative beat is modified
+    //! \param snapshot snapshot being rendered
+    void RenderLanesConcurrent(RenderInfo& renderInfo, const RenderSnapshot * snapshot);
+
+    //! ParallelFor callback, records the lanes of the render tasks [begin, end)
+    //! \param userData the timeline
+    static void RunLaneRenderTasks(int begin, int end, void* userData);
+
     // The timeline cannot be copied
     PG_DISABLE_COPY(Timeline)
 
@@ -354,9 +446,66 @@ private:
     //! Pegasus time returned by \a GetPegasusTime() when the timeline was started being played
     double mStartPegasusTime;
 
+    //! Number of updates per second of time in PLAYMODE_FIXED_STEP mode
+    float mFixedStepFrameRate;
+
+    //! Number of beats per update in PLAYMODE_FIXED_STEP mode, derived from the tempo and mFixedStepFrameRate
+    float mFixedStep;
+
+    //! Beat of the first update in PLAYMODE_FIXED_STEP mode
+    float mFixedStepStartBeat;
+
+    //! Number of updates since mFixedStepStartBeat, the beat is computed from it
+    //! so no error accumulates over long runs
+    unsigned int mFixedStepFrame;
+
+    //! Trace recording the timings of each frame, nullptr when not recording
+    TimelineTrace * mTrace;
+
     //! script helper object
     TimelineScriptRunner mScriptRunner;
 
+    //! Block to update in a lane for the current frame
+    struct BlockUpdateTask
+    {
+        Block * mBlock;
+        float mRelativeBeat;
+        unsigned int mLane;
+    };
+
+    //! Blocks to update for the current frame, at most one per lane, in the order of the lanes
+    BlockUpdateTask mBlockUpdateTasks[MAX_NUM_LANES];
+
+    //! UpdateGroup property of each block of mBlockUpdateTasks
+    int mBlockUpdateGroups[MAX_NUM_LANES];
+
+    //! Scheduler of the concurrent block updates
+    UpdateScheduler mUpdateScheduler;
+
+    //! State published by each update for the render
+    RenderSnapshotBuffer mRenderSnapshots;
+
+    //! Block to render in a lane for the current frame
+    struct LaneRenderTask
+    {
+        Lane * mLane;
+        Block * mBlock;
+        float mRelativeBeat;
+        bool mRecorded;     //!< True when recorded into the command buffer of the task
+    };
+
+    //! Lanes to render for the current frame, at most one task per lane, in the order of the lanes
+    LaneRenderTask mLaneRenderTasks[MAX_NUM_LANES];
+
+    //! Command buffer of each render task, created on first use and kept from one frame to the other
+    Render::CommandBuffer * mLaneCommandBuffers[MAX_NUM_LANES];
+
+    //! Render info of the frame whose lanes are being recorded
+    const RenderInfo * mLaneRenderInfo;
+
+    //! True to record the lanes on worker threads
+    bool mConcurrentRender;
+
     //! True if the start time has been modified to synchronize the beat of the timeline with the music
     bool mSyncedToMusic;
 
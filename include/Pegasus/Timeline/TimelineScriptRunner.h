@@ -42,6 +42,7 @@ namespace Pegasus {
 
     namespace PropertyGrid {
         class PropertyGridObject;
+        class PropertySnapshot;
     }
 }
 
@@ -94,14 +95,47 @@ public:
     //! \param index - index to update
     void NotifyInternalObjectPropertyUpdated(unsigned int index);
 
-    //! Update the content of the block, called once at the beginning of each rendered frame
+    //! Update the content of the block, called once at the beginning of each rendered frame.
+    //! Same as calling PrepareUpdate(), CallUpdateScript() then UpdateNodes().
     //! \param update information.
     void CallUpdate(const UpdateInfo& updateInfo);
 
-    //! Render the content of the block
+    //! First step of the update, recompiles the script if it changed. Main thread only.
+    void PrepareUpdate();
+
+    //! Second step of the update, runs the update function of the script.
+    //! Only touches the virtual machine state of this runner, so runners can be updated concurrently
+    //! as long as their scripts do not write to shared resources.
+    //! \param update information.
+    void CallUpdateScript(const UpdateInfo& updateInfo);
+
+    //! Sends the change events of the node properties written by the script since the last flush,
+    //! after CallUpdateScript() or CallRender() ran on a worker thread. Main thread only.
+    void FlushPropertyChanges();
+
+    //! Last step of the update, updates the nodes created by the script. Main thread only, after FlushPropertyChanges().
+    void UpdateNodes();
+
+    //! Capture the property values read by the render: the property grid of the runner
+    //! and the nodes created by the script. Main thread only, after UpdateNodes().
+    //! \param snapshot snapshot of the frame
+    void CaptureRenderProperties(PropertyGrid::PropertySnapshot& snapshot);
+
+    //! Render the content of the block.
+    //! When the render info has a snapshot, the script reads the node properties from it.
     //! \param render information used.
     void CallRender(const RenderInfo& renderInfo);
 
+    //! Run the lazy window initialization of the script, on the main thread before a CallRender() from a worker thread.
+    //! \param windowIndex - index of the window rendered.
+    void PrepareRender(int windowIndex);
+
+    //! Test if the render of the script can record on a worker thread.
+    //! The first render after the initialization of the script runs on the main thread, and the script
+    //! keeps rendering there when its render creates resources or nodes, or resolves uniforms.
+    //! \return true if CallRender() can record into the command buffer of the render info
+    bool CanRenderConcurrently() const;
+
     //! Call window creation.
     //! \param windowIndex - index of the window to create.
     void CallWindowCreated(int windowIndex);
@@ -114,6 +148,10 @@ public:
     //Gets the property grid that this runner is using to dispatch externs
     PropertyGrid::PropertyGridObject* GetPropertyGrid() { return mPropertyGrid; }
 
+    //! Gets the collection of the nodes and resources created by the script
+    //! \return the render collection of the virtual machine state of this runner
+    Application::RenderCollection* GetRenderCollection();
+
     //Sets the global cache to be used by this blockscript
     //! \param globalCache to own
     //! \param controlReset controls the reset of this global cache. Only one script runner is allowed to do this (the master script).
@@ -146,6 +184,9 @@ private:
     //! version of the script, used for global variable initialization
     int mScriptVersion;
 
+    //! true once the script has rendered on the main thread since its initialization
+    bool mHasRenderedOnMainThread;
+
     //! Boolean that decides if we control the reset of the global cache.
     bool mControlGlobalCacheReset;
 
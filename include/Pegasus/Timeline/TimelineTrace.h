@@ -0,0 +1,90 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file	TimelineTrace.h
+//! \author	Kleber Garcia
+//! \date	October 18th 2026
+//! \brief	Per frame timings of the timeline update and render phases
+
+#ifndef PEGASUS_TIMELINE_TIMELINETRACE_H
+#define PEGASUS_TIMELINE_TIMELINETRACE_H
+
+#include "Pegasus/Utils/Vector.h"
+#include "Pegasus/Core/Io.h"
+
+namespace Pegasus {
+namespace Timeline {
+
+
+//! Records how long the update and the render of each frame of a timeline take.
+//! Attach it to a timeline with Timeline::SetTrace(), then save it as CSV to compare runs.
+class TimelineTrace
+{
+public:
+
+    //! Timings of one frame
+    struct Frame
+    {
+        float mBeat;            //!< Beat of the frame
+        double mUpdateSeconds;  //!< Duration of Timeline::Update()
+        double mRenderSeconds;  //!< Total duration of the Timeline::Render() calls of the frame (one per window)
+    };
+
+    //! Constructor
+    //! \param allocator Allocator of the frame list
+    explicit TimelineTrace(Alloc::IAllocator * allocator);
+
+    //! Destructor
+    ~TimelineTrace();
+
+    //! Remove all the recorded frames
+    void Clear();
+
+    //! Start a new frame, called by the timeline after its update
+    //! \param beat Beat of the frame
+    //! \param updateSeconds Duration of the update
+    void AddFrame(float beat, double updateSeconds);
+
+    //! Add the duration of a render to the current frame, called by the timeline
+    //! \param renderSeconds Duration of the render
+    void AddRender(double renderSeconds);
+
+    //! Get the number of recorded frames
+    //! \return Number of frames
+    inline unsigned int GetFrameCount() const { return mFrames.GetSize(); }
+
+    //! Get a recorded frame
+    //! \param frame Index of the frame (< GetFrameCount())
+    //! \return Frame timings
+    inline const Frame & GetFrame(unsigned int frame) const { return mFrames[frame]; }
+
+    //! Get the number of frames evaluated per second, update and render included
+    //! \return Frames per second, 0 if nothing was recorded
+    double GetFramesPerSecond() const;
+
+    //! Save the frames as CSV, one line per frame: frame, beat, update ms, render ms
+    //! \param ioManager IO manager used to write the file
+    //! \param relativePath Path of the file, relative to the root of the IO manager
+    //! \return Error code of the write, ERR_NONE if successful
+    Io::IoError SaveCsv(Io::IOManager * ioManager, const char * relativePath) const;
+
+private:
+
+    // The trace cannot be copied
+    PG_DISABLE_COPY(TimelineTrace)
+
+    //! Allocator of the CSV text
+    Alloc::IAllocator * mAllocator;
+
+    //! Recorded frames, in order
+    Utils::Vector<Frame> mFrames;
+};
+
+
+}   // namespace Timeline
+}   // namespace Pegasus
+
+#endif  // PEGASUS_TIMELINE_TIMELINETRACE_H
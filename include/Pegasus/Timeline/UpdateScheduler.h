@@ -0,0 +1,77 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file	UpdateScheduler.h
+//! \author	Kleber Garcia
+//! \date	October 18th 2026
+//! \brief	Runs the update tasks of the timeline lanes concurrently, following their dependency groups
+
+#ifndef PEGASUS_TIMELINE_UPDATESCHEDULER_H
+#define PEGASUS_TIMELINE_UPDATESCHEDULER_H
+
+#include "Pegasus/Timeline/Shared/TimelineDefs.h"
+
+namespace Pegasus {
+namespace Timeline {
+
+
+//! Callback running one update task
+//! \param task index of the task
+//! \param userData user pointer given to UpdateScheduler::Run()
+typedef void (*UpdateTaskCallback)(int task, void* userData);
+
+//! Update scheduler, runs a set of tasks (one per lane) on the worker threads of Core::ParallelFor.
+//! Each task has a dependency group: tasks of group INDEPENDENT_GROUP run concurrently with any other task,
+//! tasks sharing another group run one after the other on the same thread, in increasing task order.
+class UpdateScheduler
+{
+public:
+
+    //! Maximum number of tasks of a run, one per lane
+    enum { MAX_TASKS = MAX_NUM_LANES };
+
+    //! Group of the tasks that do not depend on any other task
+    enum { INDEPENDENT_GROUP = 0 };
+
+    //! Constructor
+    UpdateScheduler();
+
+    //! Runs the tasks and returns when all of them have completed
+    //! \param taskGroups dependency group of each task
+    //! \param taskCount number of tasks (<= MAX_TASKS)
+    //! \param callback function called once per task, possibly from several threads at once
+    //! \param userData user pointer passed to every callback
+    void Run(const int * taskGroups, int taskCount, UpdateTaskCallback callback, void* userData);
+
+    //! Get the number of jobs of the last run, the tasks of a job run sequentially
+    //! \return number of jobs, <= number of tasks
+    inline int GetJobCount() const { return mJobCount; }
+
+private:
+
+    //! Splits the tasks into jobs, one per independent task and one per dependency group
+    void BuildJobs(const int * taskGroups, int taskCount);
+
+    //! ParallelFor callback, runs jobs [begin, end)
+    static void RunJobs(int begin, int end, void* userData);
+
+    //! Tasks sorted by job, the tasks of job j are mJobTasks[mJobOffsets[j] .. mJobOffsets[j + 1])
+    int mJobTasks[MAX_TASKS];
+    int mJobOffsets[MAX_TASKS + 1];
+
+    //! Number of jobs of the current run
+    int mJobCount;
+
+    //! Task callback of the current run
+    UpdateTaskCallback mCallback;
+    void* mUserData;
+};
+
+
+}   // namespace Timeline
+}   // namespace Pegasus
+
+#endif  // PEGASUS_TIMELINE_UPDATESCHEDULER_H
@@ -25,7 +25,8 @@ struct PegasusDesc
     {
         DIRECT_3D,
         OPEN_GL,
-        OPEN_GLES
+        OPEN_GLES,
+        NULL_GAPI   //!< Headless backend, no GPU object is created
     };
 
     //! Pegasus Major version number